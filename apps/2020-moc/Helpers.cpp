@@ -199,7 +199,7 @@ void solve( const MeshInfo&         meshInfo,
    UnsteadyDiffusionOperator     diffusionOperator( storage, level, level, diffusionDt, diffusivity, diffusionTimeIntegrator );
    LaplaceOperator               L( storage, level, level );
    MassOperator                  M( storage, level, level );
-   MMOCTransport< FunctionType > transport( storage, setupStorage, level, level, TimeSteppingScheme::RK4 );
+   MMOCTransport< FunctionType > transport( storage, level, level, TimeSteppingScheme::RK4 );
 
 #ifdef HYTEG_BUILD_WITH_PETSC
    PETScManager manager;
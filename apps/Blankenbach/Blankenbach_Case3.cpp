@@ -421,7 +421,7 @@ void runBenchmark( real_t      cflMax,
    LaplaceOperator                 L( storage, level, level );
    MassOperatorVelocity            MVelocity( storage, level, level );
    MassOperatorPressure            MPressure( storage, level, level );
-   MMOCTransport< ScalarFunction > transport( storage, setupStorage, level, level, TimeSteppingScheme::RK4 );
+   MMOCTransport< ScalarFunction > transport( storage, level, level, TimeSteppingScheme::RK4 );
 
    auto internalDiffusionSolver = std::make_shared< CGSolver< UnsteadyDiffusionOperator > >( storage, level, level, 5000, 1e-14 );
 
@@ -25,6 +25,7 @@
 #include "core/mpi/MPIManager.h"
 #include "core/timing/TimingJSON.h"
 
+#include "hyteg/KernelInstrumentation.hpp"
 #include "hyteg/LikwidWrapper.hpp"
 #include "hyteg/dataexport/VTKOutput.hpp"
 #include "hyteg/edgedofspace/generatedKernels/apply_2D_macroface_edgedof_to_edgedof_replace.hpp"
@@ -59,6 +60,21 @@ static void registerLikwidRegion( const std::string& regionName )
    LIKWID_MARKER_STOP( regionName.c_str() );
 }
 
+/// adds the analytic cost of all iterations of a benchmark to the roofline statistics
+static void recordKernel( const std::string& kernel,
+                          const uint_t&      level,
+                          const uint_t&      numDoFs,
+                          const uint_t&      iterations,
+                          const double&      valuesPerDoF,
+                          const double&      flopsPerDoF,
+                          const double&      time )
+{
+   KernelCost cost;
+   cost.bytes = double( numDoFs * iterations ) * valuesPerDoF * double( sizeof( real_t ) );
+   cost.flops = double( numDoFs * iterations ) * flopsPerDoF;
+   KernelInstrumentation::instance()->record( kernel, level, cost, time );
+}
+
 static void performBenchmark( hyteg::P2Function< double >&      src,
                               hyteg::P2Function< double >&      dst,
                               hyteg::P2ConstantLaplaceOperator& laplace,
@@ -144,6 +160,8 @@ static void performBenchmark( hyteg::P2Function< double >&      src,
       mlups = real_t( innerIterationsVertex * iterations ) / time / 1e6;
       /// 13 Flops: 7 Mults and 6 Adds
       mflops = real_t( innerIterationsVertex * iterations * 13 ) / time / 1e6;
+      /// read src, write dst (+ write allocate)
+      recordKernel( "apply_2D_macroface_vertexdof_to_vertexdof_replace", level, innerIterationsVertex, iterations, 3, 13, time );
 
       WALBERLA_LOG_INFO_ON_ROOT(
           walberla::format( "%18s|%10.3e|%10.3e|%10.3e|%6u|%5u", "vertex to vertex", time, mlups, mflops, iterations, level ) )
@@ -195,6 +213,8 @@ static void performBenchmark( hyteg::P2Function< double >&      src,
       mlups = real_t( innerIterationsVertex * iterations ) / time / 1e6;
       /// 4 DoFs for each subgroup; 23 Flops: 12 Mults and 11 Adds
       mflops = real_t( innerIterationsVertex * iterations * 23 ) / time / 1e6;
+      /// read 3 edge src, write vertex dst (+ write allocate)
+      recordKernel( "apply_2D_macroface_edgedof_to_vertexdof_replace", level, innerIterationsVertex, iterations, 5, 23, time );
 
       WALBERLA_LOG_INFO_ON_ROOT(
           walberla::format( "%18s|%10.3e|%10.3e|%10.3e|%6u|%5u", "edge to vertex", time, mlups, mflops, iterations, level ) )
@@ -250,6 +270,8 @@ static void performBenchmark( hyteg::P2Function< double >&      src,
       mlups = real_t( innerIterationsVertex * iterations ) / time / 1e6;
       /// 5 DoFs for each subgroup; 29 Flops: 15 Mults and 12 Adds
       mflops = real_t( innerIterationsVertex * iterations * 27 ) / time / 1e6;
+      /// read 3 edge src, write 3 edge dst (+ write allocate)
+      recordKernel( "apply_2D_macroface_edgedof_to_edgedof_replace", level, innerIterationsVertex, iterations, 9, 27, time );
 
       WALBERLA_LOG_INFO_ON_ROOT(
           walberla::format( "%18s|%10.3e|%10.3e|%10.3e|%6u|%5u", "edge to edge", time, mlups, mflops, iterations, level ) )
@@ -306,6 +328,8 @@ static void performBenchmark( hyteg::P2Function< double >&      src,
       mlups = real_t( innerIterationsVertex * iterations ) / time / 1e6;
       /// 21 Flops: 12 Mults and 3 * 3 Adds
       mflops = real_t( innerIterationsVertex * iterations * 21 ) / time / 1e6;
+      /// read vertex src, write 3 edge dst (+ write allocate)
+      recordKernel( "apply_2D_macroface_vertexdof_to_edgedof_replace", level, innerIterationsVertex, iterations, 7, 21, time );
 
       WALBERLA_LOG_INFO_ON_ROOT(
           walberla::format( "%18s|%10.3e|%10.3e|%10.3e|%6u|%5u", "vertex to edge", time, mlups, mflops, iterations, level ) )
@@ -392,6 +416,13 @@ int main( int argc, char* argv[] )
       jsonOutput.close();
    }
 
+   if ( mainConf.getParameter< bool >( "rooflineOutput" ) )
+   {
+      KernelInstrumentation::instance()->writeRooflineJSON( "ApplyPerformanceAnalysis-2D-P2-roofline.json",
+                                                            mainConf.getParameter< double >( "peakBandwidthGBs" ),
+                                                            mainConf.getParameter< double >( "peakGFLOPs" ) );
+   }
+
    if ( mainConf.getParameter< bool >( "VTKOutput" ) )
    {
       WALBERLA_LOG_INFO_ON_ROOT( "Writing VTK output" )
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/// Threads vs. ranks benchmark for the elementwise operators.
+///
+/// The number of macro-cells is fixed (numMacroCells), so that the benchmark can be run on a single node
+/// with varying combinations of MPI processes and OpenMP threads per process, e.g.
+///
+///    mpirun -np 6 ./ElementwiseThreading
+///    OMP_NUM_THREADS=6 mpirun -np 1 ./ElementwiseThreading
+///
+/// With one process per core, ranks that own a single macro-cell cannot profit from threading over
+/// macro-primitives. The elementwise operators therefore distribute slabs of micro-elements among the threads.
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/Format.hpp"
+#include "core/config/Config.h"
+#include "core/math/Constants.h"
+#include "core/mpi/MPIManager.h"
+#include "core/timing/Timer.h"
+
+#include "hyteg/FunctionProperties.hpp"
+#include "hyteg/LikwidWrapper.hpp"
+#include "hyteg/OpenMPManager.hpp"
+#include "hyteg/elementwiseoperators/P1ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+
+namespace hyteg {
+
+template < typename Function_T, typename Operator_T >
+static void runBenchmark( const std::shared_ptr< PrimitiveStorage >& storage,
+                          const uint_t&                              level,
+                          const real_t&                              minRuntime,
+                          const std::string&                         name )
+{
+   Function_T src( "src", storage, level, level );
+   Function_T dst( "dst", storage, level, level );
+
+   Operator_T op( storage, level, level );
+
+   std::function< real_t( const Point3D& ) > f = []( const Point3D& x ) {
+      return std::sin( walberla::math::pi * x[0] ) * std::sin( walberla::math::pi * x[1] ) * x[2];
+   };
+   src.interpolate( f, level, All );
+
+   const uint_t globalDoFs = numberOfGlobalDoFs< typename Function_T::Tag >( *storage, level );
+
+   walberla::WcTimer timer;
+   uint_t            iterations = 1;
+   do
+   {
+      LIKWID_MARKER_START( name.c_str() );
+      WALBERLA_MPI_BARRIER();
+      timer.reset();
+      for ( uint_t i = 0; i < iterations; ++i )
+      {
+         op.apply( src, dst, level, Inner );
+      }
+      WALBERLA_MPI_BARRIER();
+      timer.end();
+      LIKWID_MARKER_STOP( name.c_str() );
+      iterations *= 2;
+   } while ( timer.last() < minRuntime );
+   iterations /= 2;
+
+   const real_t timePerApply = real_c( timer.last() ) / real_c( iterations );
+   const real_t mdofs        = real_c( globalDoFs ) / timePerApply / 1e6;
+
+   WALBERLA_LOG_INFO_ON_ROOT( walberla::format( "%12s|%5u|%6u|%8u|%12u|%12.4e|%12.4e",
+                                                name.c_str(),
+                                                level,
+                                                uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ),
+                                                uint_c( OpenMPManager::instance()->numThreads() ),
+                                                globalDoFs,
+                                                timePerApply,
+                                                mdofs ) )
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   LIKWID_MARKER_INIT;
+   walberla::Environment env( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+   LIKWID_MARKER_THREADINIT;
+
+   auto cfg = std::make_shared< walberla::config::Config >();
+   if ( env.config() == nullptr )
+   {
+      auto defaultFile = "./ElementwiseThreading.prm";
+      WALBERLA_LOG_INFO_ON_ROOT( "No Parameter file given loading default parameter file: " << defaultFile )
+      cfg->readParameterFile( defaultFile );
+   }
+   else
+   {
+      cfg = env.config();
+   }
+   const walberla::Config::BlockHandle mainConf = cfg->getBlock( "Parameters" );
+
+   const uint_t      level      = mainConf.getParameter< uint_t >( "level" );
+   const uint_t      numCubes   = mainConf.getParameter< uint_t >( "numCubes" );
+   const int         numThreads = mainConf.getParameter< int >( "numThreads" );
+   const real_t      minRuntime = mainConf.getParameter< real_t >( "minRuntime" );
+   const std::string discr      = mainConf.getParameter< std::string >( "discretization" );
+
+   if ( numThreads > 0 )
+   {
+      hyteg::OpenMPManager::instance()->setNumThreads( numThreads );
+   }
+
+   // the cuboid consists of 6 tetrahedra per cube
+   auto meshInfo = hyteg::MeshInfo::meshCuboid( hyteg::Point3D( {0, 0, 0} ), hyteg::Point3D( {1, 1, 1} ), numCubes, 1, 1 );
+   hyteg::SetupPrimitiveStorage setupStorage( meshInfo,
+                                              uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   hyteg::loadbalancing::roundRobin( setupStorage );
+   auto storage = std::make_shared< hyteg::PrimitiveStorage >( setupStorage );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "macro-cells: " << setupStorage.getNumberOfCells() )
+   WALBERLA_LOG_INFO_ON_ROOT( walberla::format( "%12s|%5s|%6s|%8s|%12s|%12s|%12s",
+                                                "operator",
+                                                "level",
+                                                "procs",
+                                                "threads",
+                                                "DoFs",
+                                                "time/apply",
+                                                "MDoF/s" ) )
+
+   if ( discr == "P1" || discr == "both" )
+   {
+      hyteg::runBenchmark< hyteg::P1Function< real_t >, hyteg::P1ElementwiseLaplaceOperator >(
+          storage, level, minRuntime, "P1Elementwise" );
+   }
+   if ( discr == "P2" || discr == "both" )
+   {
+      hyteg::runBenchmark< hyteg::P2Function< real_t >, hyteg::P2ElementwiseLaplaceOperator >(
+          storage, level, minRuntime, "P2Elementwise" );
+   }
+
+   LIKWID_MARKER_CLOSE;
+   return EXIT_SUCCESS;
+}
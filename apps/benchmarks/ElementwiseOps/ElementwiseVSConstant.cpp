@@ -65,10 +65,10 @@ void performBenchmark( hyteg::P2Function< double >&         src,
    auto dstElemEdgePtr     = cell.getData( dstElem.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
    auto srcVertexPtr       = cell.getData( src.getVertexDoFFunction().getCellDataID() )->getPointer( level );
    auto srcEdgePtr         = cell.getData( src.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
-   auto const_v2v_opr_data = cell.getData( constantOperator.getVertexToVertexOpr().getCellStencilID() )->getData( level );
-   auto const_v2e_opr_data = cell.getData( constantOperator.getVertexToEdgeOpr().getCellStencilID() )->getData( level );
-   auto const_e2v_opr_data = cell.getData( constantOperator.getEdgeToVertexOpr().getCellStencilID() )->getData( level );
-   auto const_e2e_opr_data = cell.getData( constantOperator.getEdgeToEdgeOpr().getCellStencilID() )->getData( level );
+   auto const_v2v_opr_data = cell.getData( constantOperator.getVertexToVertexOpr().getCellStencilID() )->getData( level ).toMap();
+   auto const_v2e_opr_data = cell.getData( constantOperator.getVertexToEdgeOpr().getCellStencilID() )->getData( level ).toMap();
+   auto const_e2v_opr_data = cell.getData( constantOperator.getEdgeToVertexOpr().getCellStencilID() )->getData( level ).toMap();
+   auto const_e2e_opr_data = cell.getData( constantOperator.getEdgeToEdgeOpr().getCellStencilID() )->getData( level ).toMap();
 
    typedef hyteg::edgedof::EdgeDoFOrientation eo;
    std::map< eo, uint_t >                     firstEdgeIdx;
@@ -51,7 +51,7 @@ int main( int argc, char** argv )
       std::vector< double > dst( tetSize );
       std::generate( dst.begin(), dst.end(), std::rand );
 
-      hyteg::vertexdof::macrocell::StencilMap_T stencil;
+      hyteg::vertexdof::macrocell::FlatStencil stencil;
       for ( const auto & neighbor : hyteg::vertexdof::macrocell::neighborsWithCenter )
         stencil[hyteg::vertexdof::logicalIndexOffsetFromVertex( neighbor ) ] = walberla::real_c( std::rand() );
 
@@ -65,7 +65,7 @@ int main( int argc, char** argv )
          for( size_t i = 0; i < iter; ++i )
          {
             hyteg::vertexdof::macrocell::generated::apply_3D_macrocell_vertexdof_to_vertexdof_add(
-                dst.data(), src.data(), (int32_t) level, stencil );
+                dst.data(), src.data(), (int32_t) level, stencil.toMap() );
             hyteg::misc::dummy( dst.data(), src.data() );
          }
          timer.end();
@@ -0,0 +1,666 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/Format.hpp"
+#include "core/config/Config.h"
+#include "core/mpi/Broadcast.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/Reduce.h"
+#include "core/timing/Timer.h"
+
+#include "hyteg/FunctionProperties.hpp"
+#include "hyteg/Git.hpp"
+#include "hyteg/communication/Syncing.hpp"
+#include "hyteg/dataexport/SQL.hpp"
+#include "hyteg/dgfunctionspace/DGFunction.hpp"
+#include "hyteg/dgfunctionspace/DGUpwindOperator.hpp"
+#include "hyteg/edgedofspace/EdgeDoFFunction.hpp"
+#include "hyteg/edgedofspace/EdgeDoFOperator.hpp"
+#include "hyteg/forms/form_fenics_base/P2FenicsForm.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticProlongation.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticRestriction.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+#include "hyteg/solvers/FusedResidualRestriction.hpp"
+
+#include "sqlite/sqlite3.h"
+
+/// Registry based micro-benchmark driver for the kernels of the different function spaces.
+///
+/// For each selected function space, operation and level the throughput (DoF/s) and the attained bandwidth
+/// (GB/s, from an analytic streaming model) are measured with several repetitions. The results are written
+/// to an SQLite database. If a baseline database of a previous run is passed, the app exits with a non-zero
+/// code if the throughput of any benchmark dropped by more than the specified tolerance.
+
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using namespace hyteg;
+
+/// A single benchmark of the suite.
+struct BenchmarkCase
+{
+   std::string functionSpace;
+   std::string operation;
+   /// number of values per DoF that are transferred from / to main memory per kernel call (streaming model),
+   /// zero if there is no meaningful streaming model (communication)
+   double valuesPerDoF;
+   /// executes a single kernel call on the passed level
+   std::function< void( uint_t ) > run;
+   /// returns the global number of DoFs that are processed by a kernel call on the passed level
+   std::function< uint_t( uint_t ) > numDoFs;
+};
+
+/// Statistics of the run time of a single repetition (i.e. iterations kernel calls).
+struct BenchmarkResult
+{
+   std::string functionSpace;
+   std::string operation;
+   uint_t      level;
+   uint_t      numDoFs;
+   uint_t      iterations;
+   double      timeMedian;
+   double      timeMin;
+   double      timeMax;
+   double      timeStdDev;
+   double      dofsPerSecond;
+   double      gbPerSecond;
+};
+
+/// prevents that the results of the dot products are optimized away
+static real_t dotSink = 0;
+
+static void syncFunction( const P1Function< real_t >& function, const uint_t& level )
+{
+   communication::syncFunctionBetweenPrimitives< vertexdof::VertexDoFFunction< real_t > >( function, level );
+}
+
+static void syncFunction( const P2Function< real_t >& function, const uint_t& level )
+{
+   communication::syncP2FunctionBetweenPrimitives( function, level );
+}
+
+static void syncFunction( const EdgeDoFFunction< real_t >& function, const uint_t& level )
+{
+   communication::syncFunctionBetweenPrimitives( function, level );
+}
+
+static void syncFunction( const DGFunction< real_t >& function, const uint_t& level )
+{
+   function.communicate< Face, Edge >( level );
+   function.communicate< Edge, Face >( level );
+}
+
+/// Registers the operator (apply, smoothers) and grid transfer benchmarks of a scalar nodal function space.
+template < typename FunctionTag_T,
+           typename FunctionType,
+           typename OperatorType,
+           typename RestrictionType,
+           typename ProlongationType >
+static void addOperatorBenchmarks( std::vector< BenchmarkCase >&              cases,
+                                   const std::string&                         functionSpace,
+                                   const std::shared_ptr< PrimitiveStorage >& storage,
+                                   const uint_t&                              minLevel,
+                                   const uint_t&                              maxLevel )
+{
+   auto u            = std::make_shared< FunctionType >( functionSpace + "_u", storage, minLevel - 1, maxLevel );
+   auto b            = std::make_shared< FunctionType >( functionSpace + "_b", storage, minLevel - 1, maxLevel );
+   auto tmp          = std::make_shared< FunctionType >( functionSpace + "_tmp", storage, minLevel - 1, maxLevel );
+   auto A            = std::make_shared< OperatorType >( storage, minLevel - 1, maxLevel );
+   auto restriction  = std::make_shared< RestrictionType >();
+   auto prolongation = std::make_shared< ProlongationType >();
+
+   std::function< real_t( const Point3D& ) > initialGuess = []( const Point3D& x ) {
+      return std::sin( x[0] ) + x[1] * x[2];
+   };
+
+   for ( uint_t level = minLevel - 1; level <= maxLevel; level++ )
+   {
+      u->interpolate( initialGuess, level, All );
+      b->interpolate( 1.0, level, All );
+      tmp->interpolate( initialGuess, level, All );
+   }
+
+   auto numDoFs = [storage]( uint_t level ) { return numberOfGlobalDoFs< FunctionTag_T >( *storage, level ); };
+
+   // fraction of the DoFs on the next coarser level
+   const double coarseFraction = 1.0 / ( storage->hasGlobalCells() ? 8.0 : 4.0 );
+
+   // read src, write dst (+ write allocate)
+   cases.push_back( {functionSpace, "apply", 3.0, [=]( uint_t level ) { A->apply( *u, *tmp, level, Inner ); }, numDoFs} );
+   // read and write u, read rhs
+   cases.push_back( {functionSpace, "gs", 3.0, [=]( uint_t level ) { A->smooth_gs( *u, *b, level, Inner ); }, numDoFs} );
+   cases.push_back( {functionSpace, "sor", 3.0, [=]( uint_t level ) { A->smooth_sor( *u, *b, 1.2, level, Inner ); }, numDoFs} );
+   // read old iterate and rhs, write new iterate (+ write allocate)
+   cases.push_back(
+       {functionSpace, "jacobi", 4.0, [=]( uint_t level ) { A->smooth_jac( *u, *b, *tmp, 0.66, level, Inner ); }, numDoFs} );
+   // read fine level, write coarse level (+ write allocate)
+   cases.push_back( {functionSpace,
+                     "restrict",
+                     1.0 + 2.0 * coarseFraction,
+                     [=]( uint_t level ) { restriction->restrict( *tmp, level, Inner ); },
+                     numDoFs} );
+   // read coarse level, read and write fine level
+   cases.push_back( {functionSpace,
+                     "prolongate",
+                     2.0 + coarseFraction,
+                     [=]( uint_t level ) { prolongation->prolongateAndAdd( *u, level - 1, Inner ); },
+                     numDoFs} );
+
+   // Residual computation and restriction as in the multigrid cycle, once as separate kernels and once fused
+   // (if available). Both count only the unavoidable traffic (read u and rhs, write the coarse level
+   // + write allocate), so that the DoF/s of both variants can be compared directly.
+   auto rhs = std::make_shared< FunctionType >( functionSpace + "_rhs", storage, minLevel - 1, maxLevel );
+   for ( uint_t level = minLevel - 1; level <= maxLevel; level++ )
+   {
+      rhs->interpolate( 1.0, level, All );
+   }
+
+   cases.push_back( {functionSpace,
+                     "residual_restrict",
+                     2.0 + 2.0 * coarseFraction,
+                     [=]( uint_t level ) {
+                        A->apply( *u, *tmp, level, Inner );
+                        tmp->assign( {1.0, -1.0}, {*rhs, *tmp}, level, Inner );
+                        restriction->restrict( *tmp, level, Inner );
+                     },
+                     numDoFs} );
+
+   if ( FusedResidualRestriction< OperatorType >::isAvailable( *A, *restriction ) )
+   {
+      cases.push_back( {functionSpace,
+                        "fused_residual_restrict",
+                        2.0 + 2.0 * coarseFraction,
+                        [=]( uint_t level ) {
+                           FusedResidualRestriction< OperatorType >::computeAndRestrictResidual(
+                               *A, *restriction, *u, *rhs, *tmp, level, Inner );
+                        },
+                        numDoFs} );
+   }
+}
+
+/// Registers the benchmark of the operator application of a function space that provides neither smoothers
+/// nor grid transfer operators.
+template < typename FunctionTag_T, typename FunctionType, typename OperatorType >
+static void addApplyBenchmark( std::vector< BenchmarkCase >&              cases,
+                               const std::string&                         functionSpace,
+                               const std::shared_ptr< PrimitiveStorage >& storage,
+                               const uint_t&                              minLevel,
+                               const uint_t&                              maxLevel,
+                               const std::shared_ptr< OperatorType >&     A,
+                               const double&                              valuesPerDoF )
+{
+   auto u   = std::make_shared< FunctionType >( functionSpace + "_apply_u", storage, minLevel, maxLevel );
+   auto tmp = std::make_shared< FunctionType >( functionSpace + "_apply_tmp", storage, minLevel, maxLevel );
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      u->interpolate( 1.0, level, All );
+      tmp->interpolate( 0.0, level, All );
+   }
+
+   auto numDoFs = [storage]( uint_t level ) { return numberOfGlobalDoFs< FunctionTag_T >( *storage, level ); };
+
+   cases.push_back(
+       {functionSpace, "apply", valuesPerDoF, [=]( uint_t level ) { A->apply( *u, *tmp, level, Inner, Replace ); }, numDoFs} );
+}
+
+/// Registers the benchmarks of the vector operations assign and sync.
+template < typename FunctionTag_T, typename FunctionType >
+static void addVectorBenchmarks( std::vector< BenchmarkCase >&              cases,
+                                 const std::string&                         functionSpace,
+                                 const std::shared_ptr< PrimitiveStorage >& storage,
+                                 const uint_t&                              minLevel,
+                                 const uint_t&                              maxLevel )
+{
+   auto x = std::make_shared< FunctionType >( functionSpace + "_x", storage, minLevel, maxLevel );
+   auto y = std::make_shared< FunctionType >( functionSpace + "_y", storage, minLevel, maxLevel );
+   auto z = std::make_shared< FunctionType >( functionSpace + "_z", storage, minLevel, maxLevel );
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      x->interpolate( 1.0, level, All );
+      y->interpolate( 2.0, level, All );
+      z->interpolate( 0.0, level, All );
+   }
+
+   auto numDoFs = [storage]( uint_t level ) { return numberOfGlobalDoFs< FunctionTag_T >( *storage, level ); };
+
+   // read x and y, write z (+ write allocate)
+   cases.push_back(
+       {functionSpace, "assign", 4.0, [=]( uint_t level ) { z->assign( {1.0, -1.0}, {*x, *y}, level, All ); }, numDoFs} );
+   cases.push_back( {functionSpace, "sync", 0.0, [=]( uint_t level ) { syncFunction( *x, level ); }, numDoFs} );
+}
+
+/// Registers the benchmark of the global dot product.
+template < typename FunctionTag_T, typename FunctionType >
+static void addDotBenchmark( std::vector< BenchmarkCase >&              cases,
+                             const std::string&                         functionSpace,
+                             const std::shared_ptr< PrimitiveStorage >& storage,
+                             const uint_t&                              minLevel,
+                             const uint_t&                              maxLevel )
+{
+   auto x = std::make_shared< FunctionType >( functionSpace + "_dot_x", storage, minLevel, maxLevel );
+   auto y = std::make_shared< FunctionType >( functionSpace + "_dot_y", storage, minLevel, maxLevel );
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      x->interpolate( 1.0, level, All );
+      y->interpolate( 2.0, level, All );
+   }
+
+   auto numDoFs = [storage]( uint_t level ) { return numberOfGlobalDoFs< FunctionTag_T >( *storage, level ); };
+
+   // read x and y (not all function spaces provide dotGlobal())
+   cases.push_back( {functionSpace,
+                     "dot",
+                     2.0,
+                     [=]( uint_t level ) {
+                        dotSink += walberla::mpi::allReduce( x->dotLocal( *y, level, All ), walberla::mpi::SUM );
+                     },
+                     numDoFs} );
+}
+
+static BenchmarkResult measure( const BenchmarkCase& benchmark, const uint_t& level, const uint_t& repetitions, const double& minTime )
+{
+   walberla::WcTimer timer;
+
+   // all processes must agree on the number of iterations since some kernels communicate
+   auto timeIterations = [&]( uint_t iterations ) {
+      WALBERLA_MPI_BARRIER()
+      timer.start();
+      for ( uint_t i = 0; i < iterations; i++ )
+      {
+         benchmark.run( level );
+      }
+      WALBERLA_MPI_BARRIER()
+      timer.end();
+      return walberla::mpi::allReduce( timer.last(), walberla::mpi::MAX );
+   };
+
+   // calibration, also serves as warm-up
+   uint_t iterations = 1;
+   while ( timeIterations( iterations ) < minTime )
+   {
+      iterations *= 2;
+   }
+
+   std::vector< double > times;
+   for ( uint_t r = 0; r < repetitions; r++ )
+   {
+      times.push_back( timeIterations( iterations ) );
+   }
+   std::sort( times.begin(), times.end() );
+
+   double mean = 0;
+   for ( auto t : times )
+   {
+      mean += t;
+   }
+   mean /= double( times.size() );
+
+   double variance = 0;
+   for ( auto t : times )
+   {
+      variance += ( t - mean ) * ( t - mean );
+   }
+   variance /= double( times.size() );
+
+   BenchmarkResult result;
+   result.functionSpace = benchmark.functionSpace;
+   result.operation     = benchmark.operation;
+   result.level         = level;
+   result.numDoFs       = benchmark.numDoFs( level );
+   result.iterations    = iterations;
+   result.timeMedian    = times.size() % 2 == 1 ? times[times.size() / 2] :
+                                               0.5 * ( times[times.size() / 2 - 1] + times[times.size() / 2] );
+   result.timeMin       = times.front();
+   result.timeMax       = times.back();
+   result.timeStdDev    = std::sqrt( variance );
+   result.dofsPerSecond = double( result.numDoFs * iterations ) / result.timeMedian;
+   result.gbPerSecond   = result.dofsPerSecond * benchmark.valuesPerDoF * double( sizeof( real_t ) ) * 1e-9;
+   return result;
+}
+
+typedef std::tuple< std::string, std::string, uint_t > BenchmarkKey;
+
+/// Reads the most recent throughput (DoF/s) of each benchmark from a database written by this app.
+static std::map< BenchmarkKey, double > readBaseline( const std::string& dbFile, const uint_t& dim, const uint_t& numProcesses )
+{
+   std::map< BenchmarkKey, double > baseline;
+
+   sqlite3* db = nullptr;
+   if ( sqlite3_open_v2( dbFile.c_str(), &db, SQLITE_OPEN_READONLY, nullptr ) != SQLITE_OK )
+   {
+      WALBERLA_ABORT( "Could not open baseline database " << dbFile << ": " << sqlite3_errmsg( db ) );
+   }
+
+   const std::string query = "SELECT function_space, operation, level, dofs_per_second FROM runs WHERE dim = " +
+                             std::to_string( dim ) + " AND num_processes = " + std::to_string( numProcesses ) +
+                             " ORDER BY rowid;";
+
+   sqlite3_stmt* statement = nullptr;
+   if ( sqlite3_prepare_v2( db, query.c_str(), -1, &statement, nullptr ) != SQLITE_OK )
+   {
+      WALBERLA_ABORT( "Could not read baseline database " << dbFile << ": " << sqlite3_errmsg( db ) );
+   }
+
+   // later rows overwrite earlier ones -> most recent entry
+   while ( sqlite3_step( statement ) == SQLITE_ROW )
+   {
+      const std::string functionSpace( reinterpret_cast< const char* >( sqlite3_column_text( statement, 0 ) ) );
+      const std::string operation( reinterpret_cast< const char* >( sqlite3_column_text( statement, 1 ) ) );
+      const uint_t      level = uint_c( sqlite3_column_int64( statement, 2 ) );
+
+      baseline[std::make_tuple( functionSpace, operation, level )] = sqlite3_column_double( statement, 3 );
+   }
+
+   sqlite3_finalize( statement );
+   sqlite3_close( db );
+
+   return baseline;
+}
+
+static std::vector< std::string > splitList( const std::string& list )
+{
+   std::vector< std::string > entries;
+   std::stringstream          ss( list );
+   std::string                entry;
+   while ( std::getline( ss, entry, ',' ) )
+   {
+      if ( !entry.empty() )
+      {
+         entries.push_back( entry );
+      }
+   }
+   return entries;
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment env( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   auto cfg = std::make_shared< walberla::config::Config >();
+   if ( env.config() == nullptr )
+   {
+      auto defaultFile = "./KernelBenchmarkSuite.prm";
+      WALBERLA_LOG_PROGRESS_ON_ROOT( "No Parameter file given loading default parameter file: " << defaultFile )
+      cfg->readParameterFile( defaultFile );
+   }
+   else
+   {
+      cfg = env.config();
+   }
+   const walberla::Config::BlockHandle mainConf = cfg->getBlock( "Parameters" );
+
+   const std::string meshFile       = mainConf.getParameter< std::string >( "mesh" );
+   const uint_t      minLevel       = mainConf.getParameter< uint_t >( "minLevel" );
+   const uint_t      maxLevel       = mainConf.getParameter< uint_t >( "maxLevel" );
+   const auto        functionSpaces = splitList( mainConf.getParameter< std::string >( "functionSpaces" ) );
+   const auto        operations     = splitList( mainConf.getParameter< std::string >( "operations" ) );
+   const uint_t      repetitions    = mainConf.getParameter< uint_t >( "repetitions" );
+   const double      minTime        = mainConf.getParameter< double >( "minTimePerRepetition" );
+   const std::string dbFile         = mainConf.getParameter< std::string >( "dbFile" );
+   const bool        useBaseline    = mainConf.getParameter< bool >( "useBaseline" );
+   const std::string baselineDBFile = mainConf.getParameter< std::string >( "baselineDBFile" );
+   const double      tolerance      = mainConf.getParameter< double >( "regressionTolerance" );
+
+   WALBERLA_CHECK_GREATER_EQUAL( minLevel, uint_t( 1 ), "The grid transfer benchmarks require the next coarser level." );
+   WALBERLA_CHECK_LESS_EQUAL( minLevel, maxLevel );
+   WALBERLA_CHECK_GREATER( repetitions, uint_t( 0 ) );
+   if ( useBaseline )
+   {
+      WALBERLA_CHECK_UNEQUAL( dbFile, baselineDBFile, "The baseline must not be overwritten by the current run." );
+   }
+
+   printGitInfo();
+
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   auto                  meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, numProcesses );
+   loadbalancing::roundRobin( setupStorage );
+   auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   const uint_t dim = storage->hasGlobalCells() ? 3 : 2;
+
+   ///// Registry /////
+
+   std::vector< BenchmarkCase > cases;
+   for ( const auto& functionSpace : functionSpaces )
+   {
+      if ( functionSpace == "P1" )
+      {
+         addOperatorBenchmarks< P1FunctionTag,
+                                P1Function< real_t >,
+                                P1ConstantLaplaceOperator,
+                                P1toP1LinearRestriction,
+                                P1toP1LinearProlongation >( cases, functionSpace, storage, minLevel, maxLevel );
+         addVectorBenchmarks< P1FunctionTag, P1Function< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+         addDotBenchmark< P1FunctionTag, P1Function< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+      }
+      else if ( functionSpace == "P2" )
+      {
+         addOperatorBenchmarks< P2FunctionTag,
+                                P2Function< real_t >,
+                                P2ConstantLaplaceOperator,
+                                P2toP2QuadraticRestriction,
+                                P2toP2QuadraticProlongation >( cases, functionSpace, storage, minLevel, maxLevel );
+         addVectorBenchmarks< P2FunctionTag, P2Function< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+         addDotBenchmark< P2FunctionTag, P2Function< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+      }
+      else if ( functionSpace == "EdgeDoF" )
+      {
+         typedef EdgeDoFOperator<
+             P2FenicsForm< p2_diffusion_cell_integral_0_otherwise, p2_tet_diffusion_cell_integral_0_otherwise > >
+             EdgeDoFLaplaceOperator;
+
+         // read src, write dst (+ write allocate)
+         addApplyBenchmark< EdgeDoFFunctionTag, EdgeDoFFunction< real_t > >(
+             cases,
+             functionSpace,
+             storage,
+             minLevel,
+             maxLevel,
+             std::make_shared< EdgeDoFLaplaceOperator >( storage, minLevel, maxLevel ),
+             3.0 );
+         addVectorBenchmarks< EdgeDoFFunctionTag, EdgeDoFFunction< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+         addDotBenchmark< EdgeDoFFunctionTag, EdgeDoFFunction< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+      }
+      else if ( functionSpace == "DG" )
+      {
+         if ( dim == 3 )
+         {
+            WALBERLA_LOG_WARNING_ON_ROOT( "DG functions are only available in 2D, skipping." )
+            continue;
+         }
+
+         std::array< P1Function< real_t >, 2 > velocity{
+             P1Function< real_t >( "DG_velocity_x", storage, minLevel, maxLevel ),
+             P1Function< real_t >( "DG_velocity_y", storage, minLevel, maxLevel )};
+         for ( uint_t level = minLevel; level <= maxLevel; level++ )
+         {
+            velocity[0].interpolate( 1.0, level, All );
+            velocity[1].interpolate( 0.5, level, All );
+         }
+
+         // read src, write dst (+ write allocate), read the two velocity components
+         // (about one P1 DoF per two DG DoFs)
+         addApplyBenchmark< DGFunctionTag, DGFunction< real_t > >(
+             cases,
+             functionSpace,
+             storage,
+             minLevel,
+             maxLevel,
+             std::make_shared< DGUpwindOperator< P1Function< real_t > > >( storage, velocity, minLevel, maxLevel ),
+             4.0 );
+         addVectorBenchmarks< DGFunctionTag, DGFunction< real_t > >( cases, functionSpace, storage, minLevel, maxLevel );
+      }
+      else
+      {
+         WALBERLA_ABORT( "Unknown function space: " << functionSpace );
+      }
+   }
+
+   ///// Benchmarks /////
+
+   FixedSizeSQLDB db( dbFile );
+   db.setConstantEntry( "git_hash", gitSHA1() );
+   db.setConstantEntry( "mesh", meshFile );
+   db.setConstantEntry( "dim", dim );
+   db.setConstantEntry( "num_processes", numProcesses );
+   db.setConstantEntry( "repetitions", repetitions );
+   db.setConstantEntry( "min_time_per_repetition", minTime );
+
+   WALBERLA_LOG_INFO_ON_ROOT( walberla::format( "%8s|%23s|%6s|%12s|%8s|%11s|%11s|%11s|%9s",
+                                                "space",
+                                                "operation",
+                                                "level",
+                                                "DoFs",
+                                                "iter",
+                                                "median (s)",
+                                                "rel. stdev",
+                                                "DoF/s",
+                                                "GB/s" ) )
+
+   std::vector< BenchmarkResult > results;
+   for ( const auto& operation : operations )
+   {
+      bool available = false;
+      for ( const auto& benchmark : cases )
+      {
+         if ( benchmark.operation != operation )
+         {
+            continue;
+         }
+         available = true;
+
+         for ( uint_t level = minLevel; level <= maxLevel; level++ )
+         {
+            const auto result = measure( benchmark, level, repetitions, minTime );
+            results.push_back( result );
+
+            WALBERLA_LOG_INFO_ON_ROOT( walberla::format( "%8s|%23s|%6u|%12u|%8u|%11.3e|%11.3e|%11.3e|%9.3f",
+                                                         result.functionSpace.c_str(),
+                                                         result.operation.c_str(),
+                                                         result.level,
+                                                         result.numDoFs,
+                                                         result.iterations,
+                                                         result.timeMedian,
+                                                         result.timeStdDev / result.timeMedian,
+                                                         result.dofsPerSecond,
+                                                         result.gbPerSecond ) )
+
+            db.setVariableEntry( "function_space", result.functionSpace );
+            db.setVariableEntry( "operation", result.operation );
+            db.setVariableEntry( "level", result.level );
+            db.setVariableEntry( "dofs", result.numDoFs );
+            db.setVariableEntry( "iterations", result.iterations );
+            db.setVariableEntry( "time_median", result.timeMedian );
+            db.setVariableEntry( "time_min", result.timeMin );
+            db.setVariableEntry( "time_max", result.timeMax );
+            db.setVariableEntry( "time_stddev", result.timeStdDev );
+            db.setVariableEntry( "dofs_per_second", result.dofsPerSecond );
+            db.setVariableEntry( "gb_per_second", result.gbPerSecond );
+            db.writeRowOnRoot();
+         }
+      }
+      if ( !available )
+      {
+         WALBERLA_LOG_WARNING_ON_ROOT( "Operation \"" << operation << "\" is not available for the selected function spaces." )
+      }
+   }
+
+   WALBERLA_LOG_DETAIL_ON_ROOT( "dot product sink: " << dotSink )
+
+   ///// Regression check /////
+
+   if ( !useBaseline )
+   {
+      return EXIT_SUCCESS;
+   }
+
+   bool regression = false;
+   WALBERLA_ROOT_SECTION()
+   {
+      const auto baseline = readBaseline( baselineDBFile, dim, numProcesses );
+
+      WALBERLA_LOG_INFO( "" )
+      WALBERLA_LOG_INFO( "Regression check against " << baselineDBFile << " (tolerance " << tolerance << ")" )
+      WALBERLA_LOG_INFO(
+          walberla::format( "%8s|%23s|%6s|%11s|%11s|%8s|%6s", "space", "operation", "level", "DoF/s", "baseline", "ratio", "" ) )
+
+      for ( const auto& result : results )
+      {
+         const auto key = std::make_tuple( result.functionSpace, result.operation, result.level );
+         if ( baseline.count( key ) == 0 )
+         {
+            WALBERLA_LOG_INFO( walberla::format( "%8s|%23s|%6u|%11.3e|%11s|%8s|%6s",
+                                                 result.functionSpace.c_str(),
+                                                 result.operation.c_str(),
+                                                 result.level,
+                                                 result.dofsPerSecond,
+                                                 "-",
+                                                 "-",
+                                                 "new" ) )
+            continue;
+         }
+
+         const double ratio  = result.dofsPerSecond / baseline.at( key );
+         const bool   failed = ratio < 1.0 - tolerance;
+         regression          = regression || failed;
+
+         WALBERLA_LOG_INFO( walberla::format( "%8s|%23s|%6u|%11.3e|%11.3e|%8.3f|%6s",
+                                              result.functionSpace.c_str(),
+                                              result.operation.c_str(),
+                                              result.level,
+                                              result.dofsPerSecond,
+                                              baseline.at( key ),
+                                              ratio,
+                                              failed ? "FAILED" : "ok" ) )
+      }
+   }
+   walberla::mpi::broadcastObject( regression );
+
+   if ( regression )
+   {
+      WALBERLA_LOG_WARNING_ON_ROOT( "Performance regression detected." )
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <fstream>
+
+#include "core/Environment.h"
+#include "core/timing/TimingJSON.h"
+
+#include "hyteg/composites/P1StokesFunction.hpp"
+#include "hyteg/composites/P1StokesOperator.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1ConstantReducedPrecisionOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/GaussSeidelSmoother.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+#include "hyteg/solvers/MinresSolver.hpp"
+#include "hyteg/solvers/MixedPrecisionSolver.hpp"
+#include "hyteg/solvers/preconditioners/stokes/StokesBlockDiagonalPreconditioner.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using namespace hyteg;
+
+/*
+ * Convergence vs. time study for the P1 Poisson problem. Compares
+ *
+ *   - double precision multigrid V-cycles,
+ *   - iterative refinement in double precision with single precision V-cycles as inner solver,
+ *   - double precision CG preconditioned by a single precision V-cycle.
+ *
+ * The same study is performed for the stabilized P1-P1 Stokes problem, solved by MINRES with a block diagonal
+ * preconditioner. The velocity blocks are preconditioned either by a double precision V-cycle or by one step of
+ * iterative refinement with a single precision V-cycle, the pressure block by the lumped inverse mass matrix.
+ * Only the scalar P1 operators and transfers are available in single precision, hence the Stokes operator itself,
+ * the MINRES iteration and the pressure preconditioner are always evaluated in double precision.
+ *
+ * The residual and the accumulated run time are printed after each iteration and optionally written to a CSV file.
+ */
+int main( int argc, char** argv )
+{
+   walberla::Environment env( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   auto              timingTree = std::make_shared< walberla::WcTimingTree >();
+   walberla::WcTimer timer;
+
+   //check if a config was given on command line or load default file otherwise
+   auto cfg = std::make_shared< walberla::config::Config >();
+   if ( env.config() == nullptr )
+   {
+      auto defaultFile = "./MixedPrecisionMultigrid.prm";
+      WALBERLA_LOG_PROGRESS_ON_ROOT( "No Parameter file given loading default parameter file: " << defaultFile );
+      cfg->readParameterFile( defaultFile );
+   }
+   else
+   {
+      cfg = env.config();
+   }
+   const walberla::Config::BlockHandle mainConf = cfg->getBlock( "Parameters" );
+
+   const uint_t level    = mainConf.getParameter< uint_t >( "level" );
+   const uint_t minLevel = mainConf.getParameter< uint_t >( "minLevel" );
+
+   const uint_t iterations         = mainConf.getParameter< uint_t >( "iterations" );
+   const uint_t cgIterations       = mainConf.getParameter< uint_t >( "cgIterations" );
+   const uint_t minresIterations   = mainConf.getParameter< uint_t >( "minresIterations" );
+   const uint_t preSmoothingSteps  = mainConf.getParameter< uint_t >( "preSmoothingSteps" );
+   const uint_t postSmoothingSteps = mainConf.getParameter< uint_t >( "postSmoothingSteps" );
+
+   const std::string meshFile = mainConf.getParameter< std::string >( "mesh" );
+   const bool        writeCSV = mainConf.getParameter< bool >( "writeCSV" );
+
+   MeshInfo              meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( setupStorage, timingTree );
+
+   const auto numDoFs = numberOfGlobalDoFs< P1FunctionTag >( *storage, level );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "" );
+   WALBERLA_LOG_INFO_ON_ROOT( "=======================================" );
+   WALBERLA_LOG_INFO_ON_ROOT( "=== Mixed Precision Multigrid Study ===" );
+   WALBERLA_LOG_INFO_ON_ROOT( "=======================================" );
+   WALBERLA_LOG_INFO_ON_ROOT( "" );
+   WALBERLA_LOG_INFO_ON_ROOT( storage->getGlobalInfo() );
+   WALBERLA_LOG_INFO_ON_ROOT( "mesh:                    " << meshFile );
+   WALBERLA_LOG_INFO_ON_ROOT( "levels (min/max):        " << minLevel << " / " << level );
+   WALBERLA_LOG_INFO_ON_ROOT( "# dofs:                  " << numDoFs );
+   WALBERLA_LOG_INFO_ON_ROOT( "MG smoothing (pre/post): "
+                              << "(" << preSmoothingSteps << ", " << postSmoothingSteps << ")" );
+
+   P1Function< real_t > u( "u", storage, minLevel, level );
+   P1Function< real_t > f( "f", storage, minLevel, level );
+   P1Function< real_t > r( "r", storage, minLevel, level );
+
+   auto A   = std::make_shared< P1ConstantLaplaceOperator >( storage, minLevel, level );
+   auto A_f = std::make_shared< P1ConstantSinglePrecisionOperator >( *A );
+
+   std::function< real_t( const hyteg::Point3D& ) > exactSolution = []( const hyteg::Point3D& x ) {
+      return std::sin( x[0] ) * std::sinh( x[1] );
+   };
+
+   const auto residualNorm = [&]() {
+      A->apply( u, r, level, Inner );
+      r.assign( {1.0, -1.0}, {f, r}, level, Inner );
+      return std::sqrt( r.dotGlobal( r, level, Inner ) / real_c( numDoFs ) );
+   };
+
+   const auto initialize = [&]() {
+      u.interpolate( exactSolution, level, DirichletBoundary );
+      u.interpolate( real_c( 0 ), level, Inner );
+      f.interpolate( real_c( 0 ), level, All );
+   };
+
+   std::ofstream csv;
+   WALBERLA_ROOT_SECTION()
+   {
+      if ( writeCSV )
+      {
+         csv.open( "MixedPrecisionMultigrid.csv" );
+         csv << "solver,iteration,time,residual\n";
+      }
+   }
+
+   const auto report = [&]( const std::string& solverName, uint_t iteration, real_t time, real_t residual ) {
+      WALBERLA_LOG_INFO_ON_ROOT(
+          walberla::format( "%13s | %4d | %10.4e s | %10.4e", solverName.c_str(), int_c( iteration ), time, residual ) );
+      WALBERLA_ROOT_SECTION()
+      {
+         if ( writeCSV )
+         {
+            csv << solverName << "," << iteration << "," << time << "," << residual << "\n";
+         }
+      }
+   };
+
+   // double precision coarse grid solver, shared by all variants
+   auto coarseGridSolver = std::make_shared< CGSolver< P1ConstantLaplaceOperator > >( storage, minLevel, minLevel );
+
+   ///////////////
+   // double MG //
+   ///////////////
+
+   {
+      initialize();
+
+      auto smoother             = std::make_shared< GaussSeidelSmoother< P1ConstantLaplaceOperator > >();
+      auto restrictionOperator  = std::make_shared< P1toP1LinearRestriction >();
+      auto prolongationOperator = std::make_shared< P1toP1LinearProlongation >();
+      GeometricMultigridSolver< P1ConstantLaplaceOperator > gmgSolver( storage,
+                                                                       smoother,
+                                                                       coarseGridSolver,
+                                                                       restrictionOperator,
+                                                                       prolongationOperator,
+                                                                       minLevel,
+                                                                       level,
+                                                                       preSmoothingSteps,
+                                                                       postSmoothingSteps );
+
+      real_t time = 0;
+      report( "mg-double", 0, time, residualNorm() );
+      for ( uint_t i = 1; i <= iterations; i++ )
+      {
+         timer.reset();
+         gmgSolver.solve( *A, u, f, level );
+         timer.end();
+         time += real_c( timer.last() );
+         report( "mg-double", i, time, residualNorm() );
+      }
+   }
+
+   // single precision V-cycle
+   auto smoother_f             = std::make_shared< GaussSeidelSmoother< P1ConstantSinglePrecisionOperator > >();
+   auto restrictionOperator_f  = std::make_shared< GenericP1toP1LinearRestriction< float > >();
+   auto prolongationOperator_f = std::make_shared< GenericP1toP1LinearProlongation< float > >();
+   auto coarseGridSolver_f =
+       std::make_shared< HigherPrecisionSolverWrapper< P1ConstantSinglePrecisionOperator, P1ConstantLaplaceOperator > >(
+           storage, minLevel, minLevel, A, coarseGridSolver );
+   auto gmgSolver_f = std::make_shared< GeometricMultigridSolver< P1ConstantSinglePrecisionOperator > >( storage,
+                                                                                                         smoother_f,
+                                                                                                         coarseGridSolver_f,
+                                                                                                         restrictionOperator_f,
+                                                                                                         prolongationOperator_f,
+                                                                                                         minLevel,
+                                                                                                         level,
+                                                                                                         preSmoothingSteps,
+                                                                                                         postSmoothingSteps );
+
+   ////////////////////////////////////
+   // iterative refinement, float MG //
+   ////////////////////////////////////
+
+   {
+      initialize();
+
+      // one V-cycle per call, no residual norm computation inside the solver
+      MixedPrecisionSolver< P1ConstantLaplaceOperator, P1ConstantSinglePrecisionOperator > mixedPrecisionSolver(
+          storage, minLevel, level, A_f, gmgSolver_f, 1, 0 );
+
+      real_t time = 0;
+      report( "mg-mixed", 0, time, residualNorm() );
+      for ( uint_t i = 1; i <= iterations; i++ )
+      {
+         timer.reset();
+         mixedPrecisionSolver.solve( *A, u, f, level );
+         timer.end();
+         time += real_c( timer.last() );
+         report( "mg-mixed", i, time, residualNorm() );
+      }
+   }
+
+   /////////////////////////////////
+   // CG, float MG preconditioner //
+   /////////////////////////////////
+
+   {
+      auto preconditioner =
+          std::make_shared< MixedPrecisionSolver< P1ConstantLaplaceOperator, P1ConstantSinglePrecisionOperator > >(
+              storage, minLevel, level, A_f, gmgSolver_f, 1, 0 );
+      preconditioner->setZeroInitialGuess( true );
+
+      // CG is restarted for each number of iterations, the time of the complete solve is reported
+      for ( uint_t i = 0; i <= cgIterations; i++ )
+      {
+         initialize();
+         CGSolver< P1ConstantLaplaceOperator > cgSolver( storage, minLevel, level, i, 1e-16, preconditioner );
+
+         timer.reset();
+         cgSolver.solve( *A, u, f, level );
+         timer.end();
+         report( "pcg-mixed", i, real_c( timer.last() ), residualNorm() );
+      }
+   }
+
+   //////////////////////////////////////////////////
+   // Stokes, MINRES, V-cycles for velocity blocks //
+   //////////////////////////////////////////////////
+
+   {
+      P1StokesFunction< real_t > uStokes( "uStokes", storage, minLevel, level );
+      P1StokesFunction< real_t > fStokes( "fStokes", storage, minLevel, level );
+      P1StokesFunction< real_t > rStokes( "rStokes", storage, minLevel, level );
+
+      P1StokesOperator L( storage, minLevel, level );
+
+      const auto numStokesDoFs = numberOfGlobalDoFs< P1StokesFunctionTag >( *storage, level );
+      WALBERLA_LOG_INFO_ON_ROOT( "# dofs (Stokes):         " << numStokesDoFs );
+
+      // velocity from the stream function sin( x ) sinh( y ), divergence free and harmonic with constant pressure
+      std::function< real_t( const hyteg::Point3D& ) > exactU = []( const hyteg::Point3D& x ) {
+         return std::sin( x[0] ) * std::cosh( x[1] );
+      };
+      std::function< real_t( const hyteg::Point3D& ) > exactV = []( const hyteg::Point3D& x ) {
+         return -std::cos( x[0] ) * std::sinh( x[1] );
+      };
+
+      const auto residualNormStokes = [&]() {
+         L.apply( uStokes, rStokes, level, Inner | NeumannBoundary );
+         rStokes.assign( {1.0, -1.0}, {fStokes, rStokes}, level, Inner | NeumannBoundary );
+         return std::sqrt( rStokes.dotGlobal( rStokes, level, Inner | NeumannBoundary ) / real_c( numStokesDoFs ) );
+      };
+
+      const auto initializeStokes = [&]() {
+         uStokes.interpolate( real_c( 0 ), level, All );
+         uStokes.uvw.u.interpolate( exactU, level, DirichletBoundary );
+         uStokes.uvw.v.interpolate( exactV, level, DirichletBoundary );
+         fStokes.interpolate( real_c( 0 ), level, All );
+      };
+
+      auto smoother             = std::make_shared< GaussSeidelSmoother< P1ConstantLaplaceOperator > >();
+      auto restrictionOperator  = std::make_shared< P1toP1LinearRestriction >();
+      auto prolongationOperator = std::make_shared< P1toP1LinearProlongation >();
+      auto velocityGMGSolver    = std::make_shared< GeometricMultigridSolver< P1ConstantLaplaceOperator > >( storage,
+                                                                                                          smoother,
+                                                                                                          coarseGridSolver,
+                                                                                                          restrictionOperator,
+                                                                                                          prolongationOperator,
+                                                                                                          minLevel,
+                                                                                                          level,
+                                                                                                          preSmoothingSteps,
+                                                                                                          postSmoothingSteps );
+
+      // Like the double precision V-cycle, the mixed precision preconditioner starts from the passed initial guess.
+      auto velocityMixedPrecisionSolver =
+          std::make_shared< MixedPrecisionSolver< P1ConstantLaplaceOperator, P1ConstantSinglePrecisionOperator > >(
+              storage, minLevel, level, A_f, gmgSolver_f, 1, 0 );
+
+      typedef StokesBlockDiagonalPreconditioner< P1StokesOperator, P1LumpedInvMassOperator > Preconditioner_T;
+
+      const std::vector< std::pair< std::string, std::shared_ptr< Solver< P1ConstantLaplaceOperator > > > > velocitySolvers = {
+          {"minres-double", velocityGMGSolver}, {"minres-mixed", velocityMixedPrecisionSolver}};
+
+      for ( const auto& velocitySolver : velocitySolvers )
+      {
+         auto preconditioner = std::make_shared< Preconditioner_T >( storage, minLevel, level, 1, velocitySolver.second );
+
+         // MINRES is restarted for each number of iterations, the time of the complete solve is reported
+         for ( uint_t i = 0; i <= minresIterations; i++ )
+         {
+            initializeStokes();
+            MinResSolver< P1StokesOperator > minresSolver( storage, minLevel, level, i, 1e-16, preconditioner );
+
+            timer.reset();
+            minresSolver.solve( L, uStokes, fStokes, level );
+            timer.end();
+            report( velocitySolver.first, i, real_c( timer.last() ), residualNormStokes() );
+         }
+      }
+   }
+
+   auto timingTreeReducedWithRemainder = timingTree->getReduced().getCopyWithRemainder();
+   WALBERLA_LOG_INFO_ON_ROOT( timingTreeReducedWithRemainder );
+
+   nlohmann::json ttjson = nlohmann::json( timingTreeReducedWithRemainder );
+   WALBERLA_ROOT_SECTION()
+   {
+      std::ofstream o( "MixedPrecisionMultigrid.json" );
+      o << ttjson;
+      o.close();
+   }
+}
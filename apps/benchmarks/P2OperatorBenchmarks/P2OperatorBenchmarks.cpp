@@ -291,19 +291,19 @@ void runBenchmark( uint_t level, real_t iterationMinTime, uint_t chunkSize, Kern
    const Cell& cell = *storage->getCell( storage->getCellIDs().front() );
 
    // gather all the pointers
-   auto v2v_opr_data = cell.getData( p2Operator.getVertexToVertexOpr().getCellStencilID() )->getData( level );
+   auto v2v_opr_data = cell.getData( p2Operator.getVertexToVertexOpr().getCellStencilID() )->getData( level ).toMap();
    auto v2v_src_data = cell.getData( p2Src.getVertexDoFFunction().getCellDataID() )->getPointer( level );
    auto v2v_dst_data = cell.getData( p2Dst.getVertexDoFFunction().getCellDataID() )->getPointer( level );
 
-   auto v2e_opr_data = cell.getData( p2Operator.getVertexToEdgeOpr().getCellStencilID() )->getData( level );
+   auto v2e_opr_data = cell.getData( p2Operator.getVertexToEdgeOpr().getCellStencilID() )->getData( level ).toMap();
    auto v2e_src_data = cell.getData( p2Src.getVertexDoFFunction().getCellDataID() )->getPointer( level );
    auto v2e_dst_data = cell.getData( p2Dst.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
 
-   auto e2v_opr_data = cell.getData( p2Operator.getEdgeToVertexOpr().getCellStencilID() )->getData( level );
+   auto e2v_opr_data = cell.getData( p2Operator.getEdgeToVertexOpr().getCellStencilID() )->getData( level ).toMap();
    auto e2v_src_data = cell.getData( p2Src.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
    auto e2v_dst_data = cell.getData( p2Dst.getVertexDoFFunction().getCellDataID() )->getPointer( level );
 
-   auto e2e_opr_data = cell.getData( p2Operator.getEdgeToEdgeOpr().getCellStencilID() )->getData( level );
+   auto e2e_opr_data = cell.getData( p2Operator.getEdgeToEdgeOpr().getCellStencilID() )->getData( level ).toMap();
    auto e2e_src_data = cell.getData( p2Src.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
    auto e2e_dst_data = cell.getData( p2Dst.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
 
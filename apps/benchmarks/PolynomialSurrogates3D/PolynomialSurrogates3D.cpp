@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "core/Environment.h"
+#include "core/timing/TimingJSON.h"
+
+#include "hyteg/FunctionTraits.hpp"
+#include "hyteg/elementwiseoperators/P1ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P1ToP2ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
+#include "hyteg/geometry/IcosahedralShellMap.hpp"
+#include "hyteg/mixedoperators/P1ToP2SurrogateOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/P1PolynomialBlendingOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/p2functionspace/P2SurrogateOperator.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using namespace hyteg;
+
+/*
+ * Accuracy vs. throughput of the 3D polynomial surrogate operators on a blended spherical shell.
+ *
+ * For each polynomial degree the surrogate operator is compared to the elementwise operator with the same form,
+ * which integrates every micro-element on every apply. Reported are the relative l2-error of the result of the apply,
+ * the time for the interpolation of the stencils (setup) and the time per apply, optionally also as CSV file.
+ * The throughput is measured in DoFs of the destination space, so the P1 and P2 rows are comparable per row of the operator.
+ */
+template < typename ElementwiseOperator_T, typename SurrogateOperator_T >
+void runStudy( const std::string&                         operatorName,
+               const std::shared_ptr< PrimitiveStorage >& storage,
+               const uint_t&                              level,
+               const uint_t&                              interpolationLevel,
+               const uint_t&                              minPolyDegree,
+               const uint_t&                              maxPolyDegree,
+               const uint_t&                              numApplications,
+               std::ofstream&                             csv,
+               const bool&                                writeCSV )
+{
+   typedef typename SurrogateOperator_T::srcType SrcFunction_T;
+   typedef typename SurrogateOperator_T::dstType DstFunction_T;
+
+   walberla::WcTimer timer;
+
+   const auto numDoFs = numberOfGlobalDoFs< typename FunctionTrait< DstFunction_T >::Tag >( *storage, level );
+
+   SrcFunction_T src( "src", storage, level, level );
+   DstFunction_T dstReference( "dstReference", storage, level, level );
+   DstFunction_T dst( "dst", storage, level, level );
+   DstFunction_T error( "error", storage, level, level );
+
+   std::function< real_t( const hyteg::Point3D& ) > srcFunction = []( const hyteg::Point3D& x ) {
+      return std::sin( 2.0 * x[0] ) * std::cos( 3.0 * x[1] ) * std::exp( x[2] );
+   };
+   src.interpolate( srcFunction, level, All );
+
+   const auto report = [&]( uint_t degree, real_t setupTime, real_t applyTime, real_t relativeError ) {
+      const std::string degreeString = degree == std::numeric_limits< uint_t >::max() ? "-" : std::to_string( degree );
+      WALBERLA_LOG_INFO_ON_ROOT( walberla::format( "%10s | %6s | %10.4e s | %10.4e s | %10.4e | %8.2f",
+                                                   operatorName.c_str(),
+                                                   degreeString.c_str(),
+                                                   setupTime,
+                                                   applyTime,
+                                                   relativeError,
+                                                   real_c( numDoFs ) / applyTime * 1e-6 ) );
+      WALBERLA_ROOT_SECTION()
+      {
+         if ( writeCSV )
+         {
+            csv << operatorName << "," << degreeString << "," << setupTime << "," << applyTime << "," << relativeError << ","
+                << real_c( numDoFs ) / applyTime * 1e-6 << "\n";
+         }
+      }
+   };
+
+   // elementwise reference
+   {
+      timer.reset();
+      ElementwiseOperator_T A( storage, level, level );
+      timer.end();
+      const real_t setupTime = real_c( timer.last() );
+
+      timer.reset();
+      for ( uint_t i = 0; i < numApplications; i++ )
+      {
+         A.apply( src, dstReference, level, All );
+      }
+      timer.end();
+      report( std::numeric_limits< uint_t >::max(), setupTime, real_c( timer.last() ) / real_c( numApplications ), 0 );
+   }
+
+   const real_t referenceNorm = std::sqrt( dstReference.dotGlobal( dstReference, level, All ) );
+
+   for ( uint_t degree = minPolyDegree; degree <= maxPolyDegree; degree++ )
+   {
+      timer.reset();
+      SurrogateOperator_T A( storage, level, level, interpolationLevel, degree );
+      timer.end();
+      const real_t setupTime = real_c( timer.last() );
+
+      timer.reset();
+      for ( uint_t i = 0; i < numApplications; i++ )
+      {
+         A.apply( src, dst, level, All );
+      }
+      timer.end();
+      const real_t applyTime = real_c( timer.last() ) / real_c( numApplications );
+
+      error.assign( { 1.0, -1.0 }, { dst, dstReference }, level, All );
+      const real_t relativeError = std::sqrt( error.dotGlobal( error, level, All ) ) / referenceNorm;
+
+      report( degree, setupTime, applyTime, relativeError );
+   }
+}
+
+int main( int argc, char** argv )
+{
+   walberla::Environment env( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   //check if a config was given on command line or load default file otherwise
+   auto cfg = std::make_shared< walberla::config::Config >();
+   if ( env.config() == nullptr )
+   {
+      auto defaultFile = "./PolynomialSurrogates3D.prm";
+      WALBERLA_LOG_PROGRESS_ON_ROOT( "No Parameter file given loading default parameter file: " << defaultFile );
+      cfg->readParameterFile( defaultFile );
+   }
+   else
+   {
+      cfg = env.config();
+   }
+   const walberla::Config::BlockHandle mainConf = cfg->getBlock( "Parameters" );
+
+   const uint_t level = mainConf.getParameter< uint_t >( "level" );
+
+   const uint_t nTan     = mainConf.getParameter< uint_t >( "nTan" );
+   const uint_t nRad     = mainConf.getParameter< uint_t >( "nRad" );
+   const real_t innerRad = mainConf.getParameter< real_t >( "innerRad" );
+   const real_t outerRad = mainConf.getParameter< real_t >( "outerRad" );
+
+   const uint_t interpolationLevel = mainConf.getParameter< uint_t >( "interpolationLevel" );
+   const uint_t minPolyDegree      = mainConf.getParameter< uint_t >( "minPolyDegree" );
+   const uint_t maxPolyDegree      = mainConf.getParameter< uint_t >( "maxPolyDegree" );
+   const uint_t numApplications    = mainConf.getParameter< uint_t >( "numApplications" );
+
+   const bool writeCSV = mainConf.getParameter< bool >( "writeCSV" );
+
+   MeshInfo              meshInfo = MeshInfo::meshSphericalShell( nTan, nRad, innerRad, outerRad );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   loadbalancing::roundRobin( setupStorage );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   IcosahedralShellMap::setMap( setupStorage );
+
+   auto                                timingTree = std::make_shared< walberla::WcTimingTree >();
+   std::shared_ptr< PrimitiveStorage > storage    = std::make_shared< PrimitiveStorage >( setupStorage, timingTree );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "" );
+   WALBERLA_LOG_INFO_ON_ROOT( "=========================================" );
+   WALBERLA_LOG_INFO_ON_ROOT( "=== 3D Polynomial Surrogate Operators ===" );
+   WALBERLA_LOG_INFO_ON_ROOT( "=========================================" );
+   WALBERLA_LOG_INFO_ON_ROOT( "" );
+   WALBERLA_LOG_INFO_ON_ROOT( storage->getGlobalInfo() );
+   WALBERLA_LOG_INFO_ON_ROOT( "level:                   " << level );
+   WALBERLA_LOG_INFO_ON_ROOT( "interpolation level:     " << interpolationLevel );
+   WALBERLA_LOG_INFO_ON_ROOT( "polynomial degrees:      " << minPolyDegree << " - " << maxPolyDegree );
+   WALBERLA_LOG_INFO_ON_ROOT( "# dofs (P1):             " << numberOfGlobalDoFs< P1FunctionTag >( *storage, level ) );
+   WALBERLA_LOG_INFO_ON_ROOT( "# dofs (P2):             " << numberOfGlobalDoFs< P2FunctionTag >( *storage, level ) );
+   WALBERLA_LOG_INFO_ON_ROOT( "" );
+   WALBERLA_LOG_INFO_ON_ROOT(
+       walberla::format( "%10s | %6s | %12s | %12s | %10s | %8s", "operator", "degree", "setup", "apply", "rel. error", "MDoF/s" ) );
+
+   std::ofstream csv;
+   WALBERLA_ROOT_SECTION()
+   {
+      if ( writeCSV )
+      {
+         csv.open( "PolynomialSurrogates3D.csv" );
+         csv << "operator,degree,setup,apply,error,mdofs\n";
+      }
+   }
+
+   runStudy< P1ElementwiseBlendingLaplaceOperator3D, P1PolynomialBlendingLaplaceOperator3D >(
+       "P1 laplace", storage, level, interpolationLevel, minPolyDegree, maxPolyDegree, numApplications, csv, writeCSV );
+   runStudy< P1ElementwiseBlendingMassOperator3D, P1PolynomialBlendingMassOperator3D >(
+       "P1 mass", storage, level, interpolationLevel, minPolyDegree, maxPolyDegree, numApplications, csv, writeCSV );
+   runStudy< P2ElementwiseBlendingLaplaceOperator, P2SurrogateLaplaceOperator >(
+       "P2 laplace", storage, level, interpolationLevel, minPolyDegree, maxPolyDegree, numApplications, csv, writeCSV );
+   runStudy< P2ElementwiseBlendingMassOperator, P2SurrogateMassOperator >(
+       "P2 mass", storage, level, interpolationLevel, minPolyDegree, maxPolyDegree, numApplications, csv, writeCSV );
+   runStudy< P1ToP2ElementwiseBlendingDivTxOperator, P1ToP2SurrogateDivTxOperator >(
+       "P1P2 divTx", storage, level, interpolationLevel, minPolyDegree, maxPolyDegree, numApplications, csv, writeCSV );
+
+   auto timingTreeReducedWithRemainder = timingTree->getReduced().getCopyWithRemainder();
+   WALBERLA_LOG_INFO_ON_ROOT( timingTreeReducedWithRemainder );
+
+   nlohmann::json ttjson = nlohmann::json( timingTreeReducedWithRemainder );
+   WALBERLA_ROOT_SECTION()
+   {
+      std::ofstream o( "PolynomialSurrogates3D.json" );
+      o << ttjson;
+      o.close();
+   }
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/config/Config.h"
+#include "core/math/Constants.h"
+#include "core/mpi/MPIManager.h"
+#include "core/timing/Timer.h"
+
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticProlongation.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticRestriction.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+#include "hyteg/solvers/MultiColorSORSmoother.hpp"
+#include "hyteg/solvers/SORSmoother.hpp"
+
+using walberla::real_t;
+using walberla::int_c;
+using walberla::real_c;
+using walberla::uint_c;
+using walberla::uint_t;
+using walberla::math::pi;
+
+using namespace hyteg;
+
+namespace hyteg {
+
+/// Compares geometric multigrid with lexicographic SOR smoothing to geometric multigrid with multi-color SOR smoothing.
+///
+/// Both solvers are applied to the same Laplace problem with a harmonic solution, zero right-hand side and zero
+/// initial guess. For each V-cycle the residual and the run time are recorded. The comparison metric is the
+/// residual reduction per second (in orders of magnitude).
+template < typename FunctionType,
+           typename OperatorType,
+           typename RestrictionOperatorType,
+           typename ProlongationOperatorType >
+void compareSmoothers( const std::shared_ptr< PrimitiveStorage >& storage,
+                       const walberla::Config::BlockHandle&       parameters,
+                       const std::string&                         discretization )
+{
+   const uint_t minLevel        = parameters.getParameter< uint_t >( "minLevel" );
+   const uint_t maxLevel        = parameters.getParameter< uint_t >( "maxLevel" );
+   const uint_t numVCycles      = parameters.getParameter< uint_t >( "numVCycles" );
+   const uint_t maxCoarseIter   = parameters.getParameter< uint_t >( "maxCoarseIter" );
+   const real_t coarseTolerance = parameters.getParameter< real_t >( "coarseTolerance" );
+   const uint_t smoothingSteps  = parameters.getParameter< uint_t >( "smoothingSteps" );
+   const real_t relax           = parameters.getParameter< real_t >( "relax" );
+   const bool   writeCSV        = parameters.getParameter< bool >( "writeCSV" );
+   const uint_t dim             = storage->hasGlobalCells() ? 3 : 2;
+
+   const auto solution = [dim]( const Point3D& p ) -> real_t {
+      if ( dim == 3 )
+      {
+         return std::sin( pi * p[0] ) * std::sin( pi * p[1] ) * std::sinh( std::sqrt( 2.0 ) * pi * p[2] );
+      }
+      return std::sin( pi * p[0] ) * std::sinh( pi * p[1] );
+   };
+
+   FunctionType u( "u", storage, minLevel, maxLevel );
+   FunctionType f( "f", storage, minLevel, maxLevel );
+   FunctionType Au( "Au", storage, minLevel, maxLevel );
+   FunctionType r( "r", storage, minLevel, maxLevel );
+
+   OperatorType A( storage, minLevel, maxLevel );
+
+   const auto residualNorm = [&]() -> real_t {
+      A.apply( u, Au, maxLevel, Inner );
+      r.assign( { 1.0, -1.0 }, { f, Au }, maxLevel, Inner );
+      return std::sqrt( r.dotGlobal( r, maxLevel, Inner ) );
+   };
+
+   auto coarseGridSolver = std::make_shared< CGSolver< OperatorType > >( storage, minLevel, minLevel, maxCoarseIter, coarseTolerance );
+   auto restrictionOperator  = std::make_shared< RestrictionOperatorType >();
+   auto prolongationOperator = std::make_shared< ProlongationOperatorType >();
+
+   std::map< std::string, std::shared_ptr< Solver< OperatorType > > > smoothers;
+   smoothers["lexicographic"] = std::make_shared< SORSmoother< OperatorType > >( relax );
+   smoothers["multicolor"]    = std::make_shared< MultiColorSORSmoother< OperatorType > >( relax );
+
+   for ( const auto& smoother : smoothers )
+   {
+      GeometricMultigridSolver< OperatorType > gmg( storage,
+                                                    smoother.second,
+                                                    coarseGridSolver,
+                                                    restrictionOperator,
+                                                    prolongationOperator,
+                                                    minLevel,
+                                                    maxLevel,
+                                                    smoothingSteps,
+                                                    smoothingSteps );
+
+      u.interpolate( real_c( 0 ), maxLevel, All );
+      u.interpolate( solution, maxLevel, DirichletBoundary );
+      f.interpolate( real_c( 0 ), maxLevel, All );
+
+      std::vector< real_t > residuals( { residualNorm() } );
+      std::vector< double > times( { 0.0 } );
+
+      walberla::WcTimer timer;
+      for ( uint_t cycle = 1; cycle <= numVCycles; cycle++ )
+      {
+         WALBERLA_MPI_BARRIER();
+         timer.start();
+         gmg.solve( A, u, f, maxLevel );
+         WALBERLA_MPI_BARRIER();
+         timer.end();
+
+         residuals.push_back( residualNorm() );
+         times.push_back( timer.total() );
+
+         WALBERLA_LOG_INFO_ON_ROOT( walberla::format( "[%s] cycle %3d | residual %10.5e | rate %5.3f | time %8.4f s",
+                                                      smoother.first.c_str(),
+                                                      int_c( cycle ),
+                                                      residuals[cycle],
+                                                      residuals[cycle] / residuals[cycle - 1],
+                                                      timer.last() ) );
+      }
+
+      const real_t averageRate     = std::pow( residuals.back() / residuals.front(), 1.0 / real_c( numVCycles ) );
+      const real_t digitsPerSecond = -std::log10( residuals.back() / residuals.front() ) / timer.total();
+
+      WALBERLA_LOG_INFO_ON_ROOT( "[" << smoother.first << "] " << discretization << ", " << dim << "D, level " << maxLevel
+                                     << ": average convergence rate " << averageRate << ", total time " << timer.total()
+                                     << " s, residual reduction per second (orders of magnitude) " << digitsPerSecond );
+
+      if ( writeCSV )
+      {
+         WALBERLA_ROOT_SECTION()
+         {
+            std::stringstream filename;
+            filename << "csv/" << discretization << "-" << dim << "D-" << smoother.first << "-" << smoothingSteps << "steps-"
+                     << maxLevel << "level.csv";
+
+            std::ofstream ofs( filename.str() );
+            ofs << "iter,resNorm,time\n";
+            for ( uint_t i = 0; i < residuals.size(); i++ )
+            {
+               ofs << i << "," << residuals[i] << "," << times[i] << "\n";
+            }
+         }
+      }
+   }
+}
+
+} // namespace hyteg
+
+int main( int argc, char** argv )
+{
+   walberla::Environment env( argc, argv );
+   walberla::mpi::MPIManager::instance()->useWorldComm();
+
+   walberla::shared_ptr< walberla::config::Config > cfg( new walberla::config::Config );
+   if ( env.config() == nullptr )
+   {
+      cfg->readParameterFile( "./MultiColorSmootherComparison.prm" );
+   }
+   else
+   {
+      cfg = env.config();
+   }
+
+   walberla::Config::BlockHandle parameters = cfg->getOneBlock( "Parameters" );
+   parameters.listParameters();
+
+   const uint_t      dim            = parameters.getParameter< uint_t >( "dim" );
+   const std::string discretization = parameters.getParameter< std::string >( "discretization" );
+
+   MeshInfo meshInfo = dim == 3 ? MeshInfo::meshSymmetricCuboid( Point3D( { 0, 0, 0 } ), Point3D( { 1, 1, 1 } ), 1, 1, 1 ) :
+                                  MeshInfo::meshRectangle( Point2D( { 0, 0 } ), Point2D( { 1, 1 } ), MeshInfo::CRISSCROSS, 4, 4 );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   if ( discretization == "P1" )
+   {
+      compareSmoothers< P1Function< real_t >, P1ConstantLaplaceOperator, P1toP1LinearRestriction, P1toP1LinearProlongation >(
+          storage, parameters, discretization );
+   }
+   else if ( discretization == "P2" )
+   {
+      compareSmoothers< P2Function< real_t >,
+                        P2ConstantLaplaceOperator,
+                        P2toP2QuadraticRestriction,
+                        P2toP2QuadraticProlongation >( storage, parameters, discretization );
+   }
+   else
+   {
+      WALBERLA_ABORT( "unknown discretization " << discretization );
+   }
+}
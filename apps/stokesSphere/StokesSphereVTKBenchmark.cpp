@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/Format.hpp"
+#include "core/config/Config.h"
+#include "core/mpi/MPIManager.h"
+#include "core/timing/Timer.h"
+
+#include "hyteg/composites/P1StokesFunction.hpp"
+#include "hyteg/dataexport/VTKOutput.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+using namespace hyteg;
+
+/// Compares write time and file size of the VTK output in ASCII, BINARY and APPENDED format
+/// for the velocity and pressure of the StokesSphere app.
+int main( int argc, char* argv[] )
+{
+   walberla::Environment env( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   auto cfg = std::make_shared< walberla::config::Config >();
+   if ( env.config() == nullptr )
+   {
+      auto defaultFile = "./StokesSphereVTKBenchmark.prm";
+      WALBERLA_LOG_INFO_ON_ROOT( "No Parameter file given loading default parameter file: " << defaultFile );
+      cfg->readParameterFile( defaultFile );
+   }
+   else
+   {
+      cfg = env.config();
+   }
+
+   const walberla::Config::BlockHandle mainConf    = cfg->getBlock( "Parameters" );
+   const walberla::Config::BlockHandle layersParam = cfg->getBlock( "Layers" );
+
+   mainConf.listParameters();
+
+   const uint_t ntan           = mainConf.getParameter< uint_t >( "ntan" );
+   const uint_t level          = mainConf.getParameter< uint_t >( "level" );
+   const uint_t numRepetitions = mainConf.getParameter< uint_t >( "numRepetitions" );
+
+   std::vector< double > layers;
+   for ( auto it : layersParam )
+   {
+      layers.push_back( layersParam.getParameter< double >( it.first ) );
+   }
+
+   hyteg::MeshInfo              meshInfo = hyteg::MeshInfo::meshSphericalShell( ntan, layers );
+   hyteg::SetupPrimitiveStorage setupStorage( meshInfo,
+                                              walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   hyteg::loadbalancing::roundRobin( setupStorage );
+
+   std::shared_ptr< hyteg::PrimitiveStorage > storage = std::make_shared< hyteg::PrimitiveStorage >( setupStorage );
+
+   hyteg::P1StokesFunction< real_t > u( "u", storage, level, level );
+
+   std::function< real_t( const hyteg::Point3D& ) > radial = []( const hyteg::Point3D& x ) { return x.norm(); };
+   std::function< real_t( const hyteg::Point3D& ) > wave   = []( const hyteg::Point3D& x ) {
+      return std::sin( x[0] ) * std::cos( x[1] ) * x[2];
+   };
+
+   u.uvw.u.interpolate( wave, level, All );
+   u.uvw.v.interpolate( radial, level, All );
+   u.uvw.w.interpolate( wave, level, All );
+   u.p.interpolate( radial, level, All );
+
+   const std::vector< std::pair< std::string, vtk::DataFormat > > formats = {
+       {"ASCII", vtk::DataFormat::ASCII}, {"BINARY", vtk::DataFormat::BINARY}, {"APPENDED", vtk::DataFormat::APPENDED}};
+
+   WALBERLA_LOG_INFO_ON_ROOT( "   format |  avg. write time [s] | file size [bytes]" );
+   WALBERLA_LOG_INFO_ON_ROOT( "----------+----------------------+------------------" );
+
+   for ( const auto& format : formats )
+   {
+      const std::string filename = "StokesSphereVTKBenchmark_" + format.first;
+
+      hyteg::VTKOutput vtkOutput( "./output", filename, storage );
+      vtkOutput.setVTKDataFormat( format.second );
+      vtkOutput.add( u );
+
+      walberla::WcTimer timer;
+      for ( uint_t i = 0; i < numRepetitions; i++ )
+      {
+         WALBERLA_MPI_BARRIER();
+         timer.start();
+         vtkOutput.write( level, i );
+         WALBERLA_MPI_BARRIER();
+         timer.end();
+      }
+
+      WALBERLA_ROOT_SECTION()
+      {
+         const std::string completeFilePath =
+             walberla::format( "./output/%s_VertexDoF_level%u_ts%u.vtu", filename.c_str(), level, 0 );
+         std::ifstream     file( completeFilePath.c_str(), std::ifstream::binary | std::ifstream::ate );
+         WALBERLA_CHECK( !!file, "Could not open " << completeFilePath );
+         const auto fileSize = file.tellg();
+
+         WALBERLA_LOG_INFO( std::setw( 9 ) << format.first << " | " << std::setw( 20 ) << std::scientific << timer.average()
+                                           << " | " << std::setw( 16 ) << fileSize );
+      }
+   }
+
+   return EXIT_SUCCESS;
+}
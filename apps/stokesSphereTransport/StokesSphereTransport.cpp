@@ -32,6 +32,7 @@
 #include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
 #include "hyteg/composites/P2P1TaylorHoodStokesOperator.hpp"
 #include "hyteg/composites/UnsteadyDiffusion.hpp"
+#include "hyteg/dataexport/FunctionCheckpoint.hpp"
 #include "hyteg/dataexport/TimingOutput.hpp"
 #include "hyteg/dataexport/VTKOutput.hpp"
 #include "hyteg/gridtransferoperators/P1toP1InjectionRestriction.hpp"
@@ -112,6 +113,10 @@ void simulate( int argc, char* argv[] )
    const std::string vtkBaseFile          = mainConf.getParameter< std::string >( "vtkBaseFile" );
    const std::string vtkDirectory         = mainConf.getParameter< std::string >( "vtkDirectory" );
    const uint_t      vtkOutputLevel       = mainConf.getParameter< uint_t >( "vtkOutputLevel" );
+   const uint_t      checkpointFrequency  = mainConf.getParameter< uint_t >( "checkpointFrequency" );
+   const std::string checkpointBaseFile   = mainConf.getParameter< std::string >( "checkpointBaseFile" );
+   const bool        restart              = mainConf.getParameter< bool >( "restart" );
+   const uint_t      restartStep          = mainConf.getParameter< uint_t >( "restartStep" );
 
    WALBERLA_LOG_INFO_ON_ROOT( "Parameters:" )
    WALBERLA_LOG_INFO_ON_ROOT( " - domain:" )
@@ -137,16 +142,34 @@ void simulate( int argc, char* argv[] )
    WALBERLA_LOG_INFO_ON_ROOT( "   + VTK output level: " << vtkOutputLevel )
    WALBERLA_LOG_INFO_ON_ROOT( "   + VTK interval: " << VTKOutputFrequency )
    WALBERLA_LOG_INFO_ON_ROOT( "   + print timing: " << printTiming )
+   WALBERLA_LOG_INFO_ON_ROOT( "   + checkpoint interval: " << checkpointFrequency )
+   WALBERLA_LOG_INFO_ON_ROOT( "   + checkpoint base name: " << checkpointBaseFile )
+   WALBERLA_LOG_INFO_ON_ROOT( "   + restart: " << restart )
+   WALBERLA_LOG_INFO_ON_ROOT( "   + restart step: " << restartStep )
    WALBERLA_LOG_INFO_ON_ROOT( "   + exit after domain output: " << exitAfterWriteDomain )
    WALBERLA_LOG_INFO_ON_ROOT( "" )
 
    /////////////////// Mesh / Domain ///////////////////////
 
-   MeshInfo meshInfo     = MeshInfo::meshSphericalShell( ntan, layers );
-   auto     setupStorage = std::make_shared< SetupPrimitiveStorage >(
-       meshInfo, walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   auto checkpointFile = [&]( uint_t timestep ) {
+      return vtkDirectory + "/" + checkpointBaseFile + "_" + std::to_string( timestep ) + ".dat";
+   };
+
+   const uint_t numProcesses = walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
 
-   setupStorage->setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   std::shared_ptr< SetupPrimitiveStorage > setupStorage;
+   if ( restart )
+   {
+      // the checkpoint contains the topology (including the boundary flags) and can be restored on any number of processes
+      WALBERLA_LOG_INFO_ON_ROOT( "Restoring domain from checkpoint " << checkpointFile( restartStep ) )
+      setupStorage = FunctionCheckpoint::readSetupStorage( checkpointFile( restartStep ), numProcesses );
+   }
+   else
+   {
+      MeshInfo meshInfo = MeshInfo::meshSphericalShell( ntan, layers );
+      setupStorage      = std::make_shared< SetupPrimitiveStorage >( meshInfo, numProcesses );
+      setupStorage->setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   }
 
    std::shared_ptr< walberla::WcTimingTree > timingTree( new walberla::WcTimingTree() );
    std::shared_ptr< PrimitiveStorage >       storage = std::make_shared< PrimitiveStorage >( *setupStorage, timingTree );
@@ -240,7 +263,7 @@ void simulate( int argc, char* argv[] )
    auto gmgSolver = std::make_shared< GeometricMultigridSolver< P2P1TaylorHoodStokesOperator > >(
        storage, uzawaSmoother, coarseGridSolver, stokesRestriction, stokesProlongation, minLevel, maxLevel, 3, 3, 2 );
 
-   MMOCTransport< P2Function< real_t > > transport( storage, setupStorage, minLevel, maxLevel, TimeSteppingScheme::RK4 );
+   MMOCTransport< P2Function< real_t > > transport( storage, minLevel, maxLevel, TimeSteppingScheme::RK4 );
 
    P2ConstantUnsteadyDiffusionOperator diffusionOperator( storage, minLevel, maxLevel, dt, diffusivity, DiffusionTimeIntegrator::ImplicitEuler );
    auto                        diffusionCoarseGridSolver =
@@ -256,10 +279,21 @@ void simulate( int argc, char* argv[] )
    UnsteadyDiffusion< P2Function< real_t >, P2ConstantUnsteadyDiffusionOperator, P2ConstantLaplaceOperator, P2ConstantMassOperator > diffusion(
        storage, minLevel, maxLevel, diffusionSolver );
 
+   // the velocity of the last time step and all other functions are recomputed from these within each time step
+   FunctionCheckpoint checkpoint( storage );
+   checkpoint.add( u );
+   checkpoint.add( temp );
+
+   const uint_t firstStep = restart ? restartStep : 0;
+   if ( restart )
+   {
+      checkpoint.restore( checkpointFile( restartStep ) );
+   }
+
    printFunctionAllocationInfo( *storage, 1 );
 
    walberla::WcTimer timer;
-   real_t            time = 0.0;
+   real_t            time = real_c( firstStep ) * dt;
 
    auto calculateResidualStokes = [&]() {
       L.apply( u, r, maxLevel, Inner | NeumannBoundary );
@@ -321,12 +355,12 @@ void simulate( int argc, char* argv[] )
 
    if ( writeVTK )
    {
-      writeVTKCallback( 0 );
+      writeVTKCallback( firstStep );
    }
 
    storage->getTimingTree()->start( "Simulation" );
 
-   for ( uint_t step = 0; step < timeSteps; ++step )
+   for ( uint_t step = firstStep; step < timeSteps; ++step )
    {
       WALBERLA_LOG_INFO_ON_ROOT( "##### Time step " << step << " #####" )
       WALBERLA_LOG_INFO_ON_ROOT( "" )
@@ -434,6 +468,14 @@ void simulate( int argc, char* argv[] )
       {
          writeVTKCallback( step + 1 );
       }
+
+      if ( checkpointFrequency > 0 && ( step + 1 ) % checkpointFrequency == 0 )
+      {
+         storage->getTimingTree()->start( "Checkpoint" );
+         WALBERLA_LOG_INFO_ON_ROOT( "Writing checkpoint " << checkpointFile( step + 1 ) )
+         checkpoint.write( checkpointFile( step + 1 ) );
+         storage->getTimingTree()->stop( "Checkpoint" );
+      }
    }
 
    storage->getTimingTree()->stop( "Simulation" );
@@ -43,6 +43,12 @@ def parameter_string(vtkDirectory, vtkBaseName, ntan, num_layers):
   vtkDirectory {vtkDirectory};
   vtkOutputLevel 4; // P1 level, max output level <= maxLevel but will output only the vertex unknowns (cannot output all DoFs)
   exitAfterWriteDomain false; // true to exit application after coarse domain output (to improve mesh offline)
+
+  /// checkpointing (files are written to the vtkDirectory)
+  checkpointFrequency 0; // write a checkpoint every n time steps, 0 disables checkpointing
+  checkpointBaseFile {vtkBaseName}_checkpoint;
+  restart false; // continue from the checkpoint written after time step restartStep
+  restartStep 0;
 }}
 
 /// Layers for the spherical shell generator
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+
+# Generates the MonomialBasis3D class.
+#
+# The monomials are sorted by their total degree. Within a degree d, they are
+# sorted by the power of z and then in the same order as the 2D basis, i.e.
+#
+#   x^d, x^(d-1) y, ..., y^d, x^(d-1) z, x^(d-2) y z, ..., y^(d-1) z, ..., z^d
+
+DEGREE = 12
+
+
+def power(var, exponent):
+  return '*'.join([var] * exponent)
+
+
+def monomial(i, j, k):
+  factors = [power(var, e) for var, e in (('x[0]', i), ('x[1]', j), ('x[2]', k)) if e > 0]
+  if len(factors) == 0:
+    return '1'
+  if len(factors) == 1:
+    return factors[0]
+  return '*'.join('({})'.format(f) if '*' in f else f for f in factors)
+
+
+monomials = []
+
+for d in range(DEGREE + 1):
+  for k in range(d + 1):
+    for j in range(d - k + 1):
+      monomials.append(monomial(d - k - j, j, k))
+
+
+def generate(name):
+  print('class {} {{'.format(name))
+  print('public:')
+  print('  static real_t eval(uint_t basis, const Point3D &x) {')
+  print('    switch(basis) {')
+
+  for i, m in enumerate(monomials):
+    print('      case {}:'.format(i))
+    print('        return {};'.format(m))
+
+  print('      default:')
+  print('      WALBERLA_ABORT("Polynomial basis " << basis << " was not generated");')
+  print('    }')
+  print('  }')
+  print('};\n')
+
+
+print('#pragma once\n')
+print('// This file was generated by the monomial_basis_3d.py Python script')
+print('// Do not edit it by hand\n')
+print('namespace hyteg {\n')
+
+generate('MonomialBasis3D')
+
+print('}')
@@ -22,6 +22,7 @@
 
 #include "core/math/MatrixMxN.h"
 #include "core/mpi/MPIWrapper.h"
+#include "core/mpi/Reduce.h"
 
 #include "hyteg/FunctionIterator.hpp"
 #include "hyteg/MeshQuality.hpp"
@@ -39,8 +40,8 @@
 #include "hyteg/p2functionspace/P2MacroCell.hpp"
 #include "hyteg/p2functionspace/P2MacroFace.hpp"
 #include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "coupling_hyteg_convection_particles/ParticleLocator.hpp"
 #include "coupling_hyteg_convection_particles/communication/SyncNextNeighborsByPrimitiveID.h"
-#include "coupling_hyteg_convection_particles/setupPrimitiveStorage/SetupPrimitiveStorageConvectionParticlesInterface.hpp"
 
 #include "convection_particles/data/ParticleStorage.h"
 #include "convection_particles/mpi/SyncNextNeighborsNoGhosts.h"
@@ -92,242 +93,6 @@ const static std::map< TimeSteppingScheme, std::vector< real_t > > RK_c = {
     {TimeSteppingScheme::Ralston, RK_c_Ralston},
     {TimeSteppingScheme::RK4, RK_c_RK4}};
 
-inline std::vector< PrimitiveID > getNeighboringPrimitives( const PrimitiveID&           primitiveID,
-                                                            const SetupPrimitiveStorage& setupStorage )
-{
-   std::set< PrimitiveID > neighboringPrimitives;
-   if ( setupStorage.getNumberOfCells() > 0 )
-   {
-      auto cellID = primitiveID;
-      auto cell   = setupStorage.getCell( cellID );
-
-      for ( const auto& vertexID : cell->neighborVertices() )
-      {
-         auto vertex = setupStorage.getVertex( vertexID );
-         for ( const auto& neighborCellID : vertex->neighborCells() )
-         {
-            neighboringPrimitives.insert( neighborCellID );
-         }
-      }
-   }
-   else
-   {
-      auto faceID = primitiveID;
-      auto face   = setupStorage.getFace( faceID );
-
-      for ( const auto& vertexID : face->neighborVertices() )
-      {
-         auto vertex = setupStorage.getVertex( vertexID );
-         for ( const auto& neighborFaceID : vertex->neighborFaces() )
-         {
-            neighboringPrimitives.insert( neighborFaceID );
-         }
-      }
-   }
-   return std::vector< PrimitiveID >( neighboringPrimitives.begin(), neighboringPrimitives.end() );
-}
-
-inline void updateParticlePosition( const SetupPrimitiveStorage&                           setupStorage,
-                                    walberla::convection_particles::data::ParticleStorage& particleStorage,
-                                    const real_t&                                          particleLocationRadius )
-{
-   if ( setupStorage.getNumberOfCells() == 0 )
-   {
-      for ( auto p : particleStorage )
-      {
-         p.setOutsideDomain( 0 );
-         bool foundByPointLocation = false;
-
-         // check for current cell (probability is high that we find the particle here...)
-         const auto faceID = p->getContainingPrimitive();
-         const auto face   = setupStorage.getFace( faceID );
-
-         Point3D computationalLocation;
-         face->getGeometryMap()->evalFinv( toPoint3D( p->getPosition() ), computationalLocation );
-         Point2D computationalLocation2D( {computationalLocation[0], computationalLocation[1]} );
-
-         if ( isPointInTriangle( computationalLocation2D,
-                                 Point2D( {face->getCoordinates().at( 0 )[0], face->getCoordinates().at( 0 )[1]} ),
-                                 Point2D( {face->getCoordinates().at( 1 )[0], face->getCoordinates().at( 1 )[1]} ),
-                                 Point2D( {face->getCoordinates().at( 2 )[0], face->getCoordinates().at( 2 )[1]} ) ) )
-         {
-            p->setContainingPrimitive( faceID );
-            foundByPointLocation = true;
-         }
-         else
-         {
-            // check for neighbor cells if we did not find it in its previous cell
-            const auto neighboringFaces = getNeighboringPrimitives( faceID, setupStorage );
-            for ( const auto& neighborFaceID : neighboringFaces )
-            {
-               const auto neighborFace = setupStorage.getFace( neighborFaceID );
-               Point3D    computationalLocationNeighbor;
-               neighborFace->getGeometryMap()->evalFinv( toPoint3D( p->getPosition() ), computationalLocationNeighbor );
-               Point2D computationalLocationNeighbor2D( {computationalLocationNeighbor[0], computationalLocationNeighbor[1]} );
-
-               if ( isPointInTriangle(
-                        computationalLocationNeighbor2D,
-                        Point2D( {neighborFace->getCoordinates().at( 0 )[0], neighborFace->getCoordinates().at( 0 )[1]} ),
-                        Point2D( {neighborFace->getCoordinates().at( 1 )[0], neighborFace->getCoordinates().at( 1 )[1]} ),
-                        Point2D( {neighborFace->getCoordinates().at( 2 )[0], neighborFace->getCoordinates().at( 2 )[1]} ) ) )
-               {
-                  // set it to the first neighbor we found to contain the particle
-                  p->setContainingPrimitive( neighborFaceID );
-                  foundByPointLocation = true;
-                  break;
-               }
-            }
-         }
-
-         if ( !foundByPointLocation )
-         {
-            // At this point there are still three possible scenarios regarding the location of the particle:
-            // 1. The particle is outside the neighborhood -> timestep too large, we do not care and crash.
-            // 2. The particle is outside of the entire domain -> we set the outsideDomain flag.
-            // 3. The particle is in the neighborhood patch, but floating-point errors made all point location
-            //    calculations return false. We therefore check with a larger radius.
-            if ( sphereTriangleIntersection( computationalLocation,
-                                             particleLocationRadius,
-                                             face->getCoordinates().at( 0 ),
-                                             face->getCoordinates().at( 1 ),
-                                             face->getCoordinates().at( 2 ) ) )
-            {
-               p->setContainingPrimitive( faceID );
-               foundByPointLocation = true;
-            }
-            else
-            {
-               const auto neighboringFaces = getNeighboringPrimitives( faceID, setupStorage );
-               for ( const auto& neighborFaceID : neighboringFaces )
-               {
-                  const auto neighborFace = setupStorage.getFace( neighborFaceID );
-                  Point3D    computationalLocationNeighbor;
-                  neighborFace->getGeometryMap()->evalFinv( toPoint3D( p->getPosition() ), computationalLocationNeighbor );
-
-                  if ( sphereTriangleIntersection( computationalLocationNeighbor,
-                                                   particleLocationRadius,
-                                                   neighborFace->getCoordinates().at( 0 ),
-                                                   neighborFace->getCoordinates().at( 1 ),
-                                                   neighborFace->getCoordinates().at( 2 ) ) )
-                  {
-                     p->setContainingPrimitive( neighborFaceID );
-                     foundByPointLocation = true;
-                     break;
-                  }
-               }
-            }
-         }
-
-         if ( !foundByPointLocation )
-         {
-            p->setOutsideDomain( 1 );
-         }
-      }
-   }
-   else
-   {
-      for ( auto p : particleStorage )
-      {
-         p.setOutsideDomain( 0 );
-         bool foundByPointLocation = false;
-
-         // check for current cell (probability is high that we find the particle here...)
-         const auto cellID = p->getContainingPrimitive();
-         const auto cell   = setupStorage.getCell( cellID );
-
-         Point3D computationalLocation;
-         cell->getGeometryMap()->evalFinv( toPoint3D( p->getPosition() ), computationalLocation );
-
-         if ( isPointInTetrahedron( computationalLocation,
-                                    cell->getCoordinates().at( 0 ),
-                                    cell->getCoordinates().at( 1 ),
-                                    cell->getCoordinates().at( 2 ),
-                                    cell->getCoordinates().at( 3 ),
-                                    cell->getFaceInwardNormal( 0 ),
-                                    cell->getFaceInwardNormal( 1 ),
-                                    cell->getFaceInwardNormal( 2 ),
-                                    cell->getFaceInwardNormal( 3 ) ) )
-         {
-            p->setContainingPrimitive( cellID );
-            foundByPointLocation = true;
-         }
-         else
-         {
-            // check for neighbor cells if we did not find it in its previous cell
-            const auto& neighboringCells = cell->getIndirectNeighborCellIDs();
-            for ( const auto& neighborCellID : neighboringCells )
-            {
-               const auto neighborCell = setupStorage.getCell( neighborCellID );
-               Point3D    computationalLocationNeighbor;
-               neighborCell->getGeometryMap()->evalFinv( toPoint3D( p->getPosition() ), computationalLocationNeighbor );
-
-               if ( isPointInTetrahedron( computationalLocationNeighbor,
-                                          neighborCell->getCoordinates().at( 0 ),
-                                          neighborCell->getCoordinates().at( 1 ),
-                                          neighborCell->getCoordinates().at( 2 ),
-                                          neighborCell->getCoordinates().at( 3 ),
-                                          neighborCell->getFaceInwardNormal( 0 ),
-                                          neighborCell->getFaceInwardNormal( 1 ),
-                                          neighborCell->getFaceInwardNormal( 2 ),
-                                          neighborCell->getFaceInwardNormal( 3 ) ) )
-               {
-                  // set it to the first neighbor we found to contain the particle
-                  p->setContainingPrimitive( neighborCellID );
-                  foundByPointLocation = true;
-                  break;
-               }
-            }
-         }
-
-         if ( !foundByPointLocation )
-         {
-            // At this point there are still three possible scenarios regarding the location of the particle:
-            // 1. The particle is outside the neighborhood -> timestep too large, we do not care and crash.
-            // 2. The particle is outside of the entire domain -> we set the outsideDomain flag.
-            // 3. The particle is in the neighborhood patch, but floating-point errors made all point location
-            //    calculations return false. We therefore check with a larger radius.
-            if ( sphereTetrahedronIntersection( computationalLocation,
-                                                particleLocationRadius,
-                                                cell->getCoordinates().at( 0 ),
-                                                cell->getCoordinates().at( 1 ),
-                                                cell->getCoordinates().at( 2 ),
-                                                cell->getCoordinates().at( 3 ) ) )
-            {
-               p->setContainingPrimitive( cellID );
-               foundByPointLocation = true;
-            }
-            else
-            {
-               const auto& neighboringCells = cell->getIndirectNeighborCellIDs();
-               for ( const auto& neighborCellID : neighboringCells )
-               {
-                  const auto neighborCell = setupStorage.getCell( neighborCellID );
-                  Point3D    computationalLocationNeighbor;
-                  neighborCell->getGeometryMap()->evalFinv( toPoint3D( p->getPosition() ), computationalLocationNeighbor );
-
-                  if ( sphereTetrahedronIntersection( computationalLocationNeighbor,
-                                                      particleLocationRadius,
-                                                      neighborCell->getCoordinates().at( 0 ),
-                                                      neighborCell->getCoordinates().at( 1 ),
-                                                      neighborCell->getCoordinates().at( 2 ),
-                                                      neighborCell->getCoordinates().at( 3 ) ) )
-                  {
-                     p->setContainingPrimitive( neighborCellID );
-                     foundByPointLocation = true;
-                     break;
-                  }
-               }
-            }
-         }
-
-         if ( !foundByPointLocation )
-         {
-            p->setOutsideDomain( 1 );
-         }
-      }
-   }
-}
-
 inline real_t evaluateAtParticlePosition( PrimitiveStorage&                                                      storage,
                                           const P2Function< real_t >&                                            function,
                                           const walberla::convection_particles::data::ParticleStorage::Particle& particle,
@@ -408,8 +173,42 @@ inline void evaluateAtParticlePosition( PrimitiveStorage&
    }
 }
 
+/// Maps the coordinates of all DoFs of the passed function (in the order of the FunctionIterator) to the physical domain.
+/// Consecutive DoFs on the same macro-primitive are mapped with a single batched call of the blending map.
+template < typename FunctionType >
+inline std::vector< Point3D >
+    mapDoFCoordinatesToPhysicalDomain( const PrimitiveStorage& storage, const FunctionType& function, const uint_t& level )
+{
+   std::vector< Point3D > physicalLocations;
+   std::vector< Point3D > batch;
+   PrimitiveID            batchPrimitiveID;
+
+   const auto mapBatch = [&]() {
+      const uint_t offset = physicalLocations.size();
+      physicalLocations.resize( offset + batch.size() );
+      storage.getPrimitive( batchPrimitiveID )
+          ->getGeometryMap()
+          ->evalF( batch.data(), physicalLocations.data() + offset, batch.size() );
+      batch.clear();
+   };
+
+   for ( auto it : FunctionIterator< FunctionType >( function, level ) )
+   {
+      if ( !batch.empty() && it.primitiveID() != batchPrimitiveID )
+      {
+         mapBatch();
+      }
+      batchPrimitiveID = it.primitiveID();
+      batch.push_back( it.coordinates() );
+   }
+   if ( !batch.empty() )
+   {
+      mapBatch();
+   }
+   return physicalLocations;
+}
+
 inline uint_t initializeParticles( walberla::convection_particles::data::ParticleStorage& particleStorage,
-                                   const SetupPrimitiveStorage&                           setupStorage,
                                    PrimitiveStorage&                                      storage,
                                    const P2Function< real_t >&                            c,
                                    const P2Function< real_t >&                            ux,
@@ -444,14 +243,16 @@ inline uint_t initializeParticles( walberla::convection_particles::data::Particl
    const std::vector< real_t >&                b        = RK_b.at( timeSteppingScheme );
    const uint_t                                rkStages = b.size();
 
+   const std::vector< Point3D > vertexDoFLocations =
+       mapDoFCoordinatesToPhysicalDomain( storage, c.getVertexDoFFunction(), level );
+   uint_t vertexDoFCounter = 0;
+
    for ( auto it : FunctionIterator< vertexdof::VertexDoFFunction< real_t > >( c.getVertexDoFFunction(), level ) )
    {
       // if ( storage.onBoundary( it.primitiveID(), true ) )
       //   continue;
 
-      Point3D physicalLocation;
-      auto    primitive = setupStorage.getPrimitive( it.primitiveID() );
-      primitive->getGeometryMap()->evalF( it.coordinates(), physicalLocation );
+      const Point3D& physicalLocation = vertexDoFLocations[vertexDoFCounter++];
 
       auto particleIt = particleStorage.create();
       particleIt->setOwner( (int) rank );
@@ -520,14 +321,15 @@ inline uint_t initializeParticles( walberla::convection_particles::data::Particl
       }
    }
 
+   const std::vector< Point3D > edgeDoFLocations = mapDoFCoordinatesToPhysicalDomain( storage, c.getEdgeDoFFunction(), level );
+   uint_t                       edgeDoFCounter   = 0;
+
    for ( auto it : FunctionIterator< EdgeDoFFunction< real_t > >( c.getEdgeDoFFunction(), level ) )
    {
 //      if ( storage.onBoundary( it.primitiveID(), true ) )
 //         continue;
 
-      Point3D physicalLocation;
-      auto    primitive = setupStorage.getPrimitive( it.primitiveID() );
-      primitive->getGeometryMap()->evalF( it.coordinates(), physicalLocation );
+      const Point3D& physicalLocation = edgeDoFLocations[edgeDoFCounter++];
 
       auto particleIt = particleStorage.create();
       particleIt->setOwner( (int) rank );
@@ -591,14 +393,61 @@ inline uint_t initializeParticles( walberla::convection_particles::data::Particl
    // walberla::convection_particles::mpi::SyncNextNeighborsNoGhosts SNN;
    walberla::convection_particles::mpi::SyncNextNeighborsByPrimitiveID SNN;
 
-   SNN( particleStorage, setupStorage );
+   SNN( particleStorage, storage );
 
    // WALBERLA_LOG_INFO( "Particles after init sync: " << particleStorage.size() );
    return numberOfCreatedParticles;
 }
 
+/// Locates all particles and migrates them to the owner of their containing macro-primitive.
+///
+/// Particles that leave the part of the mesh that is known to their process are forwarded across the processes
+/// until they are located. To avoid an infinite loop, the remaining particles are marked as outside of the domain
+/// after maxForwardIterations rounds.
+///
+/// The particle locator is rebuilt if the storage was modified since it was created.
+inline void locateAndSyncParticles( walberla::convection_particles::data::ParticleStorage&                     particleStorage,
+                                    const PrimitiveStorage&                                                    storage,
+                                    std::shared_ptr< const ParticleLocator >&                                  particleLocator,
+                                    const walberla::convection_particles::mpi::SyncNextNeighborsByPrimitiveID& SNN,
+                                    const real_t&                                                              particleLocationRadius,
+                                    const uint_t&                                                              maxForwardIterations = 10 )
+{
+   if ( particleLocator == nullptr || particleLocator->getModificationStamp() != storage.getModificationStamp() )
+   {
+      particleLocator = std::make_shared< const ParticleLocator >( storage );
+   }
+
+   for ( uint_t iteration = 0; iteration <= maxForwardIterations; iteration++ )
+   {
+      const bool forwardParticles = iteration < maxForwardIterations;
+
+      storage.getTimingTree()->start( "Update particle position" );
+      particleLocator->updateParticlePosition( storage, particleStorage, particleLocationRadius, forwardParticles );
+      storage.getTimingTree()->stop( "Update particle position" );
+
+      storage.getTimingTree()->start( "Sync particles" );
+      SNN( particleStorage, storage );
+      storage.getTimingTree()->stop( "Sync particles" );
+
+      uint_t numForwardedParticles = 0;
+      for ( const auto& p : particleStorage )
+      {
+         if ( p.getOutsideDomain() == PARTICLE_FORWARDED )
+         {
+            numForwardedParticles++;
+         }
+      }
+      numForwardedParticles = walberla::mpi::allReduce( numForwardedParticles, walberla::mpi::SUM );
+      if ( numForwardedParticles == 0 )
+      {
+         return;
+      }
+   }
+}
+
 inline void particleIntegration( walberla::convection_particles::data::ParticleStorage& particleStorage,
-                                 const SetupPrimitiveStorage&                           setupStorage,
+                                 std::shared_ptr< const ParticleLocator >&              particleLocator,
                                  PrimitiveStorage&                                      storage,
                                  const P2Function< real_t >&                            ux,
                                  const P2Function< real_t >&                            uy,
@@ -629,7 +478,7 @@ inline void particleIntegration( walberla::convection_particles::data::ParticleS
    const uint_t                                rkStages = b.size();
 
    storage.getTimingTree()->start( "Sync particles" );
-   SNN( particleStorage, setupStorage );
+   SNN( particleStorage, storage );
    storage.getTimingTree()->stop( "Sync particles" );
 
    for ( uint_t step = 0; step < steps; step++ )
@@ -680,13 +529,10 @@ inline void particleIntegration( walberla::convection_particles::data::ParticleS
             }
             p->setPosition( evaluationPoint );
          }
-         updateParticlePosition( setupStorage, particleStorage, particleLocationRadius );
          storage.getTimingTree()->stop( "Update particle position" );
 
-         // sync particles to be able to evaluate the velocity at that point
-         storage.getTimingTree()->start( "Sync particles" );
-         SNN( particleStorage, setupStorage );
-         storage.getTimingTree()->stop( "Sync particles" );
+         // locate and sync particles to be able to evaluate the velocity at that point
+         locateAndSyncParticles( particleStorage, storage, particleLocator, SNN, particleLocationRadius );
 
          // evaluate velocity at current particle positions and update k[stage]
          // we perform a linear interpolation here using the c-weights of the RK method
@@ -717,13 +563,10 @@ inline void particleIntegration( walberla::convection_particles::data::ParticleS
          p->setPosition( finalPosition );
          p->setStartPosition( p->getPosition() );
       }
-      updateParticlePosition( setupStorage, particleStorage, particleLocationRadius );
       storage.getTimingTree()->stop( "Update particle position" );
 
-      // sync particles as position was finally updated
-      storage.getTimingTree()->start( "Sync particles" );
-      SNN( particleStorage, setupStorage );
-      storage.getTimingTree()->stop( "Sync particles" );
+      // locate and sync particles as position was finally updated
+      locateAndSyncParticles( particleStorage, storage, particleLocator, SNN, particleLocationRadius );
    }
 }
 
@@ -902,13 +745,12 @@ template < typename FunctionType >
 class MMOCTransport
 {
  public:
-   MMOCTransport( const std::shared_ptr< PrimitiveStorage >&      storage,
-                  const std::shared_ptr< SetupPrimitiveStorage >& setupStorage,
-                  const uint_t                                    minLevel,
-                  const uint_t                                    maxLevel,
-                  const TimeSteppingScheme&                       timeSteppingSchemeConvection )
+   MMOCTransport( const std::shared_ptr< PrimitiveStorage >& storage,
+                  const uint_t                               minLevel,
+                  const uint_t                               maxLevel,
+                  const TimeSteppingScheme&                  timeSteppingSchemeConvection )
    : storage_( storage )
-   , setupStorage_( setupStorage )
+   , particleLocator_( std::make_shared< const ParticleLocator >( *storage ) )
    , cOld_( "cOld", storage, minLevel, maxLevel )
    , cTmp_( "cTmp", storage, minLevel, maxLevel )
    , cPlus_( "cPlus", storage, minLevel, maxLevel )
@@ -947,13 +789,13 @@ class MMOCTransport
          cOld_.assign( {1.0}, {c}, level, All );
          storage_->getTimingTree()->start( "Particle initialization" );
          numberOfCreatedParticles_ = initializeParticles(
-             particleStorage_, *setupStorage_, *storage_, c, ux, uy, uz, level, Inner, timeSteppingSchemeConvection_, 0 );
+             particleStorage_, *storage_, c, ux, uy, uz, level, Inner, timeSteppingSchemeConvection_, 0 );
          storage_->getTimingTree()->stop( "Particle initialization" );
       }
 
       storage_->getTimingTree()->start( "Particle integration" );
       particleIntegration( particleStorage_,
-                           *setupStorage_,
+                           particleLocator_,
                            *storage_,
                            ux,
                            uy,
@@ -1071,7 +913,7 @@ class MMOCTransport
 
  private:
    const std::shared_ptr< PrimitiveStorage >             storage_;
-   const std::shared_ptr< SetupPrimitiveStorage >        setupStorage_;
+   std::shared_ptr< const ParticleLocator >              particleLocator_;
    FunctionType                                          cOld_;
    FunctionType                                          cTmp_;
    FunctionType                                          cPlus_;
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "core/DataTypes.h"
+#include "core/math/Matrix3.h"
+
+#include "hyteg/geometry/GeometryMap.hpp"
+#include "hyteg/geometry/Intersection.hpp"
+#include "hyteg/primitives/Cell.hpp"
+#include "hyteg/primitives/Face.hpp"
+#include "hyteg/primitives/Vertex.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+
+#include "convection_particles/data/ParticleStorage.h"
+
+namespace hyteg {
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+using walberla::convection_particles::Vec3;
+
+/// Values of the outsideDomain property of the particles that are set by the ParticleLocator.
+enum ParticleLocationStatus : int
+{
+   /// the containing primitive is a macro-face (2D) / macro-cell (3D)
+   PARTICLE_INSIDE_DOMAIN = 0,
+   /// the particle could not be located in the neighborhood of its previous macro-primitive
+   PARTICLE_OUTSIDE_DOMAIN = 1,
+   /// the particle left the part of the mesh that is known to this process, the containing primitive is set to a
+   /// primitive of the process that continues the search (see ParticleLocator)
+   PARTICLE_FORWARDED = 2,
+};
+
+/// \brief Point location of particles in the macro-faces (2D) or macro-cells (3D) of a distributed PrimitiveStorage.
+///
+/// Only the process-local macro-primitives and those in the direct neighborhood (halo) of the PrimitiveStorage are
+/// used, so no replicated SetupPrimitiveStorage is required.
+///
+/// All topological and geometrical information that is required to locate particles is precomputed once:
+/// - the inverse of the affine map from the reference simplex to each macro-simplex (in the computational domain),
+///   which yields the barycentric coordinates of a point with a single matrix-vector product,
+/// - the neighbor across each facet of the macro-simplex,
+/// - the list of all known macro-simplices that share at least one vertex (the "indirect" neighbors).
+///
+/// The particles are grouped by their previous containing macro-simplex, so that the barycentric coordinates of all
+/// particles that remain in their macro-simplex (the common case) are computed in a single loop with the same
+/// geometry map and transformation. The remaining particles walk across the facets in direction of the most negative
+/// barycentric coordinate. If the walk fails at the domain boundary (or due to round-off), the known indirect
+/// neighbors are tested, followed by the intersection tests with the particle location radius.
+///
+/// If the walk leaves the part of the mesh that is known to this process, the particle is marked as
+/// PARTICLE_FORWARDED and its containing primitive is set to the facet that was crossed (or to the last
+/// macro-simplex if the facet is not known). The process that owns this primitive knows the macro-simplices on both
+/// sides and continues the search after the particles were synchronized (see locateAndSyncParticles() in
+/// MMOCTransport.hpp).
+///
+/// The locator describes the storage at the time of construction and must be rebuilt after the storage was modified
+/// (e.g. after migration), see getModificationStamp().
+class ParticleLocator
+{
+ public:
+   explicit ParticleLocator( const PrimitiveStorage& storage )
+   : dim_( storage.hasGlobalCells() ? 3 : 2 )
+   , modificationStamp_( storage.getModificationStamp() )
+   {
+      std::vector< PrimitiveID > simplexIDs;
+      if ( dim_ == 3 )
+      {
+         storage.getCellIDs( simplexIDs );
+         std::vector< PrimitiveID > neighborIDs;
+         storage.getNeighboringCellIDs( neighborIDs );
+         simplexIDs.insert( simplexIDs.end(), neighborIDs.begin(), neighborIDs.end() );
+      }
+      else
+      {
+         storage.getFaceIDs( simplexIDs );
+         std::vector< PrimitiveID > neighborIDs;
+         storage.getNeighboringFaceIDs( neighborIDs );
+         simplexIDs.insert( simplexIDs.end(), neighborIDs.begin(), neighborIDs.end() );
+      }
+      std::sort( simplexIDs.begin(), simplexIDs.end() );
+
+      for ( const auto& id : simplexIDs )
+      {
+         simplexIndex_[id] = simplices_.size();
+         simplices_.push_back( MacroSimplex() );
+      }
+
+      for ( uint_t s = 0; s < simplices_.size(); s++ )
+      {
+         MacroSimplex& simplex = simplices_[s];
+         simplex.id            = simplexIDs[s];
+
+         const Primitive* primitive = storage.getPrimitive( simplex.id );
+         simplex.map                = primitive->getGeometryMap();
+
+         // vertices and the facets opposite to them
+         std::vector< PrimitiveID >   vertexIDs;
+         std::array< PrimitiveID, 4 > facetIDs;
+         if ( dim_ == 3 )
+         {
+            const Cell* cell = storage.getCell( simplex.id );
+            vertexIDs        = cell->neighborVertices();
+            for ( uint_t i = 0; i < 4; i++ )
+            {
+               simplex.vertices[i] = cell->getCoordinates()[i];
+            }
+            for ( uint_t f = 0; f < 4; f++ )
+            {
+               uint_t opposite = 0 + 1 + 2 + 3;
+               for ( const auto& it : cell->getFaceLocalVertexToCellLocalVertexMaps()[f] )
+               {
+                  opposite -= it.second;
+               }
+               facetIDs[opposite] = cell->neighborFaces()[f];
+            }
+         }
+         else
+         {
+            const Face* face = storage.getFace( simplex.id );
+            vertexIDs        = face->neighborVertices();
+            for ( uint_t i = 0; i < 3; i++ )
+            {
+               simplex.vertices[i] = face->getCoordinates()[i];
+               facetIDs[i]         = face->getEdgeOppositeToVertex( vertexIDs[i] );
+            }
+         }
+
+         // inverse of the affine map x = v0 + A * xi (A is extended by the identity in 2D)
+         walberla::math::Matrix3< real_t > A( real_c( 1 ), real_c( 0 ), real_c( 0 ),
+                                              real_c( 0 ), real_c( 1 ), real_c( 0 ),
+                                              real_c( 0 ), real_c( 0 ), real_c( 1 ) );
+         for ( uint_t j = 0; j < dim_; j++ )
+         {
+            for ( uint_t i = 0; i < dim_; i++ )
+            {
+               A( i, j ) = simplex.vertices[j + 1][i] - simplex.vertices[0][i];
+            }
+         }
+         simplex.inverseAffineMap = A.getInverse();
+
+         // facet neighbors
+         for ( uint_t i = 0; i < dim_ + 1; i++ )
+         {
+            simplex.facetNeighbors[i] = invalidIndex();
+            simplex.forwardTo[i]      = simplex.id;
+
+            const Primitive* facet = storage.getPrimitive( facetIDs[i] );
+            if ( facet == nullptr )
+            {
+               // the facet is not known, only the owner of this macro-simplex can continue
+               simplex.facetStatus[i] = FacetStatus::UNKNOWN;
+               continue;
+            }
+
+            const auto& facetNeighborIDs = dim_ == 3 ? facet->neighborCells() : facet->neighborFaces();
+            if ( facetNeighborIDs.size() < 2 )
+            {
+               simplex.facetStatus[i] = FacetStatus::BOUNDARY;
+               continue;
+            }
+
+            const auto neighborID = facetNeighborIDs[0] == simplex.id ? facetNeighborIDs[1] : facetNeighborIDs[0];
+            if ( simplexIndex_.count( neighborID ) > 0 )
+            {
+               simplex.facetStatus[i]    = FacetStatus::NEIGHBOR;
+               simplex.facetNeighbors[i] = simplexIndex_.at( neighborID );
+            }
+            else
+            {
+               // the owner of the facet knows the macro-simplices on both sides
+               simplex.facetStatus[i] = FacetStatus::UNKNOWN;
+               simplex.forwardTo[i]   = facetIDs[i];
+            }
+         }
+
+         // known indirect neighbors, sorted by ID
+         std::set< PrimitiveID > indirectNeighbors;
+         for ( const auto& vertexID : vertexIDs )
+         {
+            const Vertex* vertex = storage.getVertex( vertexID );
+            if ( vertex == nullptr )
+            {
+               continue;
+            }
+            for ( const auto& neighborID : dim_ == 3 ? vertex->neighborCells() : vertex->neighborFaces() )
+            {
+               if ( neighborID != simplex.id && simplexIndex_.count( neighborID ) > 0 )
+               {
+                  indirectNeighbors.insert( neighborID );
+               }
+            }
+         }
+         for ( const auto& neighborID : indirectNeighbors )
+         {
+            simplex.indirectNeighbors.push_back( simplexIndex_.at( neighborID ) );
+         }
+      }
+   }
+
+   /// Modification stamp of the PrimitiveStorage the locator was built for.
+   uint_t getModificationStamp() const { return modificationStamp_; }
+
+   /// \brief Updates the containing macro-primitive and the location status (outsideDomain property) of all particles.
+   ///
+   /// The search starts at the previous containing primitive of each particle, which must be known to this process
+   /// (local or in the neighborhood). For forwarded particles this is the facet that was crossed on the previous
+   /// process; the search continues in one of the macro-simplices next to it.
+   ///
+   /// If forwardParticles is false, particles that leave the known part of the mesh are marked as
+   /// PARTICLE_OUTSIDE_DOMAIN instead of PARTICLE_FORWARDED.
+   void updateParticlePosition( const PrimitiveStorage&                                storage,
+                                walberla::convection_particles::data::ParticleStorage& particleStorage,
+                                const real_t&                                          particleLocationRadius,
+                                const bool&                                            forwardParticles = true ) const
+   {
+      const uint_t numParticles = particleStorage.size();
+
+      // sort the particles by their start macro-simplex (counting sort)
+      std::vector< uint_t > simplexOfParticle( numParticles );
+      std::vector< uint_t > offsets( simplices_.size() + 1, 0 );
+      for ( uint_t p = 0; p < numParticles; p++ )
+      {
+         simplexOfParticle[p] = startSimplex( storage, particleStorage.getContainingPrimitive( p ) );
+         offsets[simplexOfParticle[p] + 1]++;
+      }
+      for ( uint_t s = 0; s < simplices_.size(); s++ )
+      {
+         offsets[s + 1] += offsets[s];
+      }
+      std::vector< uint_t > particlesBySimplex( numParticles );
+      {
+         std::vector< uint_t > fill( offsets.begin(), offsets.end() - 1 );
+         for ( uint_t p = 0; p < numParticles; p++ )
+         {
+            particlesBySimplex[fill[simplexOfParticle[p]]++] = p;
+         }
+      }
+
+      std::vector< Point3D >                 computationalLocations;
+      std::vector< std::array< real_t, 4 > > barycentricCoordinates;
+
+      for ( uint_t s = 0; s < simplices_.size(); s++ )
+      {
+         const uint_t begin = offsets[s];
+         const uint_t end   = offsets[s + 1];
+         if ( begin == end )
+         {
+            continue;
+         }
+
+         const MacroSimplex& simplex = simplices_[s];
+
+         computationalLocations.resize( end - begin );
+         barycentricCoordinates.resize( end - begin );
+
+         for ( uint_t i = begin; i < end; i++ )
+         {
+            simplex.map->evalFinv( toPoint3D( particleStorage.getPosition( particlesBySimplex[i] ) ),
+                                   computationalLocations[i - begin] );
+         }
+
+         for ( uint_t i = 0; i < end - begin; i++ )
+         {
+            computeBarycentricCoordinates( simplex, computationalLocations[i], barycentricCoordinates[i] );
+         }
+
+         for ( uint_t i = begin; i < end; i++ )
+         {
+            const uint_t p = particlesBySimplex[i];
+
+            if ( isInside( barycentricCoordinates[i - begin] ) )
+            {
+               particleStorage.setOutsideDomain( p, PARTICLE_INSIDE_DOMAIN );
+               particleStorage.setContainingPrimitive( p, simplex.id );
+               continue;
+            }
+
+            uint_t      containingSimplex = s;
+            PrimitiveID forwardTo;
+            const auto  walkResult =
+                walk( s, barycentricCoordinates[i - begin], particleStorage.getPosition( p ), containingSimplex, forwardTo );
+
+            if ( walkResult == WalkResult::FOUND ||
+                 searchNeighborhood( s, particleStorage.getPosition( p ), particleLocationRadius, containingSimplex ) )
+            {
+               particleStorage.setOutsideDomain( p, PARTICLE_INSIDE_DOMAIN );
+               particleStorage.setContainingPrimitive( p, simplices_[containingSimplex].id );
+            }
+            else if ( walkResult == WalkResult::FORWARD && forwardParticles )
+            {
+               particleStorage.setOutsideDomain( p, PARTICLE_FORWARDED );
+               particleStorage.setContainingPrimitive( p, forwardTo );
+            }
+            else
+            {
+               // the particle keeps its start macro-simplex, so that it can still be evaluated
+               particleStorage.setOutsideDomain( p, PARTICLE_OUTSIDE_DOMAIN );
+               particleStorage.setContainingPrimitive( p, simplex.id );
+            }
+         }
+      }
+   }
+
+ private:
+   static uint_t invalidIndex() { return std::numeric_limits< uint_t >::max(); }
+
+   enum class FacetStatus
+   {
+      NEIGHBOR, ///< the macro-simplex on the other side is known
+      BOUNDARY, ///< the facet is located on the domain boundary
+      UNKNOWN,  ///< the macro-simplex on the other side is not known to this process
+   };
+
+   enum class WalkResult
+   {
+      FOUND,
+      FAILED,
+      FORWARD,
+   };
+
+   struct MacroSimplex
+   {
+      PrimitiveID                       id;
+      std::shared_ptr< GeometryMap >    map;
+      std::array< Point3D, 4 >          vertices;
+      walberla::math::Matrix3< real_t > inverseAffineMap;
+      /// status of the facet opposite to each local vertex
+      std::array< FacetStatus, 4 > facetStatus;
+      /// index of the neighbor across the facet opposite to each local vertex (if FacetStatus::NEIGHBOR)
+      std::array< uint_t, 4 > facetNeighbors;
+      /// primitive whose owner continues the search across the facet opposite to each local vertex
+      /// (if FacetStatus::UNKNOWN)
+      std::array< PrimitiveID, 4 > forwardTo;
+      /// indices of all other known macro-simplices that share at least one vertex, sorted by ID
+      std::vector< uint_t > indirectNeighbors;
+   };
+
+   /// Returns the index of the macro-simplex where the search for a particle with the passed
+   /// containing primitive starts.
+   uint_t startSimplex( const PrimitiveStorage& storage, const PrimitiveID& containingPrimitive ) const
+   {
+      const auto it = simplexIndex_.find( containingPrimitive );
+      if ( it != simplexIndex_.end() )
+      {
+         return it->second;
+      }
+
+      // forwarded particle, the containing primitive is a facet
+      const Primitive* facet = storage.getPrimitive( containingPrimitive );
+      WALBERLA_CHECK_NOT_NULLPTR( facet, "Particle location: primitive " << containingPrimitive << " is not known." );
+      for ( const auto& neighborID : dim_ == 3 ? facet->neighborCells() : facet->neighborFaces() )
+      {
+         if ( simplexIndex_.count( neighborID ) > 0 )
+         {
+            return simplexIndex_.at( neighborID );
+         }
+      }
+      WALBERLA_ABORT( "Particle location: no macro-simplex next to primitive " << containingPrimitive << " is known." );
+   }
+
+   void computeBarycentricCoordinates( const MacroSimplex&      simplex,
+                                       const Point3D&           computationalLocation,
+                                       std::array< real_t, 4 >& lambda ) const
+   {
+      const Vec3 xi = simplex.inverseAffineMap * toVec3( computationalLocation - simplex.vertices[0] );
+      lambda[0]     = real_c( 1 );
+      for ( uint_t i = 0; i < dim_; i++ )
+      {
+         lambda[i + 1] = xi[i];
+         lambda[0] -= xi[i];
+      }
+   }
+
+   bool isInside( const std::array< real_t, 4 >& lambda ) const
+   {
+      for ( uint_t i = 0; i < dim_ + 1; i++ )
+      {
+         if ( lambda[i] < 0 )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   /// Walks from the passed macro-simplex across the facet with the most negative barycentric coordinate
+   /// until the containing macro-simplex is found. Fails at the domain boundary or if a macro-simplex is visited twice.
+   /// If the macro-simplex on the other side of the facet is not known, the primitive of the process that can
+   /// continue the walk is returned.
+   WalkResult walk( const uint_t&                  start,
+                    const std::array< real_t, 4 >& startLambda,
+                    const Vec3&                    physicalLocation,
+                    uint_t&                        containingSimplex,
+                    PrimitiveID&                   forwardTo ) const
+   {
+      std::vector< uint_t >   visited( 1, start );
+      std::array< real_t, 4 > lambda  = startLambda;
+      uint_t                  current = start;
+
+      for ( uint_t step = 0; step < maxWalkSteps_; step++ )
+      {
+         uint_t minIndex = 0;
+         for ( uint_t i = 1; i < dim_ + 1; i++ )
+         {
+            if ( lambda[i] < lambda[minIndex] )
+            {
+               minIndex = i;
+            }
+         }
+
+         const MacroSimplex& simplex = simplices_[current];
+         if ( simplex.facetStatus[minIndex] == FacetStatus::BOUNDARY )
+         {
+            return WalkResult::FAILED;
+         }
+         if ( simplex.facetStatus[minIndex] == FacetStatus::UNKNOWN )
+         {
+            forwardTo = simplex.forwardTo[minIndex];
+            return WalkResult::FORWARD;
+         }
+
+         const uint_t next = simplex.facetNeighbors[minIndex];
+         if ( std::find( visited.begin(), visited.end(), next ) != visited.end() )
+         {
+            return WalkResult::FAILED;
+         }
+         visited.push_back( next );
+         current = next;
+
+         Point3D computationalLocation;
+         simplices_[current].map->evalFinv( toPoint3D( physicalLocation ), computationalLocation );
+         computeBarycentricCoordinates( simplices_[current], computationalLocation, lambda );
+         if ( isInside( lambda ) )
+         {
+            containingSimplex = current;
+            return WalkResult::FOUND;
+         }
+      }
+      return WalkResult::FAILED;
+   }
+
+   /// Fallback: tests the start macro-simplex and all its known indirect neighbors with the inclusion test and then
+   /// with the intersection test using the particle location radius.
+   bool searchNeighborhood( const uint_t& start,
+                            const Vec3&   physicalLocation,
+                            const real_t& particleLocationRadius,
+                            uint_t&       containingSimplex ) const
+   {
+      const auto& neighbors = simplices_[start].indirectNeighbors;
+
+      if ( contains( start, physicalLocation ) )
+      {
+         containingSimplex = start;
+         return true;
+      }
+      for ( const auto& candidate : neighbors )
+      {
+         if ( contains( candidate, physicalLocation ) )
+         {
+            containingSimplex = candidate;
+            return true;
+         }
+      }
+
+      // At this point there are still three possible scenarios regarding the location of the particle:
+      // 1. The particle is outside the neighborhood -> timestep too large, we do not care and crash.
+      // 2. The particle is outside of the entire domain -> we set the outsideDomain flag.
+      // 3. The particle is in the neighborhood patch, but floating-point errors made all point location
+      //    calculations return false. We therefore check with a larger radius.
+      if ( intersects( start, physicalLocation, particleLocationRadius ) )
+      {
+         containingSimplex = start;
+         return true;
+      }
+      for ( const auto& candidate : neighbors )
+      {
+         if ( intersects( candidate, physicalLocation, particleLocationRadius ) )
+         {
+            containingSimplex = candidate;
+            return true;
+         }
+      }
+      return false;
+   }
+
+   /// inclusion test including the tolerances of the geometric predicates
+   bool contains( const uint_t& simplexIndex, const Vec3& physicalLocation ) const
+   {
+      const auto& simplex = simplices_[simplexIndex];
+      const auto& v       = simplex.vertices;
+      Point3D     computationalLocation;
+      simplex.map->evalFinv( toPoint3D( physicalLocation ), computationalLocation );
+      if ( dim_ == 3 )
+      {
+         return isPointInTetrahedron( computationalLocation, v[0], v[1], v[2], v[3] );
+      }
+      return isPointInTriangle( Point2D( {computationalLocation[0], computationalLocation[1]} ),
+                                Point2D( {v[0][0], v[0][1]} ),
+                                Point2D( {v[1][0], v[1][1]} ),
+                                Point2D( {v[2][0], v[2][1]} ) );
+   }
+
+   bool intersects( const uint_t& simplexIndex, const Vec3& physicalLocation, const real_t& radius ) const
+   {
+      const auto& simplex = simplices_[simplexIndex];
+      const auto& v       = simplex.vertices;
+      Point3D     computationalLocation;
+      simplex.map->evalFinv( toPoint3D( physicalLocation ), computationalLocation );
+      if ( dim_ == 3 )
+      {
+         return sphereTetrahedronIntersection( computationalLocation, radius, v[0], v[1], v[2], v[3] );
+      }
+      return sphereTriangleIntersection( computationalLocation, radius, v[0], v[1], v[2] );
+   }
+
+   /// the particles are expected to move at most into the indirect neighbors, so the walk is short
+   static constexpr uint_t maxWalkSteps_ = 16;
+
+   uint_t                          dim_;
+   uint_t                          modificationStamp_;
+   std::vector< MacroSimplex >     simplices_;
+   std::map< PrimitiveID, uint_t > simplexIndex_;
+};
+
+} // namespace hyteg
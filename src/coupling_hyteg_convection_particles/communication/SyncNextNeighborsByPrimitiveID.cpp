@@ -33,11 +33,14 @@ namespace convection_particles {
 namespace mpi {
 
 void SyncNextNeighborsByPrimitiveID::operator()(data::ParticleStorage& ps,
-                                                const hyteg::SetupPrimitiveStorage & setupStorage) const
+                                                const hyteg::PrimitiveStorage & storage) const
 {
    if (numProcesses_ == 1) return;
 
-   for( uint_t nbProcessRank = 0; nbProcessRank < uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ); nbProcessRank++ )
+   neighborRanks_.clear();
+   storage.getNeighboringRanks(neighborRanks_);
+
+   for( const auto& nbProcessRank : neighborRanks_ )
    {
       if (bs.sendBuffer(nbProcessRank).isEmpty())
       {
@@ -45,10 +48,11 @@ void SyncNextNeighborsByPrimitiveID::operator()(data::ParticleStorage& ps,
          bs.sendBuffer(nbProcessRank) << walberla::uint8_c(0);
       }
    }
-   generateSynchronizationMessages(ps, setupStorage);
+   generateSynchronizationMessages(ps, storage);
 
-   // size of buffer is unknown and changes with each send
-   bs.setReceiverInfoFromSendBufferState(false, true);
+   // size of buffer is unknown and changes with each send,
+   // the neighborhood relation of the PrimitiveStorage is symmetric
+   bs.setReceiverInfo(neighborRanks_, true);
    bs.sendAll();
 
    // Receiving the updates for the remote rigid bodies from the connected processes
@@ -67,7 +71,7 @@ void SyncNextNeighborsByPrimitiveID::operator()(data::ParticleStorage& ps,
 }
 
 void SyncNextNeighborsByPrimitiveID::generateSynchronizationMessages(data::ParticleStorage& ps,
-                                                                     const hyteg::SetupPrimitiveStorage & setupStorage) const
+                                                                     const hyteg::PrimitiveStorage & storage) const
 {
    const uint_t ownRank = uint_c(rank_);
 
@@ -96,7 +100,9 @@ void SyncNextNeighborsByPrimitiveID::generateSynchronizationMessages(data::Parti
       WALBERLA_LOG_DETAIL( "Processing local particle " << pIt->getUid() );
 
       //particle has left subdomain?
-      const auto ownerRank = setupStorage.getTargetRank( pIt->getContainingPrimitive() );
+      const auto ownerRank = storage.getPrimitiveRank( pIt->getContainingPrimitive() );
+      WALBERLA_CHECK( ownerRank == ownRank || neighborRanks_.count( int_c( ownerRank ) ) > 0,
+                      "Particle " << pIt->getUid() << " moved to a primitive that is not in the neighborhood." );
       if( ownerRank != ownRank )
       {
          WALBERLA_LOG_DETAIL( "Local particle " << pIt->getUid() << " is no longer on process " << ownRank << " but on process " << ownerRank );
@@ -38,7 +38,7 @@
 #include <convection_particles/mpi/notifications/ParticleUpdateNotification.h>
 #include <core/logging/Logging.h>
 #include <core/mpi/BufferSystem.h>
-#include <hyteg/primitivestorage/SetupPrimitiveStorage.hpp>
+#include <hyteg/primitivestorage/PrimitiveStorage.hpp>
 #include <coupling_hyteg_convection_particles/communication/ParseMessagePrimitiveIDCommunication.h>
 
 namespace walberla {
@@ -52,12 +52,16 @@ namespace mpi {
  * but does not generate ghost particles on overlap. This can be useful for
  * particles without spatial extend like tracer particles.
  *
+ * The new owner of a particle is the owner of its containing primitive, which
+ * must be a local primitive or a primitive in the neighborhood of the
+ * PrimitiveStorage. Therefore, only the neighboring processes communicate.
+ *
  * \ingroup convection_particles_mpi
  */
 class SyncNextNeighborsByPrimitiveID
 {
  public:
-   void operator()( data::ParticleStorage& ps, const hyteg::SetupPrimitiveStorage& setupStorage ) const;
+   void operator()( data::ParticleStorage& ps, const hyteg::PrimitiveStorage& storage ) const;
 
    int64_t getBytesSent() const { return bs.getBytesSent(); }
    int64_t getBytesReceived() const { return bs.getBytesReceived(); }
@@ -66,8 +70,8 @@ class SyncNextNeighborsByPrimitiveID
    int64_t getNumberOfReceives() const { return bs.getNumberOfReceives(); }
 
  private:
-   void generateSynchronizationMessages( data::ParticleStorage& ps, const hyteg::SetupPrimitiveStorage& setupStorage ) const;
-   mutable std::vector< uint_t > neighborRanks_; ///cache for neighbor ranks -> will be updated in operator()
+   void generateSynchronizationMessages( data::ParticleStorage& ps, const hyteg::PrimitiveStorage& storage ) const;
+   mutable std::set< walberla::mpi::MPIRank > neighborRanks_; ///cache for neighbor ranks -> will be updated in operator()
 
    mutable walberla::mpi::BufferSystem bs = walberla::mpi::BufferSystem( walberla::mpi::MPIManager::instance()->comm() );
 
@@ -77,6 +77,9 @@ public:
 
   std::shared_ptr< PrimitiveStorage > getStorage() const { return storage_; }
 
+  uint_t getMinLevel() const { return minLevel_; }
+  uint_t getMaxLevel() const { return maxLevel_; }
+
   void enableTiming( const std::shared_ptr< walberla::WcTimingTree > & timingTree )
   {
     timingTree_ = timingTree;
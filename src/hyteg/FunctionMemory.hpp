@@ -27,8 +27,14 @@
 #include <core/mpi/RecvBuffer.h>
 #include <core/mpi/Reduce.h>
 #include <core/mpi/SendBuffer.h>
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #include "hyteg/misc/zeros.hpp"
 #include "hyteg/primitivedata/PrimitiveDataHandling.hpp"
@@ -36,16 +42,44 @@
 
 namespace hyteg {
 
+using walberla::int_c;
 using walberla::real_c;
 using walberla::real_t;
 using walberla::uint_t;
 using walberla::mpi::RecvBuffer;
 using walberla::mpi::SendBuffer;
 
+/// Process-wide settings for the allocation of function memory.
+struct FunctionMemoryAllocation
+{
+   /// All levels are aligned to this boundary (in bytes), which is suitable for cache lines and SIMD loads.
+   static constexpr uint_t alignment = 64;
+
+   /// Size of a (transparent) huge page in bytes.
+   static constexpr uint_t hugePageSize = 2 * 1024 * 1024;
+
+   /// Arenas with at least this number of entries are initialized in parallel (first touch).
+   static constexpr uint_t firstTouchThreshold = 1 << 16;
+
+   /// If set to true, arenas that are larger than a huge page are aligned to huge page boundaries and
+   /// (on Linux) advised to be backed by transparent huge pages. Disabled by default.
+   static bool& useHugePages()
+   {
+      static bool useHugePages_ = false;
+      return useHugePages_;
+   }
+};
+
+/// \brief Level-wise memory of a function on a single macro-primitive.
+///
+/// The memory of all levels that are allocated at once (see addData( minLevel, maxLevel, ... )) is taken from a
+/// single arena. Each level starts at an address that is aligned to FunctionMemoryAllocation::alignment bytes.
+/// The level data is indexed by the level, so that getPointer() does not require any lookup.
 template < typename ValueType >
 class FunctionMemory
 {
    static_assert( std::is_arithmetic< ValueType >::value, "Wrong ValueType template" );
+   static_assert( FunctionMemoryAllocation::alignment % sizeof( ValueType ) == 0, "Alignment must be a multiple of the ValueType size" );
 
  public:
    /// Constructs memory for a function
@@ -62,75 +96,123 @@ class FunctionMemory
    {
       WALBERLA_ASSERT_LESS_EQUAL(
           minLevel, maxLevel, "minLevel should be equal or less than maxLevel during FunctionMemory allocation." );
-      for ( uint_t level = minLevel; level <= maxLevel; level++ )
-      {
-         addData( level, sizeFunction( level, primitive ), fillValue );
-      }
+      addData(
+          minLevel, maxLevel, [&]( const uint_t& level ) { return sizeFunction( level, primitive ); }, fillValue );
    }
 
-   ~FunctionMemory()
-   {
-      for ( const auto& it : data_ )
-      {
-         totalAllocatedMemoryInBytes_ -= it.second->size() * sizeof( ValueType );
-      }
-   }
+   FunctionMemory( const FunctionMemory& ) = delete;
+   FunctionMemory& operator=( const FunctionMemory& ) = delete;
 
    /// Returns true if data is allocated at the specified level, false otherwise.
-   inline bool hasLevel( const uint_t& level ) const { return data_.count( level ) > 0; }
+   inline bool hasLevel( const uint_t& level ) const { return level < levels_.size() && levels_[level].data != nullptr; }
 
    inline uint_t getSize( const uint_t& level ) const
    {
       WALBERLA_CHECK( hasLevel( level ), "Requested level not allocated" );
-      return data_.at( level )->size();
+      return levels_[level].size;
    }
 
    /// Allocates an array of size size for a certain level
    inline void addData( const uint_t& level, const uint_t& size, const ValueType& fillValue )
    {
-      WALBERLA_ASSERT( !hasLevel( level ),
-                       "Attempting to overwrite already existing level (level == " << level << ") in function memory!" );
-      data_[level] = std::unique_ptr< std::vector< ValueType > >( new std::vector< ValueType >( size, fillValue ) );
-      totalAllocatedMemoryInBytes_ += size * sizeof( ValueType );
+      addData(
+          level, level, [size]( const uint_t& ) { return size; }, fillValue );
+   }
+
+   /// Allocates the levels minLevel to maxLevel from a single arena.
+   /// sizeFunction( level ) must return the number of entries of the respective level.
+   template < typename SizeFunction >
+   inline void addData( const uint_t& minLevel, const uint_t& maxLevel, const SizeFunction& sizeFunction, const ValueType& fillValue )
+   {
+      const uint_t alignmentInEntries = FunctionMemoryAllocation::alignment / sizeof( ValueType );
+
+      std::vector< uint_t > offsets;
+      std::vector< uint_t > sizes;
+      uint_t                arenaSize = 0;
+      for ( uint_t level = minLevel; level <= maxLevel; level++ )
+      {
+         WALBERLA_ASSERT( !hasLevel( level ),
+                          "Attempting to overwrite already existing level (level == " << level << ") in function memory!" );
+         // padding only between levels, so that the arena of a single level has exactly the level's size
+         arenaSize = ( ( arenaSize + alignmentInEntries - 1 ) / alignmentInEntries ) * alignmentInEntries;
+         offsets.push_back( arenaSize );
+         sizes.push_back( sizeFunction( level ) );
+         arenaSize += sizes.back();
+      }
+
+      auto arena = allocateArena( arenaSize, fillValue );
+
+      if ( levels_.size() <= maxLevel )
+      {
+         levels_.resize( maxLevel + 1 );
+      }
+
+      for ( uint_t level = minLevel; level <= maxLevel; level++ )
+      {
+         levels_[level].data  = arena.get() + offsets[level - minLevel];
+         levels_[level].size  = sizes[level - minLevel];
+         levels_[level].arena = arena;
+      }
    }
 
-   /// Deletes data of a certain level
+   /// Deletes data of a certain level.
+   /// The underlying arena is released as soon as none of its levels is in use anymore.
    inline void deleteData( const uint_t& level )
    {
       if ( !hasLevel( level ) )
          return;
-      totalAllocatedMemoryInBytes_ -= data_[level]->size() * sizeof( ValueType );
-      data_.erase( level );
+      levels_[level] = LevelData();
    }
 
    /// Returns a pointer to the first entry of the allocated array
    inline ValueType* getPointer( const uint_t& level ) const
    {
       WALBERLA_CHECK( hasLevel( level ), "Requested level not allocated" );
-      return data_.at( level )->data();
+      return levels_[level].data;
    }
 
    /// Copies the data of one leve from the other FunctionMemory.
-   inline void copyFrom( const FunctionMemory& other, const uint_t& level ) { *data_[level] = *other.data_.at( level ); }
+   inline void copyFrom( const FunctionMemory& other, const uint_t& level )
+   {
+      WALBERLA_ASSERT_EQUAL( getSize( level ), other.getSize( level ), "Cannot copy FunctionMemory of different sizes." );
+      std::copy( other.levels_[level].data, other.levels_[level].data + other.levels_[level].size, levels_[level].data );
+   }
+
+   /// Copies the data of one level from a FunctionMemory with a different value type.
+   /// Each entry is converted via static_cast, e.g. to convert between double and single precision.
+   template < typename OtherValueType >
+   inline void copyFrom( const FunctionMemory< OtherValueType >& other, const uint_t& level )
+   {
+      WALBERLA_ASSERT_EQUAL( getSize( level ), other.getSize( level ), "Cannot copy FunctionMemory of different sizes." );
+      const OtherValueType* src  = other.getPointer( level );
+      ValueType*            dst  = levels_[level].data;
+      const uint_t          size = levels_[level].size;
+      for ( uint_t k = 0; k < size; ++k )
+      {
+         dst[k] = static_cast< ValueType >( src[k] );
+      }
+   }
 
    inline void swap( const FunctionMemory< ValueType >& other, const uint_t& level ) const
    {
       WALBERLA_ASSERT( hasLevel( level ), "Requested level not allocated." );
       WALBERLA_ASSERT( other.hasLevel( level ), "Requested level not allocated." );
       WALBERLA_ASSERT_EQUAL( getSize( level ), other.getSize( level ), "Cannot swap FunctionMemory of different sizes." );
-      data_.at( level )->swap( *( other.data_.at( level ) ) );
+      std::swap( levels_[level], other.levels_[level] );
    }
 
    inline void setToZero( const uint_t& level ) const
    {
       WALBERLA_ASSERT( hasLevel( level ), "Requested level not allocated." );
-      ValueType* ptr = data_.at( level )->data();
-      for ( uint_t k = 0; k < data_.at( level )->size(); ++k )
+      ValueType* ptr = levels_[level].data;
+      for ( uint_t k = 0; k < levels_[level].size; ++k )
       {
          ptr[k] = generateZero< ValueType >();
       }
    }
 
+   /// Returns the number of bytes of all arenas that are currently allocated on this process
+   /// (including the padding between the levels).
    inline static unsigned long long getLocalAllocatedMemoryInBytes() { return totalAllocatedMemoryInBytes_; }
    inline static unsigned long long getMinLocalAllocatedMemoryInBytes()
    {
@@ -151,24 +233,34 @@ class FunctionMemory
    /// Serializes the allocated data to a send buffer
    inline void serialize( SendBuffer& sendBuffer ) const
    {
-      const uint_t numLevels = data_.size();
+      uint_t numLevels = 0;
+      for ( uint_t level = 0; level < levels_.size(); level++ )
+      {
+         if ( hasLevel( level ) )
+            numLevels++;
+      }
       sendBuffer << numLevels;
 
-      for ( const auto& it : data_ )
+      for ( uint_t level = 0; level < levels_.size(); level++ )
       {
-         const uint_t level     = it.first;
-         const uint_t levelSize = it.second->size();
+         if ( !hasLevel( level ) )
+            continue;
+
+         const uint_t levelSize = levels_[level].size;
 
          sendBuffer << level;
          sendBuffer << levelSize;
-         sendBuffer << getVector( level );
+         for ( uint_t k = 0; k < levelSize; k++ )
+         {
+            sendBuffer << levels_[level].data[k];
+         }
       }
    }
 
    /// Deserializes data from a recv buffer (clears all already allocated data and replaces it with the recv buffer's content)
    inline void deserialize( RecvBuffer& recvBuffer )
    {
-      data_.clear();
+      levels_.clear();
 
       uint_t numLevels;
 
@@ -184,17 +276,71 @@ class FunctionMemory
 
          addData( level, levelSize, fillValue_ );
 
-         std::vector< ValueType >& dataVector = getVector( level );
-         recvBuffer >> dataVector;
+         for ( uint_t k = 0; k < levelSize; k++ )
+         {
+            recvBuffer >> levels_[level].data[k];
+         }
       }
    }
 
  private:
-   inline const std::vector< ValueType >& getVector( const uint_t& level ) const { return *( data_.at( level ) ); }
-   inline std::vector< ValueType >&       getVector( const uint_t& level ) { return *( data_[level] ); }
+   struct LevelData
+   {
+      LevelData()
+      : data( nullptr )
+      , size( 0 )
+      {}
+
+      ValueType*                   data;
+      uint_t                       size;
+      std::shared_ptr< ValueType > arena;
+   };
+
+   /// Allocates an aligned arena and initializes it in parallel if it is large enough.
+   /// The arena keeps track of the allocated memory and releases it as soon as the last level that refers to it is deleted.
+   static std::shared_ptr< ValueType > allocateArena( const uint_t& numEntries, const ValueType& fillValue )
+   {
+      const uint_t bytes = numEntries * sizeof( ValueType );
+      const bool   hugePages =
+          FunctionMemoryAllocation::useHugePages() && bytes >= FunctionMemoryAllocation::hugePageSize;
+      const uint_t alignment =
+          hugePages ? uint_t( FunctionMemoryAllocation::hugePageSize ) : uint_t( FunctionMemoryAllocation::alignment );
+
+      void*       raw     = ::operator new( bytes + alignment );
+      void*       aligned = raw;
+      std::size_t space   = bytes + alignment;
+      std::align( alignment, bytes, aligned, space );
+      WALBERLA_ASSERT_NOT_NULLPTR( aligned );
+
+#if defined( __linux__ ) && defined( MADV_HUGEPAGE )
+      if ( hugePages )
+      {
+         madvise( aligned, bytes, MADV_HUGEPAGE );
+      }
+#endif
+
+      ValueType* data = static_cast< ValueType* >( aligned );
+
+      // The memory is not touched before, so that the pages are mapped close to the threads that initialize them.
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for schedule( static ) if ( numEntries >= FunctionMemoryAllocation::firstTouchThreshold )
+#endif
+      for ( int k = 0; k < int_c( numEntries ); k++ )
+      {
+         data[k] = fillValue;
+      }
+
+      totalAllocatedMemoryInBytes_ += bytes;
+
+      return std::shared_ptr< ValueType >( data, [raw, bytes]( ValueType* ) {
+         totalAllocatedMemoryInBytes_ -= bytes;
+         ::operator delete( raw );
+      } );
+   }
 
-   /// Maps a level to the respective allocated data
-   std::map< uint_t, std::unique_ptr< std::vector< ValueType > > > data_;
+   /// Level-wise data, indexed by the level.
+   /// Mutable since swapping data of two functions is a const operation on the functions.
+   mutable std::vector< LevelData > levels_;
 
    const ValueType fillValue_;
 
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "core/DataTypes.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/MPIWrapper.h"
+#include "core/mpi/Reduce.h"
+
+#include "hyteg/types/flags.hpp"
+
+namespace hyteg {
+
+using walberla::int_c;
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Computes the process-local contributions to several scalar products at once.
+///
+/// The i-th entry of the returned vector is the local contribution to (lhs[i], rhs[i]).
+template < typename FunctionType >
+std::vector< real_t > dotLocal( const std::vector< std::reference_wrapper< const FunctionType > >& lhs,
+                                const std::vector< std::reference_wrapper< const FunctionType > >& rhs,
+                                const uint_t&                                                      level,
+                                const DoFType&                                                     flag = All )
+{
+   WALBERLA_CHECK_EQUAL( lhs.size(), rhs.size() );
+   std::vector< real_t > scalarProducts( lhs.size() );
+   for ( uint_t i = 0; i < lhs.size(); i++ )
+   {
+      scalarProducts[i] = lhs[i].get().dotLocal( rhs[i].get(), level, flag );
+   }
+   return scalarProducts;
+}
+
+/// \brief Computes several scalar products with a single global reduction.
+///
+/// The i-th entry of the returned vector is (lhs[i], rhs[i]).
+/// In contrast to multiple calls to dotGlobal() only one allreduce is issued.
+template < typename FunctionType >
+std::vector< real_t > dotGlobal( const std::vector< std::reference_wrapper< const FunctionType > >& lhs,
+                                 const std::vector< std::reference_wrapper< const FunctionType > >& rhs,
+                                 const uint_t&                                                      level,
+                                 const DoFType&                                                     flag = All )
+{
+   auto scalarProducts = dotLocal( lhs, rhs, level, flag );
+   walberla::mpi::allReduceInplace( scalarProducts, walberla::mpi::SUM, walberla::mpi::MPIManager::instance()->comm() );
+   return scalarProducts;
+}
+
+/// \brief Non-blocking global sum of a small number of scalars.
+///
+/// The reduction is started with start() and completed with wait(). Any work that does not depend
+/// on the reduced values (e.g. operator applications or preconditioning) can be performed in between
+/// to hide the latency of the reduction.
+class NonBlockingSumReduction
+{
+ public:
+   NonBlockingSumReduction()
+   : active_( false )
+   {}
+
+   NonBlockingSumReduction( const NonBlockingSumReduction& ) = delete;
+   NonBlockingSumReduction& operator=( const NonBlockingSumReduction& ) = delete;
+
+   ~NonBlockingSumReduction()
+   {
+      if ( active_ )
+      {
+         wait();
+      }
+   }
+
+   /// Starts the global reduction of the passed process-local values.
+   void start( const std::vector< real_t >& localValues )
+   {
+      WALBERLA_CHECK( !active_, "Reduction is still in progress." );
+      sendBuffer_ = localValues;
+      recvBuffer_.resize( sendBuffer_.size() );
+      active_ = true;
+
+#ifdef WALBERLA_BUILD_WITH_MPI
+      MPI_Iallreduce( sendBuffer_.data(),
+                      recvBuffer_.data(),
+                      int_c( sendBuffer_.size() ),
+                      walberla::MPITrait< real_t >::type(),
+                      MPI_SUM,
+                      walberla::mpi::MPIManager::instance()->comm(),
+                      &request_ );
+#else
+      recvBuffer_ = sendBuffer_;
+#endif
+   }
+
+   /// Blocks until the reduction is finished and returns the reduced values.
+   const std::vector< real_t >& wait()
+   {
+      WALBERLA_CHECK( active_, "No reduction in progress." );
+
+#ifdef WALBERLA_BUILD_WITH_MPI
+      MPI_Wait( &request_, MPI_STATUS_IGNORE );
+#endif
+
+      active_ = false;
+      return recvBuffer_;
+   }
+
+ private:
+   bool                  active_;
+   std::vector< real_t > sendBuffer_;
+   std::vector< real_t > recvBuffer_;
+#ifdef WALBERLA_BUILD_WITH_MPI
+   MPI_Request request_;
+#endif
+};
+
+/// \brief Starts a non-blocking global reduction of several scalar products.
+///
+/// The i-th entry of the vector returned by reduction.wait() is (lhs[i], rhs[i]).
+template < typename FunctionType >
+void startDotGlobal( NonBlockingSumReduction&                                            reduction,
+                     const std::vector< std::reference_wrapper< const FunctionType > >& lhs,
+                     const std::vector< std::reference_wrapper< const FunctionType > >& rhs,
+                     const uint_t&                                                      level,
+                     const DoFType&                                                     flag = All )
+{
+   reduction.start( dotLocal( lhs, rhs, level, flag ) );
+}
+
+} // namespace hyteg
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/KernelInstrumentation.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "core/debug/CheckFunctions.h"
+#include "core/logging/Logging.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/Reduce.h"
+#include "core/mpi/SetReduction.h"
+#include "core/timing/TimingJSON.h"
+
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/LikwidWrapper.hpp"
+
+namespace hyteg {
+
+using walberla::uint_c;
+
+namespace kernelcost {
+
+KernelCost constantStencilApply( const uint_t& numDoFs, const uint_t& stencilSize, const UpdateType& updateType )
+{
+   KernelCost cost;
+   cost.bytes = double( numDoFs ) * 3.0 * double( sizeof( real_t ) );
+   cost.flops = double( numDoFs ) * double( 2 * stencilSize - 1 + ( updateType == Add ? 1 : 0 ) );
+   return cost;
+}
+
+KernelCost constantStencilSOR( const uint_t& numDoFs, const uint_t& stencilSize )
+{
+   KernelCost cost;
+   cost.bytes = double( numDoFs ) * 3.0 * double( sizeof( real_t ) );
+   cost.flops = double( numDoFs ) * double( 2 * ( stencilSize - 1 ) + 5 );
+   return cost;
+}
+
+KernelCost constantStencilApply( const uint_t&     numDstDoFs,
+                                 const uint_t&     numSrcDoFs,
+                                 const double&     weightsPerDstDoF,
+                                 const UpdateType& updateType )
+{
+   KernelCost cost;
+   cost.bytes = ( double( numSrcDoFs ) + 2.0 * double( numDstDoFs ) ) * double( sizeof( real_t ) );
+   cost.flops = double( numDstDoFs ) * ( 2.0 * weightsPerDstDoF - 1.0 + ( updateType == Add ? 1.0 : 0.0 ) );
+   return cost;
+}
+
+KernelCost elementwiseApply( const uint_t& numElements, const uint_t& numLocalDoFs, const uint_t& numDoFs, const bool& storedMatrices )
+{
+   KernelCost cost;
+   cost.bytes = double( numDoFs ) * 3.0 * double( sizeof( real_t ) );
+   if ( storedMatrices )
+   {
+      cost.bytes += double( numElements ) * double( numLocalDoFs * numLocalDoFs ) * double( sizeof( real_t ) );
+   }
+   cost.flops = double( numElements ) * double( 2 * numLocalDoFs * numLocalDoFs );
+   return cost;
+}
+
+uint_t numInnerVertexDoFsPerFace( const uint_t& level )
+{
+   return levelinfo::num_microvertices_per_face_from_width( levelinfo::num_microvertices_per_edge( level ) - 3 );
+}
+
+uint_t numInnerVertexDoFsPerCell( const uint_t& level )
+{
+   return levelinfo::num_microvertices_per_cell_from_width( levelinfo::num_microvertices_per_edge( level ) - 4 );
+}
+
+uint_t numInnerEdgeDoFsPerFace( const uint_t& level )
+{
+   return levelinfo::num_microedges_per_face( level ) - 3 * levelinfo::num_microedges_per_edge( level );
+}
+
+uint_t numInnerEdgeDoFsPerCell( const uint_t& level )
+{
+   // the micro-edges on the macro-edges are contained in two macro-faces each
+   return levelinfo::num_microedges_per_cell( level ) - 4 * levelinfo::num_microedges_per_face( level ) +
+          6 * levelinfo::num_microedges_per_edge( level );
+}
+
+} // namespace kernelcost
+
+std::string KernelInstrumentation::likwidRegionTag( const std::string& name )
+{
+   std::string tag = name;
+   std::replace( tag.begin(), tag.end(), ' ', '_' );
+   return tag;
+}
+
+std::string KernelInstrumentation::likwidRegionTag( const std::string& name, const uint_t& level )
+{
+   return likwidRegionTag( name ) + "_level" + ( level < 10 ? "0" : "" ) + std::to_string( level );
+}
+
+void KernelInstrumentation::startLikwidRegion( const std::string& name ) const
+{
+   if ( likwidRegionsEnabled_ )
+   {
+      const std::string tag = likwidRegionTag( name );
+      WALBERLA_UNUSED( tag );
+      LIKWID_MARKER_START( tag.c_str() );
+   }
+}
+
+void KernelInstrumentation::stopLikwidRegion( const std::string& name ) const
+{
+   if ( likwidRegionsEnabled_ )
+   {
+      const std::string tag = likwidRegionTag( name );
+      WALBERLA_UNUSED( tag );
+      LIKWID_MARKER_STOP( tag.c_str() );
+   }
+}
+
+void KernelInstrumentation::startLikwidRegion( const std::string& name, const uint_t& level ) const
+{
+   if ( likwidRegionsEnabled_ )
+   {
+      const std::string tag = likwidRegionTag( name, level );
+      WALBERLA_UNUSED( tag );
+      LIKWID_MARKER_START( tag.c_str() );
+   }
+}
+
+void KernelInstrumentation::stopLikwidRegion( const std::string& name, const uint_t& level ) const
+{
+   if ( likwidRegionsEnabled_ )
+   {
+      const std::string tag = likwidRegionTag( name, level );
+      WALBERLA_UNUSED( tag );
+      LIKWID_MARKER_STOP( tag.c_str() );
+   }
+}
+
+void KernelInstrumentation::record( const std::string& kernel, const uint_t& level, const KernelCost& cost, const double& time )
+{
+   auto& statistics = statistics_[kernel][level];
+   statistics.calls++;
+   statistics.time += time;
+   statistics.bytes += cost.bytes;
+   statistics.flops += cost.flops;
+}
+
+void KernelInstrumentation::writeRooflineJSON( const std::string& file,
+                                               const double&      peakBandwidthGBs,
+                                               const double&      peakGFLOPs ) const
+{
+   WALBERLA_CHECK_GREATER( peakBandwidthGBs, 0.0 );
+   WALBERLA_CHECK_GREATER( peakGFLOPs, 0.0 );
+
+   // processes that did not call a kernel do not know it - the reduction is performed over the union of all kernels
+   std::vector< std::string > localKernels;
+   uint_t                     numLevels = 0;
+   for ( const auto& it : statistics_ )
+   {
+      localKernels.push_back( it.first );
+      for ( const auto& levelIt : it.second )
+      {
+         numLevels = std::max( numLevels, levelIt.first + 1 );
+      }
+   }
+
+   const std::vector< std::string > kernels = walberla::mpi::allReduceSet( localKernels, walberla::mpi::UNION );
+   numLevels                                = walberla::mpi::allReduce( numLevels, walberla::mpi::MAX );
+
+   std::vector< double > calls( kernels.size() * numLevels, 0.0 );
+   std::vector< double > time( kernels.size() * numLevels, 0.0 );
+   std::vector< double > bytes( kernels.size() * numLevels, 0.0 );
+   std::vector< double > flops( kernels.size() * numLevels, 0.0 );
+
+   for ( uint_t k = 0; k < kernels.size(); k++ )
+   {
+      if ( statistics_.count( kernels[k] ) == 0 )
+      {
+         continue;
+      }
+      for ( const auto& levelIt : statistics_.at( kernels[k] ) )
+      {
+         const uint_t idx = k * numLevels + levelIt.first;
+         calls[idx]       = double( levelIt.second.calls );
+         time[idx]        = levelIt.second.time;
+         bytes[idx]       = levelIt.second.bytes;
+         flops[idx]       = levelIt.second.flops;
+      }
+   }
+
+   walberla::mpi::allReduceInplace( calls, walberla::mpi::MAX );
+   walberla::mpi::allReduceInplace( time, walberla::mpi::MAX );
+   walberla::mpi::allReduceInplace( bytes, walberla::mpi::SUM );
+   walberla::mpi::allReduceInplace( flops, walberla::mpi::SUM );
+
+   WALBERLA_ROOT_SECTION()
+   {
+      nlohmann::json json;
+
+      json["machine"]["peakBandwidthGBs"] = peakBandwidthGBs;
+      json["machine"]["peakGFLOPs"]       = peakGFLOPs;
+      json["machine"]["ridgePoint"]       = peakGFLOPs / peakBandwidthGBs;
+      json["numProcesses"]                = walberla::mpi::MPIManager::instance()->numProcesses();
+
+      json["kernels"] = nlohmann::json::object();
+
+      for ( uint_t k = 0; k < kernels.size(); k++ )
+      {
+         for ( uint_t level = 0; level < numLevels; level++ )
+         {
+            const uint_t idx = k * numLevels + level;
+            if ( calls[idx] < 1.0 )
+            {
+               continue;
+            }
+
+            const double intensity   = bytes[idx] > 0 ? flops[idx] / bytes[idx] : 0.0;
+            const double bandwidth   = time[idx] > 0 ? bytes[idx] / time[idx] * 1e-9 : 0.0;
+            const double performance = time[idx] > 0 ? flops[idx] / time[idx] * 1e-9 : 0.0;
+            const double roofline    = std::min( peakGFLOPs, intensity * peakBandwidthGBs );
+
+            nlohmann::json entry;
+            entry["calls"]               = uint_c( calls[idx] );
+            entry["time"]                = time[idx];
+            entry["bytes"]               = bytes[idx];
+            entry["flops"]               = flops[idx];
+            entry["bandwidthGBs"]        = bandwidth;
+            entry["GFLOPs"]              = performance;
+            entry["arithmeticIntensity"] = intensity;
+            entry["rooflineGFLOPs"]      = roofline;
+            entry["fractionOfRoofline"]  = roofline > 0 ? performance / roofline : 0.0;
+            entry["bound"]               = intensity * peakBandwidthGBs < peakGFLOPs ? "memory" : "compute";
+
+            json["kernels"][kernels[k]][std::to_string( level )] = entry;
+         }
+      }
+
+      std::ofstream jsonOutput;
+      jsonOutput.open( file );
+      jsonOutput << json.dump( 4 );
+      jsonOutput.close();
+   }
+}
+
+KernelRegion::KernelRegion( const std::string& kernel, const uint_t& level, const bool& enabled )
+: kernel_( kernel )
+, level_( level )
+, likwidRegion_( enabled && KernelInstrumentation::instance()->likwidRegionsEnabled() )
+, recordStatistics_( enabled && KernelInstrumentation::instance()->kernelStatisticsEnabled() )
+{
+   if ( likwidRegion_ )
+   {
+      KernelInstrumentation::instance()->startLikwidRegion( kernel_, level_ );
+   }
+   if ( recordStatistics_ )
+   {
+      timer_.start();
+   }
+}
+
+KernelRegion::~KernelRegion()
+{
+   if ( recordStatistics_ )
+   {
+      timer_.end();
+      KernelInstrumentation::instance()->record( kernel_, level_, cost_, timer_.last() );
+   }
+   if ( likwidRegion_ )
+   {
+      KernelInstrumentation::instance()->stopLikwidRegion( kernel_, level_ );
+   }
+}
+
+} // namespace hyteg
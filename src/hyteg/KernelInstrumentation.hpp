@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "core/DataTypes.h"
+#include "core/singleton/Singleton.h"
+#include "core/timing/Timer.h"
+#include "core/timing/TimingTree.h"
+
+#include "hyteg/types/flags.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Analytic data volume (in bytes) and number of floating point operations of a kernel.
+struct KernelCost
+{
+   double bytes = 0;
+   double flops = 0;
+};
+
+inline KernelCost operator+( const KernelCost& lhs, const KernelCost& rhs )
+{
+   KernelCost cost;
+   cost.bytes = lhs.bytes + rhs.bytes;
+   cost.flops = lhs.flops + rhs.flops;
+   return cost;
+}
+
+namespace kernelcost {
+
+/// \brief Cost of the application of a constant stencil with stencilSize entries to numDoFs unknowns.
+///
+/// Streaming model: the stencil weights reside in cache and the layer condition is fulfilled for the source vector.
+/// Per unknown, one source value is read and one destination value is written. The destination value is also read,
+/// either explicitly (UpdateType Add) or due to the write-allocate transfer (UpdateType Replace).
+/// Flops: stencilSize multiplications and stencilSize - 1 additions, plus one addition for UpdateType Add.
+KernelCost constantStencilApply( const uint_t& numDoFs, const uint_t& stencilSize, const UpdateType& updateType );
+
+/// \brief Cost of a (Gauss-Seidel or SOR) relaxation sweep with a constant stencil with stencilSize entries over numDoFs unknowns.
+///
+/// Streaming model: per unknown, the solution is read and written back (no write-allocate since the cache line was
+/// loaded before) and the right-hand side is read.
+/// Flops: stencilSize - 1 multiplications and additions for the off-diagonal part, the subtraction from the
+/// right-hand side, the scaling with relax / diagonal and the weighted update of the old value.
+KernelCost constantStencilSOR( const uint_t& numDoFs, const uint_t& stencilSize );
+
+/// \brief Cost of the application of a constant stencil that couples different DoF types (e.g. edge DoFs to vertex DoFs).
+///
+/// Same streaming model as above, but the numSrcDoFs source values and the numDstDoFs destination values are counted
+/// separately. weightsPerDstDoF is the (average) number of stencil weights per destination unknown.
+KernelCost constantStencilApply( const uint_t&     numDstDoFs,
+                                 const uint_t&     numSrcDoFs,
+                                 const double&     weightsPerDstDoF,
+                                 const UpdateType& updateType );
+
+/// \brief Cost of the elementwise application of an operator with numLocalDoFs unknowns per micro-element to numDoFs unknowns.
+///
+/// Per unknown, the source value is read and the destination value is read and written. If the local element matrices
+/// are stored, they are streamed from memory as well. The flops only cover the local matrix-vector products
+/// (numLocalDoFs^2 multiplications and additions per element), the on-the-fly integration of the local element
+/// matrices depends on the form and is not counted.
+KernelCost elementwiseApply( const uint_t& numElements, const uint_t& numLocalDoFs, const uint_t& numDoFs, const bool& storedMatrices );
+
+/// Number of micro-vertices in the interior of a macro-face (2D) or macro-cell (3D).
+uint_t numInnerVertexDoFsPerFace( const uint_t& level );
+uint_t numInnerVertexDoFsPerCell( const uint_t& level );
+
+/// Number of micro-edges in the interior of a macro-face (2D) or macro-cell (3D).
+uint_t numInnerEdgeDoFsPerFace( const uint_t& level );
+uint_t numInnerEdgeDoFsPerCell( const uint_t& level );
+
+/// Returns the number of the passed macro-primitives whose boundary type (w.r.t. the passed function) matches the flag.
+template < typename PrimitiveMapType, typename FunctionType >
+inline uint_t numMacroPrimitivesWithFlag( const PrimitiveMapType& primitives, const FunctionType& function, const DoFType& flag )
+{
+   uint_t count = 0;
+   for ( const auto& it : primitives )
+   {
+      if ( testFlag( function.getBoundaryCondition().getBoundaryType( it.second->getMeshBoundaryFlag() ), flag ) )
+      {
+         count++;
+      }
+   }
+   return count;
+}
+
+/// Number of weights of a stencil that is stored in (nested) maps.
+inline uint_t numStencilWeights( const real_t& )
+{
+   return 1;
+}
+
+template < typename Key, typename Value >
+inline uint_t numStencilWeights( const std::map< Key, Value >& stencil )
+{
+   uint_t num = 0;
+   for ( const auto& it : stencil )
+   {
+      num += numStencilWeights( it.second );
+   }
+   return num;
+}
+
+} // namespace kernelcost
+
+/// \brief Instrumentation of the compute kernels for performance analyses.
+///
+/// Provides two independent features that are disabled by default:
+///
+/// - LIKWID marker regions: if enabled, the timing regions of the operators (e.g. "Apply", "SOR"), the multigrid
+///   regions (e.g. "Smoother", "Restriction") and the kernel regions below are additionally wrapped into LIKWID
+///   marker regions. The region tags are the timing region names with spaces replaced by underscores, regions that
+///   are executed on a specific level get the suffix "_levelXX". Without LIKWID_PERFMON this only affects the
+///   (then no-op) macros in LikwidWrapper.hpp.
+///
+/// - Kernel statistics: if enabled, the kernel regions record the number of calls, the measured run time and the
+///   analytic number of transferred bytes and flops per kernel and level. After the run, the statistics are reduced
+///   over all processes and exported as a roofline summary via writeRooflineJSON().
+///
+/// Usage:
+///
+///   KernelInstrumentation::instance()->enableKernelStatistics( true );
+///   ... // solve
+///   KernelInstrumentation::instance()->writeRooflineJSON( "roofline.json", peakBandwidth, peakGFLOPs );
+class KernelInstrumentation : public walberla::singleton::Singleton< KernelInstrumentation >
+{
+ public:
+   WALBERLA_BEFRIEND_SINGLETON;
+
+   /// Accumulated statistics of a kernel on one level.
+   struct Statistics
+   {
+      uint_t calls = 0;
+      double time  = 0;
+      double bytes = 0;
+      double flops = 0;
+   };
+
+   void enableLikwidRegions( bool enable ) { likwidRegionsEnabled_ = enable; }
+   bool likwidRegionsEnabled() const { return likwidRegionsEnabled_; }
+
+   void enableKernelStatistics( bool enable ) { kernelStatisticsEnabled_ = enable; }
+   bool kernelStatisticsEnabled() const { return kernelStatisticsEnabled_; }
+
+   /// Starts / stops the LIKWID marker region with the passed name if LIKWID regions are enabled.
+   void startLikwidRegion( const std::string& name ) const;
+   void stopLikwidRegion( const std::string& name ) const;
+
+   /// Same as above, the level is appended to the region tag.
+   void startLikwidRegion( const std::string& name, const uint_t& level ) const;
+   void stopLikwidRegion( const std::string& name, const uint_t& level ) const;
+
+   /// Adds a single call of a kernel with the passed (process local) cost and run time to the statistics.
+   void record( const std::string& kernel, const uint_t& level, const KernelCost& cost, const double& time );
+
+   /// Returns the process local statistics of all recorded kernels, indexed by kernel name and level.
+   const std::map< std::string, std::map< uint_t, Statistics > >& getStatistics() const { return statistics_; }
+
+   /// Clears all recorded statistics.
+   void reset() { statistics_.clear(); }
+
+   /// \brief Writes the roofline summary of all recorded kernels to a JSON file.
+   ///
+   /// The byte and flop counts are summed up over all processes, the time is the maximum over all processes.
+   /// For each kernel and level the attained bandwidth (GB/s), performance (GFLOP/s) and arithmetic intensity
+   /// (flops / byte) are compared to the roofline limit min( peakGFLOPs, intensity * peakBandwidth ).
+   /// The peak values must refer to all processes of the run (e.g. the peak of all involved sockets).
+   ///
+   /// Collective call, involves multiple allReduces. The file is written by the root process.
+   void writeRooflineJSON( const std::string& file, const double& peakBandwidthGBs, const double& peakGFLOPs ) const;
+
+   /// Converts a timing region name to a LIKWID region tag.
+   static std::string likwidRegionTag( const std::string& name );
+   static std::string likwidRegionTag( const std::string& name, const uint_t& level );
+
+ private:
+   KernelInstrumentation()
+   : likwidRegionsEnabled_( false )
+   , kernelStatisticsEnabled_( false )
+   {}
+
+   bool likwidRegionsEnabled_;
+   bool kernelStatisticsEnabled_;
+
+   std::map< std::string, std::map< uint_t, Statistics > > statistics_;
+};
+
+/// \brief Scoped region around a compute kernel.
+///
+/// If the kernel statistics are enabled, the run time of the scope is measured and recorded together with the
+/// analytic cost that is passed via setCost() during destruction. If LIKWID regions are enabled, the scope is wrapped
+/// into a LIKWID marker region "<kernel>_levelXX".
+///
+/// Regions around generated kernels are named exactly like the generated kernel that is called on the macro-primitives
+/// (e.g. "apply_3D_macrocell_vertexdof_to_vertexdof_replace" or "sor_3D_macrocell_P1_backwards"), so that the
+/// statistics and LIKWID tags can be matched with the kernel sources. If one sweep calls several generated kernels
+/// per macro-primitive (e.g. the P2 SOR, which updates the vertex DoFs and the edge DoFs), the region is named after
+/// their common prefix ("sor_3D_macrocell_P2"). Other kernels follow the same pattern
+/// <operation>_<dimension>D_<primitive>_<kernel> (e.g. "apply_3D_macrocell_P2_elementwise").
+///
+/// Must not be created inside OpenMP parallel regions. The cost is the sum over all primitives processed by this process.
+class KernelRegion
+{
+ public:
+   /// \param kernel  name of the kernel
+   /// \param level   refinement level the kernel is executed on
+   /// \param enabled allows to skip the instrumentation of code paths for which no cost model is available
+   KernelRegion( const std::string& kernel, const uint_t& level, const bool& enabled = true );
+
+   ~KernelRegion();
+
+   /// Returns true if the statistics of this region are recorded, i.e. if setCost() should be called.
+   bool recordsStatistics() const { return recordStatistics_; }
+
+   void setCost( const KernelCost& cost ) { cost_ = cost; }
+
+ private:
+   std::string       kernel_;
+   uint_t            level_;
+   bool              likwidRegion_;
+   bool              recordStatistics_;
+   KernelCost        cost_;
+   walberla::WcTimer timer_;
+};
+
+/// Starts a region in the timing tree and, if enabled, the corresponding LIKWID marker region on the passed level.
+inline void startInstrumentedRegion( walberla::WcTimingTree& timingTree, const std::string& name, const uint_t& level )
+{
+   timingTree.start( name );
+   KernelInstrumentation::instance()->startLikwidRegion( name, level );
+}
+
+/// Stops a region that was started with startInstrumentedRegion().
+inline void stopInstrumentedRegion( walberla::WcTimingTree& timingTree, const std::string& name, const uint_t& level )
+{
+   KernelInstrumentation::instance()->stopLikwidRegion( name, level );
+   timingTree.stop( name );
+}
+
+} // namespace hyteg
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "core/DataTypes.h"
 #include "core/singleton/Singleton.h"
 #include "core/OpenMP.h"
 
@@ -49,6 +50,17 @@ class OpenMPManager : public walberla::singleton::Singleton< OpenMPManager >
       #endif
    }
 
+   /// \brief Sets the (maximum) number of OpenMP threads that are used in subsequent parallel regions.
+   ///        This also governs the threading inside of macro-primitives (e.g. in the elementwise operators).
+   void setNumThreads( int numThreads )
+   {
+      #ifdef WALBERLA_BUILD_WITH_OPENMP
+      omp_set_num_threads( numThreads );
+      #else
+      WALBERLA_UNUSED( numThreads );
+      #endif
+   }
+
    /// \brief Returns the current (maximum) number of threads.
    int numThreads() const
    {
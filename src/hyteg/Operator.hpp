@@ -24,6 +24,7 @@
 #include <core/timing/TimingTree.h>
 #include "hyteg/primitivestorage/PrimitiveStorage.hpp"
 #include "hyteg/FunctionTraits.hpp"
+#include "hyteg/KernelInstrumentation.hpp"
 
 #include <memory>
 
@@ -71,16 +72,32 @@ public:
       timingTree_->start( "Operator " + FunctionTrait< SourceFunction >::getTypeName() + " to " + FunctionTrait< DestinationFunction >::getTypeName() );
       timingTree_->start( timerString );
     }
+    if ( KernelInstrumentation::instance()->likwidRegionsEnabled() )
+    {
+      KernelInstrumentation::instance()->startLikwidRegion( likwidRegionName( timerString ) );
+    }
   }
 
   void stopTiming ( const std::string & timerString ) const
   {
+    if ( KernelInstrumentation::instance()->likwidRegionsEnabled() )
+    {
+      KernelInstrumentation::instance()->stopLikwidRegion( likwidRegionName( timerString ) );
+    }
     if ( timingTree_ )
     {
       timingTree_->stop( timerString );
       timingTree_->stop( "Operator " + FunctionTrait< SourceFunction >::getTypeName() + " to " + FunctionTrait< DestinationFunction >::getTypeName() );
     }
   }
+
+ private:
+
+  /// LIKWID regions are not nested like the timing tree, therefore the operator type is part of the region name.
+  static std::string likwidRegionName( const std::string & timerString )
+  {
+    return "Operator " + FunctionTrait< SourceFunction >::getTypeName() + " to " + FunctionTrait< DestinationFunction >::getTypeName() + " " + timerString;
+  }
 };
 
 }
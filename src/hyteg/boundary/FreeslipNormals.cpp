@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/boundary/FreeslipNormals.hpp"
+
+namespace hyteg {
+
+FreeslipNormalCache::FreeslipNormalCache( const std::shared_ptr< PrimitiveStorage >& storage,
+                                          const uint_t&                              minLevel,
+                                          const uint_t&                              maxLevel,
+                                          const ComputeFunction&                     compute )
+: storage_( storage )
+, minLevel_( minLevel )
+, maxLevel_( maxLevel )
+, compute_( compute )
+, modificationStamp_( storage->getModificationStamp() )
+{
+   build();
+}
+
+const FreeslipNormals& FreeslipNormalCache::get( const PrimitiveID& primitiveID, const uint_t& level )
+{
+   if ( isOutdated() )
+   {
+      build();
+   }
+
+   auto& normalsOnLevel = normals_[level];
+   auto  it             = normalsOnLevel.find( primitiveID );
+   if ( it == normalsOnLevel.end() )
+   {
+      it = normalsOnLevel.emplace( primitiveID, FreeslipNormals() ).first;
+      compute_( primitiveID, level, it->second );
+   }
+   return it->second;
+}
+
+void FreeslipNormalCache::build()
+{
+   normals_.clear();
+   modificationStamp_ = storage_->getModificationStamp();
+
+   std::vector< PrimitiveID > primitiveIDs = storage_->getVertexIDs();
+   const auto                 edgeIDs      = storage_->getEdgeIDs();
+   const auto                 faceIDs      = storage_->getFaceIDs();
+   primitiveIDs.insert( primitiveIDs.end(), edgeIDs.begin(), edgeIDs.end() );
+   primitiveIDs.insert( primitiveIDs.end(), faceIDs.begin(), faceIDs.end() );
+
+   for ( uint_t level = minLevel_; level <= maxLevel_; level++ )
+   {
+      for ( const auto& primitiveID : primitiveIDs )
+      {
+         if ( storage_->onBoundary( primitiveID ) )
+         {
+            compute_( primitiveID, level, normals_[level][primitiveID] );
+         }
+      }
+   }
+}
+
+} // namespace hyteg
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/PrimitiveID.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/types/pointnd.hpp"
+
+namespace hyteg {
+
+using walberla::uint_t;
+
+/// Normals of the free-slip DoFs of a single macro-primitive on a single level.
+///
+/// The normal of the DoF at array position indices[i] is stored in normals[i].
+struct FreeslipNormals
+{
+   std::vector< uint_t >  indices;
+   std::vector< Point3D > normals;
+};
+
+/// Applies the normal projection ( I - n n^T ) to the 2D vectors ( dstU, dstV ) at the stored DoFs.
+template < typename ValueType >
+inline void applyNormalProjection2D( const FreeslipNormals& freeslipNormals, ValueType* dstU, ValueType* dstV )
+{
+   const uint_t*  indices = freeslipNormals.indices.data();
+   const Point3D* normals = freeslipNormals.normals.data();
+
+   for ( uint_t i = 0; i < freeslipNormals.indices.size(); i++ )
+   {
+      const uint_t   idx = indices[i];
+      const Point3D& n   = normals[i];
+
+      const ValueType nDotIn = n[0] * dstU[idx] + n[1] * dstV[idx];
+
+      dstU[idx] -= nDotIn * n[0];
+      dstV[idx] -= nDotIn * n[1];
+   }
+}
+
+/// Applies the normal projection ( I - n n^T ) to the 3D vectors ( dstU, dstV, dstW ) at the stored DoFs.
+template < typename ValueType >
+inline void applyNormalProjection3D( const FreeslipNormals& freeslipNormals, ValueType* dstU, ValueType* dstV, ValueType* dstW )
+{
+   const uint_t*  indices = freeslipNormals.indices.data();
+   const Point3D* normals = freeslipNormals.normals.data();
+
+   for ( uint_t i = 0; i < freeslipNormals.indices.size(); i++ )
+   {
+      const uint_t   idx = indices[i];
+      const Point3D& n   = normals[i];
+
+      const ValueType nDotIn = n[0] * dstU[idx] + n[1] * dstV[idx] + n[2] * dstW[idx];
+
+      dstU[idx] -= nDotIn * n[0];
+      dstV[idx] -= nDotIn * n[1];
+      dstW[idx] -= nDotIn * n[2];
+   }
+}
+
+/// \brief Level-wise storage of the free-slip normals of the macro-primitives.
+///
+/// The normals of all local macro-primitives on the domain boundary are computed on construction. Normals of other
+/// macro-primitives are computed on the first request. All normals are recomputed if the PrimitiveStorage was modified
+/// (e.g. by a migration of primitives).
+class FreeslipNormalCache
+{
+ public:
+   /// Computes the normals of the macro-primitive with the passed ID on the passed level.
+   /// Must leave the normals empty if there are no projected DoFs on the macro-primitive on that level.
+   typedef std::function< void( const PrimitiveID&, const uint_t&, FreeslipNormals& ) > ComputeFunction;
+
+   FreeslipNormalCache( const std::shared_ptr< PrimitiveStorage >& storage,
+                        const uint_t&                              minLevel,
+                        const uint_t&                              maxLevel,
+                        const ComputeFunction&                     compute );
+
+   /// Returns the normals of the macro-primitive with the passed ID on the passed level.
+   const FreeslipNormals& get( const PrimitiveID& primitiveID, const uint_t& level );
+
+   /// Returns true if the storage has been modified since the normals were computed.
+   bool isOutdated() const { return storage_->getModificationStamp() != modificationStamp_; }
+
+ private:
+   /// Discards all normals and computes the normals of the local macro-primitives on the domain boundary.
+   void build();
+
+   std::shared_ptr< PrimitiveStorage > storage_;
+   uint_t                              minLevel_;
+   uint_t                              maxLevel_;
+   ComputeFunction                     compute_;
+   uint_t                              modificationStamp_;
+
+   std::map< uint_t, std::map< PrimitiveID, FreeslipNormals > > normals_;
+};
+
+} // namespace hyteg
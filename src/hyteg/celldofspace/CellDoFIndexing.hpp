@@ -125,6 +125,25 @@ inline std::array< Index, 4 > getMicroVerticesFromMicroCell( const Index& microC
    return std::array< Index, 4 >();
 }
 
+/// Returns a unique linear index in [0, levelinfo::num_microcells_per_cell( level )) for the micro-cell of the given
+/// indices and cell type.
+///
+/// The micro-cells are numbered type by type in the order of allCellTypes and lexicographically within each type.
+/// Intended for the storage of per-micro-cell data (e.g. local element matrices) in flat arrays.
+inline uint_t index( const uint_t& level, const uint_t& x, const uint_t& y, const uint_t& z, const CellType& cellType )
+{
+   uint_t offset = 0;
+   for ( const auto& cType : allCellTypes )
+   {
+      if ( cType == cellType )
+      {
+         break;
+      }
+      offset += indexing::macroCellSize( numCellsPerRowByType( level, cType ) );
+   }
+   return offset + indexing::macroCellIndex( numCellsPerRowByType( level, cellType ), x, y, z );
+}
+
 // Iterators
 
 class Iterator : public indexing::CellIterator
@@ -135,6 +154,69 @@ class Iterator : public indexing::CellIterator
    {}
 };
 
+/// \brief Iterates over the logical indices of all micro-cells of the passed type in the slab with z-index \p slab.
+///
+/// All micro-cells of a slab only touch micro-vertices and micro-edges with z-index slab or slab + 1.
+/// Therefore, slabs of equal parity do not share any DoFs and can be processed concurrently.
+/// The micro-cells of a slab form a triangle and are traversed row-wise (x fastest).
+class SlabIterator
+{
+ public:
+   using iterator_category = std::input_iterator_tag;
+   using value_type        = Index;
+   using reference         = value_type const&;
+   using pointer           = value_type const*;
+   using difference_type   = ptrdiff_t;
+
+   SlabIterator( const uint_t& level, const CellType& cellType, const uint_t& slab )
+   : SlabIterator( numCellsPerRowByType( level, cellType ) > slab ? numCellsPerRowByType( level, cellType ) - slab : 0,
+                   slab,
+                   false )
+   {}
+
+   SlabIterator begin() const { return SlabIterator( slabWidth_, coordinates_.z(), false ); }
+   SlabIterator end() const { return SlabIterator( slabWidth_, coordinates_.z(), true ); }
+
+   bool operator==( const SlabIterator& other ) const { return other.step_ == step_; }
+   bool operator!=( const SlabIterator& other ) const { return other.step_ != step_; }
+
+   reference operator*() const { return coordinates_; }
+   pointer   operator->() const { return &coordinates_; }
+
+   SlabIterator& operator++() // prefix
+   {
+      step_++;
+      if ( coordinates_.x() + 1 < slabWidth_ - coordinates_.y() )
+      {
+         coordinates_.x()++;
+      }
+      else
+      {
+         coordinates_.x() = 0;
+         coordinates_.y()++;
+      }
+      return *this;
+   }
+
+   SlabIterator operator++( int ) // postfix
+   {
+      const SlabIterator tmp( *this );
+      ++*this;
+      return tmp;
+   }
+
+ private:
+   SlabIterator( const uint_t& slabWidth, const uint_t& slab, const bool& end )
+   : slabWidth_( slabWidth )
+   , step_( end ? ( slabWidth * ( slabWidth + 1 ) ) / 2 : 0 )
+   , coordinates_( 0, 0, slab )
+   {}
+
+   uint_t slabWidth_;
+   uint_t step_;
+   Index  coordinates_;
+};
+
 } // namespace macrocell
 } // namespace celldof
 } // namespace hyteg
@@ -56,6 +56,7 @@ DoFSpacePackInfo< ValueType >::DoFSpacePackInfo( uint_t
 {}
 
 template class DoFSpacePackInfo< double >;
+template class DoFSpacePackInfo< float >;
 template class DoFSpacePackInfo< int >;
 template class DoFSpacePackInfo< long >;
 template class DoFSpacePackInfo< uint_t >;
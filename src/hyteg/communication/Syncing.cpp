@@ -20,6 +20,7 @@
 #include "Syncing.hpp"
 
 #include "hyteg/Function.hpp"
+#include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
 #include "hyteg/p1functionspace/VertexDoFFunction.hpp"
 #include "hyteg/p2functionspace/P2Function.hpp"
 #include "hyteg/primitives/all.hpp"
@@ -48,6 +49,49 @@ void syncP2FunctionBetweenPrimitives( const P2Function< ValueType >& function, c
    syncFunctionBetweenPrimitives< hyteg::EdgeDoFFunction< ValueType > >( function.getEdgeDoFFunction(), level );
 }
 
+template < typename SenderType, typename ReceiverType, typename ValueType >
+static void communicateSimultaneously( const std::vector< const vertexdof::VertexDoFFunction< ValueType >* >& vertexDoFFunctions,
+                                       const std::vector< const EdgeDoFFunction< ValueType >* >&              edgeDoFFunctions,
+                                       const uint_t&                                                          level )
+{
+   for ( const auto& function : vertexDoFFunctions )
+   {
+      function->template startCommunication< SenderType, ReceiverType >( level );
+   }
+   for ( const auto& function : edgeDoFFunctions )
+   {
+      function->template startCommunication< SenderType, ReceiverType >( level );
+   }
+   for ( const auto& function : vertexDoFFunctions )
+   {
+      function->template endCommunication< SenderType, ReceiverType >( level );
+   }
+   for ( const auto& function : edgeDoFFunctions )
+   {
+      function->template endCommunication< SenderType, ReceiverType >( level );
+   }
+}
+
+template < typename ValueType >
+void syncP2P1TaylorHoodFunctionBetweenPrimitives( const P2P1TaylorHoodFunction< ValueType >& function, const uint_t& level )
+{
+   std::vector< const vertexdof::VertexDoFFunction< ValueType >* > vertexDoFFunctions = {&function.p};
+   std::vector< const EdgeDoFFunction< ValueType >* >              edgeDoFFunctions;
+   for ( uint_t idx = 0; idx < function.uvw.getDimension(); ++idx )
+   {
+      vertexDoFFunctions.push_back( &function.uvw[idx].getVertexDoFFunction() );
+      edgeDoFFunctions.push_back( &function.uvw[idx].getEdgeDoFFunction() );
+   }
+
+   communicateSimultaneously< Vertex, Edge >( vertexDoFFunctions, edgeDoFFunctions, level );
+   communicateSimultaneously< Edge, Face >( vertexDoFFunctions, edgeDoFFunctions, level );
+   communicateSimultaneously< Face, Cell >( vertexDoFFunctions, edgeDoFFunctions, level );
+
+   communicateSimultaneously< Cell, Face >( vertexDoFFunctions, edgeDoFFunctions, level );
+   communicateSimultaneously< Face, Edge >( vertexDoFFunctions, edgeDoFFunctions, level );
+   communicateSimultaneously< Edge, Vertex >( vertexDoFFunctions, edgeDoFFunctions, level );
+}
+
 // Version for VectorFunctions
 template < typename vType >
 void syncVectorFunctionBetweenPrimitives( const P1VectorFunction< vType >& vecFunc, const uint_t& level )
@@ -70,7 +114,10 @@ void syncVectorFunctionBetweenPrimitives( const P2VectorFunction< vType >& vecFu
 template void syncP2FunctionBetweenPrimitives( const P2Function< double >& function, const uint_t& level );
 template void syncP2FunctionBetweenPrimitives( const P2Function< int >& function, const uint_t& level );
 
+template void syncP2P1TaylorHoodFunctionBetweenPrimitives( const P2P1TaylorHoodFunction< double >& function, const uint_t& level );
+
 template void syncFunctionBetweenPrimitives( const vertexdof::VertexDoFFunction< double >& function, const uint_t& level );
+template void syncFunctionBetweenPrimitives( const vertexdof::VertexDoFFunction< float >& function, const uint_t& level );
 template void syncFunctionBetweenPrimitives( const vertexdof::VertexDoFFunction< int >& function, const uint_t& level );
 template void syncFunctionBetweenPrimitives( const vertexdof::VertexDoFFunction< long >& function, const uint_t& level );
 
@@ -29,6 +29,9 @@ namespace hyteg {
 template < typename funcType >
 class P2Function;
 
+template < typename ValueType >
+class P2P1TaylorHoodFunction;
+
 namespace communication {
 
 using walberla::uint_t;
@@ -46,5 +49,12 @@ void syncVectorFunctionBetweenPrimitives( const P2VectorFunction< vType >& funct
 template < typename ValueType >
 void syncP2FunctionBetweenPrimitives( const P2Function< ValueType >& function, const uint_t& level );
 
+/// Syncs all velocity components and the pressure at once.
+///
+/// In contrast to syncing the components one after another, each stage of the exchange is started for all
+/// components before it is completed, so that only one round of messages per stage is required.
+template < typename ValueType >
+void syncP2P1TaylorHoodFunctionBetweenPrimitives( const P2P1TaylorHoodFunction< ValueType >& function, const uint_t& level );
+
 } // namespace communication
 } // namespace hyteg
@@ -145,10 +145,17 @@ class P2P1TaylorHoodFunction
    }
 
    walberla::real_t
-       dotGlobal( const P2P1TaylorHoodFunction< ValueType >& rhs, const size_t level, const DoFType flag = All ) const
+       dotLocal( const P2P1TaylorHoodFunction< ValueType >& rhs, const size_t level, const DoFType flag = All ) const
    {
       walberla::real_t sum = uvw.dotLocal( rhs.uvw, level, flag );
       sum += p.dotLocal( rhs.p, level, flag | DirichletBoundary );
+      return sum;
+   }
+
+   walberla::real_t
+       dotGlobal( const P2P1TaylorHoodFunction< ValueType >& rhs, const size_t level, const DoFType flag = All ) const
+   {
+      walberla::real_t sum = dotLocal( rhs, level, flag );
       walberla::mpi::allReduceInplace( sum, walberla::mpi::SUM, walberla::mpi::MPIManager::instance()->comm() );
       return sum;
    }
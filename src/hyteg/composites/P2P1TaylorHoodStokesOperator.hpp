@@ -21,6 +21,7 @@
 
 #include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
 #include "hyteg/composites/P2P1TaylorHoodStokesBlockPreconditioner.hpp"
+#include "hyteg/elementwiseoperators/P2P1ElementwiseFusedStokesOperator.hpp"
 #include "hyteg/mixedoperators/P1ScalarToP2VectorOperator.hpp"
 #include "hyteg/mixedoperators/P1ToP2Operator.hpp"
 #include "hyteg/mixedoperators/P2ToP1Operator.hpp"
@@ -49,13 +50,40 @@ class P2P1TaylorHoodStokesOperator : public Operator< P2P1TaylorHoodFunction< re
    , pspg_( storage, minLevel, maxLevel )
    , pspg_inv_diag_( storage, minLevel, maxLevel )
    , hasGlobalCells_( storage->hasGlobalCells() )
+   , useFusedApply_( false )
    {}
 
+   /// Enables or disables the monolithic apply.
+   ///
+   /// If enabled, apply() does not call the blocks one after another but performs a single sweep over the
+   /// micro-elements with one combined halo exchange (see P2P1ElementwiseFusedStokesOperator). The local
+   /// element matrices of the same forms that define the stencils are precomputed for this purpose, so that
+   /// the result agrees with the blockwise apply up to round-off. Disabled by default.
+   ///
+   /// The monolithic operator and its element matrices are only allocated when the fused apply is enabled.
+   void setFusedApply( bool fused )
+   {
+      if ( fused && fusedApply_ == nullptr )
+      {
+         fusedApply_ = std::make_shared< P2P1ElementwiseFusedConstantStokesOperator >( storage_, minLevel_, maxLevel_ );
+         fusedApply_->computeAndStoreLocalElementMatrices();
+      }
+      useFusedApply_ = fused;
+   }
+
+   bool getFusedApply() const { return useFusedApply_; }
+
    void apply( const P2P1TaylorHoodFunction< real_t >& src,
                const P2P1TaylorHoodFunction< real_t >& dst,
                const uint_t                            level,
                const DoFType                           flag ) const
    {
+      if ( useFusedApply_ )
+      {
+         fusedApply_->apply( src, dst, level, flag );
+         return;
+      }
+
       A.apply( src.uvw.u, dst.uvw.u, level, flag, Replace );
       divT_x.apply( src.p, dst.uvw.u, level, flag, Add );
 
@@ -92,6 +120,10 @@ class P2P1TaylorHoodStokesOperator : public Operator< P2P1TaylorHoodFunction< re
    P1PSPGOperator        pspg_;
    P1PSPGInvDiagOperator pspg_inv_diag_;
    bool                  hasGlobalCells_;
+
+ private:
+   std::shared_ptr< P2P1ElementwiseFusedConstantStokesOperator > fusedApply_;
+   bool                                                          useFusedApply_;
 };
 
 } // namespace hyteg
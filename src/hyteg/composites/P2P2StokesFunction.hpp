@@ -106,10 +106,16 @@ class P2P2StokesFunction
       p.add( scalars, functions_p, level, flag );
    }
 
-   walberla::real_t dotGlobal( const P2P2StokesFunction< ValueType >& rhs, const uint_t level, const DoFType flag = All ) const
+   walberla::real_t dotLocal( const P2P2StokesFunction< ValueType >& rhs, const uint_t level, const DoFType flag = All ) const
    {
       walberla::real_t sum = uvw.dotLocal( rhs.uvw, level, flag );
       sum += p.dotLocal( rhs.p, level, flag );
+      return sum;
+   }
+
+   walberla::real_t dotGlobal( const P2P2StokesFunction< ValueType >& rhs, const uint_t level, const DoFType flag = All ) const
+   {
+      walberla::real_t sum = dotLocal( rhs, level, flag );
       walberla::mpi::allReduceInplace( sum, walberla::mpi::SUM, walberla::mpi::MPIManager::instance()->comm() );
       return sum;
    }
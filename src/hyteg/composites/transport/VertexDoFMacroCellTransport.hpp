@@ -50,9 +50,9 @@ inline void apply( const uint_t&                                               l
                    const PrimitiveDataID< FunctionMemory< ValueType >, Cell >& uxId,
                    const PrimitiveDataID< FunctionMemory< ValueType >, Cell >& uyId,
                    const PrimitiveDataID< FunctionMemory< ValueType >, Cell >& uzId,
-                   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >&  xOprId,
-                   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >&  yOprId,
-                   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >&  zOprId )
+                   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&   xOprId,
+                   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&   yOprId,
+                   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&   zOprId )
 {
    typedef stencilDirection sd;
 
@@ -67,7 +67,7 @@ inline void apply( const uint_t&                                               l
    auto yOperatorData = cell.getData( yOprId )->getData( level );
    auto zOperatorData = cell.getData( zOprId )->getData( level );
 
-   vertexdof::macrocell::StencilMap_T stencil;
+   vertexdof::macrocell::FlatStencil  stencil;
    real_t                             dTmp;
 
    ValueType tmp;
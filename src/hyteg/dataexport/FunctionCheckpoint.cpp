@@ -0,0 +1,838 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/dataexport/FunctionCheckpoint.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <set>
+#include <tuple>
+
+#include "core/debug/CheckFunctions.h"
+#include "core/mpi/BufferSystem.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/Reduce.h"
+
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+
+namespace hyteg {
+
+using walberla::uint64_c;
+using walberla::uint64_t;
+
+namespace checkpoint {
+
+static const char magic[8] = {'H', 'Y', 'T', 'E', 'G', 'C', 'P', '2'};
+
+/// Maximum number of bytes that are passed to a single MPI-IO call (the count argument is an int).
+static const uint64_t maxChunkSize = uint64_t( 1 ) << 30;
+
+/// Location of the data of one function on one primitive and one level.
+struct IndexEntry
+{
+   uint64_t entry;
+   uint64_t primitiveID;
+   uint64_t level;
+   /// absolute position in the file in bytes
+   uint64_t offset;
+   /// number of values
+   uint64_t size;
+};
+
+/// Position of the topology and the index, at the very end of the file.
+struct Footer
+{
+   uint64_t topologyOffset;
+   uint64_t topologyBytes;
+   uint64_t indexOffset;
+   uint64_t numIndexEntries;
+   uint64_t valueSize;
+};
+
+/// Contiguous part of the file that is read to the passed memory.
+struct Block
+{
+   uint64_t offset;
+   char*    data;
+   uint64_t bytes;
+};
+
+template < typename T >
+static void appendToBuffer( std::vector< char >& buffer, const T& value )
+{
+   const auto oldSize = buffer.size();
+   buffer.resize( oldSize + sizeof( T ) );
+   std::memcpy( buffer.data() + oldSize, &value, sizeof( T ) );
+}
+
+template < typename T >
+static T readFromBuffer( const std::vector< char >& buffer, uint64_t& position )
+{
+   WALBERLA_CHECK_LESS_EQUAL( position + sizeof( T ), buffer.size(), "[Checkpoint] Corrupt checkpoint header." );
+   T value;
+   std::memcpy( &value, buffer.data() + position, sizeof( T ) );
+   position += sizeof( T );
+   return value;
+}
+
+/// Thin wrapper around the file that is accessed via (collective) MPI-IO if available and via std::fstream otherwise.
+class File
+{
+ public:
+   File( const std::string& filename, const bool& write )
+   : filename_( filename )
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      comm_ = walberla::mpi::MPIManager::instance()->comm();
+      const int mode   = write ? ( MPI_MODE_WRONLY | MPI_MODE_CREATE ) : MPI_MODE_RDONLY;
+      const int result = MPI_File_open( comm_, const_cast< char* >( filename.c_str() ), mode, MPI_INFO_NULL, &file_ );
+      WALBERLA_CHECK_EQUAL( result, MPI_SUCCESS, "[Checkpoint] Error opening file: " << filename_ );
+      if ( write )
+      {
+         // truncate the file in case it already existed, before any process starts writing
+         MPI_File_set_size( file_, 0 );
+         MPI_Barrier( comm_ );
+      }
+#else
+      file_.open( filename.c_str(),
+                  write ? ( std::fstream::out | std::fstream::binary | std::fstream::trunc ) :
+                          ( std::fstream::in | std::fstream::binary ) );
+      WALBERLA_CHECK( !!file_, "[Checkpoint] Error opening file: " << filename );
+#endif
+   }
+
+   ~File()
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      MPI_File_close( &file_ );
+#else
+      file_.close();
+#endif
+   }
+
+   /// Collective write. All processes must call this function, possibly with zero bytes.
+   void writeAtAll( const uint64_t& offset, const char* data, const uint64_t& bytes )
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      const uint64_t numChunks = walberla::mpi::allReduce( ( bytes + maxChunkSize - 1 ) / maxChunkSize, walberla::mpi::MAX );
+      for ( uint64_t chunk = 0; chunk < numChunks; chunk++ )
+      {
+         const uint64_t chunkBegin = std::min( chunk * maxChunkSize, bytes );
+         const uint64_t chunkSize  = std::min( maxChunkSize, bytes - chunkBegin );
+         MPI_File_write_at_all( file_,
+                                MPI_Offset( offset + chunkBegin ),
+                                const_cast< char* >( data + chunkBegin ),
+                                int( chunkSize ),
+                                MPI_CHAR,
+                                MPI_STATUS_IGNORE );
+      }
+#else
+      writeAt( offset, data, bytes );
+#endif
+   }
+
+   /// Independent write.
+   void writeAt( const uint64_t& offset, const char* data, const uint64_t& bytes )
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      for ( uint64_t chunkBegin = 0; chunkBegin < bytes; chunkBegin += maxChunkSize )
+      {
+         const uint64_t chunkSize = std::min( maxChunkSize, bytes - chunkBegin );
+         MPI_File_write_at( file_,
+                            MPI_Offset( offset + chunkBegin ),
+                            const_cast< char* >( data + chunkBegin ),
+                            int( chunkSize ),
+                            MPI_CHAR,
+                            MPI_STATUS_IGNORE );
+      }
+#else
+      file_.seekp( static_cast< std::streamoff >( offset ) );
+      file_.write( data, static_cast< std::streamsize >( bytes ) );
+      WALBERLA_CHECK( !!file_, "[Checkpoint] Error writing file: " << filename_ );
+#endif
+   }
+
+   /// Collective read. All processes must call this function, possibly with zero bytes.
+   void readAtAll( const uint64_t& offset, char* data, const uint64_t& bytes )
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      const uint64_t numChunks = walberla::mpi::allReduce( ( bytes + maxChunkSize - 1 ) / maxChunkSize, walberla::mpi::MAX );
+      for ( uint64_t chunk = 0; chunk < numChunks; chunk++ )
+      {
+         const uint64_t chunkBegin = std::min( chunk * maxChunkSize, bytes );
+         const uint64_t chunkSize  = std::min( maxChunkSize, bytes - chunkBegin );
+         MPI_File_read_at_all(
+             file_, MPI_Offset( offset + chunkBegin ), data + chunkBegin, int( chunkSize ), MPI_CHAR, MPI_STATUS_IGNORE );
+      }
+#else
+      readAt( offset, data, bytes );
+#endif
+   }
+
+   /// Independent read.
+   void readAt( const uint64_t& offset, char* data, const uint64_t& bytes )
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      for ( uint64_t chunkBegin = 0; chunkBegin < bytes; chunkBegin += maxChunkSize )
+      {
+         const uint64_t chunkSize = std::min( maxChunkSize, bytes - chunkBegin );
+         MPI_File_read_at(
+             file_, MPI_Offset( offset + chunkBegin ), data + chunkBegin, int( chunkSize ), MPI_CHAR, MPI_STATUS_IGNORE );
+      }
+#else
+      file_.seekg( static_cast< std::streamoff >( offset ) );
+      file_.read( data, static_cast< std::streamsize >( bytes ) );
+      WALBERLA_CHECK( !!file_, "[Checkpoint] Error reading file: " << filename_ );
+#endif
+   }
+
+   /// Collective read of several blocks. All processes must call this function, possibly without any blocks.
+   /// The blocks of each process are combined to a file view, so that they are read with a single collective call
+   /// (per chunk of at most maxChunkSize bytes).
+   void readBlocksAll( const std::vector< Block >& blocks )
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      // the displacements of a file view must be sorted
+      std::vector< Block > pieces;
+      for ( const auto& block : blocks )
+      {
+         for ( uint64_t begin = 0; begin < block.bytes; begin += maxChunkSize )
+         {
+            pieces.push_back( {block.offset + begin, block.data + begin, std::min( maxChunkSize, block.bytes - begin )} );
+         }
+      }
+      std::sort( pieces.begin(), pieces.end(), []( const Block& a, const Block& b ) { return a.offset < b.offset; } );
+
+      std::vector< std::vector< Block > > chunks;
+      uint64_t                            chunkSize = maxChunkSize;
+      for ( const auto& piece : pieces )
+      {
+         if ( chunkSize + piece.bytes > maxChunkSize )
+         {
+            chunks.emplace_back();
+            chunkSize = 0;
+         }
+         chunks.back().push_back( piece );
+         chunkSize += piece.bytes;
+      }
+
+      const uint64_t numChunks = walberla::mpi::allReduce( uint64_c( chunks.size() ), walberla::mpi::MAX );
+      std::vector< char > buffer;
+      for ( uint64_t chunk = 0; chunk < numChunks; chunk++ )
+      {
+         std::vector< int >      blockLengths;
+         std::vector< MPI_Aint > displacements;
+         buffer.clear();
+         if ( chunk < chunks.size() )
+         {
+            for ( const auto& piece : chunks[chunk] )
+            {
+               blockLengths.push_back( int( piece.bytes ) );
+               displacements.push_back( MPI_Aint( piece.offset ) );
+            }
+            buffer.resize( std::accumulate( blockLengths.begin(), blockLengths.end(), size_t( 0 ) ) );
+         }
+
+         MPI_Datatype fileType;
+         MPI_Type_create_hindexed( int( blockLengths.size() ), blockLengths.data(), displacements.data(), MPI_CHAR, &fileType );
+         MPI_Type_commit( &fileType );
+         MPI_File_set_view( file_, 0, MPI_CHAR, fileType, const_cast< char* >( "native" ), MPI_INFO_NULL );
+         MPI_File_read_all( file_, buffer.data(), int( buffer.size() ), MPI_CHAR, MPI_STATUS_IGNORE );
+         MPI_File_set_view( file_, 0, MPI_CHAR, MPI_CHAR, const_cast< char* >( "native" ), MPI_INFO_NULL );
+         MPI_Type_free( &fileType );
+
+         if ( chunk < chunks.size() )
+         {
+            uint64_t position = 0;
+            for ( const auto& piece : chunks[chunk] )
+            {
+               std::memcpy( piece.data, buffer.data() + position, piece.bytes );
+               position += piece.bytes;
+            }
+         }
+      }
+#else
+      for ( const auto& block : blocks )
+      {
+         readAt( block.offset, block.data, block.bytes );
+      }
+#endif
+   }
+
+   uint64_t size()
+   {
+#ifdef WALBERLA_BUILD_WITH_MPI
+      MPI_Offset fileSize;
+      MPI_File_get_size( file_, &fileSize );
+      return uint64_c( fileSize );
+#else
+      file_.seekg( 0, std::fstream::end );
+      return uint64_c( file_.tellg() );
+#endif
+   }
+
+ private:
+   std::string filename_;
+#ifdef WALBERLA_BUILD_WITH_MPI
+   MPI_Comm comm_;
+   MPI_File file_;
+#else
+   std::fstream file_;
+#endif
+};
+
+static Footer readFooter( File& file, const std::string& filename )
+{
+   const uint64_t fileSize = file.size();
+   WALBERLA_CHECK_GREATER_EQUAL( fileSize, sizeof( Footer ), "[Checkpoint] Invalid checkpoint file: " << filename );
+
+   Footer footer;
+   file.readAtAll( fileSize - sizeof( Footer ), reinterpret_cast< char* >( &footer ), sizeof( Footer ) );
+   WALBERLA_CHECK_EQUAL(
+       footer.valueSize, sizeof( real_t ), "[Checkpoint] Checkpoint was written with a different floating point type." );
+   return footer;
+}
+
+static void appendIndexEntry( std::vector< uint64_t >& buffer, const IndexEntry& indexEntry )
+{
+   buffer.insert( buffer.end(),
+                  {indexEntry.entry, indexEntry.primitiveID, indexEntry.level, indexEntry.offset, indexEntry.size} );
+}
+
+static IndexEntry indexEntryFromBuffer( const std::vector< uint64_t >& buffer, const uint_t& position )
+{
+   return {buffer[position], buffer[position + 1], buffer[position + 2], buffer[position + 3], buffer[position + 4]};
+}
+
+static const uint_t indexEntryWords = 5;
+
+} // namespace checkpoint
+
+/// Returns an accessor to the function memory of functions that store data on all primitive types.
+template < typename FunctionType >
+static std::function< FunctionMemory< real_t >*( const PrimitiveID& ) >
+    memoryAccessor( const std::shared_ptr< PrimitiveStorage >& storage, const FunctionType& function )
+{
+   const auto vertexDataID = function.getVertexDataID();
+   const auto edgeDataID   = function.getEdgeDataID();
+   const auto faceDataID   = function.getFaceDataID();
+   const auto cellDataID   = function.getCellDataID();
+
+   return [storage, vertexDataID, edgeDataID, faceDataID, cellDataID]( const PrimitiveID& id ) -> FunctionMemory< real_t >* {
+      if ( storage->vertexExistsLocally( id ) )
+         return storage->getVertex( id )->getData( vertexDataID );
+      if ( storage->edgeExistsLocally( id ) )
+         return storage->getEdge( id )->getData( edgeDataID );
+      if ( storage->faceExistsLocally( id ) )
+         return storage->getFace( id )->getData( faceDataID );
+      if ( storage->cellExistsLocally( id ) )
+         return storage->getCell( id )->getData( cellDataID );
+      return nullptr;
+   };
+}
+
+FunctionCheckpoint::FunctionCheckpoint( const std::shared_ptr< PrimitiveStorage >& storage )
+: storage_( storage )
+{}
+
+void FunctionCheckpoint::addEntry( const std::string&    name,
+                                   const uint_t&         minLevel,
+                                   const uint_t&         maxLevel,
+                                   const MemoryAccessor& memory )
+{
+   entries_.push_back( {name, minLevel, maxLevel, memory} );
+}
+
+void FunctionCheckpoint::add( const P1Function< real_t >& function )
+{
+   addEntry( function.getFunctionName(), function.getMinLevel(), function.getMaxLevel(), memoryAccessor( storage_, function ) );
+}
+
+void FunctionCheckpoint::add( const P2Function< real_t >& function )
+{
+   addEntry( function.getFunctionName() + "_VertexDoF",
+             function.getMinLevel(),
+             function.getMaxLevel(),
+             memoryAccessor( storage_, function.getVertexDoFFunction() ) );
+   addEntry( function.getFunctionName() + "_EdgeDoF",
+             function.getMinLevel(),
+             function.getMaxLevel(),
+             memoryAccessor( storage_, function.getEdgeDoFFunction() ) );
+}
+
+void FunctionCheckpoint::add( const EdgeDoFFunction< real_t >& function )
+{
+   addEntry( function.getFunctionName(), function.getMinLevel(), function.getMaxLevel(), memoryAccessor( storage_, function ) );
+}
+
+void FunctionCheckpoint::add( const DGFunction< real_t >& function )
+{
+   const auto storage      = storage_;
+   const auto vertexDataID = function.getVertexDataID();
+   const auto edgeDataID   = function.getEdgeDataID();
+   const auto faceDataID   = function.getFaceDataID();
+
+   addEntry( function.getFunctionName(),
+             function.getMinLevel(),
+             function.getMaxLevel(),
+             [storage, vertexDataID, edgeDataID, faceDataID]( const PrimitiveID& id ) -> FunctionMemory< real_t >* {
+                if ( storage->vertexExistsLocally( id ) )
+                   return storage->getVertex( id )->getData( vertexDataID );
+                if ( storage->edgeExistsLocally( id ) )
+                   return storage->getEdge( id )->getData( edgeDataID );
+                if ( storage->faceExistsLocally( id ) )
+                   return storage->getFace( id )->getData( faceDataID );
+                return nullptr;
+             } );
+}
+
+void FunctionCheckpoint::add( const P1VectorFunction< real_t >& function )
+{
+   for ( uint_t component = 0; component < function.getDimension(); component++ )
+   {
+      add( function[component] );
+   }
+}
+
+void FunctionCheckpoint::add( const P2VectorFunction< real_t >& function )
+{
+   for ( uint_t component = 0; component < function.getDimension(); component++ )
+   {
+      add( function[component] );
+   }
+}
+
+void FunctionCheckpoint::add( const P1StokesFunction< real_t >& function )
+{
+   add( function.uvw );
+   add( function.p );
+}
+
+void FunctionCheckpoint::add( const P2P1TaylorHoodFunction< real_t >& function )
+{
+   add( function.uvw );
+   add( function.p );
+}
+
+/// The header is identical on all processes. It contains the registered functions and the global number of
+/// primitives per type, which is used to detect checkpoints of a different mesh.
+static std::vector< char > checkpointHeader( const PrimitiveStorage& storage,
+                                              const std::vector< std::tuple< std::string, uint_t, uint_t > >& entries )
+{
+   std::vector< char > header( checkpoint::magic, checkpoint::magic + sizeof( checkpoint::magic ) );
+
+   checkpoint::appendToBuffer( header, uint64_c( storage.getNumberOfGlobalVertices() ) );
+   checkpoint::appendToBuffer( header, uint64_c( storage.getNumberOfGlobalEdges() ) );
+   checkpoint::appendToBuffer( header, uint64_c( storage.getNumberOfGlobalFaces() ) );
+   checkpoint::appendToBuffer( header, uint64_c( storage.getNumberOfGlobalCells() ) );
+
+   checkpoint::appendToBuffer( header, uint64_c( entries.size() ) );
+   for ( const auto& entry : entries )
+   {
+      const auto& name = std::get< 0 >( entry );
+      checkpoint::appendToBuffer( header, uint64_c( name.size() ) );
+      header.insert( header.end(), name.begin(), name.end() );
+      checkpoint::appendToBuffer( header, uint64_c( std::get< 1 >( entry ) ) );
+      checkpoint::appendToBuffer( header, uint64_c( std::get< 2 >( entry ) ) );
+   }
+
+   return header;
+}
+
+void FunctionCheckpoint::write( const std::string& filename ) const
+{
+   storage_->getTimingTree()->start( "Checkpoint write" );
+
+   std::vector< std::tuple< std::string, uint_t, uint_t > > entryInfo;
+   for ( const auto& entry : entries_ )
+   {
+      entryInfo.emplace_back( entry.name, entry.minLevel, entry.maxLevel );
+   }
+   const std::vector< char > header = checkpointHeader( *storage_, entryInfo );
+
+   // collect the process local data and the respective index entries (with offsets relative to the local data)
+   std::vector< PrimitiveID > primitiveIDs;
+   storage_->getPrimitiveIDs( primitiveIDs );
+
+   std::vector< real_t >                 localData;
+   std::vector< checkpoint::IndexEntry > localIndex;
+
+   for ( uint_t entryIdx = 0; entryIdx < entries_.size(); entryIdx++ )
+   {
+      const auto& entry = entries_[entryIdx];
+      for ( const auto& primitiveID : primitiveIDs )
+      {
+         const auto memory = entry.memory( primitiveID );
+         if ( memory == nullptr )
+         {
+            continue;
+         }
+         for ( uint_t level = entry.minLevel; level <= entry.maxLevel; level++ )
+         {
+            if ( !memory->hasLevel( level ) )
+            {
+               continue;
+            }
+            const uint_t size = memory->getSize( level );
+            localIndex.push_back( {uint64_c( entryIdx ),
+                                   uint64_c( primitiveID.getID() ),
+                                   uint64_c( level ),
+                                   uint64_c( localData.size() * sizeof( real_t ) ),
+                                   uint64_c( size )} );
+            localData.insert( localData.end(), memory->getPointer( level ), memory->getPointer( level ) + size );
+         }
+      }
+   }
+
+   // the topology consists of the local primitives of all processes
+   walberla::mpi::SendBuffer topology;
+   topology << uint64_c( storage_->getVertices().size() );
+   for ( const auto& it : storage_->getVertices() )
+   {
+      it.second->serialize( topology );
+   }
+   topology << uint64_c( storage_->getEdges().size() );
+   for ( const auto& it : storage_->getEdges() )
+   {
+      it.second->serialize( topology );
+   }
+   topology << uint64_c( storage_->getFaces().size() );
+   for ( const auto& it : storage_->getFaces() )
+   {
+      it.second->serialize( topology );
+   }
+   topology << uint64_c( storage_->getCells().size() );
+   for ( const auto& it : storage_->getCells() )
+   {
+      it.second->serialize( topology );
+   }
+
+   // layout: header | topology of all processes | data of all processes | index of all processes | footer
+   const uint64_t localTopologyBytes = uint64_c( topology.size() );
+   const uint64_t localDataBytes     = uint64_c( localData.size() * sizeof( real_t ) );
+   const uint64_t localIndexBytes    = uint64_c( localIndex.size() * sizeof( checkpoint::IndexEntry ) );
+
+   uint64_t topologyOffset      = 0;
+   uint64_t dataOffset          = 0;
+   uint64_t indexOffset         = 0;
+   uint64_t globalTopologyBytes = localTopologyBytes;
+   uint64_t globalDataBytes     = localDataBytes;
+   uint64_t numIndexEntries     = uint64_c( localIndex.size() );
+
+#ifdef WALBERLA_BUILD_WITH_MPI
+   globalTopologyBytes = walberla::mpi::allReduce( localTopologyBytes, walberla::mpi::SUM );
+   globalDataBytes     = walberla::mpi::allReduce( localDataBytes, walberla::mpi::SUM );
+   numIndexEntries     = walberla::mpi::allReduce( numIndexEntries, walberla::mpi::SUM );
+
+   uint64_t localSizes[3] = {localTopologyBytes, localDataBytes, localIndexBytes};
+   uint64_t offsets[3]    = {0, 0, 0};
+   MPI_Exscan( localSizes, offsets, 3, MPI_UINT64_T, MPI_SUM, walberla::mpi::MPIManager::instance()->comm() );
+   // the result of MPI_Exscan is undefined on the first process
+   if ( walberla::mpi::MPIManager::instance()->rank() != 0 )
+   {
+      topologyOffset = offsets[0];
+      dataOffset     = offsets[1];
+      indexOffset    = offsets[2];
+   }
+#endif
+
+   const uint64_t topologyBegin = uint64_c( header.size() );
+   const uint64_t dataBegin     = topologyBegin + globalTopologyBytes;
+   const uint64_t indexBegin    = dataBegin + globalDataBytes;
+   const uint64_t footerBegin = indexBegin + numIndexEntries * sizeof( checkpoint::IndexEntry );
+
+   for ( auto& indexEntry : localIndex )
+   {
+      indexEntry.offset += dataBegin + dataOffset;
+   }
+
+   checkpoint::File file( filename, true );
+
+   WALBERLA_ROOT_SECTION()
+   {
+      file.writeAt( 0, header.data(), header.size() );
+   }
+
+   file.writeAtAll( topologyBegin + topologyOffset, reinterpret_cast< const char* >( topology.ptr() ), localTopologyBytes );
+   file.writeAtAll( dataBegin + dataOffset, reinterpret_cast< const char* >( localData.data() ), localDataBytes );
+   file.writeAtAll( indexBegin + indexOffset, reinterpret_cast< const char* >( localIndex.data() ), localIndexBytes );
+
+   WALBERLA_ROOT_SECTION()
+   {
+      const checkpoint::Footer footer = {
+          topologyBegin, globalTopologyBytes, indexBegin, numIndexEntries, uint64_c( sizeof( real_t ) )};
+      file.writeAt( footerBegin, reinterpret_cast< const char* >( &footer ), sizeof( checkpoint::Footer ) );
+   }
+
+   storage_->getTimingTree()->stop( "Checkpoint write" );
+}
+
+void FunctionCheckpoint::restore( const std::string& filename ) const
+{
+   storage_->getTimingTree()->start( "Checkpoint restore" );
+
+   checkpoint::File         file( filename, false );
+   const checkpoint::Footer footer = checkpoint::readFooter( file, filename );
+
+   // the header is small and located in front of the data, compare it with the header of the registered functions
+   std::vector< std::tuple< std::string, uint_t, uint_t > > entryInfo;
+   for ( const auto& entry : entries_ )
+   {
+      entryInfo.emplace_back( entry.name, entry.minLevel, entry.maxLevel );
+   }
+   const std::vector< char > expectedHeader = checkpointHeader( *storage_, entryInfo );
+
+   WALBERLA_CHECK_LESS_EQUAL(
+       expectedHeader.size(), footer.topologyOffset, "[Checkpoint] Checkpoint does not match the registered functions." );
+   std::vector< char > header( expectedHeader.size() );
+   file.readAtAll( 0, header.data(), header.size() );
+
+   WALBERLA_CHECK( std::equal( checkpoint::magic, checkpoint::magic + sizeof( checkpoint::magic ), header.begin() ),
+                   "[Checkpoint] Invalid checkpoint file: " << filename );
+   uint64_t expectedPosition = sizeof( checkpoint::magic );
+   uint64_t position         = sizeof( checkpoint::magic );
+   for ( const auto& primitiveType : {"vertices", "edges", "faces", "cells"} )
+   {
+      const uint64_t expected = checkpoint::readFromBuffer< uint64_t >( expectedHeader, expectedPosition );
+      const uint64_t actual   = checkpoint::readFromBuffer< uint64_t >( header, position );
+      WALBERLA_CHECK_EQUAL( actual,
+                            expected,
+                            "[Checkpoint] Number of global " << primitiveType
+                                                             << " does not match. Was the checkpoint written for a different mesh?" );
+   }
+   WALBERLA_CHECK( header == expectedHeader,
+                   "[Checkpoint] Checkpoint does not match the registered functions. "
+                   "Functions must be added in the same order with the same names and levels as during the write." );
+
+   // Each process reads an equally sized part of the index and forwards the entries to the process that serves as
+   // directory for the respective primitive (primitive ID modulo the number of processes). The processes request the
+   // entries of their local primitives from the directories, so that no process has to read the complete index.
+   const auto     comm         = walberla::mpi::MPIManager::instance()->comm();
+   const auto     rank         = walberla::mpi::MPIManager::instance()->rank();
+   const uint64_t numProcesses = uint64_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   const uint64_t indexBegin = footer.numIndexEntries * uint64_c( rank ) / numProcesses;
+   const uint64_t indexEnd   = footer.numIndexEntries * ( uint64_c( rank ) + 1 ) / numProcesses;
+
+   std::vector< checkpoint::IndexEntry > indexPart( indexEnd - indexBegin );
+   file.readAtAll( footer.indexOffset + indexBegin * sizeof( checkpoint::IndexEntry ),
+                   reinterpret_cast< char* >( indexPart.data() ),
+                   indexPart.size() * sizeof( checkpoint::IndexEntry ) );
+
+   auto directoryOf = [numProcesses]( const uint64_t& primitiveID ) {
+      return walberla::mpi::MPIRank( primitiveID % numProcesses );
+   };
+
+   std::vector< PrimitiveID > primitiveIDs;
+   storage_->getPrimitiveIDs( primitiveIDs );
+
+   std::map< walberla::mpi::MPIRank, std::vector< uint64_t > > entriesToDirectory;
+   std::map< walberla::mpi::MPIRank, std::vector< uint64_t > > requestsToDirectory;
+   for ( const auto& indexEntry : indexPart )
+   {
+      checkpoint::appendIndexEntry( entriesToDirectory[directoryOf( indexEntry.primitiveID )], indexEntry );
+   }
+   for ( const auto& primitiveID : primitiveIDs )
+   {
+      requestsToDirectory[directoryOf( primitiveID.getID() )].push_back( uint64_c( primitiveID.getID() ) );
+   }
+
+   std::map< uint64_t, std::vector< checkpoint::IndexEntry > > directory;
+   std::map< walberla::mpi::MPIRank, std::vector< uint64_t > > requestsFromProcesses;
+
+   auto addToDirectory = [&]( const walberla::mpi::MPIRank&  sender,
+                              const std::vector< uint64_t >& entries,
+                              const std::vector< uint64_t >& requests ) {
+      for ( uint_t i = 0; i < entries.size(); i += checkpoint::indexEntryWords )
+      {
+         const auto indexEntry = checkpoint::indexEntryFromBuffer( entries, i );
+         directory[indexEntry.primitiveID].push_back( indexEntry );
+      }
+      auto& requestsFromSender = requestsFromProcesses[sender];
+      requestsFromSender.insert( requestsFromSender.end(), requests.begin(), requests.end() );
+   };
+
+   walberla::mpi::BufferSystem directoryBufferSystem( comm );
+   std::set< walberla::mpi::MPIRank > directoryRanks;
+   for ( const auto& it : entriesToDirectory )
+   {
+      directoryRanks.insert( it.first );
+   }
+   for ( const auto& it : requestsToDirectory )
+   {
+      directoryRanks.insert( it.first );
+   }
+   for ( const auto& directoryRank : directoryRanks )
+   {
+      if ( directoryRank != rank )
+      {
+         auto& buffer = directoryBufferSystem.sendBuffer( directoryRank );
+         buffer << entriesToDirectory[directoryRank] << requestsToDirectory[directoryRank];
+      }
+   }
+   directoryBufferSystem.setReceiverInfoFromSendBufferState( false, true );
+   directoryBufferSystem.sendAll();
+
+   addToDirectory( rank, entriesToDirectory[rank], requestsToDirectory[rank] );
+   for ( auto i = directoryBufferSystem.begin(); i != directoryBufferSystem.end(); ++i )
+   {
+      std::vector< uint64_t > entries;
+      std::vector< uint64_t > requests;
+      i.buffer() >> entries >> requests;
+      addToDirectory( i.rank(), entries, requests );
+   }
+
+   // reply the index entries of the requested primitives
+   std::map< std::tuple< uint64_t, uint64_t, uint64_t >, checkpoint::IndexEntry > localIndex;
+
+   auto addToLocalIndex = [&localIndex]( const std::vector< uint64_t >& entries ) {
+      for ( uint_t i = 0; i < entries.size(); i += checkpoint::indexEntryWords )
+      {
+         const auto indexEntry = checkpoint::indexEntryFromBuffer( entries, i );
+         localIndex[std::make_tuple( indexEntry.entry, indexEntry.primitiveID, indexEntry.level )] = indexEntry;
+      }
+   };
+
+   walberla::mpi::BufferSystem replyBufferSystem( comm );
+   std::set< walberla::mpi::MPIRank > ranksToReceiveRepliesFrom;
+   for ( const auto& it : requestsToDirectory )
+   {
+      if ( it.first != rank )
+      {
+         ranksToReceiveRepliesFrom.insert( it.first );
+      }
+   }
+   for ( const auto& it : requestsFromProcesses )
+   {
+      std::vector< uint64_t > entries;
+      for ( const auto& primitiveID : it.second )
+      {
+         for ( const auto& indexEntry : directory[primitiveID] )
+         {
+            checkpoint::appendIndexEntry( entries, indexEntry );
+         }
+      }
+      if ( it.first == rank )
+      {
+         addToLocalIndex( entries );
+      }
+      else
+      {
+         replyBufferSystem.sendBuffer( it.first ) << entries;
+      }
+   }
+   replyBufferSystem.setReceiverInfo( ranksToReceiveRepliesFrom, true );
+   replyBufferSystem.sendAll();
+
+   for ( auto i = replyBufferSystem.begin(); i != replyBufferSystem.end(); ++i )
+   {
+      std::vector< uint64_t > entries;
+      i.buffer() >> entries;
+      addToLocalIndex( entries );
+   }
+
+   // read the data of all local primitives with a single collective call
+   std::vector< checkpoint::Block > blocks;
+   for ( uint_t entryIdx = 0; entryIdx < entries_.size(); entryIdx++ )
+   {
+      const auto& entry = entries_[entryIdx];
+      for ( const auto& primitiveID : primitiveIDs )
+      {
+         const auto memory = entry.memory( primitiveID );
+         if ( memory == nullptr )
+         {
+            continue;
+         }
+         for ( uint_t level = entry.minLevel; level <= entry.maxLevel; level++ )
+         {
+            if ( !memory->hasLevel( level ) )
+            {
+               continue;
+            }
+            const auto it =
+                localIndex.find( std::make_tuple( uint64_c( entryIdx ), uint64_c( primitiveID.getID() ), uint64_c( level ) ) );
+            WALBERLA_CHECK( it != localIndex.end(),
+                            "[Checkpoint] No data for function " << entry.name << " on primitive " << primitiveID << " on level "
+                                                                 << level );
+            WALBERLA_CHECK_EQUAL( it->second.size, memory->getSize( level ), "[Checkpoint] Data size does not match." );
+            blocks.push_back( {it->second.offset,
+                               reinterpret_cast< char* >( memory->getPointer( level ) ),
+                               it->second.size * sizeof( real_t )} );
+         }
+      }
+   }
+   file.readBlocksAll( blocks );
+
+   storage_->getTimingTree()->stop( "Checkpoint restore" );
+}
+
+std::shared_ptr< SetupPrimitiveStorage > FunctionCheckpoint::readSetupStorage( const std::string& filename,
+                                                                                const uint_t&      numberOfProcesses )
+{
+   checkpoint::File         file( filename, false );
+   const checkpoint::Footer footer = checkpoint::readFooter( file, filename );
+
+   // the SetupPrimitiveStorage is replicated on all processes, therefore all processes read the complete topology
+   walberla::mpi::RecvBuffer topology;
+   topology.resize( footer.topologyBytes );
+   file.readAtAll( footer.topologyOffset, reinterpret_cast< char* >( topology.ptr() ), footer.topologyBytes );
+
+   SetupPrimitiveStorage::VertexMap vertices;
+   SetupPrimitiveStorage::EdgeMap   edges;
+   SetupPrimitiveStorage::FaceMap   faces;
+   SetupPrimitiveStorage::CellMap   cells;
+
+   // the topology consists of the primitives of all processes that wrote the checkpoint
+   while ( !topology.isEmpty() )
+   {
+      uint64_t numPrimitives;
+      topology >> numPrimitives;
+      for ( uint64_t i = 0; i < numPrimitives; i++ )
+      {
+         auto vertex                       = std::make_shared< Vertex >( topology );
+         vertices[vertex->getID().getID()] = vertex;
+      }
+      topology >> numPrimitives;
+      for ( uint64_t i = 0; i < numPrimitives; i++ )
+      {
+         auto edge                    = std::make_shared< Edge >( topology );
+         edges[edge->getID().getID()] = edge;
+      }
+      topology >> numPrimitives;
+      for ( uint64_t i = 0; i < numPrimitives; i++ )
+      {
+         auto face                    = std::make_shared< Face >( topology );
+         faces[face->getID().getID()] = face;
+      }
+      topology >> numPrimitives;
+      for ( uint64_t i = 0; i < numPrimitives; i++ )
+      {
+         auto cell                    = std::make_shared< Cell >( topology );
+         cells[cell->getID().getID()] = cell;
+      }
+   }
+
+   return std::make_shared< SetupPrimitiveStorage >( vertices, edges, faces, cells, numberOfProcesses );
+}
+
+} // namespace hyteg
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/FunctionMemory.hpp"
+#include "hyteg/PrimitiveID.hpp"
+#include "hyteg/composites/P1StokesFunction.hpp"
+#include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
+#include "hyteg/dgfunctionspace/DGFunction.hpp"
+#include "hyteg/edgedofspace/EdgeDoFFunction.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+class PrimitiveStorage;
+class SetupPrimitiveStorage;
+
+/// \brief Checkpoint-restart of functions via parallel I/O.
+///
+/// Writes the data of all registered functions on all levels to a single binary file using collective MPI-IO.
+/// The data is stored per macro-primitive and indexed by the global PrimitiveID. Additionally, the topology of the
+/// PrimitiveStorage (i.e. all macro-primitives including their neighborhood, mesh boundary flags and geometry maps)
+/// is stored. Therefore, a checkpoint can be restored on a different number of processes and with a different
+/// distribution of the primitives.
+///
+/// Usage:
+///
+///   FunctionCheckpoint checkpoint( storage );
+///   checkpoint.add( u );
+///   checkpoint.add( c );
+///   checkpoint.write( "checkpoint.dat" );
+///
+/// and after the restart:
+///
+///   auto setupStorage = FunctionCheckpoint::readSetupStorage( "checkpoint.dat", numProcesses );
+///   loadbalancing::roundRobin( *setupStorage ); // or any other load balancing routine
+///   auto storage = std::make_shared< PrimitiveStorage >( *setupStorage );
+///
+///   FunctionCheckpoint checkpoint( storage );
+///   checkpoint.add( u );
+///   checkpoint.add( c );
+///   checkpoint.restore( "checkpoint.dat" );
+///
+/// The functions must be added in the same order, with the same names and the same levels as during write().
+/// Instead of reading the topology from the checkpoint, the PrimitiveStorage can also be created from the same mesh,
+/// which results in the same PrimitiveIDs. The global number of primitives of each type is stored in the file and
+/// checked during the restore.
+class FunctionCheckpoint
+{
+ public:
+   explicit FunctionCheckpoint( const std::shared_ptr< PrimitiveStorage >& storage );
+
+   void add( const P1Function< real_t >& function );
+   void add( const P2Function< real_t >& function );
+
+   void add( const EdgeDoFFunction< real_t >& function );
+   void add( const DGFunction< real_t >& function );
+
+   void add( const P1VectorFunction< real_t >& function );
+   void add( const P2VectorFunction< real_t >& function );
+
+   void add( const P1StokesFunction< real_t >& function );
+   void add( const P2P1TaylorHoodFunction< real_t >& function );
+
+   /// Writes the data of all registered functions to the specified file.
+   /// Collective call, existing files are overwritten.
+   void write( const std::string& filename ) const;
+
+   /// Reads the data of all registered functions from the specified file.
+   /// Collective call. Each process only reads the index entries and the data of its local primitives.
+   /// Since the complete function memory (including the ghost layers) of each primitive is stored, no communication
+   /// is required afterwards.
+   void restore( const std::string& filename ) const;
+
+   /// Reads the topology of the PrimitiveStorage from the specified checkpoint file.
+   /// Collective call. The returned SetupPrimitiveStorage distributes the primitives round robin to the passed number
+   /// of processes and can be re-balanced with the loadbalancing routines before the PrimitiveStorage is created.
+   static std::shared_ptr< SetupPrimitiveStorage > readSetupStorage( const std::string& filename,
+                                                                     const uint_t&      numberOfProcesses );
+
+ private:
+   typedef std::function< FunctionMemory< real_t >*( const PrimitiveID& ) > MemoryAccessor;
+
+   /// Data of a single function that is stored in FunctionMemory on the macro-primitives.
+   struct Entry
+   {
+      std::string name;
+      uint_t      minLevel;
+      uint_t      maxLevel;
+      /// returns the function memory on the local primitive with the passed ID, or nullptr if there is none
+      MemoryAccessor memory;
+   };
+
+   void addEntry( const std::string& name, const uint_t& minLevel, const uint_t& maxLevel, const MemoryAccessor& memory );
+
+   std::shared_ptr< PrimitiveStorage > storage_;
+   std::vector< Entry >                entries_;
+};
+
+} // namespace hyteg
@@ -19,7 +19,12 @@
  */
 #include "hyteg/dataexport/VTKOutput.hpp"
 
+#include <iomanip>
+#include <limits>
+#include <memory>
+
 #include "core/Format.hpp"
+#include "core/mpi/MPIManager.h"
 
 #include "hyteg/Levelinfo.hpp"
 #include "hyteg/celldofspace/CellDoFIndexing.hpp"
@@ -36,6 +41,7 @@
 
 namespace hyteg {
 
+using walberla::int_c;
 using walberla::real_c;
 
 static void writeXMLHeader( std::ostream& output )
@@ -43,7 +49,7 @@ static void writeXMLHeader( std::ostream& output )
    WALBERLA_ROOT_SECTION()
    {
       output << "<?xml version=\"1.0\"?>\n";
-      output << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\">\n";
+      output << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
       output << " <UnstructuredGrid>\n";
    }
 }
@@ -73,16 +79,140 @@ static void writePieceFooter( std::ostream& output )
 static void writePointsHeader( std::ostream& output )
 {
    output << "<Points>\n";
-   output << "<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"ascii\">\n";
-   // VTKOutput::openDataElement( output, "Float64", "", 3, VTKOutput::VTK_DATA_FORMAT::ASCII );
 }
 
 static void writePointsFooter( std::ostream& output )
 {
-   output << "\n</DataArray>\n";
    output << "</Points>\n";
 }
 
+/// Writes the data of all local macro-primitives of the passed type to the stream.
+///
+/// The macro-primitives are formatted in parallel, each into a separate stream writer. These are appended to the
+/// destination stream in the order of the primitive IDs, so that the output does not depend on the number of threads.
+template < typename PrimitiveType, typename dtype, typename PrimitiveWriter_T >
+static void writeMacroPrimitivesInParallel( vtk::VTKStreamWriter< dtype >&             dstStream,
+                                            const vtk::DataFormat&                     vtkDataFormat,
+                                            const std::shared_ptr< PrimitiveStorage >& storage,
+                                            const PrimitiveWriter_T&                   writePrimitive )
+{
+   std::vector< PrimitiveID > primitiveIDs;
+   storage->getPrimitiveIDsGenerically< PrimitiveType >( primitiveIDs );
+
+   std::vector< std::unique_ptr< vtk::VTKStreamWriter< dtype > > > primitiveStreams( primitiveIDs.size() );
+
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int i = 0; i < int_c( primitiveIDs.size() ); i++ )
+   {
+      primitiveStreams[uint_c( i )].reset( new vtk::VTKStreamWriter< dtype >( vtkDataFormat ) );
+      writePrimitive( *storage->getPrimitiveGenerically< PrimitiveType >( primitiveIDs[uint_c( i )] ),
+                      *primitiveStreams[uint_c( i )] );
+   }
+
+   for ( const auto& primitiveStream : primitiveStreams )
+   {
+      dstStream.append( *primitiveStream );
+   }
+}
+
+/// Number of digits of the offset attributes in APPENDED format.
+/// The offsets are padded with zeros so that they can be shifted in place once the offsets of all processes are known.
+static const int appendedOffsetWidth = 20;
+
+/// Writes a VTK file with raw appended data via collective MPI-IO.
+///
+/// The file contains the XML parts of all processes in rank order, followed by the appended data of all processes
+/// in rank order. The offsets in the XML part of each process are shifted by the size of the appended data of all
+/// processes with lower rank.
+static void writeAppendedFile( const std::string&                                  filePath,
+                               std::string                                         xmlPart,
+                               const std::vector< std::pair< size_t, uint64_t > >& offsetPositions,
+                               const std::vector< char >&                          appendedData )
+{
+   const std::string appendedDataHeader = " </UnstructuredGrid>\n <AppendedData encoding=\"raw\">\n_";
+   const std::string appendedDataFooter = "\n </AppendedData>\n</VTKFile>\n";
+
+   uint64_t localSizes[2]  = {xmlPart.size(), appendedData.size()};
+   uint64_t offsets[2]     = {0, 0};
+   uint64_t globalSizes[2] = {localSizes[0], localSizes[1]};
+
+#ifdef WALBERLA_BUILD_WITH_MPI
+   MPI_Comm comm = walberla::mpi::MPIManager::instance()->comm();
+   MPI_Exscan( localSizes, offsets, 2, MPI_UINT64_T, MPI_SUM, comm );
+   MPI_Allreduce( localSizes, globalSizes, 2, MPI_UINT64_T, MPI_SUM, comm );
+   // the result of MPI_Exscan is undefined on the first process
+   WALBERLA_ROOT_SECTION()
+   {
+      offsets[0] = 0;
+      offsets[1] = 0;
+   }
+#endif
+
+   for ( const auto& offsetPosition : offsetPositions )
+   {
+      std::ostringstream shiftedOffset;
+      shiftedOffset << std::setw( appendedOffsetWidth ) << std::setfill( '0' ) << offsets[1] + offsetPosition.second;
+      xmlPart.replace( offsetPosition.first, uint_c( appendedOffsetWidth ), shiftedOffset.str() );
+   }
+
+   const uint64_t appendedDataBegin = globalSizes[0] + appendedDataHeader.size();
+
+#ifdef WALBERLA_BUILD_WITH_MPI
+   WALBERLA_CHECK_LESS_EQUAL( xmlPart.size(), uint64_t( std::numeric_limits< int >::max() ) );
+   WALBERLA_CHECK_LESS_EQUAL( appendedData.size(), uint64_t( std::numeric_limits< int >::max() ) );
+
+   MPI_File file;
+   const int result =
+       MPI_File_open( comm, const_cast< char* >( filePath.c_str() ), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+   WALBERLA_CHECK_EQUAL( result, MPI_SUCCESS, "[VTKWriter] Error opening file: " << filePath );
+
+   // truncate the file in case it already existed
+   MPI_File_set_size( file, 0 );
+
+   MPI_File_write_at_all( file,
+                          MPI_Offset( offsets[0] ),
+                          const_cast< char* >( xmlPart.data() ),
+                          int( xmlPart.size() ),
+                          MPI_CHAR,
+                          MPI_STATUS_IGNORE );
+   MPI_File_write_at_all( file,
+                          MPI_Offset( appendedDataBegin + offsets[1] ),
+                          const_cast< char* >( appendedData.data() ),
+                          int( appendedData.size() ),
+                          MPI_CHAR,
+                          MPI_STATUS_IGNORE );
+
+   WALBERLA_ROOT_SECTION()
+   {
+      MPI_File_write_at( file,
+                         MPI_Offset( globalSizes[0] ),
+                         const_cast< char* >( appendedDataHeader.data() ),
+                         int( appendedDataHeader.size() ),
+                         MPI_CHAR,
+                         MPI_STATUS_IGNORE );
+      MPI_File_write_at( file,
+                         MPI_Offset( appendedDataBegin + globalSizes[1] ),
+                         const_cast< char* >( appendedDataFooter.data() ),
+                         int( appendedDataFooter.size() ),
+                         MPI_CHAR,
+                         MPI_STATUS_IGNORE );
+   }
+
+   MPI_File_close( &file );
+#else
+   WALBERLA_UNUSED( appendedDataBegin );
+
+   std::ofstream file( filePath.c_str(), std::ofstream::out | std::ofstream::binary );
+   WALBERLA_CHECK( !!file, "[VTKWriter] Error opening file: " << filePath );
+   file << xmlPart << appendedDataHeader;
+   file.write( appendedData.data(), static_cast< std::streamsize >( appendedData.size() ) );
+   file << appendedDataFooter;
+   file.close();
+#endif
+}
+
 VTKOutput::VTKOutput( std::string                                dir,
                       std::string                                filename,
                       const std::shared_ptr< PrimitiveStorage >& storage,
@@ -91,6 +221,7 @@ VTKOutput::VTKOutput( std::string                                dir,
 , filename_( std::move( filename ) )
 , writeFrequency_( writeFrequency )
 , write2D_( true )
+, vtkDataFormat_( vtk::DataFormat::ASCII )
 , storage_( storage )
 {
    /// set output to 3D is storage contains cells
@@ -144,87 +275,82 @@ void VTKOutput::add( P2P1TaylorHoodFunction< real_t > function )
    add( function.p );
 }
 
-void VTKOutput::writeVertexDoFData( std::ostream&                                 output,
+template < typename dtype >
+void VTKOutput::closeDataElement( std::ostream& output, vtk::VTKStreamWriter< dtype >& streamWriter ) const
+{
+   streamWriter.toStream( output, appendedData_ );
+   output << "\n</DataArray>\n";
+}
+
+void VTKOutput::writeVertexDoFData( vtk::VTKStreamWriter< real_t >&               dstStream,
                                     const vertexdof::VertexDoFFunction< real_t >& function,
                                     const std::shared_ptr< PrimitiveStorage >&    storage,
                                     const uint_t&                                 level ) const
 {
    if ( write2D_ )
    {
-      for ( const auto& it : storage->getFaces() )
-      {
-         const Face& face = *it.second;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          size_t len = levelinfo::num_microvertices_per_face( level );
-         output << std::scientific;
 
          for ( size_t i = 0; i < len; ++i )
          {
-            output << face.getData( function.getFaceDataID() )->getPointer( level )[i] << " ";
+            primitiveStream << face.getData( function.getFaceDataID() )->getPointer( level )[i];
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( dstStream, vtkDataFormat_, storage, writeFace );
    }
    else
    {
-      for ( const auto& it : storage->getCells() )
-      {
-         const Cell& cell     = *it.second;
-         const auto  cellData = cell.getData( function.getCellDataID() )->getPointer( level );
-
-         output << std::scientific;
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
+         const auto cellData = cell.getData( function.getCellDataID() )->getPointer( level );
 
          for ( const auto& idxIt : vertexdof::macrocell::Iterator( level ) )
          {
-            output << cellData[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )] << " ";
+            primitiveStream << cellData[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )];
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( dstStream, vtkDataFormat_, storage, writeCell );
    }
 }
 
-void VTKOutput::writeP1VectorFunctionData( std::ostream&                              output,
+void VTKOutput::writeP1VectorFunctionData( vtk::VTKStreamWriter< real_t >&             dstStream,
                                            const P1VectorFunction< real_t >&          function,
                                            const std::shared_ptr< PrimitiveStorage >& storage,
                                            const uint_t&                              level ) const
 {
    if ( write2D_ )
    {
-      for ( const auto& it : storage->getFaces() )
-      {
-         const Face& face = *it.second;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          size_t len = levelinfo::num_microvertices_per_face( level );
-         output << std::scientific;
 
          for ( size_t i = 0; i < len; ++i )
          {
-            output << face.getData( function[0].getFaceDataID() )->getPointer( level )[i] << " ";
-            output << face.getData( function[1].getFaceDataID() )->getPointer( level )[i] << " ";
-            // output << real_t(0) << " "; Paraview needs 3D vector fields to form glyphs
+            primitiveStream << face.getData( function[0].getFaceDataID() )->getPointer( level )[i];
+            primitiveStream << face.getData( function[1].getFaceDataID() )->getPointer( level )[i];
+            // primitiveStream << real_t(0); Paraview needs 3D vector fields to form glyphs
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( dstStream, vtkDataFormat_, storage, writeFace );
    }
    else
    {
-      for ( const auto& it : storage->getCells() )
-      {
-         const Cell& cell      = *it.second;
-         const auto  cellData0 = cell.getData( function[0].getCellDataID() )->getPointer( level );
-         const auto  cellData1 = cell.getData( function[1].getCellDataID() )->getPointer( level );
-         const auto  cellData2 = cell.getData( function[2].getCellDataID() )->getPointer( level );
-
-         output << std::scientific;
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
+         const auto cellData0 = cell.getData( function[0].getCellDataID() )->getPointer( level );
+         const auto cellData1 = cell.getData( function[1].getCellDataID() )->getPointer( level );
+         const auto cellData2 = cell.getData( function[2].getCellDataID() )->getPointer( level );
 
          for ( const auto& idxIt : vertexdof::macrocell::Iterator( level ) )
          {
-            output << cellData0[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )] << " ";
-            output << cellData1[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )] << " ";
-            output << cellData2[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )] << " ";
+            primitiveStream << cellData0[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )];
+            primitiveStream << cellData1[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )];
+            primitiveStream << cellData2[vertexdof::macrocell::index( level, idxIt.x(), idxIt.y(), idxIt.z() )];
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( dstStream, vtkDataFormat_, storage, writeCell );
    }
 }
 
-void VTKOutput::writeEdgeDoFData( std::ostream&                              output,
+void VTKOutput::writeEdgeDoFData( vtk::VTKStreamWriter< real_t >&             dstStream,
                                   const EdgeDoFFunction< real_t >&           function,
                                   const std::shared_ptr< PrimitiveStorage >& storage,
                                   const uint_t&                              level,
@@ -237,21 +363,15 @@ void VTKOutput::writeEdgeDoFData( std::ostream&                              out
 
    if ( write2D_ )
    {
-      for ( const auto& it : storage->getFaces() )
-      {
-         const Face& face = *it.second;
-
-         output << std::scientific;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          switch ( dofType )
          {
          case VTKOutput::DoFType::EDGE_X:
          {
             for ( const auto& itIdx : edgedof::macroface::Iterator( level ) )
             {
-               output << face.getData( function.getFaceDataID() )
-                             ->getPointer( level )[edgedof::macroface::horizontalIndex( level, itIdx.col(), itIdx.row() )]
-                      << "\n";
+               primitiveStream << face.getData( function.getFaceDataID() )
+                                   ->getPointer( level )[edgedof::macroface::horizontalIndex( level, itIdx.col(), itIdx.row() )];
             }
             break;
          }
@@ -259,9 +379,8 @@ void VTKOutput::writeEdgeDoFData( std::ostream&                              out
          {
             for ( const auto& itIdx : edgedof::macroface::Iterator( level ) )
             {
-               output << face.getData( function.getFaceDataID() )
-                             ->getPointer( level )[edgedof::macroface::verticalIndex( level, itIdx.col(), itIdx.row() )]
-                      << "\n";
+               primitiveStream << face.getData( function.getFaceDataID() )
+                                   ->getPointer( level )[edgedof::macroface::verticalIndex( level, itIdx.col(), itIdx.row() )];
             }
             break;
          }
@@ -269,9 +388,8 @@ void VTKOutput::writeEdgeDoFData( std::ostream&                              out
          {
             for ( const auto& itIdx : edgedof::macroface::Iterator( level ) )
             {
-               output << face.getData( function.getFaceDataID() )
-                             ->getPointer( level )[edgedof::macroface::diagonalIndex( level, itIdx.col(), itIdx.row() )]
-                      << "\n";
+               primitiveStream << face.getData( function.getFaceDataID() )
+                                   ->getPointer( level )[edgedof::macroface::diagonalIndex( level, itIdx.col(), itIdx.row() )];
             }
             break;
          }
@@ -279,22 +397,19 @@ void VTKOutput::writeEdgeDoFData( std::ostream&                              out
             WALBERLA_ABORT( "Bad DoF type in VTK output for edge DoFs" );
             break;
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( dstStream, vtkDataFormat_, storage, writeFace );
    }
    else
    {
-      for ( const auto& it : storage->getCells() )
-      {
-         const Cell& cell     = *it.second;
-         const auto  cellData = cell.getData( function.getCellDataID() )->getPointer( level );
-
-         output << std::scientific;
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
+         const auto cellData = cell.getData( function.getCellDataID() )->getPointer( level );
 
          if ( dofType == VTKOutput::DoFType::EDGE_XYZ )
          {
             for ( const auto& itIdx : edgedof::macrocell::IteratorXYZ( level ) )
             {
-               output << cellData[edgedof::macrocell::xyzIndex( level, itIdx.x(), itIdx.y(), itIdx.z() )] << "\n";
+               primitiveStream << cellData[edgedof::macrocell::xyzIndex( level, itIdx.x(), itIdx.y(), itIdx.z() )];
             }
          }
          else
@@ -326,10 +441,11 @@ void VTKOutput::writeEdgeDoFData( std::ostream&                              out
                   WALBERLA_ABORT( "[VTK] Invalid DoFType" );
                   break;
                }
-               output << cellData[idx] << "\n";
+               primitiveStream << cellData[idx];
             }
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( dstStream, vtkDataFormat_, storage, writeCell );
    }
 }
 
@@ -351,16 +467,13 @@ std::string VTKOutput::fileNameExtension( const VTKOutput::DoFType& dofType, con
    return walberla::format( "_%s_level%u_ts%u", DoFTypeToString_.at( dofType ).c_str(), level, timestep );
 }
 
-void VTKOutput::writePointsForMicroVertices( std::ostream&                              output,
+void VTKOutput::writePointsForMicroVertices( vtk::VTKStreamWriter< real_t >&             dstStream,
                                              const std::shared_ptr< PrimitiveStorage >& storage,
                                              const uint_t&                              level ) const
 {
    if ( write2D_ )
    {
-      for ( const auto& it : storage->getFaces() )
-      {
-         Face& face = *it.second;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          size_t  rowsize = levelinfo::num_microvertices_per_edge( level );
          Point3D x, x0, xBlend;
 
@@ -379,32 +492,31 @@ void VTKOutput::writePointsForMicroVertices( std::ostream&
             for ( size_t j = 0; j < inner_rowsize; ++j )
             {
                face.getGeometryMap()->evalF( x, xBlend );
-               output << std::scientific << xBlend[0] << " " << xBlend[1] << " " << xBlend[2] << " ";
+               primitiveStream << xBlend[0] << xBlend[1] << xBlend[2];
                x += d0;
             }
 
             --inner_rowsize;
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( dstStream, vtkDataFormat_, storage, writeFace );
    }
    else
    {
-      for ( const auto& it : storage->getCells() )
-      {
-         const Cell& cell = *it.second;
-
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          for ( const auto& idxIt : vertexdof::macrocell::Iterator( level, 0 ) )
          {
             const Point3D vtkPoint = vertexdof::macrocell::coordinateFromIndex( level, cell, idxIt );
             Point3D       xBlend;
             cell.getGeometryMap()->evalF( vtkPoint, xBlend );
-            output << std::scientific << xBlend[0] << " " << xBlend[1] << " " << xBlend[2] << "\n";
+            primitiveStream << xBlend[0] << xBlend[1] << xBlend[2];
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( dstStream, vtkDataFormat_, storage, writeCell );
    }
 }
 
-void VTKOutput::writePointsForMicroEdges( std::ostream&                              output,
+void VTKOutput::writePointsForMicroEdges( vtk::VTKStreamWriter< real_t >&             dstStream,
                                           const std::shared_ptr< PrimitiveStorage >& storage,
                                           const uint_t&                              level,
                                           const VTKOutput::DoFType&                  dofType ) const
@@ -414,10 +526,7 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
       WALBERLA_ASSERT( dofType == VTKOutput::DoFType::EDGE_X || dofType == VTKOutput::DoFType::EDGE_Y ||
                        dofType == VTKOutput::DoFType::EDGE_XY );
 
-      for ( const auto& it : storage->getFaces() )
-      {
-         Face& face = *it.second;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          const Point3D faceBottomLeftCoords  = face.coords[0];
          const Point3D faceBottomRightCoords = face.coords[1];
          const Point3D faceTopLeftCoords     = face.coords[2];
@@ -439,7 +548,7 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
                    faceBottomLeftCoords + ( real_c( itIdx.col() * 2 + 1 ) * horizontalMicroEdgeOffset +
                                             real_c( itIdx.row() * 2 ) * verticalMicroEdgeOffset );
                face.getGeometryMap()->evalF( horizontalMicroEdgePosition, xBlend );
-               output << xBlend[0] << " " << xBlend[1] << " " << xBlend[2] << "\n";
+               primitiveStream << xBlend[0] << xBlend[1] << xBlend[2];
             }
             break;
          }
@@ -451,7 +560,7 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
                    faceBottomLeftCoords + ( real_c( itIdx.col() * 2 ) * horizontalMicroEdgeOffset +
                                             real_c( itIdx.row() * 2 + 1 ) * verticalMicroEdgeOffset );
                face.getGeometryMap()->evalF( verticalMicroEdgePosition, xBlend );
-               output << xBlend[0] << " " << xBlend[1] << " " << xBlend[2] << "\n";
+               primitiveStream << xBlend[0] << xBlend[1] << xBlend[2];
             }
             break;
          }
@@ -464,7 +573,7 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
                                             real_c( itIdx.row() * 2 ) * verticalMicroEdgeOffset );
                const Point3D diagonalMicroEdgePosition = horizontalMicroEdgePosition + verticalMicroEdgeOffset;
                face.getGeometryMap()->evalF( diagonalMicroEdgePosition, xBlend );
-               output << xBlend[0] << " " << xBlend[1] << " " << xBlend[2] << "\n";
+               primitiveStream << xBlend[0] << xBlend[1] << xBlend[2];
             }
             break;
          }
@@ -472,7 +581,8 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
             WALBERLA_ABORT( "Bad DoF type in VTK output for edge DoFs" );
             break;
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( dstStream, vtkDataFormat_, storage, writeFace );
    }
    else
    {
@@ -481,9 +591,7 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
                        dofType == VTKOutput::DoFType::EDGE_XZ || dofType == VTKOutput::DoFType::EDGE_YZ ||
                        dofType == VTKOutput::DoFType::EDGE_XYZ );
 
-      for ( const auto& it : storage->getCells() )
-      {
-         Cell&   cell = *it.second;
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          Point3D microEdgePosition;
 
          if ( dofType == VTKOutput::DoFType::EDGE_XYZ )
@@ -494,7 +602,7 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
                                    edgedof::macrocell::xShiftFromVertex( level, cell ) +
                                    edgedof::macrocell::yShiftFromVertex( level, cell ) +
                                    edgedof::macrocell::zShiftFromVertex( level, cell );
-               output << microEdgePosition[0] << " " << microEdgePosition[1] << " " << microEdgePosition[2] << "\n";
+               primitiveStream << microEdgePosition[0] << microEdgePosition[1] << microEdgePosition[2];
             }
          }
          else
@@ -529,10 +637,11 @@ void VTKOutput::writePointsForMicroEdges( std::ostream&
                   WALBERLA_ABORT( "[VTK] Invalid DoFType" );
                   break;
                }
-               output << microEdgePosition[0] << " " << microEdgePosition[1] << " " << microEdgePosition[2] << "\n";
+               primitiveStream << microEdgePosition[0] << microEdgePosition[1] << microEdgePosition[2];
             }
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( dstStream, vtkDataFormat_, storage, writeCell );
    }
 }
 
@@ -541,7 +650,8 @@ void VTKOutput::writeCells2D( std::ostream&                              output,
                               const uint_t&                              faceWidth ) const
 {
    output << "<Cells>\n";
-   openDataElement( output, "Int32", "connectivity", 0, VTK_DATA_FORMAT::ASCII );
+   openDataElement( output, vtk::typeName< int32_t >(), "connectivity", 0, vtkDataFormat_ );
+   vtk::VTKStreamWriter< int32_t > streamWriterConnectivity( vtkDataFormat_ );
 
    const uint_t numberOfCells = ( ( ( faceWidth - 1 ) * faceWidth ) / 2 ) + ( ( ( faceWidth - 2 ) * ( faceWidth - 1 ) ) / 2 );
 
@@ -559,12 +669,12 @@ void VTKOutput::writeCells2D( std::ostream&                              output,
       {
          for ( size_t j = 0; j < inner_rowsize - 1; ++j )
          {
-            output << offset << " " << offset + 1 << " " << offset + inner_rowsize + 1 << " ";
-            output << offset + 1 << " " << offset + inner_rowsize + 2 << " " << offset + inner_rowsize + 1 << " ";
+            streamWriterConnectivity << offset << offset + 1 << offset + inner_rowsize + 1;
+            streamWriterConnectivity << offset + 1 << offset + inner_rowsize + 2 << offset + inner_rowsize + 1;
             ++offset;
          }
 
-         output << offset << " " << offset + 1 << " " << offset + inner_rowsize + 1 << " ";
+         streamWriterConnectivity << offset << offset + 1 << offset + inner_rowsize + 1;
 
          offset += 2;
          --inner_rowsize;
@@ -573,8 +683,9 @@ void VTKOutput::writeCells2D( std::ostream&                              output,
       ++offset;
    }
 
-   output << "\n</DataArray>\n";
-   openDataElement( output, "Int32", "offsets", 0, VTK_DATA_FORMAT::ASCII );
+   closeDataElement( output, streamWriterConnectivity );
+   openDataElement( output, vtk::typeName< int32_t >(), "offsets", 0, vtkDataFormat_ );
+   vtk::VTKStreamWriter< int32_t > streamWriterOffsets( vtkDataFormat_ );
 
    // offsets
    offset = 3;
@@ -584,13 +695,14 @@ void VTKOutput::writeCells2D( std::ostream&                              output,
 
       for ( size_t i = 0; i < numberOfCells; ++i )
       {
-         output << offset << " ";
+         streamWriterOffsets << offset;
          offset += 3;
       }
    }
 
-   output << "\n</DataArray>\n";
-   openDataElement( output, "UInt8", "types", 0, VTK_DATA_FORMAT::ASCII );
+   closeDataElement( output, streamWriterOffsets );
+   openDataElement( output, vtk::typeName< uint8_t >(), "types", 0, vtkDataFormat_ );
+   vtk::VTKStreamWriter< uint8_t > streamWriterTypes( vtkDataFormat_ );
 
    // cell types
    for ( auto& it : storage->getFaces() )
@@ -598,11 +710,11 @@ void VTKOutput::writeCells2D( std::ostream&                              output,
       WALBERLA_UNUSED( it );
       for ( size_t i = 0; i < numberOfCells; ++i )
       {
-         output << "5 ";
+         streamWriterTypes << 5;
       }
    }
 
-   output << "\n</DataArray>\n";
+   closeDataElement( output, streamWriterTypes );
    output << "</Cells>\n";
 }
 
@@ -611,7 +723,8 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
                               const uint_t&                              width ) const
 {
    output << "<Cells>\n";
-   openDataElement( output, "Int32", "connectivity", 0, VTK_DATA_FORMAT::ASCII );
+   openDataElement( output, vtk::typeName< int32_t >(), "connectivity", 0, vtkDataFormat_ );
+   vtk::VTKStreamWriter< int32_t > streamWriterConnectivity( vtkDataFormat_ );
 
    // calculates the position of the point in the VTK list of points from a logical vertex index
    auto calcVTKPointArrayPosition = [width]( const indexing::Index& vertexIndex ) -> uint_t {
@@ -634,9 +747,8 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
          for ( const auto& spanningVertexIndex : spanningVertexIndices )
          {
-            output << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex ) << " ";
+            streamWriterConnectivity << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex );
          }
-         output << "\n";
       }
 
       for ( const auto& it : indexing::CellIterator( width - 2 ) )
@@ -645,9 +757,8 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
          for ( const auto& spanningVertexIndex : spanningVertexIndices )
          {
-            output << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex ) << " ";
+            streamWriterConnectivity << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex );
          }
-         output << "\n";
       }
 
       for ( const auto& it : indexing::CellIterator( width - 2 ) )
@@ -656,9 +767,8 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
          for ( const auto& spanningVertexIndex : spanningVertexIndices )
          {
-            output << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex ) << " ";
+            streamWriterConnectivity << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex );
          }
-         output << "\n";
       }
 
       for ( const auto& it : indexing::CellIterator( width - 3 ) )
@@ -668,9 +778,8 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
          for ( const auto& spanningVertexIndex : spanningVertexIndices )
          {
-            output << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex ) << " ";
+            streamWriterConnectivity << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex );
          }
-         output << "\n";
       }
 
       for ( const auto& it : indexing::CellIterator( width - 2 ) )
@@ -679,9 +788,8 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
          for ( const auto& spanningVertexIndex : spanningVertexIndices )
          {
-            output << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex ) << " ";
+            streamWriterConnectivity << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex );
          }
-         output << "\n";
       }
 
       for ( const auto& it : indexing::CellIterator( width - 2 ) )
@@ -691,14 +799,14 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
          for ( const auto& spanningVertexIndex : spanningVertexIndices )
          {
-            output << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex ) << " ";
+            streamWriterConnectivity << macroCellIdx * numberOfVertices + calcVTKPointArrayPosition( spanningVertexIndex );
          }
-         output << "\n";
       }
    }
 
-   output << "\n</DataArray>\n";
-   openDataElement( output, "Int32", "offsets", 0, VTK_DATA_FORMAT::ASCII );
+   closeDataElement( output, streamWriterConnectivity );
+   openDataElement( output, vtk::typeName< int32_t >(), "offsets", 0, vtkDataFormat_ );
+   vtk::VTKStreamWriter< int32_t > streamWriterOffsets( vtkDataFormat_ );
 
    // offsets
    uint_t offset = 4;
@@ -708,13 +816,14 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
 
       for ( size_t i = 0; i < numberOfCells; ++i )
       {
-         output << offset << " ";
+         streamWriterOffsets << offset;
          offset += 4;
       }
    }
 
-   output << "\n</DataArray>\n";
-   openDataElement( output, "UInt8", "types", 0, VTK_DATA_FORMAT::ASCII );
+   closeDataElement( output, streamWriterOffsets );
+   openDataElement( output, vtk::typeName< uint8_t >(), "types", 0, vtkDataFormat_ );
+   vtk::VTKStreamWriter< uint8_t > streamWriterTypes( vtkDataFormat_ );
 
    // cell types
    for ( const auto& it : storage->getCells() )
@@ -722,11 +831,11 @@ void VTKOutput::writeCells3D( std::ostream&                              output,
       WALBERLA_UNUSED( it );
       for ( size_t i = 0; i < numberOfCells; ++i )
       {
-         output << "10 ";
+         streamWriterTypes << 10;
       }
    }
 
-   output << "\n</DataArray>\n";
+   closeDataElement( output, streamWriterTypes );
    output << "</Cells>\n";
 }
 
@@ -756,7 +865,10 @@ void VTKOutput::writeP1( std::ostream& output, const uint_t& level ) const
    }
 
    writePointsHeader( output );
-   writePointsForMicroVertices( output, storage, level );
+   openDataElement( output, vtk::typeName< real_t >(), "", 3, vtkDataFormat_ );
+   vtk::VTKStreamWriter< real_t > streamWriterPoints( vtkDataFormat_ );
+   writePointsForMicroVertices( streamWriterPoints, storage, level );
+   closeDataElement( output, streamWriterPoints );
    writePointsFooter( output );
 
    if ( write2D_ )
@@ -772,17 +884,19 @@ void VTKOutput::writeP1( std::ostream& output, const uint_t& level ) const
 
    for ( const auto& function : p1Functions_ )
    {
-      openDataElement( output, "Float64", function.getFunctionName(), 1, VTK_DATA_FORMAT::ASCII );
-      writeVertexDoFData( output, function, storage, level );
-      output << "\n</DataArray>\n";
+      openDataElement( output, vtk::typeName< real_t >(), function.getFunctionName(), 1, vtkDataFormat_ );
+      vtk::VTKStreamWriter< real_t > streamWriter( vtkDataFormat_ );
+      writeVertexDoFData( streamWriter, function, storage, level );
+      closeDataElement( output, streamWriter );
    }
 
    for ( const auto& function : p1VecFunctions_ )
    {
       uint_t dim = write2D_ ? 2 : 3;
-      openDataElement( output, "Float64", function.getFunctionName(), dim, VTK_DATA_FORMAT::ASCII );
-      writeP1VectorFunctionData( output, function, storage, level );
-      output << "\n</DataArray>\n";
+      openDataElement( output, vtk::typeName< real_t >(), function.getFunctionName(), dim, vtkDataFormat_ );
+      vtk::VTKStreamWriter< real_t > streamWriter( vtkDataFormat_ );
+      writeP1VectorFunctionData( streamWriter, function, storage, level );
+      closeDataElement( output, streamWriter );
    }
 
    output << "</PointData>\n";
@@ -831,18 +945,20 @@ void VTKOutput::writeEdgeDoFs( std::ostream& output, const uint_t& level, const
       writePieceHeader( output, numberOfPoints3D, numberOfCells3D );
    }
    writePointsHeader( output );
-   writePointsForMicroEdges( output, storage, level, dofType );
+   openDataElement( output, vtk::typeName< real_t >(), "", 3, vtkDataFormat_ );
+   vtk::VTKStreamWriter< real_t > streamWriterPoints( vtkDataFormat_ );
+   writePointsForMicroEdges( streamWriterPoints, storage, level, dofType );
+   closeDataElement( output, streamWriterPoints );
    writePointsFooter( output );
 
    output << "<PointData>\n";
 
    for ( const auto& function : edgeDoFFunctions_ )
    {
-      openDataElement( output, "Float64", function.getFunctionName(), 1, VTK_DATA_FORMAT::ASCII );
-
-      writeEdgeDoFData( output, function, storage, level, dofType );
-
-      output << "\n</DataArray>\n";
+      openDataElement( output, vtk::typeName< real_t >(), function.getFunctionName(), 1, vtkDataFormat_ );
+      vtk::VTKStreamWriter< real_t > streamWriter( vtkDataFormat_ );
+      writeEdgeDoFData( streamWriter, function, storage, level, dofType );
+      closeDataElement( output, streamWriter );
    }
 
    output << "</PointData>\n";
@@ -877,7 +993,10 @@ void VTKOutput::writeDGDoFs( std::ostream& output, const uint_t& level ) const
    writePieceHeader( output, numberOfPoints, numberOfCells );
 
    writePointsHeader( output );
-   writePointsForMicroVertices( output, storage, level );
+   openDataElement( output, vtk::typeName< real_t >(), "", 3, vtkDataFormat_ );
+   vtk::VTKStreamWriter< real_t > streamWriterPoints( vtkDataFormat_ );
+   writePointsForMicroVertices( streamWriterPoints, storage, level );
+   closeDataElement( output, streamWriterPoints );
    writePointsFooter( output );
 
    writeCells2D( output, storage, levelinfo::num_microvertices_per_edge( level ) );
@@ -886,15 +1005,12 @@ void VTKOutput::writeDGDoFs( std::ostream& output, const uint_t& level ) const
 
    for ( const auto& function : dgFunctions_ )
    {
-      openDataElement( output, "Float64", function.getFunctionName(), 1, VTK_DATA_FORMAT::ASCII );
-
-      for ( const auto& it : storage->getFaces() )
-      {
-         const Face& face = *it.second;
+      openDataElement( output, vtk::typeName< real_t >(), function.getFunctionName(), 1, vtkDataFormat_ );
+      vtk::VTKStreamWriter< real_t > streamWriter( vtkDataFormat_ );
 
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          uint_t rowsize       = levelinfo::num_microvertices_per_edge( level );
          uint_t inner_rowsize = rowsize;
-         output << std::scientific;
 
          uint_t idx;
 
@@ -903,16 +1019,17 @@ void VTKOutput::writeDGDoFs( std::ostream& output, const uint_t& level ) const
             for ( size_t i = 0; i < inner_rowsize - 2; ++i )
             {
                idx = facedof::macroface::indexFaceFromGrayFace( level, i, j, stencilDirection::CELL_GRAY_C );
-               output << face.getData( function.getFaceDataID() )->getPointer( level )[idx] << " ";
+               primitiveStream << face.getData( function.getFaceDataID() )->getPointer( level )[idx];
                idx = facedof::macroface::indexFaceFromBlueFace( level, i, j, stencilDirection::CELL_BLUE_C );
-               output << face.getData( function.getFaceDataID() )->getPointer( level )[idx] << " ";
+               primitiveStream << face.getData( function.getFaceDataID() )->getPointer( level )[idx];
             }
             idx = facedof::macroface::indexFaceFromGrayFace( level, inner_rowsize - 2, j, stencilDirection::CELL_GRAY_C );
-            output << face.getData( function.getFaceDataID() )->getPointer( level )[idx] << " ";
+            primitiveStream << face.getData( function.getFaceDataID() )->getPointer( level )[idx];
             --inner_rowsize;
          }
-      }
-      output << "\n</DataArray>\n";
+      };
+      writeMacroPrimitivesInParallel< Face >( streamWriter, vtkDataFormat_, storage, writeFace );
+      closeDataElement( output, streamWriter );
    }
 
    output << "\n</CellData>\n";
@@ -940,7 +1057,10 @@ void VTKOutput::writeP2( std::ostream& output, const uint_t& level ) const
    writePieceHeader( output, numberOfPoints, numberOfCells );
 
    writePointsHeader( output );
-   writePointsForMicroVertices( output, storage, level + 1 );
+   openDataElement( output, vtk::typeName< real_t >(), "", 3, vtkDataFormat_ );
+   vtk::VTKStreamWriter< real_t > streamWriterPoints( vtkDataFormat_ );
+   writePointsForMicroVertices( streamWriterPoints, storage, level + 1 );
+   closeDataElement( output, streamWriterPoints );
    writePointsFooter( output );
 
    if ( write2D_ )
@@ -982,65 +1102,54 @@ void VTKOutput::writeP2( std::ostream& output, const uint_t& level ) const
 void VTKOutput::writeSingleP2Function( const P2Function< real_t >& function, std::ostream& output, const uint_t& level ) const
 {
    auto storage = function.getStorage();
-   openDataElement( output, "Float64", function.getFunctionName(), 1, VTK_DATA_FORMAT::ASCII );
+   openDataElement( output, vtk::typeName< real_t >(), function.getFunctionName(), 1, vtkDataFormat_ );
+   vtk::VTKStreamWriter< real_t > streamWriter( vtkDataFormat_ );
 
    if ( write2D_ )
    {
-      for ( const auto& itFaces : storage->getFaces() )
-      {
-         const Face& face = *itFaces.second;
-
-         output << std::scientific;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          for ( const auto& it : vertexdof::macroface::Iterator( level + 1, 0 ) )
          {
             if ( it.row() % 2 == 0 )
             {
                if ( it.col() % 2 == 0 )
                {
-                  output << face.getData( function.getVertexDoFFunction().getFaceDataID() )
-                                ->getPointer( level )[vertexdof::macroface::indexFromVertex(
-                                    level, it.col() / 2, it.row() / 2, stencilDirection::VERTEX_C )]
-                         << " ";
+                  primitiveStream << face.getData( function.getVertexDoFFunction().getFaceDataID() )
+                                   ->getPointer( level )[vertexdof::macroface::indexFromVertex(
+                                       level, it.col() / 2, it.row() / 2, stencilDirection::VERTEX_C )];
                }
                else
                {
-                  output << face.getData( function.getEdgeDoFFunction().getFaceDataID() )
-                                ->getPointer(
-                                    level )[edgedof::macroface::horizontalIndex( level, ( it.col() - 1 ) / 2, it.row() / 2 )]
-                         << " ";
+                  primitiveStream << face.getData( function.getEdgeDoFFunction().getFaceDataID() )
+                                   ->getPointer(
+                                       level )[edgedof::macroface::horizontalIndex( level, ( it.col() - 1 ) / 2, it.row() / 2 )];
                }
             }
             else
             {
                if ( it.col() % 2 == 0 )
                {
-                  output << face.getData( function.getEdgeDoFFunction().getFaceDataID() )
-                                ->getPointer(
-                                    level )[edgedof::macroface::verticalIndex( level, it.col() / 2, ( it.row() - 1 ) / 2 )]
-                         << " ";
+                  primitiveStream << face.getData( function.getEdgeDoFFunction().getFaceDataID() )
+                                   ->getPointer(
+                                       level )[edgedof::macroface::verticalIndex( level, it.col() / 2, ( it.row() - 1 ) / 2 )];
                }
                else
                {
-                  output
+                  primitiveStream
                       << face.getData( function.getEdgeDoFFunction().getFaceDataID() )
                              ->getPointer(
-                                 level )[edgedof::macroface::diagonalIndex( level, ( it.col() - 1 ) / 2, ( it.row() - 1 ) / 2 )]
-                      << " ";
+                                 level )[edgedof::macroface::diagonalIndex( level, ( it.col() - 1 ) / 2, ( it.row() - 1 ) / 2 )];
                }
             }
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( streamWriter, vtkDataFormat_, storage, writeFace );
    }
    else
    {
-      for ( const auto& itCells : storage->getCells() )
-      {
-         const Cell& cell       = *itCells.second;
-         auto        vertexData = cell.getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( level );
-         auto        edgeData   = cell.getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
-
-         output << std::scientific;
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
+         auto vertexData = cell.getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( level );
+         auto edgeData   = cell.getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
 
          for ( const auto& it : vertexdof::macrocell::Iterator( level + 1, 0 ) )
          {
@@ -1052,37 +1161,37 @@ void VTKOutput::writeSingleP2Function( const P2Function< real_t >& function, std
             switch ( mod )
             {
             case 0b000:
-               output
-                   << vertexData[vertexdof::macrocell::indexFromVertex( level, x / 2, y / 2, z / 2, stencilDirection::VERTEX_C )]
-                   << " ";
+               primitiveStream
+                   << vertexData[vertexdof::macrocell::indexFromVertex( level, x / 2, y / 2, z / 2, stencilDirection::VERTEX_C )];
                break;
             case 0b100:
-               output << edgeData[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )];
                break;
             case 0b010:
-               output << edgeData[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )];
                break;
             case 0b001:
-               output << edgeData[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )];
                break;
             case 0b110:
-               output << edgeData[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )];
                break;
             case 0b101:
-               output << edgeData[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )];
                break;
             case 0b011:
-               output << edgeData[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
                break;
             case 0b111:
-               output << edgeData[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
                break;
             }
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( streamWriter, vtkDataFormat_, storage, writeCell );
    }
 
-   output << "\n</DataArray>\n";
+   closeDataElement( output, streamWriter );
 }
 
 void VTKOutput::writeSingleP2VectorFunction( const P2VectorFunction< real_t >& function,
@@ -1090,79 +1199,65 @@ void VTKOutput::writeSingleP2VectorFunction( const P2VectorFunction< real_t >& f
                                              const uint_t&                     level ) const
 {
    auto storage = function.getStorage();
-   openDataElement( output, "Float64", function.getFunctionName(), function.getDimension(), VTK_DATA_FORMAT::ASCII );
+   openDataElement( output, vtk::typeName< real_t >(), function.getFunctionName(), function.getDimension(), vtkDataFormat_ );
+   vtk::VTKStreamWriter< real_t > streamWriter( vtkDataFormat_ );
 
    if ( write2D_ )
    {
-      for ( const auto& itFaces : storage->getFaces() )
-      {
-         const Face& face = *itFaces.second;
-
-         output << std::scientific;
-
+      const auto writeFace = [&]( const Face& face, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          for ( const auto& it : vertexdof::macroface::Iterator( level + 1, 0 ) )
          {
             if ( it.row() % 2 == 0 )
             {
                if ( it.col() % 2 == 0 )
                {
-                  output << face.getData( function[0].getVertexDoFFunction().getFaceDataID() )
-                                ->getPointer( level )[vertexdof::macroface::indexFromVertex(
-                                    level, it.col() / 2, it.row() / 2, stencilDirection::VERTEX_C )]
-                         << " ";
-                  output << face.getData( function[1].getVertexDoFFunction().getFaceDataID() )
-                                ->getPointer( level )[vertexdof::macroface::indexFromVertex(
-                                    level, it.col() / 2, it.row() / 2, stencilDirection::VERTEX_C )]
-                         << " ";
+                  primitiveStream << face.getData( function[0].getVertexDoFFunction().getFaceDataID() )
+                                   ->getPointer( level )[vertexdof::macroface::indexFromVertex(
+                                       level, it.col() / 2, it.row() / 2, stencilDirection::VERTEX_C )];
+                  primitiveStream << face.getData( function[1].getVertexDoFFunction().getFaceDataID() )
+                                   ->getPointer( level )[vertexdof::macroface::indexFromVertex(
+                                       level, it.col() / 2, it.row() / 2, stencilDirection::VERTEX_C )];
                }
                else
                {
-                  output << face.getData( function[0].getEdgeDoFFunction().getFaceDataID() )
-                                ->getPointer(
-                                    level )[edgedof::macroface::horizontalIndex( level, ( it.col() - 1 ) / 2, it.row() / 2 )]
-                         << " ";
-                  output << face.getData( function[1].getEdgeDoFFunction().getFaceDataID() )
-                                ->getPointer(
-                                    level )[edgedof::macroface::horizontalIndex( level, ( it.col() - 1 ) / 2, it.row() / 2 )]
-                         << " ";
+                  primitiveStream << face.getData( function[0].getEdgeDoFFunction().getFaceDataID() )
+                                   ->getPointer(
+                                       level )[edgedof::macroface::horizontalIndex( level, ( it.col() - 1 ) / 2, it.row() / 2 )];
+                  primitiveStream << face.getData( function[1].getEdgeDoFFunction().getFaceDataID() )
+                                   ->getPointer(
+                                       level )[edgedof::macroface::horizontalIndex( level, ( it.col() - 1 ) / 2, it.row() / 2 )];
                }
             }
             else
             {
                if ( it.col() % 2 == 0 )
                {
-                  output << face.getData( function[0].getEdgeDoFFunction().getFaceDataID() )
-                                ->getPointer(
-                                    level )[edgedof::macroface::verticalIndex( level, it.col() / 2, ( it.row() - 1 ) / 2 )]
-                         << " ";
-                  output << face.getData( function[1].getEdgeDoFFunction().getFaceDataID() )
-                                ->getPointer(
-                                    level )[edgedof::macroface::verticalIndex( level, it.col() / 2, ( it.row() - 1 ) / 2 )]
-                         << " ";
+                  primitiveStream << face.getData( function[0].getEdgeDoFFunction().getFaceDataID() )
+                                   ->getPointer(
+                                       level )[edgedof::macroface::verticalIndex( level, it.col() / 2, ( it.row() - 1 ) / 2 )];
+                  primitiveStream << face.getData( function[1].getEdgeDoFFunction().getFaceDataID() )
+                                   ->getPointer(
+                                       level )[edgedof::macroface::verticalIndex( level, it.col() / 2, ( it.row() - 1 ) / 2 )];
                }
                else
                {
-                  output
+                  primitiveStream
                       << face.getData( function[0].getEdgeDoFFunction().getFaceDataID() )
                              ->getPointer(
-                                 level )[edgedof::macroface::diagonalIndex( level, ( it.col() - 1 ) / 2, ( it.row() - 1 ) / 2 )]
-                      << " ";
-                  output
+                                 level )[edgedof::macroface::diagonalIndex( level, ( it.col() - 1 ) / 2, ( it.row() - 1 ) / 2 )];
+                  primitiveStream
                       << face.getData( function[1].getEdgeDoFFunction().getFaceDataID() )
                              ->getPointer(
-                                 level )[edgedof::macroface::diagonalIndex( level, ( it.col() - 1 ) / 2, ( it.row() - 1 ) / 2 )]
-                      << " ";
+                                 level )[edgedof::macroface::diagonalIndex( level, ( it.col() - 1 ) / 2, ( it.row() - 1 ) / 2 )];
                }
             }
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Face >( streamWriter, vtkDataFormat_, storage, writeFace );
    }
    else
    {
-      for ( const auto& itCells : storage->getCells() )
-      {
-         const Cell& cell = *itCells.second;
-
+      const auto writeCell = [&]( const Cell& cell, vtk::VTKStreamWriter< real_t >& primitiveStream ) {
          auto vertexData0 = cell.getData( function[0].getVertexDoFFunction().getCellDataID() )->getPointer( level );
          auto vertexData1 = cell.getData( function[1].getVertexDoFFunction().getCellDataID() )->getPointer( level );
          auto vertexData2 = cell.getData( function[2].getVertexDoFFunction().getCellDataID() )->getPointer( level );
@@ -1171,8 +1266,6 @@ void VTKOutput::writeSingleP2VectorFunction( const P2VectorFunction< real_t >& f
          auto edgeData1 = cell.getData( function[1].getEdgeDoFFunction().getCellDataID() )->getPointer( level );
          auto edgeData2 = cell.getData( function[2].getEdgeDoFFunction().getCellDataID() )->getPointer( level );
 
-         output << std::scientific;
-
          for ( const auto& it : vertexdof::macrocell::Iterator( level + 1, 0 ) )
          {
             const auto   x   = it.x();
@@ -1183,55 +1276,53 @@ void VTKOutput::writeSingleP2VectorFunction( const P2VectorFunction< real_t >& f
             switch ( mod )
             {
             case 0b000:
-               output
+               primitiveStream
                    << vertexData0[vertexdof::macrocell::indexFromVertex( level, x / 2, y / 2, z / 2, stencilDirection::VERTEX_C )]
-                   << " "
                    << vertexData1[vertexdof::macrocell::indexFromVertex( level, x / 2, y / 2, z / 2, stencilDirection::VERTEX_C )]
-                   << " "
-                   << vertexData2[vertexdof::macrocell::indexFromVertex( level, x / 2, y / 2, z / 2, stencilDirection::VERTEX_C )]
-                   << " ";
+                   << vertexData2[vertexdof::macrocell::indexFromVertex( level, x / 2, y / 2, z / 2, stencilDirection::VERTEX_C )];
                break;
             case 0b100:
-               output << edgeData0[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::xIndex( level, ( x - 1 ) / 2, y / 2, z / 2 )];
                break;
             case 0b010:
-               output << edgeData0[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::yIndex( level, x / 2, ( y - 1 ) / 2, z / 2 )];
                break;
             case 0b001:
-               output << edgeData0[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::zIndex( level, x / 2, y / 2, ( z - 1 ) / 2 )];
                break;
             case 0b110:
-               output << edgeData0[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::xyIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, z / 2 )];
                break;
             case 0b101:
-               output << edgeData0[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::xzIndex( level, ( x - 1 ) / 2, y / 2, ( z - 1 ) / 2 )];
                break;
             case 0b011:
-               output << edgeData0[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::yzIndex( level, x / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
                break;
             case 0b111:
-               output << edgeData0[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData1[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
-               output << edgeData2[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )] << " ";
+               primitiveStream << edgeData0[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData1[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
+               primitiveStream << edgeData2[edgedof::macrocell::xyzIndex( level, ( x - 1 ) / 2, ( y - 1 ) / 2, ( z - 1 ) / 2 )];
                break;
             }
          }
-      }
+      };
+      writeMacroPrimitivesInParallel< Cell >( streamWriter, vtkDataFormat_, storage, writeCell );
    }
 
-   output << "\n</DataArray>\n";
+   closeDataElement( output, streamWriter );
 }
 
 void VTKOutput::writeDoFByType( std::ostream& output, const uint_t& level, const VTKOutput::DoFType& dofType ) const
@@ -1327,19 +1418,29 @@ void VTKOutput::write( const uint_t& level, const uint_t& timestep ) const
 
             std::ostringstream output;
 
+            appendedData_.clear();
+            appendedDataOffsetPositions_.clear();
+
             writeXMLHeader( output );
 
             writeDoFByType( output, level, dofType );
 
-            walberla::mpi::writeMPITextFile( completeFilePath, output.str() );
-
-            WALBERLA_ROOT_SECTION()
+            if ( vtkDataFormat_ == vtk::DataFormat::APPENDED )
             {
-               std::ofstream pvtu_file;
-               pvtu_file.open( completeFilePath.c_str(), std::ofstream::out | std::ofstream::app );
-               WALBERLA_CHECK( !!pvtu_file, "[VTKWriter] Error opening file: " << completeFilePath );
-               writeXMLFooter( pvtu_file );
-               pvtu_file.close();
+               writeAppendedFile( completeFilePath, output.str(), appendedDataOffsetPositions_, appendedData_ );
+            }
+            else
+            {
+               walberla::mpi::writeMPITextFile( completeFilePath, output.str() );
+
+               WALBERLA_ROOT_SECTION()
+               {
+                  std::ofstream pvtu_file;
+                  pvtu_file.open( completeFilePath.c_str(), std::ofstream::out | std::ofstream::app );
+                  WALBERLA_CHECK( !!pvtu_file, "[VTKWriter] Error opening file: " << completeFilePath );
+                  writeXMLFooter( pvtu_file );
+                  pvtu_file.close();
+               }
             }
          }
       }
@@ -1352,7 +1453,7 @@ void VTKOutput::openDataElement( std::ostream&         output,
                                  const std::string&    type,
                                  const std::string&    name,
                                  const uint_t          nComponents,
-                                 const VTK_DATA_FORMAT fmt ) const
+                                 const vtk::DataFormat fmt ) const
 {
    // open element and write type
    output << "<DataArray type=\"" << type << "\"";
@@ -1369,9 +1470,22 @@ void VTKOutput::openDataElement( std::ostream&         output,
       output << " NumberOfComponents=\"" << nComponents << "\"";
    }
    // specify format
-   WALBERLA_UNUSED( fmt );
-   WALBERLA_ASSERT( fmt == VTK_DATA_FORMAT::ASCII, "Only ASCII is supported as VTK_DATA_FORMAT at the moment" );
-   output << " format=\"ascii\">\n";
+   switch ( fmt )
+   {
+   case vtk::DataFormat::ASCII:
+      output << " format=\"ascii\">\n";
+      break;
+   case vtk::DataFormat::BINARY:
+      output << " format=\"binary\">\n";
+      break;
+   case vtk::DataFormat::APPENDED:
+      // the offset is relative to the appended data of this process and is shifted before the file is written
+      output << " format=\"appended\" offset=\"";
+      appendedDataOffsetPositions_.emplace_back( static_cast< size_t >( output.tellp() ), appendedData_.size() );
+      output << std::setw( appendedOffsetWidth ) << std::setfill( '0' ) << appendedData_.size() << std::setfill( ' ' )
+             << "\">\n";
+      break;
+   }
 }
 
 void VTKOutput::syncAllFunctions( const uint_t& level ) const
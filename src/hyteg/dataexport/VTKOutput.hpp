@@ -28,6 +28,7 @@
 
 #include "hyteg/composites/P1StokesFunction.hpp"
 #include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
+#include "hyteg/dataexport/VTKStreamWriter.hpp"
 #include "hyteg/dgfunctionspace/DGFunction.hpp"
 #include "hyteg/edgedofspace/EdgeDoFFunction.hpp"
 #include "hyteg/p1functionspace/P1Function.hpp"
@@ -68,6 +69,13 @@ class VTKOutput
    void add( P1StokesFunction< real_t > function );
    void add( P2P1TaylorHoodFunction< real_t > function );
 
+   /// Selects the format of the DataArrays in the written files.
+   ///
+   /// ASCII (default) writes human readable text. BINARY writes base64 encoded data inline.
+   /// APPENDED writes raw binary data to the end of the file, which results in the smallest files and
+   /// the fastest output. In all formats, all processes write to a single file per time step via MPI-IO.
+   void setVTKDataFormat( const vtk::DataFormat& vtkDataFormat ) { vtkDataFormat_ = vtkDataFormat; }
+
    /// Writes the VTK output only if writeFrequency > 0 and timestep % writeFrequency == 0.
    /// Therefore always writes output if timestep is 0.
    /// Appends the time step to the filename.
@@ -89,13 +97,6 @@ class VTKOutput
       P2
    };
 
-   enum class VTK_DATA_FORMAT
-   {
-      ASCII,
-      BINARY,
-      APPENDED
-   };
-
    static const std::map< VTKOutput::DoFType, std::string > DoFTypeToString_;
 
    void   writeDoFByType( std::ostream& output, const uint_t& level, const VTKOutput::DoFType& dofType ) const;
@@ -115,25 +116,25 @@ class VTKOutput
    void writeHeader( std::ostringstream& output, const uint_t& numberOfPoints, const uint_t& numberOfCells ) const;
    void writeFooterAndFile( std::ostringstream& output, const std::string& completeFilePath ) const;
 
-   void writePointsForMicroVertices( std::ostream&                              output,
+   void writePointsForMicroVertices( vtk::VTKStreamWriter< real_t >&             dstStream,
                                      const std::shared_ptr< PrimitiveStorage >& storage,
                                      const uint_t&                              level ) const;
-   void writePointsForMicroEdges( std::ostream&                              output,
+   void writePointsForMicroEdges( vtk::VTKStreamWriter< real_t >&             dstStream,
                                   const std::shared_ptr< PrimitiveStorage >& storage,
                                   const uint_t&                              level,
                                   const VTKOutput::DoFType&                  dofType ) const;
 
-   void writeVertexDoFData( std::ostream&                                 output,
+   void writeVertexDoFData( vtk::VTKStreamWriter< real_t >&               dstStream,
                             const vertexdof::VertexDoFFunction< real_t >& function,
                             const std::shared_ptr< PrimitiveStorage >&    storage,
                             const uint_t&                                 level ) const;
-   void writeEdgeDoFData( std::ostream&                              output,
+   void writeEdgeDoFData( vtk::VTKStreamWriter< real_t >&             dstStream,
                           const EdgeDoFFunction< real_t >&           function,
                           const std::shared_ptr< PrimitiveStorage >& storage,
                           const uint_t&                              level,
                           const DoFType&                             dofType ) const;
 
-   void writeP1VectorFunctionData( std::ostream&                              output,
+   void writeP1VectorFunctionData( vtk::VTKStreamWriter< real_t >&             dstStream,
                                    const P1VectorFunction< real_t >&          function,
                                    const std::shared_ptr< PrimitiveStorage >& storage,
                                    const uint_t&                              level ) const;
@@ -147,7 +148,11 @@ class VTKOutput
                          const std::string&    type,
                          const std::string&    name,
                          const uint_t          nComponents,
-                         const VTK_DATA_FORMAT fmt ) const;
+                         const vtk::DataFormat fmt ) const;
+
+   /// Writes the values of the stream writer in the selected format and closes the DataArray element.
+   template < typename dtype >
+   void closeDataElement( std::ostream& output, vtk::VTKStreamWriter< dtype >& streamWriter ) const;
 
    /// Writes only macro-faces.
    void set2D() { write2D_ = true; }
@@ -163,6 +168,13 @@ class VTKOutput
 
    bool write2D_;
 
+   vtk::DataFormat vtkDataFormat_;
+
+   /// raw data of all DataArrays in APPENDED format, collected during write()
+   mutable std::vector< char > appendedData_;
+   /// positions of the offset attributes in the XML output and the respective offsets in appendedData_
+   mutable std::vector< std::pair< size_t, uint64_t > > appendedDataOffsetPositions_;
+
    std::vector< P1Function< real_t > > p1Functions_;
    std::vector< P2Function< real_t > > p2Functions_;
 
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/DataTypes.h"
+#include "core/debug/CheckFunctions.h"
+
+namespace hyteg {
+namespace vtk {
+
+/// Format of the DataArray elements in the VTK XML files.
+///
+/// ASCII:    values are written as text (default)
+/// BINARY:   values are written inline, base64 encoded
+/// APPENDED: values are written as raw binary data to the AppendedData section at the end of the file
+enum class DataFormat
+{
+   ASCII,
+   BINARY,
+   APPENDED
+};
+
+/// Returns the VTK type name (e.g. "Float64") that corresponds to the passed C++ type.
+template < typename T >
+inline std::string typeName();
+
+template <>
+inline std::string typeName< double >()
+{
+   return "Float64";
+}
+
+template <>
+inline std::string typeName< float >()
+{
+   return "Float32";
+}
+
+template <>
+inline std::string typeName< int32_t >()
+{
+   return "Int32";
+}
+
+template <>
+inline std::string typeName< int64_t >()
+{
+   return "Int64";
+}
+
+template <>
+inline std::string typeName< uint8_t >()
+{
+   return "UInt8";
+}
+
+/// Appends the base64 encoding of the passed bytes to the output stream.
+inline void base64Encode( std::ostream& os, const std::vector< unsigned char >& bytes )
+{
+   static const char* const alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+   std::string encoded;
+   encoded.reserve( 4 * ( ( bytes.size() + 2 ) / 3 ) );
+
+   size_t i = 0;
+   for ( ; i + 2 < bytes.size(); i += 3 )
+   {
+      const uint32_t triple = ( uint32_t( bytes[i] ) << 16 ) | ( uint32_t( bytes[i + 1] ) << 8 ) | uint32_t( bytes[i + 2] );
+      encoded.push_back( alphabet[( triple >> 18 ) & 0x3F] );
+      encoded.push_back( alphabet[( triple >> 12 ) & 0x3F] );
+      encoded.push_back( alphabet[( triple >> 6 ) & 0x3F] );
+      encoded.push_back( alphabet[triple & 0x3F] );
+   }
+
+   const size_t remainder = bytes.size() - i;
+   if ( remainder > 0 )
+   {
+      uint32_t triple = uint32_t( bytes[i] ) << 16;
+      if ( remainder == 2 )
+      {
+         triple |= uint32_t( bytes[i + 1] ) << 8;
+      }
+      encoded.push_back( alphabet[( triple >> 18 ) & 0x3F] );
+      encoded.push_back( alphabet[( triple >> 12 ) & 0x3F] );
+      encoded.push_back( remainder == 2 ? alphabet[( triple >> 6 ) & 0x3F] : '=' );
+      encoded.push_back( '=' );
+   }
+
+   os << encoded;
+}
+
+/// \brief Collects the values of a single VTK DataArray and writes them in the selected format.
+///
+/// The values are passed via operator<<. In ASCII format they are written as text directly.
+/// In the binary formats they are converted to dtype and buffered until toStream() is called.
+///
+/// As required by the VTK XML format, binary data is prefixed by a header that contains the
+/// number of bytes of the data block as UInt32.
+template < typename dtype >
+class VTKStreamWriter
+{
+ public:
+   explicit VTKStreamWriter( const DataFormat& vtkDataFormat )
+   : vtkDataFormat_( vtkDataFormat )
+   {
+      if ( vtkDataFormat_ == DataFormat::ASCII )
+      {
+         outputAscii_ << std::scientific;
+      }
+   }
+
+   template < typename T >
+   inline VTKStreamWriter& operator<<( const T& data )
+   {
+      if ( vtkDataFormat_ == DataFormat::ASCII )
+      {
+         outputAscii_ << data << " ";
+      }
+      else
+      {
+         values_.push_back( static_cast< dtype >( data ) );
+      }
+      return *this;
+   }
+
+   /// Appends the values that were collected by another stream writer with the same format.
+   void append( const VTKStreamWriter& other )
+   {
+      WALBERLA_CHECK( vtkDataFormat_ == other.vtkDataFormat_, "[VTK] Cannot append data of a different format." );
+      if ( vtkDataFormat_ == DataFormat::ASCII )
+      {
+         outputAscii_ << other.outputAscii_.str();
+      }
+      else
+      {
+         values_.insert( values_.end(), other.values_.begin(), other.values_.end() );
+      }
+   }
+
+   /// Writes the collected values.
+   ///
+   /// \param os           the XML output, ASCII and BINARY data is written here
+   /// \param appendedData the raw appended data section, APPENDED data is appended here
+   void toStream( std::ostream& os, std::vector< char >& appendedData )
+   {
+      switch ( vtkDataFormat_ )
+      {
+      case DataFormat::ASCII:
+         os << outputAscii_.str();
+         break;
+      case DataFormat::BINARY:
+      {
+         std::vector< unsigned char > bytes( sizeof( uint32_t ) + numberOfBytes() );
+         writeHeaderAndValues( bytes.data() );
+         base64Encode( os, bytes );
+         break;
+      }
+      case DataFormat::APPENDED:
+      {
+         const size_t oldSize = appendedData.size();
+         appendedData.resize( oldSize + sizeof( uint32_t ) + numberOfBytes() );
+         writeHeaderAndValues( appendedData.data() + oldSize );
+         break;
+      }
+      }
+   }
+
+ private:
+   size_t numberOfBytes() const { return values_.size() * sizeof( dtype ); }
+
+   void writeHeaderAndValues( void* dst ) const
+   {
+      WALBERLA_CHECK_LESS_EQUAL( numberOfBytes(),
+                                 size_t( std::numeric_limits< uint32_t >::max() ),
+                                 "[VTK] DataArray exceeds the maximum size of a binary data block." );
+      const uint32_t header = uint32_t( numberOfBytes() );
+      std::memcpy( dst, &header, sizeof( uint32_t ) );
+      if ( !values_.empty() )
+      {
+         std::memcpy( static_cast< char* >( dst ) + sizeof( uint32_t ), values_.data(), numberOfBytes() );
+      }
+   }
+
+   DataFormat           vtkDataFormat_;
+   std::ostringstream   outputAscii_;
+   std::vector< dtype > values_;
+};
+
+} // namespace vtk
+} // namespace hyteg
@@ -250,8 +250,7 @@ inline void upwind( const uint_t&
 {
    using namespace vertexdof::macroface;
 
-   size_t rowsize       = levelinfo::num_microvertices_per_edge( Level );
-   size_t inner_rowsize = rowsize;
+   const size_t rowsize = levelinfo::num_microvertices_per_edge( Level );
 
    // get memories
    auto src = face.getData( srcId )->getPointer( Level );
@@ -284,16 +283,23 @@ inline void upwind( const uint_t&
    real_t faceArea    = std::pow( 4.0, -walberla::real_c( Level ) ) * face.area;
    real_t faceAreaInv = 1.0 / faceArea;
 
-   ValueType tmp;
-
-   Point2D u_0, u_1, u_2;
-   real_t  un_0, un_1, un_2;
-   real_t  c_up_0, c_up_1, c_up_2;
-
-   for ( size_t j = 1; j < rowsize - 2; ++j )
+   // The rows only write to their own micro-faces, so they are distributed among the threads.
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int row = 1; row < walberla::int_c( rowsize ) - 2; ++row )
    {
+      const size_t j             = walberla::uint_c( row );
+      const size_t inner_rowsize = rowsize - ( j - 1 );
+
       for ( size_t i = 1; i < inner_rowsize - 3; ++i )
       {
+         ValueType tmp;
+
+         Point2D u_0, u_1, u_2;
+         real_t  un_0, un_1, un_2;
+         real_t  c_up_0, c_up_1, c_up_2;
+
          // evalate velocities
          u_0[0] = 0.5 * ( u[indexFromVertex( Level, i, j, stencilDirection::VERTEX_C )] +
                           u[indexFromVertex( Level, i + 1, j, stencilDirection::VERTEX_C )] );
@@ -353,20 +359,29 @@ inline void upwind( const uint_t&
             dst[facedof::macroface::indexFaceFromGrayFace( Level, i, j, stencilDirection::CELL_GRAY_C )] += tmp;
          }
       }
-      --inner_rowsize;
    }
 
-   inner_rowsize = rowsize;
-
    // flip normals
    n_0 *= -1.0;
    n_1 *= -1.0;
    n_2 *= -1.0;
 
-   for ( size_t j = 0; j < rowsize - 2; ++j )
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int row = 0; row < walberla::int_c( rowsize ) - 2; ++row )
    {
+      const size_t j             = walberla::uint_c( row );
+      const size_t inner_rowsize = rowsize - j;
+
       for ( size_t i = 0; i < inner_rowsize - 2; ++i )
       {
+         ValueType tmp;
+
+         Point2D u_0, u_1, u_2;
+         real_t  un_0, un_1, un_2;
+         real_t  c_up_0, c_up_1, c_up_2;
+
          // evalate velocities
          u_0[0] = 0.5 * ( u[indexFromVertex( Level, i, j + 1, stencilDirection::VERTEX_C )] +
                           u[indexFromVertex( Level, i + 1, j + 1, stencilDirection::VERTEX_C )] );
@@ -426,7 +441,6 @@ inline void upwind( const uint_t&
             dst[facedof::macroface::indexFaceFromBlueFace( Level, i, j, stencilDirection::CELL_BLUE_C )] += tmp;
          }
       }
-      --inner_rowsize;
    }
 }
 
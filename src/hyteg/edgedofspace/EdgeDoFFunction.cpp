@@ -86,25 +86,34 @@ EdgeDoFFunction< ValueType >::EdgeDoFFunction( const std::string&
    storage->addFaceData( faceDataID_, faceDataHandling, name );
    storage->addCellData( cellDataID_, cellDataHandling, name );
 
-   for ( uint_t level = minLevel; level <= maxLevel; ++level )
+   // all levels of a macro-primitive are allocated from a single arena
+   for ( const auto & it : storage->getVertices() )
    {
-      for ( const auto & it : storage->getVertices() )
-      {
-         allocateMemory( level, *it.second );
-      }
-      for ( const auto & it : storage->getEdges() )
-      {
-         allocateMemory( level, *it.second );
-      }
-      for ( const auto & it : storage->getFaces() )
-      {
-         allocateMemory( level, *it.second );
-      }
-      for ( const auto & it : storage->getCells() )
-      {
-         allocateMemory( level, *it.second );
-      }
+      const Vertex & vertex = *it.second;
+      vertex.getData( vertexDataID_ )->addData(
+          minLevel, maxLevel, [&vertex]( const uint_t & level ) { return edgedof::edgeDoFMacroVertexFunctionMemorySize( level, vertex ); }, 0 );
+   }
+   for ( const auto & it : storage->getEdges() )
+   {
+      const Edge & edge = *it.second;
+      edge.getData( edgeDataID_ )->addData(
+          minLevel, maxLevel, [&edge]( const uint_t & level ) { return edgedof::edgeDoFMacroEdgeFunctionMemorySize( level, edge ); }, 0 );
+   }
+   for ( const auto & it : storage->getFaces() )
+   {
+      const Face & face = *it.second;
+      face.getData( faceDataID_ )->addData(
+          minLevel, maxLevel, [&face]( const uint_t & level ) { return edgedof::edgeDoFMacroFaceFunctionMemorySize( level, face ); }, 0 );
+   }
+   for ( const auto & it : storage->getCells() )
+   {
+      const Cell & cell = *it.second;
+      cell.getData( cellDataID_ )->addData(
+          minLevel, maxLevel, [&cell]( const uint_t & level ) { return edgedof::edgeDoFMacroCellFunctionMemorySize( level, cell ); }, 0 );
+   }
 
+   for ( uint_t level = minLevel; level <= maxLevel; ++level )
+   {
       communicators_[level]->addPackInfo( std::make_shared< EdgeDoFPackInfo< ValueType > >(
           level, vertexDataID_, edgeDataID_, faceDataID_, cellDataID_, this->getStorage() ) );
       additiveCommunicators_[level]->addPackInfo( std::make_shared< EdgeDoFAdditivePackInfo< ValueType > >(
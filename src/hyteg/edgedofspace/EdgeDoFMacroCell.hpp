@@ -213,64 +213,70 @@ inline void interpolate( const uint_t&
       srcPtr.push_back( cell.getData( src )->getPointer( Level ) );
    }
 
-   std::vector< ValueType > srcVectorX( srcIds.size() );
-   std::vector< ValueType > srcVectorY( srcIds.size() );
-   std::vector< ValueType > srcVectorZ( srcIds.size() );
-   std::vector< ValueType > srcVectorXY( srcIds.size() );
-   std::vector< ValueType > srcVectorXZ( srcIds.size() );
-   std::vector< ValueType > srcVectorYZ( srcIds.size() );
-   std::vector< ValueType > srcVectorXYZ( srcIds.size() );
+   std::vector< ValueType > srcVector( srcIds.size() );
+
+   const Point3D xShift = xShiftFromVertex( Level, cell );
+   const Point3D yShift = yShiftFromVertex( Level, cell );
+   const Point3D zShift = zShiftFromVertex( Level, cell );
+
+   // the blending map is evaluated for the edge DoFs of one row of micro-edges at a time (single virtual call per row)
+   std::vector< Point3D > coordinates;
+   std::vector< uint_t >  indices;
+   std::vector< Point3D > xBlend;
+
+   const auto processRow = [&]() {
+      cell.getGeometryMap()->evalF( coordinates, xBlend );
+      for ( uint_t i = 0; i < indices.size(); ++i )
+      {
+         const uint_t idx = indices[i];
+         for ( uint_t k = 0; k < srcPtr.size(); ++k )
+         {
+            srcVector[k] = srcPtr[k][idx];
+         }
+         cellData[idx] = expr( xBlend[i], srcVector );
+      }
+      coordinates.clear();
+      indices.clear();
+   };
 
    for ( const auto& it : edgedof::macrocell::Iterator( Level, 0 ) )
    {
-      const Point3D microVertexPosition = vertexdof::macrocell::coordinateFromIndex( Level, cell, it );
-      const Point3D xMicroEdgePosition  = microVertexPosition + xShiftFromVertex( Level, cell );
-      const Point3D yMicroEdgePosition  = microVertexPosition + yShiftFromVertex( Level, cell );
-      const Point3D zMicroEdgePosition  = microVertexPosition + zShiftFromVertex( Level, cell );
-      const Point3D xyMicroEdgePosition = microVertexPosition + xShiftFromVertex( Level, cell ) + yShiftFromVertex( Level, cell );
-      const Point3D xzMicroEdgePosition = microVertexPosition + xShiftFromVertex( Level, cell ) + zShiftFromVertex( Level, cell );
-      const Point3D yzMicroEdgePosition = microVertexPosition + yShiftFromVertex( Level, cell ) + zShiftFromVertex( Level, cell );
-
-      for ( uint_t k = 0; k < srcPtr.size(); ++k )
+      if ( it.x() == 0 && !indices.empty() )
       {
-         srcVectorX[k]  = srcPtr[k][edgedof::macrocell::xIndex( Level, it.x(), it.y(), it.z() )];
-         srcVectorY[k]  = srcPtr[k][edgedof::macrocell::yIndex( Level, it.x(), it.y(), it.z() )];
-         srcVectorZ[k]  = srcPtr[k][edgedof::macrocell::zIndex( Level, it.x(), it.y(), it.z() )];
-         srcVectorXY[k] = srcPtr[k][edgedof::macrocell::xyIndex( Level, it.x(), it.y(), it.z() )];
-         srcVectorXZ[k] = srcPtr[k][edgedof::macrocell::xzIndex( Level, it.x(), it.y(), it.z() )];
-         srcVectorYZ[k] = srcPtr[k][edgedof::macrocell::yzIndex( Level, it.x(), it.y(), it.z() )];
+         processRow();
       }
 
-      Point3D xBlend, yBlend, zBlend, xyBlend, xzBlend, yzBlend;
-      cell.getGeometryMap()->evalF( xMicroEdgePosition, xBlend );
-      cell.getGeometryMap()->evalF( yMicroEdgePosition, yBlend );
-      cell.getGeometryMap()->evalF( zMicroEdgePosition, zBlend );
-      cell.getGeometryMap()->evalF( xyMicroEdgePosition, xyBlend );
-      cell.getGeometryMap()->evalF( xzMicroEdgePosition, xzBlend );
-      cell.getGeometryMap()->evalF( yzMicroEdgePosition, yzBlend );
-      cellData[edgedof::macrocell::xIndex( Level, it.x(), it.y(), it.z() )]  = expr( xBlend, srcVectorX );
-      cellData[edgedof::macrocell::yIndex( Level, it.x(), it.y(), it.z() )]  = expr( yBlend, srcVectorY );
-      cellData[edgedof::macrocell::zIndex( Level, it.x(), it.y(), it.z() )]  = expr( zBlend, srcVectorZ );
-      cellData[edgedof::macrocell::xyIndex( Level, it.x(), it.y(), it.z() )] = expr( xyBlend, srcVectorXY );
-      cellData[edgedof::macrocell::xzIndex( Level, it.x(), it.y(), it.z() )] = expr( xzBlend, srcVectorXZ );
-      cellData[edgedof::macrocell::yzIndex( Level, it.x(), it.y(), it.z() )] = expr( yzBlend, srcVectorYZ );
+      const Point3D microVertexPosition = vertexdof::macrocell::coordinateFromIndex( Level, cell, it );
+
+      coordinates.push_back( microVertexPosition + xShift );
+      coordinates.push_back( microVertexPosition + yShift );
+      coordinates.push_back( microVertexPosition + zShift );
+      coordinates.push_back( microVertexPosition + xShift + yShift );
+      coordinates.push_back( microVertexPosition + xShift + zShift );
+      coordinates.push_back( microVertexPosition + yShift + zShift );
+
+      indices.push_back( edgedof::macrocell::xIndex( Level, it.x(), it.y(), it.z() ) );
+      indices.push_back( edgedof::macrocell::yIndex( Level, it.x(), it.y(), it.z() ) );
+      indices.push_back( edgedof::macrocell::zIndex( Level, it.x(), it.y(), it.z() ) );
+      indices.push_back( edgedof::macrocell::xyIndex( Level, it.x(), it.y(), it.z() ) );
+      indices.push_back( edgedof::macrocell::xzIndex( Level, it.x(), it.y(), it.z() ) );
+      indices.push_back( edgedof::macrocell::yzIndex( Level, it.x(), it.y(), it.z() ) );
    }
+   processRow();
 
    for ( const auto& it : edgedof::macrocell::IteratorXYZ( Level, 0 ) )
    {
-      const Point3D microVertexPosition  = vertexdof::macrocell::coordinateFromIndex( Level, cell, it );
-      const Point3D xyzMicroEdgePosition = microVertexPosition + xShiftFromVertex( Level, cell ) +
-                                           yShiftFromVertex( Level, cell ) + zShiftFromVertex( Level, cell );
-
-      for ( uint_t k = 0; k < srcPtr.size(); ++k )
+      if ( it.x() == 0 && !indices.empty() )
       {
-         srcVectorXYZ[k] = srcPtr[k][edgedof::macrocell::xyzIndex( Level, it.x(), it.y(), it.z() )];
+         processRow();
       }
 
-      Point3D xyzBlend;
-      cell.getGeometryMap()->evalF( xyzMicroEdgePosition, xyzBlend );
-      cellData[edgedof::macrocell::xyzIndex( Level, it.x(), it.y(), it.z() )] = expr( xyzBlend, srcVectorXYZ );
+      const Point3D microVertexPosition = vertexdof::macrocell::coordinateFromIndex( Level, cell, it );
+
+      coordinates.push_back( microVertexPosition + xShift + yShift + zShift );
+      indices.push_back( edgedof::macrocell::xyzIndex( Level, it.x(), it.y(), it.z() ) );
    }
+   processRow();
 }
 
 template < typename ValueType >
@@ -657,7 +663,7 @@ inline void apply( const uint_t&
 {
    auto srcData  = cell.getData( srcId )->getPointer( Level );
    auto dstData  = cell.getData( dstId )->getPointer( Level );
-   auto opr_data = cell.getData( operatorId )->getData( Level );
+   const auto& opr_data = cell.getData( operatorId )->getData( Level );
 
    for ( const auto& it : edgedof::macrocell::Iterator( Level, 0 ) )
    {
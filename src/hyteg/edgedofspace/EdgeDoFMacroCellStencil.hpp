@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+
+#include "core/DataTypes.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/mpi/RecvBuffer.h"
+#include "core/mpi/SendBuffer.h"
+
+#include "hyteg/edgedofspace/EdgeDoFOrientation.hpp"
+#include "hyteg/indexing/Common.hpp"
+
+namespace hyteg {
+namespace edgedof {
+namespace macrocell {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// Number of logical index increments in the 3x3x3 block around a DoF.
+constexpr uint_t numIncrementSlots = 27;
+
+/// Number of edge DoF orientations in a macro-cell.
+constexpr uint_t numOrientations = 7;
+
+/// Returns the lexicographic position of the logical index increment (x, y, z) in the 3x3x3 block around a DoF,
+/// or numIncrementSlots if the increment lies outside of the block.
+constexpr uint_t incrementSlot( const int x, const int y, const int z )
+{
+   return ( x < -1 || x > 1 || y < -1 || y > 1 || z < -1 || z > 1 ) ? numIncrementSlots :
+                                                                       uint_t( 9 * ( x + 1 ) + 3 * ( y + 1 ) + ( z + 1 ) );
+}
+
+/// Returns the number of set bits of the mask below the given slot.
+constexpr uint_t numBitsBelow( const uint32_t mask, const uint_t slot )
+{
+   uint_t num = 0;
+   for ( uint_t i = 0; i < slot; i++ )
+   {
+      num += ( mask >> i ) & 1u;
+   }
+   return num;
+}
+
+/// Bit masks (over incrementSlot()) of the increments from an edge DoF to the neighboring edge DoFs in a macro-cell,
+/// edgeToEdgeMasks[centerOrientation][leafOrientation]. The orientations are ordered as in EdgeDoFOrientation.
+/// The increments are those returned by P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromEdgeDoFInMacroCell().
+constexpr uint32_t edgeToEdgeMasks[numOrientations][numOrientations] = {
+    { 0x00002000, 0x00082000, 0x0028a000, 0x00003c00, 0x00003000, 0x000c3000, 0x00001400 },
+    { 0x00002080, 0x00002000, 0x0000a000, 0x00002010, 0x00002040, 0x00003000, 0x00001010 },
+    { 0x000028a0, 0x00002800, 0x00002000, 0x00002814, 0x00002010, 0x00082410, 0x00000410 },
+    { 0x0001e000, 0x00402000, 0x0140a000, 0x00002000, 0x0000a000, 0x00603000, 0x00003000 },
+    { 0x00006000, 0x00102000, 0x00402000, 0x00002800, 0x00002000, 0x00082000, 0x00002400 },
+    { 0x00006180, 0x00006000, 0x00412080, 0x00006030, 0x00002080, 0x00002000, 0x00002010 },
+    { 0x00014000, 0x00404000, 0x00410000, 0x00006000, 0x00012000, 0x00402000, 0x00002000 } };
+
+/// Bit masks of the increments from an edge DoF to the neighboring vertex DoFs, per orientation of the edge DoF
+/// (see P2Elements::P2Elements3D::getAllVertexDoFNeighborsFromEdgeDoFInMacroCell()).
+constexpr uint32_t vertexToEdgeMasks[numOrientations] = {
+    0x0079e000, 0x0041e080, 0x005168a0, 0x03c1e000, 0x00d16000, 0x00c36180, 0x02c34000 };
+
+/// Bit masks of the increments from a vertex DoF to the neighboring edge DoFs, per orientation of the edge DoFs
+/// (see P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromVertexDoFInMacroCell()).
+constexpr uint32_t edgeToVertexMasks[numOrientations] = {
+    0x00003cf0, 0x00083c10, 0x0028b450, 0x00003c1e, 0x00003458, 0x000c3618, 0x0000161a };
+
+/// Rows of the edge DoF to edge DoF stencil: one per pair of center and leaf orientation.
+struct EdgeToEdgeLayout
+{
+   static constexpr uint_t   numRows() { return numOrientations * numOrientations; }
+   static constexpr uint32_t mask( const uint_t row ) { return edgeToEdgeMasks[row / numOrientations][row % numOrientations]; }
+};
+
+/// Rows of the vertex DoF to edge DoF stencil: one per orientation of the center edge DoF.
+struct VertexToEdgeLayout
+{
+   static constexpr uint_t   numRows() { return numOrientations; }
+   static constexpr uint32_t mask( const uint_t row ) { return vertexToEdgeMasks[row]; }
+};
+
+/// Rows of the edge DoF to vertex DoF stencil: one per orientation of the leaf edge DoFs.
+struct EdgeToVertexLayout
+{
+   static constexpr uint_t   numRows() { return numOrientations; }
+   static constexpr uint32_t mask( const uint_t row ) { return edgeToVertexMasks[row]; }
+};
+
+/// Position of the first weight of the row in a flat stencil. The rows are stored one after another.
+template < typename Layout_T >
+constexpr uint_t rowOffset( const uint_t row )
+{
+   uint_t offset = 0;
+   for ( uint_t r = 0; r < row; r++ )
+   {
+      offset += numBitsBelow( Layout_T::mask( r ), numIncrementSlots );
+   }
+   return offset;
+}
+
+/// Total number of weights of a flat stencil.
+template < typename Layout_T >
+constexpr uint_t flatStencilSize()
+{
+   return rowOffset< Layout_T >( Layout_T::numRows() );
+}
+
+/// Returns the position of the weight of the increment (x, y, z) in the given row of a flat stencil, or
+/// flatStencilSize() if the increment is not part of the row. Within a row, the weights are sorted lexicographically
+/// by their increments.
+template < typename Layout_T >
+constexpr uint_t flatStencilIndex( const uint_t row, const int x, const int y, const int z )
+{
+   return ( incrementSlot( x, y, z ) < numIncrementSlots && ( ( Layout_T::mask( row ) >> incrementSlot( x, y, z ) ) & 1u ) ) ?
+              rowOffset< Layout_T >( row ) + numBitsBelow( Layout_T::mask( row ), incrementSlot( x, y, z ) ) :
+              flatStencilSize< Layout_T >();
+}
+
+static_assert( flatStencilSize< EdgeToEdgeLayout >() == 115, "Unexpected number of edge to edge weights in a macro-cell." );
+static_assert( flatStencilSize< VertexToEdgeLayout >() == 50, "Unexpected number of vertex to edge weights in a macro-cell." );
+static_assert( flatStencilSize< EdgeToVertexLayout >() == 50, "Unexpected number of edge to vertex weights in a macro-cell." );
+static_assert( flatStencilIndex< EdgeToEdgeLayout >( 1, 0, 0, 0 ) == 1, "Unexpected position of the X to Y weight." );
+
+/// \brief View on the weights of one row of a flat stencil, e.g. all edge DoF neighbors of one orientation.
+///
+/// The weights are accessed via their logical index increments like in a std::map.
+template < typename Value_T, typename Layout_T >
+class FlatStencilRow
+{
+ public:
+   FlatStencilRow( Value_T* weights, const uint_t row )
+   : weights_( weights )
+   , row_( row )
+   {}
+
+   Value_T& operator[]( const indexing::IndexIncrement& increment ) const
+   {
+      const uint_t idx = flatStencilIndex< Layout_T >( row_, increment.x(), increment.y(), increment.z() );
+      WALBERLA_ASSERT_LESS( idx, flatStencilSize< Layout_T >(), "Index increment is not part of the macro-cell stencil." );
+      return weights_[idx];
+   }
+
+   Value_T& at( const indexing::IndexIncrement& increment ) const
+   {
+      const uint_t idx = flatStencilIndex< Layout_T >( row_, increment.x(), increment.y(), increment.z() );
+      WALBERLA_CHECK_LESS( idx,
+                           flatStencilSize< Layout_T >(),
+                           "Index increment (" << increment.x() << ", " << increment.y() << ", " << increment.z()
+                                               << ") is not part of the macro-cell stencil." );
+      return weights_[idx];
+   }
+
+   /// Returns 1 if the increment is part of the row and 0 otherwise (like std::map::count()).
+   uint_t count( const indexing::IndexIncrement& increment ) const
+   {
+      return flatStencilIndex< Layout_T >( row_, increment.x(), increment.y(), increment.z() ) < flatStencilSize< Layout_T >() ?
+                 1 :
+                 0;
+   }
+
+   uint_t size() const { return numBitsBelow( Layout_T::mask( row_ ), numIncrementSlots ); }
+
+   /// Returns the row as map[indexOffset] = weight.
+   std::map< indexing::IndexIncrement, real_t > toMap() const
+   {
+      std::map< indexing::IndexIncrement, real_t > stencilMap;
+      for ( int x = -1; x <= 1; x++ )
+      {
+         for ( int y = -1; y <= 1; y++ )
+         {
+            for ( int z = -1; z <= 1; z++ )
+            {
+               const uint_t idx = flatStencilIndex< Layout_T >( row_, x, y, z );
+               if ( idx < flatStencilSize< Layout_T >() )
+               {
+                  stencilMap[indexing::IndexIncrement( x, y, z )] = weights_[idx];
+               }
+            }
+         }
+      }
+      return stencilMap;
+   }
+
+ private:
+   Value_T* weights_;
+   uint_t   row_;
+};
+
+/// \brief Constant stencil in a macro-cell whose weights are indexed by one edge DoF orientation and an index increment.
+///
+/// Used for the vertex DoF to edge DoF stencil (rows: orientation of the center edge DoF) and the edge DoF to vertex
+/// DoF stencil (rows: orientation of the leaf edge DoFs). The weights are stored contiguously in a fixed-size array,
+/// stencil[orientation][indexOffset] returns a reference to the weight like the nested map it replaces.
+template < typename Layout_T >
+class FlatOrientationStencil
+{
+ public:
+   typedef std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > Map_T;
+
+   FlatOrientationStencil() { weights_.fill( real_t( 0 ) ); }
+
+   FlatStencilRow< real_t, Layout_T > operator[]( const edgedof::EdgeDoFOrientation& orientation )
+   {
+      return FlatStencilRow< real_t, Layout_T >( weights_.data(), static_cast< uint_t >( orientation ) );
+   }
+
+   FlatStencilRow< const real_t, Layout_T > operator[]( const edgedof::EdgeDoFOrientation& orientation ) const
+   {
+      return FlatStencilRow< const real_t, Layout_T >( weights_.data(), static_cast< uint_t >( orientation ) );
+   }
+
+   /// Returns the weights as map[orientation][indexOffset] = weight, as expected by the generated kernels.
+   Map_T toMap() const
+   {
+      Map_T stencilMap;
+      for ( uint_t row = 0; row < numOrientations; row++ )
+      {
+         const auto orientation  = static_cast< edgedof::EdgeDoFOrientation >( row );
+         stencilMap[orientation] = ( *this )[orientation].toMap();
+      }
+      return stencilMap;
+   }
+
+   real_t*       data() { return weights_.data(); }
+   const real_t* data() const { return weights_.data(); }
+
+   static constexpr uint_t size() { return flatStencilSize< Layout_T >(); }
+
+ private:
+   std::array< real_t, flatStencilSize< Layout_T >() > weights_;
+};
+
+/// Vertex DoF to edge DoF stencil of a macro-cell: stencil[centerOrientation][indexOffset] = weight
+typedef FlatOrientationStencil< VertexToEdgeLayout > VertexToEdgeFlatStencil;
+
+/// Edge DoF to vertex DoF stencil of a macro-cell: stencil[leafOrientation][indexOffset] = weight
+typedef FlatOrientationStencil< EdgeToVertexLayout > EdgeToVertexFlatStencil;
+
+/// \brief Constant edge DoF to edge DoF stencil of a macro-cell, stored in a fixed-size array.
+///
+/// stencil[centerOrientation][leafOrientation][indexOffset] returns a reference to the weight like the nested map it
+/// replaces. The 115 weights are stored contiguously, grouped by center and leaf orientation.
+class EdgeToEdgeFlatStencil
+{
+ public:
+   typedef std::map< edgedof::EdgeDoFOrientation,
+                     std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > >
+       Map_T;
+
+   /// All rows of one center orientation.
+   template < typename Value_T >
+   class CenterView
+   {
+    public:
+      CenterView( Value_T* weights, const uint_t center )
+      : weights_( weights )
+      , center_( center )
+      {}
+
+      FlatStencilRow< Value_T, EdgeToEdgeLayout > operator[]( const edgedof::EdgeDoFOrientation& leafOrientation ) const
+      {
+         const uint_t row = center_ * numOrientations + static_cast< uint_t >( leafOrientation );
+         return FlatStencilRow< Value_T, EdgeToEdgeLayout >( weights_, row );
+      }
+
+    private:
+      Value_T* weights_;
+      uint_t   center_;
+   };
+
+   EdgeToEdgeFlatStencil() { weights_.fill( real_t( 0 ) ); }
+
+   CenterView< real_t > operator[]( const edgedof::EdgeDoFOrientation& centerOrientation )
+   {
+      return CenterView< real_t >( weights_.data(), static_cast< uint_t >( centerOrientation ) );
+   }
+
+   CenterView< const real_t > operator[]( const edgedof::EdgeDoFOrientation& centerOrientation ) const
+   {
+      return CenterView< const real_t >( weights_.data(), static_cast< uint_t >( centerOrientation ) );
+   }
+
+   /// Returns the weights as map[centerOrientation][leafOrientation][indexOffset] = weight, as expected by the
+   /// generated kernels.
+   Map_T toMap() const
+   {
+      Map_T stencilMap;
+      for ( uint_t center = 0; center < numOrientations; center++ )
+      {
+         for ( uint_t leaf = 0; leaf < numOrientations; leaf++ )
+         {
+            const auto centerOrientation                   = static_cast< edgedof::EdgeDoFOrientation >( center );
+            const auto leafOrientation                     = static_cast< edgedof::EdgeDoFOrientation >( leaf );
+            stencilMap[centerOrientation][leafOrientation] = ( *this )[centerOrientation][leafOrientation].toMap();
+         }
+      }
+      return stencilMap;
+   }
+
+   real_t*       data() { return weights_.data(); }
+   const real_t* data() const { return weights_.data(); }
+
+   static constexpr uint_t size() { return flatStencilSize< EdgeToEdgeLayout >(); }
+
+ private:
+   std::array< real_t, flatStencilSize< EdgeToEdgeLayout >() > weights_;
+};
+
+} // namespace macrocell
+} // namespace edgedof
+} // namespace hyteg
+
+namespace walberla {
+namespace mpi {
+
+template < typename T, // Element type of SendBuffer
+           typename G, // Growth policy of SendBuffer
+           typename Layout_T >
+inline mpi::GenericSendBuffer< T, G >& operator<<( mpi::GenericSendBuffer< T, G >&                                    buffer,
+                                                   const hyteg::edgedof::macrocell::FlatOrientationStencil< Layout_T >& stencil )
+{
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      buffer << stencil.data()[i];
+   }
+   return buffer;
+}
+
+template < typename T, // Element type  of RecvBuffer
+           typename Layout_T >
+inline mpi::GenericRecvBuffer< T >& operator>>( mpi::GenericRecvBuffer< T >&                                  buffer,
+                                                hyteg::edgedof::macrocell::FlatOrientationStencil< Layout_T >& stencil )
+{
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      buffer >> stencil.data()[i];
+   }
+   return buffer;
+}
+
+template < typename T, // Element type of SendBuffer
+           typename G  // Growth policy of SendBuffer
+           >
+inline mpi::GenericSendBuffer< T, G >& operator<<( mpi::GenericSendBuffer< T, G >&                          buffer,
+                                                   const hyteg::edgedof::macrocell::EdgeToEdgeFlatStencil& stencil )
+{
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      buffer << stencil.data()[i];
+   }
+   return buffer;
+}
+
+template < typename T // Element type  of RecvBuffer
+           >
+inline mpi::GenericRecvBuffer< T >& operator>>( mpi::GenericRecvBuffer< T >&                      buffer,
+                                                hyteg::edgedof::macrocell::EdgeToEdgeFlatStencil& stencil )
+{
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      buffer >> stencil.data()[i];
+   }
+   return buffer;
+}
+
+} // namespace mpi
+} // namespace walberla
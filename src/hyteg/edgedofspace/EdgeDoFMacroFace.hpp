@@ -254,9 +254,7 @@ inline void interpolate( const uint_t&
       srcPtr.push_back( face.getData( src )->getPointer( Level ) );
    }
 
-   std::vector< ValueType > srcVectorHorizontal( srcIds.size() );
-   std::vector< ValueType > srcVectorVertical( srcIds.size() );
-   std::vector< ValueType > srcVectorDiagonal( srcIds.size() );
+   std::vector< ValueType > srcVector( srcIds.size() );
 
    const Point3D faceBottomLeftCoords  = face.coords[0];
    const Point3D faceBottomRightCoords = face.coords[1];
@@ -267,10 +265,33 @@ inline void interpolate( const uint_t&
    const Point3D verticalMicroEdgeOffset =
        ( ( faceTopLeftCoords - faceBottomLeftCoords ) / real_c( levelinfo::num_microedges_per_edge( Level ) ) ) * 0.5;
 
-   Point3D xBlend;
+   // the blending map is evaluated for the edge DoFs of one row of micro-edges at a time (single virtual call per row)
+   std::vector< Point3D > coordinates;
+   std::vector< uint_t >  indices;
+   std::vector< Point3D > xBlend;
+
+   const auto processRow = [&]() {
+      face.getGeometryMap()->evalF( coordinates, xBlend );
+      for ( uint_t i = 0; i < indices.size(); ++i )
+      {
+         const uint_t idx = indices[i];
+         for ( uint_t k = 0; k < srcPtr.size(); ++k )
+         {
+            srcVector[k] = srcPtr[k][idx];
+         }
+         faceData[idx] = expr( xBlend[i], srcVector );
+      }
+      coordinates.clear();
+      indices.clear();
+   };
 
    for ( const auto& it : edgedof::macroface::Iterator( Level, 0 ) )
    {
+      if ( it.col() == 0 && !indices.empty() )
+      {
+         processRow();
+      }
+
       const Point3D horizontalMicroEdgePosition =
           faceBottomLeftCoords +
           ( ( real_c( it.col() ) * 2 + 1 ) * horizontalMicroEdgeOffset + ( real_c( it.row() ) * 2 ) * verticalMicroEdgeOffset );
@@ -282,39 +303,25 @@ inline void interpolate( const uint_t&
       // Do not update horizontal DoFs at bottom
       if ( it.row() != 0 )
       {
-         for ( uint_t k = 0; k < srcPtr.size(); ++k )
-         {
-            srcVectorHorizontal[k] = srcPtr[k][edgedof::macroface::horizontalIndex( Level, it.col(), it.row() )];
-         }
-
-         face.getGeometryMap()->evalF( horizontalMicroEdgePosition, xBlend );
-         faceData[edgedof::macroface::horizontalIndex( Level, it.col(), it.row() )] = expr( xBlend, srcVectorHorizontal );
+         coordinates.push_back( horizontalMicroEdgePosition );
+         indices.push_back( edgedof::macroface::horizontalIndex( Level, it.col(), it.row() ) );
       }
 
       // Do not update vertical DoFs at left border
       if ( it.col() != 0 )
       {
-         for ( uint_t k = 0; k < srcPtr.size(); ++k )
-         {
-            srcVectorVertical[k] = srcPtr[k][edgedof::macroface::verticalIndex( Level, it.col(), it.row() )];
-         }
-
-         face.getGeometryMap()->evalF( verticalMicroEdgePosition, xBlend );
-         faceData[edgedof::macroface::verticalIndex( Level, it.col(), it.row() )] = expr( xBlend, srcVectorVertical );
+         coordinates.push_back( verticalMicroEdgePosition );
+         indices.push_back( edgedof::macroface::verticalIndex( Level, it.col(), it.row() ) );
       }
 
       // Do not update diagonal DoFs at diagonal border
       if ( it.col() + it.row() != ( hyteg::levelinfo::num_microedges_per_edge( Level ) - 1 ) )
       {
-         for ( uint_t k = 0; k < srcPtr.size(); ++k )
-         {
-            srcVectorDiagonal[k] = srcPtr[k][edgedof::macroface::diagonalIndex( Level, it.col(), it.row() )];
-         }
-
-         face.getGeometryMap()->evalF( diagonalMicroEdgePosition, xBlend );
-         faceData[edgedof::macroface::diagonalIndex( Level, it.col(), it.row() )] = expr( xBlend, srcVectorDiagonal );
+         coordinates.push_back( diagonalMicroEdgePosition );
+         indices.push_back( edgedof::macroface::diagonalIndex( Level, it.col(), it.row() ) );
       }
    }
+   processRow();
 }
 
 template < typename ValueType >
@@ -291,6 +291,21 @@ void EdgeDoFOperator< EdgeDoFForm >::apply(const EdgeDoFFunction<real_t> &src,co
 
   if ( level >= 1 )
   {
+     KernelRegion kernelRegion( std::string( "apply_3D_macrocell_edgedof_to_edgedof_" ) +
+                                    ( updateType == Replace ? "replace" : "add" ),
+                                level,
+                                hyteg::globalDefines::useGeneratedKernels && storage_->hasGlobalCells() );
+     if ( kernelRegion.recordsStatistics() && !storage_->getCells().empty() )
+     {
+        const uint_t numDoFs = kernelcost::numMacroPrimitivesWithFlag( storage_->getCells(), dst, flag ) *
+                               kernelcost::numInnerEdgeDoFsPerCell( level );
+        kernelRegion.setCost( kernelcost::constantStencilApply(
+            numDoFs,
+            numDoFs,
+            double( edgedof::macrocell::StencilMap_T::size() ) / double( edgedof::macrocell::numOrientations ),
+            updateType ) );
+     }
+
      std::vector< PrimitiveID > cellIDs = this->getStorage()->getCellIDs();
      #ifdef WALBERLA_BUILD_WITH_OPENMP
    #pragma omp parallel for default(shared)
@@ -307,7 +322,7 @@ void EdgeDoFOperator< EdgeDoFForm >::apply(const EdgeDoFFunction<real_t> &src,co
           typedef edgedof::EdgeDoFOrientation eo;
           auto dstData = cell.getData( dst.getCellDataID())->getPointer( level );
           auto srcData = cell.getData( src.getCellDataID())->getPointer( level );
-          auto stencilData = cell.getData( cellStencilID_ )->getData( level );
+          const auto stencilData = cell.getData( cellStencilID_ )->getData( level ).toMap();
           std::map< eo, uint_t > firstIdx;
           for ( auto e : edgedof::allEdgeDoFOrientations )
             firstIdx[e] = edgedof::macrocell::index( level, 0, 0, 0, e );
@@ -363,6 +378,18 @@ void EdgeDoFOperator< EdgeDoFForm >::apply(const EdgeDoFFunction<real_t> &src,co
 
   if ( level >= 1 )
   {
+     KernelRegion kernelRegion( std::string( "apply_2D_macroface_edgedof_to_edgedof_" ) +
+                                    ( updateType == Replace ? "replace" : "add" ),
+                                level,
+                                hyteg::globalDefines::useGeneratedKernels && !storage_->hasGlobalCells() );
+     if ( kernelRegion.recordsStatistics() )
+     {
+        // 15 weights for the three edge DoF orientations
+        const uint_t numDoFs = kernelcost::numMacroPrimitivesWithFlag( storage_->getFaces(), dst, flag ) *
+                               kernelcost::numInnerEdgeDoFsPerFace( level );
+        kernelRegion.setCost( kernelcost::constantStencilApply( numDoFs, numDoFs, 5.0, updateType ) );
+     }
+
      std::vector< PrimitiveID > faceIDs = this->getStorage()->getFaceIDs();
      #ifdef WALBERLA_BUILD_WITH_OPENMP
    #pragma omp parallel for default(shared)
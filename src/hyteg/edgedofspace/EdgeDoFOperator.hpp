@@ -208,7 +208,7 @@ void assembleEdgeToEdgeStencils(
                       form );
                   for ( const auto stencilIt : edgeToEdgeStencilMap )
                   {
-                     edgeToEdgeStencilMemory[centerOrientation][leafOrientation][stencilIt.first] = stencilIt.second;
+                     edgeToEdgeStencilMemory[centerOrientation][leafOrientation].at( stencilIt.first ) = stencilIt.second;
                   }
                }
             }
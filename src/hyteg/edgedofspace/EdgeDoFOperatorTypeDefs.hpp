@@ -23,6 +23,8 @@
 
 #include "core/DataTypes.h"
 
+#include "hyteg/edgedofspace/EdgeDoFMacroCellStencil.hpp"
+
 namespace hyteg {
 
 namespace indexing {
@@ -34,8 +36,6 @@ namespace edgedof {
 using walberla::real_t;
 using walberla::uint_t;
 
-enum class EdgeDoFOrientation : walberla::uint_t;
-
 namespace macroedge {
 
 /// map[neighborCellID][centerOrientation][leafOrientation][indexOffset] = weight
@@ -59,9 +59,7 @@ typedef std::map< uint_t,
 namespace macrocell {
 
 /// map[centerOrientation][leafOrientation][indexOffset] = weight
-typedef std::map< edgedof::EdgeDoFOrientation,
-                  std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > >
-    StencilMap_T;
+typedef EdgeToEdgeFlatStencil StencilMap_T;
 
 } // namespace macrocell
 
@@ -517,7 +517,7 @@ inline void saveCellOperator( const uint_t&
 {
    auto srcData  = cell.getData( srcId )->getPointer( Level );
    auto dstData  = cell.getData( dstId )->getPointer( Level );
-   auto opr_data = cell.getData( operatorId )->getData( Level );
+   const auto& opr_data = cell.getData( operatorId )->getData( Level );
 
    for ( const auto& it : edgedof::macrocell::Iterator( Level, 0 ) )
    {
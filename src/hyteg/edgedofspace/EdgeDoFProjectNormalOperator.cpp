@@ -26,6 +26,23 @@
 
 namespace hyteg {
 
+/// Computes the normals of the edge DoFs of a macro-primitive on the domain boundary.
+static void computeNormals( const std::shared_ptr< PrimitiveStorage >&               storage,
+                            const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                            const PrimitiveID&                                       primitiveID,
+                            const uint_t&                                            level,
+                            FreeslipNormals&                                         normals )
+{
+   if ( storage->edgeExistsLocally( primitiveID ) && level >= 1 )
+   {
+      edgedof::macroedge::computeNormals( level, *storage->getEdge( primitiveID ), normal_function, normals );
+   }
+   else if ( storage->faceExistsLocally( primitiveID ) && storage->hasGlobalCells() && level >= 2 )
+   {
+      edgedof::macroface::computeNormals3D( level, *storage->getFace( primitiveID ), normal_function, normals );
+   }
+}
+
 EdgeDoFProjectNormalOperator::EdgeDoFProjectNormalOperator(
     const std::shared_ptr< PrimitiveStorage >&               storage,
     size_t                                                   minLevel,
@@ -33,6 +50,12 @@ EdgeDoFProjectNormalOperator::EdgeDoFProjectNormalOperator(
     const std::function< void( const Point3D&, Point3D& ) >& normal_function )
 : Operator( storage, minLevel, maxLevel )
 , normal_function_( normal_function )
+, normals_( storage,
+            minLevel,
+            maxLevel,
+            [storage, normal_function]( const PrimitiveID& primitiveID, const uint_t& level, FreeslipNormals& normals ) {
+               computeNormals( storage, normal_function, primitiveID, level, normals );
+            } )
 {}
 
 void EdgeDoFProjectNormalOperator::apply( const EdgeDoFFunction< real_t >& dst_u,
@@ -83,15 +106,20 @@ void EdgeDoFProjectNormalOperator::apply( const EdgeDoFFunction< real_t >& dst_u
          const DoFType edgeBC = dst_u.getBoundaryCondition().getBoundaryType( edge.getMeshBoundaryFlag() );
          if ( testFlag( edgeBC, flag ) )
          {
+            const FreeslipNormals& normals = normals_.get( edge.getID(), level );
+
             if ( storage_->hasGlobalCells() )
             {
-               edgedof::macroedge::projectNormal3D< real_t >(
-                   level, edge, storage_, normal_function_, dst_u.getEdgeDataID(), dst_v.getEdgeDataID(), dst_w.getEdgeDataID() );
+               applyNormalProjection3D( normals,
+                                        edge.getData( dst_u.getEdgeDataID() )->getPointer( level ),
+                                        edge.getData( dst_v.getEdgeDataID() )->getPointer( level ),
+                                        edge.getData( dst_w.getEdgeDataID() )->getPointer( level ) );
             }
             else
             {
-               edgedof::macroedge::projectNormal2D< real_t >(
-                   level, edge, storage_, normal_function_, dst_u.getEdgeDataID(), dst_v.getEdgeDataID() );
+               applyNormalProjection2D( normals,
+                                        edge.getData( dst_u.getEdgeDataID() )->getPointer( level ),
+                                        edge.getData( dst_v.getEdgeDataID() )->getPointer( level ) );
             }
          }
       }
@@ -112,8 +140,12 @@ void EdgeDoFProjectNormalOperator::apply( const EdgeDoFFunction< real_t >& dst_u
          {
             if ( storage_->hasGlobalCells() )
             {
-               edgedof::macroface::projectNormal3D< real_t >(
-                   level, face, storage_, normal_function_, dst_u.getFaceDataID(), dst_v.getFaceDataID(), dst_w.getFaceDataID() );
+               const FreeslipNormals& normals = normals_.get( face.getID(), level );
+
+               applyNormalProjection3D( normals,
+                                        face.getData( dst_u.getFaceDataID() )->getPointer( level ),
+                                        face.getData( dst_v.getFaceDataID() )->getPointer( level ),
+                                        face.getData( dst_w.getFaceDataID() )->getPointer( level ) );
             }
          }
       }
@@ -24,6 +24,7 @@
 #include "hyteg/Levelinfo.hpp"
 #include "hyteg/petsc/PETScWrapper.hpp"
 #include "hyteg/Operator.hpp"
+#include "hyteg/boundary/FreeslipNormals.hpp"
 #include "hyteg/sparseassembly/SparseMatrixProxy.hpp"
 #include "hyteg/edgedofspace/EdgeDoFFunction.hpp"
 #include "hyteg/edgedofspace/EdgeDoFIndexing.hpp"
@@ -66,6 +67,9 @@ class EdgeDoFProjectNormalOperator final : public Operator< hyteg::EdgeDoFFuncti
 
  private:
    const std::function< void( const Point3D&, Point3D& ) > normal_function_;
+
+   /// normals of the projected DoFs, computed on construction for the macro-primitives on the domain boundary
+   mutable FreeslipNormalCache normals_;
 };
 
 } // namespace hyteg
@@ -23,6 +23,7 @@
 
 #include "hyteg/Levelinfo.hpp"
 #include "hyteg/Macros.hpp"
+#include "hyteg/boundary/FreeslipNormals.hpp"
 #include "hyteg/indexing/Common.hpp"
 #include "hyteg/p1functionspace/P1Elements.hpp"
 #include "hyteg/p1functionspace/VertexDoFMacroEdge.hpp"
@@ -60,26 +61,13 @@ void projectionMatrix3D( const Point3D& normal, Matrix3r& projection )
 
 namespace macroface {
 
-template < typename ValueType >
-inline void projectNormal3D( uint_t                                                      level,
-                             const Face&                                                 face,
-                             const std::shared_ptr< PrimitiveStorage >&                  storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&    normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstIdV,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstIdW )
+/// Computes the normals at all inner edge DoFs of a macro-face on the boundary of a 3D domain.
+inline void computeNormals3D( uint_t                                                   level,
+                              const Face&                                              face,
+                              const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                              FreeslipNormals&                                         freeslipNormals )
 {
-   auto dstU = face.getData( dstIdU )->getPointer( level );
-   auto dstV = face.getData( dstIdV )->getPointer( level );
-   auto dstW = face.getData( dstIdW )->getPointer( level );
-
-   Point3D  normal;
-   Matrix3r projection;
-   Point3D  in;
-   Point3D  out;
-
-   Point3D x;
-   Point3D xBlend;
+   std::vector< Point3D > x;
 
    const Point3D faceBottomLeftCoords  = face.coords[0];
    const Point3D faceBottomRightCoords = face.coords[1];
@@ -103,62 +91,32 @@ inline void projectNormal3D( uint_t
       // Do not update horizontal DoFs at bottom
       if ( it.row() != 0 )
       {
-         face.getGeometryMap()->evalF( horizontalMicroEdgePosition, xBlend );
-         normal_function( xBlend, normal );
-         projectionMatrix3D( normal, projection );
-
-         const uint_t idx = edgedof::macroface::horizontalIndex( level, it.col(), it.row() );
-
-         in[0] = dstU[idx];
-         in[1] = dstV[idx];
-         in[2] = dstW[idx];
-
-         out = projection.mul( in );
-
-         dstU[idx] = out[0];
-         dstV[idx] = out[1];
-         dstW[idx] = out[2];
+         x.push_back( horizontalMicroEdgePosition );
+         freeslipNormals.indices.push_back( edgedof::macroface::horizontalIndex( level, it.col(), it.row() ) );
       }
 
       // Do not update vertical DoFs at left border
       if ( it.col() != 0 )
       {
-         face.getGeometryMap()->evalF( verticalMicroEdgePosition, xBlend );
-         normal_function( xBlend, normal );
-         projectionMatrix3D( normal, projection );
-
-         const uint_t idx = edgedof::macroface::verticalIndex( level, it.col(), it.row() );
-
-         in[0] = dstU[idx];
-         in[1] = dstV[idx];
-         in[2] = dstW[idx];
-
-         out = projection.mul( in );
-
-         dstU[idx] = out[0];
-         dstV[idx] = out[1];
-         dstW[idx] = out[2];
+         x.push_back( verticalMicroEdgePosition );
+         freeslipNormals.indices.push_back( edgedof::macroface::verticalIndex( level, it.col(), it.row() ) );
       }
 
       // Do not update diagonal DoFs at diagonal border
       if ( it.col() + it.row() != ( hyteg::levelinfo::num_microedges_per_edge( level ) - 1 ) )
       {
-         face.getGeometryMap()->evalF( diagonalMicroEdgePosition, xBlend );
-         normal_function( xBlend, normal );
-         projectionMatrix3D( normal, projection );
-
-         const uint_t idx = edgedof::macroface::diagonalIndex( level, it.col(), it.row() );
-
-         in[0] = dstU[idx];
-         in[1] = dstV[idx];
-         in[2] = dstW[idx];
+         x.push_back( diagonalMicroEdgePosition );
+         freeslipNormals.indices.push_back( edgedof::macroface::diagonalIndex( level, it.col(), it.row() ) );
+      }
+   }
 
-         out = projection.mul( in );
+   std::vector< Point3D > xBlend;
+   face.getGeometryMap()->evalF( x, xBlend );
 
-         dstU[idx] = out[0];
-         dstV[idx] = out[1];
-         dstW[idx] = out[2];
-      }
+   freeslipNormals.normals.resize( xBlend.size() );
+   for ( uint_t i = 0; i < xBlend.size(); i++ )
+   {
+      normal_function( xBlend[i], freeslipNormals.normals[i] );
    }
 }
 
@@ -166,93 +124,32 @@ inline void projectNormal3D( uint_t
 
 namespace macroedge {
 
-template < typename ValueType >
-inline void projectNormal2D( uint_t                                                      level,
-                             const Edge&                                                 edge,
-                             const std::shared_ptr< PrimitiveStorage >&                  storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&    normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdV )
+/// Computes the normals at all edge DoFs of a macro-edge on the domain boundary (2D and 3D).
+inline void computeNormals( uint_t                                                   level,
+                            const Edge&                                              edge,
+                            const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                            FreeslipNormals&                                         freeslipNormals )
 {
-   auto dstU = edge.getData( dstIdU )->getPointer( level );
-   auto dstV = edge.getData( dstIdV )->getPointer( level );
-
    const Point3D leftCoords  = edge.getCoordinates()[0];
    const Point3D rightCoords = edge.getCoordinates()[1];
 
    const Point3D microEdgeOffset = ( rightCoords - leftCoords ) / real_c( 2 * levelinfo::num_microedges_per_edge( level ) );
 
-   Point3D  normal;
-   Matrix2r projection;
-   Point2D  in;
-   Point2D  out;
-
-   Point3D xPhy;
-
+   std::vector< Point3D > x;
    for ( const auto& it : edgedof::macroedge::Iterator( level ) )
    {
-      const Point3D currentCoordinates = leftCoords + microEdgeOffset + real_c( 2 ) * it.col() * microEdgeOffset;
-      edge.getGeometryMap()->evalF( currentCoordinates, xPhy );
-
-      normal_function( xPhy, normal );
-      projectionMatrix2D( normal, projection );
-
-      const uint_t idx = edgedof::macroedge::indexFromHorizontalEdge( level, it.col(), stencilDirection::EDGE_HO_C );
-
-      in[0] = dstU[idx];
-      in[1] = dstV[idx];
-
-      out = projection.mul( in );
-
-      dstU[idx] = out[0];
-      dstV[idx] = out[1];
+      x.push_back( leftCoords + microEdgeOffset + real_c( 2 ) * it.col() * microEdgeOffset );
+      freeslipNormals.indices.push_back(
+          edgedof::macroedge::indexFromHorizontalEdge( level, it.col(), stencilDirection::EDGE_HO_C ) );
    }
-}
-
-template < typename ValueType >
-inline void projectNormal3D( uint_t                                                      level,
-                             const Edge&                                                 edge,
-                             const std::shared_ptr< PrimitiveStorage >&                  storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&    normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdV,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdW )
-{
-   auto dstU = edge.getData( dstIdU )->getPointer( level );
-   auto dstV = edge.getData( dstIdV )->getPointer( level );
-   auto dstW = edge.getData( dstIdW )->getPointer( level );
-
-   const Point3D leftCoords  = edge.getCoordinates()[0];
-   const Point3D rightCoords = edge.getCoordinates()[1];
 
-   const Point3D microEdgeOffset = ( rightCoords - leftCoords ) / real_c( 2 * levelinfo::num_microedges_per_edge( level ) );
-
-   Point3D  normal;
-   Matrix3r projection;
-   Point3D  in;
-   Point3D  out;
-
-   Point3D xPhy;
+   std::vector< Point3D > xPhy;
+   edge.getGeometryMap()->evalF( x, xPhy );
 
-   for ( const auto& it : edgedof::macroedge::Iterator( level ) )
+   freeslipNormals.normals.resize( xPhy.size() );
+   for ( uint_t i = 0; i < xPhy.size(); i++ )
    {
-      const Point3D currentCoordinates = leftCoords + microEdgeOffset + real_c( 2 ) * it.col() * microEdgeOffset;
-      edge.getGeometryMap()->evalF( currentCoordinates, xPhy );
-
-      normal_function( xPhy, normal );
-      projectionMatrix3D( normal, projection );
-
-      const uint_t idx = edgedof::macroedge::indexFromHorizontalEdge( level, it.col(), stencilDirection::EDGE_HO_C );
-
-      in[0] = dstU[idx];
-      in[1] = dstV[idx];
-      in[2] = dstW[idx];
-
-      out = projection.mul( in );
-
-      dstU[idx] = out[0];
-      dstV[idx] = out[1];
-      dstW[idx] = out[2];
+      normal_function( xPhy[i], freeslipNormals.normals[i] );
    }
 }
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <set>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/celldofspace/CellDoFIndexing.hpp"
+#include "hyteg/geometry/BlendedPrimitiveMemory.hpp"
+#include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+namespace elementmatrixcache {
+
+/// Number of entries that are reserved for the micro-faces of a macro-face.
+/// Some of the entries are not used, so that the index can be computed directly from the micro-vertex index.
+inline uint_t numMicroFaces( const uint_t& level )
+{
+   return 2 * levelinfo::num_microvertices_per_face( level );
+}
+
+/// Linear index of a micro-face in [0, numMicroFaces( level )).
+///
+/// \param level    refinement level
+/// \param xIdx     column index of the micro-vertex that specifies the micro-face
+/// \param yIdx     row index of the micro-vertex that specifies the micro-face
+/// \param elIdx    0 for the micro-face elementN, 1 for the micro-face elementNW of the micro-vertex
+inline uint_t microFaceIndex( const uint_t& level, const uint_t& xIdx, const uint_t& yIdx, const uint_t& elIdx )
+{
+   return elIdx * levelinfo::num_microvertices_per_face( level ) + vertexdof::macroface::index( level, xIdx, yIdx );
+}
+
+/// Number of entries that are reserved for the micro-cells of a macro-cell.
+inline uint_t numMicroCells( const uint_t& level )
+{
+   return levelinfo::num_microcells_per_cell( level );
+}
+
+/// Linear index of a micro-cell in [0, numMicroCells( level )).
+inline uint_t microCellIndex( const uint_t& level, const indexing::Index& microCell, const celldof::CellType& cType )
+{
+   return celldof::macrocell::index( level, microCell.x(), microCell.y(), microCell.z(), cType );
+}
+
+} // namespace elementmatrixcache
+
+/// \brief Stores the local element matrices of all micro-elements of non-affinely mapped macro-primitives.
+///
+/// On macro-primitives with a blending map the micro-elements are not congruent, and the forms evaluate the
+/// geometry map and its Jacobian at the quadrature points of each micro-element in every apply. With this cache,
+/// the integrated local element matrix of each micro-element is stored once, so that the apply reduces to
+/// gather, matrix-vector product and scatter.
+///
+/// The matrices are stored as FunctionMemory on the macro-primitives (see BlendedPrimitiveMemory) and are migrated
+/// together with them. The memory grows by a factor of 8 (4 in 2D) per refinement level. Therefore, only the
+/// coarsest levels whose accumulated memory fits into a given budget are cached. On the remaining levels, the
+/// operators keep integrating on-the-fly.
+///
+/// After a modification of the storage, isOutdated() returns true and the owner must allocate and integrate the
+/// matrices again, since the level selection depends on the distribution of the primitives.
+///
+/// The matrices are indexed via the functions in namespace elementmatrixcache.
+template < typename ElementMatrix_T, typename PrimitiveType >
+class BlendedElementMatrixCache
+{
+   static_assert( sizeof( ElementMatrix_T ) % sizeof( real_t ) == 0, "Element matrix must consist of real_t entries only." );
+
+ public:
+   /// Selects the cached levels and allocates the matrices on all local non-affinely mapped macro-primitives.
+   /// The matrices are zero-initialized. Must be called collectively.
+   ///
+   /// \param storage              the storage of the operator
+   /// \param minLevel             coarsest level that may be cached
+   /// \param maxLevel             finest level that may be cached
+   /// \param numElementMatrices   number of matrices per macro-primitive on the passed level
+   /// \param memoryBudgetInBytes  maximum memory per process
+   void allocate( const std::shared_ptr< PrimitiveStorage >& storage,
+                  const uint_t&                              minLevel,
+                  const uint_t&                              maxLevel,
+                  const std::function< uint_t( uint_t ) >&   numElementMatrices,
+                  const uint_t&                              memoryBudgetInBytes )
+   {
+      memory_.allocate(
+          storage,
+          minLevel,
+          maxLevel,
+          [&numElementMatrices]( uint_t level ) { return numElementMatrices( level ) * entriesPerMatrix; },
+          memoryBudgetInBytes );
+   }
+
+   /// Returns true if the storage has been modified since the last allocation.
+   bool isOutdated() const { return memory_.isOutdated(); }
+
+   /// Returns true if the matrices on the passed level are cached.
+   bool isCached( const uint_t& level ) const { return memory_.isCached( level ); }
+
+   const std::set< uint_t >& getCachedLevels() const { return memory_.getCachedLevels(); }
+
+   /// Returns a pointer to the matrices of the passed macro-primitive and level, or nullptr if they are not cached.
+   ElementMatrix_T* get( const PrimitiveType& primitive, const uint_t& level ) const
+   {
+      return reinterpret_cast< ElementMatrix_T* >( memory_.get( primitive, level ) );
+   }
+
+   /// Returns the memory that is occupied by the matrices on this process.
+   uint_t memoryInBytes() const { return memory_.memoryInBytes(); }
+
+   void clear() { memory_.clear(); }
+
+ private:
+   static constexpr uint_t entriesPerMatrix = sizeof( ElementMatrix_T ) / sizeof( real_t );
+
+   BlendedPrimitiveMemory< PrimitiveType > memory_;
+};
+
+} // namespace hyteg
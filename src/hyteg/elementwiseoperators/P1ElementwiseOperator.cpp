@@ -47,6 +47,7 @@ P1ElementwiseOperator< P1Form >::P1ElementwiseOperator( const std::shared_ptr< P
                                                         bool                                       needsInverseDiagEntries )
 : Operator( storage, minLevel, maxLevel )
 , form_( form )
+, blendedLocalElementMatricesMemoryBudget_( 0 )
 {
    if ( needsInverseDiagEntries )
    {
@@ -65,6 +66,12 @@ void P1ElementwiseOperator< P1Form >::apply( const P1Function< real_t >& src,
 
    this->startTiming( "apply" );
 
+   // the cached levels of the blended element matrices depend on the distribution of the macro-primitives
+   if ( blendedElementMatrices2D_.isOutdated() || blendedElementMatrices3D_.isOutdated() )
+   {
+      integrateBlendedLocalElementMatrices();
+   }
+
    // Make sure that halos are up-to-date (can we improve communication here?)
    communication::syncFunctionBetweenPrimitives( src, level );
 
@@ -81,38 +88,82 @@ void P1ElementwiseOperator< P1Form >::apply( const P1Function< real_t >& src,
    // For 3D we work on cells and for 2D on faces
    if ( storage_->hasGlobalCells() )
    {
-      // we only perform computations on cell primitives
-      for ( auto& macroIter : storage_->getCells() )
       {
-         Cell& cell = *macroIter.second;
+         KernelRegion kernelRegion( "apply_3D_macrocell_P1_elementwise", level );
+         if ( kernelRegion.recordsStatistics() )
+         {
+            const uint_t numDoFs = levelinfo::num_microvertices_per_cell( level );
+            KernelCost   cost;
+            for ( const auto& it : storage_->getCells() )
+            {
+               const bool storedMatrices = blendedElementMatrices3D_.get( *it.second, level ) != nullptr;
+               cost =
+                   cost + kernelcost::elementwiseApply( levelinfo::num_microcells_per_cell( level ), 4, numDoFs, storedMatrices );
+            }
+            kernelRegion.setCost( cost );
+         }
 
-         // get hold of the actual numerical data in the two functions
-         PrimitiveDataID< FunctionMemory< real_t >, Cell > dstVertexDoFIdx = dst.getCellDataID();
-         PrimitiveDataID< FunctionMemory< real_t >, Cell > srcVertexDoFIdx = src.getCellDataID();
+         // we only perform computations on cell primitives
+         for ( auto& macroIter : storage_->getCells() )
+         {
+            Cell& cell = *macroIter.second;
+
+            // get hold of the actual numerical data in the two functions
+            PrimitiveDataID< FunctionMemory< real_t >, Cell > dstVertexDoFIdx = dst.getCellDataID();
+            PrimitiveDataID< FunctionMemory< real_t >, Cell > srcVertexDoFIdx = src.getCellDataID();
 
-         real_t* srcVertexData = cell.getData( srcVertexDoFIdx )->getPointer( level );
-         real_t* dstVertexData = cell.getData( dstVertexDoFIdx )->getPointer( level );
+            real_t* srcVertexData = cell.getData( srcVertexDoFIdx )->getPointer( level );
+            real_t* dstVertexData = cell.getData( dstVertexDoFIdx )->getPointer( level );
 
-         // Zero out dst halos only
-         //
-         // This is also necessary when using update type == Add.
-         // During additive comm we then skip zeroing the data on the lower-dim primitives.
+            // Zero out dst halos only
+            //
+            // This is also necessary when using update type == Add.
+            // During additive comm we then skip zeroing the data on the lower-dim primitives.
 
-         for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
-         {
-            if ( !vertexdof::macrocell::isOnCellFace( idx, level ).empty() )
+            for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
             {
-               auto arrayIdx           = vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
-               dstVertexData[arrayIdx] = real_c( 0 );
+               if ( !vertexdof::macrocell::isOnCellFace( idx, level ).empty() )
+               {
+                  auto arrayIdx           = vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
+                  dstVertexData[arrayIdx] = real_c( 0 );
+               }
             }
-         }
 
-         // loop over micro-cells
-         for ( const auto& cType : celldof::allCellTypes )
-         {
-            for ( const auto& micro : celldof::macrocell::Iterator( level, cType, 0 ) )
+            // use the element matrices of all micro-cells if this macro-cell is blended and the level is cached
+            const Matrix4r* blendedElMats = blendedElementMatrices3D_.get( cell, level );
+
+            // loop over micro-cells
+            //
+            // The micro-cells are processed slab-wise. Slabs of equal parity do not share any DoFs,
+            // so that the scatter-add into dst is race-free if those are distributed among threads.
+            const int numSlabs = int_c( levelinfo::num_microedges_per_edge( level ) );
+            for ( int parity = 0; parity < 2; parity++ )
             {
-               localMatrixVectorMultiply3D( cell, level, micro, cType, srcVertexData, dstVertexData );
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for schedule( static, 1 ) default( shared )
+#endif
+               for ( int slab = parity; slab < numSlabs; slab += 2 )
+               {
+                  for ( const auto& cType : celldof::allCellTypes )
+                  {
+                     for ( const auto& micro : celldof::macrocell::SlabIterator( level, cType, uint_c( slab ) ) )
+                     {
+                        if ( blendedElMats != nullptr )
+                        {
+                           localMatrixVectorMultiply3D( level,
+                                                        micro,
+                                                        cType,
+                                                        blendedElMats[elementmatrixcache::microCellIndex( level, micro, cType )],
+                                                        srcVertexData,
+                                                        dstVertexData );
+                        }
+                        else
+                        {
+                           localMatrixVectorMultiply3D( cell, level, micro, cType, srcVertexData, dstVertexData );
+                        }
+                     }
+                  }
+               }
             }
          }
       }
@@ -128,65 +179,108 @@ void P1ElementwiseOperator< P1Form >::apply( const P1Function< real_t >& src,
 
    else
    {
-      // we only perform computations on face primitives
-      for ( auto& it : storage_->getFaces() )
       {
-         Face& face = *it.second;
+         KernelRegion kernelRegion( "apply_2D_macroface_P1_elementwise", level );
+         if ( kernelRegion.recordsStatistics() )
+         {
+            const uint_t numDoFs = levelinfo::num_microvertices_per_face( level );
+            KernelCost   cost;
+            for ( const auto& it : storage_->getFaces() )
+            {
+               const bool storedMatrices = blendedElementMatrices2D_.get( *it.second, level ) != nullptr;
+               cost =
+                   cost + kernelcost::elementwiseApply( levelinfo::num_microfaces_per_face( level ), 3, numDoFs, storedMatrices );
+            }
+            kernelRegion.setCost( cost );
+         }
 
-         Point3D x0( face.coords[0] );
-         Point3D x1( face.coords[1] );
-         Point3D x2( face.coords[2] );
+         // we only perform computations on face primitives
+         for ( auto& it : storage_->getFaces() )
+         {
+            Face& face = *it.second;
 
-         uint_t                   rowsize       = levelinfo::num_microvertices_per_edge( level );
-         uint_t                   inner_rowsize = rowsize;
-         uint_t                   xIdx, yIdx;
-         Point3D                  v0, v1, v2;
-         indexing::Index          nodeIdx;
-         indexing::IndexIncrement offset;
+            Point3D x0( face.coords[0] );
+            Point3D x1( face.coords[1] );
+            Point3D x2( face.coords[2] );
 
-         // get hold of the actual numerical data in the two functions
-         PrimitiveDataID< FunctionMemory< real_t >, Face > dstVertexDoFIdx = dst.getFaceDataID();
-         PrimitiveDataID< FunctionMemory< real_t >, Face > srcVertexDoFIdx = src.getFaceDataID();
+            const uint_t rowsize = levelinfo::num_microvertices_per_edge( level );
 
-         real_t* srcVertexData = face.getData( srcVertexDoFIdx )->getPointer( level );
-         real_t* dstVertexData = face.getData( dstVertexDoFIdx )->getPointer( level );
+            // get hold of the actual numerical data in the two functions
+            PrimitiveDataID< FunctionMemory< real_t >, Face > dstVertexDoFIdx = dst.getFaceDataID();
+            PrimitiveDataID< FunctionMemory< real_t >, Face > srcVertexDoFIdx = src.getFaceDataID();
 
-         // Zero out dst halos only
-         //
-         // This is also necessary when using update type == Add.
-         // During additive comm we then skip zeroing the data on the lower-dim primitives.
+            real_t* srcVertexData = face.getData( srcVertexDoFIdx )->getPointer( level );
+            real_t* dstVertexData = face.getData( dstVertexDoFIdx )->getPointer( level );
 
-         for ( const auto& idx : vertexdof::macroface::Iterator( level ) )
-         {
-            if ( vertexdof::macroface::isVertexOnBoundary( level, idx ) )
+            // Zero out dst halos only
+            //
+            // This is also necessary when using update type == Add.
+            // During additive comm we then skip zeroing the data on the lower-dim primitives.
+
+            for ( const auto& idx : vertexdof::macroface::Iterator( level ) )
             {
-               auto arrayIdx           = vertexdof::macroface::index( level, idx.x(), idx.y() );
-               dstVertexData[arrayIdx] = real_c( 0 );
+               if ( vertexdof::macroface::isVertexOnBoundary( level, idx ) )
+               {
+                  auto arrayIdx           = vertexdof::macroface::index( level, idx.x(), idx.y() );
+                  dstVertexData[arrayIdx] = real_c( 0 );
+               }
             }
-         }
 
-         // the explicit uint_c cast prevents a segfault in intel compiler 2018.4
-         // now loop over micro-faces of macro-face
-         for ( yIdx = uint_c( 0 ); yIdx < rowsize - 2; ++yIdx )
-         {
-            // loop over vertices in row with two associated triangles
-            for ( xIdx = uint_c( 1 ); xIdx < inner_rowsize - 1; ++xIdx )
+            // use the element matrices of all micro-faces if this macro-face is blended and the level is cached
+            const Matrix3r* blendedElMats = blendedElementMatrices2D_.get( face, level );
+
+            // now loop over micro-faces of macro-face
+            //
+            // The micro-faces of a row only touch DoFs in that and the next row of micro-vertices.
+            // Rows of equal parity can therefore be distributed among threads without races in the scatter-add.
+            const int numRows = int_c( rowsize ) - 1;
+            for ( int parity = 0; parity < 2; parity++ )
             {
-               // we associate two elements with current micro-vertex
-               localMatrixVectorMultiply2D(
-                   face, level, xIdx, yIdx, P1Elements::P1Elements2D::elementN, srcVertexData, dstVertexData );
-               localMatrixVectorMultiply2D(
-                   face, level, xIdx, yIdx, P1Elements::P1Elements2D::elementNW, srcVertexData, dstVertexData );
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for schedule( static, 1 ) default( shared )
+#endif
+               for ( int row = parity; row < numRows; row += 2 )
+               {
+                  const uint_t rowIdx       = uint_c( row );
+                  const uint_t innerRowsize = rowsize - rowIdx;
+
+                  // the explicit uint_c cast prevents a segfault in intel compiler 2018.4
+                  uint_t colIdx;
+
+                  // processes a single micro-face, elMatIdx is 0 for elementN and 1 for elementNW
+                  auto processElement = [&]( const uint_t&                              xIdx,
+                                             const P1Elements::P1Elements2D::P1Element& element,
+                                             const uint_t&                              elMatIdx ) {
+                     if ( blendedElMats != nullptr )
+                     {
+                        localMatrixVectorMultiply2D( level,
+                                                     xIdx,
+                                                     rowIdx,
+                                                     element,
+                                                     blendedElMats[elementmatrixcache::microFaceIndex( level, xIdx, rowIdx, elMatIdx )],
+                                                     srcVertexData,
+                                                     dstVertexData );
+                     }
+                     else
+                     {
+                        localMatrixVectorMultiply2D( face, level, xIdx, rowIdx, element, srcVertexData, dstVertexData );
+                     }
+                  };
+
+                  // loop over vertices in row with two associated triangles
+                  for ( colIdx = uint_c( 1 ); colIdx < innerRowsize - 1; ++colIdx )
+                  {
+                     // we associate two elements with current micro-vertex
+                     processElement( colIdx, P1Elements::P1Elements2D::elementN, 0 );
+                     processElement( colIdx, P1Elements::P1Elements2D::elementNW, 1 );
+                  }
+
+                  // final micro-vertex in row has only one associated micro-face
+                  // (for the top row this is the only micro-element)
+                  processElement( colIdx, P1Elements::P1Elements2D::elementNW, 1 );
+               }
             }
-            --inner_rowsize;
-
-            // final micro-vertex in row has only one associated micro-face
-            localMatrixVectorMultiply2D(
-                face, level, xIdx, yIdx, P1Elements::P1Elements2D::elementNW, srcVertexData, dstVertexData );
          }
-
-         // top north-west micro-element not treated, yet
-         localMatrixVectorMultiply2D( face, level, 1, yIdx, P1Elements::P1Elements2D::elementNW, srcVertexData, dstVertexData );
       }
 
       // Push result to lower-dimensional primitives
@@ -233,11 +327,9 @@ void P1ElementwiseOperator< P1Form >::localMatrixVectorMultiply2D( const Face&
    WALBERLA_ASSERT_UNEQUAL( srcVertexData, dstVertexData );
 
    Matrix3r                 elMat;
-   Point3D                  elVecOld, elVecNew;
    indexing::Index          nodeIdx;
    indexing::IndexIncrement offset;
    Point3D                  v0, v1, v2;
-   std::array< uint_t, 3 >  dofDataIdx;
    P1Form                   form( form_ );
 
    // determine vertices of micro-element
@@ -252,6 +344,23 @@ void P1ElementwiseOperator< P1Form >::localMatrixVectorMultiply2D( const Face&
    form.setGeometryMap( face.getGeometryMap() );
    form.integrateAll( {v0, v1, v2}, elMat );
 
+   localMatrixVectorMultiply2D( level, xIdx, yIdx, element, elMat, srcVertexData, dstVertexData );
+}
+
+template < class P1Form >
+void P1ElementwiseOperator< P1Form >::localMatrixVectorMultiply2D( const uint_t                               level,
+                                                                   const uint_t                               xIdx,
+                                                                   const uint_t                               yIdx,
+                                                                   const P1Elements::P1Elements2D::P1Element& element,
+                                                                   const Matrix3r&                            elMat,
+                                                                   const real_t* const                        srcVertexData,
+                                                                   real_t* const dstVertexData ) const
+{
+   WALBERLA_ASSERT_UNEQUAL( srcVertexData, dstVertexData );
+
+   Point3D                 elVecOld, elVecNew;
+   std::array< uint_t, 3 > dofDataIdx;
+
    // assemble local element vector
    dofDataIdx[0] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[0] );
    dofDataIdx[1] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[1] );
@@ -292,6 +401,17 @@ void P1ElementwiseOperator< P1Form >::localMatrixVectorMultiply3D( const Cell&
    form.setGeometryMap( cell.getGeometryMap() );
    form.integrateAll( coords, elMat );
 
+   localMatrixVectorMultiply3D( level, microCell, cType, elMat, srcVertexData, dstVertexData );
+}
+
+template < class P1Form >
+void P1ElementwiseOperator< P1Form >::localMatrixVectorMultiply3D( const uint_t            level,
+                                                                   const indexing::Index&  microCell,
+                                                                   const celldof::CellType cType,
+                                                                   const Matrix4r&         elMat,
+                                                                   const real_t* const     srcVertexData,
+                                                                   real_t* const           dstVertexData ) const
+{
    // obtain data indices of dofs associated with micro-cell
    std::array< uint_t, 4 > vertexDoFIndices;
    vertexdof::getVertexDoFDataIndicesFromMicroCell( microCell, cType, level, vertexDoFIndices );
@@ -313,6 +433,115 @@ void P1ElementwiseOperator< P1Form >::localMatrixVectorMultiply3D( const Cell&
    }
 }
 
+template < class P1Form >
+void P1ElementwiseOperator< P1Form >::computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes )
+{
+   blendedLocalElementMatricesMemoryBudget_ = memoryBudgetInBytes;
+   integrateBlendedLocalElementMatrices();
+}
+
+template < class P1Form >
+void P1ElementwiseOperator< P1Form >::integrateBlendedLocalElementMatrices() const
+{
+   if ( storage_->hasGlobalCells() )
+   {
+      blendedElementMatrices3D_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return elementmatrixcache::numMicroCells( level ); },
+          blendedLocalElementMatricesMemoryBudget_ );
+
+      for ( const auto& level : blendedElementMatrices3D_.getCachedLevels() )
+      {
+         for ( const auto& it : storage_->getCells() )
+         {
+            const Cell& cell = *it.second;
+            if ( cell.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            P1Form form( form_ );
+            form.setGeometryMap( cell.getGeometryMap() );
+
+            Matrix4r* elMats = blendedElementMatrices3D_.get( cell, level );
+            for ( uint_t slab = 0; slab < levelinfo::num_microedges_per_edge( level ); slab++ )
+            {
+               for ( const auto& cType : celldof::allCellTypes )
+               {
+                  for ( const auto& micro : celldof::macrocell::SlabIterator( level, cType, slab ) )
+                  {
+                     const std::array< indexing::Index, 4 > verts =
+                         celldof::macrocell::getMicroVerticesFromMicroCell( micro, cType );
+                     std::array< Point3D, 4 > coords;
+                     for ( uint_t k = 0; k < 4; ++k )
+                     {
+                        coords[k] = vertexdof::macrocell::coordinateFromIndex( level, cell, verts[k] );
+                     }
+                     form.integrateAll( coords, elMats[elementmatrixcache::microCellIndex( level, micro, cType )] );
+                  }
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      blendedElementMatrices2D_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return elementmatrixcache::numMicroFaces( level ); },
+          blendedLocalElementMatricesMemoryBudget_ );
+
+      const std::array< P1Elements::P1Elements2D::P1Element, 2 > elements = {
+          {P1Elements::P1Elements2D::elementN, P1Elements::P1Elements2D::elementNW}};
+
+      for ( const auto& level : blendedElementMatrices2D_.getCachedLevels() )
+      {
+         for ( const auto& it : storage_->getFaces() )
+         {
+            const Face& face = *it.second;
+            if ( face.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            P1Form form( form_ );
+            form.setGeometryMap( face.getGeometryMap() );
+
+            Matrix3r* elMats = blendedElementMatrices2D_.get( face, level );
+
+            // integrates over the micro-face elements[elIdx] of the passed micro-vertex
+            auto integrateElement = [&]( const uint_t& xIdx, const uint_t& yIdx, const uint_t& elIdx ) {
+               const indexing::Index nodeIdx( xIdx, yIdx, 0 );
+               const Point3D         v0 = vertexdof::macroface::coordinateFromIndex( level, face, nodeIdx );
+               const Point3D         v1 = vertexdof::macroface::coordinateFromIndex(
+                   level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( elements[elIdx][1] ) );
+               const Point3D v2 = vertexdof::macroface::coordinateFromIndex(
+                   level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( elements[elIdx][2] ) );
+               form.integrateAll( {v0, v1, v2}, elMats[elementmatrixcache::microFaceIndex( level, xIdx, yIdx, elIdx )] );
+            };
+
+            // same traversal of the micro-faces as in apply()
+            const uint_t rowsize = levelinfo::num_microvertices_per_edge( level );
+            for ( uint_t rowIdx = 0; rowIdx < rowsize - 1; rowIdx++ )
+            {
+               const uint_t innerRowsize = rowsize - rowIdx;
+               uint_t       colIdx;
+               for ( colIdx = 1; colIdx < innerRowsize - 1; ++colIdx )
+               {
+                  integrateElement( colIdx, rowIdx, 0 );
+                  integrateElement( colIdx, rowIdx, 1 );
+               }
+               integrateElement( colIdx, rowIdx, 1 );
+            }
+         }
+      }
+   }
+}
+
 template < class P1Form >
 void P1ElementwiseOperator< P1Form >::computeDiagonalOperatorValues( bool invert )
 {
@@ -718,6 +947,9 @@ template class P1ElementwiseOperator< P1Form_mass3D >;
 // P1ElementwiseBlendingLaplaceOperator
 template class P1ElementwiseOperator< P1Form_laplace >;
 
+// P1ElementwiseBlendingLaplaceOperator3D
+template class P1ElementwiseOperator< P1Form_laplace3D >;
+
 // Needed for P1Blending(Inverse)DiagonalOperator
 template class P1ElementwiseOperator< P1RowSumForm >;
 
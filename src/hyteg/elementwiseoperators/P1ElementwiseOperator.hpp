@@ -21,10 +21,12 @@
 
 #include "hyteg/celldofspace/CellDoFIndexing.hpp"
 #include "hyteg/communication/Syncing.hpp"
+#include "hyteg/elementwiseoperators/BlendedElementMatrixCache.hpp"
 #include "hyteg/forms/form_fenics_base/P1FenicsForm.hpp"
 #include "hyteg/forms/form_fenics_generated/p1_polar_laplacian.h"
 #include "hyteg/forms/form_hyteg_generated/P1FormLaplace.hpp"
 #include "hyteg/forms/form_hyteg_generated/P1FormMass.hpp"
+#include "hyteg/forms/form_hyteg_manual/P1FormLaplace3D.hpp"
 #include "hyteg/forms/form_hyteg_manual/P1FormMass3D.hpp"
 #include "hyteg/p1functionspace/P1Elements.hpp"
 #include "hyteg/p1functionspace/P1Function.hpp"
@@ -108,7 +110,30 @@ class P1ElementwiseOperator : public Operator< P1Function< real_t >, P1Function<
       return inverseDiagonalValues_;
    };
 
+   /// Precomputes and stores the local element matrices of all micro-elements of macro-primitives with a
+   /// non-affine (blending) geometry map.
+   ///
+   /// After this call, apply() uses the stored matrices on the cached levels instead of integrating the form (and
+   /// thereby evaluating the geometry map) on-the-fly. Starting from the coarsest level, levels are cached as long
+   /// as the accumulated memory per process stays below the passed budget.
+   ///
+   /// \param memoryBudgetInBytes maximum memory per process that is spent on the stored matrices
+   ///
+   /// \note The stored matrices are not updated if the form is changed afterwards. After the storage has been
+   ///       modified, they are recomputed with the same budget in the next apply().
+   void computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes );
+
+   /// Returns the levels on which the local element matrices of blended macro-primitives are stored.
+   std::set< uint_t > getBlendedLocalElementMatrixLevels() const
+   {
+      return storage_->hasGlobalCells() ? blendedElementMatrices3D_.getCachedLevels() :
+                                          blendedElementMatrices2D_.getCachedLevels();
+   }
+
  private:
+   /// Selects the cached levels and integrates the local element matrices of all blended macro-primitives.
+   void integrateBlendedLocalElementMatrices() const;
+
    /// compute product of element local vector with element matrix
    ///
    /// \param face           face primitive we operate on
@@ -128,6 +153,17 @@ class P1ElementwiseOperator : public Operator< P1Function< real_t >, P1Function<
                                      const real_t* const                        srcVertexData,
                                      real_t* const                              dstVertexData ) const;
 
+   /// compute product of element local vector with a precomputed element matrix
+   ///
+   /// Same as above, but the form is not integrated.
+   void localMatrixVectorMultiply2D( const uint_t                               level,
+                                     const uint_t                               xIdx,
+                                     const uint_t                               yIdx,
+                                     const P1Elements::P1Elements2D::P1Element& element,
+                                     const Matrix3r&                            elMat,
+                                     const real_t* const                        srcVertexData,
+                                     real_t* const                              dstVertexData ) const;
+
    /// compute product of element local vector with element matrix
    ///
    /// \param cell           cell primitive we operate on
@@ -145,6 +181,16 @@ class P1ElementwiseOperator : public Operator< P1Function< real_t >, P1Function<
                                      const real_t* const     srcVertexData,
                                      real_t* const           dstVertexData ) const;
 
+   /// compute product of element local vector with a precomputed element matrix
+   ///
+   /// Same as above, but the form is not integrated.
+   void localMatrixVectorMultiply3D( const uint_t            level,
+                                     const indexing::Index&  microCell,
+                                     const celldof::CellType cType,
+                                     const Matrix4r&         elMat,
+                                     const real_t* const     srcVertexData,
+                                     real_t* const           dstVertexData ) const;
+
    /// Compute contributions to operator diagonal for given micro-face
    ///
    /// \param face           face primitive we operate on
@@ -202,6 +248,13 @@ class P1ElementwiseOperator : public Operator< P1Function< real_t >, P1Function<
    std::shared_ptr< P1Function< real_t > > inverseDiagonalValues_;
 
    P1Form form_;
+
+   /// local element matrices of all micro-elements of non-affinely mapped macro-primitives on the cached levels
+   mutable BlendedElementMatrixCache< Matrix3r, Face > blendedElementMatrices2D_;
+   mutable BlendedElementMatrixCache< Matrix4r, Cell > blendedElementMatrices3D_;
+
+   /// memory budget of the blended element matrices, kept to recompute them after the storage has been modified
+   uint_t blendedLocalElementMatricesMemoryBudget_;
 };
 
 typedef P1ElementwiseOperator<
@@ -216,6 +269,7 @@ typedef P1ElementwiseOperator< P1FenicsForm< p1_mass_cell_integral_0_otherwise,
 typedef P1ElementwiseOperator< P1Form_mass >   P1ElementwiseBlendingMassOperator;
 typedef P1ElementwiseOperator< P1Form_mass3D > P1ElementwiseBlendingMassOperator3D;
 
-typedef P1ElementwiseOperator< P1Form_laplace > P1ElementwiseBlendingLaplaceOperator;
+typedef P1ElementwiseOperator< P1Form_laplace >   P1ElementwiseBlendingLaplaceOperator;
+typedef P1ElementwiseOperator< P1Form_laplace3D > P1ElementwiseBlendingLaplaceOperator3D;
 
 } // namespace hyteg
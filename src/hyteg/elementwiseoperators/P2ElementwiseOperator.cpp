@@ -22,6 +22,48 @@
 
 namespace hyteg {
 
+/// Selects the micro-elements that are processed in a sweep of the apply.
+enum class MicroElementSweep
+{
+   ALL,
+   /// micro-elements that do not have a vertex on the boundary of the macro-primitive and therefore do not read halo data
+   INNER,
+   /// micro-elements that have at least one vertex on the boundary of the macro-primitive
+   BOUNDARY
+};
+
+static inline bool isInnerMicroCell( const uint_t& level, const indexing::Index& microCell, const celldof::CellType& cType )
+{
+   const uint_t width = levelinfo::num_microedges_per_edge( level );
+   for ( const auto& v : celldof::macrocell::getMicroVerticesFromMicroCell( microCell, cType ) )
+   {
+      if ( v.x() == 0 || v.y() == 0 || v.z() == 0 || v.x() + v.y() + v.z() == width )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static inline bool
+    isInnerMicroFace( const uint_t& level, const uint_t& xIdx, const uint_t& yIdx, const P2Elements::P2Element& element )
+{
+   const indexing::Index nodeIdx( xIdx, yIdx, 0 );
+   for ( uint_t k = 0; k < 3; k++ )
+   {
+      if ( vertexdof::macroface::isVertexOnBoundary( level, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( element[k] ) ) )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static inline bool isInSweep( const MicroElementSweep& sweep, const bool& isInnerMicroElement )
+{
+   return sweep == MicroElementSweep::ALL || ( sweep == MicroElementSweep::INNER ) == isInnerMicroElement;
+}
+
 template < class P2Form >
 P2ElementwiseOperator< P2Form >::P2ElementwiseOperator( const std::shared_ptr< PrimitiveStorage >& storage,
                                                         size_t                                     minLevel,
@@ -45,6 +87,10 @@ P2ElementwiseOperator< P2Form >::P2ElementwiseOperator( const std::shared_ptr< P
                                                         bool                                       needsInverseDiagEntries )
 : Operator( storage, minLevel, maxLevel )
 , form_( form )
+, localElementMatricesPrecomputed_( false )
+, localElementMatricesModificationStamp_( 0 )
+, overlapCommunication_( false )
+, blendedLocalElementMatricesMemoryBudget_( 0 )
 {
    if ( needsInverseDiagEntries )
    {
@@ -63,8 +109,47 @@ void P2ElementwiseOperator< P2Form >::apply( const P2Function< real_t >& src,
 
    this->startTiming( "apply" );
 
-   // Make sure that halos are up-to-date (can we improve communication here?)
-   communication::syncP2FunctionBetweenPrimitives( src, level );
+   // the cached levels of the blended element matrices depend on the distribution of the macro-primitives
+   if ( blendedElementMatrices2D_.isOutdated() || blendedElementMatrices3D_.isOutdated() )
+   {
+      integrateBlendedLocalElementMatrices();
+   }
+
+   // the stored element matrices are indexed by the macro-primitives and must be recomputed after a migration
+   if ( localElementMatricesPrecomputed_ && localElementMatricesModificationStamp_ != storage_->getModificationStamp() )
+   {
+      integrateLocalElementMatrices();
+   }
+
+   // Make sure that halos are up-to-date
+   //
+   // The kernels only read the data of the macro-cells (macro-faces in 2D). If the communication is overlapped,
+   // only the exchange towards those primitives is performed and its last stage is completed after the inner
+   // micro-elements have been processed.
+   std::vector< MicroElementSweep > sweeps = {MicroElementSweep::ALL};
+   if ( overlapCommunication_ )
+   {
+      sweeps = {MicroElementSweep::INNER, MicroElementSweep::BOUNDARY};
+
+      src.getVertexDoFFunction().communicate< Vertex, Edge >( level );
+      src.getEdgeDoFFunction().communicate< Vertex, Edge >( level );
+      if ( storage_->hasGlobalCells() )
+      {
+         src.getVertexDoFFunction().communicate< Edge, Face >( level );
+         src.getEdgeDoFFunction().communicate< Edge, Face >( level );
+         src.getVertexDoFFunction().startCommunication< Face, Cell >( level );
+         src.getEdgeDoFFunction().startCommunication< Face, Cell >( level );
+      }
+      else
+      {
+         src.getVertexDoFFunction().startCommunication< Edge, Face >( level );
+         src.getEdgeDoFFunction().startCommunication< Edge, Face >( level );
+      }
+   }
+   else
+   {
+      communication::syncP2FunctionBetweenPrimitives( src, level );
+   }
 
    if ( updateType == Replace )
    {
@@ -79,57 +164,141 @@ void P2ElementwiseOperator< P2Form >::apply( const P2Function< real_t >& src,
    // For 3D we work on cells and for 2D on faces
    if ( storage_->hasGlobalCells() )
    {
-      // we only perform computations on cell primitives
-      for ( auto& macroIter : storage_->getCells() )
+      for ( const auto& sweep : sweeps )
       {
-         Cell& cell = *macroIter.second;
+         if ( sweep == MicroElementSweep::BOUNDARY )
+         {
+            src.getVertexDoFFunction().endCommunication< Face, Cell >( level );
+            src.getEdgeDoFFunction().endCommunication< Face, Cell >( level );
+         }
 
-         // get hold of the actual numerical data in the two functions
-         PrimitiveDataID< FunctionMemory< real_t >, Cell > dstVertexDoFIdx = dst.getVertexDoFFunction().getCellDataID();
-         PrimitiveDataID< FunctionMemory< real_t >, Cell > srcVertexDoFIdx = src.getVertexDoFFunction().getCellDataID();
+         // only instrumented without overlapping communication, the split sweeps would also include the halo exchange
+         KernelRegion kernelRegion( "apply_3D_macrocell_P2_elementwise", level, sweep == MicroElementSweep::ALL );
+         if ( kernelRegion.recordsStatistics() )
+         {
+            const uint_t numDoFs = levelinfo::num_microvertices_per_cell( level ) + levelinfo::num_microedges_per_cell( level );
+            KernelCost   cost;
+            for ( const auto& it : storage_->getCells() )
+            {
+               const bool storedMatrices = blendedElementMatrices3D_.get( *it.second, level ) != nullptr;
+               cost = cost + kernelcost::elementwiseApply( levelinfo::num_microcells_per_cell( level ), 10, numDoFs, storedMatrices );
+            }
+            kernelRegion.setCost( cost );
+         }
 
-         PrimitiveDataID< FunctionMemory< real_t >, Cell > dstEdgeDoFIdx = dst.getEdgeDoFFunction().getCellDataID();
-         PrimitiveDataID< FunctionMemory< real_t >, Cell > srcEdgeDoFIdx = src.getEdgeDoFFunction().getCellDataID();
+         // we only perform computations on cell primitives
+         for ( auto& macroIter : storage_->getCells() )
+         {
+            Cell& cell = *macroIter.second;
 
-         real_t* srcVertexData = cell.getData( srcVertexDoFIdx )->getPointer( level );
-         real_t* dstVertexData = cell.getData( dstVertexDoFIdx )->getPointer( level );
+            // get hold of the actual numerical data in the two functions
+            PrimitiveDataID< FunctionMemory< real_t >, Cell > dstVertexDoFIdx = dst.getVertexDoFFunction().getCellDataID();
+            PrimitiveDataID< FunctionMemory< real_t >, Cell > srcVertexDoFIdx = src.getVertexDoFFunction().getCellDataID();
 
-         real_t* srcEdgeData = cell.getData( srcEdgeDoFIdx )->getPointer( level );
-         real_t* dstEdgeData = cell.getData( dstEdgeDoFIdx )->getPointer( level );
+            PrimitiveDataID< FunctionMemory< real_t >, Cell > dstEdgeDoFIdx = dst.getEdgeDoFFunction().getCellDataID();
+            PrimitiveDataID< FunctionMemory< real_t >, Cell > srcEdgeDoFIdx = src.getEdgeDoFFunction().getCellDataID();
 
-         // Zero out dst halos only
-         //
-         // This is also necessary when using update type == Add.
-         // During additive comm we then skip zeroing the data on the lower-dim primitives.
+            real_t* srcVertexData = cell.getData( srcVertexDoFIdx )->getPointer( level );
+            real_t* dstVertexData = cell.getData( dstVertexDoFIdx )->getPointer( level );
 
-         for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
-         {
-            if ( !vertexdof::macrocell::isOnCellFace( idx, level ).empty() )
+            real_t* srcEdgeData = cell.getData( srcEdgeDoFIdx )->getPointer( level );
+            real_t* dstEdgeData = cell.getData( dstEdgeDoFIdx )->getPointer( level );
+
+            if ( sweep != MicroElementSweep::BOUNDARY )
             {
-               auto arrayIdx           = vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
-               dstVertexData[arrayIdx] = real_c( 0 );
+               // Zero out dst halos only
+               //
+               // This is also necessary when using update type == Add.
+               // During additive comm we then skip zeroing the data on the lower-dim primitives.
+
+               for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
+               {
+                  if ( !vertexdof::macrocell::isOnCellFace( idx, level ).empty() )
+                  {
+                     auto arrayIdx           = vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
+                     dstVertexData[arrayIdx] = real_c( 0 );
+                  }
+               }
+
+               for ( const auto& idx : edgedof::macrocell::Iterator( level ) )
+               {
+                  for ( const auto& orientation : edgedof::allEdgeDoFOrientationsWithoutXYZ )
+                  {
+                     if ( !edgedof::macrocell::isInnerEdgeDoF( level, idx, orientation ) )
+                     {
+                        auto arrayIdx         = edgedof::macrocell::index( level, idx.x(), idx.y(), idx.z(), orientation );
+                        dstEdgeData[arrayIdx] = real_c( 0 );
+                     }
+                  }
+               }
             }
-         }
 
-         for ( const auto& idx : edgedof::macrocell::Iterator( level ) )
-         {
-            for ( const auto& orientation : edgedof::allEdgeDoFOrientationsWithoutXYZ )
+            // use precomputed element matrices if available for this macro-cell
+            const std::array< Matrix10r, 6 >* elMats = nullptr;
+            if ( localElementMatricesPrecomputed_ )
             {
-               if ( !edgedof::macrocell::isInnerEdgeDoF( level, idx, orientation ) )
+               auto cellIt = localElementMatrices3D_.find( cell.getID() );
+               if ( cellIt != localElementMatrices3D_.end() && cellIt->second.count( level ) > 0 )
                {
-                  auto arrayIdx         = edgedof::macrocell::index( level, idx.x(), idx.y(), idx.z(), orientation );
-                  dstEdgeData[arrayIdx] = real_c( 0 );
+                  elMats = &cellIt->second.at( level );
                }
             }
-         }
 
-         // loop over micro-cells
-         for ( const auto& cType : celldof::allCellTypes )
-         {
-            for ( const auto& micro : celldof::macrocell::Iterator( level, cType, 0 ) )
+            // use the element matrices of all micro-cells if this macro-cell is blended and the level is cached
+            const Matrix10r* blendedElMats = blendedElementMatrices3D_.get( cell, level );
+
+            // loop over micro-cells
+            //
+            // The micro-cells are processed slab-wise. Slabs of equal parity do not share any DoFs,
+            // so that the scatter-add into dst is race-free if those are distributed among threads.
+            const int numSlabs = int_c( levelinfo::num_microedges_per_edge( level ) );
+            for ( int parity = 0; parity < 2; parity++ )
             {
-               localMatrixVectorMultiply3D< P2Form >(
-                   cell, level, micro, cType, srcVertexData, srcEdgeData, dstVertexData, dstEdgeData, form_ );
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for schedule( static, 1 ) default( shared )
+#endif
+               for ( int slab = parity; slab < numSlabs; slab += 2 )
+               {
+                  for ( uint_t cTypeIdx = 0; cTypeIdx < celldof::allCellTypes.size(); cTypeIdx++ )
+                  {
+                     const celldof::CellType cType = celldof::allCellTypes[cTypeIdx];
+                     for ( const auto& micro : celldof::macrocell::SlabIterator( level, cType, uint_c( slab ) ) )
+                     {
+                        if ( sweep != MicroElementSweep::ALL && !isInSweep( sweep, isInnerMicroCell( level, micro, cType ) ) )
+                        {
+                           continue;
+                        }
+
+                        if ( elMats != nullptr )
+                        {
+                           localMatrixVectorMultiply3D( level,
+                                                        micro,
+                                                        cType,
+                                                        ( *elMats )[cTypeIdx],
+                                                        srcVertexData,
+                                                        srcEdgeData,
+                                                        dstVertexData,
+                                                        dstEdgeData );
+                        }
+                        else if ( blendedElMats != nullptr )
+                        {
+                           localMatrixVectorMultiply3D( level,
+                                                        micro,
+                                                        cType,
+                                                        blendedElMats[elementmatrixcache::microCellIndex( level, micro, cType )],
+                                                        srcVertexData,
+                                                        srcEdgeData,
+                                                        dstVertexData,
+                                                        dstEdgeData );
+                        }
+                        else
+                        {
+                           localMatrixVectorMultiply3D< P2Form >(
+                               cell, level, micro, cType, srcVertexData, srcEdgeData, dstVertexData, dstEdgeData, form_ );
+                        }
+                     }
+                  }
+               }
             }
          }
       }
@@ -152,97 +321,163 @@ void P2ElementwiseOperator< P2Form >::apply( const P2Function< real_t >& src,
 
    else
    {
-      // we only perform computations on face primitives
-      for ( auto& it : storage_->getFaces() )
+      for ( const auto& sweep : sweeps )
       {
-         Face& face = *it.second;
+         if ( sweep == MicroElementSweep::BOUNDARY )
+         {
+            src.getVertexDoFFunction().endCommunication< Edge, Face >( level );
+            src.getEdgeDoFFunction().endCommunication< Edge, Face >( level );
+         }
 
-         Point3D x0( face.coords[0] );
-         Point3D x1( face.coords[1] );
-         Point3D x2( face.coords[2] );
+         // only instrumented without overlapping communication, the split sweeps would also include the halo exchange
+         KernelRegion kernelRegion( "apply_2D_macroface_P2_elementwise", level, sweep == MicroElementSweep::ALL );
+         if ( kernelRegion.recordsStatistics() )
+         {
+            const uint_t numDoFs = levelinfo::num_microvertices_per_face( level ) + levelinfo::num_microedges_per_face( level );
+            KernelCost   cost;
+            for ( const auto& it : storage_->getFaces() )
+            {
+               const bool storedMatrices = blendedElementMatrices2D_.get( *it.second, level ) != nullptr;
+               cost = cost + kernelcost::elementwiseApply( levelinfo::num_microfaces_per_face( level ), 6, numDoFs, storedMatrices );
+            }
+            kernelRegion.setCost( cost );
+         }
 
-         uint_t                   rowsize       = levelinfo::num_microvertices_per_edge( level );
-         uint_t                   inner_rowsize = rowsize;
-         uint_t                   xIdx, yIdx;
-         Point3D                  v0, v1, v2;
-         indexing::Index          nodeIdx;
-         indexing::IndexIncrement offset;
+         // we only perform computations on face primitives
+         for ( auto& it : storage_->getFaces() )
+         {
+            Face& face = *it.second;
 
-         // get hold of the actual numerical data in the two functions
-         PrimitiveDataID< FunctionMemory< real_t >, Face > dstVertexDoFIdx = dst.getVertexDoFFunction().getFaceDataID();
-         PrimitiveDataID< FunctionMemory< real_t >, Face > srcVertexDoFIdx = src.getVertexDoFFunction().getFaceDataID();
+            Point3D x0( face.coords[0] );
+            Point3D x1( face.coords[1] );
+            Point3D x2( face.coords[2] );
 
-         PrimitiveDataID< FunctionMemory< real_t >, Face > dstEdgeDoFIdx = dst.getEdgeDoFFunction().getFaceDataID();
-         PrimitiveDataID< FunctionMemory< real_t >, Face > srcEdgeDoFIdx = src.getEdgeDoFFunction().getFaceDataID();
+            const uint_t rowsize = levelinfo::num_microvertices_per_edge( level );
 
-         real_t* srcVertexData = face.getData( srcVertexDoFIdx )->getPointer( level );
-         real_t* dstVertexData = face.getData( dstVertexDoFIdx )->getPointer( level );
+            // get hold of the actual numerical data in the two functions
+            PrimitiveDataID< FunctionMemory< real_t >, Face > dstVertexDoFIdx = dst.getVertexDoFFunction().getFaceDataID();
+            PrimitiveDataID< FunctionMemory< real_t >, Face > srcVertexDoFIdx = src.getVertexDoFFunction().getFaceDataID();
 
-         real_t* srcEdgeData = face.getData( srcEdgeDoFIdx )->getPointer( level );
-         real_t* dstEdgeData = face.getData( dstEdgeDoFIdx )->getPointer( level );
+            PrimitiveDataID< FunctionMemory< real_t >, Face > dstEdgeDoFIdx = dst.getEdgeDoFFunction().getFaceDataID();
+            PrimitiveDataID< FunctionMemory< real_t >, Face > srcEdgeDoFIdx = src.getEdgeDoFFunction().getFaceDataID();
 
-         // Zero out dst halos only
-         //
-         // This is also necessary when using update type == Add.
-         // During additive comm we then skip zeroing the data on the lower-dim primitives.
+            real_t* srcVertexData = face.getData( srcVertexDoFIdx )->getPointer( level );
+            real_t* dstVertexData = face.getData( dstVertexDoFIdx )->getPointer( level );
 
-         for ( const auto& idx : vertexdof::macroface::Iterator( level ) )
-         {
-            if ( vertexdof::macroface::isVertexOnBoundary( level, idx ) )
+            real_t* srcEdgeData = face.getData( srcEdgeDoFIdx )->getPointer( level );
+            real_t* dstEdgeData = face.getData( dstEdgeDoFIdx )->getPointer( level );
+
+            if ( sweep != MicroElementSweep::BOUNDARY )
             {
-               auto arrayIdx           = vertexdof::macroface::index( level, idx.x(), idx.y() );
-               dstVertexData[arrayIdx] = real_c( 0 );
+               // Zero out dst halos only
+               //
+               // This is also necessary when using update type == Add.
+               // During additive comm we then skip zeroing the data on the lower-dim primitives.
+
+               for ( const auto& idx : vertexdof::macroface::Iterator( level ) )
+               {
+                  if ( vertexdof::macroface::isVertexOnBoundary( level, idx ) )
+                  {
+                     auto arrayIdx           = vertexdof::macroface::index( level, idx.x(), idx.y() );
+                     dstVertexData[arrayIdx] = real_c( 0 );
+                  }
+               }
+
+               for ( const auto& idx : edgedof::macroface::Iterator( level ) )
+               {
+                  for ( const auto& orientation : edgedof::faceLocalEdgeDoFOrientations )
+                  {
+                     if ( !edgedof::macroface::isInnerEdgeDoF( level, idx, orientation ) )
+                     {
+                        auto arrayIdx         = edgedof::macroface::index( level, idx.x(), idx.y(), orientation );
+                        dstEdgeData[arrayIdx] = real_c( 0 );
+                     }
+                  }
+               }
             }
-         }
 
-         for ( const auto& idx : edgedof::macroface::Iterator( level ) )
-         {
-            for ( const auto& orientation : edgedof::faceLocalEdgeDoFOrientations )
+            // use precomputed element matrices if available for this macro-face
+            const std::array< Matrix6r, 2 >* elMats = nullptr;
+            if ( localElementMatricesPrecomputed_ )
             {
-               if ( !edgedof::macroface::isInnerEdgeDoF( level, idx, orientation ) )
+               auto faceIt = localElementMatrices2D_.find( face.getID() );
+               if ( faceIt != localElementMatrices2D_.end() && faceIt->second.count( level ) > 0 )
                {
-                  auto arrayIdx         = edgedof::macroface::index( level, idx.x(), idx.y(), orientation );
-                  dstEdgeData[arrayIdx] = real_c( 0 );
+                  elMats = &faceIt->second.at( level );
                }
             }
-         }
 
-         // now loop over micro-faces of macro-face
-         for ( yIdx = 0; yIdx < rowsize - 2; ++yIdx )
-         {
-            // loop over vertices in row with two associated triangles
-            for ( xIdx = 1; xIdx < inner_rowsize - 1; ++xIdx )
+            // use the element matrices of all micro-faces if this macro-face is blended and the level is cached
+            const Matrix6r* blendedElMats = blendedElementMatrices2D_.get( face, level );
+
+            // now loop over micro-faces of macro-face
+            //
+            // The micro-faces of a row only touch DoFs in that and the next row of micro-vertices.
+            // Rows of equal parity can therefore be distributed among threads without races in the scatter-add.
+            const int numRows = int_c( rowsize ) - 1;
+            for ( int parity = 0; parity < 2; parity++ )
             {
-               // we associate two elements with current micro-vertex
-               localMatrixVectorMultiply2D( face,
-                                            level,
-                                            xIdx,
-                                            yIdx,
-                                            P2Elements::P2Face::elementN,
-                                            srcVertexData,
-                                            srcEdgeData,
-                                            dstVertexData,
-                                            dstEdgeData );
-               localMatrixVectorMultiply2D( face,
-                                            level,
-                                            xIdx,
-                                            yIdx,
-                                            P2Elements::P2Face::elementNW,
-                                            srcVertexData,
-                                            srcEdgeData,
-                                            dstVertexData,
-                                            dstEdgeData );
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for schedule( static, 1 ) default( shared )
+#endif
+               for ( int row = parity; row < numRows; row += 2 )
+               {
+                  const uint_t rowIdx       = uint_c( row );
+                  const uint_t innerRowsize = rowsize - rowIdx;
+                  uint_t       colIdx;
+
+                  // processes a single micro-face if it belongs to the current sweep
+                  auto processElement = [&]( const uint_t& xIdx, const P2Elements::P2Element& element, const uint_t& elMatIdx ) {
+                     if ( sweep != MicroElementSweep::ALL && !isInSweep( sweep, isInnerMicroFace( level, xIdx, rowIdx, element ) ) )
+                     {
+                        return;
+                     }
+
+                     if ( elMats != nullptr )
+                     {
+                        localMatrixVectorMultiply2D( level,
+                                                     xIdx,
+                                                     rowIdx,
+                                                     element,
+                                                     ( *elMats )[elMatIdx],
+                                                     srcVertexData,
+                                                     srcEdgeData,
+                                                     dstVertexData,
+                                                     dstEdgeData );
+                     }
+                     else if ( blendedElMats != nullptr )
+                     {
+                        localMatrixVectorMultiply2D( level,
+                                                     xIdx,
+                                                     rowIdx,
+                                                     element,
+                                                     blendedElMats[elementmatrixcache::microFaceIndex( level, xIdx, rowIdx, elMatIdx )],
+                                                     srcVertexData,
+                                                     srcEdgeData,
+                                                     dstVertexData,
+                                                     dstEdgeData );
+                     }
+                     else
+                     {
+                        localMatrixVectorMultiply2D(
+                            face, level, xIdx, rowIdx, element, srcVertexData, srcEdgeData, dstVertexData, dstEdgeData );
+                     }
+                  };
+
+                  // loop over vertices in row with two associated triangles
+                  for ( colIdx = 1; colIdx < innerRowsize - 1; ++colIdx )
+                  {
+                     // we associate two elements with current micro-vertex
+                     processElement( colIdx, P2Elements::P2Face::elementN, 0 );
+                     processElement( colIdx, P2Elements::P2Face::elementNW, 1 );
+                  }
+
+                  // final micro-vertex in row has only one associated micro-face
+                  // (for the top row this is the only micro-element)
+                  processElement( colIdx, P2Elements::P2Face::elementNW, 1 );
+               }
             }
-            --inner_rowsize;
-
-            // final micro-vertex in row has only one associated micro-face
-            localMatrixVectorMultiply2D(
-                face, level, xIdx, yIdx, P2Elements::P2Face::elementNW, srcVertexData, srcEdgeData, dstVertexData, dstEdgeData );
          }
-
-         // top north-west micro-element not treated, yet
-         localMatrixVectorMultiply2D(
-             face, level, 1, yIdx, P2Elements::P2Face::elementNW, srcVertexData, srcEdgeData, dstVertexData, dstEdgeData );
       }
 
       // Push result to lower-dimensional primitives
@@ -345,6 +580,238 @@ void P2ElementwiseOperator< P2Form >::localMatrixVectorMultiply2D( const Face&
    dstEdgeData[dofDataIdx[5]] += elVecNew[5];
 }
 
+template < class P2Form >
+void P2ElementwiseOperator< P2Form >::localMatrixVectorMultiply2D( const uint_t                 level,
+                                                                   const uint_t                 xIdx,
+                                                                   const uint_t                 yIdx,
+                                                                   const P2Elements::P2Element& element,
+                                                                   const Matrix6r&              elMat,
+                                                                   const real_t* const          srcVertexData,
+                                                                   const real_t* const          srcEdgeData,
+                                                                   real_t* const                dstVertexData,
+                                                                   real_t* const                dstEdgeData ) const
+{
+   WALBERLA_ASSERT_UNEQUAL( srcVertexData, dstVertexData );
+   WALBERLA_ASSERT_UNEQUAL( srcEdgeData, dstEdgeData );
+
+   Point6D                 elVecOld, elVecNew;
+   std::array< uint_t, 6 > dofDataIdx;
+
+   // assemble local element vector (note the tweaked ordering to go along with FEniCS indexing)
+   dofDataIdx[0] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[0] );
+   dofDataIdx[1] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[1] );
+   dofDataIdx[2] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[2] );
+
+   dofDataIdx[3] = edgedof::macroface::indexFromVertex( level, xIdx, yIdx, element[4] );
+   dofDataIdx[4] = edgedof::macroface::indexFromVertex( level, xIdx, yIdx, element[5] );
+   dofDataIdx[5] = edgedof::macroface::indexFromVertex( level, xIdx, yIdx, element[3] );
+
+   elVecOld[0] = srcVertexData[dofDataIdx[0]];
+   elVecOld[1] = srcVertexData[dofDataIdx[1]];
+   elVecOld[2] = srcVertexData[dofDataIdx[2]];
+
+   elVecOld[3] = srcEdgeData[dofDataIdx[3]];
+   elVecOld[4] = srcEdgeData[dofDataIdx[4]];
+   elVecOld[5] = srcEdgeData[dofDataIdx[5]];
+
+   // apply matrix (operator locally)
+   elVecNew = elMat.mul( elVecOld );
+
+   // redistribute result from "local" to "global vector"
+   dstVertexData[dofDataIdx[0]] += elVecNew[0];
+   dstVertexData[dofDataIdx[1]] += elVecNew[1];
+   dstVertexData[dofDataIdx[2]] += elVecNew[2];
+
+   dstEdgeData[dofDataIdx[3]] += elVecNew[3];
+   dstEdgeData[dofDataIdx[4]] += elVecNew[4];
+   dstEdgeData[dofDataIdx[5]] += elVecNew[5];
+}
+
+template < class P2Form >
+void P2ElementwiseOperator< P2Form >::computeAndStoreLocalElementMatrices()
+{
+   integrateLocalElementMatrices();
+   localElementMatricesPrecomputed_ = true;
+}
+
+template < class P2Form >
+void P2ElementwiseOperator< P2Form >::integrateLocalElementMatrices() const
+{
+   localElementMatrices2D_.clear();
+   localElementMatrices3D_.clear();
+
+   for ( uint_t level = minLevel_; level <= maxLevel_; level++ )
+   {
+      if ( storage_->hasGlobalCells() )
+      {
+         for ( const auto& it : storage_->getCells() )
+         {
+            const Cell& cell = *it.second;
+            if ( !cell.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            P2Form form( form_ );
+            form.setGeometryMap( cell.getGeometryMap() );
+
+            // all micro-cells of one type are congruent, so we integrate over the first one of each type
+            std::array< Matrix10r, 6 >& elMats = localElementMatrices3D_[cell.getID()][level];
+            for ( uint_t cTypeIdx = 0; cTypeIdx < celldof::allCellTypes.size(); cTypeIdx++ )
+            {
+               const std::array< indexing::Index, 4 > verts =
+                   celldof::macrocell::getMicroVerticesFromMicroCell( indexing::Index( 0, 0, 0 ), celldof::allCellTypes[cTypeIdx] );
+               std::array< Point3D, 4 > coords;
+               for ( uint_t k = 0; k < 4; ++k )
+               {
+                  coords[k] = vertexdof::macrocell::coordinateFromIndex( level, cell, verts[k] );
+               }
+               form.integrateAll( coords, elMats[cTypeIdx] );
+            }
+         }
+      }
+      else
+      {
+         for ( const auto& it : storage_->getFaces() )
+         {
+            const Face& face = *it.second;
+            if ( !face.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            P2Form form( form_ );
+            form.setGeometryMap( face.getGeometryMap() );
+
+            // all micro-faces of one orientation are congruent, so we integrate over the first one of each orientation
+            std::array< Matrix6r, 2 >& elMats = localElementMatrices2D_[face.getID()][level];
+            const std::array< P2Elements::P2Element, 2 > elements = {
+                {P2Elements::P2Face::elementN, P2Elements::P2Face::elementNW}};
+            for ( uint_t elIdx = 0; elIdx < elements.size(); elIdx++ )
+            {
+               const indexing::Index nodeIdx( 1, 0, 0 );
+               const Point3D         v0 = vertexdof::macroface::coordinateFromIndex( level, face, nodeIdx );
+               const Point3D         v1 = vertexdof::macroface::coordinateFromIndex(
+                   level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( elements[elIdx][1] ) );
+               const Point3D v2 = vertexdof::macroface::coordinateFromIndex(
+                   level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( elements[elIdx][2] ) );
+               form.integrateAll( {v0, v1, v2}, elMats[elIdx] );
+            }
+         }
+      }
+   }
+
+   localElementMatricesModificationStamp_ = storage_->getModificationStamp();
+}
+
+template < class P2Form >
+void P2ElementwiseOperator< P2Form >::computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes )
+{
+   blendedLocalElementMatricesMemoryBudget_ = memoryBudgetInBytes;
+   integrateBlendedLocalElementMatrices();
+}
+
+template < class P2Form >
+void P2ElementwiseOperator< P2Form >::integrateBlendedLocalElementMatrices() const
+{
+   if ( storage_->hasGlobalCells() )
+   {
+      blendedElementMatrices3D_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return elementmatrixcache::numMicroCells( level ); },
+          blendedLocalElementMatricesMemoryBudget_ );
+
+      for ( const auto& level : blendedElementMatrices3D_.getCachedLevels() )
+      {
+         for ( const auto& it : storage_->getCells() )
+         {
+            const Cell& cell = *it.second;
+            if ( cell.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            P2Form form( form_ );
+            form.setGeometryMap( cell.getGeometryMap() );
+
+            Matrix10r* elMats = blendedElementMatrices3D_.get( cell, level );
+            for ( uint_t slab = 0; slab < levelinfo::num_microedges_per_edge( level ); slab++ )
+            {
+               for ( const auto& cType : celldof::allCellTypes )
+               {
+                  for ( const auto& micro : celldof::macrocell::SlabIterator( level, cType, slab ) )
+                  {
+                     const std::array< indexing::Index, 4 > verts =
+                         celldof::macrocell::getMicroVerticesFromMicroCell( micro, cType );
+                     std::array< Point3D, 4 > coords;
+                     for ( uint_t k = 0; k < 4; ++k )
+                     {
+                        coords[k] = vertexdof::macrocell::coordinateFromIndex( level, cell, verts[k] );
+                     }
+                     form.integrateAll( coords, elMats[elementmatrixcache::microCellIndex( level, micro, cType )] );
+                  }
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      blendedElementMatrices2D_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return elementmatrixcache::numMicroFaces( level ); },
+          blendedLocalElementMatricesMemoryBudget_ );
+
+      const std::array< P2Elements::P2Element, 2 > elements = {{P2Elements::P2Face::elementN, P2Elements::P2Face::elementNW}};
+
+      for ( const auto& level : blendedElementMatrices2D_.getCachedLevels() )
+      {
+         for ( const auto& it : storage_->getFaces() )
+         {
+            const Face& face = *it.second;
+            if ( face.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            P2Form form( form_ );
+            form.setGeometryMap( face.getGeometryMap() );
+
+            Matrix6r* elMats = blendedElementMatrices2D_.get( face, level );
+
+            // integrates over the micro-face elements[elIdx] of the passed micro-vertex
+            auto integrateElement = [&]( const uint_t& xIdx, const uint_t& yIdx, const uint_t& elIdx ) {
+               const indexing::Index nodeIdx( xIdx, yIdx, 0 );
+               const Point3D         v0 = vertexdof::macroface::coordinateFromIndex( level, face, nodeIdx );
+               const Point3D         v1 = vertexdof::macroface::coordinateFromIndex(
+                   level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( elements[elIdx][1] ) );
+               const Point3D v2 = vertexdof::macroface::coordinateFromIndex(
+                   level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( elements[elIdx][2] ) );
+               form.integrateAll( {v0, v1, v2}, elMats[elementmatrixcache::microFaceIndex( level, xIdx, yIdx, elIdx )] );
+            };
+
+            // same traversal of the micro-faces as in apply()
+            const uint_t rowsize = levelinfo::num_microvertices_per_edge( level );
+            for ( uint_t rowIdx = 0; rowIdx < rowsize - 1; rowIdx++ )
+            {
+               const uint_t innerRowsize = rowsize - rowIdx;
+               uint_t       colIdx;
+               for ( colIdx = 1; colIdx < innerRowsize - 1; ++colIdx )
+               {
+                  integrateElement( colIdx, rowIdx, 0 );
+                  integrateElement( colIdx, rowIdx, 1 );
+               }
+               integrateElement( colIdx, rowIdx, 1 );
+            }
+         }
+      }
+   }
+}
+
 template < class P2Form >
 void P2ElementwiseOperator< P2Form >::computeDiagonalOperatorValues( bool invert )
 {
@@ -535,6 +1002,47 @@ void localMatrixVectorMultiply3D( const Cell&            cell,
    }
 }
 
+void localMatrixVectorMultiply3D( uint_t                 level,
+                                  const indexing::Index& microCell,
+                                  celldof::CellType      cType,
+                                  const Matrix10r&       elMat,
+                                  const real_t* const    srcVertexData,
+                                  const real_t* const    srcEdgeData,
+                                  real_t* const          dstVertexData,
+                                  real_t* const          dstEdgeData )
+{
+   // obtain data indices of dofs associated with micro-cell
+   std::array< uint_t, 4 > vertexDoFIndices;
+   vertexdof::getVertexDoFDataIndicesFromMicroCell( microCell, cType, level, vertexDoFIndices );
+
+   std::array< uint_t, 6 > edgeDoFIndices;
+   edgedof::getEdgeDoFDataIndicesFromMicroCellFEniCSOrdering( microCell, cType, level, edgeDoFIndices );
+
+   // assemble local element vector
+   Point10D elVecOld, elVecNew;
+   for ( uint_t k = 0; k < 4; ++k )
+   {
+      elVecOld[k] = srcVertexData[vertexDoFIndices[k]];
+   }
+   for ( uint_t k = 4; k < 10; ++k )
+   {
+      elVecOld[k] = srcEdgeData[edgeDoFIndices[k - 4]];
+   }
+
+   // apply matrix (operator locally)
+   elVecNew = elMat.mul( elVecOld );
+
+   // redistribute result from "local" to "global vector"
+   for ( uint_t k = 0; k < 4; ++k )
+   {
+      dstVertexData[vertexDoFIndices[k]] += elVecNew[k];
+   }
+   for ( uint_t k = 4; k < 10; ++k )
+   {
+      dstEdgeData[edgeDoFIndices[k - 4]] += elVecNew[k];
+   }
+}
+
 template < class P2Form >
 void P2ElementwiseOperator< P2Form >::computeLocalDiagonalContributions2D( const Face&                  face,
                                                                            const uint_t                 level,
@@ -21,6 +21,7 @@
 
 #include "hyteg/celldofspace/CellDoFIndexing.hpp"
 #include "hyteg/communication/Syncing.hpp"
+#include "hyteg/elementwiseoperators/BlendedElementMatrixCache.hpp"
 #include "hyteg/forms/P2LinearCombinationForm.hpp"
 #include "hyteg/forms/P2RowSumForm.hpp"
 #include "hyteg/forms/form_fenics_base/P2FenicsForm.hpp"
@@ -120,7 +121,61 @@ class P2ElementwiseOperator : public Operator< P2Function< real_t >, P2Function<
 
    P2Form getForm() const;
 
+   /// Precomputes and stores the local element matrices of all macro-primitives with an affine geometry map.
+   ///
+   /// On affinely mapped macro-cells (macro-faces) all micro-cells (micro-faces) of the same type are congruent.
+   /// Hence, there are only six (two) distinct local element matrices per macro-primitive and level. After this
+   /// call, apply() on such primitives skips the integration of the form and only performs a gather, a small
+   /// matrix-vector product and a scatter per micro-element. Primitives with a non-affine (blending) map are
+   /// not cached and still integrate the form on-the-fly.
+   ///
+   /// The matrices are indexed by the macro-primitives. If the primitives are migrated afterwards, the matrices are
+   /// recomputed in the next apply().
+   ///
+   /// \note Opt-in only, since the cached matrices are only valid for forms that do not depend on the
+   ///       position of the micro-element (e.g. no spatially varying coefficients).
+   void computeAndStoreLocalElementMatrices();
+
+   /// Returns true if local element matrices have been precomputed via computeAndStoreLocalElementMatrices().
+   bool localElementMatricesPrecomputed() const { return localElementMatricesPrecomputed_; }
+
+   /// Precomputes and stores the local element matrices of all micro-elements of macro-primitives with a
+   /// non-affine (blending) geometry map.
+   ///
+   /// On such primitives, the integration of the form evaluates the geometry map and its Jacobian at all quadrature
+   /// points of every micro-element in each apply(). After this call, apply() uses the stored matrices instead on
+   /// all levels that have been selected for caching. Starting from the coarsest level, levels are selected as long
+   /// as the accumulated memory per process stays below the passed budget. On the remaining levels, the form is
+   /// integrated on-the-fly.
+   ///
+   /// \param memoryBudgetInBytes maximum memory per process that is spent on the stored matrices
+   ///
+   /// \note The stored matrices are not updated if the form is changed afterwards (e.g. the coefficients of a
+   ///       linear combination form). Call this method again in that case.
+   ///       The matrices migrate with the macro-primitives. After the storage has been modified, they are
+   ///       recomputed with the same budget in the next apply().
+   void computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes );
+
+   /// Returns the levels on which the local element matrices of blended macro-primitives are stored.
+   std::set< uint_t > getBlendedLocalElementMatrixLevels() const
+   {
+      return storage_->hasGlobalCells() ? blendedElementMatrices3D_.getCachedLevels() :
+                                          blendedElementMatrices2D_.getCachedLevels();
+   }
+
+   /// Enables or disables the overlap of the halo exchange with the computation in apply().
+   ///
+   /// If enabled, the last stage of the exchange towards the macro-cells (macro-faces in 2D) is started
+   /// non-blocking, the micro-elements that do not touch the macro-primitive boundary are processed and the
+   /// remaining micro-elements are processed after the exchange has been completed. Disabled by default.
+   void setCommunicationOverlap( bool overlap ) { overlapCommunication_ = overlap; }
+
+   bool getCommunicationOverlap() const { return overlapCommunication_; }
+
  private:
+   /// Selects the cached levels and integrates the local element matrices of all blended macro-primitives.
+   void integrateBlendedLocalElementMatrices() const;
+
    /// compute product of element local vector with element matrix
    ///
    /// \param face           face primitive we operate on
@@ -144,6 +199,19 @@ class P2ElementwiseOperator : public Operator< P2Function< real_t >, P2Function<
                                      real_t* const                dstVertexData,
                                      real_t* const                dstEdgeData ) const;
 
+   /// compute product of element local vector with a precomputed element matrix
+   ///
+   /// Same as above, but the form is not integrated.
+   void localMatrixVectorMultiply2D( const uint_t                 level,
+                                     const uint_t                 xIdx,
+                                     const uint_t                 yIdx,
+                                     const P2Elements::P2Element& element,
+                                     const Matrix6r&              elMat,
+                                     const real_t* const          srcVertexData,
+                                     const real_t* const          srcEdgeData,
+                                     real_t* const                dstVertexData,
+                                     real_t* const                dstEdgeData ) const;
+
    /// Compute contributions to operator diagonal for given micro-face
    ///
    /// \param face           face primitive we operate on
@@ -205,10 +273,36 @@ class P2ElementwiseOperator : public Operator< P2Function< real_t >, P2Function<
    /// \param invert if true, assembles the function carrying the inverse of the diagonal
    void computeDiagonalOperatorValues( bool invert );
 
+   /// (Re)computes the local element matrices of all local affinely mapped macro-primitives and records the
+   /// modification stamp of the storage.
+   void integrateLocalElementMatrices() const;
+
    std::shared_ptr< P2Function< real_t > > diagonalValues_;
    std::shared_ptr< P2Function< real_t > > inverseDiagonalValues_;
 
    P2Form form_;
+
+   bool localElementMatricesPrecomputed_;
+
+   /// If true, apply() overlaps the halo exchange with the computation. Only the exchange towards the
+   /// macro-cells (macro-faces) is performed, i.e. the ghost layers of src on lower-dimensional primitives
+   /// are not updated in this mode.
+   bool overlapCommunication_;
+
+   /// local element matrices of affinely mapped macro-primitives, indexed by macro-primitive, level and micro-element type
+   /// (2D: elementN, elementNW; 3D: ordering of celldof::allCellTypes)
+   mutable std::map< PrimitiveID, std::map< uint_t, std::array< Matrix6r, 2 > > >  localElementMatrices2D_;
+   mutable std::map< PrimitiveID, std::map< uint_t, std::array< Matrix10r, 6 > > > localElementMatrices3D_;
+
+   /// modification stamp of the storage when the local element matrices were computed
+   mutable uint_t localElementMatricesModificationStamp_;
+
+   /// local element matrices of all micro-elements of non-affinely mapped macro-primitives on the cached levels
+   mutable BlendedElementMatrixCache< Matrix6r, Face >  blendedElementMatrices2D_;
+   mutable BlendedElementMatrixCache< Matrix10r, Cell > blendedElementMatrices3D_;
+
+   /// memory budget of the blended element matrices, kept to recompute them after the storage has been modified
+   uint_t blendedLocalElementMatricesMemoryBudget_;
 };
 
 /// compute product of element local vector with element matrix
@@ -234,6 +328,27 @@ void localMatrixVectorMultiply3D( const Cell&            cell,
                                   real_t* const          dstEdgeData,
                                   P2Form                 form );
 
+/// compute product of element local vector with a precomputed element matrix
+///
+/// \param level          level on which we operate in mesh hierarchy
+/// \param microCell      index associated with the current element = micro-cell
+/// \param cType          type of micro-cell (WHITE_UP, BLUE_DOWN, ...)
+/// \param elMat          local element matrix of the micro-cell
+/// \param srcVertexData  pointer to DoF data on micro-vertices (for reading data)
+/// \param srcEdgeData    pointer to DoF data on micro-edges (for reading data)
+/// \param dstVertexData  pointer to DoF data on micro-vertices (for writing data)
+/// \param dstEdgeData    pointer to DoF data on micro-edges (for writing data)
+///
+/// \note The src and dst data arrays must not be identical.
+void localMatrixVectorMultiply3D( uint_t                 level,
+                                  const indexing::Index& microCell,
+                                  celldof::CellType      cType,
+                                  const Matrix10r&       elMat,
+                                  const real_t* const    srcVertexData,
+                                  const real_t* const    srcEdgeData,
+                                  real_t* const          dstVertexData,
+                                  real_t* const          dstEdgeData );
+
 typedef P2ElementwiseOperator<
     P2FenicsForm< p2_diffusion_cell_integral_0_otherwise, p2_tet_diffusion_cell_integral_0_otherwise > >
     P2ElementwiseLaplaceOperator;
@@ -24,6 +24,7 @@
 #include "hyteg/elementwiseoperators/P1ToP2ElementwiseOperator.hpp"
 #include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
 #include "hyteg/elementwiseoperators/P2P1ElementwiseBlendingStokesBlockPreconditioner.hpp"
+#include "hyteg/elementwiseoperators/P2P1ElementwiseFusedStokesOperator.hpp"
 #include "hyteg/elementwiseoperators/P2ToP1ElementwiseOperator.hpp"
 
 namespace hyteg {
@@ -53,13 +54,58 @@ class P2P1ElementwiseBlendingStokesOperator
    //   , pspg_( storage, minLevel, maxLevel )
    , pspg_inv_diag_( storage, minLevel, maxLevel )
    , hasGlobalCells_( storage->hasGlobalCells() )
+   , useFusedApply_( false )
+   , blendedLocalElementMatricesMemoryBudget_( 0 )
    {}
 
+   /// Enables or disables the monolithic apply.
+   ///
+   /// If enabled, apply() does not call the blocks one after another but performs a single sweep over the
+   /// micro-elements with one combined halo exchange (see P2P1ElementwiseFusedStokesOperator). Disabled by default.
+   ///
+   /// The monolithic operator is only allocated when the fused apply is enabled.
+   void setFusedApply( bool fused )
+   {
+      if ( fused && fusedApply_ == nullptr )
+      {
+         fusedApply_ = std::make_shared< P2P1ElementwiseFusedBlendingStokesOperator >( storage_, minLevel_, maxLevel_ );
+         if ( blendedLocalElementMatricesMemoryBudget_ > 0 )
+         {
+            fusedApply_->computeAndStoreBlendedLocalElementMatrices( blendedLocalElementMatricesMemoryBudget_ );
+         }
+      }
+      useFusedApply_ = fused;
+   }
+
+   bool getFusedApply() const { return useFusedApply_; }
+
+   /// Precomputes and stores the local element matrices of all micro-elements on blended macro-primitives for the
+   /// monolithic apply and for the velocity block A (which is also used by the block preconditioners).
+   ///
+   /// If the monolithic apply is not enabled yet, its matrices are computed when it is enabled.
+   ///
+   /// \param memoryBudgetInBytes maximum memory per process, applies to each of the two operators separately
+   void computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes )
+   {
+      blendedLocalElementMatricesMemoryBudget_ = memoryBudgetInBytes;
+      if ( fusedApply_ != nullptr )
+      {
+         fusedApply_->computeAndStoreBlendedLocalElementMatrices( memoryBudgetInBytes );
+      }
+      A.computeAndStoreBlendedLocalElementMatrices( memoryBudgetInBytes );
+   }
+
    void apply( const P2P1TaylorHoodFunction< real_t >& src,
                const P2P1TaylorHoodFunction< real_t >& dst,
                const uint_t                            level,
                const DoFType                           flag ) const
    {
+      if ( useFusedApply_ )
+      {
+         fusedApply_->apply( src, dst, level, flag );
+         return;
+      }
+
       A.apply( src.uvw.u, dst.uvw.u, level, flag, Replace );
       divT_x.apply( src.p, dst.uvw.u, level, flag, Add );
 
@@ -92,6 +138,11 @@ class P2P1ElementwiseBlendingStokesOperator
    //   P1ElementwisePSPGOperator        pspg_;
    P1PSPGInvDiagOperator pspg_inv_diag_;
    bool                  hasGlobalCells_;
+
+ private:
+   std::shared_ptr< P2P1ElementwiseFusedBlendingStokesOperator > fusedApply_;
+   bool                                                          useFusedApply_;
+   uint_t                                                        blendedLocalElementMatricesMemoryBudget_;
 };
 
 } // namespace hyteg
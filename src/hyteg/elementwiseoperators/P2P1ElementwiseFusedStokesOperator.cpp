@@ -0,0 +1,668 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "P2P1ElementwiseFusedStokesOperator.hpp"
+
+namespace hyteg {
+
+template < typename SenderType, typename ReceiverType >
+static void communicateAdditivelySimultaneously( const std::vector< const vertexdof::VertexDoFFunction< real_t >* >& vertexDoFFunctions,
+                                                 const std::vector< const EdgeDoFFunction< real_t >* >&              edgeDoFFunctions,
+                                                 const uint_t&                                                       level,
+                                                 const DoFType&                                                      flag,
+                                                 const PrimitiveStorage&                                             storage )
+{
+   for ( const auto& function : vertexDoFFunctions )
+   {
+      function->template startAdditiveCommunication< SenderType, ReceiverType >( level, DoFType::All ^ flag, storage, true );
+   }
+   for ( const auto& function : edgeDoFFunctions )
+   {
+      function->template startAdditiveCommunication< SenderType, ReceiverType >( level, DoFType::All ^ flag, storage, true );
+   }
+   for ( const auto& function : vertexDoFFunctions )
+   {
+      function->template endAdditiveCommunication< SenderType, ReceiverType >( level );
+   }
+   for ( const auto& function : edgeDoFFunctions )
+   {
+      function->template endAdditiveCommunication< SenderType, ReceiverType >( level );
+   }
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    P2P1ElementwiseFusedStokesOperator( const std::shared_ptr< PrimitiveStorage >& storage, size_t minLevel, size_t maxLevel )
+: Operator( storage, minLevel, maxLevel )
+, localElementMatricesPrecomputed_( false )
+, blendedLocalElementMatricesMemoryBudget_( 0 )
+{}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::Forms::
+    setGeometryMap( const std::shared_ptr< GeometryMap >& map )
+{
+   A.setGeometryMap( map );
+   div_x.setGeometryMap( map );
+   div_y.setGeometryMap( map );
+   div_z.setGeometryMap( map );
+   divT_x.setGeometryMap( map );
+   divT_y.setGeometryMap( map );
+   divT_z.setGeometryMap( map );
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::apply(
+    const P2P1TaylorHoodFunction< real_t >& src,
+    const P2P1TaylorHoodFunction< real_t >& dst,
+    const uint_t                            level,
+    const DoFType                           flag ) const
+{
+   WALBERLA_ASSERT_NOT_IDENTICAL( std::addressof( src ), std::addressof( dst ) );
+
+   this->startTiming( "apply" );
+
+   // the cached levels of the blended element matrices depend on the distribution of the macro-primitives
+   if ( blendedElementMatrices2D_.isOutdated() || blendedElementMatrices3D_.isOutdated() )
+   {
+      integrateBlendedLocalElementMatrices();
+   }
+
+   // Make sure that halos of all components are up-to-date
+   communication::syncP2P1TaylorHoodFunctionBetweenPrimitives( src, level );
+
+   // We need to zero the destination array (including halos).
+   // However, we must not zero out anything that is not flagged with the specified BCs.
+   // Therefore we first zero out everything that flagged, and then, later,
+   // the halos of the highest dim primitives.
+   dst.interpolate( real_c( 0 ), level, flag );
+
+   std::vector< const vertexdof::VertexDoFFunction< real_t >* > dstVertexDoFFunctions = {&dst.p};
+   std::vector< const EdgeDoFFunction< real_t >* >              dstEdgeDoFFunctions;
+   for ( uint_t k = 0; k < dst.uvw.getDimension(); k++ )
+   {
+      dstVertexDoFFunctions.push_back( &dst.uvw[k].getVertexDoFFunction() );
+      dstEdgeDoFFunctions.push_back( &dst.uvw[k].getEdgeDoFFunction() );
+   }
+
+   // For 3D we work on cells and for 2D on faces
+   if ( storage_->hasGlobalCells() )
+   {
+      apply3D( src, dst, level );
+
+      // Push result to lower-dimensional primitives
+      communicateAdditivelySimultaneously< Cell, Face >( dstVertexDoFFunctions, dstEdgeDoFFunctions, level, flag, *storage_ );
+      communicateAdditivelySimultaneously< Cell, Edge >( dstVertexDoFFunctions, dstEdgeDoFFunctions, level, flag, *storage_ );
+      communicateAdditivelySimultaneously< Cell, Vertex >( dstVertexDoFFunctions, {}, level, flag, *storage_ );
+   }
+   else
+   {
+      apply2D( src, dst, level );
+
+      // Push result to lower-dimensional primitives
+      communicateAdditivelySimultaneously< Face, Edge >( dstVertexDoFFunctions, dstEdgeDoFFunctions, level, flag, *storage_ );
+      communicateAdditivelySimultaneously< Face, Vertex >( dstVertexDoFFunctions, {}, level, flag, *storage_ );
+   }
+
+   this->stopTiming( "apply" );
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::apply3D(
+    const P2P1TaylorHoodFunction< real_t >& src,
+    const P2P1TaylorHoodFunction< real_t >& dst,
+    const uint_t&                           level ) const
+{
+   for ( auto& macroIter : storage_->getCells() )
+   {
+      Cell& cell = *macroIter.second;
+
+      // get hold of the actual numerical data of all components
+      MacroPrimitiveData data;
+      for ( uint_t k = 0; k < 3; k++ )
+      {
+         data.srcVertexData[k] = cell.getData( src.uvw[k].getVertexDoFFunction().getCellDataID() )->getPointer( level );
+         data.srcEdgeData[k]   = cell.getData( src.uvw[k].getEdgeDoFFunction().getCellDataID() )->getPointer( level );
+         data.dstVertexData[k] = cell.getData( dst.uvw[k].getVertexDoFFunction().getCellDataID() )->getPointer( level );
+         data.dstEdgeData[k]   = cell.getData( dst.uvw[k].getEdgeDoFFunction().getCellDataID() )->getPointer( level );
+      }
+      data.srcPressureData = cell.getData( src.p.getCellDataID() )->getPointer( level );
+      data.dstPressureData = cell.getData( dst.p.getCellDataID() )->getPointer( level );
+
+      // Zero out dst halos only
+      //
+      // During additive comm we then skip zeroing the data on the lower-dim primitives.
+      for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
+      {
+         if ( !vertexdof::macrocell::isOnCellFace( idx, level ).empty() )
+         {
+            auto arrayIdx = vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
+            for ( uint_t k = 0; k < 3; k++ )
+            {
+               data.dstVertexData[k][arrayIdx] = real_c( 0 );
+            }
+            data.dstPressureData[arrayIdx] = real_c( 0 );
+         }
+      }
+
+      for ( const auto& idx : edgedof::macrocell::Iterator( level ) )
+      {
+         for ( const auto& orientation : edgedof::allEdgeDoFOrientationsWithoutXYZ )
+         {
+            if ( !edgedof::macrocell::isInnerEdgeDoF( level, idx, orientation ) )
+            {
+               auto arrayIdx = edgedof::macrocell::index( level, idx.x(), idx.y(), idx.z(), orientation );
+               for ( uint_t k = 0; k < 3; k++ )
+               {
+                  data.dstEdgeData[k][arrayIdx] = real_c( 0 );
+               }
+            }
+         }
+      }
+
+      // use precomputed element matrices if available for this macro-cell
+      const std::array< LocalElementMatrices3D, 6 >* cachedElMats = nullptr;
+      if ( localElementMatricesPrecomputed_ )
+      {
+         auto cellIt = localElementMatrices3D_.find( cell.getID() );
+         if ( cellIt != localElementMatrices3D_.end() && cellIt->second.count( level ) > 0 )
+         {
+            cachedElMats = &cellIt->second.at( level );
+         }
+      }
+
+      // use the element matrices of all micro-cells if this macro-cell is blended and the level is cached
+      const LocalElementMatrices3D* blendedElMats = blendedElementMatrices3D_.get( cell, level );
+
+      Forms forms( forms_ );
+      forms.setGeometryMap( cell.getGeometryMap() );
+      LocalElementMatrices3D elMats;
+
+      // loop over micro-cells
+      for ( uint_t cTypeIdx = 0; cTypeIdx < celldof::allCellTypes.size(); cTypeIdx++ )
+      {
+         const celldof::CellType cType = celldof::allCellTypes[cTypeIdx];
+         for ( const auto& micro : celldof::macrocell::Iterator( level, cType, 0 ) )
+         {
+            if ( cachedElMats != nullptr )
+            {
+               localMatrixVectorMultiply3D( level, micro, cType, ( *cachedElMats )[cTypeIdx], data );
+            }
+            else if ( blendedElMats != nullptr )
+            {
+               localMatrixVectorMultiply3D(
+                   level, micro, cType, blendedElMats[elementmatrixcache::microCellIndex( level, micro, cType )], data );
+            }
+            else
+            {
+               integrateLocalElementMatrices3D( forms, microCellCoordinates( cell, level, micro, cType ), elMats );
+               localMatrixVectorMultiply3D( level, micro, cType, elMats, data );
+            }
+         }
+      }
+   }
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::apply2D(
+    const P2P1TaylorHoodFunction< real_t >& src,
+    const P2P1TaylorHoodFunction< real_t >& dst,
+    const uint_t&                           level ) const
+{
+   for ( auto& it : storage_->getFaces() )
+   {
+      Face& face = *it.second;
+
+      // get hold of the actual numerical data of all components
+      MacroPrimitiveData data;
+      for ( uint_t k = 0; k < 2; k++ )
+      {
+         data.srcVertexData[k] = face.getData( src.uvw[k].getVertexDoFFunction().getFaceDataID() )->getPointer( level );
+         data.srcEdgeData[k]   = face.getData( src.uvw[k].getEdgeDoFFunction().getFaceDataID() )->getPointer( level );
+         data.dstVertexData[k] = face.getData( dst.uvw[k].getVertexDoFFunction().getFaceDataID() )->getPointer( level );
+         data.dstEdgeData[k]   = face.getData( dst.uvw[k].getEdgeDoFFunction().getFaceDataID() )->getPointer( level );
+      }
+      data.srcVertexData[2] = nullptr;
+      data.srcEdgeData[2]   = nullptr;
+      data.dstVertexData[2] = nullptr;
+      data.dstEdgeData[2]   = nullptr;
+      data.srcPressureData  = face.getData( src.p.getFaceDataID() )->getPointer( level );
+      data.dstPressureData  = face.getData( dst.p.getFaceDataID() )->getPointer( level );
+
+      // Zero out dst halos only
+      //
+      // During additive comm we then skip zeroing the data on the lower-dim primitives.
+      for ( const auto& idx : vertexdof::macroface::Iterator( level ) )
+      {
+         if ( vertexdof::macroface::isVertexOnBoundary( level, idx ) )
+         {
+            auto arrayIdx = vertexdof::macroface::index( level, idx.x(), idx.y() );
+            for ( uint_t k = 0; k < 2; k++ )
+            {
+               data.dstVertexData[k][arrayIdx] = real_c( 0 );
+            }
+            data.dstPressureData[arrayIdx] = real_c( 0 );
+         }
+      }
+
+      for ( const auto& idx : edgedof::macroface::Iterator( level ) )
+      {
+         for ( const auto& orientation : edgedof::faceLocalEdgeDoFOrientations )
+         {
+            if ( !edgedof::macroface::isInnerEdgeDoF( level, idx, orientation ) )
+            {
+               auto arrayIdx = edgedof::macroface::index( level, idx.x(), idx.y(), orientation );
+               for ( uint_t k = 0; k < 2; k++ )
+               {
+                  data.dstEdgeData[k][arrayIdx] = real_c( 0 );
+               }
+            }
+         }
+      }
+
+      // use precomputed element matrices if available for this macro-face
+      const std::array< LocalElementMatrices2D, 2 >* cachedElMats = nullptr;
+      if ( localElementMatricesPrecomputed_ )
+      {
+         auto faceIt = localElementMatrices2D_.find( face.getID() );
+         if ( faceIt != localElementMatrices2D_.end() && faceIt->second.count( level ) > 0 )
+         {
+            cachedElMats = &faceIt->second.at( level );
+         }
+      }
+
+      // use the element matrices of all micro-faces if this macro-face is blended and the level is cached
+      const LocalElementMatrices2D* blendedElMats = blendedElementMatrices2D_.get( face, level );
+
+      Forms forms( forms_ );
+      forms.setGeometryMap( face.getGeometryMap() );
+      LocalElementMatrices2D elMats;
+
+      auto processElement = [&]( const uint_t& xIdx, const uint_t& yIdx, const P2Elements::P2Element& element, const uint_t& elMatIdx ) {
+         if ( cachedElMats != nullptr )
+         {
+            localMatrixVectorMultiply2D( level, xIdx, yIdx, element, ( *cachedElMats )[elMatIdx], data );
+         }
+         else if ( blendedElMats != nullptr )
+         {
+            localMatrixVectorMultiply2D(
+                level, xIdx, yIdx, element, blendedElMats[elementmatrixcache::microFaceIndex( level, xIdx, yIdx, elMatIdx )], data );
+         }
+         else
+         {
+            integrateLocalElementMatrices2D( forms, microFaceCoordinates( face, level, xIdx, yIdx, element ), elMats );
+            localMatrixVectorMultiply2D( level, xIdx, yIdx, element, elMats, data );
+         }
+      };
+
+      // now loop over micro-faces of macro-face
+      const uint_t rowsize = levelinfo::num_microvertices_per_edge( level );
+      for ( uint_t yIdx = 0; yIdx < rowsize - 1; ++yIdx )
+      {
+         const uint_t innerRowsize = rowsize - yIdx;
+         uint_t       xIdx;
+
+         // loop over vertices in row with two associated triangles
+         for ( xIdx = 1; xIdx < innerRowsize - 1; ++xIdx )
+         {
+            processElement( xIdx, yIdx, P2Elements::P2Face::elementN, 0 );
+            processElement( xIdx, yIdx, P2Elements::P2Face::elementNW, 1 );
+         }
+
+         // final micro-vertex in row has only one associated micro-face
+         processElement( xIdx, yIdx, P2Elements::P2Face::elementNW, 1 );
+      }
+   }
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    integrateLocalElementMatrices2D( Forms& forms, const std::array< Point3D, 3 >& coords, LocalElementMatrices2D& elMats ) const
+{
+   forms.A.integrateAll( coords, elMats.A );
+   forms.div_x.integrateAll( coords, elMats.div[0] );
+   forms.div_y.integrateAll( coords, elMats.div[1] );
+   forms.divT_x.integrateAll( coords, elMats.divT[0] );
+   forms.divT_y.integrateAll( coords, elMats.divT[1] );
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    integrateLocalElementMatrices3D( Forms& forms, const std::array< Point3D, 4 >& coords, LocalElementMatrices3D& elMats ) const
+{
+   forms.A.integrateAll( coords, elMats.A );
+   forms.div_x.integrateAll( coords, elMats.div[0] );
+   forms.div_y.integrateAll( coords, elMats.div[1] );
+   forms.div_z.integrateAll( coords, elMats.div[2] );
+   forms.divT_x.integrateAll( coords, elMats.divT[0] );
+   forms.divT_y.integrateAll( coords, elMats.divT[1] );
+   forms.divT_z.integrateAll( coords, elMats.divT[2] );
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+std::array< Point3D, 3 >
+    P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+        microFaceCoordinates( const Face&                  face,
+                              const uint_t&                level,
+                              const uint_t&                xIdx,
+                              const uint_t&                yIdx,
+                              const P2Elements::P2Element& element )
+{
+   const indexing::Index nodeIdx( xIdx, yIdx, 0 );
+   return {vertexdof::macroface::coordinateFromIndex( level, face, nodeIdx ),
+           vertexdof::macroface::coordinateFromIndex(
+               level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( element[1] ) ),
+           vertexdof::macroface::coordinateFromIndex(
+               level, face, nodeIdx + vertexdof::logicalIndexOffsetFromVertex( element[2] ) )};
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+std::array< Point3D, 4 >
+    P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+        microCellCoordinates( const Cell&              cell,
+                              const uint_t&            level,
+                              const indexing::Index&   microCell,
+                              const celldof::CellType& cType )
+{
+   const std::array< indexing::Index, 4 > verts = celldof::macrocell::getMicroVerticesFromMicroCell( microCell, cType );
+   std::array< Point3D, 4 >               coords;
+   for ( uint_t k = 0; k < 4; ++k )
+   {
+      coords[k] = vertexdof::macrocell::coordinateFromIndex( level, cell, verts[k] );
+   }
+   return coords;
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    localMatrixVectorMultiply2D( const uint_t&                 level,
+                                 const uint_t&                 xIdx,
+                                 const uint_t&                 yIdx,
+                                 const P2Elements::P2Element&  element,
+                                 const LocalElementMatrices2D& elMats,
+                                 const MacroPrimitiveData&     data )
+{
+   // obtain data indices of dofs associated with micro-face (note the tweaked ordering to go along with FEniCS indexing)
+   std::array< uint_t, 3 > vertexDoFIndices;
+   vertexDoFIndices[0] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[0] );
+   vertexDoFIndices[1] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[1] );
+   vertexDoFIndices[2] = vertexdof::macroface::indexFromVertex( level, xIdx, yIdx, element[2] );
+
+   std::array< uint_t, 3 > edgeDoFIndices;
+   edgeDoFIndices[0] = edgedof::macroface::indexFromVertex( level, xIdx, yIdx, element[4] );
+   edgeDoFIndices[1] = edgedof::macroface::indexFromVertex( level, xIdx, yIdx, element[5] );
+   edgeDoFIndices[2] = edgedof::macroface::indexFromVertex( level, xIdx, yIdx, element[3] );
+
+   Point3D pressureOld, pressureNew;
+   for ( uint_t k = 0; k < 3; ++k )
+   {
+      pressureOld[k] = data.srcPressureData[vertexDoFIndices[k]];
+   }
+
+   for ( uint_t c = 0; c < 2; ++c )
+   {
+      // assemble local element vector of the velocity component
+      Point6D velocityOld;
+      for ( uint_t k = 0; k < 3; ++k )
+      {
+         velocityOld[k]     = data.srcVertexData[c][vertexDoFIndices[k]];
+         velocityOld[k + 3] = data.srcEdgeData[c][edgeDoFIndices[k]];
+      }
+
+      // apply matrices (operator locally)
+      const Point6D velocityNew = elMats.A.mul( velocityOld ) + elMats.divT[c].mul( pressureOld );
+      pressureNew += elMats.div[c].mul( velocityOld );
+
+      // redistribute result from "local" to "global vector"
+      for ( uint_t k = 0; k < 3; ++k )
+      {
+         data.dstVertexData[c][vertexDoFIndices[k]] += velocityNew[k];
+         data.dstEdgeData[c][edgeDoFIndices[k]] += velocityNew[k + 3];
+      }
+   }
+
+   for ( uint_t k = 0; k < 3; ++k )
+   {
+      data.dstPressureData[vertexDoFIndices[k]] += pressureNew[k];
+   }
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    localMatrixVectorMultiply3D( const uint_t&                 level,
+                                 const indexing::Index&        microCell,
+                                 const celldof::CellType&      cType,
+                                 const LocalElementMatrices3D& elMats,
+                                 const MacroPrimitiveData&     data )
+{
+   // obtain data indices of dofs associated with micro-cell
+   std::array< uint_t, 4 > vertexDoFIndices;
+   vertexdof::getVertexDoFDataIndicesFromMicroCell( microCell, cType, level, vertexDoFIndices );
+
+   std::array< uint_t, 6 > edgeDoFIndices;
+   edgedof::getEdgeDoFDataIndicesFromMicroCellFEniCSOrdering( microCell, cType, level, edgeDoFIndices );
+
+   Point4D pressureOld, pressureNew;
+   for ( uint_t k = 0; k < 4; ++k )
+   {
+      pressureOld[k] = data.srcPressureData[vertexDoFIndices[k]];
+   }
+
+   for ( uint_t c = 0; c < 3; ++c )
+   {
+      // assemble local element vector of the velocity component
+      Point10D velocityOld;
+      for ( uint_t k = 0; k < 4; ++k )
+      {
+         velocityOld[k] = data.srcVertexData[c][vertexDoFIndices[k]];
+      }
+      for ( uint_t k = 4; k < 10; ++k )
+      {
+         velocityOld[k] = data.srcEdgeData[c][edgeDoFIndices[k - 4]];
+      }
+
+      // apply matrices (operator locally)
+      const Point10D velocityNew = elMats.A.mul( velocityOld ) + elMats.divT[c].mul( pressureOld );
+      pressureNew += elMats.div[c].mul( velocityOld );
+
+      // redistribute result from "local" to "global vector"
+      for ( uint_t k = 0; k < 4; ++k )
+      {
+         data.dstVertexData[c][vertexDoFIndices[k]] += velocityNew[k];
+      }
+      for ( uint_t k = 4; k < 10; ++k )
+      {
+         data.dstEdgeData[c][edgeDoFIndices[k - 4]] += velocityNew[k];
+      }
+   }
+
+   for ( uint_t k = 0; k < 4; ++k )
+   {
+      data.dstPressureData[vertexDoFIndices[k]] += pressureNew[k];
+   }
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    computeAndStoreLocalElementMatrices()
+{
+   localElementMatrices2D_.clear();
+   localElementMatrices3D_.clear();
+
+   for ( uint_t level = minLevel_; level <= maxLevel_; level++ )
+   {
+      if ( storage_->hasGlobalCells() )
+      {
+         for ( const auto& it : storage_->getCells() )
+         {
+            const Cell& cell = *it.second;
+            if ( !cell.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            Forms forms( forms_ );
+            forms.setGeometryMap( cell.getGeometryMap() );
+
+            // all micro-cells of one type are congruent, so we integrate over the first one of each type
+            std::array< LocalElementMatrices3D, 6 >& elMats = localElementMatrices3D_[cell.getID()][level];
+            for ( uint_t cTypeIdx = 0; cTypeIdx < celldof::allCellTypes.size(); cTypeIdx++ )
+            {
+               integrateLocalElementMatrices3D(
+                   forms, microCellCoordinates( cell, level, indexing::Index( 0, 0, 0 ), celldof::allCellTypes[cTypeIdx] ), elMats[cTypeIdx] );
+            }
+         }
+      }
+      else
+      {
+         for ( const auto& it : storage_->getFaces() )
+         {
+            const Face& face = *it.second;
+            if ( !face.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            Forms forms( forms_ );
+            forms.setGeometryMap( face.getGeometryMap() );
+
+            // all micro-faces of one orientation are congruent, so we integrate over the first one of each orientation
+            std::array< LocalElementMatrices2D, 2 >& elMats = localElementMatrices2D_[face.getID()][level];
+            integrateLocalElementMatrices2D( forms, microFaceCoordinates( face, level, 1, 0, P2Elements::P2Face::elementN ), elMats[0] );
+            integrateLocalElementMatrices2D( forms, microFaceCoordinates( face, level, 1, 0, P2Elements::P2Face::elementNW ), elMats[1] );
+         }
+      }
+   }
+
+   localElementMatricesPrecomputed_ = true;
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes )
+{
+   blendedLocalElementMatricesMemoryBudget_ = memoryBudgetInBytes;
+   integrateBlendedLocalElementMatrices();
+}
+
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+void P2P1ElementwiseFusedStokesOperator< ViscousForm, DivxForm, DivyForm, DivzForm, DivTxForm, DivTyForm, DivTzForm >::
+    integrateBlendedLocalElementMatrices() const
+{
+   if ( storage_->hasGlobalCells() )
+   {
+      blendedElementMatrices3D_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return elementmatrixcache::numMicroCells( level ); },
+          blendedLocalElementMatricesMemoryBudget_ );
+
+      for ( const auto& level : blendedElementMatrices3D_.getCachedLevels() )
+      {
+         for ( const auto& it : storage_->getCells() )
+         {
+            const Cell& cell = *it.second;
+            if ( cell.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            Forms forms( forms_ );
+            forms.setGeometryMap( cell.getGeometryMap() );
+
+            LocalElementMatrices3D* elMats = blendedElementMatrices3D_.get( cell, level );
+            for ( const auto& cType : celldof::allCellTypes )
+            {
+               for ( const auto& micro : celldof::macrocell::Iterator( level, cType, 0 ) )
+               {
+                  integrateLocalElementMatrices3D( forms,
+                                                   microCellCoordinates( cell, level, micro, cType ),
+                                                   elMats[elementmatrixcache::microCellIndex( level, micro, cType )] );
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      blendedElementMatrices2D_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return elementmatrixcache::numMicroFaces( level ); },
+          blendedLocalElementMatricesMemoryBudget_ );
+
+      for ( const auto& level : blendedElementMatrices2D_.getCachedLevels() )
+      {
+         for ( const auto& it : storage_->getFaces() )
+         {
+            const Face& face = *it.second;
+            if ( face.getGeometryMap()->isAffine() )
+            {
+               continue;
+            }
+
+            Forms forms( forms_ );
+            forms.setGeometryMap( face.getGeometryMap() );
+
+            LocalElementMatrices2D* elMats = blendedElementMatrices2D_.get( face, level );
+
+            auto integrateElement = [&]( const uint_t& xIdx, const uint_t& yIdx, const P2Elements::P2Element& element, const uint_t& elIdx ) {
+               integrateLocalElementMatrices2D( forms,
+                                                microFaceCoordinates( face, level, xIdx, yIdx, element ),
+                                                elMats[elementmatrixcache::microFaceIndex( level, xIdx, yIdx, elIdx )] );
+            };
+
+            // same traversal of the micro-faces as in apply2D()
+            const uint_t rowsize = levelinfo::num_microvertices_per_edge( level );
+            for ( uint_t yIdx = 0; yIdx < rowsize - 1; ++yIdx )
+            {
+               const uint_t innerRowsize = rowsize - yIdx;
+               uint_t       xIdx;
+               for ( xIdx = 1; xIdx < innerRowsize - 1; ++xIdx )
+               {
+                  integrateElement( xIdx, yIdx, P2Elements::P2Face::elementN, 0 );
+                  integrateElement( xIdx, yIdx, P2Elements::P2Face::elementNW, 1 );
+               }
+               integrateElement( xIdx, yIdx, P2Elements::P2Face::elementNW, 1 );
+            }
+         }
+      }
+   }
+}
+
+template class P2P1ElementwiseFusedStokesOperator<
+    P2FenicsForm< p2_diffusion_cell_integral_0_otherwise, p2_tet_diffusion_cell_integral_0_otherwise >,
+    P2ToP1FenicsForm< p2_to_p1_div_cell_integral_0_otherwise, p2_to_p1_tet_div_tet_cell_integral_0_otherwise >,
+    P2ToP1FenicsForm< p2_to_p1_div_cell_integral_1_otherwise, p2_to_p1_tet_div_tet_cell_integral_1_otherwise >,
+    P2ToP1FenicsForm< fenics::NoAssemble, p2_to_p1_tet_div_tet_cell_integral_2_otherwise >,
+    P1ToP2FenicsForm< p1_to_p2_divt_cell_integral_0_otherwise, p1_to_p2_tet_divt_tet_cell_integral_0_otherwise >,
+    P1ToP2FenicsForm< p1_to_p2_divt_cell_integral_1_otherwise, p1_to_p2_tet_divt_tet_cell_integral_1_otherwise >,
+    P1ToP2FenicsForm< fenics::NoAssemble, p1_to_p2_tet_divt_tet_cell_integral_2_otherwise > >;
+
+template class P2P1ElementwiseFusedStokesOperator< P2Form_laplace,
+                                                   P2ToP1Form_div< 0 >,
+                                                   P2ToP1Form_div< 1 >,
+                                                   P2ToP1Form_div< 2 >,
+                                                   P1ToP2Form_divt< 0 >,
+                                                   P1ToP2Form_divt< 1 >,
+                                                   P1ToP2Form_divt< 2 > >;
+
+} // namespace hyteg
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <map>
+
+#include "hyteg/celldofspace/CellDoFIndexing.hpp"
+#include "hyteg/communication/Syncing.hpp"
+#include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
+#include "hyteg/elementwiseoperators/BlendedElementMatrixCache.hpp"
+#include "hyteg/elementwiseoperators/P1ToP2ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P2ToP1ElementwiseOperator.hpp"
+#include "hyteg/p2functionspace/P2Elements.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+
+/// \brief Monolithic apply of the P2-P1 Taylor-Hood Stokes operator.
+///
+/// Computes
+///
+///   dst.uvw = A src.uvw + divT src.p
+///   dst.p   = div src.uvw
+///
+/// in a single sweep over the micro-elements of the macro-cells (macro-faces in 2D). The velocity
+/// and pressure DoFs of each micro-element are gathered once, multiplied with the local element
+/// matrices of all blocks and scattered once. The halos of all components are updated in a single
+/// combined exchange before the sweep, and the results are pushed to the lower-dimensional primitives
+/// afterwards, again for all components at once.
+///
+/// The local element matrices are integrated on-the-fly, or taken from a cache on affinely mapped
+/// macro-primitives after computeAndStoreLocalElementMatrices() has been called. On blended macro-primitives,
+/// the matrices of all micro-elements can be stored via computeAndStoreBlendedLocalElementMatrices().
+///
+/// \tparam ViscousForm      P2 form of the velocity block (applied to each component)
+/// \tparam DivxForm, ...    P2 to P1 forms of the divergence block (per velocity component)
+/// \tparam DivTxForm, ...   P1 to P2 forms of the gradient block (per velocity component)
+template < class ViscousForm, class DivxForm, class DivyForm, class DivzForm, class DivTxForm, class DivTyForm, class DivTzForm >
+class P2P1ElementwiseFusedStokesOperator
+: public Operator< P2P1TaylorHoodFunction< real_t >, P2P1TaylorHoodFunction< real_t > >
+{
+ public:
+   P2P1ElementwiseFusedStokesOperator( const std::shared_ptr< PrimitiveStorage >& storage, size_t minLevel, size_t maxLevel );
+
+   void apply( const P2P1TaylorHoodFunction< real_t >& src,
+               const P2P1TaylorHoodFunction< real_t >& dst,
+               const uint_t                            level,
+               const DoFType                           flag ) const;
+
+   /// Precomputes and stores the local element matrices of all blocks on all macro-primitives with an affine
+   /// geometry map (six (two) distinct sets of matrices per macro-cell (macro-face) and level).
+   void computeAndStoreLocalElementMatrices();
+
+   /// Returns true if local element matrices have been precomputed via computeAndStoreLocalElementMatrices().
+   bool localElementMatricesPrecomputed() const { return localElementMatricesPrecomputed_; }
+
+   /// Precomputes and stores the local element matrices of all blocks and all micro-elements on macro-primitives
+   /// with a non-affine (blending) geometry map. Starting from the coarsest level, levels are cached as long as the
+   /// accumulated memory per process stays below the passed budget. See P2ElementwiseOperator for details.
+   void computeAndStoreBlendedLocalElementMatrices( uint_t memoryBudgetInBytes );
+
+   /// Returns the levels on which the local element matrices of blended macro-primitives are stored.
+   std::set< uint_t > getBlendedLocalElementMatrixLevels() const
+   {
+      return storage_->hasGlobalCells() ? blendedElementMatrices3D_.getCachedLevels() :
+                                          blendedElementMatrices2D_.getCachedLevels();
+   }
+
+ private:
+   /// Selects the cached levels and integrates the local element matrices of all blended macro-primitives.
+   void integrateBlendedLocalElementMatrices() const;
+
+   /// local element matrices of all blocks of a single micro-face
+   struct LocalElementMatrices2D
+   {
+      Matrix6r                         A;
+      std::array< Matrixr< 3, 6 >, 2 > div;
+      std::array< Matrixr< 6, 3 >, 2 > divT;
+   };
+
+   /// local element matrices of all blocks of a single micro-cell
+   struct LocalElementMatrices3D
+   {
+      Matrix10r                         A;
+      std::array< Matrixr< 4, 10 >, 3 > div;
+      std::array< Matrixr< 10, 4 >, 3 > divT;
+   };
+
+   /// pointers to the data of all components on a single macro-primitive
+   struct MacroPrimitiveData
+   {
+      std::array< real_t*, 3 > srcVertexData;
+      std::array< real_t*, 3 > srcEdgeData;
+      real_t*                  srcPressureData;
+      std::array< real_t*, 3 > dstVertexData;
+      std::array< real_t*, 3 > dstEdgeData;
+      real_t*                  dstPressureData;
+   };
+
+   /// copies of the forms with the geometry map of the current macro-primitive
+   struct Forms
+   {
+      ViscousForm A;
+      DivxForm    div_x;
+      DivyForm    div_y;
+      DivzForm    div_z;
+      DivTxForm   divT_x;
+      DivTyForm   divT_y;
+      DivTzForm   divT_z;
+
+      void setGeometryMap( const std::shared_ptr< GeometryMap >& map );
+   };
+
+   void integrateLocalElementMatrices2D( Forms& forms, const std::array< Point3D, 3 >& coords, LocalElementMatrices2D& elMats ) const;
+   void integrateLocalElementMatrices3D( Forms& forms, const std::array< Point3D, 4 >& coords, LocalElementMatrices3D& elMats ) const;
+
+   static std::array< Point3D, 3 >
+       microFaceCoordinates( const Face& face, const uint_t& level, const uint_t& xIdx, const uint_t& yIdx, const P2Elements::P2Element& element );
+
+   static std::array< Point3D, 4 >
+       microCellCoordinates( const Cell& cell, const uint_t& level, const indexing::Index& microCell, const celldof::CellType& cType );
+
+   /// gathers the DoFs of all components of a micro-face, applies the local element matrices and scatters the result
+   static void localMatrixVectorMultiply2D( const uint_t&                 level,
+                                            const uint_t&                 xIdx,
+                                            const uint_t&                 yIdx,
+                                            const P2Elements::P2Element&  element,
+                                            const LocalElementMatrices2D& elMats,
+                                            const MacroPrimitiveData&     data );
+
+   /// gathers the DoFs of all components of a micro-cell, applies the local element matrices and scatters the result
+   static void localMatrixVectorMultiply3D( const uint_t&                 level,
+                                            const indexing::Index&        microCell,
+                                            const celldof::CellType&      cType,
+                                            const LocalElementMatrices3D& elMats,
+                                            const MacroPrimitiveData&     data );
+
+   void apply2D( const P2P1TaylorHoodFunction< real_t >& src, const P2P1TaylorHoodFunction< real_t >& dst, const uint_t& level ) const;
+   void apply3D( const P2P1TaylorHoodFunction< real_t >& src, const P2P1TaylorHoodFunction< real_t >& dst, const uint_t& level ) const;
+
+   Forms forms_;
+
+   bool localElementMatricesPrecomputed_;
+
+   /// local element matrices of affinely mapped macro-primitives, indexed by macro-primitive, level and micro-element type
+   /// (2D: elementN, elementNW; 3D: ordering of celldof::allCellTypes)
+   std::map< PrimitiveID, std::map< uint_t, std::array< LocalElementMatrices2D, 2 > > > localElementMatrices2D_;
+   std::map< PrimitiveID, std::map< uint_t, std::array< LocalElementMatrices3D, 6 > > > localElementMatrices3D_;
+
+   /// local element matrices of all micro-elements of non-affinely mapped macro-primitives on the cached levels
+   mutable BlendedElementMatrixCache< LocalElementMatrices2D, Face > blendedElementMatrices2D_;
+   mutable BlendedElementMatrixCache< LocalElementMatrices3D, Cell > blendedElementMatrices3D_;
+
+   /// memory budget of the blended element matrices, kept to recompute them after the storage has been modified
+   uint_t blendedLocalElementMatricesMemoryBudget_;
+};
+
+typedef P2P1ElementwiseFusedStokesOperator<
+    P2FenicsForm< p2_diffusion_cell_integral_0_otherwise, p2_tet_diffusion_cell_integral_0_otherwise >,
+    P2ToP1FenicsForm< p2_to_p1_div_cell_integral_0_otherwise, p2_to_p1_tet_div_tet_cell_integral_0_otherwise >,
+    P2ToP1FenicsForm< p2_to_p1_div_cell_integral_1_otherwise, p2_to_p1_tet_div_tet_cell_integral_1_otherwise >,
+    P2ToP1FenicsForm< fenics::NoAssemble, p2_to_p1_tet_div_tet_cell_integral_2_otherwise >,
+    P1ToP2FenicsForm< p1_to_p2_divt_cell_integral_0_otherwise, p1_to_p2_tet_divt_tet_cell_integral_0_otherwise >,
+    P1ToP2FenicsForm< p1_to_p2_divt_cell_integral_1_otherwise, p1_to_p2_tet_divt_tet_cell_integral_1_otherwise >,
+    P1ToP2FenicsForm< fenics::NoAssemble, p1_to_p2_tet_divt_tet_cell_integral_2_otherwise > >
+    P2P1ElementwiseFusedConstantStokesOperator;
+
+typedef P2P1ElementwiseFusedStokesOperator< P2Form_laplace,
+                                            P2ToP1Form_div< 0 >,
+                                            P2ToP1Form_div< 1 >,
+                                            P2ToP1Form_div< 2 >,
+                                            P1ToP2Form_divt< 0 >,
+                                            P1ToP2Form_divt< 1 >,
+                                            P1ToP2Form_divt< 2 > >
+    P2P1ElementwiseFusedBlendingStokesOperator;
+
+} // namespace hyteg
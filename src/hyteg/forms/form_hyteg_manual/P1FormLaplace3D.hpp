@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "hyteg/forms/form_hyteg_base/P1FormHyTeG.hpp"
+#include "hyteg/forms/form_hyteg_manual/QuadratureRules.hpp"
+#include "hyteg/geometry/GeometryMap.hpp"
+
+namespace hyteg {
+
+/// Laplace form for linear elements on tetrahedra with support for non-affine blending maps.
+///
+/// The element matrix is computed by quadrature. At each cubature point the Jacobian of the
+/// composition of the affine map of the micro-element and the blending map is inverted explicitly.
+class P1Form_laplace3D : public P1FormHyTeG
+{
+ public:
+   void integrateAll( const std::array< Point3D, 3 >& coords, Matrix3r& elMat ) const final
+   {
+      WALBERLA_UNUSED( coords );
+      WALBERLA_UNUSED( elMat );
+      WALBERLA_ABORT( "Not implemented." );
+   }
+
+   void integrateAll( const std::array< Point3D, 4 >& coords, Matrix4r& elMat ) const final
+   {
+// Select quadrature rule
+#define CUBAPOINTS cubature::T4_points
+#define CUBAWEIGHTS cubature::T4_weights
+
+      // gradients of the shape functions on the reference tetrahedron
+      static const std::array< std::array< real_t, 3 >, 4 > refGrad = {
+          { { -1.0, -1.0, -1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } } };
+
+      // Jacobian of the affine map from the reference tetrahedron to the computational element
+      Matrix3r DPhi;
+      for ( uint_t i = 0; i < 3; i++ )
+      {
+         for ( uint_t j = 0; j < 3; j++ )
+         {
+            DPhi( i, j ) = coords[j + 1][i] - coords[0][i];
+         }
+      }
+
+      elMat.setAll( real_c( 0 ) );
+
+      Matrix3r DPsi;
+      for ( uint_t k = 0; k < CUBAWEIGHTS.size(); k++ )
+      {
+         const real_t L2 = CUBAPOINTS[k][0];
+         const real_t L3 = CUBAPOINTS[k][1];
+         const real_t L4 = CUBAPOINTS[k][2];
+
+         // map point to computational element
+         Point3D mappedPt = coords[0];
+         for ( uint_t i = 0; i < 3; i++ )
+         {
+            mappedPt[i] += DPhi( i, 0 ) * L2 + DPhi( i, 1 ) * L3 + DPhi( i, 2 ) * L4;
+         }
+
+         // derivative of the complete map from the reference to the physical element
+         geometryMap_->evalDF( mappedPt, DPsi );
+         const Matrix3r J = DPsi.mul( DPhi );
+
+         // adjugate of J, J^{-1} = adj / det
+         Matrix3r adj;
+         adj( 0, 0 ) = J( 1, 1 ) * J( 2, 2 ) - J( 1, 2 ) * J( 2, 1 );
+         adj( 0, 1 ) = J( 0, 2 ) * J( 2, 1 ) - J( 0, 1 ) * J( 2, 2 );
+         adj( 0, 2 ) = J( 0, 1 ) * J( 1, 2 ) - J( 0, 2 ) * J( 1, 1 );
+         adj( 1, 0 ) = J( 1, 2 ) * J( 2, 0 ) - J( 1, 0 ) * J( 2, 2 );
+         adj( 1, 1 ) = J( 0, 0 ) * J( 2, 2 ) - J( 0, 2 ) * J( 2, 0 );
+         adj( 1, 2 ) = J( 0, 2 ) * J( 1, 0 ) - J( 0, 0 ) * J( 1, 2 );
+         adj( 2, 0 ) = J( 1, 0 ) * J( 2, 1 ) - J( 1, 1 ) * J( 2, 0 );
+         adj( 2, 1 ) = J( 0, 1 ) * J( 2, 0 ) - J( 0, 0 ) * J( 2, 1 );
+         adj( 2, 2 ) = J( 0, 0 ) * J( 1, 1 ) - J( 0, 1 ) * J( 1, 0 );
+
+         const real_t detJ = J( 0, 0 ) * adj( 0, 0 ) + J( 0, 1 ) * adj( 1, 0 ) + J( 0, 2 ) * adj( 2, 0 );
+
+         // physical gradients scaled by det( J ): grad_i = J^{-T} refGrad_i = adj^T refGrad_i / det( J )
+         std::array< std::array< real_t, 3 >, 4 > grad;
+         for ( uint_t s = 0; s < 4; s++ )
+         {
+            for ( uint_t i = 0; i < 3; i++ )
+            {
+               grad[s][i] = adj( 0, i ) * refGrad[s][0] + adj( 1, i ) * refGrad[s][1] + adj( 2, i ) * refGrad[s][2];
+            }
+         }
+
+         const real_t factor = CUBAWEIGHTS[k] * std::abs( detJ ) / ( detJ * detJ );
+
+         for ( uint_t i = 0; i < 4; i++ )
+         {
+            for ( uint_t j = i; j < 4; j++ )
+            {
+               elMat( i, j ) += factor * ( grad[i][0] * grad[j][0] + grad[i][1] * grad[j][1] + grad[i][2] * grad[j][2] );
+            }
+         }
+      }
+
+      for ( uint_t i = 0; i < 4; i++ )
+      {
+         for ( uint_t j = 0; j < i; j++ )
+         {
+            elMat( i, j ) = elMat( j, i );
+         }
+      }
+
+#undef CUBAPOINTS
+#undef CUBAWEIGHTS
+   }
+};
+
+} // namespace hyteg
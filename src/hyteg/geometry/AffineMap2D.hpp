@@ -68,6 +68,31 @@ class AffineMap2D : public GeometryMap
       xnew[2] = real_c( 0 );
    }
 
+   void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+   {
+      const real_t m00 = mat_( 0, 0 );
+      const real_t m01 = mat_( 0, 1 );
+      const real_t m10 = mat_( 1, 0 );
+      const real_t m11 = mat_( 1, 1 );
+      const real_t v0  = vec_[0];
+      const real_t v1  = vec_[1];
+
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         Fx[i][0] = m00 * x[i][0] + m01 * x[i][1] + v0;
+         Fx[i][1] = m10 * x[i][0] + m11 * x[i][1] + v1;
+         Fx[i][2] = real_c( 0 );
+      }
+   }
+
+   void evalFAndDF( const Point3D& x, Point3D& Fx, Matrix2r& DFx ) const final
+   {
+      AffineMap2D::evalF( x, Fx );
+      AffineMap2D::evalDF( x, DFx );
+   }
+
+   bool isAffine() const final { return true; }
+
    void serializeSubClass( walberla::mpi::SendBuffer& sendBuffer ) const
    {
       sendBuffer << Type::AFFINE_2D;
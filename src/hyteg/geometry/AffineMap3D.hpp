@@ -71,6 +71,26 @@ class AffineMap3D : public GeometryMap
       xnew[2] = mat_( 2, 0 ) * xold[0] + mat_( 2, 1 ) * xold[1] + mat_( 2, 2 ) * xold[2] + vec_[2];
    }
 
+   void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+   {
+      const Matrix3r mat = mat_;
+      const Point3D  vec = vec_;
+
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         Fx[i][0] = mat( 0, 0 ) * x[i][0] + mat( 0, 1 ) * x[i][1] + mat( 0, 2 ) * x[i][2] + vec[0];
+         Fx[i][1] = mat( 1, 0 ) * x[i][0] + mat( 1, 1 ) * x[i][1] + mat( 1, 2 ) * x[i][2] + vec[1];
+         Fx[i][2] = mat( 2, 0 ) * x[i][0] + mat( 2, 1 ) * x[i][1] + mat( 2, 2 ) * x[i][2] + vec[2];
+      }
+   }
+
+   real_t evalFAndDF( const Point3D& x, Point3D& Fx, Matrix3r& DFx ) const final
+   {
+      AffineMap3D::evalF( x, Fx );
+      DFx = mat_;
+      return jacDet_;
+   }
+
    real_t evalDF( const Point3D& x, Matrix3r& DFx ) const final
    {
       WALBERLA_UNUSED( x );
@@ -78,6 +98,8 @@ class AffineMap3D : public GeometryMap
       return jacDet_;
    }
 
+   bool isAffine() const final { return true; }
+
    void serializeSubClass( walberla::mpi::SendBuffer& sendBuffer ) const
    {
       sendBuffer << Type::AFFINE_3D;
@@ -99,6 +99,30 @@ class AnnulusMap : public GeometryMap
       ANNULUS_MAP_LOG( "Mapped: " << xold << " --> " << xnew );
    }
 
+   void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+   {
+      // all quantities that only depend on the macro triangle are computed once for the whole batch
+      const real_t areaT = ( refVertex_[0] - rayVertex_[0] ) * ( thrVertex_[1] - rayVertex_[1] ) -
+                           ( refVertex_[1] - rayVertex_[1] ) * ( thrVertex_[0] - rayVertex_[0] );
+      const real_t invAreaT = real_c( 1 ) / areaT;
+      const real_t rayX     = rayVertex_[0];
+      const real_t rayY     = rayVertex_[1];
+      const real_t thrRayX  = thrVertex_[0] - rayVertex_[0];
+      const real_t thrRayY  = thrVertex_[1] - rayVertex_[1];
+      const real_t radRay   = radRayVertex_;
+      const real_t dist     = radRefVertex_ - radRayVertex_;
+
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         const real_t factor = ( ( x[i][0] - rayX ) * thrRayY - ( x[i][1] - rayY ) * thrRayX ) * invAreaT;
+         const real_t oldRad = std::sqrt( x[i][0] * x[i][0] + x[i][1] * x[i][1] );
+         const real_t scale  = ( radRay + factor * dist ) / oldRad;
+         Fx[i][0]            = x[i][0] * scale;
+         Fx[i][1]            = x[i][1] * scale;
+         Fx[i][2]            = real_c( 0 );
+      }
+   }
+
    void evalFinv( const Point3D& xPhys, Point3D& xComp ) const
    {
       real_t tmp0 = radRayVertex_ - radRefVertex_;
@@ -114,7 +138,6 @@ class AnnulusMap : public GeometryMap
       xComp[1] = tmp4 * xPhys[1];
    }
 
-   // note: we could save computations by fusing evalF with evalDF!
    void evalDF( const Point3D& x, Matrix2r& DFx ) const
    {
       real_t dist  = radRefVertex_ - radRayVertex_;
@@ -142,6 +165,36 @@ class AnnulusMap : public GeometryMap
       DFx( 1, 1 ) = x[0] * tmp5 - tmp2 * tmp4;
    }
 
+   void evalFAndDF( const Point3D& x, Point3D& Fx, Matrix2r& DFx ) const final
+   {
+      real_t dist  = radRefVertex_ - radRayVertex_;
+      real_t areaT = ( refVertex_[0] - rayVertex_[0] ) * ( thrVertex_[1] - rayVertex_[1] ) -
+                     ( refVertex_[1] - rayVertex_[1] ) * ( thrVertex_[0] - rayVertex_[0] );
+      real_t areaX = ( x[0] - rayVertex_[0] ) * ( thrVertex_[1] - rayVertex_[1] ) -
+                     ( x[1] - rayVertex_[1] ) * ( thrVertex_[0] - rayVertex_[0] );
+      real_t bary   = areaX / areaT;
+      real_t oldRad = std::sqrt( x[0] * x[0] + x[1] * x[1] );
+      real_t newRad = radRayVertex_ + bary * dist;
+
+      real_t invNorm  = 1.0 / oldRad;
+      real_t invNorm3 = invNorm * invNorm * invNorm;
+      real_t tmp0     = invNorm * dist / areaT;
+      real_t tmp1     = x[0] * tmp0;
+      real_t tmp2     = x[1] * tmp0;
+      real_t tmp3     = thrVertex_[1] - rayVertex_[1];
+      real_t tmp4     = thrVertex_[0] - rayVertex_[0];
+      real_t tmp5     = x[0] * invNorm3 * newRad;
+      real_t tmp6     = x[1] * invNorm3 * newRad;
+
+      DFx( 0, 0 ) = x[1] * tmp6 + tmp1 * tmp3;
+      DFx( 0, 1 ) = -x[0] * tmp6 - tmp1 * tmp4;
+      DFx( 1, 0 ) = -x[1] * tmp5 + tmp2 * tmp3;
+      DFx( 1, 1 ) = x[0] * tmp5 - tmp2 * tmp4;
+
+      Fx[0] = x[0] * newRad * invNorm;
+      Fx[1] = x[1] * newRad * invNorm;
+   }
+
    void evalDFinv( const Point3D& x, Matrix2r& DFinvx ) const
    {
       Matrix2r tmp;
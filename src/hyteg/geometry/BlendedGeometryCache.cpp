@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/geometry/BlendedGeometryCache.hpp"
+
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
+
+namespace hyteg {
+
+using walberla::int_c;
+using walberla::uint_c;
+
+BlendedGeometryCache::BlendedGeometryCache( const std::shared_ptr< PrimitiveStorage >& storage,
+                                            const uint_t&                              minLevel,
+                                            const uint_t&                              maxLevel,
+                                            const uint_t&                              memoryBudgetInBytes )
+: storage_( storage )
+, minLevel_( minLevel )
+, maxLevel_( maxLevel )
+, memoryBudgetInBytes_( memoryBudgetInBytes )
+{
+   build();
+}
+
+void BlendedGeometryCache::update()
+{
+   if ( isOutdated() )
+   {
+      build();
+   }
+}
+
+const real_t* BlendedGeometryCache::getJacobians( const Face& face, const uint_t& level ) const
+{
+   const real_t* data = faceMemory_.get( face, level );
+   return data == nullptr ? nullptr : data + 3 * levelinfo::num_microvertices_per_face( level );
+}
+
+const real_t* BlendedGeometryCache::getJacobians( const Cell& cell, const uint_t& level ) const
+{
+   const real_t* data = cellMemory_.get( cell, level );
+   return data == nullptr ? nullptr : data + 3 * levelinfo::num_microvertices_per_cell( level );
+}
+
+void BlendedGeometryCache::build()
+{
+   if ( storage_->hasGlobalCells() )
+   {
+      cellMemory_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return ( 3 + 9 ) * levelinfo::num_microvertices_per_cell( level ); },
+          memoryBudgetInBytes_ );
+
+      const std::vector< Cell* > cells = cellMemory_.getBlendedPrimitives();
+      for ( const auto& level : cellMemory_.getCachedLevels() )
+      {
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+         for ( int i = 0; i < int_c( cells.size() ); i++ )
+         {
+            const Cell& cell        = *cells[uint_c( i )];
+            real_t*     coordinates = cellMemory_.get( cell, level );
+            real_t*     jacobians   = coordinates + 3 * levelinfo::num_microvertices_per_cell( level );
+            for ( const auto& it : vertexdof::macrocell::Iterator( level ) )
+            {
+               const uint_t idx = vertexdof::macrocell::index( level, it.x(), it.y(), it.z() );
+               Point3D      x;
+               Matrix3r     DF;
+               cell.getGeometryMap()->evalFAndDF( vertexdof::macrocell::coordinateFromIndex( level, cell, it ), x, DF );
+               for ( uint_t k = 0; k < 3; k++ )
+               {
+                  coordinates[3 * idx + k] = x[k];
+               }
+               for ( uint_t k = 0; k < 9; k++ )
+               {
+                  jacobians[9 * idx + k] = DF( k / 3, k % 3 );
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      faceMemory_.allocate(
+          storage_,
+          minLevel_,
+          maxLevel_,
+          []( uint_t level ) { return ( 3 + 4 ) * levelinfo::num_microvertices_per_face( level ); },
+          memoryBudgetInBytes_ );
+
+      const std::vector< Face* > faces = faceMemory_.getBlendedPrimitives();
+      for ( const auto& level : faceMemory_.getCachedLevels() )
+      {
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+         for ( int i = 0; i < int_c( faces.size() ); i++ )
+         {
+            const Face& face        = *faces[uint_c( i )];
+            real_t*     coordinates = faceMemory_.get( face, level );
+            real_t*     jacobians   = coordinates + 3 * levelinfo::num_microvertices_per_face( level );
+            for ( const auto& it : vertexdof::macroface::Iterator( level ) )
+            {
+               const uint_t idx = vertexdof::macroface::index( level, it.x(), it.y() );
+               Point3D      x;
+               Matrix2r     DF;
+               face.getGeometryMap()->evalFAndDF( vertexdof::macroface::coordinateFromIndex( level, face, it ), x, DF );
+               for ( uint_t k = 0; k < 3; k++ )
+               {
+                  coordinates[3 * idx + k] = x[k];
+               }
+               for ( uint_t k = 0; k < 4; k++ )
+               {
+                  jacobians[4 * idx + k] = DF( k / 2, k % 2 );
+               }
+            }
+         }
+      }
+   }
+}
+
+} // namespace hyteg
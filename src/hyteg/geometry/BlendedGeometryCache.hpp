@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <memory>
+#include <set>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/geometry/BlendedPrimitiveMemory.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Stores the mapped coordinates and the Jacobians of the geometry map at all micro-vertices of
+///        non-affinely mapped macro-primitives.
+///
+/// Evaluating a blending map (and its Jacobian) involves trigonometric functions or projections and is repeated for
+/// every interpolation on the same level. This cache evaluates the map once per micro-vertex. In 2D the macro-faces
+/// are cached, in 3D the macro-cells. The memory is attached to the macro-primitives and migrated with them. Since
+/// the mapped coordinates only depend on the macro-primitive, the data stays valid after a migration. update()
+/// re-selects the levels for the new distribution.
+///
+/// Layout per macro-primitive and level, indexed by the micro-vertex index (vertexdof::macroface::index() and
+/// vertexdof::macrocell::index()):
+///   - mapped coordinates: 3 entries per micro-vertex, starting at getMappedCoordinates()
+///   - Jacobians:          2x2 (3x3 in 3D) row-major entries per micro-vertex, starting at getJacobians()
+///
+/// Only the coarsest levels whose accumulated memory fits into the passed budget are cached. On the remaining levels
+/// and on affinely mapped macro-primitives, the getters return nullptr and the map must be evaluated on-the-fly.
+class BlendedGeometryCache
+{
+ public:
+   /// Evaluates the geometry map on all cached levels. Must be called collectively.
+   BlendedGeometryCache( const std::shared_ptr< PrimitiveStorage >& storage,
+                         const uint_t&                              minLevel,
+                         const uint_t&                              maxLevel,
+                         const uint_t&                              memoryBudgetInBytes );
+
+   /// Re-selects the cached levels and evaluates the map again if the storage has been modified.
+   /// Must be called collectively.
+   void update();
+
+   /// Returns true if the storage has been modified since the cache was built.
+   bool isOutdated() const { return faceMemory_.isOutdated() || cellMemory_.isOutdated(); }
+
+   const std::set< uint_t >& getCachedLevels() const
+   {
+      return storage_->hasGlobalCells() ? cellMemory_.getCachedLevels() : faceMemory_.getCachedLevels();
+   }
+
+   /// Returns the mapped coordinates of all micro-vertices of the macro-face, or nullptr if they are not cached.
+   const real_t* getMappedCoordinates( const Face& face, const uint_t& level ) const { return faceMemory_.get( face, level ); }
+
+   /// Returns the mapped coordinates of all micro-vertices of the macro-cell, or nullptr if they are not cached.
+   const real_t* getMappedCoordinates( const Cell& cell, const uint_t& level ) const { return cellMemory_.get( cell, level ); }
+
+   /// Returns the Jacobians of the map at all micro-vertices of the macro-face, or nullptr if they are not cached.
+   const real_t* getJacobians( const Face& face, const uint_t& level ) const;
+
+   /// Returns the Jacobians of the map at all micro-vertices of the macro-cell, or nullptr if they are not cached.
+   const real_t* getJacobians( const Cell& cell, const uint_t& level ) const;
+
+   /// Returns the memory that is allocated on this process.
+   uint_t memoryInBytes() const { return faceMemory_.memoryInBytes() + cellMemory_.memoryInBytes(); }
+
+ private:
+   void build();
+
+   std::shared_ptr< PrimitiveStorage > storage_;
+   uint_t                              minLevel_;
+   uint_t                              maxLevel_;
+   uint_t                              memoryBudgetInBytes_;
+
+   BlendedPrimitiveMemory< Face > faceMemory_;
+   BlendedPrimitiveMemory< Cell > cellMemory_;
+};
+
+} // namespace hyteg
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "core/DataTypes.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/mpi/Reduce.h"
+
+#include "hyteg/FunctionMemory.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+namespace blendedprimitivememory {
+
+inline void addData( PrimitiveStorage&                                   storage,
+                     PrimitiveDataID< FunctionMemory< real_t >, Face >& dataID,
+                     const std::string&                                  identifier )
+{
+   storage.addFaceData( dataID, std::make_shared< MemoryDataHandling< FunctionMemory< real_t >, Face > >(), identifier );
+}
+
+inline void addData( PrimitiveStorage&                                   storage,
+                     PrimitiveDataID< FunctionMemory< real_t >, Cell >& dataID,
+                     const std::string&                                  identifier )
+{
+   storage.addCellData( dataID, std::make_shared< MemoryDataHandling< FunctionMemory< real_t >, Cell > >(), identifier );
+}
+
+} // namespace blendedprimitivememory
+
+/// \brief Level-wise memory on all local macro-primitives of one type that have a non-affine (blending) geometry map.
+///
+/// The memory is attached to the macro-primitives as FunctionMemory and is therefore migrated together with them.
+/// Since the memory grows by a factor of 8 (4 in 2D) per refinement level, only the coarsest levels whose accumulated
+/// memory fits into a given budget are allocated.
+///
+/// The selected levels only hold for the distribution of the primitives at the time of the allocation. As soon as the
+/// storage is modified, isOutdated() returns true and the owner has to allocate and fill the memory again.
+template < typename PrimitiveType >
+class BlendedPrimitiveMemory
+{
+ public:
+   BlendedPrimitiveMemory()
+   : minLevel_( 0 )
+   , maxLevel_( 0 )
+   , modificationStamp_( 0 )
+   {}
+
+   /// Selects the levels and allocates the memory on all local non-affinely mapped macro-primitives.
+   ///
+   /// Starting from minLevel, levels are added as long as the accumulated memory stays below the budget.
+   /// The memory is reduced (maximum) over all processes, so that all processes select the same levels.
+   /// Must be called collectively.
+   ///
+   /// \param storage              the storage, the same storage must be passed to all calls
+   /// \param minLevel             coarsest level that may be allocated
+   /// \param maxLevel             finest level that may be allocated
+   /// \param numEntries           number of entries per macro-primitive on the passed level
+   /// \param memoryBudgetInBytes  maximum memory per process
+   void allocate( const std::shared_ptr< PrimitiveStorage >& storage,
+                  const uint_t&                              minLevel,
+                  const uint_t&                              maxLevel,
+                  const std::function< uint_t( uint_t ) >&   numEntries,
+                  const uint_t&                              memoryBudgetInBytes )
+   {
+      if ( storage_ == nullptr )
+      {
+         storage_ = storage;
+         blendedprimitivememory::addData( *storage_, dataID_, "blended primitive memory" );
+      }
+      WALBERLA_CHECK_EQUAL( storage_, storage, "The memory cannot be moved to a different storage." );
+
+      clear();
+      minLevel_ = minLevel;
+      maxLevel_ = maxLevel;
+
+      const std::vector< PrimitiveType* > primitives = getBlendedPrimitives();
+
+      uint_t accumulatedBytes = 0;
+      for ( uint_t level = minLevel; level <= maxLevel; level++ )
+      {
+         const uint_t localBytes  = primitives.size() * numEntries( level ) * sizeof( real_t );
+         const uint_t globalBytes = walberla::mpi::allReduce( localBytes, walberla::mpi::MAX );
+         if ( accumulatedBytes + globalBytes > memoryBudgetInBytes )
+         {
+            break;
+         }
+         accumulatedBytes += globalBytes;
+         levels_.insert( level );
+      }
+
+      if ( !levels_.empty() )
+      {
+         for ( const auto& primitive : primitives )
+         {
+            primitive->getData( dataID_ )->addData( *levels_.begin(), *levels_.rbegin(), numEntries, real_t( 0 ) );
+         }
+      }
+
+      modificationStamp_ = storage_->getModificationStamp();
+   }
+
+   /// Returns true if the storage has been modified since the last allocation.
+   bool isOutdated() const { return storage_ != nullptr && storage_->getModificationStamp() != modificationStamp_; }
+
+   /// Returns true if the memory on the passed level is allocated.
+   bool isCached( const uint_t& level ) const { return levels_.count( level ) > 0; }
+
+   const std::set< uint_t >& getCachedLevels() const { return levels_; }
+
+   /// Returns a pointer to the memory of the passed macro-primitive and level, or nullptr if it is not allocated.
+   real_t* get( const PrimitiveType& primitive, const uint_t& level ) const
+   {
+      if ( !isCached( level ) )
+      {
+         return nullptr;
+      }
+      const FunctionMemory< real_t >* memory = primitive.getData( dataID_ );
+      return memory->hasLevel( level ) ? memory->getPointer( level ) : nullptr;
+   }
+
+   /// Returns all local macro-primitives with a non-affine geometry map.
+   std::vector< PrimitiveType* > getBlendedPrimitives() const
+   {
+      std::vector< PrimitiveID > primitiveIDs;
+      storage_->template getPrimitiveIDsGenerically< PrimitiveType >( primitiveIDs );
+
+      std::vector< PrimitiveType* > primitives;
+      for ( const auto& id : primitiveIDs )
+      {
+         PrimitiveType* primitive = storage_->template getPrimitiveGenerically< PrimitiveType >( id );
+         if ( !primitive->getGeometryMap()->isAffine() )
+         {
+            primitives.push_back( primitive );
+         }
+      }
+      return primitives;
+   }
+
+   /// Returns the memory that is allocated on this process.
+   uint_t memoryInBytes() const
+   {
+      uint_t bytes = 0;
+      if ( storage_ != nullptr )
+      {
+         for ( const auto& primitive : getBlendedPrimitives() )
+         {
+            for ( const auto& level : levels_ )
+            {
+               if ( primitive->getData( dataID_ )->hasLevel( level ) )
+               {
+                  bytes += primitive->getData( dataID_ )->getSize( level ) * sizeof( real_t );
+               }
+            }
+         }
+      }
+      return bytes;
+   }
+
+   /// Releases the memory on all local macro-primitives.
+   void clear()
+   {
+      if ( storage_ != nullptr )
+      {
+         std::vector< PrimitiveID > primitiveIDs;
+         storage_->template getPrimitiveIDsGenerically< PrimitiveType >( primitiveIDs );
+         for ( const auto& id : primitiveIDs )
+         {
+            // primitives that were migrated to this process may carry memory of the previous allocation
+            FunctionMemory< real_t >* memory = storage_->template getPrimitiveGenerically< PrimitiveType >( id )->getData( dataID_ );
+            for ( uint_t level = minLevel_; level <= maxLevel_; level++ )
+            {
+               memory->deleteData( level );
+            }
+         }
+      }
+      levels_.clear();
+   }
+
+ private:
+   std::shared_ptr< PrimitiveStorage >                         storage_;
+   PrimitiveDataID< FunctionMemory< real_t >, PrimitiveType > dataID_;
+   std::set< uint_t >                                          levels_;
+   uint_t                                                      minLevel_;
+   uint_t                                                      maxLevel_;
+   uint_t                                                      modificationStamp_;
+};
+
+} // namespace hyteg
@@ -110,6 +110,37 @@ class CircularMap : public GeometryMap
       Fx[1]        = tmp14 * ( center_[1] + radius_ * sin( tmp12 ) - tmp15 + tmp4 ) + tmp15 + tmp7 * x2bar_[1] + x1_[1];
    }
 
+   void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+   {
+      // quantities that only depend on the macro triangle are computed once for the whole batch
+      const real_t tmp0 = -x1_[0];
+      const real_t tmp4 = -x1_[1];
+
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         const real_t tmp2  = invDet_ * ( tmp0 + x[i][0] );
+         const real_t tmp3  = tmp2 * x3bar_[1];
+         const real_t tmp5  = invDet_ * ( tmp4 + x[i][1] );
+         const real_t tmp6  = tmp5 * x3bar_[0];
+         const real_t tmp7  = tmp3 - tmp6;
+         const real_t tmp8  = tmp5 * x2bar_[0];
+         const real_t tmp9  = tmp2 * x2bar_[1];
+         const real_t tmp10 = tmp8 - tmp9;
+         const real_t tmp13 = -tmp8 + tmp9 + 1;
+         if ( std::fabs( tmp13 ) < 1e-14 )
+         {
+            Fx[i] = x[i];
+            continue;
+         }
+         const real_t tmp11 = tmp10 * x3bar_[0];
+         const real_t tmp12 = s1_ + s3bar_ * tmp10;
+         const real_t tmp14 = ( tmp13 - tmp3 + tmp6 ) / tmp13;
+         const real_t tmp15 = tmp10 * x3bar_[1];
+         Fx[i][0] = tmp11 + tmp14 * ( center_[0] + radius_ * cos( tmp12 ) + tmp0 - tmp11 ) + tmp7 * x2bar_[0] + x1_[0];
+         Fx[i][1] = tmp14 * ( center_[1] + radius_ * sin( tmp12 ) - tmp15 + tmp4 ) + tmp15 + tmp7 * x2bar_[1] + x1_[1];
+      }
+   }
+
    void evalDF( const Point3D& x, Matrix2r& DFx ) const
    {
       real_t tmp0  = x2bar_[0] * x3bar_[1];
@@ -157,6 +188,59 @@ class CircularMap : public GeometryMap
       DFx( 1, 1 )  = tmp25 * ( tmp19 * tmp29 - tmp3 ) + tmp28 * tmp31 + tmp30 * tmp31 + tmp4;
    }
 
+   void evalFAndDF( const Point3D& x, Point3D& Fx, Matrix2r& DFx ) const final
+   {
+      real_t tmp0  = x2bar_[0] * x3bar_[1];
+      real_t tmp1  = x3bar_[0] * x2bar_[1];
+      real_t tmp2  = 1.0 / ( tmp0 - tmp1 );
+      real_t tmp3  = tmp0 * tmp2;
+      real_t tmp4  = -tmp1 * tmp2 + tmp3;
+      real_t tmp5  = tmp2 * x2bar_[1];
+      real_t tmp6  = tmp2 * x3bar_[1];
+      real_t tmp7  = -x1_[0];
+      real_t tmp8  = tmp7 + x[0];
+      real_t tmp9  = tmp5 * tmp8;
+      real_t tmp10 = -x1_[1];
+      real_t tmp11 = tmp10 + x[1];
+      real_t tmp12 = tmp2 * x2bar_[0];
+      real_t tmp13 = tmp11 * tmp12;
+      real_t tmp14 = -tmp13 + tmp9 + 1;
+      if (std::fabs(tmp14) < 1e-14) {
+         Fx           = x;
+         DFx( 0, 0 )  = 1.0;
+         DFx( 0, 1 )  = 0.0;
+         DFx( 1, 0 )  = 0.0;
+         DFx( 1, 1 )  = 1.0;
+         return;
+      }
+      real_t tmp15 = 1.0 / tmp14;
+      real_t tmp16 = tmp15 * ( tmp5 - tmp6 );
+      real_t tmp17 = tmp13 - tmp9;
+      real_t tmp18 = s1_ + s3bar_ * tmp17;
+      real_t tmp19 = radius_ * cos( tmp18 );
+      real_t tmp20 = center_[0] - tmp17 * x3bar_[0] + tmp19 + tmp7;
+      real_t tmp21 = s3bar_ * tmp2 * x2bar_[1];
+      real_t tmp22 = radius_ * sin( tmp18 );
+      real_t tmp23 = tmp2 * x3bar_[0];
+      real_t tmp24 = tmp11 * tmp23 + tmp14 - tmp6 * tmp8;
+      real_t tmp25 = tmp15 * tmp24;
+      real_t tmp26 = pow( tmp14, -2 );
+      real_t tmp27 = tmp2 * tmp24 * tmp26 * x2bar_[1];
+      real_t tmp28 = tmp15 * ( -tmp12 + tmp23 );
+      real_t tmp29 = s3bar_ * tmp2 * x2bar_[0];
+      real_t tmp30 = tmp2 * tmp24 * tmp26 * x2bar_[0];
+      real_t tmp31 = center_[1] + tmp10 - tmp17 * x3bar_[1] + tmp22;
+      DFx( 0, 0 )  = tmp16 * tmp20 - tmp20 * tmp27 + tmp25 * ( tmp2 * x3bar_[0] * x2bar_[1] + tmp21 * tmp22 ) + tmp4;
+      DFx( 0, 1 )  = tmp20 * tmp28 + tmp20 * tmp30 + tmp25 * ( -tmp12 * x3bar_[0] - tmp22 * tmp29 );
+      DFx( 1, 0 )  = tmp16 * tmp31 + tmp25 * ( -tmp19 * tmp21 + tmp5 * x3bar_[1] ) - tmp27 * tmp31;
+      DFx( 1, 1 )  = tmp25 * ( tmp19 * tmp29 - tmp3 ) + tmp28 * tmp31 + tmp30 * tmp31 + tmp4;
+
+      // the mapping shares the angle (tmp17, tmp18) and the blending factor (tmp25) with the Jacobian
+      real_t tmp32 = tmp6 * tmp8 - tmp11 * tmp23;
+      Fx[0]        = tmp17 * x3bar_[0] + tmp25 * tmp20 + tmp32 * x2bar_[0] + x1_[0];
+      Fx[1]        = tmp17 * x3bar_[1] + tmp25 * tmp31 + tmp32 * x2bar_[1] + x1_[1];
+   }
+
    void evalDFinv( const Point3D& x, Matrix2r& DFxInv ) const
    {
       Matrix2r tmp;
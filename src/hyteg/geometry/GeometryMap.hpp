@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <vector>
+
 #include "hyteg/types/matrix.hpp"
 #include "hyteg/types/pointnd.hpp"
 
@@ -47,6 +49,29 @@ class GeometryMap
    /// \param Fx Physical output coordinates
    virtual void evalF( const Point3D& x, Point3D& Fx ) const = 0;
 
+   /// Mapping of a batch of reference coordinates to physical coordinates
+   ///
+   /// Evaluates the map for \p n points with a single virtual call. Child classes override this with a
+   /// plain loop over the points (constants hoisted, no branches), so that the compiler can inline the
+   /// evaluation and vectorise across points.
+   /// \param x Pointer to \p n reference input coordinates
+   /// \param Fx Pointer to \p n physical output coordinates (must not overlap with \p x)
+   /// \param n Number of points
+   virtual void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const
+   {
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         evalF( x[i], Fx[i] );
+      }
+   }
+
+   /// Convenience overload of the batched evalF(), resizes \p Fx to the size of \p x
+   void evalF( const std::vector< Point3D >& x, std::vector< Point3D >& Fx ) const
+   {
+      Fx.resize( x.size() );
+      evalF( x.data(), Fx.data(), x.size() );
+   }
+
    /// Maps point from physical back to computational domain (inverse blending)
    /// \param xPhys coordinates of point in physical domain
    /// \param xComp coordinates of point in computational domain
@@ -78,6 +103,33 @@ class GeometryMap
    /// \param DFinvx Inverse of the Jacobian matrix
    virtual void evalDFinv( const Point3D& x, Matrix2r& DFinvx ) const = 0;
 
+   /// Fused evaluation of the mapping and its Jacobian matrix at reference position \p x (2D)
+   ///
+   /// Child classes override this to share the intermediate results of both evaluations.
+   /// \param x Reference input coordinates
+   /// \param Fx Physical output coordinates
+   /// \param DFx Jacobian matrix
+   virtual void evalFAndDF( const Point3D& x, Point3D& Fx, Matrix2r& DFx ) const
+   {
+      evalF( x, Fx );
+      evalDF( x, DFx );
+   }
+
+   /// Fused evaluation of the mapping and its Jacobian matrix at reference position \p x (3D)
+   /// \param x Reference input coordinates
+   /// \param Fx Physical output coordinates
+   /// \param DFx Jacobian matrix
+   /// \return value of Jacobian determinant
+   virtual real_t evalFAndDF( const Point3D& x, Point3D& Fx, Matrix3r& DFx ) const
+   {
+      evalF( x, Fx );
+      return evalDF( x, DFx );
+   }
+
+   /// Returns true if the map is affine, i.e. if its Jacobian is constant.
+   /// In that case all micro-elements of the same type of a macro-primitive are congruent.
+   virtual bool isAffine() const { return false; }
+
    /// Evaluation of the determinant of the Jacobian matrix at reference position \p x
    /// \param x Reference input coordinates
    real_t evalDetDF( const Point3D& x );
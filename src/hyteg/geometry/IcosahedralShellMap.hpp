@@ -133,6 +133,50 @@ class IcosahedralShellMap : public GeometryMap
       // SHELL_MAP_LOG( "Mapped: " << xold << " --> " << xnew );
    }
 
+   void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+   {
+      // all quantities that only depend on the macro tetrahedron are computed once for the whole batch
+      const real_t tmp0  = -rayVertex_[2];
+      const real_t tmp1  = refVertex_[2] + tmp0;
+      const real_t tmp2  = -rayVertex_[0];
+      const real_t tmp3  = thrVertex_[0] + tmp2;
+      const real_t tmp4  = -rayVertex_[1];
+      const real_t tmp5  = forVertex_[1] + tmp4;
+      const real_t tmp6  = tmp3 * tmp5;
+      const real_t tmp7  = refVertex_[1] + tmp4;
+      const real_t tmp8  = thrVertex_[2] + tmp0;
+      const real_t tmp9  = forVertex_[0] + tmp2;
+      const real_t tmp10 = tmp8 * tmp9;
+      const real_t tmp11 = refVertex_[0] + tmp2;
+      const real_t tmp12 = thrVertex_[1] + tmp4;
+      const real_t tmp13 = forVertex_[2] + tmp0;
+      const real_t tmp14 = tmp12 * tmp13;
+      const real_t tmp15 = tmp13 * tmp3;
+      const real_t tmp16 = tmp12 * tmp9;
+      const real_t tmp17 = tmp5 * tmp8;
+
+      const real_t volT    = -tmp1 * tmp16 + tmp1 * tmp6 + tmp10 * tmp7 + tmp11 * tmp14 - tmp11 * tmp17 - tmp15 * tmp7;
+      const real_t invVolT = real_c( 1 ) / volT;
+      const real_t radRay  = radRayVertex_;
+      const real_t dist    = radRefVertex_ - radRayVertex_;
+
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         const real_t tmp18 = tmp0 + x[i][2];
+         const real_t tmp19 = tmp4 + x[i][1];
+         const real_t tmp20 = tmp2 + x[i][0];
+
+         const real_t volX = tmp10 * tmp19 + tmp14 * tmp20 - tmp15 * tmp19 - tmp16 * tmp18 - tmp17 * tmp20 + tmp18 * tmp6;
+         const real_t bary = std::abs( volX * invVolT );
+
+         const real_t oldRad = std::sqrt( x[i][0] * x[i][0] + x[i][1] * x[i][1] + x[i][2] * x[i][2] );
+         const real_t scale  = ( radRay + bary * dist ) / oldRad;
+         Fx[i][0]            = x[i][0] * scale;
+         Fx[i][1]            = x[i][1] * scale;
+         Fx[i][2]            = x[i][2] * scale;
+      }
+   }
+
    void evalFinv( const Point3D& xPhys, Point3D& xComp ) const
    {
       // calculating the intersection point of the prism-parallel plane that contains xComp
@@ -200,7 +244,7 @@ class IcosahedralShellMap : public GeometryMap
       real_t tmp23 = x[2] * x[2];
       real_t tmp24 = tmp0 + tmp22 + tmp23;
       real_t tmp25 = tmp17 * ( tmp12 - tmp15 );
-      real_t tmp26 = 1.0 / ( tmp16 * pow( tmp24, 3.0 / 2.0 ) );
+      real_t tmp26 = 1.0 / ( tmp16 * tmp24 * std::sqrt( tmp24 ) );
       real_t tmp27 = tmp13 - tmp8;
       real_t tmp28 = tmp17 * tmp24;
       real_t tmp29 = tmp21 * x[1] + tmp27 * tmp28;
@@ -226,6 +270,72 @@ class IcosahedralShellMap : public GeometryMap
              DFx( 2, 0 ) * DFx( 0, 1 ) * DFx( 1, 2 ) - DFx( 2, 0 ) * DFx( 1, 1 ) * DFx( 0, 2 );
    };
 
+   real_t evalFAndDF( const Point3D& x, Point3D& Fx, Matrix3r& DFx ) const final
+   {
+      // real_t tmp0 = pow(x[0], 2);
+      real_t tmp0  = x[0] * x[0];
+      real_t tmp1  = rayVertex_[2] - refVertex_[2];
+      real_t tmp2  = rayVertex_[0] - thrVertex_[0];
+      real_t tmp3  = rayVertex_[1] - forVertex_[1];
+      real_t tmp4  = tmp2 * tmp3;
+      real_t tmp5  = rayVertex_[1] - refVertex_[1];
+      real_t tmp6  = rayVertex_[0] - forVertex_[0];
+      real_t tmp7  = rayVertex_[2] - thrVertex_[2];
+      real_t tmp8  = tmp6 * tmp7;
+      real_t tmp9  = rayVertex_[0] - refVertex_[0];
+      real_t tmp10 = rayVertex_[1] - thrVertex_[1];
+      real_t tmp11 = rayVertex_[2] - forVertex_[2];
+      real_t tmp12 = tmp10 * tmp11;
+      real_t tmp13 = tmp11 * tmp2;
+      real_t tmp14 = tmp10 * tmp6;
+      real_t tmp15 = tmp3 * tmp7;
+      real_t tmp16 = -tmp1 * tmp14 + tmp1 * tmp4 + tmp12 * tmp9 - tmp13 * tmp5 - tmp15 * tmp9 + tmp5 * tmp8;
+      real_t tmp17 = radRayVertex_ - radRefVertex_;
+      real_t tmp18 = rayVertex_[2] - x[2];
+      real_t tmp19 = rayVertex_[1] - x[1];
+      real_t tmp20 = rayVertex_[0] - x[0];
+      real_t volX  = tmp12 * tmp20 - tmp13 * tmp19 - tmp14 * tmp18 - tmp15 * tmp20 + tmp18 * tmp4 + tmp19 * tmp8;
+      real_t tmp21 = radRayVertex_ * tmp16 - tmp17 * volX;
+      // real_t tmp22 = pow(x[1], 2);
+      // real_t tmp23 = pow(x[2], 2);
+      real_t tmp22 = x[1] * x[1];
+      real_t tmp23 = x[2] * x[2];
+      real_t tmp24 = tmp0 + tmp22 + tmp23;
+      real_t oldRad = std::sqrt( tmp24 );
+      real_t tmp25  = tmp17 * ( tmp12 - tmp15 );
+      real_t tmp26  = 1.0 / ( tmp16 * tmp24 * oldRad );
+      real_t tmp27 = tmp13 - tmp8;
+      real_t tmp28 = tmp17 * tmp24;
+      real_t tmp29 = tmp21 * x[1] + tmp27 * tmp28;
+      real_t tmp30 = tmp26 * x[0];
+      real_t tmp31 = -tmp14 + tmp4;
+      real_t tmp32 = -tmp21 * x[2] + tmp28 * tmp31;
+      real_t tmp33 = -tmp21 * x[0] + tmp24 * tmp25;
+      real_t tmp34 = tmp26 * x[1];
+      real_t tmp35 = tmp26 * x[2];
+
+      DFx( 0, 0 ) = tmp26 * ( -tmp0 * tmp21 + tmp24 * ( tmp21 + tmp25 * x[0] ) );
+      DFx( 0, 1 ) = -tmp29 * tmp30;
+      DFx( 0, 2 ) = tmp30 * tmp32;
+      DFx( 1, 0 ) = tmp33 * tmp34;
+      DFx( 1, 1 ) = tmp26 * ( -tmp21 * tmp22 + tmp24 * ( -tmp17 * tmp27 * x[1] + tmp21 ) );
+      DFx( 1, 2 ) = tmp32 * tmp34;
+      DFx( 2, 0 ) = tmp33 * tmp35;
+      DFx( 2, 1 ) = -tmp29 * tmp35;
+      DFx( 2, 2 ) = tmp26 * ( -tmp21 * tmp23 + tmp24 * ( tmp17 * tmp31 * x[2] + tmp21 ) );
+
+      // the mapping shares the volume of the macro-tetrahedron (tmp16) and the radius with the Jacobian
+      real_t bary   = std::abs( volX / tmp16 );
+      real_t newRad = radRayVertex_ - bary * tmp17;
+      Fx[0]         = x[0] * newRad / oldRad;
+      Fx[1]         = x[1] * newRad / oldRad;
+      Fx[2]         = x[2] * newRad / oldRad;
+
+      return DFx( 0, 0 ) * DFx( 1, 1 ) * DFx( 2, 2 ) - DFx( 0, 0 ) * DFx( 2, 1 ) * DFx( 1, 2 ) -
+             DFx( 1, 0 ) * DFx( 0, 1 ) * DFx( 2, 2 ) + DFx( 1, 0 ) * DFx( 2, 1 ) * DFx( 0, 2 ) +
+             DFx( 2, 0 ) * DFx( 0, 1 ) * DFx( 1, 2 ) - DFx( 2, 0 ) * DFx( 1, 1 ) * DFx( 0, 2 );
+   };
+
    void serializeSubClass( walberla::mpi::SendBuffer& sendBuffer ) const
    {
       sendBuffer << Type::ICOSAHEDRAL_SHELL << rayVertex_ << refVertex_ << thrVertex_ << forVertex_ << radRefVertex_
@@ -32,6 +32,14 @@ class IdentityMap : public GeometryMap
 
    void evalFinv( const Point3D& xPhys, Point3D& xComp ) const final { xComp = xPhys; }
 
+   void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+   {
+      for ( uint_t i = 0; i < n; i++ )
+      {
+         Fx[i] = x[i];
+      }
+   }
+
    void evalDF( const Point3D&, Matrix2r& DFx ) const final
    {
       DFx( 0, 0 ) = 1.0;
@@ -57,6 +65,20 @@ class IdentityMap : public GeometryMap
       return 1.0;
    }
 
+   void evalFAndDF( const Point3D& x, Point3D& Fx, Matrix2r& DFx ) const final
+   {
+      Fx = x;
+      IdentityMap::evalDF( x, DFx );
+   }
+
+   real_t evalFAndDF( const Point3D& x, Point3D& Fx, Matrix3r& DFx ) const final
+   {
+      Fx = x;
+      return IdentityMap::evalDF( x, DFx );
+   }
+
+   bool isAffine() const final { return true; }
+
    void evalDFinv( const Point3D&, Matrix2r& DFinvx ) const final
    {
       DFinvx( 0, 0 ) = 1.0;
@@ -36,6 +36,30 @@ namespace hyteg {
       Fx[1] = x[0] * std::sin( x[1] );
     }
 
+    void evalF( const Point3D* x, Point3D* Fx, uint_t n ) const final
+    {
+      for ( uint_t i = 0; i < n; i++ )
+      {
+        Fx[i][0] = x[i][0] * std::cos( x[i][1] );
+        Fx[i][1] = x[i][0] * std::sin( x[i][1] );
+        Fx[i][2] = real_c( 0 );
+      }
+    }
+
+    void evalFAndDF( const Point3D& x, Point3D& Fx, Matrix2r& DFx ) const final
+    {
+      const real_t cosPhi = std::cos( x[1] );
+      const real_t sinPhi = std::sin( x[1] );
+
+      Fx[0] = x[0] * cosPhi;
+      Fx[1] = x[0] * sinPhi;
+
+      DFx( 0, 0 ) =          cosPhi;
+      DFx( 0, 1 ) = - x[0] * sinPhi;
+      DFx( 1, 0 ) =          sinPhi;
+      DFx( 1, 1 ) =   x[0] * cosPhi;
+    }
+
     void evalDF( const Point3D& x, Matrix2r& DFx ) const
     {
       DFx( 0, 0 ) =          std::cos( x[1] );
@@ -20,25 +20,29 @@
 
 #include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
 
+#include <type_traits>
+
 #include "hyteg/FunctionMemory.hpp"
 #include "hyteg/HytegDefinitions.hpp"
 #include "hyteg/Levelinfo.hpp"
+#include "hyteg/OpenMPManager.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/prolongate_2D_macroface_P1_push_additive.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/prolongate_3D_macrocell_P1_push_additive.hpp"
 #include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
 
 namespace hyteg {
 
-void P1toP1LinearProlongation::prolongate2D( const P1Function< real_t >& function,
-                                             const uint_t&               sourceLevel,
-                                             const DoFType&              flag ) const
+template < typename ValueType >
+void GenericP1toP1LinearProlongation< ValueType >::prolongate2D( const P1Function< ValueType >& function,
+                                                                 const uint_t&                  sourceLevel,
+                                                                 const DoFType&                 flag ) const
 {
    const uint_t destinationLevel = sourceLevel + 1;
 
-   function.communicate< Vertex, Edge >( sourceLevel );
-   function.communicate< Edge, Face >( sourceLevel );
-   function.communicate< Face, Edge >( sourceLevel );
-   function.communicate< Edge, Vertex >( sourceLevel );
+   function.template communicate< Vertex, Edge >( sourceLevel );
+   function.template communicate< Edge, Face >( sourceLevel );
+   function.template communicate< Face, Edge >( sourceLevel );
+   function.template communicate< Edge, Vertex >( sourceLevel );
 
    for ( const auto& it : function.getStorage()->getVertices() )
    {
@@ -77,6 +81,47 @@ void P1toP1LinearProlongation::prolongate2D( const P1Function< real_t >& functio
    }
 }
 
+/// Returns the inverse number of macro-faces that share the micro-vertex at the passed (possibly out of range) index
+/// of a macro-face, or zero if the index is located outside of the macro-face.
+static real_t inverseNumNeighborFacesOfMicroVertex( const std::array< real_t, 3 >& invNumNeighborsOfVertex,
+                                                    const std::array< real_t, 3 >& invNumNeighborsOfEdge,
+                                                    const int&                     x,
+                                                    const int&                     y,
+                                                    const uint_t&                  level )
+{
+   const int width = int_c( levelinfo::num_microvertices_per_edge( level ) );
+
+   if ( x < 0 || y < 0 || x + y > width - 1 )
+   {
+      return real_c( 0 );
+   }
+   if ( x == 0 && y == 0 )
+   {
+      return invNumNeighborsOfVertex[0];
+   }
+   if ( x == width - 1 && y == 0 )
+   {
+      return invNumNeighborsOfVertex[1];
+   }
+   if ( x == 0 && y == width - 1 )
+   {
+      return invNumNeighborsOfVertex[2];
+   }
+   if ( y == 0 )
+   {
+      return invNumNeighborsOfEdge[0];
+   }
+   if ( x == 0 )
+   {
+      return invNumNeighborsOfEdge[1];
+   }
+   if ( x + y == width - 1 )
+   {
+      return invNumNeighborsOfEdge[2];
+   }
+   return real_c( 1 );
+}
+
 static real_t calculateInverseFactorToScaleNeighborhoodContribution( const std::array< real_t, 4 >& invNumNeighborsOfVertex,
                                                                      const std::array< real_t, 6 >& invNumNeighborsOfEdge,
                                                                      const std::array< real_t, 4 >  invNumNeighborsOfFace,
@@ -111,18 +156,19 @@ static real_t calculateInverseFactorToScaleNeighborhoodContribution( const std::
    return invFactorDueToNeighborhood;
 }
 
-void P1toP1LinearProlongation::prolongate2DAdditively( const P1Function< real_t >& function,
-                                                       const uint_t&               sourceLevel,
-                                                       const DoFType&              flag,
-                                                       const UpdateType&           updateType ) const
+template < typename ValueType >
+void GenericP1toP1LinearProlongation< ValueType >::prolongate2DAdditively( const P1Function< ValueType >& function,
+                                                                           const uint_t&                  sourceLevel,
+                                                                           const DoFType&                 flag,
+                                                                           const UpdateType&              updateType ) const
 {
    /// XOR flag with all to get the DoFTypes that should be excluded
    const DoFType excludeFlag = ( flag ^ All );
 
    const uint_t destinationLevel = sourceLevel + 1;
 
-   function.communicate< Vertex, Edge >( sourceLevel );
-   function.communicate< Edge, Face >( sourceLevel );
+   function.template communicate< Vertex, Edge >( sourceLevel );
+   function.template communicate< Edge, Face >( sourceLevel );
 
    auto storage = function.getStorage();
 
@@ -158,51 +204,104 @@ void P1toP1LinearProlongation::prolongate2DAdditively( const P1Function< real_t
          WALBERLA_ABORT( "Invalid update type in prolongation." );
       }
 
-      const auto numNeighborFacesEdge0 =
-          static_cast< double >( storage->getEdge( face->neighborEdges().at( 0 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesEdge1 =
-          static_cast< double >( storage->getEdge( face->neighborEdges().at( 1 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesEdge2 =
-          static_cast< double >( storage->getEdge( face->neighborEdges().at( 2 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesVertex0 =
-          static_cast< double >( storage->getVertex( face->neighborVertices().at( 0 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesVertex1 =
-          static_cast< double >( storage->getVertex( face->neighborVertices().at( 1 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesVertex2 =
-          static_cast< double >( storage->getVertex( face->neighborVertices().at( 2 ) )->getNumNeighborFaces() );
-
-      vertexdof::macroface::generated::prolongate_2D_macroface_P1_push_additive( srcData,
-                                                                                 dstData,
-                                                                                 static_cast< int32_t >( sourceLevel ),
-                                                                                 numNeighborFacesEdge0,
-                                                                                 numNeighborFacesEdge1,
-                                                                                 numNeighborFacesEdge2,
-                                                                                 numNeighborFacesVertex0,
-                                                                                 numNeighborFacesVertex1,
-                                                                                 numNeighborFacesVertex2 );
+      if constexpr ( std::is_same< ValueType, double >::value )
+      {
+         const auto numNeighborFacesEdge0 =
+             static_cast< double >( storage->getEdge( face->neighborEdges().at( 0 ) )->getNumNeighborFaces() );
+         const auto numNeighborFacesEdge1 =
+             static_cast< double >( storage->getEdge( face->neighborEdges().at( 1 ) )->getNumNeighborFaces() );
+         const auto numNeighborFacesEdge2 =
+             static_cast< double >( storage->getEdge( face->neighborEdges().at( 2 ) )->getNumNeighborFaces() );
+         const auto numNeighborFacesVertex0 =
+             static_cast< double >( storage->getVertex( face->neighborVertices().at( 0 ) )->getNumNeighborFaces() );
+         const auto numNeighborFacesVertex1 =
+             static_cast< double >( storage->getVertex( face->neighborVertices().at( 1 ) )->getNumNeighborFaces() );
+         const auto numNeighborFacesVertex2 =
+             static_cast< double >( storage->getVertex( face->neighborVertices().at( 2 ) )->getNumNeighborFaces() );
+
+         vertexdof::macroface::generated::prolongate_2D_macroface_P1_push_additive( srcData,
+                                                                                    dstData,
+                                                                                    static_cast< int32_t >( sourceLevel ),
+                                                                                    numNeighborFacesEdge0,
+                                                                                    numNeighborFacesEdge1,
+                                                                                    numNeighborFacesEdge2,
+                                                                                    numNeighborFacesVertex0,
+                                                                                    numNeighborFacesVertex1,
+                                                                                    numNeighborFacesVertex2 );
+      }
+      else
+      {
+         // generic kernel for the value types that are not supported by the generated kernel
+         std::array< real_t, 3 > invNumNeighborsOfVertex;
+         std::array< real_t, 3 > invNumNeighborsOfEdge;
+         for ( uint_t i = 0; i < 3; i++ )
+         {
+            invNumNeighborsOfVertex[i] =
+                real_c( 1 ) / real_c( storage->getVertex( face->neighborVertices().at( i ) )->getNumNeighborFaces() );
+            invNumNeighborsOfEdge[i] =
+                real_c( 1 ) / real_c( storage->getEdge( face->neighborEdges().at( i ) )->getNumNeighborFaces() );
+         }
+
+         for ( const auto& srcIdx : vertexdof::macroface::Iterator( sourceLevel ) )
+         {
+            const real_t srcValue = srcData[vertexdof::macroface::index( sourceLevel, srcIdx.x(), srcIdx.y() )];
+            const int    dstX     = 2 * int_c( srcIdx.x() );
+            const int    dstY     = 2 * int_c( srcIdx.y() );
+
+            // update center
+            const auto invFactorCenter = inverseNumNeighborFacesOfMicroVertex(
+                invNumNeighborsOfVertex, invNumNeighborsOfEdge, dstX, dstY, destinationLevel );
+            dstData[vertexdof::macroface::index( destinationLevel, uint_c( dstX ), uint_c( dstY ) )] +=
+                static_cast< ValueType >( invFactorCenter * srcValue );
+
+            // update new points, skipping those that are located outside of the macro-face
+            for ( const auto& dir : vertexdof::macroface::neighborsWithoutCenter )
+            {
+               const auto increment = vertexdof::logicalIndexOffsetFromVertex( dir );
+               const int  leafX     = dstX + increment.x();
+               const int  leafY     = dstY + increment.y();
+               const auto invFactor = inverseNumNeighborFacesOfMicroVertex(
+                   invNumNeighborsOfVertex, invNumNeighborsOfEdge, leafX, leafY, destinationLevel );
+               if ( invFactor > real_c( 0 ) )
+               {
+                  dstData[vertexdof::macroface::index( destinationLevel, uint_c( leafX ), uint_c( leafY ) )] +=
+                      static_cast< ValueType >( 0.5 * invFactor * srcValue );
+               }
+            }
+         }
+      }
    }
 
-   function.communicateAdditively< Face, Edge >( destinationLevel, excludeFlag, *storage, updateType == Replace );
-   function.communicateAdditively< Face, Vertex >( destinationLevel, excludeFlag, *storage, updateType == Replace );
+   function.template communicateAdditively< Face, Edge >( destinationLevel, excludeFlag, *storage, updateType == Replace );
+   function.template communicateAdditively< Face, Vertex >( destinationLevel, excludeFlag, *storage, updateType == Replace );
 }
 
-void P1toP1LinearProlongation::prolongate3DAdditively( const P1Function< real_t >& function,
-                                                       const uint_t&               sourceLevel,
-                                                       const DoFType&              flag,
-                                                       const UpdateType&           updateType ) const
+template < typename ValueType >
+void GenericP1toP1LinearProlongation< ValueType >::prolongate3DAdditively( const P1Function< ValueType >& function,
+                                                                           const uint_t&                  sourceLevel,
+                                                                           const DoFType&                 flag,
+                                                                           const UpdateType&              updateType ) const
 {
    /// XOR flag with all to get the DoFTypes that should be excluded
    const DoFType excludeFlag = ( flag ^ All );
 
    const uint_t destinationLevel = sourceLevel + 1;
 
-   function.communicate< Vertex, Edge >( sourceLevel );
-   function.communicate< Edge, Face >( sourceLevel );
-   function.communicate< Face, Cell >( sourceLevel );
-
-   for ( const auto& cellIt : function.getStorage()->getCells() )
+   function.template communicate< Vertex, Edge >( sourceLevel );
+   function.template communicate< Edge, Face >( sourceLevel );
+   function.template communicate< Face, Cell >( sourceLevel );
+
+   // The macro-cells only write to their own memory. If there are at least as many macro-cells as threads, they are
+   // distributed among the threads and processed by the generated kernel. Otherwise, the threads share the slabs of
+   // one macro-cell after the other.
+   const std::vector< PrimitiveID > cellIDs          = function.getStorage()->getCellIDs();
+   const bool                       threadMacroCells = int_c( cellIDs.size() ) >= OpenMPManager::instance()->numThreads();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared ) if ( threadMacroCells )
+#endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
    {
-      const auto cell    = cellIt.second;
+      const auto cell    = function.getStorage()->getCell( cellIDs[walberla::uint_c( i )] );
       const auto srcData = cell->getData( function.getCellDataID() )->getPointer( sourceLevel );
       auto       dstData = cell->getData( function.getCellDataID() )->getPointer( destinationLevel );
 
@@ -232,58 +331,62 @@ void P1toP1LinearProlongation::prolongate3DAdditively( const P1Function< real_t
          WALBERLA_ABORT( "Invalid update type in prolongation." );
       }
 
-      if ( globalDefines::useGeneratedKernels )
+      if ( std::is_same< ValueType, double >::value && globalDefines::useGeneratedKernels && threadMacroCells )
       {
-         auto storage = function.getStorage();
-
-         const double numNeighborCellsFace0 =
-             static_cast< double >( storage->getFace( cell->neighborFaces().at( 0 ) )->getNumNeighborCells() );
-         const double numNeighborCellsFace1 =
-             static_cast< double >( storage->getFace( cell->neighborFaces().at( 1 ) )->getNumNeighborCells() );
-         const double numNeighborCellsFace2 =
-             static_cast< double >( storage->getFace( cell->neighborFaces().at( 2 ) )->getNumNeighborCells() );
-         const double numNeighborCellsFace3 =
-             static_cast< double >( storage->getFace( cell->neighborFaces().at( 3 ) )->getNumNeighborCells() );
-
-         const double numNeighborCellsEdge0 =
-             static_cast< double >( storage->getEdge( cell->neighborEdges().at( 0 ) )->getNumNeighborCells() );
-         const double numNeighborCellsEdge1 =
-             static_cast< double >( storage->getEdge( cell->neighborEdges().at( 1 ) )->getNumNeighborCells() );
-         const double numNeighborCellsEdge2 =
-             static_cast< double >( storage->getEdge( cell->neighborEdges().at( 2 ) )->getNumNeighborCells() );
-         const double numNeighborCellsEdge3 =
-             static_cast< double >( storage->getEdge( cell->neighborEdges().at( 3 ) )->getNumNeighborCells() );
-         const double numNeighborCellsEdge4 =
-             static_cast< double >( storage->getEdge( cell->neighborEdges().at( 4 ) )->getNumNeighborCells() );
-         const double numNeighborCellsEdge5 =
-             static_cast< double >( storage->getEdge( cell->neighborEdges().at( 5 ) )->getNumNeighborCells() );
-
-         const double numNeighborCellsVertex0 =
-             static_cast< double >( storage->getVertex( cell->neighborVertices().at( 0 ) )->getNumNeighborCells() );
-         const double numNeighborCellsVertex1 =
-             static_cast< double >( storage->getVertex( cell->neighborVertices().at( 1 ) )->getNumNeighborCells() );
-         const double numNeighborCellsVertex2 =
-             static_cast< double >( storage->getVertex( cell->neighborVertices().at( 2 ) )->getNumNeighborCells() );
-         const double numNeighborCellsVertex3 =
-             static_cast< double >( storage->getVertex( cell->neighborVertices().at( 3 ) )->getNumNeighborCells() );
-
-         vertexdof::macrocell::generated::prolongate_3D_macrocell_P1_push_additive( srcData,
-                                                                                    dstData,
-                                                                                    static_cast< int32_t >( sourceLevel ),
-                                                                                    numNeighborCellsEdge0,
-                                                                                    numNeighborCellsEdge1,
-                                                                                    numNeighborCellsEdge2,
-                                                                                    numNeighborCellsEdge3,
-                                                                                    numNeighborCellsEdge4,
-                                                                                    numNeighborCellsEdge5,
-                                                                                    numNeighborCellsFace0,
-                                                                                    numNeighborCellsFace1,
-                                                                                    numNeighborCellsFace2,
-                                                                                    numNeighborCellsFace3,
-                                                                                    numNeighborCellsVertex0,
-                                                                                    numNeighborCellsVertex1,
-                                                                                    numNeighborCellsVertex2,
-                                                                                    numNeighborCellsVertex3 );
+         // the generated kernel is only available for double precision
+         if constexpr ( std::is_same< ValueType, double >::value )
+         {
+            auto storage = function.getStorage();
+
+            const double numNeighborCellsFace0 =
+                static_cast< double >( storage->getFace( cell->neighborFaces().at( 0 ) )->getNumNeighborCells() );
+            const double numNeighborCellsFace1 =
+                static_cast< double >( storage->getFace( cell->neighborFaces().at( 1 ) )->getNumNeighborCells() );
+            const double numNeighborCellsFace2 =
+                static_cast< double >( storage->getFace( cell->neighborFaces().at( 2 ) )->getNumNeighborCells() );
+            const double numNeighborCellsFace3 =
+                static_cast< double >( storage->getFace( cell->neighborFaces().at( 3 ) )->getNumNeighborCells() );
+
+            const double numNeighborCellsEdge0 =
+                static_cast< double >( storage->getEdge( cell->neighborEdges().at( 0 ) )->getNumNeighborCells() );
+            const double numNeighborCellsEdge1 =
+                static_cast< double >( storage->getEdge( cell->neighborEdges().at( 1 ) )->getNumNeighborCells() );
+            const double numNeighborCellsEdge2 =
+                static_cast< double >( storage->getEdge( cell->neighborEdges().at( 2 ) )->getNumNeighborCells() );
+            const double numNeighborCellsEdge3 =
+                static_cast< double >( storage->getEdge( cell->neighborEdges().at( 3 ) )->getNumNeighborCells() );
+            const double numNeighborCellsEdge4 =
+                static_cast< double >( storage->getEdge( cell->neighborEdges().at( 4 ) )->getNumNeighborCells() );
+            const double numNeighborCellsEdge5 =
+                static_cast< double >( storage->getEdge( cell->neighborEdges().at( 5 ) )->getNumNeighborCells() );
+
+            const double numNeighborCellsVertex0 =
+                static_cast< double >( storage->getVertex( cell->neighborVertices().at( 0 ) )->getNumNeighborCells() );
+            const double numNeighborCellsVertex1 =
+                static_cast< double >( storage->getVertex( cell->neighborVertices().at( 1 ) )->getNumNeighborCells() );
+            const double numNeighborCellsVertex2 =
+                static_cast< double >( storage->getVertex( cell->neighborVertices().at( 2 ) )->getNumNeighborCells() );
+            const double numNeighborCellsVertex3 =
+                static_cast< double >( storage->getVertex( cell->neighborVertices().at( 3 ) )->getNumNeighborCells() );
+
+            vertexdof::macrocell::generated::prolongate_3D_macrocell_P1_push_additive( srcData,
+                                                                                       dstData,
+                                                                                       static_cast< int32_t >( sourceLevel ),
+                                                                                       numNeighborCellsEdge0,
+                                                                                       numNeighborCellsEdge1,
+                                                                                       numNeighborCellsEdge2,
+                                                                                       numNeighborCellsEdge3,
+                                                                                       numNeighborCellsEdge4,
+                                                                                       numNeighborCellsEdge5,
+                                                                                       numNeighborCellsFace0,
+                                                                                       numNeighborCellsFace1,
+                                                                                       numNeighborCellsFace2,
+                                                                                       numNeighborCellsFace3,
+                                                                                       numNeighborCellsVertex0,
+                                                                                       numNeighborCellsVertex1,
+                                                                                       numNeighborCellsVertex2,
+                                                                                       numNeighborCellsVertex3 );
+         }
       }
       else
       {
@@ -312,96 +415,146 @@ void P1toP1LinearProlongation::prolongate3DAdditively( const P1Function< real_t
                 real_c( 1 ) / real_c( function.getStorage()->getFace( neighborFaceID )->getNumNeighborCells() );
          }
 
-         for ( const auto& srcIdx : vertexdof::macrocell::Iterator( sourceLevel ) )
+         // The coarse slab z only pushes to the fine slabs 2z - 1, 2z and 2z + 1.
+         // Therefore, coarse slabs of equal parity can be processed concurrently.
+         const uint_t numSlabs = levelinfo::num_microvertices_per_edge( sourceLevel );
+         for ( int parity = 0; parity < 2; parity++ )
          {
-            const auto arrayIdxSrc = vertexdof::macrocell::index( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z() );
-            const auto dstIdx      = srcIdx * 2;
-
-            const auto onCellVertices = vertexdof::macrocell::isOnCellVertex( srcIdx, sourceLevel );
-            const auto onCellEdges    = vertexdof::macrocell::isOnCellEdge( srcIdx, sourceLevel );
-            const auto onCellFaces    = vertexdof::macrocell::isOnCellFace( srcIdx, sourceLevel );
-
-            // update center
-            const auto invFactorToScaleContributionCenter = calculateInverseFactorToScaleNeighborhoodContribution(
-                invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace, dstIdx, destinationLevel );
-
-            const auto arrayIdxDstCenter = vertexdof::macrocell::index( destinationLevel, dstIdx.x(), dstIdx.y(), dstIdx.z() );
-            dstData[arrayIdxDstCenter] += invFactorToScaleContributionCenter * srcData[arrayIdxSrc];
-
-            // update new points depending on location in macro-cell
-            if ( onCellVertices.size() > 0 )
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for schedule( static, 1 ) default( shared ) if ( !threadMacroCells )
+#endif
+            for ( int slab = parity; slab < int_c( numSlabs ); slab += 2 )
             {
-               WALBERLA_ASSERT_EQUAL( onCellVertices.size(), 1 );
-               const auto localVertexID = *onCellVertices.begin();
-
-               for ( const auto& dir : vertexdof::macrocell::neighborsOnVertexWithoutCenter[localVertexID] )
-               {
-                  const auto increment                    = vertexdof::logicalIndexOffsetFromVertex( dir );
-                  const auto dirIdxDst                    = dstIdx + increment;
-                  const auto invFactorToScaleContribution = calculateInverseFactorToScaleNeighborhoodContribution(
-                      invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace, dirIdxDst, destinationLevel );
-
-                  const auto arrayIdxDst =
-                      vertexdof::macrocell::index( destinationLevel, dirIdxDst.x(), dirIdxDst.y(), dirIdxDst.z() );
-                  dstData[arrayIdxDst] += 0.5 * invFactorToScaleContribution * srcData[arrayIdxSrc];
-               }
-            }
-            else if ( onCellEdges.size() > 0 )
-            {
-               WALBERLA_ASSERT_EQUAL( onCellEdges.size(), 1 );
-               const auto localEdgeID = *onCellEdges.begin();
-
-               for ( const auto& dir : vertexdof::macrocell::neighborsOnEdgeWithoutCenter[localEdgeID] )
-               {
-                  const auto increment                    = vertexdof::logicalIndexOffsetFromVertex( dir );
-                  const auto dirIdxDst                    = dstIdx + increment;
-                  const auto invFactorToScaleContribution = calculateInverseFactorToScaleNeighborhoodContribution(
-                      invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace, dirIdxDst, destinationLevel );
-                  const auto arrayIdxDst =
-                      vertexdof::macrocell::index( destinationLevel, dirIdxDst.x(), dirIdxDst.y(), dirIdxDst.z() );
-                  dstData[arrayIdxDst] += 0.5 * invFactorToScaleContribution * srcData[arrayIdxSrc];
-               }
-            }
-            else if ( onCellFaces.size() > 0 )
-            {
-               WALBERLA_ASSERT_EQUAL( onCellFaces.size(), 1 );
-               const auto localFaceID = *onCellFaces.begin();
-
-               for ( const auto& dir : vertexdof::macrocell::neighborsOnFaceWithoutCenter[localFaceID] )
-               {
-                  const auto increment                    = vertexdof::logicalIndexOffsetFromVertex( dir );
-                  const auto dirIdxDst                    = dstIdx + increment;
-                  const auto invFactorToScaleContribution = calculateInverseFactorToScaleNeighborhoodContribution(
-                      invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace, dirIdxDst, destinationLevel );
-                  const auto arrayIdxDst =
-                      vertexdof::macrocell::index( destinationLevel, dirIdxDst.x(), dirIdxDst.y(), dirIdxDst.z() );
-                  dstData[arrayIdxDst] += 0.5 * invFactorToScaleContribution * srcData[arrayIdxSrc];
-               }
-            }
-            else
-            {
-               for ( const auto& dir : vertexdof::macrocell::neighborsWithoutCenter )
+               const uint_t z = uint_c( slab );
+               for ( uint_t y = 0; y < numSlabs - z; y++ )
                {
-                  const auto arrayIdxDst =
-                      vertexdof::macrocell::indexFromVertex( destinationLevel, dstIdx.x(), dstIdx.y(), dstIdx.z(), dir );
-                  dstData[arrayIdxDst] += 0.5 * srcData[arrayIdxSrc];
+                  for ( uint_t x = 0; x < numSlabs - z - y; x++ )
+                  {
+                     const indexing::Index srcIdx( x, y, z );
+                     const auto            arrayIdxSrc = vertexdof::macrocell::index( sourceLevel, x, y, z );
+                     const auto            dstIdx      = srcIdx * 2;
+
+                     if ( x > 0 && y > 0 && z > 0 && x + y + z < numSlabs - 1 )
+                     {
+                        // inner points do not need any scaling
+                        dstData[vertexdof::macrocell::index( destinationLevel, dstIdx.x(), dstIdx.y(), dstIdx.z() )] +=
+                            srcData[arrayIdxSrc];
+                        const ValueType contribution = static_cast< ValueType >( 0.5 * srcData[arrayIdxSrc] );
+                        for ( const auto& dir : vertexdof::macrocell::neighborsWithoutCenter )
+                        {
+                           const auto arrayIdxDst =
+                               vertexdof::macrocell::indexFromVertex( destinationLevel, dstIdx.x(), dstIdx.y(), dstIdx.z(), dir );
+                           dstData[arrayIdxDst] += contribution;
+                        }
+                        continue;
+                     }
+
+                     // points on the macro-cell boundary are scaled by the number of neighboring macro-cells
+                     const auto onCellVertices = vertexdof::macrocell::isOnCellVertex( srcIdx, sourceLevel );
+                     const auto onCellEdges    = vertexdof::macrocell::isOnCellEdge( srcIdx, sourceLevel );
+                     const auto onCellFaces    = vertexdof::macrocell::isOnCellFace( srcIdx, sourceLevel );
+
+                     // update center
+                     const auto invFactorToScaleContributionCenter = calculateInverseFactorToScaleNeighborhoodContribution(
+                         invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace, dstIdx, destinationLevel );
+
+                     const auto arrayIdxDstCenter =
+                         vertexdof::macrocell::index( destinationLevel, dstIdx.x(), dstIdx.y(), dstIdx.z() );
+                     dstData[arrayIdxDstCenter] +=
+                         static_cast< ValueType >( invFactorToScaleContributionCenter * srcData[arrayIdxSrc] );
+
+                     // update new points depending on location in macro-cell
+                     if ( onCellVertices.size() > 0 )
+                     {
+                        WALBERLA_ASSERT_EQUAL( onCellVertices.size(), 1 );
+                        const auto localVertexID = *onCellVertices.begin();
+
+                        for ( const auto& dir : vertexdof::macrocell::neighborsOnVertexWithoutCenter[localVertexID] )
+                        {
+                           const auto increment                    = vertexdof::logicalIndexOffsetFromVertex( dir );
+                           const auto dirIdxDst                    = dstIdx + increment;
+                           const auto invFactorToScaleContribution =
+                               calculateInverseFactorToScaleNeighborhoodContribution( invNumNeighborsOfVertex,
+                                                                                      invNumNeighborsOfEdge,
+                                                                                      invNumNeighborsOfFace,
+                                                                                      dirIdxDst,
+                                                                                      destinationLevel );
+
+                           const auto arrayIdxDst =
+                               vertexdof::macrocell::index( destinationLevel, dirIdxDst.x(), dirIdxDst.y(), dirIdxDst.z() );
+                           dstData[arrayIdxDst] +=
+                               static_cast< ValueType >( 0.5 * invFactorToScaleContribution * srcData[arrayIdxSrc] );
+                        }
+                     }
+                     else if ( onCellEdges.size() > 0 )
+                     {
+                        WALBERLA_ASSERT_EQUAL( onCellEdges.size(), 1 );
+                        const auto localEdgeID = *onCellEdges.begin();
+
+                        for ( const auto& dir : vertexdof::macrocell::neighborsOnEdgeWithoutCenter[localEdgeID] )
+                        {
+                           const auto increment                    = vertexdof::logicalIndexOffsetFromVertex( dir );
+                           const auto dirIdxDst                    = dstIdx + increment;
+                           const auto invFactorToScaleContribution =
+                               calculateInverseFactorToScaleNeighborhoodContribution( invNumNeighborsOfVertex,
+                                                                                      invNumNeighborsOfEdge,
+                                                                                      invNumNeighborsOfFace,
+                                                                                      dirIdxDst,
+                                                                                      destinationLevel );
+                           const auto arrayIdxDst =
+                               vertexdof::macrocell::index( destinationLevel, dirIdxDst.x(), dirIdxDst.y(), dirIdxDst.z() );
+                           dstData[arrayIdxDst] +=
+                               static_cast< ValueType >( 0.5 * invFactorToScaleContribution * srcData[arrayIdxSrc] );
+                        }
+                     }
+                     else if ( onCellFaces.size() > 0 )
+                     {
+                        WALBERLA_ASSERT_EQUAL( onCellFaces.size(), 1 );
+                        const auto localFaceID = *onCellFaces.begin();
+
+                        for ( const auto& dir : vertexdof::macrocell::neighborsOnFaceWithoutCenter[localFaceID] )
+                        {
+                           const auto increment                    = vertexdof::logicalIndexOffsetFromVertex( dir );
+                           const auto dirIdxDst                    = dstIdx + increment;
+                           const auto invFactorToScaleContribution =
+                               calculateInverseFactorToScaleNeighborhoodContribution( invNumNeighborsOfVertex,
+                                                                                      invNumNeighborsOfEdge,
+                                                                                      invNumNeighborsOfFace,
+                                                                                      dirIdxDst,
+                                                                                      destinationLevel );
+                           const auto arrayIdxDst =
+                               vertexdof::macrocell::index( destinationLevel, dirIdxDst.x(), dirIdxDst.y(), dirIdxDst.z() );
+                           dstData[arrayIdxDst] +=
+                               static_cast< ValueType >( 0.5 * invFactorToScaleContribution * srcData[arrayIdxSrc] );
+                        }
+                     }
+                  }
                }
             }
          }
       }
    }
 
-   function.communicateAdditively< Cell, Vertex >( destinationLevel, excludeFlag, *function.getStorage(), updateType == Replace );
-   function.communicateAdditively< Cell, Edge >( destinationLevel, excludeFlag, *function.getStorage(), updateType == Replace );
-   function.communicateAdditively< Cell, Face >( destinationLevel, excludeFlag, *function.getStorage(), updateType == Replace );
+   function.template communicateAdditively< Cell, Vertex >(
+       destinationLevel, excludeFlag, *function.getStorage(), updateType == Replace );
+   function.template communicateAdditively< Cell, Edge >(
+       destinationLevel, excludeFlag, *function.getStorage(), updateType == Replace );
+   function.template communicateAdditively< Cell, Face >(
+       destinationLevel, excludeFlag, *function.getStorage(), updateType == Replace );
 }
 
-void P1toP1LinearProlongation::prolongateMacroVertex2D( const real_t* src, real_t* dst, const uint_t& ) const
+template < typename ValueType >
+void GenericP1toP1LinearProlongation< ValueType >::prolongateMacroVertex2D( const ValueType* src,
+                                                                            ValueType*       dst,
+                                                                            const uint_t& ) const
 {
    dst[0] = src[0];
 }
 
-void P1toP1LinearProlongation::prolongateMacroEdge2D( const real_t* src, real_t* dst, const uint_t& sourceLevel ) const
+template < typename ValueType >
+void GenericP1toP1LinearProlongation< ValueType >::prolongateMacroEdge2D( const ValueType* src,
+                                                                          ValueType*       dst,
+                                                                          const uint_t&    sourceLevel ) const
 {
    uint_t rowsize_c = levelinfo::num_microvertices_per_edge( sourceLevel );
    uint_t i_c;
@@ -421,7 +574,10 @@ void P1toP1LinearProlongation::prolongateMacroEdge2D( const real_t* src, real_t*
                src[vertexdof::macroedge::indexFromVertex( sourceLevel, i_c, stencilDirection::VERTEX_C )] );
 }
 
-void P1toP1LinearProlongation::prolongateMacroFace2D( const real_t* src, real_t* dst, const uint_t& sourceLevel ) const
+template < typename ValueType >
+void GenericP1toP1LinearProlongation< ValueType >::prolongateMacroFace2D( const ValueType* src,
+                                                                          ValueType*       dst,
+                                                                          const uint_t&    sourceLevel ) const
 {
    typedef stencilDirection SD;
    using namespace vertexdof::macroface;
@@ -462,4 +618,7 @@ void P1toP1LinearProlongation::prolongateMacroFace2D( const real_t* src, real_t*
    }
 }
 
+template class GenericP1toP1LinearProlongation< float >;
+template class GenericP1toP1LinearProlongation< double >;
+
 } // namespace hyteg
\ No newline at end of file
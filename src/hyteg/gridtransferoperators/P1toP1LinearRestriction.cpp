@@ -19,25 +19,36 @@
  */
 
 #include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
 #include "hyteg/FunctionMemory.hpp"
 #include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroEdge.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroVertex.hpp"
 #include "hyteg/Levelinfo.hpp"
+#include "hyteg/OpenMPManager.hpp"
 #include "hyteg/HytegDefinitions.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_2D_macroface_P1_pull_additive.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_3D_macrocell_P1_pull_additive.hpp"
 
 namespace hyteg {
 
-void P1toP1LinearRestriction::restrict2D( const P1Function< real_t >& function, const uint_t& sourceLevel, const DoFType& flag ) const
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::restrict2D( const P1Function< ValueType >& function,
+                                                              const uint_t&                  sourceLevel,
+                                                              const DoFType&                 flag ) const
 {
   const uint_t destinationLevel  = sourceLevel - 1;
   const auto   storage           = function.getStorage();
   const auto   boundaryCondition = function.getBoundaryCondition();
 
-  function.communicate< Vertex, Edge >( sourceLevel );
-  function.communicate< Edge, Face >( sourceLevel );
-  function.communicate< Face, Edge >( sourceLevel );
-  function.communicate< Edge, Vertex >( sourceLevel );
+  function.template communicate< Vertex, Edge >( sourceLevel );
+  function.template communicate< Edge, Face >( sourceLevel );
+  function.template communicate< Face, Edge >( sourceLevel );
+  function.template communicate< Edge, Vertex >( sourceLevel );
 
   for( const auto& it : storage->getVertices() )
   {
@@ -76,6 +87,33 @@ void P1toP1LinearRestriction::restrict2D( const P1Function< real_t >& function,
   }
 }
 
+/// Returns the inverse number of macro-faces that share the micro-vertex at the passed (possibly out of range) index
+/// of a macro-face, or zero if the index is located outside of the macro-face.
+static real_t inverseNumNeighborFacesOfMicroVertex( const std::array< real_t, 3 >& invNumNeighborsOfVertex,
+                                                    const std::array< real_t, 3 >& invNumNeighborsOfEdge,
+                                                    const int&                     x,
+                                                    const int&                     y,
+                                                    const uint_t&                  level )
+{
+  const int width = int_c( levelinfo::num_microvertices_per_edge( level ) );
+
+  if ( x < 0 || y < 0 || x + y > width - 1 )
+    return real_c( 0 );
+  if ( x == 0 && y == 0 )
+    return invNumNeighborsOfVertex[0];
+  if ( x == width - 1 && y == 0 )
+    return invNumNeighborsOfVertex[1];
+  if ( x == 0 && y == width - 1 )
+    return invNumNeighborsOfVertex[2];
+  if ( y == 0 )
+    return invNumNeighborsOfEdge[0];
+  if ( x == 0 )
+    return invNumNeighborsOfEdge[1];
+  if ( x + y == width - 1 )
+    return invNumNeighborsOfEdge[2];
+  return real_c( 1 );
+}
+
 static real_t calculateInverseFactorToScaleNeighborhoodContribution(
   const std::array< real_t, 4 > & invNumNeighborsOfVertex,
   const std::array< real_t, 6 > & invNumNeighborsOfEdge,
@@ -111,17 +149,18 @@ static real_t calculateInverseFactorToScaleNeighborhoodContribution(
   return invFactorDueToNeighborhood;
 }
 
-void P1toP1LinearRestriction::restrict2DAdditively( const P1Function< real_t >& function,
-                                                    const uint_t&               sourceLevel,
-                                                    const DoFType&              flag ) const
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::restrict2DAdditively( const P1Function< ValueType >& function,
+                                                                        const uint_t&                  sourceLevel,
+                                                                        const DoFType&                 flag ) const
 {
    /// XOR flag with all to get the DoFTypes that should be excluded
   const DoFType excludeFlag = (flag ^ All);
 
   const uint_t destinationLevel = sourceLevel - 1;
 
-  function.communicate< Vertex, Edge >  ( sourceLevel );
-  function.communicate< Edge,   Face >  ( sourceLevel );
+  function.template communicate< Vertex, Edge >  ( sourceLevel );
+  function.template communicate< Edge,   Face >  ( sourceLevel );
 
   auto storage = function.getStorage();
 
@@ -131,105 +170,157 @@ void P1toP1LinearRestriction::restrict2DAdditively( const P1Function< real_t >&
     const auto srcData = face->getData( function.getFaceDataID())->getPointer( sourceLevel );
     auto dstData = face->getData( function.getFaceDataID())->getPointer( destinationLevel );
 
-    const auto numNeighborFacesEdge0 =
-    static_cast< double >( storage->getEdge( face->neighborEdges().at( 0 ))->getNumNeighborFaces());
-    const auto numNeighborFacesEdge1 =
-    static_cast< double >( storage->getEdge( face->neighborEdges().at( 1 ))->getNumNeighborFaces());
-    const auto numNeighborFacesEdge2 =
-    static_cast< double >( storage->getEdge( face->neighborEdges().at( 2 ))->getNumNeighborFaces());
-    const auto numNeighborFacesVertex0 =
-    static_cast< double >( storage->getVertex( face->neighborVertices().at( 0 ))->getNumNeighborFaces());
-    const auto numNeighborFacesVertex1 =
-    static_cast< double >( storage->getVertex( face->neighborVertices().at( 1 ))->getNumNeighborFaces());
-    const auto numNeighborFacesVertex2 =
-    static_cast< double >( storage->getVertex( face->neighborVertices().at( 2 ))->getNumNeighborFaces());
-
-    vertexdof::macroface::generated::restrict_2D_macroface_P1_pull_additive( dstData,
-                                                                             srcData,
-                                                                             static_cast< int32_t >( destinationLevel ),
-                                                                             numNeighborFacesEdge0,
-                                                                             numNeighborFacesEdge1,
-                                                                             numNeighborFacesEdge2,
-                                                                             numNeighborFacesVertex0,
-                                                                             numNeighborFacesVertex1,
-                                                                             numNeighborFacesVertex2 );
+    if constexpr ( std::is_same< ValueType, double >::value )
+    {
+      const auto numNeighborFacesEdge0 =
+      static_cast< double >( storage->getEdge( face->neighborEdges().at( 0 ))->getNumNeighborFaces());
+      const auto numNeighborFacesEdge1 =
+      static_cast< double >( storage->getEdge( face->neighborEdges().at( 1 ))->getNumNeighborFaces());
+      const auto numNeighborFacesEdge2 =
+      static_cast< double >( storage->getEdge( face->neighborEdges().at( 2 ))->getNumNeighborFaces());
+      const auto numNeighborFacesVertex0 =
+      static_cast< double >( storage->getVertex( face->neighborVertices().at( 0 ))->getNumNeighborFaces());
+      const auto numNeighborFacesVertex1 =
+      static_cast< double >( storage->getVertex( face->neighborVertices().at( 1 ))->getNumNeighborFaces());
+      const auto numNeighborFacesVertex2 =
+      static_cast< double >( storage->getVertex( face->neighborVertices().at( 2 ))->getNumNeighborFaces());
+
+      vertexdof::macroface::generated::restrict_2D_macroface_P1_pull_additive( dstData,
+                                                                               srcData,
+                                                                               static_cast< int32_t >( destinationLevel ),
+                                                                               numNeighborFacesEdge0,
+                                                                               numNeighborFacesEdge1,
+                                                                               numNeighborFacesEdge2,
+                                                                               numNeighborFacesVertex0,
+                                                                               numNeighborFacesVertex1,
+                                                                               numNeighborFacesVertex2 );
+    }
+    else
+    {
+      // generic kernel for the value types that are not supported by the generated kernel
+      std::array< real_t, 3 > invNumNeighborsOfVertex;
+      std::array< real_t, 3 > invNumNeighborsOfEdge;
+      for ( uint_t i = 0; i < 3; i++ )
+      {
+        invNumNeighborsOfVertex[i] = real_c( 1 ) / real_c( storage->getVertex( face->neighborVertices().at( i ) )->getNumNeighborFaces() );
+        invNumNeighborsOfEdge[i]   = real_c( 1 ) / real_c( storage->getEdge( face->neighborEdges().at( i ) )->getNumNeighborFaces() );
+      }
+
+      for ( const auto & dstIdx : vertexdof::macroface::Iterator( destinationLevel ) )
+      {
+        const int srcX = 2 * int_c( dstIdx.x() );
+        const int srcY = 2 * int_c( dstIdx.y() );
+
+        real_t tmp = inverseNumNeighborFacesOfMicroVertex( invNumNeighborsOfVertex, invNumNeighborsOfEdge, srcX, srcY, sourceLevel ) *
+                     srcData[vertexdof::macroface::index( sourceLevel, uint_c( srcX ), uint_c( srcY ) )];
+
+        // leaves outside of the macro-face do not contribute
+        for ( const auto & dir : vertexdof::macroface::neighborsWithoutCenter )
+        {
+          const auto increment = vertexdof::logicalIndexOffsetFromVertex( dir );
+          const int  leafX     = srcX + increment.x();
+          const int  leafY     = srcY + increment.y();
+          const auto invFactor =
+              inverseNumNeighborFacesOfMicroVertex( invNumNeighborsOfVertex, invNumNeighborsOfEdge, leafX, leafY, sourceLevel );
+          if ( invFactor > real_c( 0 ) )
+          {
+            tmp += 0.5 * invFactor * srcData[vertexdof::macroface::index( sourceLevel, uint_c( leafX ), uint_c( leafY ) )];
+          }
+        }
+
+        dstData[vertexdof::macroface::index( destinationLevel, dstIdx.x(), dstIdx.y() )] = static_cast< ValueType >( tmp );
+      }
+    }
   }
 
-  function.communicateAdditively< Face, Edge >( destinationLevel, excludeFlag, *storage );
-  function.communicateAdditively< Face, Vertex >( destinationLevel, excludeFlag, *storage );
+  function.template communicateAdditively< Face, Edge >( destinationLevel, excludeFlag, *storage );
+  function.template communicateAdditively< Face, Vertex >( destinationLevel, excludeFlag, *storage );
 }
 
-void P1toP1LinearRestriction::restrict3D( const P1Function< real_t >& function,
-                                          const uint_t&               sourceLevel,
-                                          const DoFType&              flag ) const
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::restrict3D( const P1Function< ValueType >& function,
+                                                              const uint_t&                  sourceLevel,
+                                                              const DoFType&                 flag ) const
 {
    /// XOR flag with all to get the DoFTypes that should be excluded
   const DoFType excludeFlag = (flag ^ All);
 
   const uint_t destinationLevel = sourceLevel - 1;
 
-  function.communicate< Vertex, Edge >  ( sourceLevel );
-  function.communicate< Edge,   Face >  ( sourceLevel );
-  function.communicate< Face,   Cell >  ( sourceLevel );
-
-  for ( const auto & cellIt : function.getStorage()->getCells() )
+  function.template communicate< Vertex, Edge >  ( sourceLevel );
+  function.template communicate< Edge,   Face >  ( sourceLevel );
+  function.template communicate< Face,   Cell >  ( sourceLevel );
+
+  // The macro-cells only write to their own memory. If there are at least as many macro-cells as threads, they are
+  // distributed among the threads and processed by the generated kernel. Otherwise, the threads share the slabs of
+  // one macro-cell after the other.
+  const std::vector< PrimitiveID > cellIDs          = function.getStorage()->getCellIDs();
+  const bool                       threadMacroCells = int_c( cellIDs.size() ) >= OpenMPManager::instance()->numThreads();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared ) if ( threadMacroCells )
+#endif
+  for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
   {
-    const auto cell = cellIt.second;
+    const auto cell = function.getStorage()->getCell( cellIDs[walberla::uint_c( i )] );
     const auto srcData = cell->getData( function.getCellDataID())->getPointer( sourceLevel );
     auto dstData = cell->getData( function.getCellDataID())->getPointer( destinationLevel );
 
-    if ( globalDefines::useGeneratedKernels )
+    if ( std::is_same< ValueType, double >::value && globalDefines::useGeneratedKernels && threadMacroCells )
     {
-       auto storage = function.getStorage();
-
-       const double numNeighborCellsFace0 =
-           static_cast< double >( storage->getFace( cell->neighborFaces().at( 0 ) )->getNumNeighborCells() );
-       const double numNeighborCellsFace1 =
-           static_cast< double >( storage->getFace( cell->neighborFaces().at( 1 ) )->getNumNeighborCells() );
-       const double numNeighborCellsFace2 =
-           static_cast< double >( storage->getFace( cell->neighborFaces().at( 2 ) )->getNumNeighborCells() );
-       const double numNeighborCellsFace3 =
-           static_cast< double >( storage->getFace( cell->neighborFaces().at( 3 ) )->getNumNeighborCells() );
-
-       const double numNeighborCellsEdge0 =
-           static_cast< double >( storage->getEdge( cell->neighborEdges().at( 0 ) )->getNumNeighborCells() );
-       const double numNeighborCellsEdge1 =
-           static_cast< double >( storage->getEdge( cell->neighborEdges().at( 1 ) )->getNumNeighborCells() );
-       const double numNeighborCellsEdge2 =
-           static_cast< double >( storage->getEdge( cell->neighborEdges().at( 2 ) )->getNumNeighborCells() );
-       const double numNeighborCellsEdge3 =
-           static_cast< double >( storage->getEdge( cell->neighborEdges().at( 3 ) )->getNumNeighborCells() );
-       const double numNeighborCellsEdge4 =
-           static_cast< double >( storage->getEdge( cell->neighborEdges().at( 4 ) )->getNumNeighborCells() );
-       const double numNeighborCellsEdge5 =
-           static_cast< double >( storage->getEdge( cell->neighborEdges().at( 5 ) )->getNumNeighborCells() );
-
-       const double numNeighborCellsVertex0 =
-           static_cast< double >( storage->getVertex( cell->neighborVertices().at( 0 ) )->getNumNeighborCells() );
-       const double numNeighborCellsVertex1 =
-           static_cast< double >( storage->getVertex( cell->neighborVertices().at( 1 ) )->getNumNeighborCells() );
-       const double numNeighborCellsVertex2 =
-           static_cast< double >( storage->getVertex( cell->neighborVertices().at( 2 ) )->getNumNeighborCells() );
-       const double numNeighborCellsVertex3 =
-           static_cast< double >( storage->getVertex( cell->neighborVertices().at( 3 ) )->getNumNeighborCells() );
-
-       vertexdof::macrocell::generated::restrict_3D_macrocell_P1_pull_additive( dstData,
-                                                                                srcData,
-                                                                                static_cast< int32_t >( destinationLevel ),
-                                                                                numNeighborCellsEdge0,
-                                                                                numNeighborCellsEdge1,
-                                                                                numNeighborCellsEdge2,
-                                                                                numNeighborCellsEdge3,
-                                                                                numNeighborCellsEdge4,
-                                                                                numNeighborCellsEdge5,
-                                                                                numNeighborCellsFace0,
-                                                                                numNeighborCellsFace1,
-                                                                                numNeighborCellsFace2,
-                                                                                numNeighborCellsFace3,
-                                                                                numNeighborCellsVertex0,
-                                                                                numNeighborCellsVertex1,
-                                                                                numNeighborCellsVertex2,
-                                                                                numNeighborCellsVertex3 );
+       // the generated kernel is only available for double precision
+       if constexpr ( std::is_same< ValueType, double >::value )
+       {
+          auto storage = function.getStorage();
+
+          const double numNeighborCellsFace0 =
+              static_cast< double >( storage->getFace( cell->neighborFaces().at( 0 ) )->getNumNeighborCells() );
+          const double numNeighborCellsFace1 =
+              static_cast< double >( storage->getFace( cell->neighborFaces().at( 1 ) )->getNumNeighborCells() );
+          const double numNeighborCellsFace2 =
+              static_cast< double >( storage->getFace( cell->neighborFaces().at( 2 ) )->getNumNeighborCells() );
+          const double numNeighborCellsFace3 =
+              static_cast< double >( storage->getFace( cell->neighborFaces().at( 3 ) )->getNumNeighborCells() );
+
+          const double numNeighborCellsEdge0 =
+              static_cast< double >( storage->getEdge( cell->neighborEdges().at( 0 ) )->getNumNeighborCells() );
+          const double numNeighborCellsEdge1 =
+              static_cast< double >( storage->getEdge( cell->neighborEdges().at( 1 ) )->getNumNeighborCells() );
+          const double numNeighborCellsEdge2 =
+              static_cast< double >( storage->getEdge( cell->neighborEdges().at( 2 ) )->getNumNeighborCells() );
+          const double numNeighborCellsEdge3 =
+              static_cast< double >( storage->getEdge( cell->neighborEdges().at( 3 ) )->getNumNeighborCells() );
+          const double numNeighborCellsEdge4 =
+              static_cast< double >( storage->getEdge( cell->neighborEdges().at( 4 ) )->getNumNeighborCells() );
+          const double numNeighborCellsEdge5 =
+              static_cast< double >( storage->getEdge( cell->neighborEdges().at( 5 ) )->getNumNeighborCells() );
+
+          const double numNeighborCellsVertex0 =
+              static_cast< double >( storage->getVertex( cell->neighborVertices().at( 0 ) )->getNumNeighborCells() );
+          const double numNeighborCellsVertex1 =
+              static_cast< double >( storage->getVertex( cell->neighborVertices().at( 1 ) )->getNumNeighborCells() );
+          const double numNeighborCellsVertex2 =
+              static_cast< double >( storage->getVertex( cell->neighborVertices().at( 2 ) )->getNumNeighborCells() );
+          const double numNeighborCellsVertex3 =
+              static_cast< double >( storage->getVertex( cell->neighborVertices().at( 3 ) )->getNumNeighborCells() );
+
+          vertexdof::macrocell::generated::restrict_3D_macrocell_P1_pull_additive( dstData,
+                                                                                   srcData,
+                                                                                   static_cast< int32_t >( destinationLevel ),
+                                                                                   numNeighborCellsEdge0,
+                                                                                   numNeighborCellsEdge1,
+                                                                                   numNeighborCellsEdge2,
+                                                                                   numNeighborCellsEdge3,
+                                                                                   numNeighborCellsEdge4,
+                                                                                   numNeighborCellsEdge5,
+                                                                                   numNeighborCellsFace0,
+                                                                                   numNeighborCellsFace1,
+                                                                                   numNeighborCellsFace2,
+                                                                                   numNeighborCellsFace3,
+                                                                                   numNeighborCellsVertex0,
+                                                                                   numNeighborCellsVertex1,
+                                                                                   numNeighborCellsVertex2,
+                                                                                   numNeighborCellsVertex3 );
+       }
     }
 
     else
@@ -256,73 +347,435 @@ void P1toP1LinearRestriction::restrict3D( const P1Function< real_t >& function,
         invNumNeighborsOfFace[cell->getLocalFaceID( neighborFaceID )] = real_c( 1 ) / real_c( function.getStorage()->getFace( neighborFaceID )->getNumNeighborCells());
       }
 
-      for ( const auto & dstIdx : vertexdof::macrocell::Iterator( destinationLevel ))
+      // Each coarse micro-vertex is written exactly once, so the coarse slabs can be processed concurrently.
+      const uint_t numSlabs = levelinfo::num_microvertices_per_edge( destinationLevel );
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared ) if ( !threadMacroCells )
+#endif
+      for ( int slab = 0; slab < int_c( numSlabs ); slab++ )
       {
-        const auto srcIdx = dstIdx * 2;
-        const auto arrayIdxDst = vertexdof::macrocell::index( destinationLevel, dstIdx.x(), dstIdx.y(), dstIdx.z());
-        const auto arrayIdxSrcCenter = vertexdof::macrocell::index( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z());
+        const uint_t z = uint_c( slab );
+        for ( uint_t y = 0; y < numSlabs - z; y++ )
+        {
+          for ( uint_t x = 0; x < numSlabs - z - y; x++ )
+          {
+            const indexing::Index dstIdx( x, y, z );
+            const auto srcIdx = dstIdx * 2;
+            const auto arrayIdxDst = vertexdof::macrocell::index( destinationLevel, x, y, z );
+            const auto arrayIdxSrcCenter = vertexdof::macrocell::index( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z());
+
+            if ( x > 0 && y > 0 && z > 0 && x + y + z < numSlabs - 1 )
+            {
+              // inner points do not need any scaling
+              real_t tmp = srcData[arrayIdxSrcCenter];
+              for ( const auto & dir : vertexdof::macrocell::neighborsWithoutCenter )
+              {
+                const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
+                tmp += 0.5 * srcData[arrayIdxSrcDir];
+              }
+              dstData[arrayIdxDst] = static_cast< ValueType >( tmp );
+              continue;
+            }
+
+            // points on the macro-cell boundary are scaled by the number of neighboring macro-cells
+            const auto onCellVertices = vertexdof::macrocell::isOnCellVertex( dstIdx, destinationLevel );
+            const auto onCellEdges = vertexdof::macrocell::isOnCellEdge( dstIdx, destinationLevel );
+            const auto onCellFaces = vertexdof::macrocell::isOnCellFace( dstIdx, destinationLevel );
+
+            // add center with weight one and scale depending on location of dst unknown
+            const auto invFactorToScaleContributionCenter = calculateInverseFactorToScaleNeighborhoodContribution(
+                invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace, dstIdx, destinationLevel );
+
+            real_t tmp = invFactorToScaleContributionCenter * srcData[arrayIdxSrcCenter];
+
+            // add leaves with weight .5 and scale depending on location of dst unknown
+            if ( onCellVertices.size() > 0 )
+            {
+              WALBERLA_ASSERT_EQUAL( onCellVertices.size(), 1 );
+              const auto localVertexID = *onCellVertices.begin();
+
+              for ( const auto & dir : vertexdof::macrocell::neighborsOnVertexWithoutCenter[localVertexID] )
+              {
+                const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
+                tmp += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
+              }
+            } else if ( onCellEdges.size() > 0 )
+            {
+              WALBERLA_ASSERT_EQUAL( onCellEdges.size(), 1 );
+              const auto localEdgeID = *onCellEdges.begin();
+
+              for ( const auto & dir : vertexdof::macrocell::neighborsOnEdgeWithoutCenter[localEdgeID] )
+              {
+                const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
+                tmp += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
+              }
+            } else if ( onCellFaces.size() > 0 )
+            {
+              WALBERLA_ASSERT_EQUAL( onCellFaces.size(), 1 );
+              const auto localFaceID = *onCellFaces.begin();
+
+              for ( const auto & dir : vertexdof::macrocell::neighborsOnFaceWithoutCenter[localFaceID] )
+              {
+                const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
+                tmp += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
+              }
+            }
+
+            dstData[arrayIdxDst] = static_cast< ValueType >( tmp );
+          }
+        }
+      }
+    }
+  }
 
-        const auto onCellVertices = vertexdof::macrocell::isOnCellVertex( dstIdx, destinationLevel );
-        const auto onCellEdges = vertexdof::macrocell::isOnCellEdge( dstIdx, destinationLevel );
-        const auto onCellFaces = vertexdof::macrocell::isOnCellFace( dstIdx, destinationLevel );
+  function.template communicateAdditively< Cell, Vertex >( destinationLevel, excludeFlag, *function.getStorage() );
+  function.template communicateAdditively< Cell, Edge >( destinationLevel, excludeFlag, *function.getStorage() );
+  function.template communicateAdditively< Cell, Face >( destinationLevel, excludeFlag, *function.getStorage() );
+}
 
-        // add center with weight one and scale depending on location of dst unknown
-        const auto invFactorToScaleContributionCenter = calculateInverseFactorToScaleNeighborhoodContribution( invNumNeighborsOfVertex, invNumNeighborsOfEdge, invNumNeighborsOfFace,
-                                                                                                               dstIdx, destinationLevel );
 
-        dstData[arrayIdxDst] = invFactorToScaleContributionCenter * srcData[arrayIdxSrcCenter];
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::computeAndRestrictResidual(
+    const PrimitiveDataID< StencilMemory< ValueType >, Vertex >&                          vertexStencilID,
+    const PrimitiveDataID< StencilMemory< ValueType >, Edge >&                            edgeStencilID,
+    const PrimitiveDataID< StencilMemory< ValueType >, Face >&                            faceStencilID,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face >& faceStencil3DID,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&  cellStencilID,
+    const P1Function< ValueType >&                                                        x,
+    const P1Function< ValueType >&                                                        b,
+    const P1Function< ValueType >&                                                        tmp,
+    const uint_t&                                                                         sourceLevel,
+    const DoFType&                                                                        flag ) const
+{
+  if ( tmp.isDummy() )
+    return;
 
-        // add leaves with weight .5 and scale depending on location of dst unknown
-        if ( onCellVertices.size() > 0 )
-        {
-          WALBERLA_ASSERT_EQUAL( onCellVertices.size(), 1 );
-          const auto localVertexID = *onCellVertices.begin();
+  const auto storage           = tmp.getStorage();
+  const auto & boundaryCondition = tmp.getBoundaryCondition();
 
-          for ( const auto & dir : vertexdof::macrocell::neighborsOnVertexWithoutCenter[localVertexID] )
-          {
-            const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
-            dstData[arrayIdxDst] += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
-          }
-        } else if ( onCellEdges.size() > 0 )
-        {
-          WALBERLA_ASSERT_EQUAL( onCellEdges.size(), 1 );
-          const auto localEdgeID = *onCellEdges.begin();
+  x.template communicate< Vertex, Edge >( sourceLevel );
+  x.template communicate< Edge, Face >( sourceLevel );
+  x.template communicate< Face, Cell >( sourceLevel );
 
-          for ( const auto & dir : vertexdof::macrocell::neighborsOnEdgeWithoutCenter[localEdgeID] )
-          {
-            const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
-            dstData[arrayIdxDst] += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
-          }
-        } else if ( onCellFaces.size() > 0 )
+  x.template communicate< Cell, Face >( sourceLevel );
+  x.template communicate< Face, Edge >( sourceLevel );
+  x.template communicate< Edge, Vertex >( sourceLevel );
+
+  // The residual on the lower-dimensional primitives is computed explicitly, since these
+  // unknowns are shared by several macro-faces (2D) or macro-cells (3D).
+  for ( const auto & it : storage->getVertices() )
+  {
+    Vertex & vertex = *it.second;
+    if ( testFlag( boundaryCondition.getBoundaryType( vertex.getMeshBoundaryFlag() ), flag ) )
+    {
+      vertexdof::macrovertex::apply< ValueType >( vertex, vertexStencilID, x.getVertexDataID(), tmp.getVertexDataID(), sourceLevel, Replace );
+      vertexdof::macrovertex::assign< ValueType >( vertex, { 1.0, -1.0 }, { b.getVertexDataID(), tmp.getVertexDataID() }, tmp.getVertexDataID(), sourceLevel );
+    }
+  }
+
+  for ( const auto & it : storage->getEdges() )
+  {
+    Edge & edge = *it.second;
+    if ( testFlag( boundaryCondition.getBoundaryType( edge.getMeshBoundaryFlag() ), flag ) )
+    {
+      vertexdof::macroedge::apply< ValueType >( sourceLevel, edge, edgeStencilID, x.getEdgeDataID(), tmp.getEdgeDataID(), Replace );
+      vertexdof::macroedge::assign< ValueType >( sourceLevel, edge, { 1.0, -1.0 }, { b.getEdgeDataID(), tmp.getEdgeDataID() }, tmp.getEdgeDataID() );
+    }
+  }
+
+  if ( storage->hasGlobalCells() )
+  {
+    if ( sourceLevel >= 2 )
+    {
+      for ( const auto & it : storage->getFaces() )
+      {
+        Face & face = *it.second;
+        if ( testFlag( boundaryCondition.getBoundaryType( face.getMeshBoundaryFlag() ), flag ) )
         {
-          WALBERLA_ASSERT_EQUAL( onCellFaces.size(), 1 );
-          const auto localFaceID = *onCellFaces.begin();
+          vertexdof::macroface::apply3D< ValueType >( sourceLevel, face, *storage, faceStencil3DID, x.getFaceDataID(), tmp.getFaceDataID(), Replace );
+          vertexdof::macroface::assign< ValueType >( sourceLevel, face, { 1.0, -1.0 }, { b.getFaceDataID(), tmp.getFaceDataID() }, tmp.getFaceDataID() );
+        }
+      }
+    }
+    computeAndRestrictResidual3D( cellStencilID, x, b, tmp, sourceLevel, flag );
+  }
+  else
+  {
+    computeAndRestrictResidual2D( faceStencilID, x, b, tmp, sourceLevel, flag );
+  }
+}
+
+/// Returns the coarse micro-edge that has the fine micro-vertex with the passed parity (x, y, z) as midpoint.
+/// The parity is encoded as 4 * ( x % 2 ) + 2 * ( y % 2 ) + ( z % 2 ), the fine micro-vertex p then contributes
+/// to the coarse micro-vertices ( p - d ) / 2 and ( p + d ) / 2 with d being the returned direction.
+static constexpr std::array< std::array< int, 3 >, 8 > coarseEdgeDirection3D = { { { 0, 0, 0 },
+                                                                                   { 0, 0, 1 },
+                                                                                   { 0, 1, 0 },
+                                                                                   { 0, 1, -1 },
+                                                                                   { 1, 0, 0 },
+                                                                                   { 1, 0, -1 },
+                                                                                   { 1, -1, 0 },
+                                                                                   { 1, -1, 1 } } };
+
+/// 2D counterpart of coarseEdgeDirection3D, the parity is encoded as 2 * ( x % 2 ) + ( y % 2 ).
+static constexpr std::array< std::array< int, 2 >, 4 > coarseEdgeDirection2D = { { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, -1 } } };
+
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::computeAndRestrictResidual2D(
+    const PrimitiveDataID< StencilMemory< ValueType >, Face >& faceStencilID,
+    const P1Function< ValueType >&                             x,
+    const P1Function< ValueType >&                             b,
+    const P1Function< ValueType >&                             tmp,
+    const uint_t&                                              sourceLevel,
+    const DoFType&                                             flag ) const
+{
+  /// XOR flag with all to get the DoFTypes that should be excluded
+  const DoFType excludeFlag = (flag ^ All);
+
+  const uint_t destinationLevel = sourceLevel - 1;
+  const auto   storage          = tmp.getStorage();
+
+  tmp.template communicate< Vertex, Edge >( sourceLevel );
+  tmp.template communicate< Edge, Face >( sourceLevel );
 
-          for ( const auto & dir : vertexdof::macrocell::neighborsOnFaceWithoutCenter[localFaceID] )
+  const int maxIdx = int_c( levelinfo::num_microvertices_per_edge( sourceLevel ) ) - 1;
+
+  for ( const auto & faceIt : storage->getFaces() )
+  {
+    const auto face = faceIt.second;
+
+    const ValueType * xData   = face->getData( x.getFaceDataID() )->getPointer( sourceLevel );
+    const ValueType * bData   = face->getData( b.getFaceDataID() )->getPointer( sourceLevel );
+    const ValueType * rData   = face->getData( tmp.getFaceDataID() )->getPointer( sourceLevel );
+    ValueType *       dstData = face->getData( tmp.getFaceDataID() )->getPointer( destinationLevel );
+
+    const ValueType * stencil = face->getData( faceStencilID )->getPointer( sourceLevel );
+    std::array< real_t, 7 >           weights;
+    std::array< stencilDirection, 7 > directions;
+    for ( uint_t i = 0; i < weights.size(); i++ )
+    {
+      directions[i] = vertexdof::macroface::neighborsWithCenter[i];
+      weights[i]    = stencil[vertexdof::stencilIndexFromVertex( directions[i] )];
+    }
+
+    // Scaling of the fine residual depending on the macro-primitive the fine micro-vertex is located on,
+    // as in the generated restriction kernel.
+    std::array< real_t, 3 > invNumNeighborsOfVertex;
+    std::array< real_t, 3 > invNumNeighborsOfEdge;
+    for ( uint_t i = 0; i < 3; i++ )
+    {
+      invNumNeighborsOfVertex[i] = real_c( 1 ) / real_c( storage->getVertex( face->neighborVertices().at( i ) )->getNumNeighborFaces() );
+      invNumNeighborsOfEdge[i]   = real_c( 1 ) / real_c( storage->getEdge( face->neighborEdges().at( i ) )->getNumNeighborFaces() );
+    }
+
+    std::fill( dstData, dstData + levelinfo::num_microvertices_per_face( destinationLevel ), ValueType( 0 ) );
+
+    // Each fine micro-vertex is visited once. Its residual is either read from tmp (macro-face boundary)
+    // or computed on the fly (interior) and then pushed to the one or two coarse micro-vertices it contributes to.
+    // The fine rows 2g and 2g + 1 only write to the coarse rows g and g + 1, so every other pair of rows
+    // can be processed in parallel.
+    const int numRowPairs = maxIdx / 2 + 1;
+    for ( int phase = 0; phase < 2; phase++ )
+    {
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+      for ( int pair = phase; pair < numRowPairs; pair += 2 )
+      {
+        for ( int fineY = 2 * pair; fineY <= std::min( 2 * pair + 1, maxIdx ); fineY++ )
+        {
+          for ( int fineX = 0; fineX <= maxIdx - fineY; fineX++ )
           {
-            const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
-            dstData[arrayIdxDst] += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
+            const uint_t arrayIdx = vertexdof::macroface::index( sourceLevel, uint_c( fineX ), uint_c( fineY ) );
+
+            real_t residual;
+            real_t scaling = real_c( 1 );
+
+            if ( fineX == 0 || fineY == 0 || fineX + fineY == maxIdx )
+            {
+              residual = rData[arrayIdx];
+              if ( fineX == 0 && fineY == 0 )
+                scaling = invNumNeighborsOfVertex[0];
+              else if ( fineX == maxIdx )
+                scaling = invNumNeighborsOfVertex[1];
+              else if ( fineY == maxIdx )
+                scaling = invNumNeighborsOfVertex[2];
+              else if ( fineY == 0 )
+                scaling = invNumNeighborsOfEdge[0];
+              else if ( fineX == 0 )
+                scaling = invNumNeighborsOfEdge[1];
+              else
+                scaling = invNumNeighborsOfEdge[2];
+            }
+            else
+            {
+              residual = bData[arrayIdx];
+              for ( uint_t i = 0; i < weights.size(); i++ )
+              {
+                residual -= weights[i] * xData[vertexdof::macroface::indexFromVertex( sourceLevel, uint_c( fineX ), uint_c( fineY ), directions[i] )];
+              }
+            }
+
+            const auto & d = coarseEdgeDirection2D[uint_c( 2 * ( fineX % 2 ) + ( fineY % 2 ) )];
+            if ( d[0] == 0 && d[1] == 0 )
+            {
+              dstData[vertexdof::macroface::index( destinationLevel, uint_c( fineX / 2 ), uint_c( fineY / 2 ) )] +=
+                  static_cast< ValueType >( scaling * residual );
+            }
+            else
+            {
+              dstData[vertexdof::macroface::index( destinationLevel, uint_c( ( fineX - d[0] ) / 2 ), uint_c( ( fineY - d[1] ) / 2 ) )] +=
+                  static_cast< ValueType >( 0.5 * scaling * residual );
+              dstData[vertexdof::macroface::index( destinationLevel, uint_c( ( fineX + d[0] ) / 2 ), uint_c( ( fineY + d[1] ) / 2 ) )] +=
+                  static_cast< ValueType >( 0.5 * scaling * residual );
+            }
           }
-        } else
+        }
+      }
+    }
+  }
+
+  tmp.template communicateAdditively< Face, Edge >( destinationLevel, excludeFlag, *storage );
+  tmp.template communicateAdditively< Face, Vertex >( destinationLevel, excludeFlag, *storage );
+}
+
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::computeAndRestrictResidual3D(
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >& cellStencilID,
+    const P1Function< ValueType >&                                                       x,
+    const P1Function< ValueType >&                                                       b,
+    const P1Function< ValueType >&                                                       tmp,
+    const uint_t&                                                                        sourceLevel,
+    const DoFType&                                                                       flag ) const
+{
+  /// XOR flag with all to get the DoFTypes that should be excluded
+  const DoFType excludeFlag = (flag ^ All);
+
+  const uint_t destinationLevel = sourceLevel - 1;
+  const auto   storage          = tmp.getStorage();
+
+  tmp.template communicate< Vertex, Edge >( sourceLevel );
+  tmp.template communicate< Edge, Face >( sourceLevel );
+  tmp.template communicate< Face, Cell >( sourceLevel );
+
+  const int maxIdx = int_c( levelinfo::num_microvertices_per_edge( sourceLevel ) ) - 1;
+
+  for ( const auto & cellIt : storage->getCells() )
+  {
+    const auto cell = cellIt.second;
+
+    const ValueType * xData   = cell->getData( x.getCellDataID() )->getPointer( sourceLevel );
+    const ValueType * bData   = cell->getData( b.getCellDataID() )->getPointer( sourceLevel );
+    const ValueType * rData   = cell->getData( tmp.getCellDataID() )->getPointer( sourceLevel );
+    ValueType *       dstData = cell->getData( tmp.getCellDataID() )->getPointer( destinationLevel );
+
+    const auto & stencil = cell->getData( cellStencilID )->getData( sourceLevel );
+    std::array< real_t, vertexdof::macrocell::stencilSize >                   weights;
+    std::array< indexing::IndexIncrement, vertexdof::macrocell::stencilSize > offsets;
+    for ( uint_t i = 0; i < weights.size(); i++ )
+    {
+      offsets[i] = vertexdof::logicalIndexOffsetFromVertex( vertexdof::macrocell::neighborsWithCenter[i] );
+      weights[i] = stencil.at( offsets[i] );
+    }
+
+    // Scaling of the fine residual depending on the macro-primitive the fine micro-vertex is located on,
+    // as in the generated restriction kernel.
+    std::array< real_t, 4 > invNumNeighborsOfVertex;
+    std::array< real_t, 6 > invNumNeighborsOfEdge;
+    std::array< real_t, 4 > invNumNeighborsOfFace;
+
+    for ( const auto & neighborVertexID : cell->neighborVertices())
+    {
+      invNumNeighborsOfVertex[cell->getLocalVertexID( neighborVertexID )] = real_c( 1 ) / real_c( storage->getVertex( neighborVertexID )->getNumNeighborCells());
+    }
+    for ( const auto & neighborEdgeID : cell->neighborEdges())
+    {
+      invNumNeighborsOfEdge[cell->getLocalEdgeID( neighborEdgeID )] = real_c( 1 ) / real_c( storage->getEdge( neighborEdgeID )->getNumNeighborCells());
+    }
+    for ( const auto & neighborFaceID : cell->neighborFaces())
+    {
+      invNumNeighborsOfFace[cell->getLocalFaceID( neighborFaceID )] = real_c( 1 ) / real_c( storage->getFace( neighborFaceID )->getNumNeighborCells());
+    }
+
+    std::fill( dstData, dstData + levelinfo::num_microvertices_per_cell( destinationLevel ), ValueType( 0 ) );
+
+    // Each fine micro-vertex is visited once. Its residual is either read from tmp (macro-cell boundary)
+    // or computed on the fly (interior) and then pushed to the one or two coarse micro-vertices it contributes to.
+    // The fine slabs 2g and 2g + 1 only write to the coarse slabs g and g + 1, so every other pair of slabs
+    // can be processed in parallel.
+    const int numSlabPairs = maxIdx / 2 + 1;
+    for ( int phase = 0; phase < 2; phase++ )
+    {
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+      for ( int pair = phase; pair < numSlabPairs; pair += 2 )
+      {
+        for ( int fineZ = 2 * pair; fineZ <= std::min( 2 * pair + 1, maxIdx ); fineZ++ )
         {
-          for ( const auto & dir : vertexdof::macrocell::neighborsWithoutCenter )
+          for ( int fineY = 0; fineY <= maxIdx - fineZ; fineY++ )
           {
-            const auto arrayIdxSrcDir = vertexdof::macrocell::indexFromVertex( sourceLevel, srcIdx.x(), srcIdx.y(), srcIdx.z(), dir );
-            dstData[arrayIdxDst] += 0.5 * invFactorToScaleContributionCenter * srcData[arrayIdxSrcDir];
+            for ( int fineX = 0; fineX <= maxIdx - fineZ - fineY; fineX++ )
+            {
+              const uint_t arrayIdx = vertexdof::macrocell::index( sourceLevel, uint_c( fineX ), uint_c( fineY ), uint_c( fineZ ) );
+
+              real_t residual;
+              real_t scaling = real_c( 1 );
+
+              if ( fineX == 0 || fineY == 0 || fineZ == 0 || fineX + fineY + fineZ == maxIdx )
+              {
+                residual = rData[arrayIdx];
+                scaling  = calculateInverseFactorToScaleNeighborhoodContribution( invNumNeighborsOfVertex,
+                                                                                 invNumNeighborsOfEdge,
+                                                                                 invNumNeighborsOfFace,
+                                                                                 indexing::Index( uint_c( fineX ), uint_c( fineY ), uint_c( fineZ ) ),
+                                                                                 sourceLevel );
+              }
+              else
+              {
+                residual = bData[arrayIdx];
+                for ( uint_t i = 0; i < weights.size(); i++ )
+                {
+                  residual -= weights[i] * xData[vertexdof::macrocell::index( sourceLevel,
+                                                                              uint_c( fineX + offsets[i].x() ),
+                                                                              uint_c( fineY + offsets[i].y() ),
+                                                                              uint_c( fineZ + offsets[i].z() ) )];
+                }
+              }
+
+              const auto & d = coarseEdgeDirection3D[uint_c( 4 * ( fineX % 2 ) + 2 * ( fineY % 2 ) + ( fineZ % 2 ) )];
+              if ( d[0] == 0 && d[1] == 0 && d[2] == 0 )
+              {
+                dstData[vertexdof::macrocell::index( destinationLevel, uint_c( fineX / 2 ), uint_c( fineY / 2 ), uint_c( fineZ / 2 ) )] +=
+                    static_cast< ValueType >( scaling * residual );
+              }
+              else
+              {
+                dstData[vertexdof::macrocell::index( destinationLevel,
+                                                     uint_c( ( fineX - d[0] ) / 2 ),
+                                                     uint_c( ( fineY - d[1] ) / 2 ),
+                                                     uint_c( ( fineZ - d[2] ) / 2 ) )] += static_cast< ValueType >( 0.5 * scaling * residual );
+                dstData[vertexdof::macrocell::index( destinationLevel,
+                                                     uint_c( ( fineX + d[0] ) / 2 ),
+                                                     uint_c( ( fineY + d[1] ) / 2 ),
+                                                     uint_c( ( fineZ + d[2] ) / 2 ) )] += static_cast< ValueType >( 0.5 * scaling * residual );
+              }
+            }
           }
         }
       }
     }
   }
 
-  function.communicateAdditively< Cell, Vertex >( destinationLevel, excludeFlag, *function.getStorage() );
-  function.communicateAdditively< Cell, Edge >( destinationLevel, excludeFlag, *function.getStorage() );
-  function.communicateAdditively< Cell, Face >( destinationLevel, excludeFlag, *function.getStorage() );
+  tmp.template communicateAdditively< Cell, Vertex >( destinationLevel, excludeFlag, *storage );
+  tmp.template communicateAdditively< Cell, Edge >( destinationLevel, excludeFlag, *storage );
+  tmp.template communicateAdditively< Cell, Face >( destinationLevel, excludeFlag, *storage );
 }
 
 
-void P1toP1LinearRestriction::restrictMacroVertex( const real_t *src, real_t *dst, const uint_t & sourceLevel,
-                                                   const uint_t & numNeighborEdges ) const
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::restrictMacroVertex( const ValueType *src, ValueType *dst, const uint_t & sourceLevel,
+                                                                       const uint_t & numNeighborEdges ) const
 {
   WALBERLA_UNUSED( sourceLevel );
   dst[0] = src[0];
@@ -333,8 +786,9 @@ void P1toP1LinearRestriction::restrictMacroVertex( const real_t *src, real_t *ds
   }
 }
 
-void P1toP1LinearRestriction::restrictMacroEdge( const real_t *src, real_t *dst, const uint_t & sourceLevel,
-                                                 const uint_t & numNeighborFaces ) const
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::restrictMacroEdge( const ValueType *src, ValueType *dst, const uint_t & sourceLevel,
+                                                                     const uint_t & numNeighborFaces ) const
 {
   size_t rowsize_c = levelinfo::num_microvertices_per_edge( sourceLevel - 1 );
 
@@ -372,14 +826,15 @@ void P1toP1LinearRestriction::restrictMacroEdge( const real_t *src, real_t *dst,
   }
 }
 
-void P1toP1LinearRestriction::restrictMacroFace( const real_t *src, real_t *dst, const uint_t & sourceLevel,
-                                                 const uint_t & numNeighborCells ) const
+template < typename ValueType >
+void GenericP1toP1LinearRestriction< ValueType >::restrictMacroFace( const ValueType *src, ValueType *dst, const uint_t & sourceLevel,
+                                                                     const uint_t & numNeighborCells ) const
 {
   WALBERLA_UNUSED( numNeighborCells );
   uint_t N_c = levelinfo::num_microvertices_per_edge( sourceLevel - 1 );
   uint_t N_c_i = N_c;
 
-  real_t tmp;
+  ValueType tmp;
 
   for ( uint_t j = 1; j < N_c - 2; ++j )
   {
@@ -401,4 +856,7 @@ void P1toP1LinearRestriction::restrictMacroFace( const real_t *src, real_t *dst,
   }
 }
 
-}
\ No newline at end of file
+template class GenericP1toP1LinearRestriction< float >;
+template class GenericP1toP1LinearRestriction< double >;
+
+}
@@ -20,15 +20,25 @@
 
 #pragma once
 
+#include "hyteg/LevelWiseMemory.hpp"
+#include "hyteg/StencilMemory.hpp"
 #include "hyteg/gridtransferoperators/RestrictionOperator.hpp"
 #include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCellStencil.hpp"
 
 namespace hyteg {
 
-class P1toP1LinearRestriction : public RestrictionOperator< P1Function< real_t > >
+/// \brief Linear P1 restriction.
+///
+/// The operator is templated on the value type of the P1 functions, e.g. to restrict the single precision
+/// residuals of the MixedPrecisionSolver. The generated kernels are only available for double precision,
+/// all other value types are restricted with the generic kernels.
+template < typename ValueType = real_t >
+class GenericP1toP1LinearRestriction : public RestrictionOperator< P1Function< ValueType > >
 {
  public:
-   void restrict ( const P1Function< real_t > & function, const uint_t & sourceLevel, const DoFType & flag ) const override
+   void restrict ( const P1Function< ValueType > & function, const uint_t & sourceLevel, const DoFType & flag ) const override
    {
      if ( function.isDummy() )
        return;
@@ -43,18 +53,51 @@ class P1toP1LinearRestriction : public RestrictionOperator< P1Function< real_t >
      }
    }
 
+   /// Computes the residual b - Ax of a constant P1 stencil operator and restricts it in a single sweep.
+   ///
+   /// The restricted residual is written to tmp on level sourceLevel - 1, i.e. the result is the same as computing
+   /// the residual into tmp and calling restrict( tmp, sourceLevel, flag ).
+   /// The residual is only stored on the lower-dimensional macro-primitives of tmp on level sourceLevel, the residual
+   /// in the interior of the macro-faces (2D) or macro-cells (3D) is computed once per micro-vertex on the fly.
+   void computeAndRestrictResidual( const PrimitiveDataID< StencilMemory< ValueType >, Vertex >&                          vertexStencilID,
+                                    const PrimitiveDataID< StencilMemory< ValueType >, Edge >&                            edgeStencilID,
+                                    const PrimitiveDataID< StencilMemory< ValueType >, Face >&                            faceStencilID,
+                                    const PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face >& faceStencil3DID,
+                                    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&  cellStencilID,
+                                    const P1Function< ValueType >&                                                        x,
+                                    const P1Function< ValueType >&                                                        b,
+                                    const P1Function< ValueType >&                                                        tmp,
+                                    const uint_t&                                                                         sourceLevel,
+                                    const DoFType&                                                                        flag ) const;
+
  private:
 
-   void restrict2D( const P1Function< real_t >& function, const uint_t& sourceLevel, const DoFType& flag ) const;
-   void restrict2DAdditively( const P1Function< real_t >& function, const uint_t& sourceLevel, const DoFType& flag ) const;
+   void restrict2D( const P1Function< ValueType >& function, const uint_t& sourceLevel, const DoFType& flag ) const;
+   void restrict2DAdditively( const P1Function< ValueType >& function, const uint_t& sourceLevel, const DoFType& flag ) const;
+
+   void restrict3D( const P1Function< ValueType >& function, const uint_t& sourceLevel, const DoFType& flag ) const;
 
-   void restrict3D( const P1Function< real_t >& function, const uint_t& sourceLevel, const DoFType& flag ) const;
+   void computeAndRestrictResidual2D( const PrimitiveDataID< StencilMemory< ValueType >, Face >& faceStencilID,
+                                      const P1Function< ValueType >&                             x,
+                                      const P1Function< ValueType >&                             b,
+                                      const P1Function< ValueType >&                             tmp,
+                                      const uint_t&                                              sourceLevel,
+                                      const DoFType&                                             flag ) const;
 
-   void restrictMacroVertex( const real_t* src, real_t* dst, const uint_t& sourceLevel, const uint_t& numNeighborEdges ) const;
+   void computeAndRestrictResidual3D( const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >& cellStencilID,
+                                      const P1Function< ValueType >&                                                       x,
+                                      const P1Function< ValueType >&                                                       b,
+                                      const P1Function< ValueType >&                                                       tmp,
+                                      const uint_t&                                                                        sourceLevel,
+                                      const DoFType&                                                                       flag ) const;
 
-   void restrictMacroEdge( const real_t* src, real_t* dst, const uint_t& sourceLevel, const uint_t& numNeighborFaces ) const;
+   void restrictMacroVertex( const ValueType* src, ValueType* dst, const uint_t& sourceLevel, const uint_t& numNeighborEdges ) const;
 
-   void restrictMacroFace( const real_t* src, real_t* dst, const uint_t& sourceLevel, const uint_t& numNeighborCells ) const;
+   void restrictMacroEdge( const ValueType* src, ValueType* dst, const uint_t& sourceLevel, const uint_t& numNeighborFaces ) const;
+
+   void restrictMacroFace( const ValueType* src, ValueType* dst, const uint_t& sourceLevel, const uint_t& numNeighborCells ) const;
 };
 
+typedef GenericP1toP1LinearRestriction<> P1toP1LinearRestriction;
+
 } // namespace hyteg
\ No newline at end of file
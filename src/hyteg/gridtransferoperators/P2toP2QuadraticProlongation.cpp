@@ -84,9 +84,14 @@ void P2toP2QuadraticProlongation::prolongateAdditively( const P2Function< real_t
    function.communicate< Vertex, Edge >( coarseLevel );
    function.communicate< Edge, Face >( coarseLevel );
 
-   for ( const auto& faceIt : function.getStorage()->getFaces() )
+   // the macro-faces only write to their own memory and are therefore distributed among the threads
+   const std::vector< PrimitiveID > faceIDs = function.getStorage()->getFaceIDs();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int i = 0; i < int_c( faceIDs.size() ); i++ )
    {
-      const auto face = faceIt.second;
+      const auto face = function.getStorage()->getFace( faceIDs[uint_c( i )] );
 
       auto vertexFineData = face->getData( function.getVertexDoFFunction().getFaceDataID() )->getPointer( fineLevel );
       auto edgeFineData   = face->getData( function.getEdgeDoFFunction().getFaceDataID() )->getPointer( fineLevel );
@@ -237,9 +242,14 @@ void P2toP2QuadraticProlongation::prolongateAdditively3D( const P2Function< real
    function.communicate< Edge, Face >( coarseLevel );
    function.communicate< Face, Cell >( coarseLevel );
 
-   for ( const auto& cellIt : function.getStorage()->getCells() )
+   // the macro-cells only write to their own memory and are therefore distributed among the threads
+   const std::vector< PrimitiveID > cellIDs = function.getStorage()->getCellIDs();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
    {
-      const auto cell = cellIt.second;
+      const auto cell = function.getStorage()->getCell( cellIDs[uint_c( i )] );
 
       auto vertexFineData = cell->getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( fineLevel );
       auto edgeFineData   = cell->getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( fineLevel );
@@ -19,13 +19,20 @@
  */
 #include "hyteg/gridtransferoperators/P2toP2QuadraticRestriction.hpp"
 
+#include <array>
+
 #include "hyteg/FunctionMemory.hpp"
+#include "hyteg/edgedofspace/EdgeDoFMacroEdge.hpp"
+#include "hyteg/edgedofspace/EdgeDoFMacroFace.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_2D_macroface_P2_update_edgedofs.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_2D_macroface_P2_update_edgedofs_level_0_to_1.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_2D_macroface_P2_update_vertexdofs.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_3D_macrocell_P2_update_vertexdofs.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_3D_macrocell_P2_update_edgedofs.hpp"
 #include "hyteg/gridtransferoperators/generatedKernels/restrict_3D_macrocell_P2_update_edgedofs_level_1_to_0.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroEdge.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroVertex.hpp"
 #include "hyteg/p2functionspace/P2Multigrid.hpp"
 
 namespace hyteg {
@@ -40,87 +47,19 @@ void P2toP2QuadraticRestriction::restrictAdditively( const P2Function< real_t >&
    /// XOR flag with all to get the DoFTypes that should be excluded
    const DoFType excludeFlag = ( flag ^ All );
 
-   const auto storage = function.getStorage();
-
    const uint_t fineLevel   = sourceLevel;
    const uint_t coarseLevel = sourceLevel - 1;
 
    function.communicate< Vertex, Edge >( fineLevel );
    function.communicate< Edge, Face >( fineLevel );
 
-   for ( const auto& faceIt : function.getStorage()->getFaces() )
+   const std::vector< PrimitiveID > faceIDs = function.getStorage()->getFaceIDs();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int i = 0; i < int_c( faceIDs.size() ); i++ )
    {
-      const auto face = faceIt.second;
-
-      const auto vertexFineData = face->getData( function.getVertexDoFFunction().getFaceDataID() )->getPointer( fineLevel );
-      const auto edgeFineData   = face->getData( function.getEdgeDoFFunction().getFaceDataID() )->getPointer( fineLevel );
-
-      auto vertexCoarseData = face->getData( function.getVertexDoFFunction().getFaceDataID() )->getPointer( coarseLevel );
-      auto edgeCoarseData   = face->getData( function.getEdgeDoFFunction().getFaceDataID() )->getPointer( coarseLevel );
-
-      const auto numNeighborFacesEdge0 =
-          static_cast< double >( storage->getEdge( face->neighborEdges().at( 0 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesEdge1 =
-          static_cast< double >( storage->getEdge( face->neighborEdges().at( 1 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesEdge2 =
-          static_cast< double >( storage->getEdge( face->neighborEdges().at( 2 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesVertex0 =
-          static_cast< double >( storage->getVertex( face->neighborVertices().at( 0 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesVertex1 =
-          static_cast< double >( storage->getVertex( face->neighborVertices().at( 1 ) )->getNumNeighborFaces() );
-      const auto numNeighborFacesVertex2 =
-          static_cast< double >( storage->getVertex( face->neighborVertices().at( 2 ) )->getNumNeighborFaces() );
-
-      typedef edgedof::EdgeDoFOrientation eo;
-      std::map< eo, uint_t >              firstIdxFine;
-      std::map< eo, uint_t >              firstIdxCoarse;
-      for ( auto e : edgedof::faceLocalEdgeDoFOrientations )
-      {
-         firstIdxFine[e]   = edgedof::macroface::index( fineLevel, 0, 0, e );
-         firstIdxCoarse[e] = edgedof::macroface::index( coarseLevel, 0, 0, e );
-      }
-
-      P2::macroface::generated::restrict_2D_macroface_P2_update_vertexdofs( &edgeFineData[firstIdxFine[eo::X]],
-                                                                            &edgeFineData[firstIdxFine[eo::XY]],
-                                                                            &edgeFineData[firstIdxFine[eo::Y]],
-                                                                            vertexCoarseData,
-                                                                            vertexFineData,
-                                                                            static_cast< int32_t >( coarseLevel ),
-                                                                            numNeighborFacesEdge0,
-                                                                            numNeighborFacesEdge1,
-                                                                            numNeighborFacesEdge2,
-                                                                            numNeighborFacesVertex0,
-                                                                            numNeighborFacesVertex1,
-                                                                            numNeighborFacesVertex2 );
-
-      if ( coarseLevel == 0 )
-      {
-         P2::macroface::generated::restrict_2D_macroface_P2_update_edgedofs_level_0_to_1( &edgeCoarseData[firstIdxCoarse[eo::X]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::XY]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::Y]],
-                                                                                          &edgeFineData[firstIdxFine[eo::X]],
-                                                                                          &edgeFineData[firstIdxFine[eo::XY]],
-                                                                                          &edgeFineData[firstIdxFine[eo::Y]],
-                                                                                          vertexFineData,
-                                                                                          static_cast< int32_t >( coarseLevel ),
-                                                                                          numNeighborFacesEdge0,
-                                                                                          numNeighborFacesEdge1,
-                                                                                          numNeighborFacesEdge2 );
-      }
-      else
-      {
-         P2::macroface::generated::restrict_2D_macroface_P2_update_edgedofs( &edgeCoarseData[firstIdxCoarse[eo::X]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::XY]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::Y]],
-                                                                             &edgeFineData[firstIdxFine[eo::X]],
-                                                                             &edgeFineData[firstIdxFine[eo::XY]],
-                                                                             &edgeFineData[firstIdxFine[eo::Y]],
-                                                                             vertexFineData,
-                                                                             static_cast< int32_t >( coarseLevel ),
-                                                                             numNeighborFacesEdge0,
-                                                                             numNeighborFacesEdge1,
-                                                                             numNeighborFacesEdge2 );
-      }
+      restrictMacroFace( function, *function.getStorage()->getFace( faceIDs[uint_c( i )] ), fineLevel );
    }
 
    function.getVertexDoFFunction().communicateAdditively< Face, Edge >( coarseLevel, excludeFlag, *function.getStorage() );
@@ -135,7 +74,6 @@ void P2toP2QuadraticRestriction::restrictAdditively3D( const P2Function< real_t
 {
    /// XOR flag with all to get the DoFTypes that should be excluded
    const DoFType excludeFlag = ( flag ^ All );
-   const auto    storage     = function.getStorage();
 
    const uint_t fineLevel   = sourceLevel;
    const uint_t coarseLevel = sourceLevel - 1;
@@ -144,146 +82,425 @@ void P2toP2QuadraticRestriction::restrictAdditively3D( const P2Function< real_t
    function.communicate< Edge, Face >( fineLevel );
    function.communicate< Face, Cell >( fineLevel );
 
-   for ( const auto& cellIt : function.getStorage()->getCells() )
+   const std::vector< PrimitiveID > cellIDs = function.getStorage()->getCellIDs();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
+   {
+      restrictMacroCell( function, *function.getStorage()->getCell( cellIDs[uint_c( i )] ), fineLevel );
+   }
+
+   function.getVertexDoFFunction().communicateAdditively< Cell, Face >( coarseLevel, excludeFlag, *function.getStorage() );
+   function.getVertexDoFFunction().communicateAdditively< Cell, Edge >( coarseLevel, excludeFlag, *function.getStorage() );
+   function.getVertexDoFFunction().communicateAdditively< Cell, Vertex >( coarseLevel, excludeFlag, *function.getStorage() );
+
+   function.getEdgeDoFFunction().communicateAdditively< Cell, Face >( coarseLevel, excludeFlag, *function.getStorage() );
+   function.getEdgeDoFFunction().communicateAdditively< Cell, Edge >( coarseLevel, excludeFlag, *function.getStorage() );
+}
+
+/// Returns true if the edge DoF with the passed orientation and index is located in the interior of the macro-cell.
+/// Same as edgedof::macrocell::isInnerEdgeDoF() but without constructing the sets of neighboring macro-faces.
+static inline bool isInnerEdgeDoFInCell( const int& x, const int& y, const int& z, const int& width, const edgedof::EdgeDoFOrientation& orientation )
+{
+   typedef edgedof::EdgeDoFOrientation eo;
+   switch ( orientation )
+   {
+   case eo::X:
+      return y != 0 && z != 0;
+   case eo::Y:
+      return x != 0 && z != 0;
+   case eo::Z:
+      return x != 0 && y != 0;
+   case eo::XY:
+      return z != 0 && x + y + z != width - 1;
+   case eo::XZ:
+      return y != 0 && x + y + z != width - 1;
+   case eo::YZ:
+      return x != 0 && x + y + z != width - 1;
+   default:
+      return true;
+   }
+}
+
+void P2toP2QuadraticRestriction::computeAndRestrictResidual( const P2Function< real_t >& b,
+                                                             const P2Function< real_t >& tmp,
+                                                             const uint_t&               sourceLevel,
+                                                             const DoFType&              flag ) const
+{
+   if ( tmp.isDummy() )
+      return;
+
+   /// XOR flag with all to get the DoFTypes that should be excluded
+   const DoFType excludeFlag = ( flag ^ All );
+
+   const auto   storage           = tmp.getStorage();
+   const auto&  boundaryCondition = tmp.getBoundaryCondition();
+   const uint_t fineLevel         = sourceLevel;
+   const uint_t coarseLevel       = sourceLevel - 1;
+
+   const auto& bVertex   = b.getVertexDoFFunction();
+   const auto& bEdge     = b.getEdgeDoFFunction();
+   const auto& tmpVertex = tmp.getVertexDoFFunction();
+   const auto& tmpEdge   = tmp.getEdgeDoFFunction();
+
+   // The DoFs on the lower-dimensional macro-primitives are shared by several macro-faces (2D) or macro-cells (3D),
+   // so the residual is completed there first and communicated to the macro-primitives of highest dimension.
+   for ( const auto& it : storage->getVertices() )
+   {
+      Vertex& vertex = *it.second;
+      if ( testFlag( boundaryCondition.getBoundaryType( vertex.getMeshBoundaryFlag() ), flag ) )
+      {
+         vertexdof::macrovertex::assign< real_t >(
+             vertex, { 1.0, -1.0 }, { bVertex.getVertexDataID(), tmpVertex.getVertexDataID() }, tmpVertex.getVertexDataID(), fineLevel );
+      }
+   }
+
+   for ( const auto& it : storage->getEdges() )
+   {
+      Edge& edge = *it.second;
+      if ( testFlag( boundaryCondition.getBoundaryType( edge.getMeshBoundaryFlag() ), flag ) )
+      {
+         vertexdof::macroedge::assign< real_t >(
+             fineLevel, edge, { 1.0, -1.0 }, { bVertex.getEdgeDataID(), tmpVertex.getEdgeDataID() }, tmpVertex.getEdgeDataID() );
+         edgedof::macroedge::assign< real_t >(
+             fineLevel, edge, { 1.0, -1.0 }, { bEdge.getEdgeDataID(), tmpEdge.getEdgeDataID() }, tmpEdge.getEdgeDataID() );
+      }
+   }
+
+   tmp.communicate< Vertex, Edge >( fineLevel );
+   tmp.communicate< Edge, Face >( fineLevel );
+
+   if ( !storage->hasGlobalCells() )
    {
-      const auto cell = cellIt.second;
-
-      const auto vertexFineData = cell->getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( fineLevel );
-      const auto edgeFineData   = cell->getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( fineLevel );
-
-      auto vertexCoarseData = cell->getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( coarseLevel );
-      auto edgeCoarseData   = cell->getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( coarseLevel );
-
-      const auto numNeighborCellsFace0 =
-          static_cast< double >( storage->getFace( cell->neighborFaces().at( 0 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsFace1 =
-          static_cast< double >( storage->getFace( cell->neighborFaces().at( 1 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsFace2 =
-          static_cast< double >( storage->getFace( cell->neighborFaces().at( 2 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsFace3 =
-          static_cast< double >( storage->getFace( cell->neighborFaces().at( 3 ) )->getNumNeighborCells() );
-
-      const auto numNeighborCellsEdge0 =
-          static_cast< double >( storage->getEdge( cell->neighborEdges().at( 0 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsEdge1 =
-          static_cast< double >( storage->getEdge( cell->neighborEdges().at( 1 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsEdge2 =
-          static_cast< double >( storage->getEdge( cell->neighborEdges().at( 2 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsEdge3 =
-          static_cast< double >( storage->getEdge( cell->neighborEdges().at( 3 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsEdge4 =
-          static_cast< double >( storage->getEdge( cell->neighborEdges().at( 4 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsEdge5 =
-          static_cast< double >( storage->getEdge( cell->neighborEdges().at( 5 ) )->getNumNeighborCells() );
-
-      const auto numNeighborCellsVertex0 =
-          static_cast< double >( storage->getVertex( cell->neighborVertices().at( 0 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsVertex1 =
-          static_cast< double >( storage->getVertex( cell->neighborVertices().at( 1 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsVertex2 =
-          static_cast< double >( storage->getVertex( cell->neighborVertices().at( 2 ) )->getNumNeighborCells() );
-      const auto numNeighborCellsVertex3 =
-          static_cast< double >( storage->getVertex( cell->neighborVertices().at( 3 ) )->getNumNeighborCells() );
-
-      typedef edgedof::EdgeDoFOrientation eo;
-      std::map< eo, uint_t >              firstIdxFine;
-      std::map< eo, uint_t >              firstIdxCoarse;
-      for ( auto e : edgedof::allEdgeDoFOrientations )
+      // Each macro-face completes the residual of its inner DoFs and restricts it right away, while the data is still in cache.
+      const std::vector< PrimitiveID > faceIDs = storage->getFaceIDs();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+      for ( int i = 0; i < int_c( faceIDs.size() ); i++ )
       {
-         firstIdxFine[e]   = edgedof::macrocell::index( fineLevel, 0, 0, 0, e );
-         firstIdxCoarse[e] = edgedof::macrocell::index( coarseLevel, 0, 0, 0, e );
+         Face& face = *storage->getFace( faceIDs[uint_c( i )] );
+
+         if ( testFlag( boundaryCondition.getBoundaryType( face.getMeshBoundaryFlag() ), flag ) )
+         {
+            const real_t* bVertexData   = face.getData( bVertex.getFaceDataID() )->getPointer( fineLevel );
+            const real_t* bEdgeData     = face.getData( bEdge.getFaceDataID() )->getPointer( fineLevel );
+            real_t*       tmpVertexData = face.getData( tmpVertex.getFaceDataID() )->getPointer( fineLevel );
+            real_t*       tmpEdgeData   = face.getData( tmpEdge.getFaceDataID() )->getPointer( fineLevel );
+
+            for ( const auto& idx : vertexdof::macroface::Iterator( fineLevel, 1 ) )
+            {
+               const uint_t arrayIdx = vertexdof::macroface::index( fineLevel, idx.x(), idx.y() );
+               tmpVertexData[arrayIdx] = bVertexData[arrayIdx] - tmpVertexData[arrayIdx];
+            }
+
+            for ( const auto& idx : edgedof::macroface::Iterator( fineLevel, 0 ) )
+            {
+               for ( const auto& orientation : edgedof::faceLocalEdgeDoFOrientations )
+               {
+                  if ( edgedof::macroface::isInnerEdgeDoF( fineLevel, idx, orientation ) )
+                  {
+                     const uint_t arrayIdx = edgedof::macroface::index( fineLevel, idx.x(), idx.y(), orientation );
+                     tmpEdgeData[arrayIdx] = bEdgeData[arrayIdx] - tmpEdgeData[arrayIdx];
+                  }
+               }
+            }
+         }
+
+         restrictMacroFace( tmp, face, fineLevel );
       }
 
-      P2::macrocell::generated::restrict_3D_macrocell_P2_update_vertexdofs( &edgeFineData[firstIdxFine[eo::X]],
-                                                                            &edgeFineData[firstIdxFine[eo::XY]],
-                                                                            &edgeFineData[firstIdxFine[eo::XYZ]],
-                                                                            &edgeFineData[firstIdxFine[eo::XZ]],
-                                                                            &edgeFineData[firstIdxFine[eo::Y]],
-                                                                            &edgeFineData[firstIdxFine[eo::YZ]],
-                                                                            &edgeFineData[firstIdxFine[eo::Z]],
-                                                                            vertexCoarseData,
-                                                                            vertexFineData,
-                                                                            static_cast< int32_t >( coarseLevel ),
-                                                                            numNeighborCellsEdge0,
-                                                                            numNeighborCellsEdge1,
-                                                                            numNeighborCellsEdge2,
-                                                                            numNeighborCellsEdge3,
-                                                                            numNeighborCellsEdge4,
-                                                                            numNeighborCellsEdge5,
-                                                                            numNeighborCellsFace0,
-                                                                            numNeighborCellsFace1,
-                                                                            numNeighborCellsFace2,
-                                                                            numNeighborCellsFace3,
-                                                                            numNeighborCellsVertex0,
-                                                                            numNeighborCellsVertex1,
-                                                                            numNeighborCellsVertex2,
-                                                                            numNeighborCellsVertex3 );
-
-      if ( coarseLevel == 0 )
+      tmpVertex.communicateAdditively< Face, Edge >( coarseLevel, excludeFlag, *storage );
+      tmpVertex.communicateAdditively< Face, Vertex >( coarseLevel, excludeFlag, *storage );
+
+      tmpEdge.communicateAdditively< Face, Edge >( coarseLevel, excludeFlag, *storage );
+      return;
+   }
+
+   for ( const auto& it : storage->getFaces() )
+   {
+      Face& face = *it.second;
+      if ( testFlag( boundaryCondition.getBoundaryType( face.getMeshBoundaryFlag() ), flag ) )
       {
-         P2::macrocell::generated::restrict_3D_macrocell_P2_update_edgedofs_level_1_to_0( &edgeCoarseData[firstIdxCoarse[eo::X]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::XY]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::XZ]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::Y]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::YZ]],
-                                                                                          &edgeCoarseData[firstIdxCoarse[eo::Z]],
-                                                                                          &edgeFineData[firstIdxFine[eo::X]],
-                                                                                          &edgeFineData[firstIdxFine[eo::XY]],
-                                                                                          &edgeFineData[firstIdxFine[eo::XYZ]],
-                                                                                          &edgeFineData[firstIdxFine[eo::XZ]],
-                                                                                          &edgeFineData[firstIdxFine[eo::Y]],
-                                                                                          &edgeFineData[firstIdxFine[eo::YZ]],
-                                                                                          &edgeFineData[firstIdxFine[eo::Z]],
-                                                                                          vertexFineData,
-                                                                                          static_cast< int32_t >( coarseLevel ),
-                                                                                          numNeighborCellsEdge0,
-                                                                                          numNeighborCellsEdge1,
-                                                                                          numNeighborCellsEdge2,
-                                                                                          numNeighborCellsEdge3,
-                                                                                          numNeighborCellsEdge4,
-                                                                                          numNeighborCellsEdge5,
-                                                                                          numNeighborCellsFace0,
-                                                                                          numNeighborCellsFace1,
-                                                                                          numNeighborCellsFace2,
-                                                                                          numNeighborCellsFace3 );
+         vertexdof::macroface::assign< real_t >(
+             fineLevel, face, { 1.0, -1.0 }, { bVertex.getFaceDataID(), tmpVertex.getFaceDataID() }, tmpVertex.getFaceDataID() );
+         edgedof::macroface::assign< real_t >(
+             fineLevel, face, { 1.0, -1.0 }, { bEdge.getFaceDataID(), tmpEdge.getFaceDataID() }, tmpEdge.getFaceDataID() );
       }
-      else
+   }
+
+   tmp.communicate< Face, Cell >( fineLevel );
+
+   // Each macro-cell completes the residual of its inner DoFs and restricts it right away, while the data is still in cache.
+   // The edge DoFs with orientation XYZ are all inner DoFs and are treated separately.
+   typedef edgedof::EdgeDoFOrientation eo;
+   const std::array< eo, 6 > innerCellEdgeDoFOrientations = { eo::X, eo::Y, eo::Z, eo::XY, eo::XZ, eo::YZ };
+   const int                 width                        = int_c( levelinfo::num_microedges_per_edge( fineLevel ) );
+   const std::vector< PrimitiveID > cellIDs = storage->getCellIDs();
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
+   {
+      Cell& cell = *storage->getCell( cellIDs[uint_c( i )] );
+
+      if ( testFlag( boundaryCondition.getBoundaryType( cell.getMeshBoundaryFlag() ), flag ) )
       {
-         P2::macrocell::generated::restrict_3D_macrocell_P2_update_edgedofs( &edgeCoarseData[firstIdxCoarse[eo::X]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::XY]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::XYZ]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::XZ]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::Y]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::YZ]],
-                                                                             &edgeCoarseData[firstIdxCoarse[eo::Z]],
-                                                                             &edgeFineData[firstIdxFine[eo::X]],
-                                                                             &edgeFineData[firstIdxFine[eo::XY]],
-                                                                             &edgeFineData[firstIdxFine[eo::XYZ]],
-                                                                             &edgeFineData[firstIdxFine[eo::XZ]],
-                                                                             &edgeFineData[firstIdxFine[eo::Y]],
-                                                                             &edgeFineData[firstIdxFine[eo::YZ]],
-                                                                             &edgeFineData[firstIdxFine[eo::Z]],
-                                                                             vertexFineData,
-                                                                             static_cast< int32_t >( coarseLevel ),
-                                                                             numNeighborCellsEdge0,
-                                                                             numNeighborCellsEdge1,
-                                                                             numNeighborCellsEdge2,
-                                                                             numNeighborCellsEdge3,
-                                                                             numNeighborCellsEdge4,
-                                                                             numNeighborCellsEdge5,
-                                                                             numNeighborCellsFace0,
-                                                                             numNeighborCellsFace1,
-                                                                             numNeighborCellsFace2,
-                                                                             numNeighborCellsFace3 );
+         const real_t* bVertexData   = cell.getData( bVertex.getCellDataID() )->getPointer( fineLevel );
+         const real_t* bEdgeData     = cell.getData( bEdge.getCellDataID() )->getPointer( fineLevel );
+         real_t*       tmpVertexData = cell.getData( tmpVertex.getCellDataID() )->getPointer( fineLevel );
+         real_t*       tmpEdgeData   = cell.getData( tmpEdge.getCellDataID() )->getPointer( fineLevel );
+
+         for ( const auto& idx : vertexdof::macrocell::Iterator( fineLevel, 1 ) )
+         {
+            const uint_t arrayIdx = vertexdof::macrocell::index( fineLevel, idx.x(), idx.y(), idx.z() );
+            tmpVertexData[arrayIdx] = bVertexData[arrayIdx] - tmpVertexData[arrayIdx];
+         }
+
+         for ( const auto& idx : edgedof::macrocell::Iterator( fineLevel, 0 ) )
+         {
+            for ( const auto& orientation : innerCellEdgeDoFOrientations )
+            {
+               if ( isInnerEdgeDoFInCell( int_c( idx.x() ), int_c( idx.y() ), int_c( idx.z() ), width, orientation ) )
+               {
+                  const uint_t arrayIdx = edgedof::macrocell::index( fineLevel, idx.x(), idx.y(), idx.z(), orientation );
+                  tmpEdgeData[arrayIdx] = bEdgeData[arrayIdx] - tmpEdgeData[arrayIdx];
+               }
+            }
+         }
+
+         for ( const auto& idx : edgedof::macrocell::IteratorXYZ( fineLevel, 0 ) )
+         {
+            const uint_t arrayIdx = edgedof::macrocell::index( fineLevel, idx.x(), idx.y(), idx.z(), edgedof::EdgeDoFOrientation::XYZ );
+            tmpEdgeData[arrayIdx] = bEdgeData[arrayIdx] - tmpEdgeData[arrayIdx];
+         }
       }
+
+      restrictMacroCell( tmp, cell, fineLevel );
    }
 
-   function.getVertexDoFFunction().communicateAdditively< Cell, Face >( coarseLevel, excludeFlag, *function.getStorage() );
-   function.getVertexDoFFunction().communicateAdditively< Cell, Edge >( coarseLevel, excludeFlag, *function.getStorage() );
-   function.getVertexDoFFunction().communicateAdditively< Cell, Vertex >( coarseLevel, excludeFlag, *function.getStorage() );
+   tmpVertex.communicateAdditively< Cell, Face >( coarseLevel, excludeFlag, *storage );
+   tmpVertex.communicateAdditively< Cell, Edge >( coarseLevel, excludeFlag, *storage );
+   tmpVertex.communicateAdditively< Cell, Vertex >( coarseLevel, excludeFlag, *storage );
 
-   function.getEdgeDoFFunction().communicateAdditively< Cell, Face >( coarseLevel, excludeFlag, *function.getStorage() );
-   function.getEdgeDoFFunction().communicateAdditively< Cell, Edge >( coarseLevel, excludeFlag, *function.getStorage() );
+   tmpEdge.communicateAdditively< Cell, Face >( coarseLevel, excludeFlag, *storage );
+   tmpEdge.communicateAdditively< Cell, Edge >( coarseLevel, excludeFlag, *storage );
+}
+
+void P2toP2QuadraticRestriction::restrictMacroFace( const P2Function< real_t >& function,
+                                                    const Face&                 face,
+                                                    const uint_t&               fineLevel ) const
+{
+   const auto   storage     = function.getStorage();
+   const uint_t coarseLevel = fineLevel - 1;
+
+   const auto vertexFineData = face.getData( function.getVertexDoFFunction().getFaceDataID() )->getPointer( fineLevel );
+   const auto edgeFineData   = face.getData( function.getEdgeDoFFunction().getFaceDataID() )->getPointer( fineLevel );
+
+   auto vertexCoarseData = face.getData( function.getVertexDoFFunction().getFaceDataID() )->getPointer( coarseLevel );
+   auto edgeCoarseData   = face.getData( function.getEdgeDoFFunction().getFaceDataID() )->getPointer( coarseLevel );
+
+   const auto numNeighborFacesEdge0 =
+       static_cast< double >( storage->getEdge( face.neighborEdges().at( 0 ) )->getNumNeighborFaces() );
+   const auto numNeighborFacesEdge1 =
+       static_cast< double >( storage->getEdge( face.neighborEdges().at( 1 ) )->getNumNeighborFaces() );
+   const auto numNeighborFacesEdge2 =
+       static_cast< double >( storage->getEdge( face.neighborEdges().at( 2 ) )->getNumNeighborFaces() );
+   const auto numNeighborFacesVertex0 =
+       static_cast< double >( storage->getVertex( face.neighborVertices().at( 0 ) )->getNumNeighborFaces() );
+   const auto numNeighborFacesVertex1 =
+       static_cast< double >( storage->getVertex( face.neighborVertices().at( 1 ) )->getNumNeighborFaces() );
+   const auto numNeighborFacesVertex2 =
+       static_cast< double >( storage->getVertex( face.neighborVertices().at( 2 ) )->getNumNeighborFaces() );
+
+   typedef edgedof::EdgeDoFOrientation eo;
+   std::map< eo, uint_t >              firstIdxFine;
+   std::map< eo, uint_t >              firstIdxCoarse;
+   for ( auto e : edgedof::faceLocalEdgeDoFOrientations )
+   {
+      firstIdxFine[e]   = edgedof::macroface::index( fineLevel, 0, 0, e );
+      firstIdxCoarse[e] = edgedof::macroface::index( coarseLevel, 0, 0, e );
+   }
+
+   P2::macroface::generated::restrict_2D_macroface_P2_update_vertexdofs( &edgeFineData[firstIdxFine[eo::X]],
+                                                                         &edgeFineData[firstIdxFine[eo::XY]],
+                                                                         &edgeFineData[firstIdxFine[eo::Y]],
+                                                                         vertexCoarseData,
+                                                                         vertexFineData,
+                                                                         static_cast< int32_t >( coarseLevel ),
+                                                                         numNeighborFacesEdge0,
+                                                                         numNeighborFacesEdge1,
+                                                                         numNeighborFacesEdge2,
+                                                                         numNeighborFacesVertex0,
+                                                                         numNeighborFacesVertex1,
+                                                                         numNeighborFacesVertex2 );
+
+   if ( coarseLevel == 0 )
+   {
+      P2::macroface::generated::restrict_2D_macroface_P2_update_edgedofs_level_0_to_1( &edgeCoarseData[firstIdxCoarse[eo::X]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::XY]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::Y]],
+                                                                                       &edgeFineData[firstIdxFine[eo::X]],
+                                                                                       &edgeFineData[firstIdxFine[eo::XY]],
+                                                                                       &edgeFineData[firstIdxFine[eo::Y]],
+                                                                                       vertexFineData,
+                                                                                       static_cast< int32_t >( coarseLevel ),
+                                                                                       numNeighborFacesEdge0,
+                                                                                       numNeighborFacesEdge1,
+                                                                                       numNeighborFacesEdge2 );
+   }
+   else
+   {
+      P2::macroface::generated::restrict_2D_macroface_P2_update_edgedofs( &edgeCoarseData[firstIdxCoarse[eo::X]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::XY]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::Y]],
+                                                                          &edgeFineData[firstIdxFine[eo::X]],
+                                                                          &edgeFineData[firstIdxFine[eo::XY]],
+                                                                          &edgeFineData[firstIdxFine[eo::Y]],
+                                                                          vertexFineData,
+                                                                          static_cast< int32_t >( coarseLevel ),
+                                                                          numNeighborFacesEdge0,
+                                                                          numNeighborFacesEdge1,
+                                                                          numNeighborFacesEdge2 );
+   }
+}
+
+void P2toP2QuadraticRestriction::restrictMacroCell( const P2Function< real_t >& function,
+                                                    const Cell&                 cell,
+                                                    const uint_t&               fineLevel ) const
+{
+   const auto   storage     = function.getStorage();
+   const uint_t coarseLevel = fineLevel - 1;
+
+   const auto vertexFineData = cell.getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( fineLevel );
+   const auto edgeFineData   = cell.getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( fineLevel );
+
+   auto vertexCoarseData = cell.getData( function.getVertexDoFFunction().getCellDataID() )->getPointer( coarseLevel );
+   auto edgeCoarseData   = cell.getData( function.getEdgeDoFFunction().getCellDataID() )->getPointer( coarseLevel );
+
+   const auto numNeighborCellsFace0 =
+       static_cast< double >( storage->getFace( cell.neighborFaces().at( 0 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsFace1 =
+       static_cast< double >( storage->getFace( cell.neighborFaces().at( 1 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsFace2 =
+       static_cast< double >( storage->getFace( cell.neighborFaces().at( 2 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsFace3 =
+       static_cast< double >( storage->getFace( cell.neighborFaces().at( 3 ) )->getNumNeighborCells() );
+
+   const auto numNeighborCellsEdge0 =
+       static_cast< double >( storage->getEdge( cell.neighborEdges().at( 0 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsEdge1 =
+       static_cast< double >( storage->getEdge( cell.neighborEdges().at( 1 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsEdge2 =
+       static_cast< double >( storage->getEdge( cell.neighborEdges().at( 2 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsEdge3 =
+       static_cast< double >( storage->getEdge( cell.neighborEdges().at( 3 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsEdge4 =
+       static_cast< double >( storage->getEdge( cell.neighborEdges().at( 4 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsEdge5 =
+       static_cast< double >( storage->getEdge( cell.neighborEdges().at( 5 ) )->getNumNeighborCells() );
+
+   const auto numNeighborCellsVertex0 =
+       static_cast< double >( storage->getVertex( cell.neighborVertices().at( 0 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsVertex1 =
+       static_cast< double >( storage->getVertex( cell.neighborVertices().at( 1 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsVertex2 =
+       static_cast< double >( storage->getVertex( cell.neighborVertices().at( 2 ) )->getNumNeighborCells() );
+   const auto numNeighborCellsVertex3 =
+       static_cast< double >( storage->getVertex( cell.neighborVertices().at( 3 ) )->getNumNeighborCells() );
+
+   typedef edgedof::EdgeDoFOrientation eo;
+   std::map< eo, uint_t >              firstIdxFine;
+   std::map< eo, uint_t >              firstIdxCoarse;
+   for ( auto e : edgedof::allEdgeDoFOrientations )
+   {
+      firstIdxFine[e]   = edgedof::macrocell::index( fineLevel, 0, 0, 0, e );
+      firstIdxCoarse[e] = edgedof::macrocell::index( coarseLevel, 0, 0, 0, e );
+   }
+
+   P2::macrocell::generated::restrict_3D_macrocell_P2_update_vertexdofs( &edgeFineData[firstIdxFine[eo::X]],
+                                                                         &edgeFineData[firstIdxFine[eo::XY]],
+                                                                         &edgeFineData[firstIdxFine[eo::XYZ]],
+                                                                         &edgeFineData[firstIdxFine[eo::XZ]],
+                                                                         &edgeFineData[firstIdxFine[eo::Y]],
+                                                                         &edgeFineData[firstIdxFine[eo::YZ]],
+                                                                         &edgeFineData[firstIdxFine[eo::Z]],
+                                                                         vertexCoarseData,
+                                                                         vertexFineData,
+                                                                         static_cast< int32_t >( coarseLevel ),
+                                                                         numNeighborCellsEdge0,
+                                                                         numNeighborCellsEdge1,
+                                                                         numNeighborCellsEdge2,
+                                                                         numNeighborCellsEdge3,
+                                                                         numNeighborCellsEdge4,
+                                                                         numNeighborCellsEdge5,
+                                                                         numNeighborCellsFace0,
+                                                                         numNeighborCellsFace1,
+                                                                         numNeighborCellsFace2,
+                                                                         numNeighborCellsFace3,
+                                                                         numNeighborCellsVertex0,
+                                                                         numNeighborCellsVertex1,
+                                                                         numNeighborCellsVertex2,
+                                                                         numNeighborCellsVertex3 );
+
+   if ( coarseLevel == 0 )
+   {
+      P2::macrocell::generated::restrict_3D_macrocell_P2_update_edgedofs_level_1_to_0( &edgeCoarseData[firstIdxCoarse[eo::X]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::XY]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::XZ]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::Y]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::YZ]],
+                                                                                       &edgeCoarseData[firstIdxCoarse[eo::Z]],
+                                                                                       &edgeFineData[firstIdxFine[eo::X]],
+                                                                                       &edgeFineData[firstIdxFine[eo::XY]],
+                                                                                       &edgeFineData[firstIdxFine[eo::XYZ]],
+                                                                                       &edgeFineData[firstIdxFine[eo::XZ]],
+                                                                                       &edgeFineData[firstIdxFine[eo::Y]],
+                                                                                       &edgeFineData[firstIdxFine[eo::YZ]],
+                                                                                       &edgeFineData[firstIdxFine[eo::Z]],
+                                                                                       vertexFineData,
+                                                                                       static_cast< int32_t >( coarseLevel ),
+                                                                                       numNeighborCellsEdge0,
+                                                                                       numNeighborCellsEdge1,
+                                                                                       numNeighborCellsEdge2,
+                                                                                       numNeighborCellsEdge3,
+                                                                                       numNeighborCellsEdge4,
+                                                                                       numNeighborCellsEdge5,
+                                                                                       numNeighborCellsFace0,
+                                                                                       numNeighborCellsFace1,
+                                                                                       numNeighborCellsFace2,
+                                                                                       numNeighborCellsFace3 );
+   }
+   else
+   {
+      P2::macrocell::generated::restrict_3D_macrocell_P2_update_edgedofs( &edgeCoarseData[firstIdxCoarse[eo::X]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::XY]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::XYZ]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::XZ]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::Y]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::YZ]],
+                                                                          &edgeCoarseData[firstIdxCoarse[eo::Z]],
+                                                                          &edgeFineData[firstIdxFine[eo::X]],
+                                                                          &edgeFineData[firstIdxFine[eo::XY]],
+                                                                          &edgeFineData[firstIdxFine[eo::XYZ]],
+                                                                          &edgeFineData[firstIdxFine[eo::XZ]],
+                                                                          &edgeFineData[firstIdxFine[eo::Y]],
+                                                                          &edgeFineData[firstIdxFine[eo::YZ]],
+                                                                          &edgeFineData[firstIdxFine[eo::Z]],
+                                                                          vertexFineData,
+                                                                          static_cast< int32_t >( coarseLevel ),
+                                                                          numNeighborCellsEdge0,
+                                                                          numNeighborCellsEdge1,
+                                                                          numNeighborCellsEdge2,
+                                                                          numNeighborCellsEdge3,
+                                                                          numNeighborCellsEdge4,
+                                                                          numNeighborCellsEdge5,
+                                                                          numNeighborCellsFace0,
+                                                                          numNeighborCellsFace1,
+                                                                          numNeighborCellsFace2,
+                                                                          numNeighborCellsFace3 );
+   }
 }
 
 void P2toP2QuadraticRestriction::restrictWithPostCommunication( const hyteg::P2Function< walberla::real_t >& function,
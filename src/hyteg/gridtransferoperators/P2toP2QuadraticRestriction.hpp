@@ -43,7 +43,21 @@ class P2toP2QuadraticRestriction : public RestrictionOperator< P2Function< real_
       }
    }
 
+   /// Completes the residual b - Ax and restricts it in a single sweep over the macro-faces (2D) or macro-cells (3D).
+   ///
+   /// On entry tmp must contain Ax on level sourceLevel. The restricted residual is written to tmp on level
+   /// sourceLevel - 1, i.e. the result is the same as assigning b - Ax to tmp and calling restrict( tmp, sourceLevel, flag ).
+   /// Each macro-face or macro-cell is restricted right after its residual is formed, so the second pass over the
+   /// fine grid data is replaced by an update of the data that has just been accessed.
+   void computeAndRestrictResidual( const P2Function< real_t >& b,
+                                    const P2Function< real_t >& tmp,
+                                    const uint_t&               sourceLevel,
+                                    const DoFType&              flag ) const;
+
  private:
+   void restrictMacroFace( const P2Function< real_t >& function, const Face& face, const uint_t& fineLevel ) const;
+   void restrictMacroCell( const P2Function< real_t >& function, const Cell& cell, const uint_t& fineLevel ) const;
+
    void restrictWithPostCommunication( const P2Function< real_t >& function,
                                        const uint_t&               sourceLevel,
                                        const DoFType&              flag ) const;
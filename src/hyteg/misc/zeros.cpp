@@ -41,6 +41,12 @@ real_t generateZero< real_t >()
    return real_c( 0 );
 }
 
+template <>
+float generateZero< float >()
+{
+   return 0.0f;
+}
+
 template <>
 uint_t generateZero< uint_t >()
 {
@@ -35,6 +35,9 @@ ValueType generateZero();
 template <>
 real_t generateZero< real_t >();
 
+template <>
+float generateZero< float >();
+
 template <>
 uint_t generateZero< uint_t >();
 
@@ -36,6 +36,7 @@
 #include "hyteg/LevelWiseMemory.hpp"
 #include "hyteg/Algorithms.hpp"
 #include "hyteg/edgedofspace/EdgeDoFMacroCell.hpp"
+#include "hyteg/edgedofspace/EdgeDoFMacroCellStencil.hpp"
 #include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
 
 namespace hyteg {
@@ -49,7 +50,7 @@ typedef std::map< uint_t, std::map< edgedof::EdgeDoFOrientation, std::map< index
 typedef std::map< uint_t, std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > > MacroFaceStencilMap_T;
 
 /// map[leafOrientation][indexOffset] = weight
-typedef std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > MacroCellStencilMap_T;
+typedef edgedof::macrocell::EdgeToVertexFlatStencil MacroCellStencilMap_T;
 
 inline void applyVertex(uint_t level,
                   Vertex &vertex,
@@ -454,7 +455,7 @@ inline void applyCell(const uint_t & Level, Cell & cell,
                       UpdateType update)
 {
 
-  auto opr_data = cell.getData(operatorId)->getData( Level );
+  const auto& opr_data = cell.getData(operatorId)->getData( Level );
   real_t * src  = cell.getData(srcId)->getPointer( Level );
   real_t * dst  = cell.getData(dstId)->getPointer( Level );
 
@@ -296,6 +296,19 @@ void EdgeDoFToVertexDoFOperator< EdgeDoFToVertexDoFForm >::apply(const EdgeDoFFu
 
   if ( level >= 2 )
   {
+     // there is only a generated kernel for UpdateType Add
+     KernelRegion kernelRegion( "apply_3D_macrocell_edgedof_to_vertexdof_add",
+                                level,
+                                hyteg::globalDefines::useGeneratedKernels && storage_->hasGlobalCells() && updateType == Add );
+     if ( kernelRegion.recordsStatistics() && !storage_->getCells().empty() )
+     {
+        const uint_t numMacroCells = kernelcost::numMacroPrimitivesWithFlag( storage_->getCells(), dst, flag );
+        kernelRegion.setCost( kernelcost::constantStencilApply( numMacroCells * kernelcost::numInnerVertexDoFsPerCell( level ),
+                                                                numMacroCells * kernelcost::numInnerEdgeDoFsPerCell( level ),
+                                                                double( EdgeDoFToVertexDoF::MacroCellStencilMap_T::size() ),
+                                                                updateType ) );
+     }
+
      std::vector< PrimitiveID > cellIDs = this->getStorage()->getCellIDs();
      #ifdef WALBERLA_BUILD_WITH_OPENMP
      #pragma omp parallel for default(shared)
@@ -312,7 +325,7 @@ void EdgeDoFToVertexDoFOperator< EdgeDoFToVertexDoFForm >::apply(const EdgeDoFFu
               typedef edgedof::EdgeDoFOrientation eo;
               auto                                dstData     = cell.getData( dst.getCellDataID() )->getPointer( level );
               auto                                srcData     = cell.getData( src.getCellDataID() )->getPointer( level );
-              auto                                stencilData = cell.getData( cellStencilID_ )->getData( level );
+              const auto                          stencilData = cell.getData( cellStencilID_ )->getData( level ).toMap();
               std::map< eo, uint_t >              firstIdx;
               for ( auto e : edgedof::allEdgeDoFOrientations )
                  firstIdx[e] = edgedof::macrocell::index( level, 0, 0, 0, e );
@@ -344,6 +357,19 @@ void EdgeDoFToVertexDoFOperator< EdgeDoFToVertexDoFForm >::apply(const EdgeDoFFu
 
   if ( level >= 1 )
   {
+     KernelRegion kernelRegion( std::string( "apply_2D_macroface_edgedof_to_vertexdof_" ) +
+                                    ( updateType == Replace ? "replace" : "add" ),
+                                level,
+                                hyteg::globalDefines::useGeneratedKernels && !storage_->hasGlobalCells() );
+     if ( kernelRegion.recordsStatistics() )
+     {
+        const uint_t numMacroFaces = kernelcost::numMacroPrimitivesWithFlag( storage_->getFaces(), dst, flag );
+        kernelRegion.setCost( kernelcost::constantStencilApply( numMacroFaces * kernelcost::numInnerVertexDoFsPerFace( level ),
+                                                                numMacroFaces * kernelcost::numInnerEdgeDoFsPerFace( level ),
+                                                                12.0,
+                                                                updateType ) );
+     }
+
      std::vector< PrimitiveID > faceIDs = this->getStorage()->getFaceIDs();
      #ifdef WALBERLA_BUILD_WITH_OPENMP
      #pragma omp parallel for default(shared)
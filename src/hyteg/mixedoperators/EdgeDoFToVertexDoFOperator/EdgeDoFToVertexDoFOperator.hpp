@@ -220,7 +220,7 @@ void assembleEdgeToVertexStencils(
                    indexing::Index( 1, 1, 1 ), leafOrientation, cell, level, form );
                for ( const auto stencilIt : edgeToVertexStencilMap )
                {
-                  edgeToVertexStencilMemory[leafOrientation][stencilIt.first] = stencilIt.second;
+                  edgeToVertexStencilMemory[leafOrientation].at( stencilIt.first ) = stencilIt.second;
                }
             }
          }
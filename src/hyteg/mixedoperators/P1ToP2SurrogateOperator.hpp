@@ -32,6 +32,9 @@
 #include "hyteg/forms/form_hyteg_manual/P2ToP1FormDiv.hpp"
 
 #include <hyteg/p2functionspace/polynomial/StencilInterpolator.hpp>
+#include <hyteg/p2functionspace/polynomial/P2MacroCellPolynomial.hpp>
+#include <hyteg/p2functionspace/polynomial/P2PolynomialDataHandling.hpp>
+#include <hyteg/polynomial/LSQPInterpolator3D.hpp>
 
 #include <hyteg/p1functionspace/VertexDoFFunction.hpp>
 #include <hyteg/p2functionspace/P2Function.hpp>
@@ -40,6 +43,10 @@ namespace hyteg {
 
 using walberla::real_t;
 
+/// P1 to P2 operator with stencils that are approximated by polynomials on each macro-face (2D) or macro-cell (3D).
+///
+/// The 3D variant works as the one of P2SurrogateOperator, the stencils of the inner P2 DoFs of the macro-cells
+/// only couple to vertex-DoFs.
 template< class P1ToP2Form >
 class P1ToP2SurrogateOperator : public Operator<P1Function<real_t>, P2Function<real_t>>
 {
@@ -51,10 +58,20 @@ class P1ToP2SurrogateOperator : public Operator<P1Function<real_t>, P2Function<r
    {
       for (uint_t level = minLevel_; level <= maxLevel_; ++level)
       {
-         PrimitiveDataID<P1toP2::FacePolynomialMemory, Face> id;
-         auto dataHandling = std::make_shared<FaceP1toP2PolynomialMemoryDataHandling>();
-         storage_->addFaceData(id, dataHandling, "P1toP2OperatorFacePolynomial");
-         polynomialIDs_[level] = id;
+         if (storage_->hasGlobalCells())
+         {
+            PrimitiveDataID<P2::CellPolynomialMemory, Cell> id;
+            auto dataHandling = std::make_shared<CellP2PolynomialMemoryDataHandling>();
+            storage_->addCellData(id, dataHandling, "P1toP2OperatorCellPolynomial");
+            cellPolynomialIDs_[level] = id;
+         }
+         else
+         {
+            PrimitiveDataID<P1toP2::FacePolynomialMemory, Face> id;
+            auto dataHandling = std::make_shared<FaceP1toP2PolynomialMemoryDataHandling>();
+            storage_->addFaceData(id, dataHandling, "P1toP2OperatorFacePolynomial");
+            polynomialIDs_[level] = id;
+         }
       }
    }
 
@@ -70,6 +87,12 @@ class P1ToP2SurrogateOperator : public Operator<P1Function<real_t>, P2Function<r
 
    void interpolateStencils(uint_t polyDegree)
    {
+      if (storage_->hasGlobalCells())
+      {
+         interpolateStencils3D(polyDegree);
+         return;
+      }
+
       real_t  H = 1.0 / (walberla::real_c(levelinfo::num_microvertices_per_edge(interpolationLevel_) - 1));
 
       // stencil entries
@@ -165,6 +188,45 @@ class P1ToP2SurrogateOperator : public Operator<P1Function<real_t>, P2Function<r
       }
    }
 
+   void interpolateStencils3D(uint_t polyDegree)
+   {
+      WALBERLA_CHECK_GREATER_EQUAL(interpolationLevel_, uint_t(2), "There are no inner micro-vertices below level 2.");
+
+      const real_t H = 1.0 / walberla::real_c(levelinfo::num_microedges_per_edge(interpolationLevel_));
+
+      for (auto& it : storage_->getCells())
+      {
+         Cell& cell = *it.second;
+         form_.setGeometryMap(cell.getGeometryMap());
+
+         for (uint_t level = minLevel_; level <= maxLevel_; ++level)
+         {
+            auto& polynomials = cell.getData(cellPolynomialIDs_[level])
+                                    ->addDegree(polyDegree, P2::variablestencil::macrocell::numSurrogateStencilEntries(false));
+
+            for (uint_t rowType = 0; rowType < P2::CellPolynomialMemory::NumRowTypes; ++rowType)
+            {
+               const auto& layout = P2::variablestencil::macrocell::surrogateStencilLayout(rowType, false);
+
+               LSQPInterpolator3D<MonomialBasis3D> interpolator(polyDegree, interpolationLevel_, layout.entries.size());
+               std::vector<real_t>                 stencil(layout.entries.size());
+
+               // sample the stencils of the current level on the inner micro-vertices of the interpolation level
+               for (const auto& idx : vertexdof::macrocell::Iterator(interpolationLevel_, 1))
+               {
+                  const Point3D ref_x(
+                      {H * walberla::real_c(idx.x()), H * walberla::real_c(idx.y()), H * walberla::real_c(idx.z())});
+                  P2::variablestencil::macrocell::assembleSurrogateStencil<P1ToP2Form, Matrixr<10, 4>>(
+                      form_, cell, ref_x, level, layout, stencil);
+                  interpolator.addInterpolationPoint(ref_x, stencil);
+               }
+
+               interpolator.interpolate(polynomials[rowType]);
+            }
+         }
+      }
+   }
+
    void useDegree(uint_t degree) {polyDegree_ = degree;}
 
    void apply(const P1Function< real_t >& src,
@@ -176,6 +238,12 @@ class P1ToP2SurrogateOperator : public Operator<P1Function<real_t>, P2Function<r
 
       checkForMissingPolynomial(level);
 
+      if (storage_->hasGlobalCells())
+      {
+         apply3D(src, dst, level, flag, updateType);
+         return;
+      }
+
       communication::syncFunctionBetweenPrimitives(src, level);
 
       const vertexdof::VertexDoFFunction<real_t>&  dstVertexDoF   = dst.getVertexDoFFunction();
@@ -228,17 +296,64 @@ class P1ToP2SurrogateOperator : public Operator<P1Function<real_t>, P2Function<r
 
  private:
 
+   void apply3D(const P1Function< real_t >& src,
+                const P2Function< real_t >& dst,
+                size_t                      level,
+                DoFType                     flag,
+                UpdateType                  updateType) const
+   {
+      communication::syncFunctionBetweenPrimitives(src, level);
+
+      if (updateType == Replace)
+      {
+         // Only the flagged DoFs are zeroed here, the halos of the macro-cells are zeroed below.
+         dst.interpolate(walberla::real_c(0), level, flag);
+      }
+
+      P1ToP2Form form(form_);
+
+      for (auto& it : storage_->getCells())
+      {
+         Cell& cell = *it.second;
+         form.setGeometryMap(cell.getGeometryMap());
+
+         const real_t* srcData       = cell.getData(src.getCellDataID())->getPointer(level);
+         real_t*       dstVertexData = cell.getData(dst.getVertexDoFFunction().getCellDataID())->getPointer(level);
+         real_t*       dstEdgeData   = cell.getData(dst.getEdgeDoFFunction().getCellDataID())->getPointer(level);
+
+         // Zero out dst halos only, the contributions of all macro-cells are added up during the additive communication.
+         P2::variablestencil::macrocell::zeroMacroCellBoundary(level, dstVertexData, dstEdgeData);
+
+         P2::variablestencil::macrocell::applyPolynomial(polyDegree_, cellPolynomialIDs_.at(level), level, cell,
+                                                         srcData, nullptr, dstVertexData, dstEdgeData, updateType);
+
+         P2::variablestencil::macrocell::applyElementwiseOnMacroCellBoundary<P1ToP2Form, Matrixr<10, 4>>(
+            form, cell, level, srcData, nullptr, dstVertexData, dstEdgeData);
+      }
+
+      // Push result to lower-dimensional primitives
+      const DoFType excludeFlag = DoFType::All ^ flag;
+      dst.getVertexDoFFunction().communicateAdditively<Cell, Face>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getVertexDoFFunction().communicateAdditively<Cell, Edge>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getVertexDoFFunction().communicateAdditively<Cell, Vertex>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getEdgeDoFFunction().communicateAdditively<Cell, Face>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getEdgeDoFFunction().communicateAdditively<Cell, Edge>(level, excludeFlag, *storage_, updateType == Replace);
+   }
+
    inline void checkForMissingPolynomial(uint_t level) const
    {
-      WALBERLA_ASSERT(polynomialIDs_.count(level) > 0, "Polynomial for level " << level << " has not been interpolated");
+      WALBERLA_ASSERT(polynomialIDs_.count(level) > 0 || cellPolynomialIDs_.count(level) > 0,
+                      "Polynomial for level " << level << " has not been interpolated");
    }
 
    uint_t polyDegree_;
    uint_t interpolationLevel_;
    P1ToP2Form form_;
    std::map<uint_t, PrimitiveDataID<P1toP2::FacePolynomialMemory, Face>> polynomialIDs_;
+   std::map<uint_t, PrimitiveDataID<P2::CellPolynomialMemory, Cell>> cellPolynomialIDs_;
 };
 
 typedef P1ToP2SurrogateOperator< P1ToP2Form_divt< 0 >> P1ToP2SurrogateDivTxOperator;
 typedef P1ToP2SurrogateOperator< P1ToP2Form_divt< 1 >> P1ToP2SurrogateDivTyOperator;
+typedef P1ToP2SurrogateOperator< P1ToP2Form_divt< 2 >> P1ToP2SurrogateDivTzOperator;
 }
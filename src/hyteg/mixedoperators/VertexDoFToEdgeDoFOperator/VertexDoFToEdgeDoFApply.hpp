@@ -29,6 +29,7 @@
 #include "hyteg/LevelWiseMemory.hpp"
 #include "hyteg/p2functionspace/P2Elements3D.hpp"
 #include "hyteg/Algorithms.hpp"
+#include "hyteg/edgedofspace/EdgeDoFMacroCellStencil.hpp"
 #include "hyteg/edgedofspace/EdgeDoFMacroFace.hpp"
 
 namespace hyteg {
@@ -40,7 +41,7 @@ typedef std::map< uint_t, std::map< edgedof::EdgeDoFOrientation, std::map< index
 typedef std::map< uint_t, std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > > MacroFaceStencilMap_T;
 
 /// map[centerOrientation][indexOffset] = weight
-typedef std::map< edgedof::EdgeDoFOrientation, std::map< indexing::IndexIncrement, real_t > > MacroCellStencilMap_T;
+typedef edgedof::macrocell::VertexToEdgeFlatStencil MacroCellStencilMap_T;
 
 inline void applyEdge(const uint_t & Level, Edge &edge,
                       const PrimitiveDataID<StencilMemory < real_t >, Edge> &operatorId,
@@ -312,7 +313,7 @@ inline void applyCell(const uint_t & Level, Cell & cell,
                       const PrimitiveDataID<FunctionMemory< real_t >, Cell> &dstId,
                       UpdateType update){
 
-  auto opr_data = cell.getData(operatorId)->getData( Level );
+  const auto& opr_data = cell.getData(operatorId)->getData( Level );
   real_t * src  = cell.getData(srcId)->getPointer( Level );
   real_t * dst  = cell.getData(dstId)->getPointer( Level );
 
@@ -310,6 +310,21 @@ void VertexDoFToEdgeDoFOperator< VertexDoFToEdgeDoFForm >::apply( const P1Functi
 
    if ( level >= 1 )
    {
+      KernelRegion kernelRegion( std::string( "apply_3D_macrocell_vertexdof_to_edgedof_" ) +
+                                     ( updateType == Replace ? "replace" : "add" ),
+                                 level,
+                                 hyteg::globalDefines::useGeneratedKernels && storage_->hasGlobalCells() );
+      if ( kernelRegion.recordsStatistics() && !storage_->getCells().empty() )
+      {
+         const uint_t numMacroCells = kernelcost::numMacroPrimitivesWithFlag( storage_->getCells(), dst, flag );
+         kernelRegion.setCost(
+             kernelcost::constantStencilApply( numMacroCells * kernelcost::numInnerEdgeDoFsPerCell( level ),
+                                               numMacroCells * kernelcost::numInnerVertexDoFsPerCell( level ),
+                                               double( VertexDoFToEdgeDoF::MacroCellStencilMap_T::size() ) /
+                                                   double( edgedof::macrocell::numOrientations ),
+                                               updateType ) );
+      }
+
       std::vector< PrimitiveID > cellIDs = this->getStorage()->getCellIDs();
       #ifdef WALBERLA_BUILD_WITH_OPENMP
       #pragma omp parallel for default(shared)
@@ -326,7 +341,7 @@ void VertexDoFToEdgeDoFOperator< VertexDoFToEdgeDoFForm >::apply( const P1Functi
                typedef edgedof::EdgeDoFOrientation eo;
                auto                                dstData     = cell.getData( dst.getCellDataID() )->getPointer( level );
                auto                                srcData     = cell.getData( src.getCellDataID() )->getPointer( level );
-               auto                                stencilData = cell.getData( cellStencilID_ )->getData( level );
+               const auto                          stencilData = cell.getData( cellStencilID_ )->getData( level ).toMap();
                std::map< eo, uint_t >              firstIdx;
                for ( auto e : edgedof::allEdgeDoFOrientations )
                   firstIdx[e] = edgedof::macrocell::index( level, 0, 0, 0, e );
@@ -372,6 +387,20 @@ void VertexDoFToEdgeDoFOperator< VertexDoFToEdgeDoFForm >::apply( const P1Functi
 
    if ( level >= 1 )
    {
+      KernelRegion kernelRegion( std::string( "apply_2D_macroface_vertexdof_to_edgedof_" ) +
+                                     ( updateType == Replace ? "replace" : "add" ),
+                                 level,
+                                 hyteg::globalDefines::useGeneratedKernels && !storage_->hasGlobalCells() );
+      if ( kernelRegion.recordsStatistics() )
+      {
+         // 12 weights for the three edge DoF orientations
+         const uint_t numMacroFaces = kernelcost::numMacroPrimitivesWithFlag( storage_->getFaces(), dst, flag );
+         kernelRegion.setCost( kernelcost::constantStencilApply( numMacroFaces * kernelcost::numInnerEdgeDoFsPerFace( level ),
+                                                                 numMacroFaces * kernelcost::numInnerVertexDoFsPerFace( level ),
+                                                                 4.0,
+                                                                 updateType ) );
+      }
+
       std::vector< PrimitiveID > faceIDs = this->getStorage()->getFaceIDs();
       #ifdef WALBERLA_BUILD_WITH_OPENMP
       #pragma omp parallel for default(shared)
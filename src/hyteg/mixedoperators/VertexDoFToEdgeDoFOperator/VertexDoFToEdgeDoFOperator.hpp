@@ -210,7 +210,7 @@ void assembleVertexToEdgeStencils(
                    edgedof::macrocell::getInnerIndexByOrientation( centerOrientation ), centerOrientation, cell, level, form );
                for ( const auto stencilIt : vertexToEdgeStencilMap )
                {
-                  vertexToEdgeStencilMemory[centerOrientation][stencilIt.first] = stencilIt.second;
+                  vertexToEdgeStencilMemory[centerOrientation].at( stencilIt.first ) = stencilIt.second;
                }
             }
          }
@@ -271,7 +271,7 @@ inline void saveCellOperator( const uint_t & Level, const Cell & cell,
                               const PrimitiveDataID< FunctionMemory< PetscInt >, Cell> & dstId,
                               const std::shared_ptr< SparseMatrixProxy > & mat )
 {
-  auto opr_data = cell.getData( operatorId )->getData( Level );
+  const auto& opr_data = cell.getData( operatorId )->getData( Level );
   const PetscInt *src = cell.getData( srcId )->getPointer( Level );
   const PetscInt *dst = cell.getData( dstId )->getPointer( Level );
 
@@ -30,6 +30,7 @@
 #pragma warning( pop )
 #endif
 
+#include "hyteg/KernelInstrumentation.hpp"
 #include "hyteg/LevelWiseMemory.hpp"
 #include "hyteg/forms/P1RowSumForm.hpp"
 #include "hyteg/forms/form_fenics_base/P1ToP2FenicsForm.hpp"
@@ -80,9 +81,10 @@ P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::P1ConstantOperat
     const P1Form&                              form )
 : Operator( storage, minLevel, maxLevel )
 , form_( form )
+, overlapCommunication_( false )
 {
    auto cellP1StencilMemoryDataHandling =
-       std::make_shared< LevelWiseMemoryDataHandling< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell > >(
+       std::make_shared< LevelWiseMemoryDataHandling< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell > >(
            minLevel_, maxLevel_ );
 
    auto face3DP1StencilMemoryDataHandling =
@@ -618,14 +620,74 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply( cons
    WALBERLA_ASSERT_NOT_IDENTICAL( std::addressof( src ), std::addressof( dst ) );
 
    this->startTiming( "Apply" );
-   src.communicate< Vertex, Edge >( level );
-   src.communicate< Edge, Face >( level );
-   src.communicate< Face, Cell >( level );
 
-   src.communicate< Cell, Face >( level );
-   src.communicate< Face, Edge >( level );
-   src.communicate< Edge, Vertex >( level );
+   if ( !overlapCommunication_ )
+   {
+      src.communicate< Vertex, Edge >( level );
+      src.communicate< Edge, Face >( level );
+      src.communicate< Face, Cell >( level );
+
+      src.communicate< Cell, Face >( level );
+      src.communicate< Face, Edge >( level );
+      src.communicate< Edge, Vertex >( level );
+
+      apply_macro_vertices( src, dst, level, flag, updateType );
+      apply_macro_edges( src, dst, level, flag, updateType );
+      apply_macro_faces( src, dst, level, flag, updateType );
+      apply_macro_cells( src, dst, level, flag, updateType );
+   }
+   else if ( storage_->hasGlobalCells() )
+   {
+      // The interior of the macro-cells does not read the ghost layers. It is processed while the
+      // ghost layers are received from the macro-faces, the boundary layer afterwards. The exchange
+      // towards the macro-faces is completed while the boundary layer is processed.
+      src.communicate< Vertex, Edge >( level );
+      src.communicate< Edge, Face >( level );
+
+      src.startCommunication< Face, Cell >( level );
+      apply_macro_cells( src, dst, level, flag, updateType, vertexdof::macrocell::InnerVertexRegion::INTERIOR );
+      src.endCommunication< Face, Cell >( level );
+
+      src.startCommunication< Cell, Face >( level );
+      apply_macro_cells( src, dst, level, flag, updateType, vertexdof::macrocell::InnerVertexRegion::BOUNDARY_LAYER );
+      src.endCommunication< Cell, Face >( level );
+
+      src.communicate< Face, Edge >( level );
+      src.communicate< Edge, Vertex >( level );
+
+      apply_macro_vertices( src, dst, level, flag, updateType );
+      apply_macro_edges( src, dst, level, flag, updateType );
+      apply_macro_faces( src, dst, level, flag, updateType );
+   }
+   else
+   {
+      // The macro-faces only read their own ghost layers. The exchange towards the macro-edges
+      // is completed while the macro-faces are processed.
+      src.communicate< Vertex, Edge >( level );
+
+      src.startCommunication< Edge, Face >( level );
+      src.startCommunication< Face, Edge >( level );
+
+      src.endCommunication< Edge, Face >( level );
+      apply_macro_faces( src, dst, level, flag, updateType );
+      src.endCommunication< Face, Edge >( level );
+
+      src.communicate< Edge, Vertex >( level );
+
+      apply_macro_vertices( src, dst, level, flag, updateType );
+      apply_macro_edges( src, dst, level, flag, updateType );
+   }
+
+   this->stopTiming( "Apply" );
+}
 
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply_macro_vertices( const P1Function< real_t >& src,
+                                                                                           const P1Function< real_t >& dst,
+                                                                                           size_t                      level,
+                                                                                           DoFType                     flag,
+                                                                                           UpdateType                  updateType) const
+{
    this->timingTree_->start( "Macro-Vertex" );
 
    std::vector< PrimitiveID > vertexIDs = this->getStorage()->getVertexIDs();
@@ -645,7 +707,15 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply( cons
    }
 
    this->timingTree_->stop( "Macro-Vertex" );
+}
 
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply_macro_edges( const P1Function< real_t >& src,
+                                                                                        const P1Function< real_t >& dst,
+                                                                                        size_t                      level,
+                                                                                        DoFType                     flag,
+                                                                                        UpdateType                  updateType) const
+{
    this->timingTree_->start( "Macro-Edge" );
 
    if ( level >= 1 )
@@ -668,9 +738,28 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply( cons
    }
 
    this->timingTree_->stop( "Macro-Edge" );
+}
 
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply_macro_faces( const P1Function< real_t >& src,
+                                                                                        const P1Function< real_t >& dst,
+                                                                                        size_t                      level,
+                                                                                        DoFType                     flag,
+                                                                                        UpdateType                  updateType) const
+{
    this->timingTree_->start( "Macro-Face" );
 
+   KernelRegion kernelRegion( std::string( "apply_2D_macroface_vertexdof_to_vertexdof_" ) +
+                                  ( updateType == Replace ? "replace" : "add" ),
+                              level,
+                              globalDefines::useGeneratedKernels && level >= 2 && !storage_->hasGlobalCells() );
+   if ( kernelRegion.recordsStatistics() )
+   {
+      const uint_t numDoFs = kernelcost::numMacroPrimitivesWithFlag( storage_->getFaces(), dst, flag ) *
+                             kernelcost::numInnerVertexDoFsPerFace( level );
+      kernelRegion.setCost( kernelcost::constantStencilApply( numDoFs, 7, updateType ) );
+   }
+
    if ( level >= 2 )
    {
       std::vector< PrimitiveID > faceIDs = this->getStorage()->getFaceIDs();
@@ -817,9 +906,33 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply( cons
    }
 
    this->timingTree_->stop( "Macro-Face" );
+}
 
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply_macro_cells( const P1Function< real_t >&             src,
+                                                                                        const P1Function< real_t >&             dst,
+                                                                                        size_t                                  level,
+                                                                                        DoFType                                 flag,
+                                                                                        UpdateType                              updateType,
+                                                                                        vertexdof::macrocell::InnerVertexRegion region ) const
+{
    this->timingTree_->start( "Macro-Cell" );
 
+   // the generated kernels cannot be restricted to a part of the macro-cell
+   const bool useGeneratedKernels =
+       hyteg::globalDefines::useGeneratedKernels && region == vertexdof::macrocell::InnerVertexRegion::ALL;
+
+   KernelRegion kernelRegion( std::string( "apply_3D_macrocell_vertexdof_to_vertexdof_" ) +
+                                  ( updateType == Replace ? "replace" : "add" ),
+                              level,
+                              useGeneratedKernels && level >= 2 && storage_->hasGlobalCells() );
+   if ( kernelRegion.recordsStatistics() )
+   {
+      const uint_t numDoFs = kernelcost::numMacroPrimitivesWithFlag( storage_->getCells(), dst, flag ) *
+                             kernelcost::numInnerVertexDoFsPerCell( level );
+      kernelRegion.setCost( kernelcost::constantStencilApply( numDoFs, 15, updateType ) );
+   }
+
    if ( level >= 2 )
    {
       std::vector< PrimitiveID > cellIDs = this->getStorage()->getCellIDs();
@@ -833,34 +946,32 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::apply( cons
          const DoFType cellBC = dst.getBoundaryCondition().getBoundaryType( cell.getMeshBoundaryFlag() );
          if ( testFlag( cellBC, flag ) )
          {
-            if ( hyteg::globalDefines::useGeneratedKernels )
+            if ( useGeneratedKernels )
             {
-               auto    opr_data = cell.getData( cellStencilID_ )->getData( level );
-               real_t* src_data = cell.getData( src.getCellDataID() )->getPointer( level );
-               real_t* dst_data = cell.getData( dst.getCellDataID() )->getPointer( level );
+               const auto& opr_data = cell.getData( cellStencilID_ )->getData( level );
+               real_t*     src_data = cell.getData( src.getCellDataID() )->getPointer( level );
+               real_t*     dst_data = cell.getData( dst.getCellDataID() )->getPointer( level );
                if ( updateType == Replace )
                {
                   vertexdof::macrocell::generated::apply_3D_macrocell_vertexdof_to_vertexdof_replace(
-                      dst_data, src_data, static_cast< int32_t >( level ), opr_data );
+                      dst_data, src_data, static_cast< int32_t >( level ), opr_data.toMap() );
                }
                else if ( updateType == Add )
                {
                   vertexdof::macrocell::generated::apply_3D_macrocell_vertexdof_to_vertexdof_add(
-                      dst_data, src_data, static_cast< int32_t >( level ), opr_data );
+                      dst_data, src_data, static_cast< int32_t >( level ), opr_data.toMap() );
                }
             }
             else
             {
                vertexdof::macrocell::apply< real_t >(
-                   level, cell, cellStencilID_, src.getCellDataID(), dst.getCellDataID(), updateType );
+                   level, cell, cellStencilID_, src.getCellDataID(), dst.getCellDataID(), updateType, region );
             }
          }
       }
    }
 
    this->timingTree_->stop( "Macro-Cell" );
-
-   this->stopTiming( "Apply" );
 }
 
 template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
@@ -1036,11 +1147,11 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_gs(
       {
          if ( globalDefines::useGeneratedKernels )
          {
-            auto rhs_data = cell.getData( rhs.getCellDataID() )->getPointer( level );
-            auto dst_data = cell.getData( dst.getCellDataID() )->getPointer( level );
-            auto stencil  = cell.getData( cellStencilID_ )->getData( level );
+            auto        rhs_data = cell.getData( rhs.getCellDataID() )->getPointer( level );
+            auto        dst_data = cell.getData( dst.getCellDataID() )->getPointer( level );
+            const auto& stencil  = cell.getData( cellStencilID_ )->getData( level );
             vertexdof::macrocell::generated::gaussseidel_3D_macrocell_P1(
-                dst_data, rhs_data, static_cast< int32_t >( level ), stencil );
+                dst_data, rhs_data, static_cast< int32_t >( level ), stencil.toMap() );
          }
          else
          {
@@ -1117,6 +1228,16 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor_
 {
    this->timingTree_->start( "Macro-Face" );
 
+   KernelRegion kernelRegion( std::string( "sor_2D_macroface_vertexdof_to_vertexdof" ) + ( backwards ? "_backwards" : "" ),
+                              level,
+                              globalDefines::useGeneratedKernels && level >= 2 && !storage_->hasGlobalCells() );
+   if ( kernelRegion.recordsStatistics() )
+   {
+      const uint_t numDoFs = kernelcost::numMacroPrimitivesWithFlag( storage_->getFaces(), dst, flag ) *
+                             kernelcost::numInnerVertexDoFsPerFace( level );
+      kernelRegion.setCost( kernelcost::constantStencilSOR( numDoFs, 7 ) );
+   }
+
    for ( auto& it : storage_->getFaces() )
    {
       Face& face = *it.second;
@@ -1328,6 +1449,16 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor_
 {
    this->timingTree_->start( "Macro-Cell" );
 
+   KernelRegion kernelRegion( std::string( "sor_3D_macrocell_P1" ) + ( backwards ? "_backwards" : "" ),
+                              level,
+                              globalDefines::useGeneratedKernels && level >= 2 && storage_->hasGlobalCells() );
+   if ( kernelRegion.recordsStatistics() )
+   {
+      const uint_t numDoFs = kernelcost::numMacroPrimitivesWithFlag( storage_->getCells(), dst, flag ) *
+                             kernelcost::numInnerVertexDoFsPerCell( level );
+      kernelRegion.setCost( kernelcost::constantStencilSOR( numDoFs, 15 ) );
+   }
+
    for ( auto& it : storage_->getCells() )
    {
       Cell& cell = *it.second;
@@ -1337,19 +1468,19 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor_
       {
          if ( globalDefines::useGeneratedKernels )
          {
-            auto rhs_data = cell.getData( rhs.getCellDataID() )->getPointer( level );
-            auto dst_data = cell.getData( dst.getCellDataID() )->getPointer( level );
-            auto stencil  = cell.getData( cellStencilID_ )->getData( level );
+            auto        rhs_data = cell.getData( rhs.getCellDataID() )->getPointer( level );
+            auto        dst_data = cell.getData( dst.getCellDataID() )->getPointer( level );
+            const auto& stencil  = cell.getData( cellStencilID_ )->getData( level );
 
             if ( backwards )
             {
                vertexdof::macrocell::generated::sor_3D_macrocell_P1_backwards(
-                   dst_data, rhs_data, static_cast< int32_t >( level ), stencil, relax );
+                   dst_data, rhs_data, static_cast< int32_t >( level ), stencil.toMap(), relax );
             }
             else
             {
                vertexdof::macrocell::generated::sor_3D_macrocell_P1(
-                   dst_data, rhs_data, static_cast< int32_t >( level ), stencil, relax );
+                   dst_data, rhs_data, static_cast< int32_t >( level ), stencil.toMap(), relax );
             }
          }
          else
@@ -1429,6 +1560,100 @@ void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor(
       this->stopTiming( "SOR" );
 }
 
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor_multicolor_macro_faces( const P1Function< real_t >& dst,
+                                                                                                        const P1Function< real_t >& rhs,
+                                                                                                        real_t                      relax,
+                                                                                                        size_t                      level,
+                                                                                                        DoFType                     flag ) const
+{
+   this->timingTree_->start( "Macro-Face" );
+
+   for ( auto& it : storage_->getFaces() )
+   {
+      Face& face = *it.second;
+
+      const DoFType faceBC = dst.getBoundaryCondition().getBoundaryType( face.getMeshBoundaryFlag() );
+      if ( testFlag( faceBC, flag ) )
+      {
+         vertexdof::macroface::smooth_sor_multicolor< real_t >(
+             level, face, faceStencilID_, dst.getFaceDataID(), rhs.getFaceDataID(), relax );
+      }
+   }
+
+   this->timingTree_->stop( "Macro-Face" );
+}
+
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor_multicolor_macro_cells( const P1Function< real_t >& dst,
+                                                                                                        const P1Function< real_t >& rhs,
+                                                                                                        real_t                      relax,
+                                                                                                        size_t                      level,
+                                                                                                        DoFType                     flag ) const
+{
+   this->timingTree_->start( "Macro-Cell" );
+
+   std::vector< PrimitiveID > cellIDs = storage_->getCellIDs();
+
+   #ifdef WALBERLA_BUILD_WITH_OPENMP
+   #pragma omp parallel for default(shared)
+   #endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
+   {
+      Cell& cell = *storage_->getCell( cellIDs[uint_c( i )] );
+
+      const DoFType cellBC = dst.getBoundaryCondition().getBoundaryType( cell.getMeshBoundaryFlag() );
+      if ( testFlag( cellBC, flag ) )
+      {
+         vertexdof::macrocell::smooth_sor_multicolor< real_t >(
+             level, cell, cellStencilID_, dst.getCellDataID(), rhs.getCellDataID(), relax );
+      }
+   }
+
+   this->timingTree_->stop( "Macro-Cell" );
+}
+
+template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
+void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_sor_multicolor( const P1Function< real_t >& dst,
+                                                                                            const P1Function< real_t >& rhs,
+                                                                                            real_t                      relax,
+                                                                                            size_t                      level,
+                                                                                            DoFType                     flag ) const
+{
+   this->startTiming( "SOR multi-color" );
+
+   dst.communicate< Vertex, Edge >( level );
+   dst.communicate< Edge, Face >( level );
+   dst.communicate< Face, Cell >( level );
+
+   dst.communicate< Cell, Face >( level );
+   dst.communicate< Face, Edge >( level );
+   dst.communicate< Edge, Vertex >( level );
+
+   smooth_sor_macro_vertices( dst, rhs, relax, level, flag );
+
+   dst.communicate< Vertex, Edge >( level );
+
+   smooth_sor_macro_edges( dst, rhs, relax, level, flag );
+
+   dst.communicate< Edge, Face >( level );
+
+   if ( storage_->hasGlobalCells() )
+   {
+      smooth_sor_macro_faces( dst, rhs, relax, level, flag );
+
+      dst.communicate< Face, Cell >( level );
+
+      smooth_sor_multicolor_macro_cells( dst, rhs, relax, level, flag );
+   }
+   else
+   {
+      smooth_sor_multicolor_macro_faces( dst, rhs, relax, level, flag );
+   }
+
+   this->stopTiming( "SOR multi-color" );
+}
+
 template < class P1Form, bool Diagonal, bool Lumped, bool InvertDiagonal >
 void P1ConstantOperator< P1Form, Diagonal, Lumped, InvertDiagonal >::smooth_jac( const P1Function< real_t >& dst,
                                                                                  const P1Function< real_t >& rhs,
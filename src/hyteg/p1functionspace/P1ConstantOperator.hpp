@@ -25,6 +25,7 @@
 #include "hyteg/Operator.hpp"
 #include "hyteg/StencilMemory.hpp"
 #include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
 #include "hyteg/LevelWiseMemory.hpp"
 #include "hyteg/p1functionspace/P1Function.hpp"
 #include "hyteg/forms/form_fenics_base/P1FenicsForm.hpp"
@@ -54,6 +55,15 @@ class P1ConstantOperator : public Operator< P1Function< real_t >, P1Function< re
                DoFType                     flag,
                UpdateType                  updateType = Replace ) const;
 
+   /// Enables or disables the overlap of the halo exchange with the computation in apply().
+   ///
+   /// If enabled, the exchange towards the lower-dimensional primitives is completed while the
+   /// macro-faces are processed in 2D. In 3D, the interior of the macro-cells is processed while their
+   /// ghost layers are received, the boundary layer of the macro-cells afterwards. Disabled by default.
+   void setCommunicationOverlap( bool overlap ) { overlapCommunication_ = overlap; }
+
+   bool getCommunicationOverlap() const { return overlapCommunication_; }
+
    void smooth_gs( const P1Function< real_t >& dst, const P1Function< real_t >& rhs, size_t level, DoFType flag ) const;
 
    void smooth_gs_backwards( const P1Function< real_t >& dst, const P1Function< real_t >& rhs, size_t level, DoFType flag ) const
@@ -77,6 +87,23 @@ class P1ConstantOperator : public Operator< P1Function< real_t >, P1Function< re
       smooth_sor( dst, rhs, relax, level, flag, true );
     }
 
+   /// Multi-color SOR.
+   ///
+   /// The inner DoFs of the macro-faces (2D) and macro-cells (3D) are updated color by color instead of in
+   /// lexicographic order, so that the update of one color is independent of the traversal order.
+   /// 3 colors are used in 2D and 4 colors in 3D since the stencils couple the diagonal neighbors.
+   /// The DoFs on the lower-dimensional macro-primitives are relaxed as in smooth_sor().
+   void smooth_sor_multicolor( const P1Function< real_t >& dst,
+                               const P1Function< real_t >& rhs,
+                               real_t                      relax,
+                               size_t                      level,
+                               DoFType                     flag ) const;
+
+   void smooth_gs_multicolor( const P1Function< real_t >& dst, const P1Function< real_t >& rhs, size_t level, DoFType flag ) const
+   {
+      smooth_sor_multicolor( dst, rhs, 1.0, level, flag );
+   }
+
 
    void smooth_jac( const P1Function< real_t >& dst,
                     const P1Function< real_t >& rhs,
@@ -119,7 +146,7 @@ class P1ConstantOperator : public Operator< P1Function< real_t >, P1Function< re
 
    const PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face >& getFaceStencil3DID() const { return faceStencil3DID_; }
 
-   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >& getCellStencilID() const { return cellStencilID_; }
+   const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&  getCellStencilID() const { return cellStencilID_; }
 
  private:
    void assembleStencils();
@@ -136,6 +163,33 @@ class P1ConstantOperator : public Operator< P1Function< real_t >, P1Function< re
    std::shared_ptr< P1Function< real_t > > diagonalValues_;
    std::shared_ptr< P1Function< real_t > > inverseDiagonalValues_;
 
+   void apply_macro_vertices( const P1Function< real_t >& src,
+                              const P1Function< real_t >& dst,
+                              size_t                      level,
+                              DoFType                     flag,
+                              UpdateType                  updateType ) const;
+
+   void apply_macro_edges( const P1Function< real_t >& src,
+                           const P1Function< real_t >& dst,
+                           size_t                      level,
+                           DoFType                     flag,
+                           UpdateType                  updateType ) const;
+
+   void apply_macro_faces( const P1Function< real_t >& src,
+                           const P1Function< real_t >& dst,
+                           size_t                      level,
+                           DoFType                     flag,
+                           UpdateType                  updateType ) const;
+
+   /// Applies the operator to the passed region of the inner micro-vertices of the macro-cells.
+   /// A region other than ALL is always processed by the non-generated kernel.
+   void apply_macro_cells( const P1Function< real_t >&             src,
+                           const P1Function< real_t >&             dst,
+                           size_t                                  level,
+                           DoFType                                 flag,
+                           UpdateType                              updateType,
+                           vertexdof::macrocell::InnerVertexRegion region = vertexdof::macrocell::InnerVertexRegion::ALL ) const;
+
    void smooth_sor_macro_vertices( const P1Function< real_t >& dst,
                                    const P1Function< real_t >& rhs,
                                    real_t                      relax,
@@ -164,14 +218,28 @@ class P1ConstantOperator : public Operator< P1Function< real_t >, P1Function< re
                                 DoFType                     flag,
                                 const bool&                 backwards = false ) const;
 
+   void smooth_sor_multicolor_macro_faces( const P1Function< real_t >& dst,
+                                           const P1Function< real_t >& rhs,
+                                           real_t                      relax,
+                                           size_t                      level,
+                                           DoFType                     flag ) const;
+
+   void smooth_sor_multicolor_macro_cells( const P1Function< real_t >& dst,
+                                           const P1Function< real_t >& rhs,
+                                           real_t                      relax,
+                                           size_t                      level,
+                                           DoFType                     flag ) const;
+
    PrimitiveDataID< StencilMemory< real_t >, Vertex > vertexStencilID_;
    PrimitiveDataID< StencilMemory< real_t >, Edge >   edgeStencilID_;
    PrimitiveDataID< LevelWiseMemory< vertexdof::macroedge::StencilMap_T >, Edge > edgeStencil3DID_;
    PrimitiveDataID< StencilMemory< real_t >, Face >   faceStencilID_;
    PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face > faceStencil3DID_;
-   PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell > cellStencilID_;
+   PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >  cellStencilID_;
 
    P1Form form_;
+
+   bool overlapCommunication_;
 };
 
 typedef P1ConstantOperator< P1FenicsForm< fenics::NoAssemble, fenics::NoAssemble > > P1ZeroOperator;
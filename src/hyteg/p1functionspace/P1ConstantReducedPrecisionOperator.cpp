@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "P1ConstantReducedPrecisionOperator.hpp"
+
+#include "core/OpenMP.h"
+
+#include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroEdge.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroVertex.hpp"
+#include "hyteg/p1functionspace/VertexDoFMemory.hpp"
+
+namespace hyteg {
+
+using walberla::int_c;
+
+template < typename ValueType >
+P1ConstantReducedPrecisionOperator< ValueType >::P1ConstantReducedPrecisionOperator(
+    const std::shared_ptr< PrimitiveStorage >&                                              storage,
+    uint_t                                                                                  minLevel,
+    uint_t                                                                                  maxLevel,
+    const PrimitiveDataID< StencilMemory< real_t >, Vertex >&                               sourceVertexStencilID,
+    const PrimitiveDataID< StencilMemory< real_t >, Edge >&                                 sourceEdgeStencilID,
+    const PrimitiveDataID< StencilMemory< real_t >, Face >&                                 sourceFaceStencilID,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face >& sourceFaceStencil3DID,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&  sourceCellStencilID )
+: Operator< P1Function< ValueType >, P1Function< ValueType > >( storage, minLevel, maxLevel )
+, faceStencil3DID_( sourceFaceStencil3DID )
+, cellStencilID_( sourceCellStencilID )
+{
+   auto vertexStencilMemoryDataHandling = std::make_shared< MemoryDataHandling< StencilMemory< ValueType >, Vertex > >(
+       minLevel, maxLevel, vertexDoFMacroVertexStencilMemorySize );
+   auto edgeStencilMemoryDataHandling = std::make_shared< MemoryDataHandling< StencilMemory< ValueType >, Edge > >(
+       minLevel, maxLevel, vertexDoFMacroEdgeStencilMemorySize );
+   auto faceStencilMemoryDataHandling = std::make_shared< MemoryDataHandling< StencilMemory< ValueType >, Face > >(
+       minLevel, maxLevel, vertexDoFMacroFaceStencilMemorySize );
+
+   storage->addVertexData( vertexStencilID_, vertexStencilMemoryDataHandling, "P1ReducedPrecisionOperatorVertexStencil" );
+   storage->addEdgeData( edgeStencilID_, edgeStencilMemoryDataHandling, "P1ReducedPrecisionOperatorEdgeStencil" );
+   storage->addFaceData( faceStencilID_, faceStencilMemoryDataHandling, "P1ReducedPrecisionOperatorFaceStencil" );
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      for ( const auto& it : storage->getVertices() )
+      {
+         it.second->getData( vertexStencilID_ )->copyFrom( *it.second->getData( sourceVertexStencilID ), level );
+      }
+
+      for ( const auto& it : storage->getEdges() )
+      {
+         it.second->getData( edgeStencilID_ )->copyFrom( *it.second->getData( sourceEdgeStencilID ), level );
+      }
+
+      for ( const auto& it : storage->getFaces() )
+      {
+         it.second->getData( faceStencilID_ )->copyFrom( *it.second->getData( sourceFaceStencilID ), level );
+      }
+   }
+}
+
+template < typename ValueType >
+void P1ConstantReducedPrecisionOperator< ValueType >::apply( const P1Function< ValueType >& src,
+                                                             const P1Function< ValueType >& dst,
+                                                             size_t                         level,
+                                                             DoFType                        flag,
+                                                             UpdateType                     updateType ) const
+{
+   WALBERLA_ASSERT_NOT_IDENTICAL( std::addressof( src ), std::addressof( dst ) );
+
+   this->startTiming( "Apply" );
+
+   src.template communicate< Vertex, Edge >( level );
+   src.template communicate< Edge, Face >( level );
+   src.template communicate< Face, Cell >( level );
+
+   src.template communicate< Cell, Face >( level );
+   src.template communicate< Face, Edge >( level );
+   src.template communicate< Edge, Vertex >( level );
+
+   for ( const auto& it : this->storage_->getVertices() )
+   {
+      Vertex& vertex = *it.second;
+
+      const DoFType vertexBC = dst.getBoundaryCondition().getBoundaryType( vertex.getMeshBoundaryFlag() );
+      if ( testFlag( vertexBC, flag ) )
+      {
+         vertexdof::macrovertex::apply< ValueType >(
+             vertex, vertexStencilID_, src.getVertexDataID(), dst.getVertexDataID(), level, updateType );
+      }
+   }
+
+   if ( level >= 1 )
+   {
+      for ( const auto& it : this->storage_->getEdges() )
+      {
+         Edge& edge = *it.second;
+
+         const DoFType edgeBC = dst.getBoundaryCondition().getBoundaryType( edge.getMeshBoundaryFlag() );
+         if ( testFlag( edgeBC, flag ) )
+         {
+            vertexdof::macroedge::apply< ValueType >(
+                level, edge, edgeStencilID_, src.getEdgeDataID(), dst.getEdgeDataID(), updateType );
+         }
+      }
+   }
+
+   if ( level >= 2 )
+   {
+      for ( const auto& it : this->storage_->getFaces() )
+      {
+         Face& face = *it.second;
+
+         const DoFType faceBC = dst.getBoundaryCondition().getBoundaryType( face.getMeshBoundaryFlag() );
+         if ( testFlag( faceBC, flag ) )
+         {
+            if ( this->storage_->hasGlobalCells() )
+            {
+               vertexdof::macroface::apply3D< ValueType >(
+                   level, face, *this->storage_, faceStencil3DID_, src.getFaceDataID(), dst.getFaceDataID(), updateType );
+            }
+            else
+            {
+               vertexdof::macroface::apply< ValueType >(
+                   level, face, faceStencilID_, src.getFaceDataID(), dst.getFaceDataID(), updateType );
+            }
+         }
+      }
+
+      std::vector< PrimitiveID > cellIDs = this->storage_->getCellIDs();
+      #ifdef WALBERLA_BUILD_WITH_OPENMP
+      #pragma omp parallel for default(shared)
+      #endif
+      for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
+      {
+         Cell& cell = *this->storage_->getCell( cellIDs[uint_c( i )] );
+
+         const DoFType cellBC = dst.getBoundaryCondition().getBoundaryType( cell.getMeshBoundaryFlag() );
+         if ( testFlag( cellBC, flag ) )
+         {
+            vertexdof::macrocell::apply< ValueType >(
+                level, cell, cellStencilID_, src.getCellDataID(), dst.getCellDataID(), updateType );
+         }
+      }
+   }
+
+   this->stopTiming( "Apply" );
+}
+
+template < typename ValueType >
+void P1ConstantReducedPrecisionOperator< ValueType >::smooth_sor_macro_vertices( const P1Function< ValueType >& dst,
+                                                                                 const P1Function< ValueType >& rhs,
+                                                                                 ValueType                      relax,
+                                                                                 size_t                         level,
+                                                                                 DoFType                        flag ) const
+{
+   for ( const auto& it : this->storage_->getVertices() )
+   {
+      Vertex& vertex = *it.second;
+
+      const DoFType vertexBC = dst.getBoundaryCondition().getBoundaryType( vertex.getMeshBoundaryFlag() );
+      if ( testFlag( vertexBC, flag ) )
+      {
+         vertexdof::macrovertex::smooth_sor< ValueType >(
+             vertex, vertexStencilID_, dst.getVertexDataID(), rhs.getVertexDataID(), level, relax );
+      }
+   }
+}
+
+template < typename ValueType >
+void P1ConstantReducedPrecisionOperator< ValueType >::smooth_sor_macro_edges( const P1Function< ValueType >& dst,
+                                                                              const P1Function< ValueType >& rhs,
+                                                                              ValueType                      relax,
+                                                                              size_t                         level,
+                                                                              DoFType                        flag ) const
+{
+   for ( const auto& it : this->storage_->getEdges() )
+   {
+      Edge& edge = *it.second;
+
+      const DoFType edgeBC = dst.getBoundaryCondition().getBoundaryType( edge.getMeshBoundaryFlag() );
+      if ( testFlag( edgeBC, flag ) )
+      {
+         vertexdof::macroedge::smooth_sor< ValueType >(
+             level, edge, edgeStencilID_, dst.getEdgeDataID(), rhs.getEdgeDataID(), relax );
+      }
+   }
+}
+
+template < typename ValueType >
+void P1ConstantReducedPrecisionOperator< ValueType >::smooth_sor( const P1Function< ValueType >& dst,
+                                                                  const P1Function< ValueType >& rhs,
+                                                                  real_t                         relax,
+                                                                  size_t                         level,
+                                                                  DoFType                        flag ) const
+{
+   this->startTiming( "SOR" );
+
+   const auto relaxValue = static_cast< ValueType >( relax );
+
+   dst.template communicate< Vertex, Edge >( level );
+   dst.template communicate< Edge, Face >( level );
+   dst.template communicate< Face, Cell >( level );
+
+   dst.template communicate< Cell, Face >( level );
+   dst.template communicate< Face, Edge >( level );
+   dst.template communicate< Edge, Vertex >( level );
+
+   smooth_sor_macro_vertices( dst, rhs, relaxValue, level, flag );
+
+   dst.template communicate< Vertex, Edge >( level );
+
+   smooth_sor_macro_edges( dst, rhs, relaxValue, level, flag );
+
+   dst.template communicate< Edge, Face >( level );
+
+   for ( const auto& it : this->storage_->getFaces() )
+   {
+      Face& face = *it.second;
+
+      const DoFType faceBC = dst.getBoundaryCondition().getBoundaryType( face.getMeshBoundaryFlag() );
+      if ( testFlag( faceBC, flag ) )
+      {
+         if ( this->storage_->hasGlobalCells() )
+         {
+            vertexdof::macroface::smoothSOR3D< ValueType >(
+                level, face, *this->storage_, faceStencil3DID_, dst.getFaceDataID(), rhs.getFaceDataID(), relaxValue );
+         }
+         else
+         {
+            vertexdof::macroface::smooth_sor< ValueType >(
+                level, face, faceStencilID_, dst.getFaceDataID(), rhs.getFaceDataID(), relaxValue );
+         }
+      }
+   }
+
+   dst.template communicate< Face, Cell >( level );
+
+   for ( const auto& it : this->storage_->getCells() )
+   {
+      Cell& cell = *it.second;
+
+      const DoFType cellBC = dst.getBoundaryCondition().getBoundaryType( cell.getMeshBoundaryFlag() );
+      if ( testFlag( cellBC, flag ) )
+      {
+         vertexdof::macrocell::smooth_sor< ValueType >(
+             level, cell, cellStencilID_, dst.getCellDataID(), rhs.getCellDataID(), relaxValue );
+      }
+   }
+
+   this->stopTiming( "SOR" );
+}
+
+template < typename ValueType >
+void P1ConstantReducedPrecisionOperator< ValueType >::smooth_sor_multicolor( const P1Function< ValueType >& dst,
+                                                                             const P1Function< ValueType >& rhs,
+                                                                             real_t                         relax,
+                                                                             size_t                         level,
+                                                                             DoFType                        flag ) const
+{
+   this->startTiming( "SOR multi-color" );
+
+   const auto relaxValue = static_cast< ValueType >( relax );
+
+   dst.template communicate< Vertex, Edge >( level );
+   dst.template communicate< Edge, Face >( level );
+   dst.template communicate< Face, Cell >( level );
+
+   dst.template communicate< Cell, Face >( level );
+   dst.template communicate< Face, Edge >( level );
+   dst.template communicate< Edge, Vertex >( level );
+
+   smooth_sor_macro_vertices( dst, rhs, relaxValue, level, flag );
+
+   dst.template communicate< Vertex, Edge >( level );
+
+   smooth_sor_macro_edges( dst, rhs, relaxValue, level, flag );
+
+   dst.template communicate< Edge, Face >( level );
+
+   for ( const auto& it : this->storage_->getFaces() )
+   {
+      Face& face = *it.second;
+
+      const DoFType faceBC = dst.getBoundaryCondition().getBoundaryType( face.getMeshBoundaryFlag() );
+      if ( testFlag( faceBC, flag ) )
+      {
+         if ( this->storage_->hasGlobalCells() )
+         {
+            vertexdof::macroface::smoothSOR3D< ValueType >(
+                level, face, *this->storage_, faceStencil3DID_, dst.getFaceDataID(), rhs.getFaceDataID(), relaxValue );
+         }
+         else
+         {
+            vertexdof::macroface::smooth_sor_multicolor< ValueType >(
+                level, face, faceStencilID_, dst.getFaceDataID(), rhs.getFaceDataID(), relaxValue );
+         }
+      }
+   }
+
+   dst.template communicate< Face, Cell >( level );
+
+   std::vector< PrimitiveID > cellIDs = this->storage_->getCellIDs();
+   #ifdef WALBERLA_BUILD_WITH_OPENMP
+   #pragma omp parallel for default(shared)
+   #endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
+   {
+      Cell& cell = *this->storage_->getCell( cellIDs[uint_c( i )] );
+
+      const DoFType cellBC = dst.getBoundaryCondition().getBoundaryType( cell.getMeshBoundaryFlag() );
+      if ( testFlag( cellBC, flag ) )
+      {
+         vertexdof::macrocell::smooth_sor_multicolor< ValueType >(
+             level, cell, cellStencilID_, dst.getCellDataID(), rhs.getCellDataID(), relaxValue );
+      }
+   }
+
+   this->stopTiming( "SOR multi-color" );
+}
+
+template class P1ConstantReducedPrecisionOperator< float >;
+template class P1ConstantReducedPrecisionOperator< double >;
+
+} // namespace hyteg
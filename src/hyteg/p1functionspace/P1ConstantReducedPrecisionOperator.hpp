@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "hyteg/LevelWiseMemory.hpp"
+#include "hyteg/Operator.hpp"
+#include "hyteg/StencilMemory.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+
+/// \brief Constant stencil P1 operator that acts on P1 functions with a (possibly) lower precision value type.
+///
+/// The stencils are not assembled from a form but copied from an assembled P1ConstantOperator (any form) and converted
+/// to ValueType. The 2D stencils and the stencils of the macro-vertices and -edges are stored in ValueType, the stencils of the
+/// macro-faces and -cells in 3D are shared with the source operator and converted on the fly.
+///
+/// Together with the grid transfer operators for arbitrary value types and the MixedPrecisionSolver, this operator is
+/// intended for mixed-precision multigrid, where the V-cycles operate on single precision data while the outer iteration
+/// is performed in double precision. Since the generated kernels are only available for double precision, the generic
+/// kernels are employed.
+///
+/// Usage:
+///
+///   P1ConstantLaplaceOperator                  A( storage, minLevel, maxLevel );
+///   P1ConstantReducedPrecisionOperator< float > A_f( A );
+///
+template < typename ValueType >
+class P1ConstantReducedPrecisionOperator : public Operator< P1Function< ValueType >, P1Function< ValueType > >
+{
+ public:
+   /// Copies the stencils of all levels of the passed constant operator.
+   template < class P1ConstantOperatorType >
+   explicit P1ConstantReducedPrecisionOperator( const P1ConstantOperatorType& sourceOperator )
+   : P1ConstantReducedPrecisionOperator( sourceOperator.getStorage(),
+                                         sourceOperator.getMinLevel(),
+                                         sourceOperator.getMaxLevel(),
+                                         sourceOperator.getVertexStencilID(),
+                                         sourceOperator.getEdgeStencilID(),
+                                         sourceOperator.getFaceStencilID(),
+                                         sourceOperator.getFaceStencil3DID(),
+                                         sourceOperator.getCellStencilID() )
+   {}
+
+   P1ConstantReducedPrecisionOperator(
+       const std::shared_ptr< PrimitiveStorage >&                                              storage,
+       uint_t                                                                                  minLevel,
+       uint_t                                                                                  maxLevel,
+       const PrimitiveDataID< StencilMemory< real_t >, Vertex >&                               sourceVertexStencilID,
+       const PrimitiveDataID< StencilMemory< real_t >, Edge >&                                 sourceEdgeStencilID,
+       const PrimitiveDataID< StencilMemory< real_t >, Face >&                                 sourceFaceStencilID,
+       const PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face >& sourceFaceStencil3DID,
+       const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&  sourceCellStencilID );
+
+   ~P1ConstantReducedPrecisionOperator() override = default;
+
+   void apply( const P1Function< ValueType >& src,
+               const P1Function< ValueType >& dst,
+               size_t                         level,
+               DoFType                        flag,
+               UpdateType                     updateType = Replace ) const;
+
+   void smooth_gs( const P1Function< ValueType >& dst, const P1Function< ValueType >& rhs, size_t level, DoFType flag ) const
+   {
+      smooth_sor( dst, rhs, 1.0, level, flag );
+   }
+
+   void smooth_sor( const P1Function< ValueType >& dst,
+                    const P1Function< ValueType >& rhs,
+                    real_t                         relax,
+                    size_t                         level,
+                    DoFType                        flag ) const;
+
+   /// Multi-color SOR, see P1ConstantOperator::smooth_sor_multicolor().
+   void smooth_sor_multicolor( const P1Function< ValueType >& dst,
+                               const P1Function< ValueType >& rhs,
+                               real_t                         relax,
+                               size_t                         level,
+                               DoFType                        flag ) const;
+
+   void smooth_gs_multicolor( const P1Function< ValueType >& dst, const P1Function< ValueType >& rhs, size_t level, DoFType flag ) const
+   {
+      smooth_sor_multicolor( dst, rhs, 1.0, level, flag );
+   }
+
+ private:
+   void smooth_sor_macro_vertices( const P1Function< ValueType >& dst,
+                                   const P1Function< ValueType >& rhs,
+                                   ValueType                      relax,
+                                   size_t                         level,
+                                   DoFType                        flag ) const;
+
+   void smooth_sor_macro_edges( const P1Function< ValueType >& dst,
+                                const P1Function< ValueType >& rhs,
+                                ValueType                      relax,
+                                size_t                         level,
+                                DoFType                        flag ) const;
+
+   PrimitiveDataID< StencilMemory< ValueType >, Vertex >                            vertexStencilID_;
+   PrimitiveDataID< StencilMemory< ValueType >, Edge >                              edgeStencilID_;
+   PrimitiveDataID< StencilMemory< ValueType >, Face >                              faceStencilID_;
+   PrimitiveDataID< LevelWiseMemory< vertexdof::macroface::StencilMap_T >, Face > faceStencil3DID_;
+   PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >  cellStencilID_;
+};
+
+typedef P1ConstantReducedPrecisionOperator< float > P1ConstantSinglePrecisionOperator;
+
+} // namespace hyteg
@@ -58,4 +58,9 @@ std::shared_ptr< FaceP1PolynomialMemory > FaceP1PolynomialMemoryDataHandling::in
   return std::make_shared< FaceP1PolynomialMemory >( );
 }
 
+std::shared_ptr< CellP1PolynomialMemory > CellP1PolynomialMemoryDataHandling::initialize( const Cell * const ) const
+{
+  return std::make_shared< CellP1PolynomialMemory >( );
+}
+
 }
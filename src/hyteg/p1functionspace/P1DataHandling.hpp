@@ -84,5 +84,13 @@ private:
 
 };
 
+class CellP1PolynomialMemoryDataHandling : public OnlyInitializeDataHandling< CellP1PolynomialMemory, Cell >
+{
+public:
+
+  std::shared_ptr< CellP1PolynomialMemory > initialize( const Cell * const cell ) const;
+
+};
+
 
 }
@@ -482,6 +482,55 @@ inline std::map< stencilDirection, real_t > calculateStencilInMacroCellForm( con
   return macroCellStencilEntries;
 }
 
+/// Calculates the stencil weights of an inner micro-vertex of a macro-cell from a form that supports blending.
+///
+/// In contrast to calculateStencilInMacroCellForm(), the micro-vertex does not need to be located on the given level.
+/// It is specified by its coordinates \p referenceCenter in the reference macro-cell, i.e. the point
+/// x_0 + r_0 ( x_1 - x_0 ) + r_1 ( x_2 - x_0 ) + r_2 ( x_3 - x_0 ) with x_i the coordinates of the macro-cell.
+/// The stencil is assembled from the element matrices of the surrounding micro-cells with the mesh size of \p level.
+/// These are computed via integrateAll() from the absolute coordinates of the micro-vertices, so that the form
+/// can evaluate the geometry map of the macro-cell (it has to be set via form.setGeometryMap() before).
+template< typename P1Form >
+inline std::map< stencilDirection, real_t > calculateStencilInMacroCellBlending( const Point3D & referenceCenter, const Cell & cell,
+                                                                                 const uint_t & level, const P1Form & form )
+{
+  WALBERLA_ASSERT_GREATER_EQUAL( level, uint_t( 2 ), "There are no inner micro-vertices on level " << level );
+
+  std::map< stencilDirection, real_t > macroCellStencilEntries;
+
+  const auto &  macroCoords = cell.getCoordinates();
+  const real_t  h           = real_c( 1 ) / real_c( levelinfo::num_microedges_per_edge( level ) );
+  const Point3D center      = macroCoords[0] + ( macroCoords[1] - macroCoords[0] ) * referenceCenter[0] +
+                         ( macroCoords[2] - macroCoords[0] ) * referenceCenter[1] +
+                         ( macroCoords[3] - macroCoords[0] ) * referenceCenter[2];
+
+  // all inner micro-vertices share the same neighborhood
+  const auto neighboringElements = getNeighboringElements( indexing::Index( 1, 1, 1 ), level );
+
+  for ( const auto & cellAtVertex : neighboringElements )
+  {
+    WALBERLA_ASSERT_EQUAL( cellAtVertex[0], sd::VERTEX_C );
+
+    std::array< Point3D, 4 > geometricCoordinates;
+    for ( uint_t localID = 0; localID < 4; localID++ ) {
+      const auto offset = vertexdof::logicalIndexOffsetFromVertex( cellAtVertex[localID] );
+      geometricCoordinates[localID] = center + ( macroCoords[1] - macroCoords[0] ) * ( h * real_c( offset.x() ) ) +
+                                      ( macroCoords[2] - macroCoords[0] ) * ( h * real_c( offset.y() ) ) +
+                                      ( macroCoords[3] - macroCoords[0] ) * ( h * real_c( offset.z() ) );
+    }
+
+    Matrix4r localStiffnessMatrix;
+    form.integrateAll( geometricCoordinates, localStiffnessMatrix );
+
+    // the reference micro-vertex is the first vertex of the element, so we need the first row of the element matrix
+    for ( uint_t localID = 0; localID < 4; localID++ )
+    {
+      macroCellStencilEntries[ cellAtVertex[ localID ] ] += localStiffnessMatrix( 0, localID );
+    }
+  }
+  return macroCellStencilEntries;
+}
+
 
 /// \brief Assembles the local P1 operator stencil on a macro-vertex
 ///
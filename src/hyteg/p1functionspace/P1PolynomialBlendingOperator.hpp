@@ -23,6 +23,8 @@
 #include <array>
 #include <hyteg/Operator.hpp>
 
+#include "hyteg/celldofspace/CellDoFIndexing.hpp"
+#include "hyteg/communication/Syncing.hpp"
 #include "hyteg/types/pointnd.hpp"
 
 #include "P1DataHandling.hpp"
@@ -43,22 +45,34 @@
 #include "hyteg/forms/form_hyteg_generated/P1FormLaplace.hpp"
 #include "hyteg/forms/form_hyteg_generated/P1FormMass.hpp"
 #include "hyteg/forms/form_hyteg_generated/P1FormPSPG.hpp"
+#include "hyteg/forms/form_hyteg_manual/P1FormLaplace3D.hpp"
+#include "hyteg/forms/form_hyteg_manual/P1FormMass3D.hpp"
 #include "hyteg/p1functionspace/VertexDoFMemory.hpp"
 #include "hyteg/polynomial/LSQPInterpolator.hpp"
+#include "hyteg/polynomial/LSQPInterpolator3D.hpp"
 
 #include "VertexDoFMacroEdge.hpp"
 #include "VertexDoFMacroFace.hpp"
 #include "VertexDoFMacroVertex.hpp"
+#include "polynomial/VertexDoFMacroCellPolynomial.hpp"
 #include "polynomial/VertexDoFMacroFacePolynomial.hpp"
 
 namespace hyteg {
 
+/// P1 operator with stencils that are approximated by polynomials on each macro-face (2D) or macro-cell (3D).
+///
+/// The polynomials are fitted to stencils that are sampled on the micro-vertices of the interpolation level.
+/// In 3D, the surrogate stencils are applied to the inner micro-vertices of the macro-cells. The contributions
+/// to the micro-vertices on the macro-cell boundaries are computed elementwise from the micro-cells that touch the
+/// boundary, and are then added up via additive communication. The form must therefore provide integrateAll()
+/// for tetrahedra (e.g. P1Form_laplace3D or P1Form_mass3D).
 template < class P1Form, OperatorType OprType >
 class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Function< real_t > >
 {
  public:
    typedef LSQPInterpolator< MonomialBasis2D, LSQPType::EDGE >   EdgeInterpolator;
    typedef LSQPInterpolator< MonomialBasis2D, LSQPType::VERTEX > VertexInterpolator;
+   typedef LSQPInterpolator3D< MonomialBasis3D >                  CellInterpolator;
 
    P1PolynomialBlendingOperator( const std::shared_ptr< PrimitiveStorage >& storage,
                                  uint_t                                     minLevel,
@@ -73,6 +87,14 @@ class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Fu
          auto faceP1PolynomialMemoryDataHandling = std::make_shared< FaceP1PolynomialMemoryDataHandling >( polyDegree_ );
          storage_->addFaceData( facePolynomialID, faceP1PolynomialMemoryDataHandling, "P1OperatorFacePolynomial" );
          facePolynomialIDs_[level] = facePolynomialID;
+
+         if ( storage_->hasGlobalCells() )
+         {
+            PrimitiveDataID< CellP1PolynomialMemory, Cell > cellPolynomialID;
+            auto cellP1PolynomialMemoryDataHandling = std::make_shared< CellP1PolynomialMemoryDataHandling >();
+            storage_->addCellData( cellPolynomialID, cellP1PolynomialMemoryDataHandling, "P1OperatorCellPolynomial" );
+            cellPolynomialIDs_[level] = cellPolynomialID;
+         }
       }
    }
 
@@ -91,7 +113,11 @@ class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Fu
 
    void interpolateStencils( uint_t polyDegree )
    {
-      if ( OprType == OperatorType::ODD )
+      if ( storage_->hasGlobalCells() )
+      {
+         interpolateStencils3D( polyDegree );
+      }
+      else if ( OprType == OperatorType::ODD )
       {
          interpolateStencilsAsymmetric( polyDegree );
       }
@@ -325,6 +351,54 @@ class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Fu
       }
    }
 
+   void interpolateStencils3D( uint_t polyDegree )
+   {
+      WALBERLA_CHECK_GREATER_EQUAL( interpolationLevel_, uint_t( 2 ), "There are no inner micro-vertices below level 2." );
+
+      const auto& neighbors = vertexdof::macrocell::neighborsWithCenter;
+
+      std::vector< real_t > cellStencil( neighbors.size() );
+
+      for ( auto& it : storage_->getCells() )
+      {
+         Cell& cell = *it.second;
+         form.setGeometryMap( cell.getGeometryMap() );
+
+         for ( uint_t level = minLevel_; level <= maxLevel_; ++level )
+         {
+            auto  cellPolynomials = cell.getData( cellPolynomialIDs_[level] );
+            auto& polynomials     = cellPolynomials->addDegree( polyDegree );
+
+            // there are no inner micro-vertices below level 2
+            if ( level < 2 )
+            {
+               continue;
+            }
+
+            CellInterpolator interpolator( polyDegree, interpolationLevel_, neighbors.size() );
+
+            const real_t ref_H = 1.0 / walberla::real_c( levelinfo::num_microedges_per_edge( interpolationLevel_ ) );
+
+            // sample the stencils of the current level on the inner micro-vertices of the interpolation level
+            for ( const auto& idx : vertexdof::macrocell::Iterator( interpolationLevel_, 1 ) )
+            {
+               const Point3D ref_x( { ref_H * real_c( idx.x() ), ref_H * real_c( idx.y() ), ref_H * real_c( idx.z() ) } );
+
+               auto stencil = P1Elements::P1Elements3D::calculateStencilInMacroCellBlending( ref_x, cell, level, form );
+
+               for ( uint_t k = 0; k < neighbors.size(); ++k )
+               {
+                  cellStencil[k] = stencil[neighbors[k]];
+               }
+
+               interpolator.addInterpolationPoint( ref_x, cellStencil );
+            }
+
+            interpolator.interpolate( polynomials );
+         }
+      }
+   }
+
    void useDegree( uint_t degree ) { polyDegree_ = degree; }
 
    void apply( const P1Function< real_t >& src,
@@ -337,6 +411,12 @@ class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Fu
 
       checkForMissingPolynomial( level, polyDegree_ );
 
+      if ( storage_->hasGlobalCells() )
+      {
+         apply3D( src, dst, level, flag, updateType );
+         return;
+      }
+
       src.communicate< Vertex, Edge >( level );
       src.communicate< Edge, Face >( level );
       src.communicate< Face, Edge >( level );
@@ -399,6 +479,8 @@ class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Fu
 
    void smooth_gs( const P1Function< real_t >& dst, const P1Function< real_t >& rhs, size_t level, DoFType flag ) const
    {
+      WALBERLA_CHECK( !storage_->hasGlobalCells(), "P1PolynomialBlendingOperator::smooth_gs() not implemented for 3D" );
+
       checkForMissingPolynomial( level, polyDegree_ );
 
       // start pulling vertex halos
@@ -586,11 +668,129 @@ class P1PolynomialBlendingOperator : public Operator< P1Function< real_t >, P1Fu
    }
 #endif
    std::map< uint_t, PrimitiveDataID< FaceP1PolynomialMemory, Face > > facePolynomialIDs_;
+   std::map< uint_t, PrimitiveDataID< CellP1PolynomialMemory, Cell > > cellPolynomialIDs_;
 
  private:
+   void apply3D( const P1Function< real_t >& src,
+                 const P1Function< real_t >& dst,
+                 const size_t                level,
+                 DoFType                     flag,
+                 UpdateType                  updateType ) const
+   {
+      communication::syncFunctionBetweenPrimitives( src, level );
+
+      if ( updateType == Replace )
+      {
+         // Only the flagged DoFs are zeroed here, the halos of the macro-cells are zeroed below.
+         dst.interpolate( real_c( 0 ), level, flag );
+      }
+
+      for ( auto& it : storage_->getCells() )
+      {
+         Cell& cell = *it.second;
+
+         const real_t* srcData = cell.getData( src.getCellDataID() )->getPointer( level );
+         real_t*       dstData = cell.getData( dst.getCellDataID() )->getPointer( level );
+
+         // Zero out dst halos only, the contributions of all macro-cells are added up during the additive communication.
+         for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
+         {
+            if ( isOnMacroCellBoundary( idx, level ) )
+            {
+               dstData[vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() )] = real_c( 0 );
+            }
+         }
+
+         vertexdof::macrocell::applyPolynomial< real_t, OprType >( polyDegree_,
+                                                                   level,
+                                                                   cell,
+                                                                   cellPolynomialIDs_.at( level ),
+                                                                   src.getCellDataID(),
+                                                                   dst.getCellDataID(),
+                                                                   updateType );
+
+         applyElementwiseOnMacroCellBoundary( level, cell, srcData, dstData );
+      }
+
+      // Push result to lower-dimensional primitives
+      dst.communicateAdditively< Cell, Face >( level, DoFType::All ^ flag, *storage_, updateType == Replace );
+      dst.communicateAdditively< Cell, Edge >( level, DoFType::All ^ flag, *storage_, updateType == Replace );
+      dst.communicateAdditively< Cell, Vertex >( level, DoFType::All ^ flag, *storage_, updateType == Replace );
+   }
+
+   /// Adds the contributions of the micro-cells that touch the boundary of the macro-cell to the micro-vertices on the boundary.
+   /// The inner micro-vertices are skipped, those are covered by the polynomial stencils.
+   void applyElementwiseOnMacroCellBoundary( const uint_t  level,
+                                             const Cell&   cell,
+                                             const real_t* srcData,
+                                             real_t*       dstData ) const
+   {
+      P1Form cellForm( form );
+      cellForm.setGeometryMap( cell.getGeometryMap() );
+
+      std::array< Point3D, 4 > coords;
+      std::array< uint_t, 4 >  vertexDoFIndices;
+      std::array< bool, 4 >    onBoundary;
+      Matrix4r                 elMat;
+
+      const uint_t numSlabs = levelinfo::num_microedges_per_edge( level );
+      for ( uint_t slab = 0; slab < numSlabs; ++slab )
+      {
+         for ( const auto& cType : celldof::allCellTypes )
+         {
+            for ( const auto& micro : celldof::macrocell::SlabIterator( level, cType, slab ) )
+            {
+               const auto verts = celldof::macrocell::getMicroVerticesFromMicroCell( micro, cType );
+
+               bool touchesBoundary = false;
+               for ( uint_t k = 0; k < 4; ++k )
+               {
+                  onBoundary[k]   = isOnMacroCellBoundary( verts[k], level );
+                  touchesBoundary = touchesBoundary || onBoundary[k];
+               }
+
+               if ( !touchesBoundary )
+               {
+                  continue;
+               }
+
+               for ( uint_t k = 0; k < 4; ++k )
+               {
+                  coords[k] = vertexdof::macrocell::coordinateFromIndex( level, cell, verts[k] );
+               }
+
+               cellForm.integrateAll( coords, elMat );
+
+               vertexdof::getVertexDoFDataIndicesFromMicroCell( micro, cType, level, vertexDoFIndices );
+
+               for ( uint_t k = 0; k < 4; ++k )
+               {
+                  if ( onBoundary[k] )
+                  {
+                     real_t tmp = real_c( 0 );
+                     for ( uint_t j = 0; j < 4; ++j )
+                     {
+                        tmp += elMat( k, j ) * srcData[vertexDoFIndices[j]];
+                     }
+                     dstData[vertexDoFIndices[k]] += tmp;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   static bool isOnMacroCellBoundary( const indexing::Index& idx, const uint_t level )
+   {
+      return idx.x() == 0 || idx.y() == 0 || idx.z() == 0 ||
+             idx.x() + idx.y() + idx.z() == levelinfo::num_microedges_per_edge( level );
+   }
+
    void checkForMissingPolynomial( uint_t level, uint_t degree ) const
    {
       WALBERLA_ASSERT( facePolynomialIDs_.count( level ) > 0, "Polynomial for level " << level << " has not been interpolated" );
+      WALBERLA_ASSERT( !storage_->hasGlobalCells() || cellPolynomialIDs_.count( level ) > 0,
+                       "Polynomial for level " << level << " has not been interpolated" );
    }
 
    uint_t polyDegree_;
@@ -614,4 +814,7 @@ typedef P1PolynomialBlendingOperator< P1Form_div_2, OperatorType::ODD > P1Polyno
 
 typedef P1PolynomialBlendingOperator< P1Form_pspg, OperatorType::EVEN > P1PolynomialBlendingPSPGOperator;
 
+typedef P1PolynomialBlendingOperator< P1Form_laplace3D, OperatorType::EVEN > P1PolynomialBlendingLaplaceOperator3D;
+typedef P1PolynomialBlendingOperator< P1Form_mass3D, OperatorType::MASS >     P1PolynomialBlendingMassOperator3D;
+
 } // namespace hyteg
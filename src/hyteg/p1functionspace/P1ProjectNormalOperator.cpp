@@ -28,12 +28,55 @@
 
 namespace hyteg {
 
+/// Computes the normals of the vertex DoFs of a macro-primitive on the domain boundary.
+static void computeNormals( const std::shared_ptr< PrimitiveStorage >&               storage,
+                            const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                            const PrimitiveID&                                       primitiveID,
+                            const uint_t&                                            level,
+                            FreeslipNormals&                                         normals )
+{
+   if ( storage->vertexExistsLocally( primitiveID ) )
+   {
+      const Vertex& vertex = *storage->getVertex( primitiveID );
+      if ( storage->hasGlobalCells() )
+      {
+         vertexdof::macrovertex::computeNormals3D( vertex, normal_function, normals );
+      }
+      else
+      {
+         vertexdof::macrovertex::computeNormals2D( vertex, storage, normal_function, normals );
+      }
+   }
+   else if ( storage->edgeExistsLocally( primitiveID ) && level >= 1 )
+   {
+      const Edge& edge = *storage->getEdge( primitiveID );
+      if ( storage->hasGlobalCells() )
+      {
+         vertexdof::macroedge::computeNormals3D( level, edge, normal_function, normals );
+      }
+      else
+      {
+         vertexdof::macroedge::computeNormals2D( level, edge, storage, normal_function, normals );
+      }
+   }
+   else if ( storage->faceExistsLocally( primitiveID ) && storage->hasGlobalCells() && level >= 2 )
+   {
+      vertexdof::macroface::computeNormals3D( level, *storage->getFace( primitiveID ), normal_function, normals );
+   }
+}
+
 P1ProjectNormalOperator::P1ProjectNormalOperator( const std::shared_ptr< PrimitiveStorage >&               storage,
                                                   size_t                                                   minLevel,
                                                   size_t                                                   maxLevel,
                                                   const std::function< void( const Point3D&, Point3D& ) >& normal_function )
 : Operator( storage, minLevel, maxLevel )
 , normal_function_( normal_function )
+, normals_( storage,
+            minLevel,
+            maxLevel,
+            [storage, normal_function]( const PrimitiveID& primitiveID, const uint_t& level, FreeslipNormals& normals ) {
+               computeNormals( storage, normal_function, primitiveID, level, normals );
+            } )
 {}
 
 void P1ProjectNormalOperator::apply( const P1Function< real_t >& dst_u,
@@ -82,20 +125,20 @@ void P1ProjectNormalOperator::apply( const P1Function< real_t >& dst_u,
       const DoFType vertexBC = dst_u.getBoundaryCondition().getBoundaryType( vertex.getMeshBoundaryFlag() );
       if ( testFlag( vertexBC, flag ) )
       {
+         const FreeslipNormals& normals = normals_.get( vertex.getID(), level );
+
          if ( storage_->hasGlobalCells() )
          {
-            vertexdof::macrovertex::projectNormal3D< real_t >( level,
-                                                               vertex,
-                                                               storage_,
-                                                               normal_function_,
-                                                               dst_u.getVertexDataID(),
-                                                               dst_v.getVertexDataID(),
-                                                               dst_w.getVertexDataID() );
+            applyNormalProjection3D( normals,
+                                     vertex.getData( dst_u.getVertexDataID() )->getPointer( level ),
+                                     vertex.getData( dst_v.getVertexDataID() )->getPointer( level ),
+                                     vertex.getData( dst_w.getVertexDataID() )->getPointer( level ) );
          }
          else
          {
-            vertexdof::macrovertex::projectNormal2D< real_t >(
-                level, vertex, storage_, normal_function_, dst_u.getVertexDataID(), dst_v.getVertexDataID() );
+            applyNormalProjection2D( normals,
+                                     vertex.getData( dst_u.getVertexDataID() )->getPointer( level ),
+                                     vertex.getData( dst_v.getVertexDataID() )->getPointer( level ) );
          }
       }
    }
@@ -113,15 +156,20 @@ void P1ProjectNormalOperator::apply( const P1Function< real_t >& dst_u,
          const DoFType edgeBC = dst_u.getBoundaryCondition().getBoundaryType( edge.getMeshBoundaryFlag() );
          if ( testFlag( edgeBC, flag ) )
          {
+            const FreeslipNormals& normals = normals_.get( edge.getID(), level );
+
             if ( storage_->hasGlobalCells() )
             {
-               vertexdof::macroedge::projectNormal3D< real_t >(
-                   level, edge, storage_, normal_function_, dst_u.getEdgeDataID(), dst_v.getEdgeDataID(), dst_w.getEdgeDataID() );
+               applyNormalProjection3D( normals,
+                                        edge.getData( dst_u.getEdgeDataID() )->getPointer( level ),
+                                        edge.getData( dst_v.getEdgeDataID() )->getPointer( level ),
+                                        edge.getData( dst_w.getEdgeDataID() )->getPointer( level ) );
             }
             else
             {
-               vertexdof::macroedge::projectNormal2D< real_t >(
-                   level, edge, storage_, normal_function_, dst_u.getEdgeDataID(), dst_v.getEdgeDataID() );
+               applyNormalProjection2D( normals,
+                                        edge.getData( dst_u.getEdgeDataID() )->getPointer( level ),
+                                        edge.getData( dst_v.getEdgeDataID() )->getPointer( level ) );
             }
          }
       }
@@ -142,8 +190,12 @@ void P1ProjectNormalOperator::apply( const P1Function< real_t >& dst_u,
          {
             if ( storage_->hasGlobalCells() )
             {
-               vertexdof::macroface::projectNormal3D< real_t >(
-                   level, face, storage_, normal_function_, dst_u.getFaceDataID(), dst_v.getFaceDataID(), dst_w.getFaceDataID() );
+               const FreeslipNormals& normals = normals_.get( face.getID(), level );
+
+               applyNormalProjection3D( normals,
+                                        face.getData( dst_u.getFaceDataID() )->getPointer( level ),
+                                        face.getData( dst_v.getFaceDataID() )->getPointer( level ),
+                                        face.getData( dst_w.getFaceDataID() )->getPointer( level ) );
             }
          }
       }
@@ -20,6 +20,7 @@
 #pragma once
 
 #include "hyteg/HytegDefinitions.hpp"
+#include "hyteg/boundary/FreeslipNormals.hpp"
 #include "hyteg/sparseassembly/SparseMatrixProxy.hpp"
 #include "hyteg/Operator.hpp"
 #include "hyteg/composites//P1StokesFunction.hpp"
@@ -67,6 +68,9 @@ class P1ProjectNormalOperator : public Operator< P1Function< real_t >, P1Functio
 
  private:
    const std::function< void( const Point3D&, Point3D& ) > normal_function_;
+
+   /// normals of the projected DoFs, computed on construction for the macro-primitives on the domain boundary
+   mutable FreeslipNormalCache normals_;
 };
 
 } // namespace hyteg
@@ -28,6 +28,7 @@
 #include "hyteg/communication/Syncing.hpp"
 #include "hyteg/dgfunctionspace/DGFunction.hpp"
 #include "hyteg/edgedofspace/EdgeDoFIndexing.hpp"
+#include "hyteg/geometry/BlendedGeometryCache.hpp"
 #include "hyteg/geometry/Intersection.hpp"
 #include "hyteg/p1functionspace/VertexDoFAdditivePackInfo.hpp"
 #include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
@@ -36,6 +37,7 @@
 #include "hyteg/p1functionspace/VertexDoFMacroVertex.hpp"
 #include "hyteg/p1functionspace/VertexDoFPackInfo.hpp"
 #include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/MacroPrimitiveLocator.hpp"
 #include "hyteg/p1functionspace/generatedKernels/assign_2D_macroface_vertexdof_1_rhsfunction.hpp"
 #include "hyteg/p1functionspace/generatedKernels/assign_2D_macroface_vertexdof_2_rhsfunctions.hpp"
 #include "hyteg/p1functionspace/generatedKernels/assign_2D_macroface_vertexdof_3_rhsfunctions.hpp"
@@ -90,25 +92,34 @@ VertexDoFFunction< ValueType >::VertexDoFFunction( const std::string&
    storage->addEdgeData( edgeDataID_, edgeVertexDoFFunctionMemoryDataHandling, name );
    storage->addVertexData( vertexDataID_, vertexVertexDoFFunctionMemoryDataHandling, name );
 
-   for ( uint_t level = minLevel; level <= maxLevel; ++level )
+   // all levels of a macro-primitive are allocated from a single arena
+   for ( const auto & it : storage->getVertices() )
    {
-      for ( const auto & it : storage->getVertices() )
-      {
-         allocateMemory( level, *it.second );
-      }
-      for ( const auto & it : storage->getEdges() )
-      {
-         allocateMemory( level, *it.second );
-      }
-      for ( const auto & it : storage->getFaces() )
-      {
-         allocateMemory( level, *it.second );
-      }
-      for ( const auto & it : storage->getCells() )
-      {
-         allocateMemory( level, *it.second );
-      }
+      const Vertex & vertex = *it.second;
+      vertex.getData( vertexDataID_ )->addData(
+          minLevel, maxLevel, [&vertex]( const uint_t & level ) { return vertexDoFMacroVertexFunctionMemorySize( level, vertex ); }, 0 );
+   }
+   for ( const auto & it : storage->getEdges() )
+   {
+      const Edge & edge = *it.second;
+      edge.getData( edgeDataID_ )->addData(
+          minLevel, maxLevel, [&edge]( const uint_t & level ) { return vertexDoFMacroEdgeFunctionMemorySize( level, edge ); }, 0 );
+   }
+   for ( const auto & it : storage->getFaces() )
+   {
+      const Face & face = *it.second;
+      face.getData( faceDataID_ )->addData(
+          minLevel, maxLevel, [&face]( const uint_t & level ) { return vertexDoFMacroFaceFunctionMemorySize( level, face ); }, 0 );
+   }
+   for ( const auto & it : storage->getCells() )
+   {
+      const Cell & cell = *it.second;
+      cell.getData( cellDataID_ )->addData(
+          minLevel, maxLevel, [&cell]( const uint_t & level ) { return vertexDoFMacroCellFunctionMemorySize( level, cell ); }, 0 );
+   }
 
+   for ( uint_t level = minLevel; level <= maxLevel; ++level )
+   {
       communicators_[level]->addPackInfo( std::make_shared< VertexDoFPackInfo< ValueType > >(
           level, vertexDataID_, edgeDataID_, faceDataID_, cellDataID_, this->getStorage() ) );
       additiveCommunicators_[level]->addPackInfo( std::make_shared< VertexDoFAdditivePackInfo< ValueType > >(
@@ -343,7 +354,8 @@ void VertexDoFFunction< ValueType >::interpolate(
 
       if ( testFlag( boundaryCondition_.getBoundaryType( face.getMeshBoundaryFlag() ), flag ) )
       {
-         vertexdof::macroface::interpolate< ValueType >( level, face, faceDataID_, srcFaceIDs, expr );
+         const real_t* mappedCoordinates = geometryCache_ ? geometryCache_->getMappedCoordinates( face, level ) : nullptr;
+         vertexdof::macroface::interpolate< ValueType >( level, face, faceDataID_, srcFaceIDs, expr, mappedCoordinates );
       }
    }
 
@@ -357,7 +369,8 @@ void VertexDoFFunction< ValueType >::interpolate(
 
       if ( testFlag( boundaryCondition_.getBoundaryType( cell.getMeshBoundaryFlag() ), flag ) )
       {
-         vertexdof::macrocell::interpolate< ValueType >( level, cell, cellDataID_, srcCellIDs, expr );
+         const real_t* mappedCoordinates = geometryCache_ ? geometryCache_->getMappedCoordinates( cell, level ) : nullptr;
+         vertexdof::macrocell::interpolate< ValueType >( level, cell, cellDataID_, srcCellIDs, expr, mappedCoordinates );
       }
    }
    this->stopTiming( "Interpolate" );
@@ -427,7 +440,8 @@ void VertexDoFFunction< ValueType >::interpolate(
 
       if ( boundaryCondition_.getBoundaryUIDFromMeshFlag( face.getMeshBoundaryFlag() ) == boundaryUID )
       {
-         vertexdof::macroface::interpolate< ValueType >( level, face, faceDataID_, srcFaceIDs, expr );
+         const real_t* mappedCoordinates = geometryCache_ ? geometryCache_->getMappedCoordinates( face, level ) : nullptr;
+         vertexdof::macroface::interpolate< ValueType >( level, face, faceDataID_, srcFaceIDs, expr, mappedCoordinates );
       }
    }
 
@@ -441,7 +455,8 @@ void VertexDoFFunction< ValueType >::interpolate(
 
       if ( boundaryCondition_.getBoundaryUIDFromMeshFlag( cell.getMeshBoundaryFlag() ) == boundaryUID )
       {
-         vertexdof::macrocell::interpolate< ValueType >( level, cell, cellDataID_, srcCellIDs, expr );
+         const real_t* mappedCoordinates = geometryCache_ ? geometryCache_->getMappedCoordinates( cell, level ) : nullptr;
+         vertexdof::macrocell::interpolate< ValueType >( level, cell, cellDataID_, srcCellIDs, expr, mappedCoordinates );
       }
    }
    this->stopTiming( "Interpolate" );
@@ -502,90 +517,72 @@ bool VertexDoFFunction< real_t >::evaluate( const Point3D& coordinates,
                                             real_t&        value,
                                             real_t         searchToleranceRadius ) const
 {
-   if ( !this->getStorage()->hasGlobalCells() )
+   const auto  locator = this->getStorage()->getMacroPrimitiveLocator();
+   PrimitiveID primitiveID;
+   Point3D     computationalCoordinates;
+   if ( !locator->findLocalPrimitive( coordinates, searchToleranceRadius, primitiveID, computationalCoordinates ) )
    {
-      Point2D coordinates2D( {coordinates[0], coordinates[1]} );
-
-      for ( auto& it : this->getStorage()->getFaces() )
-      {
-         Face& face = *it.second;
-
-         Point2D faceCoodinates0( {face.getCoordinates()[0][0], face.getCoordinates()[0][1]} );
-         Point2D faceCoodinates1( {face.getCoordinates()[1][0], face.getCoordinates()[1][1]} );
-         Point2D faceCoodinates2( {face.getCoordinates()[2][0], face.getCoordinates()[2][1]} );
-
-         if ( isPointInTriangle( coordinates2D, faceCoodinates0, faceCoodinates1, faceCoodinates2 ) )
-         {
-            value = vertexdof::macroface::evaluate< real_t >( level, face, coordinates, faceDataID_ );
-            return true;
-         }
-      }
-
-      if ( searchToleranceRadius > 0 )
-      {
-         for ( auto& it : this->getStorage()->getFaces() )
-         {
-            Face& face = *it.second;
-
-            Point2D faceCoodinates0( {face.getCoordinates()[0][0], face.getCoordinates()[0][1]} );
-            Point2D faceCoodinates1( {face.getCoordinates()[1][0], face.getCoordinates()[1][1]} );
-            Point2D faceCoodinates2( {face.getCoordinates()[2][0], face.getCoordinates()[2][1]} );
+      return false;
+   }
 
-            if ( circleTriangleIntersection( coordinates2D,
-                                             searchToleranceRadius,
-                                             faceCoodinates0,
-                                             faceCoodinates1,
-                                             faceCoodinates2 ) )
-            {
-               value = vertexdof::macroface::evaluate< real_t >( level, face, coordinates, faceDataID_ );
-               return true;
-            }
-         }
-      }
+   if ( !this->getStorage()->hasGlobalCells() )
+   {
+      Face& face = *this->getStorage()->getFace( primitiveID );
+      value      = vertexdof::macroface::evaluate< real_t >( level, face, computationalCoordinates, faceDataID_ );
    }
    else
    {
-      for ( auto& it : this->getStorage()->getCells() )
-      {
-         Cell& cell = *it.second;
+      Cell& cell = *this->getStorage()->getCell( primitiveID );
+      value      = vertexdof::macrocell::evaluate< real_t >( level, cell, computationalCoordinates, cellDataID_ );
+   }
 
-         if ( isPointInTetrahedron( coordinates,
+   return true;
+}
 
-                                    cell.getCoordinates()[0],
-                                    cell.getCoordinates()[1],
-                                    cell.getCoordinates()[2],
-                                    cell.getCoordinates()[3],
-                                    cell.getFaceInwardNormal( 0 ),
-                                    cell.getFaceInwardNormal( 1 ),
-                                    cell.getFaceInwardNormal( 2 ),
-                                    cell.getFaceInwardNormal( 3 ) ) )
+template < typename ValueType >
+void VertexDoFFunction< ValueType >::evaluate( const std::vector< Point3D >& coordinates,
+                                               uint_t                        level,
+                                               std::vector< ValueType >&     values,
+                                               std::vector< bool >&          found,
+                                               real_t                        searchToleranceRadius ) const
+{
+   WALBERLA_UNUSED( coordinates );
+   WALBERLA_UNUSED( level );
+   WALBERLA_UNUSED( values );
+   WALBERLA_UNUSED( found );
+   WALBERLA_UNUSED( searchToleranceRadius );
+   WALBERLA_ABORT( "VertexDoFFunction< ValueType >::evaluate not implemented for requested template parameter" );
+}
+
+template <>
+void VertexDoFFunction< real_t >::evaluate( const std::vector< Point3D >& coordinates,
+                                            uint_t                        level,
+                                            std::vector< real_t >&        values,
+                                            std::vector< bool >&          found,
+                                            real_t                        searchToleranceRadius ) const
+{
+   const auto storage = this->getStorage();
+
+   auto evaluateLocal = [&]( const PrimitiveID& primitiveID, const std::vector< Point3D >& points, std::vector< real_t >& result ) {
+      if ( !storage->hasGlobalCells() )
+      {
+         Face& face = *storage->getFace( primitiveID );
+         for ( uint_t i = 0; i < points.size(); i++ )
          {
-            value = vertexdof::macrocell::evaluate< real_t >( level, cell, coordinates, cellDataID_ );
-            return true;
+            result[i] = vertexdof::macroface::evaluate< real_t >( level, face, points[i], faceDataID_ );
          }
       }
-
-      if ( searchToleranceRadius > 0 )
+      else
       {
-         for ( auto& it : this->getStorage()->getCells() )
+         Cell& cell = *storage->getCell( primitiveID );
+         for ( uint_t i = 0; i < points.size(); i++ )
          {
-            Cell& cell = *it.second;
-
-            if ( sphereTetrahedronIntersection( coordinates,
-                                                searchToleranceRadius,
-                                                cell.getCoordinates()[0],
-                                                cell.getCoordinates()[1],
-                                                cell.getCoordinates()[2],
-                                                cell.getCoordinates()[3] ) )
-            {
-               value = vertexdof::macrocell::evaluate< real_t >( level, cell, coordinates, cellDataID_ );
-               return true;
-            }
+            result[i] = vertexdof::macrocell::evaluate< real_t >( level, cell, points[i], cellDataID_ );
          }
       }
-   }
+   };
 
-   return false;
+   storage->getMacroPrimitiveLocator()->evaluateDistributed( coordinates, searchToleranceRadius, evaluateLocal, values, found );
 }
 
 template < typename ValueType >
@@ -732,6 +729,48 @@ void VertexDoFFunction< ValueType >::copyFrom( const VertexDoFFunction< ValueTyp
    this->stopTiming( "Copy" );
 }
 
+template < typename ValueType >
+template < typename OtherValueType >
+void VertexDoFFunction< ValueType >::copyFrom( const VertexDoFFunction< OtherValueType >& other, const uint_t& level ) const
+{
+   if ( isDummy() )
+   {
+      return;
+   }
+   this->startTiming( "Copy (conversion)" );
+
+   for ( auto& it : this->getStorage()->getVertices() )
+   {
+      auto primitiveID = it.first;
+      WALBERLA_ASSERT( other.getStorage()->vertexExistsLocally( primitiveID ) )
+      it.second->getData( vertexDataID_ )
+          ->copyFrom( *other.getStorage()->getVertex( primitiveID )->getData( other.getVertexDataID() ), level );
+   }
+
+   for ( auto& it : this->getStorage()->getEdges() )
+   {
+      auto primitiveID = it.first;
+      WALBERLA_ASSERT( other.getStorage()->edgeExistsLocally( primitiveID ) )
+      it.second->getData( edgeDataID_ )->copyFrom( *other.getStorage()->getEdge( primitiveID )->getData( other.getEdgeDataID() ), level );
+   }
+
+   for ( auto& it : this->getStorage()->getFaces() )
+   {
+      auto primitiveID = it.first;
+      WALBERLA_ASSERT( other.getStorage()->faceExistsLocally( primitiveID ) )
+      it.second->getData( faceDataID_ )->copyFrom( *other.getStorage()->getFace( primitiveID )->getData( other.getFaceDataID() ), level );
+   }
+
+   for ( auto& it : this->getStorage()->getCells() )
+   {
+      auto primitiveID = it.first;
+      WALBERLA_ASSERT( other.getStorage()->cellExistsLocally( primitiveID ) )
+      it.second->getData( cellDataID_ )->copyFrom( *other.getStorage()->getCell( primitiveID )->getData( other.getCellDataID() ), level );
+   }
+
+   this->stopTiming( "Copy (conversion)" );
+}
+
 template < typename ValueType >
 void VertexDoFFunction< ValueType >::copyFrom( const VertexDoFFunction< ValueType >&          other,
                                                const uint_t&                                  level,
@@ -2210,9 +2249,13 @@ void VertexDoFFunction< real_t >::invertElementwise( uint_t level, DoFType flag,
 //  explicit instantiation
 // ========================
 template class VertexDoFFunction< double >;
+template class VertexDoFFunction< float >;
 template class VertexDoFFunction< int >;
 template class VertexDoFFunction< long >;
 
+template void VertexDoFFunction< double >::copyFrom< float >( const VertexDoFFunction< float >& other, const uint_t& level ) const;
+template void VertexDoFFunction< float >::copyFrom< double >( const VertexDoFFunction< double >& other, const uint_t& level ) const;
+
 template void VertexDoFFunction< double >::interpolateByPrimitiveType< hyteg::Vertex >( const double& constant,
                                                                                         uint_t        level,
                                                                                         DoFType       flag ) const;
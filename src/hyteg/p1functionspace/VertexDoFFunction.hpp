@@ -50,6 +50,7 @@ class Vertex;
 class Edge;
 class Face;
 class Cell;
+class BlendedGeometryCache;
 
 namespace vertexdof {
 
@@ -123,6 +124,15 @@ class VertexDoFFunction : public Function< VertexDoFFunction< ValueType > >
                   const std::map< PrimitiveID::IDType, uint_t >& localPrimitiveIDsToRank,
                   const std::map< PrimitiveID::IDType, uint_t >& otherPrimitiveIDsToRank ) const;
 
+   /// \brief Copies all values function data from a function with a different value type to this.
+   ///
+   /// The values are converted entry by entry, e.g. to convert between double and single precision in
+   /// mixed-precision solvers. The ghost layers are copied as well, so no communication is required afterwards.
+   /// Both storages must have identical distribution.
+   ///
+   template < typename OtherValueType >
+   void copyFrom( const VertexDoFFunction< OtherValueType >& other, const uint_t& level ) const;
+
    /// \brief Evaluate finite element function at a specific coordinates.
    ///
    /// In a parallel setting, the specified coordinate might not lie in the local subdomain.
@@ -148,7 +158,7 @@ class VertexDoFFunction : public Function< VertexDoFFunction< ValueType > >
    /// -> Does not need to be called collectively.
    /// -> Different values are returned on each process.
    ///
-   /// \param coordinates where the function shall be evaluated
+   /// \param coordinates where the function shall be evaluated (physical domain, blending maps are inverted)
    /// \param level refinement level
    /// \param value function value at the coordinate if search was successful
    /// \param searchToleranceRadius radius of the sphere (circle) for the second search phase, skipped if negative
@@ -156,6 +166,27 @@ class VertexDoFFunction : public Function< VertexDoFFunction< ValueType > >
    ///
    bool evaluate( const Point3D& coordinates, uint_t level, ValueType& value, real_t searchToleranceRadius = 1e-05 ) const;
 
+   /// \brief Evaluates the function at multiple points that may be located anywhere in the (global) domain.
+   ///
+   /// The points are located via the spatial index of the PrimitiveStorage (see MacroPrimitiveLocator),
+   /// grouped by the containing macro-primitive and evaluated in a single sweep. The two search phases
+   /// are the same as for the evaluation at a single point.
+   ///
+   /// Must be called collectively. Each process passes its own (possibly empty) list of points,
+   /// which may also be located in the subdomains of other processes.
+   ///
+   /// \param coordinates where the function shall be evaluated (physical domain, blending maps are inverted)
+   /// \param level refinement level
+   /// \param values function values at the coordinates, zero for points that were not found
+   /// \param found true for each point that was found on any process, false otherwise
+   /// \param searchToleranceRadius radius of the sphere (circle) for the second search phase, skipped if negative
+   ///
+   void evaluate( const std::vector< Point3D >& coordinates,
+                  uint_t                        level,
+                  std::vector< ValueType >&     values,
+                  std::vector< bool >&          found,
+                  real_t                        searchToleranceRadius = 1e-05 ) const;
+
    void evaluateGradient( const Point3D& coordinates, uint_t level, Point3D& gradient ) const;
 
    void assign( const std::vector< ValueType >&                                                      scalars,
@@ -377,6 +408,10 @@ class VertexDoFFunction : public Function< VertexDoFFunction< ValueType > >
    /// \param localCommunicationMode
    void setLocalCommunicationMode( const communication::BufferedCommunicator::LocalCommunicationMode& localCommunicationMode );
 
+   /// Sets a cache of the mapped micro-vertex coordinates that is used by interpolate() on blended macro-faces (2D) and
+   /// macro-cells (3D) instead of evaluating the geometry map. Pass nullptr to evaluate the map again.
+   void setGeometryCache( const std::shared_ptr< const BlendedGeometryCache >& geometryCache ) { geometryCache_ = geometryCache; }
+
    using Function< VertexDoFFunction< ValueType > >::isDummy;
 
  private:
@@ -395,6 +430,8 @@ class VertexDoFFunction : public Function< VertexDoFFunction< ValueType > >
 
    BoundaryCondition boundaryCondition_;
 
+   std::shared_ptr< const BlendedGeometryCache > geometryCache_;
+
    /// friend Stokes and P2Function for usage of enumerate
    friend class P2Function< ValueType >;
    friend class P1StokesFunction< ValueType >;
@@ -416,6 +453,13 @@ inline void projectMean( const VertexDoFFunction< real_t >& pressure, const uint
 template <>
 bool VertexDoFFunction< real_t >::evaluate( const Point3D& coordinates, uint_t level, real_t& value, real_t searchToleranceRadius ) const;
 
+template <>
+void VertexDoFFunction< real_t >::evaluate( const std::vector< Point3D >& coordinates,
+                                            uint_t                        level,
+                                            std::vector< real_t >&        values,
+                                            std::vector< bool >&          found,
+                                            real_t                        searchToleranceRadius ) const;
+
 // extern template class VertexDoFFunction< double >;
 extern template class VertexDoFFunction< int >;
 
@@ -29,6 +29,7 @@
 #include "hyteg/indexing/MacroCellIndexing.hpp"
 #include "hyteg/indexing/MacroEdgeIndexing.hpp"
 #include "hyteg/indexing/MacroFaceIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCellStencil.hpp"
 
 namespace hyteg {
 
@@ -264,6 +265,26 @@ class BoundaryIterator : public hyteg::indexing::FaceBoundaryIterator
 
 bool isVertexOnBoundary( const uint_t& level, const hyteg::indexing::Index& idx );
 
+// Multi-coloring
+
+/// Number of colors of the vertex DoF coloring of a macro-face (see \ref color).
+constexpr uint_t numColors = 3;
+
+/// Color of the vertex DoF (x, y) in a macro-face that is not coupled to a macro-cell.
+/// Two vertex DoFs of the same color never share a micro-face, i.e. none of the six neighbors
+/// (x+-1, y), (x, y+-1), (x+1, y-1), (x-1, y+1) has the same color as (x, y).
+/// Red-black is not sufficient since the neighbors in the diagonal direction would share the color.
+inline uint_t color( const uint_t& x, const uint_t& y )
+{
+   return ( x + 2 * y ) % numColors;
+}
+
+/// Returns the smallest x >= xMin so that color( x, y ) == c.
+inline uint_t firstIndexOfColor( const uint_t& c, const uint_t& xMin, const uint_t& y )
+{
+   return xMin + ( c + numColors - color( xMin, y ) ) % numColors;
+}
+
 // map[neighborCellID][indexOffset] = weight
 typedef std::map< uint_t, std::map< indexing::IndexIncrement, real_t > > StencilMap_T;
 
@@ -483,8 +504,24 @@ std::set< uint_t > isOnCellEdge( const indexing::Index& index, const uint_t& lev
 /// See \ref indexing::isOnCellVertex
 std::set< uint_t > isOnCellVertex( const indexing::Index& index, const uint_t& level );
 
-/// map[indexOffset] = weight
-typedef std::map< indexing::IndexIncrement, real_t > StencilMap_T;
+// Multi-coloring
+
+/// Number of colors of the vertex DoF coloring of a macro-cell (see \ref color).
+constexpr uint_t numColors = 4;
+
+/// Color of the vertex DoF (x, y, z) in a macro-cell.
+/// Two vertex DoFs of the same color never share a micro-cell, i.e. none of the 14 neighbors
+/// in the stencil of (x, y, z) has the same color as (x, y, z).
+inline uint_t color( const uint_t& x, const uint_t& y, const uint_t& z )
+{
+   return ( x + 2 * y + 3 * z ) % numColors;
+}
+
+/// Returns the smallest x >= xMin so that color( x, y, z ) == c.
+inline uint_t firstIndexOfColor( const uint_t& c, const uint_t& xMin, const uint_t& y, const uint_t& z )
+{
+   return xMin + ( c + numColors - color( xMin, y, z ) ) % numColors;
+}
 
 } // namespace macrocell
 
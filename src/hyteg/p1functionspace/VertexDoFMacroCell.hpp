@@ -95,7 +95,8 @@ inline void interpolate( const uint_t & level,
                          const Cell & cell,
                          const PrimitiveDataID< FunctionMemory< ValueType >, Cell >& cellMemoryId,
                          const std::vector< PrimitiveDataID< FunctionMemory< ValueType >, Cell > > & srcIds,
-                         const std::function< ValueType( const hyteg::Point3D &, const std::vector< ValueType > & )> & expr)
+                         const std::function< ValueType( const hyteg::Point3D &, const std::vector< ValueType > & )> & expr,
+                         const real_t * mappedCoordinates = nullptr )
 {
   ValueType * cellData = cell.getData( cellMemoryId )->getPointer( level );
 
@@ -107,20 +108,52 @@ inline void interpolate( const uint_t & level,
 
   std::vector<ValueType> srcVector( srcIds.size() );
 
-  Point3D xBlend;
+  // the mapped coordinates of all micro-vertices have been cached (see BlendedGeometryCache)
+  if ( mappedCoordinates != nullptr )
+  {
+    for ( const auto & it : vertexdof::macrocell::Iterator( level, 1 ) )
+    {
+      const uint_t idx = vertexdof::macrocell::indexFromVertex( level, it.x(), it.y(), it.z(), stencilDirection::VERTEX_C );
+      for ( uint_t k = 0; k < srcPtr.size(); ++k )
+      {
+        srcVector[ k ] = srcPtr[ k ][ idx ];
+      }
+      const Point3D x( { mappedCoordinates[ 3 * idx ], mappedCoordinates[ 3 * idx + 1 ], mappedCoordinates[ 3 * idx + 2 ] } );
+      cellData[ idx ] = expr( x, srcVector );
+    }
+    return;
+  }
+
+  // the blending map is evaluated for one row of micro-vertices at a time (single virtual call per row)
+  std::vector< Point3D > coordinates;
+  std::vector< uint_t >  indices;
+  std::vector< Point3D > xBlend;
+
+  const auto processRow = [&]() {
+    cell.getGeometryMap()->evalF( coordinates, xBlend );
+    for ( uint_t i = 0; i < indices.size(); ++i )
+    {
+      const uint_t idx = indices[ i ];
+      for ( uint_t k = 0; k < srcPtr.size(); ++k )
+      {
+        srcVector[ k ] = srcPtr[ k ][ idx ];
+      }
+      cellData[ idx ] = expr( xBlend[ i ], srcVector );
+    }
+    coordinates.clear();
+    indices.clear();
+  };
 
   for ( const auto & it : vertexdof::macrocell::Iterator( level, 1 ) )
   {
-    const Point3D coordinate = coordinateFromIndex( level, cell, it );
-    const uint_t  idx        = vertexdof::macrocell::indexFromVertex( level, it.x(), it.y(), it.z(), stencilDirection::VERTEX_C );
-
-    for ( uint_t k = 0; k < srcPtr.size(); ++k )
+    if ( it.x() == 1 && !indices.empty() )
     {
-      srcVector[ k ] = srcPtr[ k ][ idx ];
+      processRow();
     }
-    cell.getGeometryMap()->evalF( coordinate, xBlend );
-    cellData[ idx ] = expr( xBlend, srcVector );
+    coordinates.push_back( coordinateFromIndex( level, cell, it ) );
+    indices.push_back( vertexdof::macrocell::indexFromVertex( level, it.x(), it.y(), it.z(), stencilDirection::VERTEX_C ) );
   }
+  processRow();
 }
 
 template< typename ValueType >
@@ -489,64 +522,104 @@ inline ValueType sum( const uint_t&
    return sum;
 }
 
+/// Selects the inner micro-vertices of a macro-cell that are updated by apply().
+enum class InnerVertexRegion
+{
+  /// all inner micro-vertices
+  ALL,
+  /// inner micro-vertices whose stencil only reads inner micro-vertices, i.e. no ghost layer data
+  INTERIOR,
+  /// inner micro-vertices adjacent to the boundary of the macro-cell, their stencil reads ghost layer data
+  BOUNDARY_LAYER
+};
+
 template< typename ValueType >
 inline void apply( const uint_t & level,
                    Cell & cell,
-                   const PrimitiveDataID< LevelWiseMemory< StencilMap_T >,  Cell > & operatorId,
+                   const PrimitiveDataID< LevelWiseMemory< FlatStencil >,  Cell > & operatorId,
                    const PrimitiveDataID< FunctionMemory< ValueType >, Cell > & srcId,
                    const PrimitiveDataID< FunctionMemory< ValueType >, Cell > & dstId,
-                   const UpdateType update )
+                   const UpdateType update,
+                   const InnerVertexRegion region = InnerVertexRegion::ALL )
 {
-  typedef stencilDirection sd;
-
   auto operatorData     = cell.getData( operatorId )->getData( level );
   const ValueType * src = cell.getData( srcId )->getPointer( level );
         ValueType * dst = cell.getData( dstId )->getPointer( level );
 
-  ValueType tmp;
+  const uint_t width = levelinfo::num_microvertices_per_edge( level );
 
-  if( update == Replace )
+  // The weights are copied once to avoid the increment look-ups in the inner loop.
+  const ValueType centerWeight = static_cast< ValueType >( operatorData[{ 0, 0, 0 }] );
+  std::array< ValueType, neighborsWithoutCenter.size() > weights;
+  for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
   {
-    for ( const auto & it : vertexdof::macrocell::Iterator( level, 1 ) )
-    {
-      const uint_t x = it.x();
-      const uint_t y = it.y();
-      const uint_t z = it.z();
-
-      const uint_t centerIdx = vertexdof::macrocell::indexFromVertex( level, x, y, z, sd::VERTEX_C );
+    WALBERLA_ASSERT_GREATER( operatorData.count( logicalIndexOffsetFromVertex( neighborsWithoutCenter[k] ) ), 0 );
+    weights[k] = static_cast< ValueType >( operatorData[logicalIndexOffsetFromVertex( neighborsWithoutCenter[k] )] );
+  }
 
-      tmp = operatorData.at({0, 0, 0}) * src[ centerIdx ];
+  // array index of the neighbor k of the vertex (1, y, z), the neighbors of (x, y, z) are located at offset x - 1
+  std::array< uint_t, neighborsWithoutCenter.size() > neighborRowStart;
+  uint_t centerRowStart = 0;
 
-      for ( const auto & neighbor : vertexdof::macrocell::neighborsWithoutCenter )
+  // updates the vertices (x, y, z) of the current row with xBegin <= x < xEnd
+  auto applyRow = [&]( const uint_t & xBegin, const uint_t & xEnd ) {
+    for ( uint_t x = xBegin; x < xEnd; ++x )
+    {
+      ValueType tmp = centerWeight * src[centerRowStart + x - 1];
+      for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
       {
-        const uint_t idx        = vertexdof::macrocell::indexFromVertex( level, x, y, z, neighbor );
-        WALBERLA_ASSERT_GREATER( operatorData.count( vertexdof::logicalIndexOffsetFromVertex( neighbor ) ), 0 );
-        tmp += operatorData.at( vertexdof::logicalIndexOffsetFromVertex( neighbor ) ) * src[ idx ];
+        tmp += weights[k] * src[neighborRowStart[k] + x - 1];
       }
 
-      dst[ centerIdx ] = tmp;
+      if ( update == Replace )
+      {
+        dst[centerRowStart + x - 1] = tmp;
+      }
+      else
+      {
+        dst[centerRowStart + x - 1] += tmp;
+      }
     }
-  }
-  else
+  };
+
+  for ( uint_t z = 1; z < width - 1; ++z )
   {
-    for ( const auto & it : vertexdof::macrocell::Iterator( level, 1 ) )
+    for ( uint_t y = 1; y < width - 1 - z; ++y )
     {
-      const uint_t x = it.x();
-      const uint_t y = it.y();
-      const uint_t z = it.z();
-
-      const uint_t centerIdx = vertexdof::macrocell::indexFromVertex( level, x, y, z, sd::VERTEX_C );
+      for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
+      {
+        neighborRowStart[k] = indexFromVertex( level, 1, y, z, neighborsWithoutCenter[k] );
+      }
+      centerRowStart = index( level, 1, y, z );
 
-      tmp = operatorData.at( {0, 0, 0} ) * src[ centerIdx ];
+      // The inner vertices of the row are located at 1 <= x < xEnd. The first and the last one of them
+      // are adjacent to the macro-cell boundary, all of them if the row itself is adjacent to it.
+      const uint_t xEnd        = width - 1 - y - z;
+      const bool   boundaryRow = y == 1 || z == 1;
 
-      for ( const auto & neighbor : vertexdof::macrocell::neighborsWithoutCenter )
+      switch ( region )
       {
-        const uint_t stencilIdx = vertexdof::stencilIndexFromVertex( neighbor );
-        const uint_t idx        = vertexdof::macrocell::indexFromVertex( level, x, y, z, neighbor );
-        tmp += operatorData.at( logicalIndexOffsetFromVertex( neighbor ) ) * src[ idx ];
+      case InnerVertexRegion::ALL:
+        applyRow( 1, xEnd );
+        break;
+      case InnerVertexRegion::INTERIOR:
+        if ( !boundaryRow )
+        {
+          applyRow( 2, xEnd - 1 );
+        }
+        break;
+      case InnerVertexRegion::BOUNDARY_LAYER:
+        if ( boundaryRow )
+        {
+          applyRow( 1, xEnd );
+        }
+        else
+        {
+          applyRow( 1, std::min( uint_t( 2 ), xEnd ) );
+          applyRow( std::max( uint_t( 2 ), xEnd - 1 ), xEnd );
+        }
+        break;
       }
-
-      dst[ centerIdx ] += tmp;
     }
   }
 }
@@ -555,7 +628,7 @@ inline void apply( const uint_t & level,
 template< typename ValueType >
 inline void smooth_gs( const uint_t & level,
                        Cell & cell,
-                       const PrimitiveDataID<LevelWiseMemory< StencilMap_T >,  Cell > & operatorId,
+                       const PrimitiveDataID<LevelWiseMemory< FlatStencil >,  Cell > & operatorId,
                        const PrimitiveDataID< FunctionMemory< ValueType >, Cell > & dstId,
                        const PrimitiveDataID< FunctionMemory< ValueType >, Cell > & rhsId )
 {
@@ -592,43 +665,113 @@ inline void smooth_gs( const uint_t & level,
 template< typename ValueType >
 inline void smooth_sor( const uint_t & level,
                        Cell & cell,
-                       const PrimitiveDataID< LevelWiseMemory< StencilMap_T >,  Cell > & operatorId,
+                       const PrimitiveDataID< LevelWiseMemory< FlatStencil >,  Cell > & operatorId,
                        const PrimitiveDataID< FunctionMemory< ValueType >, Cell > & dstId,
                        const PrimitiveDataID< FunctionMemory< ValueType >, Cell > & rhsId,
                        ValueType                                                    relax )
 {
-  typedef stencilDirection sd;
-
   auto operatorData = cell.getData( operatorId )->getData( level );
   const ValueType * rhs          = cell.getData( rhsId )->getPointer( level );
   ValueType * dst          = cell.getData( dstId )->getPointer( level );
 
-  ValueType tmp;
+  const uint_t width = levelinfo::num_microvertices_per_edge( level );
 
-  const auto inverseCenterWeight = 1.0 / operatorData[ { 0, 0, 0 } ];
+  const ValueType relaxOverCenter = static_cast< ValueType >( relax / operatorData[{ 0, 0, 0 }] );
+  const ValueType oneMinusRelax   = static_cast< ValueType >( 1 ) - relax;
 
-  for ( const auto & it : vertexdof::macrocell::Iterator( level, 1 ) )
+  // The weights are copied once to avoid the increment look-ups in the inner loop.
+  std::array< ValueType, neighborsWithoutCenter.size() > weights;
+  for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
   {
-    const uint_t x = it.x();
-    const uint_t y = it.y();
-    const uint_t z = it.z();
-
-    const uint_t centerIdx = vertexdof::macrocell::indexFromVertex( level, x, y, z, sd::VERTEX_C );
+    weights[k] = static_cast< ValueType >( operatorData[logicalIndexOffsetFromVertex( neighborsWithoutCenter[k] )] );
+  }
 
-    tmp = rhs[ centerIdx ];
+  // array index of the neighbor k of the vertex (1, y, z), the neighbors of (x, y, z) are located at offset x - 1
+  std::array< uint_t, neighborsWithoutCenter.size() > neighborRowStart;
 
-    for ( const auto & neighbor : vertexdof::macrocell::neighborsWithoutCenter )
+  // lexicographic order, x is the fastest index (as in vertexdof::macrocell::Iterator)
+  for ( uint_t z = 1; z < width - 1; ++z )
+  {
+    for ( uint_t y = 1; y < width - 1 - z; ++y )
     {
-      const uint_t idx        = vertexdof::macrocell::indexFromVertex( level, x, y, z, neighbor );
-      tmp -= operatorData[ logicalIndexOffsetFromVertex( neighbor ) ] * dst[ idx ];
-    }
+      for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
+      {
+        neighborRowStart[k] = indexFromVertex( level, 1, y, z, neighborsWithoutCenter[k] );
+      }
+      const uint_t centerRowStart = index( level, 1, y, z );
 
-    dst[ centerIdx ] = ( 1.0 - relax ) * dst[ centerIdx ] + tmp * relax * inverseCenterWeight;
+      for ( uint_t x = 1; x < width - 1 - y - z; ++x )
+      {
+        ValueType tmp = rhs[centerRowStart + x - 1];
+        for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
+        {
+          tmp -= weights[k] * dst[neighborRowStart[k] + x - 1];
+        }
+        dst[centerRowStart + x - 1] = oneMinusRelax * dst[centerRowStart + x - 1] + relaxOverCenter * tmp;
+      }
+    }
   }
 }
 
 
 
+/// SOR on the inner vertex DoFs of a macro-cell.
+///
+/// In contrast to smooth_sor() the DoFs are not updated in lexicographic order but color by color (see
+/// \ref vertexdof::macrocell::color). Since the DoFs of one color are not coupled, the result does not depend
+/// on the traversal order within one color and the inner loop is free of loop-carried dependencies.
+template < typename ValueType >
+inline void smooth_sor_multicolor( const uint_t&                                                level,
+                                   Cell&                                                        cell,
+                                   const PrimitiveDataID< LevelWiseMemory< FlatStencil >, Cell >&  operatorId,
+                                   const PrimitiveDataID< FunctionMemory< ValueType >, Cell >&   dstId,
+                                   const PrimitiveDataID< FunctionMemory< ValueType >, Cell >&   rhsId,
+                                   ValueType                                                    relax )
+{
+   auto             operatorData = cell.getData( operatorId )->getData( level );
+   const ValueType* rhs          = cell.getData( rhsId )->getPointer( level );
+   ValueType*       dst          = cell.getData( dstId )->getPointer( level );
+
+   const uint_t width = levelinfo::num_microvertices_per_edge( level );
+
+   const ValueType relaxOverCenter = relax / operatorData[{ 0, 0, 0 }];
+   const ValueType oneMinusRelax   = 1.0 - relax;
+
+   std::array< ValueType, neighborsWithoutCenter.size() > weights;
+   for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
+   {
+      weights[k] = operatorData[logicalIndexOffsetFromVertex( neighborsWithoutCenter[k] )];
+   }
+
+   // array index of the neighbor k of the vertex (1, y, z), the neighbors of (x, y, z) are located at offset x - 1
+   std::array< uint_t, neighborsWithoutCenter.size() > neighborRowStart;
+
+   for ( uint_t c = 0; c < numColors; ++c )
+   {
+      for ( uint_t z = 1; z < width - 1; ++z )
+      {
+         for ( uint_t y = 1; y < width - 1 - z; ++y )
+         {
+            for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
+            {
+               neighborRowStart[k] = indexFromVertex( level, 1, y, z, neighborsWithoutCenter[k] );
+            }
+            const uint_t centerRowStart = index( level, 1, y, z );
+
+            for ( uint_t x = firstIndexOfColor( c, 1, y, z ); x < width - 1 - y - z; x += numColors )
+            {
+               ValueType tmp = rhs[centerRowStart + x - 1];
+               for ( uint_t k = 0; k < neighborsWithoutCenter.size(); ++k )
+               {
+                  tmp -= weights[k] * dst[neighborRowStart[k] + x - 1];
+               }
+               dst[centerRowStart + x - 1] = oneMinusRelax * dst[centerRowStart + x - 1] + relaxOverCenter * tmp;
+            }
+         }
+      }
+   }
+}
+
 template< typename ValueType >
 inline void enumerate(const uint_t & Level, Cell & cell, const PrimitiveDataID<FunctionMemory< ValueType >, Cell> &dstId, ValueType& num) {
 
@@ -689,7 +832,7 @@ inline ValueType getMaxMagnitude( const uint_t & level, Cell &cell, const Primit
 
 inline void saveOperator( const uint_t&                                                                         Level,
                           Cell&                                                                                 cell,
-                          const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >& operatorId,
+                          const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&  operatorId,
                           const PrimitiveDataID< FunctionMemory< PetscInt >, Cell >&                            srcId,
                           const PrimitiveDataID< FunctionMemory< PetscInt >, Cell >&                            dstId,
                           const std::shared_ptr< SparseMatrixProxy >&                                           mat )
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <array>
+#include <map>
+
+#include "core/DataTypes.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/mpi/RecvBuffer.h"
+#include "core/mpi/SendBuffer.h"
+
+#include "hyteg/indexing/Common.hpp"
+
+namespace hyteg {
+namespace vertexdof {
+namespace macrocell {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// Number of weights of the constant vertex DoF stencil in a macro-cell (center and 14 neighbors).
+constexpr uint_t stencilSize = 15;
+
+/// Returns the position of the weight with the logical index increment (x, y, z) in a FlatStencil,
+/// or stencilSize if the increment is not part of the stencil.
+///
+/// The weights are sorted lexicographically by their index increments:
+///
+///   0: (-1, 0, 0)   3: (-1, 1, 0)   6: (0, 0,-1)   9: (0, 1,-1)   12: (1,-1, 1)
+///   1: (-1, 0, 1)   4: ( 0,-1, 0)   7: (0, 0, 0)  10: (0, 1, 0)   13: (1, 0,-1)
+///   2: (-1, 1,-1)   5: ( 0,-1, 1)   8: (0, 0, 1)  11: (1,-1, 0)   14: (1, 0, 0)
+constexpr uint_t stencilIndex( const int x, const int y, const int z )
+{
+   if ( x < -1 || x > 1 || y < -1 || y > 1 || z < -1 || z > 1 )
+   {
+      return stencilSize;
+   }
+   switch ( 9 * ( x + 1 ) + 3 * ( y + 1 ) + ( z + 1 ) )
+   {
+   case 4:
+      return 0;
+   case 5:
+      return 1;
+   case 6:
+      return 2;
+   case 7:
+      return 3;
+   case 10:
+      return 4;
+   case 11:
+      return 5;
+   case 12:
+      return 6;
+   case 13:
+      return 7;
+   case 14:
+      return 8;
+   case 15:
+      return 9;
+   case 16:
+      return 10;
+   case 19:
+      return 11;
+   case 20:
+      return 12;
+   case 21:
+      return 13;
+   case 22:
+      return 14;
+   default:
+      return stencilSize;
+   }
+}
+
+static_assert( stencilIndex( 0, 0, 0 ) == 7, "Unexpected position of the center weight." );
+static_assert( stencilIndex( 1, 1, 0 ) == stencilSize, "Increment (1, 1, 0) is not part of the macro-cell stencil." );
+
+/// \brief Constant 15-point vertex DoF stencil of a macro-cell, stored in a fixed-size array.
+///
+/// The weights are accessed via their logical index increments like in a std::map, but are stored
+/// contiguously in the order given by stencilIndex(), so that the lookups reduce to compile-time offsets.
+/// The generated kernels still take the weights as std::map, toMap() converts the stencil once per call.
+class FlatStencil
+{
+ public:
+   FlatStencil() { weights_.fill( real_t( 0 ) ); }
+
+   /// Copies the weights of a stencil map, as returned by the assembly routines.
+   FlatStencil( const std::map< indexing::IndexIncrement, real_t >& stencilMap )
+   : FlatStencil()
+   {
+      for ( const auto& it : stencilMap )
+      {
+         weights_[checkedIndex( it.first )] = it.second;
+      }
+   }
+
+   real_t&       operator[]( const indexing::IndexIncrement& increment ) { return weights_[index( increment )]; }
+   const real_t& operator[]( const indexing::IndexIncrement& increment ) const { return weights_[index( increment )]; }
+
+   real_t&       at( const indexing::IndexIncrement& increment ) { return weights_[checkedIndex( increment )]; }
+   const real_t& at( const indexing::IndexIncrement& increment ) const { return weights_[checkedIndex( increment )]; }
+
+   /// Returns 1 if the increment is part of the stencil and 0 otherwise (like std::map::count()).
+   uint_t count( const indexing::IndexIncrement& increment ) const
+   {
+      return stencilIndex( increment.x(), increment.y(), increment.z() ) < stencilSize ? 1 : 0;
+   }
+
+   /// Returns the weights as map[indexOffset] = weight, as expected by the generated kernels.
+   std::map< indexing::IndexIncrement, real_t > toMap() const
+   {
+      std::map< indexing::IndexIncrement, real_t > stencilMap;
+      for ( int x = -1; x <= 1; x++ )
+      {
+         for ( int y = -1; y <= 1; y++ )
+         {
+            for ( int z = -1; z <= 1; z++ )
+            {
+               const uint_t idx = stencilIndex( x, y, z );
+               if ( idx < stencilSize )
+               {
+                  stencilMap[indexing::IndexIncrement( x, y, z )] = weights_[idx];
+               }
+            }
+         }
+      }
+      return stencilMap;
+   }
+
+   real_t*       data() { return weights_.data(); }
+   const real_t* data() const { return weights_.data(); }
+
+   static constexpr uint_t size() { return stencilSize; }
+
+ private:
+   static uint_t index( const indexing::IndexIncrement& increment )
+   {
+      const uint_t idx = stencilIndex( increment.x(), increment.y(), increment.z() );
+      WALBERLA_ASSERT_LESS( idx, stencilSize, "Index increment is not part of the macro-cell stencil." );
+      return idx;
+   }
+
+   static uint_t checkedIndex( const indexing::IndexIncrement& increment )
+   {
+      const uint_t idx = stencilIndex( increment.x(), increment.y(), increment.z() );
+      WALBERLA_CHECK_LESS( idx,
+                           stencilSize,
+                           "Index increment (" << increment.x() << ", " << increment.y() << ", " << increment.z()
+                                               << ") is not part of the macro-cell stencil." );
+      return idx;
+   }
+
+   std::array< real_t, stencilSize > weights_;
+};
+
+/// map[indexOffset] = weight
+typedef FlatStencil StencilMap_T;
+
+} // namespace macrocell
+} // namespace vertexdof
+} // namespace hyteg
+
+namespace walberla {
+namespace mpi {
+
+template < typename T, // Element type of SendBuffer
+           typename G  // Growth policy of SendBuffer
+           >
+inline mpi::GenericSendBuffer< T, G >& operator<<( mpi::GenericSendBuffer< T, G >&                buffer,
+                                                   const hyteg::vertexdof::macrocell::FlatStencil& stencil )
+{
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      buffer << stencil.data()[i];
+   }
+   return buffer;
+}
+
+template < typename T // Element type  of RecvBuffer
+           >
+inline mpi::GenericRecvBuffer< T >& operator>>( mpi::GenericRecvBuffer< T >&              buffer,
+                                                hyteg::vertexdof::macrocell::FlatStencil& stencil )
+{
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      buffer >> stencil.data()[i];
+   }
+   return buffer;
+}
+
+} // namespace mpi
+} // namespace walberla
@@ -264,7 +264,8 @@ inline void interpolate( const uint_t&
                          Face&                                                                                     face,
                          const PrimitiveDataID< FunctionMemory< ValueType >, Face >&                               faceMemoryId,
                          const std::vector< PrimitiveDataID< FunctionMemory< ValueType >, Face > >&                srcIds,
-                         const std::function< ValueType( const hyteg::Point3D&, const std::vector< ValueType >& ) >& expr )
+                         const std::function< ValueType( const hyteg::Point3D&, const std::vector< ValueType >& ) >& expr,
+                         const real_t*                                                                             mappedCoordinates = nullptr )
 {
    ValueType* faceData = face.getData( faceMemoryId )->getPointer( Level );
 
@@ -276,20 +277,52 @@ inline void interpolate( const uint_t&
 
    std::vector< ValueType > srcVector( srcIds.size() );
 
-   Point3D xBlend;
+   // the mapped coordinates of all micro-vertices have been cached (see BlendedGeometryCache)
+   if( mappedCoordinates != nullptr )
+   {
+      for( const auto& it : vertexdof::macroface::Iterator( Level, 1 ) )
+      {
+         const uint_t idx = vertexdof::macroface::indexFromVertex( Level, it.x(), it.y(), stencilDirection::VERTEX_C );
+         for( uint_t k = 0; k < srcPtr.size(); ++k )
+         {
+            srcVector[k] = srcPtr[k][idx];
+         }
+         const Point3D x( { mappedCoordinates[3 * idx], mappedCoordinates[3 * idx + 1], mappedCoordinates[3 * idx + 2] } );
+         faceData[idx] = expr( x, srcVector );
+      }
+      return;
+   }
+
+   // the blending map is evaluated for one row of micro-vertices at a time (single virtual call per row)
+   std::vector< Point3D > coordinates;
+   std::vector< uint_t >  indices;
+   std::vector< Point3D > xBlend;
+
+   const auto processRow = [&]() {
+      face.getGeometryMap()->evalF( coordinates, xBlend );
+      for( uint_t i = 0; i < indices.size(); ++i )
+      {
+         const uint_t idx = indices[i];
+         for( uint_t k = 0; k < srcPtr.size(); ++k )
+         {
+            srcVector[k] = srcPtr[k][idx];
+         }
+         faceData[idx] = expr( xBlend[i], srcVector );
+      }
+      coordinates.clear();
+      indices.clear();
+   };
 
    for( const auto& it : vertexdof::macroface::Iterator( Level, 1 ) )
    {
-      const Point3D coordinate = coordinateFromIndex( Level, face, it );
-      const uint_t  idx        = vertexdof::macroface::indexFromVertex( Level, it.x(), it.y(), stencilDirection::VERTEX_C );
-
-      for( uint_t k = 0; k < srcPtr.size(); ++k )
+      if( it.x() == 1 && !indices.empty() )
       {
-         srcVector[k] = srcPtr[k][idx];
+         processRow();
       }
-      face.getGeometryMap()->evalF( coordinate, xBlend );
-      faceData[idx] = expr( xBlend, srcVector );
+      coordinates.push_back( coordinateFromIndex( Level, face, it ) );
+      indices.push_back( vertexdof::macroface::indexFromVertex( Level, it.x(), it.y(), stencilDirection::VERTEX_C ) );
    }
+   processRow();
 }
 
 template< typename ValueType >
@@ -809,6 +842,61 @@ inline void smooth_sor( const uint_t&
   }
 }
 
+/// SOR on the inner vertex DoFs of a macro-face that is not coupled to a macro-cell.
+///
+/// In contrast to smooth_sor() the DoFs are not updated in lexicographic order but color by color (see
+/// \ref vertexdof::macroface::color). Since the DoFs of one color are not coupled, the result does not depend
+/// on the traversal order within one color and the inner loop is free of loop-carried dependencies.
+template < typename ValueType >
+inline void smooth_sor_multicolor( const uint_t&                                               Level,
+                                   Face&                                                       face,
+                                   const PrimitiveDataID< StencilMemory< ValueType >, Face >&  operatorId,
+                                   const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstId,
+                                   const PrimitiveDataID< FunctionMemory< ValueType >, Face >& rhsId,
+                                   ValueType                                                   relax )
+{
+   WALBERLA_ASSERT_EQUAL( face.getNumNeighborCells(), 0, "Multi-color SOR is only implemented for 2D macro-faces." );
+
+   typedef stencilDirection sD;
+
+   const uint_t rowsize = levelinfo::num_microvertices_per_edge( Level );
+
+   auto opr_data = face.getData( operatorId )->getPointer( Level );
+   auto dst      = face.getData( dstId )->getPointer( Level );
+   auto rhs      = face.getData( rhsId )->getPointer( Level );
+
+   const ValueType relaxOverCenter = relax / opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_C )];
+   const ValueType oneMinusRelax   = 1.0 - relax;
+
+   const ValueType w_S  = opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_S )];
+   const ValueType w_SE = opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_SE )];
+   const ValueType w_E  = opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_E )];
+   const ValueType w_N  = opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_N )];
+   const ValueType w_NW = opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_NW )];
+   const ValueType w_W  = opr_data[vertexdof::stencilIndexFromVertex( sD::VERTEX_W )];
+
+   for ( uint_t c = 0; c < vertexdof::macroface::numColors; ++c )
+   {
+      for ( uint_t j = 1; j < rowsize - 2; ++j )
+      {
+         // the row below is one DoF longer, the row above one DoF shorter than the current row
+         const uint_t centerRow = vertexdof::macroface::index( Level, 0, j );
+         const uint_t southRow  = vertexdof::macroface::index( Level, 0, j - 1 );
+         const uint_t northRow  = vertexdof::macroface::index( Level, 0, j + 1 );
+
+         for ( uint_t i = vertexdof::macroface::firstIndexOfColor( c, 1, j ); i < rowsize - 1 - j;
+               i += vertexdof::macroface::numColors )
+         {
+            const ValueType tmp = rhs[centerRow + i] - w_S * dst[southRow + i] - w_SE * dst[southRow + i + 1] -
+                                  w_E * dst[centerRow + i + 1] - w_W * dst[centerRow + i - 1] - w_N * dst[northRow + i] -
+                                  w_NW * dst[northRow + i - 1];
+
+            dst[centerRow + i] = oneMinusRelax * dst[centerRow + i] + relaxOverCenter * tmp;
+         }
+      }
+   }
+}
+
 template < typename ValueType >
 inline void smoothSOR3D( const uint_t&                                                   Level,
                          Face&                                                           face,
@@ -31,6 +31,7 @@
 #include "hyteg/Levelinfo.hpp"
 #include "hyteg/types/matrix.hpp"
 #include "hyteg/polynomial/Polynomial2D.hpp"
+#include "hyteg/polynomial/Polynomial3D.hpp"
 
 #include <string>
 
@@ -311,5 +312,44 @@ public:
 
 };
 
+/// Polynomial approximations of the 15-point stencils of the inner micro-vertices of a macro-cell.
+/// The polynomials of a degree are sorted like vertexdof::macrocell::neighborsWithCenter.
+class CellP1PolynomialMemory
+{
+public:
+
+  typedef std::vector<GeneralPolynomial3D> CellPolynomials;
+
+  static constexpr uint_t NumStencilEntries = 15;
+
+  std::map<uint_t, CellPolynomials> polynomials_;
+
+  CellP1PolynomialMemory() {}
+
+  inline CellPolynomials& addDegree(uint_t degree)
+  {
+    if (polynomialDegreeExists(degree)) {
+      WALBERLA_LOG_WARNING("Degree already exists.");
+    }
+
+    CellPolynomials& tmp = polynomials_[degree];
+    tmp = CellPolynomials(NumStencilEntries, GeneralPolynomial3D(degree));
+    return tmp;
+  }
+
+  bool polynomialDegreeExists(uint_t degree) const {
+    return polynomials_.count(degree)>0;
+  }
+
+  CellPolynomials& getPolynomials(uint_t degree) {
+    return polynomials_.at(degree);
+  }
+
+  const CellPolynomials& getPolynomials(uint_t degree) const {
+    return polynomials_.at(degree);
+  }
+
+};
+
 
 } // namespace hyteg
@@ -23,6 +23,7 @@
 
 #include "hyteg/Levelinfo.hpp"
 #include "hyteg/Macros.hpp"
+#include "hyteg/boundary/FreeslipNormals.hpp"
 #include "hyteg/indexing/Common.hpp"
 #include "hyteg/p1functionspace/P1Elements.hpp"
 #include "hyteg/p1functionspace/VertexDoFMacroEdge.hpp"
@@ -39,60 +40,32 @@ namespace vertexdof {
 
 namespace macroface {
 
-template < typename ValueType >
-inline void projectNormal3D( uint_t                                                      level,
-                             const Face&                                                 face,
-                             const std::shared_ptr< PrimitiveStorage >&                  storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&    normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstIdV,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Face >& dstIdW )
+/// Computes the normals at all inner micro-vertices of a macro-face on the boundary of a 3D domain.
+inline void computeNormals3D( uint_t                                                   level,
+                              const Face&                                              face,
+                              const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                              FreeslipNormals&                                         freeslipNormals )
 {
    if ( face.getNumNeighborCells() == 2 )
    {
       WALBERLA_ABORT( "Cannot project normals if not a boundary face" );
    }
 
-   auto dstU = face.getData( dstIdU )->getPointer( level );
-   auto dstV = face.getData( dstIdV )->getPointer( level );
-   auto dstW = face.getData( dstIdW )->getPointer( level );
-
-   Point3D  normal;
-   Matrix3r projection;
-   Point3D  in;
-   Point3D  out;
-
-   Point3D x;
-   Point3D xPhy;
-
+   std::vector< Point3D > x;
    for ( const auto& it : vertexdof::macroface::Iterator( level, 1 ) )
    {
-      x = coordinateFromIndex( level, face, it );
-      face.getGeometryMap()->evalF( x, xPhy );
-
-      normal_function( xPhy, normal );
-
-      projection( 0, 0 ) = 1.0 - normal[0] * normal[0];
-      projection( 0, 1 ) = -normal[0] * normal[1];
-      projection( 0, 2 ) = -normal[0] * normal[2];
-      projection( 1, 0 ) = projection( 0, 1 );
-      projection( 1, 1 ) = 1.0 - normal[1] * normal[1];
-      projection( 1, 2 ) = -normal[1] * normal[2];
-      projection( 2, 0 ) = projection( 0, 2 );
-      projection( 2, 1 ) = projection( 1, 2 );
-      projection( 2, 2 ) = 1.0 - normal[2] * normal[2];
-
-      const uint_t idx = vertexdof::macroface::indexFromVertex( level, it.x(), it.y(), stencilDirection::VERTEX_C );
-
-      in[0] = dstU[idx];
-      in[1] = dstV[idx];
-      in[2] = dstW[idx];
+      x.push_back( coordinateFromIndex( level, face, it ) );
+      freeslipNormals.indices.push_back(
+          vertexdof::macroface::indexFromVertex( level, it.x(), it.y(), stencilDirection::VERTEX_C ) );
+   }
 
-      out = projection.mul( in );
+   std::vector< Point3D > xPhy;
+   face.getGeometryMap()->evalF( x, xPhy );
 
-      dstU[idx] = out[0];
-      dstV[idx] = out[1];
-      dstW[idx] = out[2];
+   freeslipNormals.normals.resize( xPhy.size() );
+   for ( uint_t i = 0; i < xPhy.size(); i++ )
+   {
+      normal_function( xPhy[i], freeslipNormals.normals[i] );
    }
 }
 
@@ -100,13 +73,12 @@ inline void projectNormal3D( uint_t
 
 namespace macroedge {
 
-template < typename ValueType >
-inline void projectNormal2D( uint_t                                                      level,
-                             const Edge&                                                 edge,
-                             const std::shared_ptr< PrimitiveStorage >&                  storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&    normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdV )
+/// Computes the normals at all inner micro-vertices of a macro-edge on the boundary of a 2D domain.
+inline void computeNormals2D( uint_t                                                   level,
+                              const Edge&                                              edge,
+                              const std::shared_ptr< PrimitiveStorage >&               storage,
+                              const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                              FreeslipNormals&                                         freeslipNormals )
 {
    if ( edge.getNumNeighborFaces() == 2 )
    {
@@ -115,93 +87,51 @@ inline void projectNormal2D( uint_t
 
    size_t rowsize = levelinfo::num_microvertices_per_edge( level );
 
-   auto dstU = edge.getData( dstIdU )->getPointer( level );
-   auto dstV = edge.getData( dstIdV )->getPointer( level );
-
    Face* faceS = storage->getFace( edge.neighborFaces()[0] );
 
-   Point3D  normal;
-   Matrix2r projection;
-   Point2D  in;
-   Point2D  out;
-
-   Point3D x  = edge.getCoordinates()[0];
-   real_t  h  = 1.0 / ( walberla::real_c( rowsize - 1 ) );
-   Point3D dx = h * edge.getDirection();
-   x += dx;
-   Point3D xPhy;
+   std::vector< Point3D > x;
+   Point3D                xCurrent = edge.getCoordinates()[0];
+   real_t                 h        = 1.0 / ( walberla::real_c( rowsize - 1 ) );
+   Point3D                dx       = h * edge.getDirection();
+   xCurrent += dx;
 
    for ( size_t i = 1; i < rowsize - 1; ++i )
    {
-      faceS->getGeometryMap()->evalF( x, xPhy );
-      normal_function( xPhy, normal );
-
-      projection( 0, 0 ) = 1.0 - normal[0] * normal[0];
-      projection( 0, 1 ) = -normal[0] * normal[1];
-      projection( 1, 0 ) = projection( 0, 1 );
-      projection( 1, 1 ) = 1.0 - normal[1] * normal[1];
-
-      in[0] = dstU[vertexdof::macroedge::indexFromVertex( level, i, stencilDirection::VERTEX_C )];
-      in[1] = dstV[vertexdof::macroedge::indexFromVertex( level, i, stencilDirection::VERTEX_C )];
-
-      out = projection.mul( in );
+      x.push_back( xCurrent );
+      freeslipNormals.indices.push_back( vertexdof::macroedge::indexFromVertex( level, i, stencilDirection::VERTEX_C ) );
+      xCurrent += dx;
+   }
 
-      dstU[vertexdof::macroedge::indexFromVertex( level, i, stencilDirection::VERTEX_C )] = out[0];
-      dstV[vertexdof::macroedge::indexFromVertex( level, i, stencilDirection::VERTEX_C )] = out[1];
+   std::vector< Point3D > xPhy;
+   faceS->getGeometryMap()->evalF( x, xPhy );
 
-      x += dx;
+   freeslipNormals.normals.resize( xPhy.size() );
+   for ( uint_t i = 0; i < xPhy.size(); i++ )
+   {
+      normal_function( xPhy[i], freeslipNormals.normals[i] );
    }
 }
 
-template < typename ValueType >
-inline void projectNormal3D( uint_t                                                      level,
-                             const Edge&                                                 edge,
-                             const std::shared_ptr< PrimitiveStorage >&                  storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&    normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdV,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Edge >& dstIdW )
+/// Computes the normals at all inner micro-vertices of a macro-edge on the boundary of a 3D domain.
+inline void computeNormals3D( uint_t                                                   level,
+                              const Edge&                                              edge,
+                              const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                              FreeslipNormals&                                         freeslipNormals )
 {
-   auto dstU = edge.getData( dstIdU )->getPointer( level );
-   auto dstV = edge.getData( dstIdV )->getPointer( level );
-   auto dstW = edge.getData( dstIdW )->getPointer( level );
-
-   Point3D  normal;
-   Matrix3r projection;
-   Point3D  in;
-   Point3D  out;
-
-   Point3D x;
-   Point3D xPhy;
-
+   std::vector< Point3D > x;
    for ( const auto& it : vertexdof::macroedge::Iterator( level, 1 ) )
    {
-      x = coordinateFromIndex( level, edge, it );
-      edge.getGeometryMap()->evalF( x, xPhy );
-
-      normal_function( xPhy, normal );
-
-      projection( 0, 0 ) = 1.0 - normal[0] * normal[0];
-      projection( 0, 1 ) = -normal[0] * normal[1];
-      projection( 0, 2 ) = -normal[0] * normal[2];
-      projection( 1, 0 ) = projection( 0, 1 );
-      projection( 1, 1 ) = 1.0 - normal[1] * normal[1];
-      projection( 1, 2 ) = -normal[1] * normal[2];
-      projection( 2, 0 ) = projection( 0, 2 );
-      projection( 2, 1 ) = projection( 1, 2 );
-      projection( 2, 2 ) = 1.0 - normal[2] * normal[2];
-
-      const uint_t idx = vertexdof::macroface::indexFromVertex( level, it.x(), it.y(), stencilDirection::VERTEX_C );
-
-      in[0] = dstU[idx];
-      in[1] = dstV[idx];
-      in[2] = dstW[idx];
+      x.push_back( coordinateFromIndex( level, edge, it ) );
+      freeslipNormals.indices.push_back( vertexdof::macroedge::indexFromVertex( level, it.x(), stencilDirection::VERTEX_C ) );
+   }
 
-      out = projection.mul( in );
+   std::vector< Point3D > xPhy;
+   edge.getGeometryMap()->evalF( x, xPhy );
 
-      dstU[idx] = out[0];
-      dstV[idx] = out[1];
-      dstW[idx] = out[2];
+   freeslipNormals.normals.resize( xPhy.size() );
+   for ( uint_t i = 0; i < xPhy.size(); i++ )
+   {
+      normal_function( xPhy[i], freeslipNormals.normals[i] );
    }
 }
 
@@ -255,19 +185,14 @@ inline void saveProjectNormalOperator2D( uint_t
 
 namespace macrovertex {
 
-template < typename ValueType >
-inline void projectNormal2D( uint_t                                                        level,
-                             const Vertex&                                                 vertex,
-                             const std::shared_ptr< PrimitiveStorage >&                    storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&      normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Vertex >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Vertex >& dstIdV )
+/// Computes the normal at a macro-vertex on the boundary of a 2D domain.
+inline void computeNormals2D( const Vertex&                                            vertex,
+                              const std::shared_ptr< PrimitiveStorage >&               storage,
+                              const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                              FreeslipNormals&                                         freeslipNormals )
 {
    WALBERLA_CHECK( storage->onBoundary( vertex.getID() ) );
 
-   auto dstU = vertex.getData( dstIdU )->getPointer( level );
-   auto dstV = vertex.getData( dstIdV )->getPointer( level );
-
    Face* faceS = storage->getFace( vertex.neighborFaces()[0] );
 
    Point3D xPhy;
@@ -276,64 +201,23 @@ inline void projectNormal2D( uint_t
    Point3D normal;
    normal_function( xPhy, normal );
 
-   Matrix2r projection;
-   projection( 0, 0 ) = 1.0 - normal[0] * normal[0];
-   projection( 0, 1 ) = -normal[0] * normal[1];
-   projection( 1, 0 ) = projection( 0, 1 );
-   projection( 1, 1 ) = 1.0 - normal[1] * normal[1];
-
-   Point2D in;
-   in[0]       = *dstU;
-   in[1]       = *dstV;
-   Point2D out = projection.mul( in );
-
-   *dstU = out[0];
-   *dstV = out[1];
+   freeslipNormals.indices.push_back( 0 );
+   freeslipNormals.normals.push_back( normal );
 }
 
-template < typename ValueType >
-inline void projectNormal3D( uint_t                                                        level,
-                             const Vertex&                                                 vertex,
-                             const std::shared_ptr< PrimitiveStorage >&                    storage,
-                             const std::function< void( const Point3D&, Point3D& ) >&      normal_function,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Vertex >& dstIdU,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Vertex >& dstIdV,
-                             const PrimitiveDataID< FunctionMemory< ValueType >, Vertex >& dstIdW )
+/// Computes the normal at a macro-vertex on the boundary of a 3D domain.
+inline void computeNormals3D( const Vertex&                                            vertex,
+                              const std::function< void( const Point3D&, Point3D& ) >& normal_function,
+                              FreeslipNormals&                                         freeslipNormals )
 {
-   auto dstU = vertex.getData( dstIdU )->getPointer( level );
-   auto dstV = vertex.getData( dstIdV )->getPointer( level );
-   auto dstW = vertex.getData( dstIdW )->getPointer( level );
-
-   Point3D  normal;
-   Matrix3r projection;
-   Point3D  in;
-   Point3D  out;
-
-   Point3D x = vertex.getCoordinates();
    Point3D xPhy;
-   vertex.getGeometryMap()->evalF( x, xPhy );
+   vertex.getGeometryMap()->evalF( vertex.getCoordinates(), xPhy );
 
+   Point3D normal;
    normal_function( xPhy, normal );
 
-   projection( 0, 0 ) = 1.0 - normal[0] * normal[0];
-   projection( 0, 1 ) = -normal[0] * normal[1];
-   projection( 0, 2 ) = -normal[0] * normal[2];
-   projection( 1, 0 ) = projection( 0, 1 );
-   projection( 1, 1 ) = 1.0 - normal[1] * normal[1];
-   projection( 1, 2 ) = -normal[1] * normal[2];
-   projection( 2, 0 ) = projection( 0, 2 );
-   projection( 2, 1 ) = projection( 1, 2 );
-   projection( 2, 2 ) = 1.0 - normal[2] * normal[2];
-
-   in[0] = dstU[0];
-   in[1] = dstV[0];
-   in[2] = dstW[0];
-
-   out = projection.mul( in );
-
-   dstU[0] = out[0];
-   dstV[0] = out[1];
-   dstW[0] = out[2];
+   freeslipNormals.indices.push_back( 0 );
+   freeslipNormals.normals.push_back( normal );
 }
 
 #ifdef HYTEG_BUILD_WITH_PETSC
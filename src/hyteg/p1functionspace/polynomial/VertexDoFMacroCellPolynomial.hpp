@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/Macros.hpp"
+#include "hyteg/indexing/Common.hpp"
+#include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMemory.hpp"
+#include "hyteg/polynomial/PolynomialEvaluator.hpp"
+#include "hyteg/primitives/Cell.hpp"
+
+#include "VertexDoFMacroFacePolynomial.hpp"
+
+namespace hyteg {
+namespace vertexdof {
+namespace macrocell {
+
+using walberla::int_c;
+using walberla::real_c;
+using walberla::uint_c;
+using walberla::uint_t;
+
+/// Applies the polynomial approximation of the stencils to the inner micro-vertices of a macro-cell.
+///
+/// The polynomials are evaluated in the logical coordinates (x, y, z) * h of the micro-vertices.
+/// Along each row in x-direction this only requires the forward differences of the Polynomial3DEvaluator.
+/// For OperatorType::EVEN the center weight is not evaluated but computed from the zero row sum.
+template < typename ValueType, OperatorType OprType, uint_t PolyDegree >
+inline void applyPolynomialTmpl( uint_t                                                   level,
+                                 Cell&                                                    cell,
+                                 const PrimitiveDataID< CellP1PolynomialMemory, Cell >&   polynomialId,
+                                 const PrimitiveDataID< FunctionMemory< ValueType >, Cell >& srcId,
+                                 const PrimitiveDataID< FunctionMemory< ValueType >, Cell >& dstId,
+                                 UpdateType                                               update )
+{
+   const auto&      polynomials = cell.getData( polynomialId )->getPolynomials( PolyDegree );
+   const ValueType* src         = cell.getData( srcId )->getPointer( level );
+   ValueType*       dst         = cell.getData( dstId )->getPointer( level );
+
+   const uint_t width = levelinfo::num_microvertices_per_edge( level );
+   const real_t h     = real_c( 1.0 ) / real_c( width - 1 );
+
+   WALBERLA_ASSERT_EQUAL( polynomials.size(), neighborsWithCenter.size() );
+
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+   for ( int zInt = 1; zInt < int_c( width ) - 1; ++zInt )
+   {
+      const uint_t z = uint_c( zInt );
+
+      // the evaluators are stateful, every thread needs its own set
+      std::vector< Polynomial3DEvaluator > evaluators;
+      evaluators.reserve( neighborsWithCenter.size() );
+      for ( const auto& poly : polynomials )
+      {
+         evaluators.emplace_back( poly );
+      }
+
+      for ( auto& evaluator : evaluators )
+      {
+         evaluator.setZ( real_c( z ) * h );
+      }
+
+      std::array< real_t, neighborsWithCenter.size() > stencil;
+      std::array< uint_t, neighborsWithCenter.size() > rowStart;
+
+      for ( uint_t y = 1; y < width - 1 - z; ++y )
+      {
+         // array index of the neighbor k of the vertex (1, y, z), the neighbors of (x, y, z) are located at offset x - 1
+         for ( uint_t k = 0; k < neighborsWithCenter.size(); ++k )
+         {
+            rowStart[k] = indexFromVertex( level, 1, y, z, neighborsWithCenter[k] );
+         }
+
+         for ( uint_t k = 0; k < neighborsWithCenter.size(); ++k )
+         {
+            if ( OprType == OperatorType::EVEN && k == 0 )
+            {
+               continue;
+            }
+            evaluators[k].setY( real_c( y ) * h );
+            evaluators[k].setStartX< PolyDegree >( 0.0, h );
+         }
+
+         for ( uint_t x = 1; x < width - 1 - y - z; ++x )
+         {
+            for ( uint_t k = 1; k < neighborsWithCenter.size(); ++k )
+            {
+               stencil[k] = evaluators[k].incrementEval< PolyDegree >();
+            }
+
+            if ( OprType == OperatorType::EVEN )
+            {
+               stencil[0] = real_c( 0 );
+               for ( uint_t k = 1; k < neighborsWithCenter.size(); ++k )
+               {
+                  stencil[0] -= stencil[k];
+               }
+            }
+            else
+            {
+               stencil[0] = evaluators[0].incrementEval< PolyDegree >();
+            }
+
+            ValueType tmp = static_cast< ValueType >( stencil[0] ) * src[rowStart[0] + x - 1];
+            for ( uint_t k = 1; k < neighborsWithCenter.size(); ++k )
+            {
+               tmp += static_cast< ValueType >( stencil[k] ) * src[rowStart[k] + x - 1];
+            }
+
+            if ( update == Replace )
+            {
+               dst[rowStart[0] + x - 1] = tmp;
+            }
+            else
+            {
+               dst[rowStart[0] + x - 1] += tmp;
+            }
+         }
+      }
+   }
+}
+
+SPECIALIZE_OPRTYPE_POLYNOMIAL( void, applyPolynomialTmpl, applyPolynomial )
+
+} // namespace macrocell
+} // namespace vertexdof
+} // namespace hyteg
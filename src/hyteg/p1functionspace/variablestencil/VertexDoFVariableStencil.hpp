@@ -60,79 +60,81 @@ inline void applyVariableStencil(uint_t Level,
 {
    typedef stencilDirection SD;
 
-   uint_t rowsize       = levelinfo::num_microvertices_per_edge( Level );
-   uint_t inner_rowsize = rowsize;
+   const uint_t rowsize = levelinfo::num_microvertices_per_edge( Level );
 
    auto src = face.getData( srcId )->getPointer( Level );
    auto dst = face.getData( dstId )->getPointer( Level );
 
-   Point3D x0( face.coords[0] ), x;
-   real_t  h = 1.0 / ( walberla::real_c( rowsize - 1 ) );
-
-   Point3D d0 = h * ( face.coords[1] - face.coords[0] );
-   Point3D d2 = h * ( face.coords[2] - face.coords[0] );
+   const Point3D x0( face.coords[0] );
+   const real_t  h = 1.0 / ( walberla::real_c( rowsize - 1 ) );
 
-   P1Form form;
-   form.setGeometryMap( face.getGeometryMap() );
+   const Point3D d0 = h * ( face.coords[1] - face.coords[0] );
+   const Point3D d2 = h * ( face.coords[2] - face.coords[0] );
 
-   ValueType tmp;
+   const Point3D dirS  = -1.0 * d2;
+   const Point3D dirSE = d0 - 1.0 * d2;
+   const Point3D dirE  = d0;
+   const Point3D dirW  = -1.0 * d0;
+   const Point3D dirNW = -1.0 * d0 + d2;
+   const Point3D dirN  = d2;
 
-   Point3D dirS  = -1.0 * d2;
-   Point3D dirSE = d0 - 1.0 * d2;
-   Point3D dirE  = d0;
-   Point3D dirW  = -1.0 * d0;
-   Point3D dirNW = -1.0 * d0 + d2;
-   Point3D dirN  = d2;
+   // The rows only write to their own micro-vertices, so they are distributed among the threads.
+   // Each thread assembles the stencils with its own form object.
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel default( shared )
+#endif
+   {
+      P1Form form;
+      form.setGeometryMap( face.getGeometryMap() );
 
-   std::vector< real_t > opr_data( 7 );
+      ValueType tmp;
+      Point3D   x;
 
-   for( uint_t j = 1; j < rowsize - 2; ++j )
-   {
-      x = x0;
-      x += walberla::real_c( j ) * d2 + d0;
+      std::vector< real_t > opr_data( 7 );
 
-      for( uint_t i = 1; i < inner_rowsize - 2; ++i )
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp for schedule( static )
+#endif
+      for( int row = 1; row < walberla::int_c( rowsize ) - 2; ++row )
       {
-         std::fill( opr_data.begin(), opr_data.end(), 0.0 );
+         const uint_t j             = walberla::uint_c( row );
+         const uint_t inner_rowsize = rowsize - ( j - 1 );
 
-         assembleLocalStencil< P1Form >( form, {x, x + dirW, x + dirS}, P1Elements::P1Elements2D::elementSW, opr_data.data() );
-         assembleLocalStencil< P1Form >( form, {x, x + dirS, x + dirSE}, P1Elements::P1Elements2D::elementS, opr_data.data() );
-         assembleLocalStencil< P1Form >( form, {x, x + dirSE, x + dirE}, P1Elements::P1Elements2D::elementSE, opr_data.data() );
-         assembleLocalStencil< P1Form >( form, {x, x + dirE, x + dirN}, P1Elements::P1Elements2D::elementNE, opr_data.data() );
-         assembleLocalStencil< P1Form >( form, {x, x + dirN, x + dirNW}, P1Elements::P1Elements2D::elementN, opr_data.data() );
-         assembleLocalStencil< P1Form >( form, {x, x + dirNW, x + dirW}, P1Elements::P1Elements2D::elementNW, opr_data.data() );
+         x = x0;
+         x += walberla::real_c( j ) * d2 + d0;
 
-         //      PointND<real_t, 7> test(opr_data.data());
-         //      WALBERLA_LOG_INFO("stencil = " << test);
-
-         if( update == Replace )
-         {
-            tmp = ValueType( 0 );
-         } else
+         for( uint_t i = 1; i < inner_rowsize - 2; ++i )
          {
-            tmp = dst[vertexdof::macroface::indexFromVertex( Level, i, j, SD::VERTEX_C )];
+            std::fill( opr_data.begin(), opr_data.end(), 0.0 );
+
+            assembleLocalStencil< P1Form >( form, {x, x + dirW, x + dirS}, P1Elements::P1Elements2D::elementSW, opr_data.data() );
+            assembleLocalStencil< P1Form >( form, {x, x + dirS, x + dirSE}, P1Elements::P1Elements2D::elementS, opr_data.data() );
+            assembleLocalStencil< P1Form >( form, {x, x + dirSE, x + dirE}, P1Elements::P1Elements2D::elementSE, opr_data.data() );
+            assembleLocalStencil< P1Form >( form, {x, x + dirE, x + dirN}, P1Elements::P1Elements2D::elementNE, opr_data.data() );
+            assembleLocalStencil< P1Form >( form, {x, x + dirN, x + dirNW}, P1Elements::P1Elements2D::elementN, opr_data.data() );
+            assembleLocalStencil< P1Form >( form, {x, x + dirNW, x + dirW}, P1Elements::P1Elements2D::elementNW, opr_data.data() );
+
+            if( update == Replace )
+            {
+               tmp = ValueType( 0 );
+            } else
+            {
+               tmp = dst[vertexdof::macroface::indexFromVertex( Level, i, j, SD::VERTEX_C )];
+            }
+
+            tmp += opr_data[vertexdof::stencilIndexFromVertex( SD::VERTEX_C )] *
+                   src[vertexdof::macroface::indexFromVertex( Level, i, j, SD::VERTEX_C )];
+            for( uint_t k = 0; k < vertexdof::macroface::neighborsWithoutCenter.size(); ++k )
+            {
+               tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[k] )] *
+                      src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[k] )];
+            }
+
+            dst[vertexdof::macroface::indexFromVertex( Level, i, j, SD::VERTEX_C )] = tmp;
+
+            x += d0;
          }
-
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( SD::VERTEX_C )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, SD::VERTEX_C )];
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[0] )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[0] )];
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[1] )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[1] )];
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[2] )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[2] )];
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[3] )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[3] )];
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[4] )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[4] )];
-         tmp += opr_data[vertexdof::stencilIndexFromVertex( vertexdof::macroface::neighborsWithoutCenter[5] )] *
-                src[vertexdof::macroface::indexFromVertex( Level, i, j, vertexdof::macroface::neighborsWithoutCenter[5] )];
-
-         dst[vertexdof::macroface::indexFromVertex( Level, i, j, SD::VERTEX_C )] = tmp;
-
-         x += d0;
       }
-      --inner_rowsize;
    }
 }
 
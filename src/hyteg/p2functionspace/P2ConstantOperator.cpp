@@ -19,6 +19,8 @@
  */
 #include "P2ConstantOperator.hpp"
 
+#include <cmath>
+
 #ifdef _MSC_VER
 #pragma warning( push, 0 )
 #endif
@@ -253,6 +255,15 @@ void P2ConstantOperator< P2Form >::smooth_sor_macro_faces( const P2Function< rea
 {
    this->timingTree_->start( "Macro-Face" );
 
+   KernelRegion kernelRegion( "sor_2D_macroface_P2", level, globalDefines::useGeneratedKernels && !storage_->hasGlobalCells() );
+   if ( kernelRegion.recordsStatistics() )
+   {
+      // vertex DoFs: 7 vertex and 12 edge DoF weights, edge DoFs: 5 edge and 4 vertex DoF weights
+      const uint_t numMacroFaces = kernelcost::numMacroPrimitivesWithFlag( storage_->getFaces(), dst, flag );
+      kernelRegion.setCost( kernelcost::constantStencilSOR( numMacroFaces * kernelcost::numInnerVertexDoFsPerFace( level ), 19 ) +
+                            kernelcost::constantStencilSOR( numMacroFaces * kernelcost::numInnerEdgeDoFsPerFace( level ), 9 ) );
+   }
+
    std::vector< PrimitiveID::IDType > faceIDs;
    for ( auto& it : storage_->getFaces() )
    {
@@ -859,6 +870,23 @@ void P2ConstantOperator< P2Form >::smooth_sor_macro_cells( const P2Function< rea
 {
    this->timingTree_->start( "Macro-Cell" );
 
+   KernelRegion kernelRegion( std::string( "sor_3D_macrocell_P2" ) + ( backwards ? "_backwards" : "" ),
+                              level,
+                              globalDefines::useGeneratedKernels && storage_->hasGlobalCells() );
+   if ( kernelRegion.recordsStatistics() && !storage_->getCells().empty() )
+   {
+      const uint_t vertexWeights = 15 + EdgeDoFToVertexDoF::MacroCellStencilMap_T::size();
+      // average over the edge DoF orientations
+      const uint_t edgeWeights = uint_c(
+          std::lround( double( edgedof::macrocell::StencilMap_T::size() + VertexDoFToEdgeDoF::MacroCellStencilMap_T::size() ) /
+                       double( edgedof::macrocell::numOrientations ) ) );
+
+      const uint_t numMacroCells = kernelcost::numMacroPrimitivesWithFlag( storage_->getCells(), dst, flag );
+      kernelRegion.setCost(
+          kernelcost::constantStencilSOR( numMacroCells * kernelcost::numInnerVertexDoFsPerCell( level ), vertexWeights ) +
+          kernelcost::constantStencilSOR( numMacroCells * kernelcost::numInnerEdgeDoFsPerCell( level ), edgeWeights ) );
+   }
+
    std::vector< PrimitiveID::IDType > cellIDs;
    for ( auto& it : storage_->getCells() )
    {
@@ -883,10 +911,11 @@ void P2ConstantOperator< P2Form >::smooth_sor_macro_cells( const P2Function< rea
             real_t* e_dst_data = cell.getData( dst.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
             real_t* e_rhs_data = cell.getData( rhs.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
 
-            auto v2v_opr_data = cell.getData( vertexToVertex.getCellStencilID() )->getData( level );
-            auto v2e_opr_data = cell.getData( vertexToEdge.getCellStencilID() )->getData( level );
-            auto e2v_opr_data = cell.getData( edgeToVertex.getCellStencilID() )->getData( level );
-            auto e2e_opr_data = cell.getData( edgeToEdge.getCellStencilID() )->getData( level );
+            // the generated kernels take the stencils as maps
+            const auto v2v_opr_data = cell.getData( vertexToVertex.getCellStencilID() )->getData( level ).toMap();
+            const auto v2e_opr_data = cell.getData( vertexToEdge.getCellStencilID() )->getData( level ).toMap();
+            const auto e2v_opr_data = cell.getData( edgeToVertex.getCellStencilID() )->getData( level ).toMap();
+            const auto e2e_opr_data = cell.getData( edgeToEdge.getCellStencilID() )->getData( level ).toMap();
 
             typedef edgedof::EdgeDoFOrientation eo;
             std::map< eo, uint_t >              firstIdx;
@@ -1245,6 +1274,115 @@ void P2ConstantOperator< P2Form >::smooth_sor( const P2Function< real_t >& dst,
       this->stopTiming( "SOR" );
 }
 
+template < class P2Form >
+void P2ConstantOperator< P2Form >::smooth_sor_multicolor_macro_faces( const P2Function< real_t >& dst,
+                                                                      const P2Function< real_t >& rhs,
+                                                                      const real_t&               relax,
+                                                                      const size_t                level,
+                                                                      const DoFType               flag ) const
+{
+   this->timingTree_->start( "Macro-Face" );
+
+   for ( auto& it : storage_->getFaces() )
+   {
+      Face& face = *it.second;
+
+      const DoFType faceBC = dst.getBoundaryCondition().getBoundaryType( face.getMeshBoundaryFlag() );
+      if ( testFlag( faceBC, flag ) )
+      {
+         P2::macroface::smoothSORMultiColor( level,
+                                             face,
+                                             relax,
+                                             vertexToVertex.getFaceStencilID(),
+                                             edgeToVertex.getFaceStencilID(),
+                                             dst.getVertexDoFFunction().getFaceDataID(),
+                                             vertexToEdge.getFaceStencilID(),
+                                             edgeToEdge.getFaceStencilID(),
+                                             dst.getEdgeDoFFunction().getFaceDataID(),
+                                             rhs.getVertexDoFFunction().getFaceDataID(),
+                                             rhs.getEdgeDoFFunction().getFaceDataID() );
+      }
+   }
+
+   this->timingTree_->stop( "Macro-Face" );
+}
+
+template < class P2Form >
+void P2ConstantOperator< P2Form >::smooth_sor_multicolor_macro_cells( const P2Function< real_t >& dst,
+                                                                      const P2Function< real_t >& rhs,
+                                                                      const real_t&               relax,
+                                                                      const size_t                level,
+                                                                      const DoFType               flag ) const
+{
+   this->timingTree_->start( "Macro-Cell" );
+
+   std::vector< PrimitiveID > cellIDs = storage_->getCellIDs();
+
+   #ifdef WALBERLA_BUILD_WITH_OPENMP
+   #pragma omp parallel for default(shared)
+   #endif
+   for ( int i = 0; i < int_c( cellIDs.size() ); i++ )
+   {
+      Cell& cell = *storage_->getCell( cellIDs[uint_c( i )] );
+
+      const DoFType cellBC = dst.getBoundaryCondition().getBoundaryType( cell.getMeshBoundaryFlag() );
+      if ( testFlag( cellBC, flag ) )
+      {
+         P2::macrocell::smoothSORMultiColor( level,
+                                             cell,
+                                             relax,
+                                             vertexToVertex.getCellStencilID(),
+                                             edgeToVertex.getCellStencilID(),
+                                             vertexToEdge.getCellStencilID(),
+                                             edgeToEdge.getCellStencilID(),
+                                             dst.getVertexDoFFunction().getCellDataID(),
+                                             rhs.getVertexDoFFunction().getCellDataID(),
+                                             dst.getEdgeDoFFunction().getCellDataID(),
+                                             rhs.getEdgeDoFFunction().getCellDataID() );
+      }
+   }
+
+   this->timingTree_->stop( "Macro-Cell" );
+}
+
+template < class P2Form >
+void P2ConstantOperator< P2Form >::smooth_sor_multicolor( const P2Function< real_t >& dst,
+                                                          const P2Function< real_t >& rhs,
+                                                          const real_t&               relax,
+                                                          const size_t                level,
+                                                          const DoFType               flag ) const
+{
+   this->startTiming( "SOR multi-color" );
+
+   communication::syncP2FunctionBetweenPrimitives( dst, level );
+
+   smooth_sor_macro_vertices( dst, rhs, relax, level, flag );
+
+   dst.getVertexDoFFunction().communicate< Vertex, Edge >( level );
+   dst.getEdgeDoFFunction().communicate< Vertex, Edge >( level );
+
+   smooth_sor_macro_edges( dst, rhs, relax, level, flag );
+
+   dst.getVertexDoFFunction().communicate< Edge, Face >( level );
+   dst.getEdgeDoFFunction().communicate< Edge, Face >( level );
+
+   if ( storage_->hasGlobalCells() )
+   {
+      smooth_sor_macro_faces( dst, rhs, relax, level, flag );
+
+      dst.getVertexDoFFunction().communicate< Face, Cell >( level );
+      dst.getEdgeDoFFunction().communicate< Face, Cell >( level );
+
+      smooth_sor_multicolor_macro_cells( dst, rhs, relax, level, flag );
+   }
+   else
+   {
+      smooth_sor_multicolor_macro_faces( dst, rhs, relax, level, flag );
+   }
+
+   this->stopTiming( "SOR multi-color" );
+}
+
 template < class P2Form >
 void P2ConstantOperator< P2Form >::smooth_jac( const P2Function< real_t >& dst,
                                                const P2Function< real_t >& rhs,
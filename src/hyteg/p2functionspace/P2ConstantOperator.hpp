@@ -76,6 +76,23 @@ class P2ConstantOperator : public Operator< P2Function< real_t >, P2Function< re
       smooth_sor( dst, rhs, relax, level, flag, true );
    }
 
+   /// Multi-color SOR.
+   ///
+   /// The inner DoFs of the macro-faces (2D) and macro-cells (3D) are updated color by color instead of in
+   /// lexicographic order. The vertex DoFs are colored as in the P1 case, the edge DoFs are colored by
+   /// their orientation, resulting in 6 colors in 2D and 11 colors in 3D.
+   /// The DoFs on the lower-dimensional macro-primitives are relaxed as in smooth_sor().
+   void smooth_sor_multicolor( const P2Function< real_t >& dst,
+                               const P2Function< real_t >& rhs,
+                               const real_t&               relax,
+                               size_t                      level,
+                               DoFType                     flag ) const;
+
+   void smooth_gs_multicolor( const P2Function< real_t >& dst, const P2Function< real_t >& rhs, size_t level, DoFType flag ) const
+   {
+      smooth_sor_multicolor( dst, rhs, 1.0, level, flag );
+   }
+
    void smooth_jac( const P2Function< real_t >& dst,
                     const P2Function< real_t >& rhs,
                     const P2Function< real_t >& src,
@@ -112,6 +129,18 @@ class P2ConstantOperator : public Operator< P2Function< real_t >, P2Function< re
                                 DoFType                     flag,
                                 const bool&                 backwards = false ) const;
 
+   void smooth_sor_multicolor_macro_faces( const P2Function< real_t >& dst,
+                                           const P2Function< real_t >& rhs,
+                                           const real_t&               relax,
+                                           size_t                      level,
+                                           DoFType                     flag ) const;
+
+   void smooth_sor_multicolor_macro_cells( const P2Function< real_t >& dst,
+                                           const P2Function< real_t >& rhs,
+                                           const real_t&               relax,
+                                           size_t                      level,
+                                           DoFType                     flag ) const;
+
    P1ConstantOperator< P2Form >         vertexToVertex;
    EdgeDoFToVertexDoFOperator< P2Form > edgeToVertex;
    VertexDoFToEdgeDoFOperator< P2Form > vertexToEdge;
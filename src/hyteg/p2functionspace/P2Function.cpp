@@ -34,6 +34,7 @@
 #include "hyteg/p2functionspace/P2MacroVertex.hpp"
 #include "hyteg/p2functionspace/P2Multigrid.hpp"
 #include "hyteg/p2functionspace/P2TransferOperators.hpp"
+#include "hyteg/primitivestorage/MacroPrimitiveLocator.hpp"
 
 namespace hyteg {
 
@@ -84,6 +85,21 @@ bool P2Function< ValueType >::evaluate( const Point3D& coordinates,
    WALBERLA_ABORT( "P2Function< ValueType >::evaluate not implemented for requested template parameter" );
 }
 
+template < typename ValueType >
+void P2Function< ValueType >::evaluate( const std::vector< Point3D >& coordinates,
+                                        uint_t                        level,
+                                        std::vector< ValueType >&     values,
+                                        std::vector< bool >&          found,
+                                        real_t                        searchToleranceRadius ) const
+{
+   WALBERLA_UNUSED( coordinates );
+   WALBERLA_UNUSED( level );
+   WALBERLA_UNUSED( values );
+   WALBERLA_UNUSED( found );
+   WALBERLA_UNUSED( searchToleranceRadius );
+   WALBERLA_ABORT( "P2Function< ValueType >::evaluate not implemented for requested template parameter" );
+}
+
 template < typename ValueType >
 void P2Function< ValueType >::evaluateGradient( const Point3D& coordinates, uint_t level, Point3D& gradient ) const
 {
@@ -665,90 +681,61 @@ void P2Function< ValueType >::setLocalCommunicationMode(
 template <>
 bool P2Function< real_t >::evaluate( const Point3D& coordinates, uint_t level, real_t& value, real_t searchToleranceRadius ) const
 {
-   if ( !this->getStorage()->hasGlobalCells() )
+   const auto  locator = this->getStorage()->getMacroPrimitiveLocator();
+   PrimitiveID primitiveID;
+   Point3D     computationalCoordinates;
+   if ( !locator->findLocalPrimitive( coordinates, searchToleranceRadius, primitiveID, computationalCoordinates ) )
    {
-      Point2D coordinates2D( {coordinates[0], coordinates[1]} );
-
-      for ( auto& it : this->getStorage()->getFaces() )
-      {
-         Face& face = *it.second;
-
-         Point2D faceCoodinates0( {face.getCoordinates()[0][0], face.getCoordinates()[0][1]} );
-         Point2D faceCoodinates1( {face.getCoordinates()[1][0], face.getCoordinates()[1][1]} );
-         Point2D faceCoodinates2( {face.getCoordinates()[2][0], face.getCoordinates()[2][1]} );
-
-         if ( isPointInTriangle( coordinates2D, faceCoodinates0, faceCoodinates1, faceCoodinates2 ) )
-         {
-            value = P2::macroface::evaluate(
-                level, face, coordinates, vertexDoFFunction_.getFaceDataID(), edgeDoFFunction_.getFaceDataID() );
-            return true;
-         }
-      }
+      return false;
+   }
 
-      if ( searchToleranceRadius > 0 )
-      {
-         for ( auto& it : this->getStorage()->getFaces() )
-         {
-            Face& face = *it.second;
-
-            Point2D faceCoodinates0( {face.getCoordinates()[0][0], face.getCoordinates()[0][1]} );
-            Point2D faceCoodinates1( {face.getCoordinates()[1][0], face.getCoordinates()[1][1]} );
-            Point2D faceCoodinates2( {face.getCoordinates()[2][0], face.getCoordinates()[2][1]} );
-
-            if ( circleTriangleIntersection(
-                     coordinates2D, searchToleranceRadius, faceCoodinates0, faceCoodinates1, faceCoodinates2 ) )
-            {
-               value = P2::macroface::evaluate(
-                   level, face, coordinates, vertexDoFFunction_.getFaceDataID(), edgeDoFFunction_.getFaceDataID() );
-               return true;
-            }
-         }
-      }
+   if ( !this->getStorage()->hasGlobalCells() )
+   {
+      Face& face = *this->getStorage()->getFace( primitiveID );
+      value      = P2::macroface::evaluate(
+          level, face, computationalCoordinates, vertexDoFFunction_.getFaceDataID(), edgeDoFFunction_.getFaceDataID() );
    }
    else
    {
-      for ( auto& it : this->getStorage()->getCells() )
-      {
-         Cell& cell = *it.second;
+      Cell& cell = *this->getStorage()->getCell( primitiveID );
+      value      = P2::macrocell::evaluate(
+          level, cell, computationalCoordinates, vertexDoFFunction_.getCellDataID(), edgeDoFFunction_.getCellDataID() );
+   }
 
-         if ( isPointInTetrahedron( coordinates,
-                                    cell.getCoordinates()[0],
-                                    cell.getCoordinates()[1],
-                                    cell.getCoordinates()[2],
-                                    cell.getCoordinates()[3],
-                                    cell.getFaceInwardNormal( 0 ),
-                                    cell.getFaceInwardNormal( 1 ),
-                                    cell.getFaceInwardNormal( 2 ),
-                                    cell.getFaceInwardNormal( 3 ) ) )
+   return true;
+}
+
+template <>
+void P2Function< real_t >::evaluate( const std::vector< Point3D >& coordinates,
+                                     uint_t                        level,
+                                     std::vector< real_t >&        values,
+                                     std::vector< bool >&          found,
+                                     real_t                        searchToleranceRadius ) const
+{
+   const auto storage = this->getStorage();
+
+   auto evaluateLocal = [&]( const PrimitiveID& primitiveID, const std::vector< Point3D >& points, std::vector< real_t >& result ) {
+      if ( !storage->hasGlobalCells() )
+      {
+         Face& face = *storage->getFace( primitiveID );
+         for ( uint_t i = 0; i < points.size(); i++ )
          {
-            value = P2::macrocell::evaluate(
-                level, cell, coordinates, vertexDoFFunction_.getCellDataID(), edgeDoFFunction_.getCellDataID() );
-            return true;
+            result[i] = P2::macroface::evaluate(
+                level, face, points[i], vertexDoFFunction_.getFaceDataID(), edgeDoFFunction_.getFaceDataID() );
          }
       }
-
-      if ( searchToleranceRadius > 0 )
+      else
       {
-         for ( auto& it : this->getStorage()->getCells() )
+         Cell& cell = *storage->getCell( primitiveID );
+         for ( uint_t i = 0; i < points.size(); i++ )
          {
-            Cell& cell = *it.second;
-
-            if ( sphereTetrahedronIntersection( coordinates,
-                                                searchToleranceRadius,
-                                                cell.getCoordinates()[0],
-                                                cell.getCoordinates()[1],
-                                                cell.getCoordinates()[2],
-                                                cell.getCoordinates()[3] ) )
-            {
-               value = P2::macrocell::evaluate(
-                   level, cell, coordinates, vertexDoFFunction_.getCellDataID(), edgeDoFFunction_.getCellDataID() );
-               return true;
-            }
+            result[i] = P2::macrocell::evaluate(
+                level, cell, points[i], vertexDoFFunction_.getCellDataID(), edgeDoFFunction_.getCellDataID() );
          }
       }
-   }
+   };
 
-   return false;
+   storage->getMacroPrimitiveLocator()->evaluateDistributed( coordinates, searchToleranceRadius, evaluateLocal, values, found );
 }
 
 template <>
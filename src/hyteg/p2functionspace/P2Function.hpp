@@ -91,7 +91,7 @@ class P2Function : public Function< P2Function< ValueType > >
    /// -> Does not need to be called collectively.
    /// -> Different values are returned on each process.
    ///
-   /// \param coordinates where the function shall be evaluated
+   /// \param coordinates where the function shall be evaluated (physical domain, blending maps are inverted)
    /// \param level refinement level
    /// \param value function value at the coordinate if search was successful
    /// \param searchToleranceRadius radius of the sphere (circle) for the second search phase, skipped if negative
@@ -99,6 +99,27 @@ class P2Function : public Function< P2Function< ValueType > >
    ///
    bool evaluate( const Point3D& coordinates, uint_t level, ValueType& value, real_t searchToleranceRadius = 1e-05 ) const;
 
+   /// \brief Evaluates the function at multiple points that may be located anywhere in the (global) domain.
+   ///
+   /// The points are located via the spatial index of the PrimitiveStorage (see MacroPrimitiveLocator),
+   /// grouped by the containing macro-primitive and evaluated in a single sweep. The two search phases
+   /// are the same as for the evaluation at a single point.
+   ///
+   /// Must be called collectively. Each process passes its own (possibly empty) list of points,
+   /// which may also be located in the subdomains of other processes.
+   ///
+   /// \param coordinates where the function shall be evaluated (physical domain, blending maps are inverted)
+   /// \param level refinement level
+   /// \param values function values at the coordinates, zero for points that were not found
+   /// \param found true for each point that was found on any process, false otherwise
+   /// \param searchToleranceRadius radius of the sphere (circle) for the second search phase, skipped if negative
+   ///
+   void evaluate( const std::vector< Point3D >& coordinates,
+                  uint_t                        level,
+                  std::vector< ValueType >&     values,
+                  std::vector< bool >&          found,
+                  real_t                        searchToleranceRadius = 1e-05 ) const;
+
    inline void evaluateGradient( const Point3D& coordinates, uint_t level, Point3D& gradient ) const;
 
    void interpolate( const ValueType& constant, uint_t level, DoFType flag = All ) const;
@@ -219,6 +240,12 @@ class P2Function : public Function< P2Function< ValueType > >
 template <>
 bool P2Function< real_t >::evaluate( const Point3D& coordinates, uint_t level, real_t& value, real_t searchToleranceRadius ) const;
 template <>
+void P2Function< real_t >::evaluate( const std::vector< Point3D >& coordinates,
+                                     uint_t                        level,
+                                     std::vector< real_t >&        values,
+                                     std::vector< bool >&          found,
+                                     real_t                        searchToleranceRadius ) const;
+template <>
 void P2Function< real_t >::evaluateGradient( const Point3D& coordinates, uint_t level, Point3D& gradient ) const;
 
 extern template class P2Function< double >;
@@ -37,7 +37,7 @@ void smoothSOR(
     const uint_t&                                                                                level,
     Cell&                                                                                        cell,
     const real_t&                                                                                relax,
-    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >&        vertexToVertexOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&         vertexToVertexOperatorId,
     const PrimitiveDataID< LevelWiseMemory< EdgeDoFToVertexDoF::MacroCellStencilMap_T >, Cell >& edgeToVertexOperatorId,
     const PrimitiveDataID< LevelWiseMemory< VertexDoFToEdgeDoF::MacroCellStencilMap_T >, Cell >& vertexToEdgeOperatorId,
     const PrimitiveDataID< LevelWiseMemory< edgedof::macrocell::StencilMap_T >, Cell >&          edgeToEdgeOperatorId,
@@ -46,10 +46,10 @@ void smoothSOR(
     const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     edgeDoFDstId,
     const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     edgeDoFRhsId )
 {
-   auto v2v_operator = cell.getData( vertexToVertexOperatorId )->getData( level );
-   auto e2v_operator = cell.getData( edgeToVertexOperatorId )->getData( level );
-   auto v2e_operator = cell.getData( vertexToEdgeOperatorId )->getData( level );
-   auto e2e_operator = cell.getData( edgeToEdgeOperatorId )->getData( level );
+   const auto& v2v_operator = cell.getData( vertexToVertexOperatorId )->getData( level );
+   const auto& e2v_operator = cell.getData( edgeToVertexOperatorId )->getData( level );
+   const auto& v2e_operator = cell.getData( vertexToEdgeOperatorId )->getData( level );
+   const auto& e2e_operator = cell.getData( edgeToEdgeOperatorId )->getData( level );
 
    real_t* vertexDoFDst = cell.getData( vertexDoFDstId )->getPointer( level );
    real_t* vertexDoFRhs = cell.getData( vertexDoFRhsId )->getPointer( level );
@@ -192,6 +192,195 @@ void smoothSOR(
    }
 }
 
+void smoothSORMultiColor(
+    const uint_t&                                                                                level,
+    Cell&                                                                                        cell,
+    const real_t&                                                                                relax,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&         vertexToVertexOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< EdgeDoFToVertexDoF::MacroCellStencilMap_T >, Cell >& edgeToVertexOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< VertexDoFToEdgeDoF::MacroCellStencilMap_T >, Cell >& vertexToEdgeOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< edgedof::macrocell::StencilMap_T >, Cell >&          edgeToEdgeOperatorId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     vertexDoFDstId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     vertexDoFRhsId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     edgeDoFDstId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     edgeDoFRhsId )
+{
+   const auto& v2v_operator = cell.getData( vertexToVertexOperatorId )->getData( level );
+   const auto& e2v_operator = cell.getData( edgeToVertexOperatorId )->getData( level );
+   const auto& v2e_operator = cell.getData( vertexToEdgeOperatorId )->getData( level );
+   const auto& e2e_operator = cell.getData( edgeToEdgeOperatorId )->getData( level );
+
+   real_t* vertexDoFDst = cell.getData( vertexDoFDstId )->getPointer( level );
+   real_t* vertexDoFRhs = cell.getData( vertexDoFRhsId )->getPointer( level );
+   real_t* edgeDoFDst   = cell.getData( edgeDoFDstId )->getPointer( level );
+   real_t* edgeDoFRhs   = cell.getData( edgeDoFRhsId )->getPointer( level );
+
+   const uint_t width         = levelinfo::num_microvertices_per_edge( level );
+   const real_t oneMinusRelax = real_c( 1 ) - relax;
+
+   // The stencils are flattened before the sweeps: the weights and the logical offsets of the leaves of the current
+   // DoF type are copied into arrays. The array indices of the center and of all leaves are linear in x, so they are
+   // computed once per row and the row is relaxed with an indexed loop.
+   std::vector< real_t >             vertexLeafWeights;
+   std::vector< IndexIncrement >     vertexLeafOffsets;
+   std::vector< uint_t >             vertexLeafIdx;
+   std::vector< real_t >             edgeLeafWeights;
+   std::vector< IndexIncrement >     edgeLeafOffsets;
+   std::vector< EdgeDoFOrientation > edgeLeafOrientations;
+   std::vector< uint_t >             edgeLeafIdx;
+
+   const auto clearLeaves = [&]() {
+      vertexLeafWeights.clear();
+      vertexLeafOffsets.clear();
+      edgeLeafWeights.clear();
+      edgeLeafOffsets.clear();
+      edgeLeafOrientations.clear();
+   };
+
+   // relaxes numDoFs DoFs with the passed stride in x, starting at the DoF first with the array index centerIdx
+   const auto relaxRow = [&]( const indexing::Index& first,
+                              const uint_t&          numDoFs,
+                              const uint_t&          stride,
+                              const uint_t&          centerIdx,
+                              const real_t* const    rhs,
+                              real_t* const          dst,
+                              const real_t&          relaxOverCenter ) {
+      vertexLeafIdx.resize( vertexLeafOffsets.size() );
+      for ( uint_t l = 0; l < vertexLeafOffsets.size(); ++l )
+      {
+         const auto leaf  = first + vertexLeafOffsets[l];
+         vertexLeafIdx[l] = vertexdof::macrocell::index( level, leaf.x(), leaf.y(), leaf.z() );
+      }
+      edgeLeafIdx.resize( edgeLeafOffsets.size() );
+      for ( uint_t l = 0; l < edgeLeafOffsets.size(); ++l )
+      {
+         const auto leaf = first + edgeLeafOffsets[l];
+         edgeLeafIdx[l]  = edgedof::macrocell::index( level, leaf.x(), leaf.y(), leaf.z(), edgeLeafOrientations[l] );
+      }
+
+      for ( uint_t k = 0; k < numDoFs * stride; k += stride )
+      {
+         real_t tmp = rhs[centerIdx + k];
+         for ( uint_t l = 0; l < vertexLeafIdx.size(); ++l )
+         {
+            tmp -= vertexLeafWeights[l] * vertexDoFDst[vertexLeafIdx[l] + k];
+         }
+         for ( uint_t l = 0; l < edgeLeafIdx.size(); ++l )
+         {
+            tmp -= edgeLeafWeights[l] * edgeDoFDst[edgeLeafIdx[l] + k];
+         }
+         dst[centerIdx + k] = oneMinusRelax * dst[centerIdx + k] + relaxOverCenter * tmp;
+      }
+   };
+
+   // update vertex unknowns color by color
+   const real_t vertexDoFRelaxOverCenter = relax / v2v_operator[{ 0, 0, 0 }];
+
+   clearLeaves();
+   for ( const auto& vertexLeaf : vertexdof::macrocell::neighborsWithoutCenter )
+   {
+      vertexLeafOffsets.push_back( vertexdof::logicalIndexOffsetFromVertex( vertexLeaf ) );
+      vertexLeafWeights.push_back( v2v_operator[vertexLeafOffsets.back()] );
+   }
+   for ( const auto& orientation : edgedof::allEdgeDoFOrientations )
+   {
+      for ( const auto& neighbor : P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromVertexDoFInMacroCell( orientation ) )
+      {
+         edgeLeafOffsets.push_back( neighbor );
+         edgeLeafOrientations.push_back( orientation );
+         edgeLeafWeights.push_back( e2v_operator[orientation][neighbor] );
+      }
+   }
+
+   for ( uint_t c = 0; c < vertexdof::macrocell::numColors; ++c )
+   {
+      for ( uint_t z = 1; z < width - 1; ++z )
+      {
+         for ( uint_t y = 1; y < width - 1 - z; ++y )
+         {
+            const uint_t xBegin = vertexdof::macrocell::firstIndexOfColor( c, 1, y, z );
+            const uint_t xEnd   = width - 1 - y - z;
+            if ( xBegin >= xEnd )
+            {
+               continue;
+            }
+            const uint_t numDoFs = ( xEnd - xBegin + vertexdof::macrocell::numColors - 1 ) / vertexdof::macrocell::numColors;
+            relaxRow( indexing::Index( xBegin, y, z ),
+                      numDoFs,
+                      vertexdof::macrocell::numColors,
+                      vertexdof::macrocell::index( level, xBegin, y, z ),
+                      vertexDoFRhs,
+                      vertexDoFDst,
+                      vertexDoFRelaxOverCenter );
+         }
+      }
+   }
+
+   // update edge unknowns, one sweep per orientation
+   for ( const auto& centerOrientation : edgedof::allEdgeDoFOrientations )
+   {
+      const real_t edgeDoFRelaxOverCenter = relax / e2e_operator[centerOrientation][centerOrientation][IndexIncrement( 0, 0, 0 )];
+
+      clearLeaves();
+      for ( const auto& neighbor : P2Elements::P2Elements3D::getAllVertexDoFNeighborsFromEdgeDoFInMacroCell( centerOrientation ) )
+      {
+         vertexLeafOffsets.push_back( neighbor );
+         vertexLeafWeights.push_back( v2e_operator[centerOrientation][neighbor] );
+      }
+      for ( const auto& leafOrientation : edgedof::allEdgeDoFOrientations )
+      {
+         for ( const auto& neighbor :
+               P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromEdgeDoFInMacroCell( centerOrientation, leafOrientation ) )
+         {
+            // skip center
+            if ( centerOrientation == leafOrientation && neighbor == IndexIncrement( 0, 0, 0 ) )
+               continue;
+
+            edgeLeafOffsets.push_back( neighbor );
+            edgeLeafOrientations.push_back( leafOrientation );
+            edgeLeafWeights.push_back( e2e_operator[centerOrientation][leafOrientation][neighbor] );
+         }
+      }
+
+      // same ranges as edgedof::macrocell::Iterator and IteratorXYZ
+      const uint_t numEdgesPerEdge =
+          levelinfo::num_microedges_per_edge( level ) - ( centerOrientation == EdgeDoFOrientation::XYZ ? 1 : 0 );
+
+      const auto isInner = [&]( const uint_t& x, const uint_t& y, const uint_t& z ) {
+         return edgedof::macrocell::isInnerEdgeDoF( level, indexing::Index( x, y, z ), centerOrientation );
+      };
+
+      for ( uint_t z = 0; z < numEdgesPerEdge; ++z )
+      {
+         for ( uint_t y = 0; y < numEdgesPerEdge - z; ++y )
+         {
+            // the inner edge DoFs of a row are contiguous, only the first and the last one may be on the boundary
+            uint_t xBegin = 0;
+            uint_t xEnd   = numEdgesPerEdge - y - z;
+            while ( xBegin < xEnd && !isInner( xBegin, y, z ) )
+            {
+               xBegin++;
+            }
+            while ( xEnd > xBegin && !isInner( xEnd - 1, y, z ) )
+            {
+               xEnd--;
+            }
+            if ( xBegin == xEnd )
+            {
+               continue;
+            }
+            relaxRow( indexing::Index( xBegin, y, z ),
+                      xEnd - xBegin,
+                      1,
+                      edgedof::macrocell::index( level, xBegin, y, z, centerOrientation ),
+                      edgeDoFRhs,
+                      edgeDoFDst,
+                      edgeDoFRelaxOverCenter );
+         }
+      }
+   }
+}
+
 } // namespace macrocell
 } // namespace P2
 } // namespace hyteg
\ No newline at end of file
@@ -181,7 +181,25 @@ void smoothSOR(
     const uint_t&                                                                                level,
     Cell&                                                                                        cell,
     const real_t&                                                                                relax,
-    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::StencilMap_T >, Cell >&        vertexToVertexOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&         vertexToVertexOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< EdgeDoFToVertexDoF::MacroCellStencilMap_T >, Cell >& edgeToVertexOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< VertexDoFToEdgeDoF::MacroCellStencilMap_T >, Cell >& vertexToEdgeOperatorId,
+    const PrimitiveDataID< LevelWiseMemory< edgedof::macrocell::StencilMap_T >, Cell >&          edgeToEdgeOperatorId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     vertexDoFDstId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     vertexDoFRhsId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     edgeDoFDstId,
+    const PrimitiveDataID< FunctionMemory< real_t >, Cell >&                                     edgeDoFRhsId );
+
+/// Multi-color variant of smoothSOR().
+///
+/// The vertex DoFs are relaxed in 4 colors (see \ref vertexdof::macrocell::color), followed by one sweep per
+/// edge DoF orientation. Since a micro-cell never contains two edges of the same orientation, the edge DoFs of
+/// one orientation are not coupled. In total 11 colors are used.
+void smoothSORMultiColor(
+    const uint_t&                                                                                level,
+    Cell&                                                                                        cell,
+    const real_t&                                                                                relax,
+    const PrimitiveDataID< LevelWiseMemory< vertexdof::macrocell::FlatStencil >, Cell >&         vertexToVertexOperatorId,
     const PrimitiveDataID< LevelWiseMemory< EdgeDoFToVertexDoF::MacroCellStencilMap_T >, Cell >& edgeToVertexOperatorId,
     const PrimitiveDataID< LevelWiseMemory< VertexDoFToEdgeDoF::MacroCellStencilMap_T >, Cell >& vertexToEdgeOperatorId,
     const PrimitiveDataID< LevelWiseMemory< edgedof::macrocell::StencilMap_T >, Cell >&          edgeToEdgeOperatorId,
@@ -367,6 +367,216 @@ void smoothSOR( const uint_t&                                            level,
    }
 }
 
+void smoothSORMultiColor( const uint_t&                                            level,
+                          const Face&                                              face,
+                          const real_t&                                            relax,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  vertexToVertexStencilID,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  edgeToVertexStencilID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& dstVertexDoFID,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  vertexToEdgeStencilID,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  edgeToEdgeStencilID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& dstEdgeDoFID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& rhsVertexDoFID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& rhsEdgeDoFID )
+{
+   typedef stencilDirection sD;
+
+   real_t* vertexToVertexStencil = face.getData( vertexToVertexStencilID )->getPointer( level );
+   real_t* edgeToVertexStencil   = face.getData( edgeToVertexStencilID )->getPointer( level );
+   real_t* dstVertexDoF          = face.getData( dstVertexDoFID )->getPointer( level );
+   real_t* vertexToEdgeStencil   = face.getData( vertexToEdgeStencilID )->getPointer( level );
+   real_t* edgeToEdgeStencil     = face.getData( edgeToEdgeStencilID )->getPointer( level );
+   real_t* dstEdgeDoF            = face.getData( dstEdgeDoFID )->getPointer( level );
+   real_t* rhsVertexDoF          = face.getData( rhsVertexDoFID )->getPointer( level );
+   real_t* rhsEdgeDoF            = face.getData( rhsEdgeDoFID )->getPointer( level );
+
+   const uint_t rowsize         = levelinfo::num_microvertices_per_edge( level );
+   const uint_t numEdgesPerEdge = levelinfo::num_microedges_per_edge( level );
+   const real_t oneMinusRelax   = 1.0 - relax;
+
+   const real_t vertexRelaxOverCenter = relax / vertexToVertexStencil[vertexdof::stencilIndexFromVertex( sD::VERTEX_C )];
+   const real_t edgeXRelaxOverCenter  = relax / edgeToEdgeStencil[edgedof::stencilIndexFromHorizontalEdge( sD::EDGE_HO_C )];
+   const real_t edgeXYRelaxOverCenter = relax / edgeToEdgeStencil[edgedof::stencilIndexFromDiagonalEdge( sD::EDGE_DI_C )];
+   const real_t edgeYRelaxOverCenter  = relax / edgeToEdgeStencil[edgedof::stencilIndexFromVerticalEdge( sD::EDGE_VE_C )];
+
+   // The stencils are flattened before the sweeps: the weights of the leaves of the current DoF type are copied into
+   // arrays. The array indices of the center and of all leaves are linear in the column, so they are computed for the
+   // first DoF of each row and the row is relaxed with an indexed loop.
+   std::vector< real_t > vertexLeafWeights;
+   std::vector< uint_t > vertexLeafIdx;
+   std::vector< real_t > edgeLeafWeights;
+   std::vector< uint_t > edgeLeafIdx;
+
+   // relaxes numDoFs DoFs with the passed stride, starting at the DoF with the array index centerIdx
+   const auto relaxRow = [&]( const uint_t&       numDoFs,
+                              const uint_t&       stride,
+                              const uint_t&       centerIdx,
+                              const real_t* const rhs,
+                              real_t* const       dst,
+                              const real_t&       relaxOverCenter ) {
+      for ( uint_t k = 0; k < numDoFs * stride; k += stride )
+      {
+         real_t tmp = rhs[centerIdx + k];
+         for ( uint_t l = 0; l < vertexLeafIdx.size(); ++l )
+         {
+            tmp -= vertexLeafWeights[l] * dstVertexDoF[vertexLeafIdx[l] + k];
+         }
+         for ( uint_t l = 0; l < edgeLeafIdx.size(); ++l )
+         {
+            tmp -= edgeLeafWeights[l] * dstEdgeDoF[edgeLeafIdx[l] + k];
+         }
+         dst[centerIdx + k] = oneMinusRelax * dst[centerIdx + k] + relaxOverCenter * tmp;
+      }
+   };
+
+   ////////// VERTEX //////////
+   vertexLeafWeights.clear();
+   for ( const auto& dir : vertexdof::macroface::neighborsWithoutCenter )
+   {
+      vertexLeafWeights.push_back( vertexToVertexStencil[vertexdof::stencilIndexFromVertex( dir )] );
+   }
+   edgeLeafWeights.clear();
+   for ( const auto& dir : edgedof::macroface::neighborsFromVertex )
+   {
+      edgeLeafWeights.push_back( edgeToVertexStencil[edgedof::stencilIndexFromVertex( dir )] );
+   }
+   vertexLeafIdx.resize( vertexLeafWeights.size() );
+   edgeLeafIdx.resize( edgeLeafWeights.size() );
+
+   for ( uint_t c = 0; c < vertexdof::macroface::numColors; ++c )
+   {
+      for ( uint_t j = 1; j < rowsize - 2; ++j )
+      {
+         const uint_t iBegin = vertexdof::macroface::firstIndexOfColor( c, 1, j );
+         const uint_t iEnd   = rowsize - 1 - j;
+         if ( iBegin >= iEnd )
+         {
+            continue;
+         }
+         for ( uint_t l = 0; l < vertexLeafIdx.size(); ++l )
+         {
+            vertexLeafIdx[l] =
+                vertexdof::macroface::indexFromVertex( level, iBegin, j, vertexdof::macroface::neighborsWithoutCenter[l] );
+         }
+         for ( uint_t l = 0; l < edgeLeafIdx.size(); ++l )
+         {
+            edgeLeafIdx[l] = edgedof::macroface::indexFromVertex( level, iBegin, j, edgedof::macroface::neighborsFromVertex[l] );
+         }
+         relaxRow( ( iEnd - iBegin + vertexdof::macroface::numColors - 1 ) / vertexdof::macroface::numColors,
+                   vertexdof::macroface::numColors,
+                   vertexdof::macroface::indexFromVertex( level, iBegin, j, sD::VERTEX_C ),
+                   rhsVertexDoF,
+                   dstVertexDoF,
+                   vertexRelaxOverCenter );
+      }
+   }
+
+   ////////// HORIZONTAL EDGE //////////
+   vertexLeafWeights.clear();
+   for ( const auto& dir : vertexdof::macroface::neighborsFromHorizontalEdge )
+   {
+      vertexLeafWeights.push_back( vertexToEdgeStencil[vertexdof::stencilIndexFromHorizontalEdge( dir )] );
+   }
+   edgeLeafWeights.clear();
+   for ( const auto& dir : edgedof::macroface::neighborsFromHorizontalEdgeWithoutCenter )
+   {
+      edgeLeafWeights.push_back( edgeToEdgeStencil[edgedof::stencilIndexFromHorizontalEdge( dir )] );
+   }
+   vertexLeafIdx.resize( vertexLeafWeights.size() );
+   edgeLeafIdx.resize( edgeLeafWeights.size() );
+
+   // inner horizontal edges: row > 0
+   for ( uint_t j = 1; j < numEdgesPerEdge; ++j )
+   {
+      for ( uint_t l = 0; l < vertexLeafIdx.size(); ++l )
+      {
+         vertexLeafIdx[l] =
+             vertexdof::macroface::indexFromHorizontalEdge( level, 0, j, vertexdof::macroface::neighborsFromHorizontalEdge[l] );
+      }
+      for ( uint_t l = 0; l < edgeLeafIdx.size(); ++l )
+      {
+         edgeLeafIdx[l] = edgedof::macroface::indexFromHorizontalEdge(
+             level, 0, j, edgedof::macroface::neighborsFromHorizontalEdgeWithoutCenter[l] );
+      }
+      relaxRow( numEdgesPerEdge - j,
+                1,
+                edgedof::macroface::indexFromHorizontalEdge( level, 0, j, sD::EDGE_HO_C ),
+                rhsEdgeDoF,
+                dstEdgeDoF,
+                edgeXRelaxOverCenter );
+   }
+
+   ////////// VERTICAL EDGE //////////
+   vertexLeafWeights.clear();
+   for ( const auto& dir : vertexdof::macroface::neighborsFromVerticalEdge )
+   {
+      vertexLeafWeights.push_back( vertexToEdgeStencil[vertexdof::stencilIndexFromVerticalEdge( dir )] );
+   }
+   edgeLeafWeights.clear();
+   for ( const auto& dir : edgedof::macroface::neighborsFromVerticalEdgeWithoutCenter )
+   {
+      edgeLeafWeights.push_back( edgeToEdgeStencil[edgedof::stencilIndexFromVerticalEdge( dir )] );
+   }
+   vertexLeafIdx.resize( vertexLeafWeights.size() );
+   edgeLeafIdx.resize( edgeLeafWeights.size() );
+
+   // inner vertical edges: column > 0
+   for ( uint_t j = 0; j + 1 < numEdgesPerEdge; ++j )
+   {
+      for ( uint_t l = 0; l < vertexLeafIdx.size(); ++l )
+      {
+         vertexLeafIdx[l] =
+             vertexdof::macroface::indexFromVerticalEdge( level, 1, j, vertexdof::macroface::neighborsFromVerticalEdge[l] );
+      }
+      for ( uint_t l = 0; l < edgeLeafIdx.size(); ++l )
+      {
+         edgeLeafIdx[l] = edgedof::macroface::indexFromVerticalEdge(
+             level, 1, j, edgedof::macroface::neighborsFromVerticalEdgeWithoutCenter[l] );
+      }
+      relaxRow( numEdgesPerEdge - j - 1,
+                1,
+                edgedof::macroface::indexFromVerticalEdge( level, 1, j, sD::EDGE_VE_C ),
+                rhsEdgeDoF,
+                dstEdgeDoF,
+                edgeYRelaxOverCenter );
+   }
+
+   ////////// DIAGONAL EDGE //////////
+   vertexLeafWeights.clear();
+   for ( const auto& dir : vertexdof::macroface::neighborsFromDiagonalEdge )
+   {
+      vertexLeafWeights.push_back( vertexToEdgeStencil[vertexdof::stencilIndexFromDiagonalEdge( dir )] );
+   }
+   edgeLeafWeights.clear();
+   for ( const auto& dir : edgedof::macroface::neighborsFromDiagonalEdgeWithoutCenter )
+   {
+      edgeLeafWeights.push_back( edgeToEdgeStencil[edgedof::stencilIndexFromDiagonalEdge( dir )] );
+   }
+   vertexLeafIdx.resize( vertexLeafWeights.size() );
+   edgeLeafIdx.resize( edgeLeafWeights.size() );
+
+   // inner diagonal edges: column + row < numEdgesPerEdge - 1
+   for ( uint_t j = 0; j + 1 < numEdgesPerEdge; ++j )
+   {
+      for ( uint_t l = 0; l < vertexLeafIdx.size(); ++l )
+      {
+         vertexLeafIdx[l] =
+             vertexdof::macroface::indexFromDiagonalEdge( level, 0, j, vertexdof::macroface::neighborsFromDiagonalEdge[l] );
+      }
+      for ( uint_t l = 0; l < edgeLeafIdx.size(); ++l )
+      {
+         edgeLeafIdx[l] = edgedof::macroface::indexFromDiagonalEdge(
+             level, 0, j, edgedof::macroface::neighborsFromDiagonalEdgeWithoutCenter[l] );
+      }
+      relaxRow( numEdgesPerEdge - j - 1,
+                1,
+                edgedof::macroface::indexFromDiagonalEdge( level, 0, j, sD::EDGE_DI_C ),
+                rhsEdgeDoF,
+                dstEdgeDoF,
+                edgeXYRelaxOverCenter );
+   }
+}
+
 void smoothSOR3D(
     const uint_t&                                                                                level,
     const PrimitiveStorage&                                                                      storage,
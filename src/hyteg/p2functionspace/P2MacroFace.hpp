@@ -76,6 +76,23 @@ void smoothSOR( const uint_t&                                            level,
                 const PrimitiveDataID< FunctionMemory< real_t >, Face >& rhsVertexDoFID,
                 const PrimitiveDataID< FunctionMemory< real_t >, Face >& rhsEdgeDoFID );
 
+/// Multi-color variant of smoothSOR().
+///
+/// The vertex DoFs are relaxed in 3 colors (see \ref vertexdof::macroface::color), followed by one sweep per
+/// edge DoF orientation. Since a micro-face never contains two edges of the same orientation, the edge DoFs of
+/// one orientation are not coupled. In total 6 colors are used.
+void smoothSORMultiColor( const uint_t&                                            level,
+                          const Face&                                              face,
+                          const real_t&                                            relax,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  vertexToVertexStencilID,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  edgeToVertexStencilID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& dstVertexDoFID,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  vertexToEdgeStencilID,
+                          const PrimitiveDataID< StencilMemory< real_t >, Face >&  edgeToEdgeStencilID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& dstEdgeDoFID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& rhsVertexDoFID,
+                          const PrimitiveDataID< FunctionMemory< real_t >, Face >& rhsEdgeDoFID );
+
 void smoothSOR3D(
     const uint_t&                                                                                level,
     const PrimitiveStorage & storage,
@@ -32,6 +32,8 @@
 #include <hyteg/forms/form_hyteg_manual/P2FormMass.hpp>
 
 #include <hyteg/p2functionspace/polynomial/StencilInterpolator.hpp>
+#include <hyteg/p2functionspace/polynomial/P2MacroCellPolynomial.hpp>
+#include <hyteg/polynomial/LSQPInterpolator3D.hpp>
 
 #include <hyteg/p1functionspace/VertexDoFFunction.hpp>
 #include <hyteg/p2functionspace/P2Function.hpp>
@@ -39,6 +41,12 @@
 
 namespace hyteg {
 
+/// P2 operator with stencils that are approximated by polynomials on each macro-face (2D) or macro-cell (3D).
+///
+/// In 3D, the surrogate stencils are applied to the inner DoFs of the macro-cells, the polynomials are fitted
+/// to stencils that are sampled on the inner micro-vertices of the interpolation level. As in
+/// P1PolynomialBlendingOperator, the contributions to the DoFs on the macro-cell boundaries are computed elementwise
+/// and added up via additive communication. The form must therefore provide integrateAll() for tetrahedra.
 template <class P2Form, OperatorType OprType>
 class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_t>>
 {
@@ -50,10 +58,20 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
    {
       for (uint_t level = minLevel_; level <= maxLevel_; ++level)
       {
-         PrimitiveDataID<P2::FacePolynomialMemory, Face> id;
-         auto dataHandling = std::make_shared<FaceP2PolynomialMemoryDataHandling>();
-         storage_->addFaceData(id, dataHandling, "P2OperatorFacePolynomial");
-         polynomialIDs_[level] = id;
+         if (storage_->hasGlobalCells())
+         {
+            PrimitiveDataID<P2::CellPolynomialMemory, Cell> id;
+            auto dataHandling = std::make_shared<CellP2PolynomialMemoryDataHandling>();
+            storage_->addCellData(id, dataHandling, "P2OperatorCellPolynomial");
+            cellPolynomialIDs_[level] = id;
+         }
+         else
+         {
+            PrimitiveDataID<P2::FacePolynomialMemory, Face> id;
+            auto dataHandling = std::make_shared<FaceP2PolynomialMemoryDataHandling>();
+            storage_->addFaceData(id, dataHandling, "P2OperatorFacePolynomial");
+            polynomialIDs_[level] = id;
+         }
       }
    }
 
@@ -69,6 +87,12 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
 
    void interpolateStencils(uint_t polyDegree)
    {
+      if (storage_->hasGlobalCells())
+      {
+         interpolateStencils3D(polyDegree);
+         return;
+      }
+
       real_t  H = 1.0 / (walberla::real_c(levelinfo::num_microvertices_per_edge(interpolationLevel_) - 1));
 
       // stencil entries
@@ -193,6 +217,45 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
       }
    }
 
+   void interpolateStencils3D(uint_t polyDegree)
+   {
+      WALBERLA_CHECK_GREATER_EQUAL(interpolationLevel_, uint_t(2), "There are no inner micro-vertices below level 2.");
+
+      const real_t H = 1.0 / walberla::real_c(levelinfo::num_microedges_per_edge(interpolationLevel_));
+
+      for (auto& it : storage_->getCells())
+      {
+         Cell& cell = *it.second;
+         form_.setGeometryMap(cell.getGeometryMap());
+
+         for (uint_t level = minLevel_; level <= maxLevel_; ++level)
+         {
+            auto& polynomials = cell.getData(cellPolynomialIDs_[level])
+                                    ->addDegree(polyDegree, P2::variablestencil::macrocell::numSurrogateStencilEntries(true));
+
+            for (uint_t rowType = 0; rowType < P2::CellPolynomialMemory::NumRowTypes; ++rowType)
+            {
+               const auto& layout = P2::variablestencil::macrocell::surrogateStencilLayout(rowType, true);
+
+               LSQPInterpolator3D<MonomialBasis3D> interpolator(polyDegree, interpolationLevel_, layout.entries.size());
+               std::vector<real_t>                 stencil(layout.entries.size());
+
+               // sample the stencils of the current level on the inner micro-vertices of the interpolation level
+               for (const auto& idx : vertexdof::macrocell::Iterator(interpolationLevel_, 1))
+               {
+                  const Point3D ref_x(
+                      {H * walberla::real_c(idx.x()), H * walberla::real_c(idx.y()), H * walberla::real_c(idx.z())});
+                  P2::variablestencil::macrocell::assembleSurrogateStencil<P2Form, Matrix10r>(
+                      form_, cell, ref_x, level, layout, stencil);
+                  interpolator.addInterpolationPoint(ref_x, stencil);
+               }
+
+               interpolator.interpolate(polynomials[rowType]);
+            }
+         }
+      }
+   }
+
    void useDegree(uint_t degree) {polyDegree_ = degree;}
 
    void apply(const P2Function<real_t>& src, const P2Function<real_t>& dst,
@@ -202,6 +265,12 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
 
       checkForMissingPolynomial(level);
 
+      if (storage_->hasGlobalCells())
+      {
+         apply3D(src, dst, level, flag, updateType);
+         return;
+      }
+
       communication::syncP2FunctionBetweenPrimitives(src, level);
 
       const vertexdof::VertexDoFFunction<real_t>&  srcVertexDoF   = src.getVertexDoFFunction();
@@ -252,6 +321,8 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
    void smooth_gs(const P2Function<real_t>& dst, const P2Function<real_t>& rhs,
                   const size_t level, DoFType flag) const
    {
+      WALBERLA_CHECK(!storage_->hasGlobalCells(), "P2SurrogateOperator::smooth_gs() not implemented for 3D");
+
       checkForMissingPolynomial(level);
 
       communication::syncP2FunctionBetweenPrimitives(dst, level);
@@ -305,11 +376,6 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
       }
 
       // communication::syncP2FunctionBetweenPrimitives(dst, level);
-
-      if (storage_->hasGlobalCells())
-      {
-         WALBERLA_ABORT("P2PolynomialBleningOperator not implemented for 3D")
-      }
    }
 
    void smooth_jac(const P1Function<real_t>& dst, const P1Function<real_t>& rhs,
@@ -320,15 +386,59 @@ class P2SurrogateOperator : public Operator<P2Function<real_t>, P2Function<real_
 
  private:
 
+   void apply3D(const P2Function<real_t>& src, const P2Function<real_t>& dst,
+                const size_t level, DoFType flag, UpdateType updateType) const
+   {
+      communication::syncP2FunctionBetweenPrimitives(src, level);
+
+      if (updateType == Replace)
+      {
+         // Only the flagged DoFs are zeroed here, the halos of the macro-cells are zeroed below.
+         dst.interpolate(walberla::real_c(0), level, flag);
+      }
+
+      P2Form form(form_);
+
+      for (auto& it : storage_->getCells())
+      {
+         Cell& cell = *it.second;
+         form.setGeometryMap(cell.getGeometryMap());
+
+         const real_t* srcVertexData = cell.getData(src.getVertexDoFFunction().getCellDataID())->getPointer(level);
+         const real_t* srcEdgeData   = cell.getData(src.getEdgeDoFFunction().getCellDataID())->getPointer(level);
+         real_t*       dstVertexData = cell.getData(dst.getVertexDoFFunction().getCellDataID())->getPointer(level);
+         real_t*       dstEdgeData   = cell.getData(dst.getEdgeDoFFunction().getCellDataID())->getPointer(level);
+
+         // Zero out dst halos only, the contributions of all macro-cells are added up during the additive communication.
+         P2::variablestencil::macrocell::zeroMacroCellBoundary(level, dstVertexData, dstEdgeData);
+
+         P2::variablestencil::macrocell::applyPolynomial(polyDegree_, cellPolynomialIDs_.at(level), level, cell,
+                                                         srcVertexData, srcEdgeData, dstVertexData, dstEdgeData, updateType);
+
+         P2::variablestencil::macrocell::applyElementwiseOnMacroCellBoundary<P2Form, Matrix10r>(
+            form, cell, level, srcVertexData, srcEdgeData, dstVertexData, dstEdgeData);
+      }
+
+      // Push result to lower-dimensional primitives
+      const DoFType excludeFlag = DoFType::All ^ flag;
+      dst.getVertexDoFFunction().communicateAdditively<Cell, Face>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getVertexDoFFunction().communicateAdditively<Cell, Edge>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getVertexDoFFunction().communicateAdditively<Cell, Vertex>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getEdgeDoFFunction().communicateAdditively<Cell, Face>(level, excludeFlag, *storage_, updateType == Replace);
+      dst.getEdgeDoFFunction().communicateAdditively<Cell, Edge>(level, excludeFlag, *storage_, updateType == Replace);
+   }
+
    inline void checkForMissingPolynomial(uint_t level) const
    {
-      WALBERLA_ASSERT(polynomialIDs_.count(level) > 0, "Polynomial for level " << level << " has not been interpolated");
+      WALBERLA_ASSERT(polynomialIDs_.count(level) > 0 || cellPolynomialIDs_.count(level) > 0,
+                      "Polynomial for level " << level << " has not been interpolated");
    }
 
    uint_t polyDegree_;
    uint_t interpolationLevel_;
    P2Form form_;
    std::map<uint_t, PrimitiveDataID<P2::FacePolynomialMemory, Face>> polynomialIDs_;
+   std::map<uint_t, PrimitiveDataID<P2::CellPolynomialMemory, Cell>> cellPolynomialIDs_;
 };
 
 typedef P2SurrogateOperator<P2Form_laplace, OperatorType::EVEN> P2SurrogateLaplaceOperator;
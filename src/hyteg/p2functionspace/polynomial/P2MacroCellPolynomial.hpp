@@ -0,0 +1,534 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/Macros.hpp"
+#include "hyteg/celldofspace/CellDoFIndexing.hpp"
+#include "hyteg/edgedofspace/EdgeDoFIndexing.hpp"
+#include "hyteg/indexing/Common.hpp"
+#include "hyteg/p1functionspace/VertexDoFIndexing.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
+#include "hyteg/p2functionspace/polynomial/P2PolynomialMemory.hpp"
+#include "hyteg/polynomial/PolynomialEvaluator.hpp"
+#include "hyteg/primitives/Cell.hpp"
+
+namespace hyteg {
+namespace P2 {
+namespace variablestencil {
+namespace macrocell {
+
+using indexing::IndexIncrement;
+using walberla::int_c;
+using walberla::real_c;
+using walberla::uint_c;
+using walberla::uint_t;
+
+/// Coupling of the center DoF of a stencil in a macro-cell to the DoF at the logical offset \p offset.
+struct SurrogateStencilEntry
+{
+   bool                        isEdgeDoF;
+   edgedof::EdgeDoFOrientation orientation;
+   IndexIncrement              offset;
+};
+
+/// Micro-cell that contains the center DoF of a stencil in a macro-cell.
+struct SurrogateStencilElement
+{
+   /// logical offsets of the micro-vertices from the stencil center
+   std::array< IndexIncrement, 4 > vertexOffsets;
+   /// row of the local element matrix that belongs to the stencil center
+   uint_t localRow;
+   /// stencil entry of each column of the local element matrix
+   std::vector< uint_t > entryIndices;
+};
+
+/// Stencil of a DoF in the interior of a macro-cell, assembled from the local element matrices of the micro-cells around it.
+struct SurrogateStencilLayout
+{
+   std::vector< SurrogateStencilEntry >   entries;
+   std::vector< SurrogateStencilElement > elements;
+};
+
+/// Pairs of local micro-vertices that span the edges of a micro-cell in the ordering of the P2 element matrices.
+const std::array< std::array< uint_t, 2 >, 6 > localEdgesFEniCSOrdering = {
+    { { 2, 3 }, { 1, 3 }, { 1, 2 }, { 0, 3 }, { 0, 2 }, { 0, 1 } } };
+
+/// The stencils are distinguished by the type of the center DoF (row type): 0 is a vertex-DoF,
+/// k > 0 an edge-DoF of orientation edgedof::allEdgeDoFOrientations[k - 1].
+inline SurrogateStencilLayout computeSurrogateStencilLayout( const uint_t rowType, const bool srcIsP2 )
+{
+   WALBERLA_ASSERT_LESS( rowType, CellPolynomialMemory::NumRowTypes );
+
+   // logical offsets of the micro-vertices that span the center DoF
+   std::vector< IndexIncrement > centerVertices;
+   if ( rowType == 0 )
+   {
+      centerVertices.push_back( IndexIncrement( 0, 0, 0 ) );
+   }
+   else
+   {
+      const auto neighbors = edgedof::calcNeighboringVertexDoFIndices( edgedof::allEdgeDoFOrientations[rowType - 1] );
+      centerVertices.push_back( neighbors[0] );
+      centerVertices.push_back( neighbors[1] );
+   }
+
+   SurrogateStencilLayout layout;
+
+   const auto entryIndex = [&layout]( bool                        isEdgeDoF,
+                                      edgedof::EdgeDoFOrientation orientation,
+                                      const IndexIncrement&       offset ) -> uint_t {
+      for ( uint_t i = 0; i < layout.entries.size(); i++ )
+      {
+         const auto& entry = layout.entries[i];
+         if ( entry.isEdgeDoF == isEdgeDoF && ( !isEdgeDoF || entry.orientation == orientation ) && entry.offset == offset )
+         {
+            return i;
+         }
+      }
+      layout.entries.push_back( { isEdgeDoF, orientation, offset } );
+      return layout.entries.size() - 1;
+   };
+
+   // All micro-cells that contain a micro-vertex are located in the 3x3x3 block of micro-cell indices around it.
+   // The micro-cell indices are shifted by a fixed center, since they cannot be negative.
+   const int center = 2;
+   for ( int z = -1; z <= 1; z++ )
+   {
+      for ( int y = -1; y <= 1; y++ )
+      {
+         for ( int x = -1; x <= 1; x++ )
+         {
+            const indexing::Index microCell( uint_c( center + x ), uint_c( center + y ), uint_c( center + z ) );
+            for ( const auto& cType : celldof::allCellTypes )
+            {
+               const auto              verts = celldof::macrocell::getMicroVerticesFromMicroCell( microCell, cType );
+               SurrogateStencilElement element;
+               for ( uint_t k = 0; k < 4; k++ )
+               {
+                  element.vertexOffsets[k] = IndexIncrement(
+                      int_c( verts[k].x() ) - center, int_c( verts[k].y() ) - center, int_c( verts[k].z() ) - center );
+               }
+
+               std::vector< uint_t > localCenterVertices;
+               for ( const auto& centerVertex : centerVertices )
+               {
+                  for ( uint_t k = 0; k < 4; k++ )
+                  {
+                     if ( element.vertexOffsets[k] == centerVertex )
+                     {
+                        localCenterVertices.push_back( k );
+                     }
+                  }
+               }
+
+               if ( localCenterVertices.size() != centerVertices.size() )
+               {
+                  continue;
+               }
+
+               if ( rowType == 0 )
+               {
+                  element.localRow = localCenterVertices[0];
+               }
+               else
+               {
+                  for ( uint_t e = 0; e < 6; e++ )
+                  {
+                     const auto& localEdge = localEdgesFEniCSOrdering[e];
+                     if ( ( localEdge[0] == localCenterVertices[0] && localEdge[1] == localCenterVertices[1] ) ||
+                          ( localEdge[0] == localCenterVertices[1] && localEdge[1] == localCenterVertices[0] ) )
+                     {
+                        element.localRow = 4 + e;
+                     }
+                  }
+               }
+
+               for ( uint_t k = 0; k < 4; k++ )
+               {
+                  element.entryIndices.push_back( entryIndex( false, edgedof::EdgeDoFOrientation::X, element.vertexOffsets[k] ) );
+               }
+
+               if ( srcIsP2 )
+               {
+                  for ( const auto& localEdge : localEdgesFEniCSOrdering )
+                  {
+                     const auto& v0 = element.vertexOffsets[localEdge[0]];
+                     const auto& v1 = element.vertexOffsets[localEdge[1]];
+                     element.entryIndices.push_back(
+                         entryIndex( true, edgedof::calcEdgeDoFOrientation( v0, v1 ), edgedof::calcEdgeDoFIndex( v0, v1 ) ) );
+                  }
+               }
+
+               layout.elements.push_back( element );
+            }
+         }
+      }
+   }
+
+   return layout;
+}
+
+/// Returns the (precomputed) stencil layout of the given row type, see computeSurrogateStencilLayout().
+inline const SurrogateStencilLayout& surrogateStencilLayout( const uint_t rowType, const bool srcIsP2 )
+{
+   static const auto layouts = [] {
+      std::array< std::array< SurrogateStencilLayout, CellPolynomialMemory::NumRowTypes >, 2 > result;
+      for ( uint_t rt = 0; rt < CellPolynomialMemory::NumRowTypes; rt++ )
+      {
+         result[0][rt] = computeSurrogateStencilLayout( rt, false );
+         result[1][rt] = computeSurrogateStencilLayout( rt, true );
+      }
+      return result;
+   }();
+   return layouts[srcIsP2 ? 1 : 0][rowType];
+}
+
+/// Number of stencil entries of each row type, e.g. to allocate the polynomials in the CellPolynomialMemory.
+inline std::array< uint_t, CellPolynomialMemory::NumRowTypes > numSurrogateStencilEntries( const bool srcIsP2 )
+{
+   std::array< uint_t, CellPolynomialMemory::NumRowTypes > result;
+   for ( uint_t rt = 0; rt < CellPolynomialMemory::NumRowTypes; rt++ )
+   {
+      result[rt] = surrogateStencilLayout( rt, srcIsP2 ).entries.size();
+   }
+   return result;
+}
+
+/// Assembles the stencil of a DoF in the interior of a macro-cell from a form that supports blending.
+///
+/// The center of the stencil does not need to be located on the given level. It is specified by its logical
+/// coordinates \p referenceCenter in the reference macro-cell, the surrounding micro-cells have the mesh size of \p level.
+/// The element matrices are computed via integrateAll() from the absolute coordinates of the micro-vertices, so that
+/// the form evaluates the geometry map of the macro-cell (it has to be set via form.setGeometryMap() before).
+/// \p stencil holds the weights in the order of layout.entries.
+template < typename Form_T, typename ElementMatrix_T >
+inline void assembleSurrogateStencil( const Form_T&                 form,
+                                      const Cell&                   cell,
+                                      const Point3D&                referenceCenter,
+                                      const uint_t                  level,
+                                      const SurrogateStencilLayout& layout,
+                                      std::vector< real_t >&        stencil )
+{
+   WALBERLA_ASSERT_EQUAL( stencil.size(), layout.entries.size() );
+
+   const auto&   macroCoords = cell.getCoordinates();
+   const real_t  h           = real_c( 1 ) / real_c( levelinfo::num_microedges_per_edge( level ) );
+   const Point3D d0          = macroCoords[1] - macroCoords[0];
+   const Point3D d1          = macroCoords[2] - macroCoords[0];
+   const Point3D d2          = macroCoords[3] - macroCoords[0];
+   const Point3D center      = macroCoords[0] + d0 * referenceCenter[0] + d1 * referenceCenter[1] + d2 * referenceCenter[2];
+
+   std::fill( stencil.begin(), stencil.end(), real_c( 0 ) );
+
+   std::array< Point3D, 4 > coords;
+   ElementMatrix_T          elMat;
+   for ( const auto& element : layout.elements )
+   {
+      for ( uint_t k = 0; k < 4; k++ )
+      {
+         const auto& offset = element.vertexOffsets[k];
+         coords[k] = center + d0 * ( h * real_c( offset.x() ) ) + d1 * ( h * real_c( offset.y() ) ) +
+                     d2 * ( h * real_c( offset.z() ) );
+      }
+
+      form.integrateAll( coords, elMat );
+
+      for ( uint_t j = 0; j < element.entryIndices.size(); j++ )
+      {
+         stencil[element.entryIndices[j]] += elMat( element.localRow, j );
+      }
+   }
+}
+
+inline bool isInnerDoF( const uint_t level, const uint_t rowType, const indexing::Index& idx )
+{
+   if ( rowType == 0 )
+   {
+      return vertexdof::macrocell::isOnCellFace( idx, level ).empty();
+   }
+   return edgedof::macrocell::isInnerEdgeDoF( level, idx, edgedof::allEdgeDoFOrientations[rowType - 1] );
+}
+
+inline uint_t dataIndex( const uint_t                      level,
+                         const bool                        isEdgeDoF,
+                         const edgedof::EdgeDoFOrientation orientation,
+                         const indexing::Index&            idx )
+{
+   return isEdgeDoF ? edgedof::macrocell::index( level, idx.x(), idx.y(), idx.z(), orientation ) :
+                      vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
+}
+
+/// Applies the polynomial approximation of the stencils to the DoFs in the interior of a macro-cell.
+///
+/// The polynomials of each row type are evaluated in the logical coordinates (x, y, z) * h of the center DoFs,
+/// along each row in x-direction via the forward differences of the Polynomial3DEvaluator.
+/// For a P1 source function (P1 -> P2 operators) \p srcEdgeDoF is a nullptr.
+template < uint_t PolyDegree >
+inline void applyPolynomialTmpl( const PrimitiveDataID< CellPolynomialMemory, Cell >& polynomialId,
+                                 const uint_t                                         level,
+                                 Cell&                                                cell,
+                                 const real_t* const                                  srcVertexDoF,
+                                 const real_t* const                                  srcEdgeDoF,
+                                 real_t* const                                        dstVertexDoF,
+                                 real_t* const                                        dstEdgeDoF,
+                                 const UpdateType                                     update )
+{
+   const bool   srcIsP2     = srcEdgeDoF != nullptr;
+   const auto&  polynomials = cell.getData( polynomialId )->getPolynomials( PolyDegree );
+   const int    N           = int_c( levelinfo::num_microedges_per_edge( level ) );
+   const real_t h           = real_c( 1 ) / real_c( N );
+
+   for ( uint_t rowType = 0; rowType < CellPolynomialMemory::NumRowTypes; rowType++ )
+   {
+      const auto&  layout     = surrogateStencilLayout( rowType, srcIsP2 );
+      const auto&  polys      = polynomials[rowType];
+      const uint_t numEntries = layout.entries.size();
+
+      WALBERLA_ASSERT_EQUAL( polys.size(), numEntries );
+
+      const edgedof::EdgeDoFOrientation centerOrientation =
+          rowType == 0 ? edgedof::EdgeDoFOrientation::X : edgedof::allEdgeDoFOrientations[rowType - 1];
+      real_t* const dst = rowType == 0 ? dstVertexDoF : dstEdgeDoF;
+
+      // largest sum of the logical coordinates of the DoFs of this type
+      const int maxSum = rowType == 0 ? N : ( centerOrientation == edgedof::EdgeDoFOrientation::XYZ ? N - 2 : N - 1 );
+
+#ifdef WALBERLA_BUILD_WITH_OPENMP
+#pragma omp parallel for default( shared )
+#endif
+      for ( int zInt = 0; zInt <= maxSum; ++zInt )
+      {
+         const uint_t z = uint_c( zInt );
+
+         // the evaluators are stateful, every thread needs its own set
+         std::vector< Polynomial3DEvaluator > evaluators;
+         evaluators.reserve( numEntries );
+         for ( const auto& poly : polys )
+         {
+            evaluators.emplace_back( poly );
+         }
+
+         for ( auto& evaluator : evaluators )
+         {
+            evaluator.setZ( real_c( z ) * h );
+         }
+
+         std::vector< real_t > stencil( numEntries );
+         std::vector< uint_t > rowStart( numEntries );
+
+         for ( int yInt = 0; yInt <= maxSum - zInt; ++yInt )
+         {
+            const uint_t y = uint_c( yInt );
+
+            // The inner DoFs of each row are contiguous, all their neighbors are located in the macro-cell.
+            int xStart = 0;
+            while ( xStart <= maxSum - yInt - zInt && !isInnerDoF( level, rowType, indexing::Index( uint_c( xStart ), y, z ) ) )
+            {
+               ++xStart;
+            }
+            if ( xStart > maxSum - yInt - zInt )
+            {
+               continue;
+            }
+            int xEnd = xStart;
+            while ( xEnd + 1 <= maxSum - yInt - zInt &&
+                    isInnerDoF( level, rowType, indexing::Index( uint_c( xEnd + 1 ), y, z ) ) )
+            {
+               ++xEnd;
+            }
+
+            const indexing::Index rowStartIdx( uint_c( xStart ), y, z );
+            for ( uint_t k = 0; k < numEntries; ++k )
+            {
+               const auto& entry = layout.entries[k];
+               rowStart[k]       = dataIndex( level, entry.isEdgeDoF, entry.orientation, rowStartIdx + entry.offset );
+            }
+            const uint_t centerRowStart = dataIndex( level, rowType != 0, centerOrientation, rowStartIdx );
+
+            for ( auto& evaluator : evaluators )
+            {
+               evaluator.setY( real_c( y ) * h );
+               evaluator.setStartX< PolyDegree >( real_c( xStart - 1 ) * h, h );
+            }
+
+            for ( int xInt = xStart; xInt <= xEnd; ++xInt )
+            {
+               const uint_t shift = uint_c( xInt - xStart );
+
+               for ( uint_t k = 0; k < numEntries; ++k )
+               {
+                  stencil[k] = evaluators[k].incrementEval< PolyDegree >();
+               }
+
+               real_t tmp = real_c( 0 );
+               for ( uint_t k = 0; k < numEntries; ++k )
+               {
+                  const real_t* src = layout.entries[k].isEdgeDoF ? srcEdgeDoF : srcVertexDoF;
+                  tmp += stencil[k] * src[rowStart[k] + shift];
+               }
+
+               if ( update == Replace )
+               {
+                  dst[centerRowStart + shift] = tmp;
+               }
+               else
+               {
+                  dst[centerRowStart + shift] += tmp;
+               }
+            }
+         }
+      }
+   }
+}
+
+SPECIALIZE_R_POLYNOMIAL( void, applyPolynomialTmpl, applyPolynomial )
+
+/// Sets the DoFs on the boundary of the macro-cell to zero, those are computed by applyElementwiseOnMacroCellBoundary().
+inline void zeroMacroCellBoundary( const uint_t level, real_t* const dstVertexDoF, real_t* const dstEdgeDoF )
+{
+   for ( const auto& idx : vertexdof::macrocell::Iterator( level ) )
+   {
+      if ( !vertexdof::macrocell::isOnCellFace( idx, level ).empty() )
+      {
+         dstVertexDoF[vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() )] = real_c( 0 );
+      }
+   }
+
+   for ( const auto& idx : edgedof::macrocell::Iterator( level ) )
+   {
+      for ( const auto& orientation : edgedof::allEdgeDoFOrientationsWithoutXYZ )
+      {
+         if ( !edgedof::macrocell::isInnerEdgeDoF( level, idx, orientation ) )
+         {
+            dstEdgeDoF[edgedof::macrocell::index( level, idx.x(), idx.y(), idx.z(), orientation )] = real_c( 0 );
+         }
+      }
+   }
+}
+
+/// Adds the contributions of the micro-cells that touch the boundary of the macro-cell to the DoFs on the boundary.
+/// The inner DoFs are skipped, those are covered by the polynomial stencils.
+///
+/// For a P1 source function (P1 -> P2 operators) \p srcEdgeDoF is a nullptr and the element matrices have four columns.
+template < typename Form_T, typename ElementMatrix_T >
+inline void applyElementwiseOnMacroCellBoundary( const Form_T&       form,
+                                                 const Cell&         cell,
+                                                 const uint_t        level,
+                                                 const real_t* const srcVertexDoF,
+                                                 const real_t* const srcEdgeDoF,
+                                                 real_t* const       dstVertexDoF,
+                                                 real_t* const       dstEdgeDoF )
+{
+   const uint_t numCols = srcEdgeDoF != nullptr ? 10 : 4;
+
+   std::array< Point3D, 4 > coords;
+   std::array< uint_t, 4 >  vertexDoFIndices;
+   std::array< uint_t, 6 >  edgeDoFIndices;
+   std::array< bool, 10 >   onBoundary;
+   std::array< real_t, 10 > srcLocal;
+   ElementMatrix_T          elMat;
+
+   for ( const auto& cType : celldof::allCellTypes )
+   {
+      for ( const auto& micro : celldof::macrocell::Iterator( level, cType ) )
+      {
+         const auto verts = celldof::macrocell::getMicroVerticesFromMicroCell( micro, cType );
+
+         // an edge-DoF on the boundary implies that both of its micro-vertices are located on the boundary
+         bool touchesBoundary = false;
+         for ( uint_t k = 0; k < 4; ++k )
+         {
+            onBoundary[k]   = !vertexdof::macrocell::isOnCellFace( verts[k], level ).empty();
+            touchesBoundary = touchesBoundary || onBoundary[k];
+         }
+
+         if ( !touchesBoundary )
+         {
+            continue;
+         }
+
+         for ( uint_t e = 0; e < 6; ++e )
+         {
+            const auto& v0 = verts[localEdgesFEniCSOrdering[e][0]];
+            const auto& v1 = verts[localEdgesFEniCSOrdering[e][1]];
+
+            const IndexIncrement v0Inc( int_c( v0.x() ), int_c( v0.y() ), int_c( v0.z() ) );
+            const IndexIncrement v1Inc( int_c( v1.x() ), int_c( v1.y() ), int_c( v1.z() ) );
+
+            const auto orientation = edgedof::calcEdgeDoFOrientation( v0Inc, v1Inc );
+            const auto edgeInc     = edgedof::calcEdgeDoFIndex( v0Inc, v1Inc );
+            const indexing::Index edgeIdx( uint_c( edgeInc.x() ), uint_c( edgeInc.y() ), uint_c( edgeInc.z() ) );
+
+            edgeDoFIndices[e] = edgedof::macrocell::index( level, edgeIdx.x(), edgeIdx.y(), edgeIdx.z(), orientation );
+            onBoundary[4 + e] = !edgedof::macrocell::isInnerEdgeDoF( level, edgeIdx, orientation );
+         }
+
+         for ( uint_t k = 0; k < 4; ++k )
+         {
+            coords[k] = vertexdof::macrocell::coordinateFromIndex( level, cell, verts[k] );
+         }
+
+         form.integrateAll( coords, elMat );
+
+         vertexdof::getVertexDoFDataIndicesFromMicroCell( micro, cType, level, vertexDoFIndices );
+
+         for ( uint_t k = 0; k < 4; ++k )
+         {
+            srcLocal[k] = srcVertexDoF[vertexDoFIndices[k]];
+         }
+         for ( uint_t k = 4; k < numCols; ++k )
+         {
+            srcLocal[k] = srcEdgeDoF[edgeDoFIndices[k - 4]];
+         }
+
+         for ( uint_t i = 0; i < 10; ++i )
+         {
+            if ( !onBoundary[i] )
+            {
+               continue;
+            }
+
+            real_t tmp = real_c( 0 );
+            for ( uint_t j = 0; j < numCols; ++j )
+            {
+               tmp += elMat( i, j ) * srcLocal[j];
+            }
+
+            if ( i < 4 )
+            {
+               dstVertexDoF[vertexDoFIndices[i]] += tmp;
+            }
+            else
+            {
+               dstEdgeDoF[edgeDoFIndices[i - 4]] += tmp;
+            }
+         }
+      }
+   }
+}
+
+} // namespace macrocell
+} // namespace variablestencil
+} // namespace P2
+} // namespace hyteg
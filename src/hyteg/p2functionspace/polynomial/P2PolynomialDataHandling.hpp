@@ -37,4 +37,15 @@ class FaceP2PolynomialMemoryDataHandling : public OnlyInitializeDataHandling<P2:
    }
 };
 
+class CellP2PolynomialMemoryDataHandling : public OnlyInitializeDataHandling<P2::CellPolynomialMemory, Cell>
+{
+ public:
+   CellP2PolynomialMemoryDataHandling() {}
+
+   std::shared_ptr<P2::CellPolynomialMemory> initialize(const Cell* const) const
+   {
+      return std::make_shared<P2::CellPolynomialMemory>();
+   }
+};
+
 } // namespace hyteg
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include <hyteg/p1functionspace/VertexDoFMemory.hpp>
 #include <hyteg/p2functionspace/variablestencil/P2VariableStencilCommon.hpp>
 #include <hyteg/p2functionspace/polynomial/P2StencilPolynomial.hpp>
+#include <hyteg/polynomial/Polynomial3D.hpp>
 
 namespace hyteg {
 namespace P2 {
@@ -72,5 +73,50 @@ class FacePolynomialMemory
    std::map<uint_t, FacePolynomials> polynomials_;
 };
 
+/// Polynomials of the stencils of the DoFs in the interior of a macro-cell.
+///
+/// The stencils are distinguished by the type of their center DoF: the vertex-DoFs and the edge-DoFs of each of
+/// the seven orientations. Each stencil entry is approximated by one trivariate polynomial.
+class CellPolynomialMemory
+{
+ public:
+
+   static constexpr uint_t NumRowTypes = 8;
+
+   typedef std::array<std::vector<GeneralPolynomial3D>, NumRowTypes> CellPolynomials;
+
+   CellPolynomialMemory() {}
+
+   inline CellPolynomials& addDegree(uint_t degree, const std::array<uint_t, NumRowTypes>& numStencilEntries)
+   {
+      if (polynomialDegreeExists(degree))
+      {
+         WALBERLA_LOG_WARNING("Degree already exists.");
+      }
+
+      CellPolynomials& poly = polynomials_[degree];
+      for (uint_t rowType = 0; rowType < NumRowTypes; ++rowType)
+      {
+         poly[rowType] = std::vector<GeneralPolynomial3D>(numStencilEntries[rowType], GeneralPolynomial3D(degree));
+      }
+
+      return poly;
+   }
+
+   inline bool polynomialDegreeExists(uint_t degree) const
+   {
+      return polynomials_.count(degree) > 0;
+   }
+
+   inline const CellPolynomials& getPolynomials(uint_t degree) const
+   {
+      return polynomials_.at(degree);
+   }
+
+ private:
+
+   std::map<uint_t, CellPolynomials> polynomials_;
+};
+
 } // namespace P2
 } // namespace hyteg
\ No newline at end of file
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "hyteg/solvers/Solver.hpp"
 
@@ -28,12 +29,6 @@
 
 #ifdef HYTEG_BUILD_WITH_PETSC
 
-#if ( PETSC_VERSION_MAJOR > 3 ) || ( PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 9 )
-#define HYTEG_PCFactorSetMatSolverType PCFactorSetMatSolverType
-#else
-#define HYTEG_PCFactorSetMatSolverType PCFactorSetMatSolverPackage
-#endif
-
 namespace hyteg {
 
 enum class PETScDirectSolverType
@@ -42,6 +37,19 @@ enum class PETScDirectSolverType
    SUPER_LU
 };
 
+/// \brief Direct solver via PETSc (MUMPS or SuperLU_DIST).
+///
+/// The operator is assembled once and factorized on the first call to solve() / assembleAndFactorize().
+/// If reassembleMatrix( true ) is set, each call assembles the operator exactly once and refactorizes the matrix.
+/// As long as the sparsity pattern does not change (e.g. for a time-dependent coefficient), only the numeric
+/// factorization is recomputed and the symbolic factorization (ordering and analysis) is reused.
+///
+/// The times for the matrix assembly, the symbolic and the numeric factorization are reported separately in the
+/// timing tree of the PrimitiveStorage.
+///
+/// As with a PCLU / PCCHOLESKY preconditioner, the PETSc options database is respected: -pc_factor_mat_solver_type
+/// overrides the solver package passed to setDirectSolverType(), and the factored matrix is configured with
+/// MatSetFromOptions() (e.g. -mat_mumps_icntl_14 or -mat_superlu_dist_rowperm).
 template < class OperatorType >
 class PETScLUSolver : public Solver< OperatorType >
 {
@@ -76,14 +84,20 @@ class PETScLUSolver : public Solver< OperatorType >
    , reassembleMatrix_( false )
    , assumeSymmetry_( true )
    , solverType_( PETScDirectSolverType::MUMPS )
+   , F( nullptr )
+   , factorized_( false )
+   , nonzeroState_( 0 )
    {
       num.enumerate( level );
-      KSPCreate( petscCommunicator_, &ksp );
-      KSPSetType( ksp, KSPPREONLY );
-      KSPSetFromOptions( ksp );
    }
 
-   ~PETScLUSolver() { KSPDestroy( &ksp ); }
+   ~PETScLUSolver()
+   {
+      if ( F != nullptr )
+      {
+         MatDestroy( &F );
+      }
+   }
 
 #if 0
   void setNullSpace( FunctionType & inKernel, const uint_t & level )
@@ -118,7 +132,8 @@ class PETScLUSolver : public Solver< OperatorType >
       manualAssemblyAndFactorization_ = manualAssemblyAndFactorization;
    }
 
-   /// \brief If set to true, the operator is reassembled for every solve / manual assembly call.
+   /// \brief If set to true, the operator is reassembled and refactorized for every solve / manual assembly call.
+   ///        The symbolic factorization is reused if the sparsity pattern of the matrix did not change.
    ///        Default is false.
    void reassembleMatrix( bool reassembleMatrix ) { reassembleMatrix_ = reassembleMatrix; }
 
@@ -127,89 +142,55 @@ class PETScLUSolver : public Solver< OperatorType >
 
    void assembleAndFactorize( const OperatorType& A )
    {
-      storage_->getTimingTree()->start( "Matrix assembly" );
+      if ( factorized_ && !reassembleMatrix_ )
+      {
+         return;
+      }
 
-      bool matrixAssembledForTheFirstTime;
-      if ( reassembleMatrix_ )
+      // the matrix is assembled exactly once, the system matrices are copies with the same sparsity pattern
+      storage_->getTimingTree()->start( "Matrix assembly" );
+      if ( factorized_ )
       {
          AmatUnsymmetric.zeroEntries();
-         AmatUnsymmetric.createMatrixFromOperator( A, allocatedLevel_, num, All );
-         matrixAssembledForTheFirstTime = true;
+      }
+      AmatUnsymmetric.createMatrixFromOperator( A, allocatedLevel_, num, All );
+      storage_->getTimingTree()->stop( "Matrix assembly" );
+
+      storage_->getTimingTree()->start( "Dirichlet boundary conditions" );
+      Amat.copyFrom( AmatUnsymmetric );
+      if ( assumeSymmetry_ )
+      {
+         Amat.applyDirichletBCSymmetrically( num, allocatedLevel_ );
       }
       else
       {
-         matrixAssembledForTheFirstTime = AmatUnsymmetric.createMatrixFromOperatorOnce( A, allocatedLevel_, num, All );
+         Amat.applyDirichletBC( num, allocatedLevel_ );
       }
+      storage_->getTimingTree()->stop( "Dirichlet boundary conditions" );
 
-      storage_->getTimingTree()->stop( "Matrix assembly" );
+      PetscObjectState nonzeroState;
+      MatGetNonzeroState( Amat.get(), &nonzeroState );
 
-      if ( matrixAssembledForTheFirstTime )
+      if ( !factorized_ || nonzeroState != nonzeroState_ )
       {
-         Amat.zeroEntries();
-         Amat.createMatrixFromOperator( A, allocatedLevel_, num, All );
-         AmatTmp.zeroEntries();
-         AmatTmp.createMatrixFromOperator( A, allocatedLevel_, num, All );
-
-         MatCopy( AmatUnsymmetric.get(), Amat.get(), DIFFERENT_NONZERO_PATTERN );
-
-         if ( assumeSymmetry_ )
-         {
-            Amat.applyDirichletBCSymmetrically( num, allocatedLevel_ );
-         }
-         else
-         {
-            Amat.applyDirichletBC( num, allocatedLevel_ );
-         }
-
-         KSPSetOperators( ksp, Amat.get(), Amat.get() );
-         KSPGetPC( ksp, &pc );
-
-         if ( assumeSymmetry_ )
-         {
-            PCSetType( pc, PCCHOLESKY );
-         }
-         else
-         {
-            PCSetType( pc, PCLU );
-         }
-
-         MatSolverType petscSolverType;
-         switch ( solverType_ )
-         {
-         case PETScDirectSolverType::MUMPS:
-#ifdef PETSC_HAVE_MUMPS
-            petscSolverType = MATSOLVERMUMPS;
-            break;
-#else
-            WALBERLA_ABORT( "PETSc is not build with MUMPS support." )
-#endif
-         case PETScDirectSolverType::SUPER_LU:
-            petscSolverType = MATSOLVERSUPERLU_DIST;
-            break;
-         default:
-            WALBERLA_ABORT( "Invalid PETSc solver type." )
-         }
-         HYTEG_PCFactorSetMatSolverType( pc, petscSolverType );
+         storage_->getTimingTree()->start( "Symbolic factorization" );
+         factorizeSymbolic();
+         storage_->getTimingTree()->stop( "Symbolic factorization" );
+         nonzeroState_ = nonzeroState;
+      }
 
-         if ( solverType_ == PETScDirectSolverType::MUMPS )
-         {
-            PCFactorSetUpMatSolverType( pc );
-            PCFactorGetMatrix( pc, &F );
-#ifdef PETSC_HAVE_MUMPS
-            for ( auto it : mumpsIcntrl_ )
-            {
-               MatMumpsSetIcntl( F, it.first, it.second );
-            }
-            for ( auto it : mumpsCntrl_ )
-            {
-               MatMumpsSetCntl( F, it.first, it.second );
-            }
-#endif
-         }
-         storage_->getTimingTree()->start( "Factorization" );
-         PCSetUp( pc );
-         storage_->getTimingTree()->stop( "Factorization" );
+      storage_->getTimingTree()->start( "Numeric factorization" );
+      if ( assumeSymmetry_ )
+      {
+         MatCholeskyFactorNumeric( F, Amat.get(), &factorInfo_ );
+      }
+      else
+      {
+         MatLUFactorNumeric( F, Amat.get(), &factorInfo_ );
       }
+      storage_->getTimingTree()->stop( "Numeric factorization" );
+
+      factorized_ = true;
    }
 
    void solve( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level )
@@ -229,6 +210,8 @@ class PETScLUSolver : public Solver< OperatorType >
       timer.end();
       const double matrixAssemblyAndFactorizationTime = timer.last();
 
+      WALBERLA_CHECK( factorized_, "[PETScLUSolver] assembleAndFactorize() must be called before the first solve." );
+
       storage_->getTimingTree()->start( "RHS vector setup" );
 
       b.assign( { 1.0 }, { x }, level, DirichletBoundary );
@@ -236,20 +219,30 @@ class PETScLUSolver : public Solver< OperatorType >
 
       if ( assumeSymmetry_ )
       {
-         AmatTmp.zeroEntries();
-         MatCopy( AmatUnsymmetric.get(), AmatTmp.get(), DIFFERENT_NONZERO_PATTERN );
+         AmatTmp.copyFrom( AmatUnsymmetric );
          AmatTmp.applyDirichletBCSymmetrically( x, num, bVec, allocatedLevel_ );
       }
 
+      MatNullSpace nullSpace;
+      MatGetNullSpace( Amat.get(), &nullSpace );
+      if ( nullSpace )
+      {
+         MatNullSpaceRemove( nullSpace, bVec.get() );
+      }
+
       storage_->getTimingTree()->stop( "RHS vector setup" );
 
       storage_->getTimingTree()->stop( "Setup" );
 
       storage_->getTimingTree()->start( "Solver" );
       timer.start();
-      KSPSolve( ksp, bVec.get(), xVec.get() );
+      MatSolve( F, bVec.get(), xVec.get() );
+      if ( nullSpace )
+      {
+         MatNullSpaceRemove( nullSpace, xVec.get() );
+      }
       timer.end();
-      const double petscKSPTimer = timer.last();
+      const double petscSolveTimer = timer.last();
       storage_->getTimingTree()->stop( "Solver" );
 
       xVec.createFunctionFromVector( x, num, level, flag_ );
@@ -257,7 +250,7 @@ class PETScLUSolver : public Solver< OperatorType >
       if ( verbose_ )
       {
          WALBERLA_LOG_INFO_ON_ROOT( "[PETScLUSolver] "
-                                    << "PETSc KSPSolver time: " << petscKSPTimer
+                                    << "PETSc solve time: " << petscSolveTimer
                                     << ", assembly and fact time: " << matrixAssemblyAndFactorizationTime );
       }
 
@@ -265,6 +258,75 @@ class PETScLUSolver : public Solver< OperatorType >
    }
 
  private:
+   /// Creates the factored matrix and computes the symbolic factorization of Amat.
+   void factorizeSymbolic()
+   {
+      if ( F != nullptr )
+      {
+         MatDestroy( &F );
+      }
+
+      // the solver package selected in the options database takes precedence (as for PCFactorSetMatSolverType())
+      char      optionsSolverType[256];
+      PetscBool optionsSolverTypeSet = PETSC_FALSE;
+      PetscOptionsGetString(
+          NULL, NULL, "-pc_factor_mat_solver_type", optionsSolverType, sizeof( optionsSolverType ), &optionsSolverTypeSet );
+
+      MatSolverType petscSolverType;
+      if ( optionsSolverTypeSet )
+      {
+         petscSolverType = optionsSolverType;
+      }
+      else
+      {
+         switch ( solverType_ )
+         {
+         case PETScDirectSolverType::MUMPS:
+#ifdef PETSC_HAVE_MUMPS
+            petscSolverType = MATSOLVERMUMPS;
+            break;
+#else
+            WALBERLA_ABORT( "PETSc is not build with MUMPS support." )
+#endif
+         case PETScDirectSolverType::SUPER_LU:
+            WALBERLA_CHECK( !assumeSymmetry_, "SuperLU_DIST does not support Cholesky factorization." );
+            petscSolverType = MATSOLVERSUPERLU_DIST;
+            break;
+         default:
+            WALBERLA_ABORT( "Invalid PETSc solver type." )
+         }
+      }
+
+      MatGetFactor( Amat.get(), petscSolverType, assumeSymmetry_ ? MAT_FACTOR_CHOLESKY : MAT_FACTOR_LU, &F );
+      WALBERLA_CHECK_NOT_NULLPTR( F, "[PETScLUSolver] Solver package " << petscSolverType << " is not available." );
+      MatSetFromOptions( F );
+
+#ifdef PETSC_HAVE_MUMPS
+      if ( std::string( petscSolverType ) == MATSOLVERMUMPS )
+      {
+         for ( auto it : mumpsIcntrl_ )
+         {
+            MatMumpsSetIcntl( F, it.first, it.second );
+         }
+         for ( auto it : mumpsCntrl_ )
+         {
+            MatMumpsSetCntl( F, it.first, it.second );
+         }
+      }
+#endif
+
+      // MUMPS and SuperLU_DIST compute their own orderings
+      MatFactorInfoInitialize( &factorInfo_ );
+      if ( assumeSymmetry_ )
+      {
+         MatCholeskyFactorSymbolic( F, Amat.get(), NULL, &factorInfo_ );
+      }
+      else
+      {
+         MatLUFactorSymbolic( F, Amat.get(), NULL, NULL, &factorInfo_ );
+      }
+   }
+
    std::shared_ptr< PrimitiveStorage >                                                           storage_;
    uint_t                                                                                        allocatedLevel_;
    MPI_Comm                                                                                      petscCommunicator_;
@@ -278,17 +340,19 @@ class PETScLUSolver : public Solver< OperatorType >
   PETScVector<typename FunctionType::valueType, OperatorType::srcType::template FunctionType> inKernel;
 #endif
 
-   KSP                        ksp;
-   PC                         pc;
    hyteg::DoFType             flag_;
    bool                       verbose_;
-   Mat                        F; //factored Matrix
    bool                       manualAssemblyAndFactorization_;
    bool                       reassembleMatrix_;
    bool                       assumeSymmetry_;
    PETScDirectSolverType      solverType_;
    std::map< uint_t, int >    mumpsIcntrl_;
    std::map< uint_t, real_t > mumpsCntrl_;
+   Mat                        F; //factored Matrix
+   MatFactorInfo              factorInfo_;
+   bool                       factorized_;
+   /// nonzero state of Amat during the last symbolic factorization
+   PetscObjectState           nonzeroState_;
 };
 
 } // namespace hyteg
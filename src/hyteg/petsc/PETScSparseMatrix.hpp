@@ -178,6 +178,49 @@ class PETScSparseMatrix
       return bcIndices;
    }
 
+   /// \brief Copies the entries of the passed (assembled) matrix.
+   ///
+   /// On the first call, this matrix is replaced by a duplicate of the passed matrix. Therefore, it does not have to be
+   /// assembled from the operator and both matrices share the same nonzero pattern. The name and the null space of
+   /// this matrix are kept.
+   /// Later calls only copy the values. As long as the nonzero pattern of the passed matrix does not change, the
+   /// nonzero pattern of this matrix is not modified either (so that e.g. a symbolic factorization can be reused).
+   /// The nonzero pattern is also kept when Dirichlet boundary conditions are applied to this matrix.
+   void copyFrom( const PETScSparseMatrix& other )
+   {
+      if ( !assembled_ )
+      {
+         const char* name;
+         PetscObjectGetName( (PetscObject) mat, &name );
+         const std::string matName( name );
+
+         MatNullSpace nullSpace;
+         MatGetNullSpace( mat, &nullSpace );
+         if ( nullSpace )
+         {
+            PetscObjectReference( (PetscObject) nullSpace );
+         }
+
+         MatDestroy( &mat );
+         MatDuplicate( other.mat, MAT_COPY_VALUES, &mat );
+         MatSetOption( mat, MAT_KEEP_NONZERO_PATTERN, PETSC_TRUE );
+         setName( matName.c_str() );
+
+         if ( nullSpace )
+         {
+            MatSetNullSpace( mat, nullSpace );
+            MatNullSpaceDestroy( &nullSpace );
+         }
+
+         assembled_ = true;
+      }
+      else
+      {
+         // the pattern of the other matrix is a subset of the pattern of this matrix (Dirichlet BCs may add diagonal entries)
+         MatCopy( other.mat, mat, SUBSET_NONZERO_PATTERN );
+      }
+   }
+
    inline void reset() { assembled_ = false; }
 
    /// \brief Sets all entries of the matrix to zero.
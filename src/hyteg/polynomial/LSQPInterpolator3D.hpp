@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "hyteg/eigen/EigenWrapper.hpp"
+
+#ifdef HYTEG_BUILD_WITH_EIGEN
+
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/Math.hpp"
+
+#include "Polynomial3D.hpp"
+
+namespace hyteg {
+
+/// Number of micro-vertices in the interior of a macro-cell, one interpolation point is located on each of them.
+inline uint_t GetNumInterpolationPoints3D(uint_t level)
+{
+  const uint_t innerWidth = levelinfo::num_microvertices_per_edge(level) - 2;
+  return innerWidth < 3 ? 0 : math::binomialCoefficient(innerWidth, 3);
+}
+
+/// Least squares fit of trivariate polynomials to values sampled on the inner micro-vertices of a macro-cell.
+///
+/// In contrast to the 2D LSQPInterpolator, several values can be sampled per interpolation point (e.g. all entries of a stencil).
+/// Since all of them share the same interpolation points, the QR decomposition of the Vandermonde matrix is only computed once.
+template<typename Basis>
+class LSQPInterpolator3D {
+public:
+
+  LSQPInterpolator3D(uint_t degree, uint_t interpolationLevel, uint_t numValues)
+      : degree_(degree),
+        numCoefficients_(Polynomial3D<Basis>::getNumCoefficients(degree)),
+        interpolationLevel_(interpolationLevel),
+        numInterpolationPoints_(GetNumInterpolationPoints3D(interpolationLevel)),
+        numValues_(numValues),
+        offset_(0),
+        A(numInterpolationPoints_, Polynomial3D<Basis>::getNumCoefficients(degree)),
+        rhs(numInterpolationPoints_, numValues) {
+  }
+
+  void addInterpolationPoint(const Point3D& x, const std::vector<real_t>& values) {
+    WALBERLA_ASSERT(offset_ < numInterpolationPoints_, "Added too many interpolation points");
+    WALBERLA_ASSERT_EQUAL(values.size(), numValues_);
+
+    for (uint_t k = 0; k < numCoefficients_; ++k) {
+      A(offset_, k) = Basis::eval(k, x);
+    }
+
+    for (uint_t v = 0; v < numValues_; ++v) {
+      rhs(offset_, v) = values[v];
+    }
+
+    ++offset_;
+  }
+
+  /// Computes one polynomial per sampled value, \p polys[v] is fitted to the v-th value of each interpolation point.
+  void interpolate(std::vector<Polynomial3D<Basis>>& polys) {
+    WALBERLA_ASSERT(offset_ == numInterpolationPoints_, "Not enough interpolation points were added");
+    WALBERLA_ASSERT_EQUAL(polys.size(), numValues_);
+
+    if (numInterpolationPoints_ < numCoefficients_) {
+      WALBERLA_LOG_WARNING("Polynomial interpolation may have poor quality since there are less interpolation points "
+                           "than coefficients. Please try to increase the interpolation level to fix this.");
+    }
+
+    Eigen::Matrix<real_t, Eigen::Dynamic, Eigen::Dynamic> coeffs;
+    coeffs = A.colPivHouseholderQr().solve(rhs);
+
+    for (uint_t v = 0; v < numValues_; ++v) {
+      WALBERLA_ASSERT_EQUAL(polys[v].getDegree(), degree_);
+      for (uint_t i = 0; i < numCoefficients_; ++i) {
+        polys[v].setCoefficient(i, coeffs(i, v));
+      }
+    }
+  }
+
+private:
+  uint_t degree_;
+  uint_t numCoefficients_;
+  uint_t interpolationLevel_;
+  uint_t numInterpolationPoints_;
+  uint_t numValues_;
+  uint_t offset_;
+  Eigen::Matrix<real_t, Eigen::Dynamic, Eigen::Dynamic> A;
+  Eigen::Matrix<real_t, Eigen::Dynamic, Eigen::Dynamic> rhs;
+};
+
+}
+
+#endif
@@ -0,0 +1,947 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+// This file was generated by the monomial_basis_3d.py Python script
+// Do not edit it by hand
+
+namespace hyteg {
+
+class MonomialBasis3D {
+public:
+  static real_t eval(uint_t basis, const Point3D &x) {
+    switch(basis) {
+      case 0:
+        return 1;
+      case 1:
+        return x[0];
+      case 2:
+        return x[1];
+      case 3:
+        return x[2];
+      case 4:
+        return x[0]*x[0];
+      case 5:
+        return x[0]*x[1];
+      case 6:
+        return x[1]*x[1];
+      case 7:
+        return x[0]*x[2];
+      case 8:
+        return x[1]*x[2];
+      case 9:
+        return x[2]*x[2];
+      case 10:
+        return x[0]*x[0]*x[0];
+      case 11:
+        return (x[0]*x[0])*x[1];
+      case 12:
+        return x[0]*(x[1]*x[1]);
+      case 13:
+        return x[1]*x[1]*x[1];
+      case 14:
+        return (x[0]*x[0])*x[2];
+      case 15:
+        return x[0]*x[1]*x[2];
+      case 16:
+        return (x[1]*x[1])*x[2];
+      case 17:
+        return x[0]*(x[2]*x[2]);
+      case 18:
+        return x[1]*(x[2]*x[2]);
+      case 19:
+        return x[2]*x[2]*x[2];
+      case 20:
+        return x[0]*x[0]*x[0]*x[0];
+      case 21:
+        return (x[0]*x[0]*x[0])*x[1];
+      case 22:
+        return (x[0]*x[0])*(x[1]*x[1]);
+      case 23:
+        return x[0]*(x[1]*x[1]*x[1]);
+      case 24:
+        return x[1]*x[1]*x[1]*x[1];
+      case 25:
+        return (x[0]*x[0]*x[0])*x[2];
+      case 26:
+        return (x[0]*x[0])*x[1]*x[2];
+      case 27:
+        return x[0]*(x[1]*x[1])*x[2];
+      case 28:
+        return (x[1]*x[1]*x[1])*x[2];
+      case 29:
+        return (x[0]*x[0])*(x[2]*x[2]);
+      case 30:
+        return x[0]*x[1]*(x[2]*x[2]);
+      case 31:
+        return (x[1]*x[1])*(x[2]*x[2]);
+      case 32:
+        return x[0]*(x[2]*x[2]*x[2]);
+      case 33:
+        return x[1]*(x[2]*x[2]*x[2]);
+      case 34:
+        return x[2]*x[2]*x[2]*x[2];
+      case 35:
+        return x[0]*x[0]*x[0]*x[0]*x[0];
+      case 36:
+        return (x[0]*x[0]*x[0]*x[0])*x[1];
+      case 37:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 38:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 39:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]);
+      case 40:
+        return x[1]*x[1]*x[1]*x[1]*x[1];
+      case 41:
+        return (x[0]*x[0]*x[0]*x[0])*x[2];
+      case 42:
+        return (x[0]*x[0]*x[0])*x[1]*x[2];
+      case 43:
+        return (x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 44:
+        return x[0]*(x[1]*x[1]*x[1])*x[2];
+      case 45:
+        return (x[1]*x[1]*x[1]*x[1])*x[2];
+      case 46:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 47:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 48:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]);
+      case 49:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 50:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 51:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]);
+      case 52:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 53:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]);
+      case 54:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 55:
+        return x[2]*x[2]*x[2]*x[2]*x[2];
+      case 56:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 57:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 58:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 59:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 60:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 61:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 62:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 63:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 64:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 65:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 66:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 67:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 68:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 69:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 70:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 71:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 72:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 73:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 74:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 75:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 76:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 77:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 78:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 79:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 80:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 81:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 82:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 83:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      case 84:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 85:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 86:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 87:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 88:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 89:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 90:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 91:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 92:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 93:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 94:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 95:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 96:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 97:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 98:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 99:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 100:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 101:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 102:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 103:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 104:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 105:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 106:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 107:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 108:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 109:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 110:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 111:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 112:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 113:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 114:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 115:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 116:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 117:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 118:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 119:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      case 120:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 121:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 122:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 123:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 124:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 125:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 126:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 127:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 128:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 129:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 130:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 131:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 132:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 133:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 134:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 135:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 136:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 137:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 138:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 139:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 140:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 141:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 142:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 143:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 144:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 145:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 146:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 147:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 148:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 149:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 150:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 151:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 152:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 153:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 154:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 155:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 156:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 157:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 158:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 159:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 160:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 161:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 162:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 163:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 164:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      case 165:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 166:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 167:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 168:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 169:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 170:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 171:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 172:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 173:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 174:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 175:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 176:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 177:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 178:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 179:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 180:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 181:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 182:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 183:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 184:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 185:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 186:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 187:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 188:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 189:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 190:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 191:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 192:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 193:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 194:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 195:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 196:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 197:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 198:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 199:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 200:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 201:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 202:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 203:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 204:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 205:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 206:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 207:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 208:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 209:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 210:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 211:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 212:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 213:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 214:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 215:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 216:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 217:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 218:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 219:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      case 220:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 221:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 222:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 223:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 224:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 225:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 226:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 227:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 228:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 229:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 230:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 231:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 232:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 233:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 234:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 235:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 236:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 237:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 238:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 239:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 240:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 241:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 242:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 243:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 244:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 245:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 246:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 247:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 248:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 249:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 250:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 251:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 252:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 253:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 254:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 255:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 256:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 257:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 258:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 259:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 260:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 261:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 262:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 263:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 264:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 265:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 266:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 267:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 268:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 269:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 270:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 271:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 272:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 273:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 274:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 275:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 276:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 277:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 278:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 279:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 280:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 281:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 282:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 283:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 284:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 285:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      case 286:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 287:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 288:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 289:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 290:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 291:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 292:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 293:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 294:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 295:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 296:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 297:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 298:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 299:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 300:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 301:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 302:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 303:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 304:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 305:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 306:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 307:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 308:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 309:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 310:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 311:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 312:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 313:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 314:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 315:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 316:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 317:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 318:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 319:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 320:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 321:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 322:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 323:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 324:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 325:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 326:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 327:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 328:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 329:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 330:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 331:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 332:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 333:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 334:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 335:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 336:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 337:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 338:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 339:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 340:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 341:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 342:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 343:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 344:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 345:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 346:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 347:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 348:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 349:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 350:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 351:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 352:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 353:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 354:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 355:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 356:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 357:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 358:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 359:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 360:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 361:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 362:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 363:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      case 364:
+        return x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0];
+      case 365:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1];
+      case 366:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]);
+      case 367:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]);
+      case 368:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]);
+      case 369:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 370:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 371:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 372:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 373:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 374:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 375:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]);
+      case 376:
+        return x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1];
+      case 377:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[2];
+      case 378:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*x[2];
+      case 379:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*x[2];
+      case 380:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*x[2];
+      case 381:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*x[2];
+      case 382:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 383:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 384:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 385:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 386:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 387:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 388:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*x[2];
+      case 389:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]);
+      case 390:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]);
+      case 391:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]);
+      case 392:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 393:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 394:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 395:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 396:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 397:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 398:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 399:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]);
+      case 400:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]);
+      case 401:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]);
+      case 402:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 403:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 404:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 405:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 406:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 407:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 408:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 409:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]);
+      case 410:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]);
+      case 411:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]);
+      case 412:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 413:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 414:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 415:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 416:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 417:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 418:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]);
+      case 419:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 420:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 421:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 422:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 423:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 424:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 425:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 426:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 427:
+        return (x[0]*x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 428:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 429:
+        return (x[0]*x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 430:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 431:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 432:
+        return x[0]*(x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 433:
+        return (x[1]*x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 434:
+        return (x[0]*x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 435:
+        return (x[0]*x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 436:
+        return (x[0]*x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 437:
+        return (x[0]*x[0])*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 438:
+        return x[0]*(x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 439:
+        return (x[1]*x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 440:
+        return (x[0]*x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 441:
+        return (x[0]*x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 442:
+        return (x[0]*x[0])*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 443:
+        return x[0]*(x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 444:
+        return (x[1]*x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 445:
+        return (x[0]*x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 446:
+        return (x[0]*x[0])*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 447:
+        return x[0]*(x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 448:
+        return (x[1]*x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 449:
+        return (x[0]*x[0])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 450:
+        return x[0]*x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 451:
+        return (x[1]*x[1])*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 452:
+        return x[0]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 453:
+        return x[1]*(x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]);
+      case 454:
+        return x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2]*x[2];
+      default:
+      WALBERLA_ABORT("Polynomial basis " << basis << " was not generated");
+    }
+  }
+};
+
+}
@@ -19,8 +19,11 @@
  */
 #pragma once
 
+#include <memory>
+
 #include "Polynomial1D.hpp"
 #include "Polynomial2D.hpp"
+#include "Polynomial3D.hpp"
 
 namespace hyteg {
 
@@ -245,4 +248,77 @@ private:
 
 };
 
+/// Evaluates a trivariate polynomial along lines in x-direction.
+///
+/// setZ() and setY() restrict the polynomial to a line, which is then traversed with
+/// the forward differences of the Polynomial2DEvaluator.
+class Polynomial3DEvaluator {
+public:
+
+  typedef Polynomial2D<MonomialBasis2D> Polynomial2;
+  typedef Polynomial3D<MonomialBasis3D> Polynomial3;
+
+  Polynomial3DEvaluator(const Polynomial3& poly)
+    : degree_(poly.getDegree()),
+      poly3_(poly),
+      poly2_(std::make_unique<Polynomial2>(poly.getDegree())),
+      evaluator2_(*poly2_)
+  {
+  }
+
+  real_t eval(const Point3D &x) const {
+    return poly3_.eval(x);
+  }
+
+  void setZ(real_t z) {
+    for (uint_t degree = 0; degree <= degree_; ++degree) {
+      for (uint_t yPower = 0; yPower <= degree; ++yPower) {
+        const uint_t xPower = degree - yPower;
+
+        real_t value = 0.0;
+        real_t z_ = walberla::real_c(1.0);
+
+        for (uint_t zPower = 0; zPower <= degree_ - degree; ++zPower) {
+          value += poly3_.getCoefficient(index(xPower, yPower, zPower)) * z_;
+          z_ *= z;
+        }
+
+        poly2_->setCoefficient((degree * (degree + 1)) / 2 + yPower, value);
+      }
+    }
+  }
+
+  void setY(real_t y) {
+    evaluator2_.setY(y);
+  }
+
+  real_t evalX(real_t x) const {
+    return evaluator2_.evalX(x);
+  }
+
+  template<uint_t Degree>
+  real_t setStartX(real_t x, real_t h) {
+    return evaluator2_.setStartX<Degree>(x, h);
+  }
+
+  template<uint_t Degree>
+  real_t incrementEval() {
+    return evaluator2_.incrementEval<Degree>();
+  }
+
+private:
+  /// index of the monomial x^xPower y^yPower z^zPower in MonomialBasis3D
+  static uint_t index(uint_t xPower, uint_t yPower, uint_t zPower) {
+    const uint_t degree = xPower + yPower + zPower;
+    return (degree * (degree + 1) * (degree + 2)) / 6 + zPower * (degree + 1) - (zPower * (zPower - 1)) / 2 + yPower;
+  }
+
+  uint_t degree_;
+  const Polynomial3& poly3_;
+  // on the heap so that the reference held by evaluator2_ stays valid if the evaluator is moved
+  std::unique_ptr<Polynomial2> poly2_;
+  Polynomial2DEvaluator evaluator2_;
+
+};
+
 }
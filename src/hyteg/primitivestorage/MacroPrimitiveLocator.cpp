@@ -0,0 +1,678 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/primitivestorage/MacroPrimitiveLocator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+#include "core/debug/CheckFunctions.h"
+#include "core/mpi/BufferSystem.h"
+#include "core/mpi/Gatherv.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/geometry/GeometryMap.hpp"
+#include "hyteg/geometry/Intersection.hpp"
+#include "hyteg/primitives/Cell.hpp"
+#include "hyteg/primitives/Face.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+
+namespace hyteg {
+
+using walberla::int_c;
+using walberla::real_c;
+using walberla::uint_c;
+
+/// Number of samples per edge of curved (non-affinely mapped) primitives for the bounding boxes.
+static constexpr uint_t numBoundingBoxSamplesPerEdge = 8;
+
+MacroPrimitiveLocator::MacroPrimitiveLocator( const PrimitiveStorage& storage )
+: is3D_( storage.hasGlobalCells() )
+, dim_( storage.hasGlobalCells() ? 3 : 2 )
+{
+   // the storage maps are ordered by ID, so the candidates of a point are tested in the same order as in a linear scan
+   if ( is3D_ )
+   {
+      for ( const auto& it : storage.getCells() )
+      {
+         const Cell& cell = *it.second;
+         primitiveIDs_.push_back( it.first );
+         vertices_.push_back( cell.getCoordinates() );
+         inwardNormals_.push_back( std::array< Point3D, 4 >{{cell.getFaceInwardNormal( 0 ),
+                                                              cell.getFaceInwardNormal( 1 ),
+                                                              cell.getFaceInwardNormal( 2 ),
+                                                              cell.getFaceInwardNormal( 3 )}} );
+         geometryMaps_.push_back( cell.getGeometryMap() );
+      }
+   }
+   else
+   {
+      for ( const auto& it : storage.getFaces() )
+      {
+         const Face& face = *it.second;
+         primitiveIDs_.push_back( it.first );
+         vertices_.push_back(
+             std::array< Point3D, 4 >{{face.getCoordinates()[0], face.getCoordinates()[1], face.getCoordinates()[2], Point3D()}} );
+         inwardNormals_.push_back( std::array< Point3D, 4 >() );
+         geometryMaps_.push_back( face.getGeometryMap() );
+      }
+   }
+
+   for ( uint_t primitive = 0; primitive < primitiveIDs_.size(); primitive++ )
+   {
+      computeMapping( primitive );
+      boundingBoxes_.push_back( computeBoundingBox( primitive ) );
+   }
+
+   primitiveGrid_.build( boundingBoxes_, dim_ );
+}
+
+void MacroPrimitiveLocator::computeMapping( const uint_t& primitive )
+{
+   const auto&              v   = vertices_[primitive];
+   const auto&              map = geometryMaps_[primitive];
+   std::array< Point3D, 4 > mappedVertices;
+   for ( uint_t i = 0; i <= dim_; i++ )
+   {
+      map->evalF( v[i], mappedVertices[i] );
+   }
+   mappedVertices_.push_back( mappedVertices );
+
+   if ( !map->isAffine() )
+   {
+      mappings_.push_back( Mapping::NON_AFFINE );
+      return;
+   }
+
+   // an affine map that does not move the vertices is the identity on the primitive
+   bool identity = true;
+   for ( uint_t i = 0; i <= dim_; i++ )
+   {
+      for ( uint_t k = 0; k < dim_; k++ )
+      {
+         identity = identity && mappedVertices[i][k] == v[i][k];
+      }
+   }
+   mappings_.push_back( identity ? Mapping::IDENTITY : Mapping::AFFINE );
+}
+
+std::pair< Point3D, Point3D > MacroPrimitiveLocator::computeBoundingBox( const uint_t& primitive ) const
+{
+   const auto& v = vertices_[primitive];
+
+   // the image of a simplex under an affine map is the simplex that is spanned by the mapped vertices,
+   // curved primitives are sampled on a regular lattice and padded by the spacing of the lattice
+   std::vector< Point3D > mappedSamples;
+   if ( mappings_[primitive] == Mapping::NON_AFFINE )
+   {
+      const uint_t           n = numBoundingBoxSamplesPerEdge;
+      std::vector< Point3D > samples;
+      for ( uint_t k = 0; k <= ( is3D_ ? n : 0 ); k++ )
+      {
+         for ( uint_t j = 0; j <= n - k; j++ )
+         {
+            for ( uint_t i = 0; i <= n - k - j; i++ )
+            {
+               Point3D x = v[0];
+               x += ( real_c( i ) / real_c( n ) ) * ( v[1] - v[0] );
+               x += ( real_c( j ) / real_c( n ) ) * ( v[2] - v[0] );
+               if ( is3D_ )
+               {
+                  x += ( real_c( k ) / real_c( n ) ) * ( v[3] - v[0] );
+               }
+               samples.push_back( x );
+            }
+         }
+      }
+      geometryMaps_[primitive]->evalF( samples, mappedSamples );
+   }
+   else
+   {
+      mappedSamples.assign( mappedVertices_[primitive].begin(), mappedVertices_[primitive].begin() + int_c( dim_ + 1 ) );
+   }
+
+   Point3D min = mappedSamples[0];
+   Point3D max = mappedSamples[0];
+   for ( const auto& x : mappedSamples )
+   {
+      for ( uint_t i = 0; i < dim_; i++ )
+      {
+         min[i] = std::min( min[i], x[i] );
+         max[i] = std::max( max[i], x[i] );
+      }
+   }
+
+   // the inclusion test for tetrahedra accepts points that are slightly outside
+   real_t padding = real_c( 1e-08 );
+   if ( mappings_[primitive] == Mapping::NON_AFFINE )
+   {
+      real_t maxExtent = 0;
+      for ( uint_t i = 0; i < dim_; i++ )
+      {
+         maxExtent = std::max( maxExtent, max[i] - min[i] );
+      }
+      padding += maxExtent / real_c( numBoundingBoxSamplesPerEdge );
+   }
+
+   for ( uint_t i = 0; i < dim_; i++ )
+   {
+      min[i] -= padding;
+      max[i] += padding;
+   }
+   return {min, max};
+}
+
+void MacroPrimitiveLocator::BucketGrid::build( const std::vector< std::pair< Point3D, Point3D > >& boxes, const uint_t& dim )
+{
+   numBuckets = {1, 1, 1};
+   offsets.clear();
+   entries.clear();
+
+   // the grid bounds of an empty set of boxes describe an empty box
+   for ( uint_t i = 0; i < 3; i++ )
+   {
+      gridMin[i]    = std::numeric_limits< real_t >::max();
+      gridMax[i]    = std::numeric_limits< real_t >::lowest();
+      bucketSize[i] = real_c( 1 );
+   }
+
+   uint_t numBoxes = 0;
+   for ( const auto& box : boxes )
+   {
+      if ( box.first[0] > box.second[0] )
+      {
+         continue;
+      }
+      numBoxes++;
+      for ( uint_t i = 0; i < dim; i++ )
+      {
+         gridMin[i] = std::min( gridMin[i], box.first[i] );
+         gridMax[i] = std::max( gridMax[i], box.second[i] );
+      }
+   }
+
+   if ( numBoxes == 0 )
+   {
+      offsets.resize( 2, 0 );
+      return;
+   }
+
+   // roughly one bucket per box, distributed according to the extent of the covered region
+   real_t maxExtent = 0;
+   for ( uint_t i = 0; i < dim; i++ )
+   {
+      maxExtent = std::max( maxExtent, gridMax[i] - gridMin[i] );
+   }
+   const real_t bucketsPerDim = std::pow( real_c( numBoxes ), real_c( 1 ) / real_c( dim ) );
+   for ( uint_t i = 0; i < dim; i++ )
+   {
+      const real_t extent = gridMax[i] - gridMin[i];
+      if ( maxExtent > 0 )
+      {
+         numBuckets[i] = std::max( uint_t( 1 ), uint_c( std::ceil( bucketsPerDim * extent / maxExtent ) ) );
+      }
+      bucketSize[i] = extent > 0 ? extent / real_c( numBuckets[i] ) : real_c( 1 );
+   }
+
+   // two passes to build the compressed bucket lists
+   const uint_t          numBucketsTotal = numBuckets[0] * numBuckets[1] * numBuckets[2];
+   std::vector< uint_t > bucketSizes( numBucketsTotal, 0 );
+   offsets.resize( numBucketsTotal + 1, 0 );
+
+   for ( uint_t pass = 0; pass < 2; pass++ )
+   {
+      for ( uint_t box = 0; box < boxes.size(); box++ )
+      {
+         std::array< uint_t, 3 > first, last;
+         if ( boxes[box].first[0] > boxes[box].second[0] || !bucketRange( boxes[box].first, boxes[box].second, first, last ) )
+         {
+            continue;
+         }
+         for ( uint_t k = first[2]; k <= last[2]; k++ )
+         {
+            for ( uint_t j = first[1]; j <= last[1]; j++ )
+            {
+               for ( uint_t i = first[0]; i <= last[0]; i++ )
+               {
+                  const uint_t bucket = i + numBuckets[0] * ( j + numBuckets[1] * k );
+                  if ( pass == 0 )
+                  {
+                     offsets[bucket + 1]++;
+                  }
+                  else
+                  {
+                     entries[offsets[bucket] + bucketSizes[bucket]++] = box;
+                  }
+               }
+            }
+         }
+      }
+
+      if ( pass == 0 )
+      {
+         for ( uint_t bucket = 0; bucket < numBucketsTotal; bucket++ )
+         {
+            offsets[bucket + 1] += offsets[bucket];
+         }
+         entries.resize( offsets[numBucketsTotal] );
+      }
+   }
+}
+
+bool MacroPrimitiveLocator::BucketGrid::bucketRange( const Point3D&           min,
+                                                     const Point3D&           max,
+                                                     std::array< uint_t, 3 >& first,
+                                                     std::array< uint_t, 3 >& last ) const
+{
+   for ( uint_t i = 0; i < 3; i++ )
+   {
+      if ( numBuckets[i] == 1 )
+      {
+         first[i] = 0;
+         last[i]  = 0;
+         continue;
+      }
+
+      const real_t lower = std::floor( ( min[i] - gridMin[i] ) / bucketSize[i] );
+      const real_t upper = std::floor( ( max[i] - gridMin[i] ) / bucketSize[i] );
+      if ( upper < 0 || lower >= real_c( numBuckets[i] ) )
+      {
+         return false;
+      }
+      first[i] = lower < 0 ? 0 : uint_c( lower );
+      last[i]  = std::min( numBuckets[i] - 1, uint_c( upper ) );
+   }
+   return true;
+}
+
+void MacroPrimitiveLocator::BucketGrid::getCandidates( const Point3D&         min,
+                                                       const Point3D&         max,
+                                                       std::vector< uint_t >& candidates ) const
+{
+   candidates.clear();
+   if ( entries.empty() )
+   {
+      return;
+   }
+
+   std::array< uint_t, 3 > first, last;
+   if ( !bucketRange( min, max, first, last ) )
+   {
+      return;
+   }
+
+   for ( uint_t k = first[2]; k <= last[2]; k++ )
+   {
+      for ( uint_t j = first[1]; j <= last[1]; j++ )
+      {
+         for ( uint_t i = first[0]; i <= last[0]; i++ )
+         {
+            const uint_t bucket = i + numBuckets[0] * ( j + numBuckets[1] * k );
+            candidates.insert( candidates.end(), entries.data() + offsets[bucket], entries.data() + offsets[bucket + 1] );
+         }
+      }
+   }
+
+   // boxes that overlap several buckets are listed multiple times
+   std::sort( candidates.begin(), candidates.end() );
+   candidates.erase( std::unique( candidates.begin(), candidates.end() ), candidates.end() );
+}
+
+void MacroPrimitiveLocator::getCandidates( const Point3D&         coordinates,
+                                           const real_t&          radius,
+                                           std::vector< uint_t >& candidates ) const
+{
+   Point3D min = coordinates;
+   Point3D max = coordinates;
+   for ( uint_t i = 0; i < 3; i++ )
+   {
+      min[i] -= radius;
+      max[i] += radius;
+   }
+   primitiveGrid_.getCandidates( min, max, candidates );
+}
+
+void MacroPrimitiveLocator::toComputational( const uint_t&  primitive,
+                                             const Point3D& coordinates,
+                                             Point3D&       computationalCoordinates ) const
+{
+   if ( mappings_[primitive] == Mapping::IDENTITY )
+   {
+      computationalCoordinates = coordinates;
+   }
+   else if ( mappings_[primitive] == Mapping::AFFINE )
+   {
+      // the affine map is inverted via the barycentric coordinates of the point in the mapped primitive
+      const auto&   v  = vertices_[primitive];
+      const auto&   w  = mappedVertices_[primitive];
+      const Point3D d  = coordinates - w[0];
+      const Point3D e1 = w[1] - w[0];
+      const Point3D e2 = w[2] - w[0];
+      if ( is3D_ )
+      {
+         const Point3D e3  = w[3] - w[0];
+         const real_t  det = e1.dot( crossProduct( e2, e3 ) );
+         const real_t  l1  = d.dot( crossProduct( e2, e3 ) ) / det;
+         const real_t  l2  = e1.dot( crossProduct( d, e3 ) ) / det;
+         const real_t  l3  = e1.dot( crossProduct( e2, d ) ) / det;
+         computationalCoordinates = v[0] + l1 * ( v[1] - v[0] ) + l2 * ( v[2] - v[0] ) + l3 * ( v[3] - v[0] );
+      }
+      else
+      {
+         const real_t det         = e1[0] * e2[1] - e1[1] * e2[0];
+         const real_t l1          = ( d[0] * e2[1] - d[1] * e2[0] ) / det;
+         const real_t l2          = ( e1[0] * d[1] - e1[1] * d[0] ) / det;
+         computationalCoordinates = v[0] + l1 * ( v[1] - v[0] ) + l2 * ( v[2] - v[0] );
+      }
+   }
+   else
+   {
+      geometryMaps_[primitive]->evalFinv( coordinates, computationalCoordinates );
+   }
+}
+
+bool MacroPrimitiveLocator::contains( const uint_t& primitive, const Point3D& computationalCoordinates ) const
+{
+   const auto& v = vertices_[primitive];
+   if ( is3D_ )
+   {
+      const auto& n = inwardNormals_[primitive];
+      return isPointInTetrahedron( computationalCoordinates, v[0], v[1], v[2], v[3], n[0], n[1], n[2], n[3] );
+   }
+   else
+   {
+      return isPointInTriangle( Point2D( {computationalCoordinates[0], computationalCoordinates[1]} ),
+                                Point2D( {v[0][0], v[0][1]} ),
+                                Point2D( {v[1][0], v[1][1]} ),
+                                Point2D( {v[2][0], v[2][1]} ) );
+   }
+}
+
+bool MacroPrimitiveLocator::intersects( const uint_t&  primitive,
+                                        const Point3D& computationalCoordinates,
+                                        const real_t&  radius ) const
+{
+   const auto& v = vertices_[primitive];
+   if ( is3D_ )
+   {
+      return sphereTetrahedronIntersection( computationalCoordinates, radius, v[0], v[1], v[2], v[3] );
+   }
+   else
+   {
+      return circleTriangleIntersection( Point2D( {computationalCoordinates[0], computationalCoordinates[1]} ),
+                                         radius,
+                                         Point2D( {v[0][0], v[0][1]} ),
+                                         Point2D( {v[1][0], v[1][1]} ),
+                                         Point2D( {v[2][0], v[2][1]} ) );
+   }
+}
+
+bool MacroPrimitiveLocator::findLocalPrimitive( const Point3D& coordinates,
+                                                const real_t&  searchToleranceRadius,
+                                                PrimitiveID&   primitiveID,
+                                                Point3D&       computationalCoordinates ) const
+{
+   std::vector< uint_t > candidates;
+   return findLocalPrimitive( coordinates, searchToleranceRadius, primitiveID, computationalCoordinates, candidates );
+}
+
+bool MacroPrimitiveLocator::findLocalPrimitive( const Point3D&         coordinates,
+                                                const real_t&          searchToleranceRadius,
+                                                PrimitiveID&           primitiveID,
+                                                Point3D&               computationalCoordinates,
+                                                std::vector< uint_t >& candidates ) const
+{
+   getCandidates( coordinates, 0, candidates );
+   for ( const auto& candidate : candidates )
+   {
+      toComputational( candidate, coordinates, computationalCoordinates );
+      if ( contains( candidate, computationalCoordinates ) )
+      {
+         primitiveID = primitiveIDs_[candidate];
+         return true;
+      }
+   }
+
+   if ( searchToleranceRadius > 0 )
+   {
+      getCandidates( coordinates, searchToleranceRadius, candidates );
+      for ( const auto& candidate : candidates )
+      {
+         toComputational( candidate, coordinates, computationalCoordinates );
+         if ( intersects( candidate, computationalCoordinates, searchToleranceRadius ) )
+         {
+            primitiveID = primitiveIDs_[candidate];
+            return true;
+         }
+      }
+   }
+
+   return false;
+}
+
+std::map< PrimitiveID, std::vector< uint_t > >
+    MacroPrimitiveLocator::groupByLocalPrimitive( const std::vector< Point3D >& coordinates,
+                                                  const real_t&                 searchToleranceRadius,
+                                                  std::vector< Point3D >&       computationalCoordinates ) const
+{
+   std::map< PrimitiveID, std::vector< uint_t > > groups;
+   std::vector< uint_t >                          candidates;
+   computationalCoordinates.resize( coordinates.size() );
+   for ( uint_t point = 0; point < coordinates.size(); point++ )
+   {
+      PrimitiveID primitiveID;
+      Point3D&    computational = computationalCoordinates[point];
+      if ( findLocalPrimitive( coordinates[point], searchToleranceRadius, primitiveID, computational, candidates ) )
+      {
+         groups[primitiveID].push_back( point );
+      }
+   }
+   return groups;
+}
+
+void MacroPrimitiveLocator::evaluateLocally( const std::vector< Point3D >&  coordinates,
+                                             const real_t&                  searchToleranceRadius,
+                                             const LocalEvaluationFunction& evaluate,
+                                             std::vector< real_t >&         values,
+                                             std::vector< bool >&           found ) const
+{
+   values.assign( coordinates.size(), real_c( 0 ) );
+   found.assign( coordinates.size(), false );
+
+   std::vector< Point3D > computationalCoordinates;
+   std::vector< Point3D > groupPoints;
+   std::vector< real_t >  groupValues;
+   for ( const auto& group : groupByLocalPrimitive( coordinates, searchToleranceRadius, computationalCoordinates ) )
+   {
+      groupPoints.clear();
+      for ( const auto& point : group.second )
+      {
+         groupPoints.push_back( computationalCoordinates[point] );
+      }
+      groupValues.resize( groupPoints.size() );
+      evaluate( group.first, groupPoints, groupValues );
+      for ( uint_t i = 0; i < group.second.size(); i++ )
+      {
+         values[group.second[i]] = groupValues[i];
+         found[group.second[i]]  = true;
+      }
+   }
+}
+
+const std::vector< std::pair< Point3D, Point3D > >& MacroPrimitiveLocator::getProcessBoundingBoxes() const
+{
+   if ( processBoundingBoxes_.empty() )
+   {
+      const Point3D&              min      = primitiveGrid_.gridMin;
+      const Point3D&              max      = primitiveGrid_.gridMax;
+      const std::vector< real_t > localBox = {min[0], min[1], min[2], max[0], max[1], max[2]};
+      const std::vector< real_t > boxes    = walberla::mpi::allGatherv( localBox, walberla::mpi::MPIManager::instance()->comm() );
+
+      processBoundingBoxes_.resize( boxes.size() / 6 );
+      for ( uint_t process = 0; process < processBoundingBoxes_.size(); process++ )
+      {
+         processBoundingBoxes_[process].first  = Point3D( {boxes[6 * process], boxes[6 * process + 1], boxes[6 * process + 2]} );
+         processBoundingBoxes_[process].second = Point3D( {boxes[6 * process + 3], boxes[6 * process + 4], boxes[6 * process + 5]} );
+      }
+      processGrid_.build( processBoundingBoxes_, dim_ );
+   }
+   return processBoundingBoxes_;
+}
+
+void MacroPrimitiveLocator::evaluateDistributed( const std::vector< Point3D >&  coordinates,
+                                                 const real_t&                  searchToleranceRadius,
+                                                 const LocalEvaluationFunction& evaluate,
+                                                 std::vector< real_t >&         values,
+                                                 std::vector< bool >&           found ) const
+{
+   const int    rank         = walberla::mpi::MPIManager::instance()->rank();
+   const int    numProcesses = walberla::mpi::MPIManager::instance()->numProcesses();
+   const auto   comm         = walberla::mpi::MPIManager::instance()->comm();
+   const real_t radius       = std::max( searchToleranceRadius, real_c( 0 ) );
+
+   // collective on the first call, the boxes are stored until the locator is rebuilt
+   const auto& processBoundingBoxes = getProcessBoundingBoxes();
+
+   // each point is only sent to the processes whose local domain (box) may contain it,
+   // the candidate processes are looked up in the bucket grid of the process boxes
+   std::map< int, std::vector< uint_t > > requestedPoints;
+   std::vector< uint_t >                  candidateProcesses;
+   for ( uint_t point = 0; point < coordinates.size(); point++ )
+   {
+      Point3D min = coordinates[point];
+      Point3D max = coordinates[point];
+      for ( uint_t i = 0; i < 3; i++ )
+      {
+         min[i] -= radius;
+         max[i] += radius;
+      }
+      processGrid_.getCandidates( min, max, candidateProcesses );
+      for ( const auto& process : candidateProcesses )
+      {
+         const auto& box       = processBoundingBoxes[process];
+         bool        candidate = true;
+         for ( uint_t i = 0; i < dim_; i++ )
+         {
+            candidate = candidate && max[i] >= box.first[i] && min[i] <= box.second[i];
+         }
+         if ( candidate )
+         {
+            requestedPoints[int_c( process )].push_back( point );
+         }
+      }
+   }
+
+   // owner of each point, if several processes find a point the lowest rank is selected
+   values.assign( coordinates.size(), real_c( 0 ) );
+   found.assign( coordinates.size(), false );
+   std::vector< int > owner( coordinates.size(), numProcesses );
+
+   auto setValue = [&]( const uint_t& point, const real_t& value, const int& process ) {
+      if ( process < owner[point] )
+      {
+         owner[point]  = process;
+         values[point] = value;
+         found[point]  = true;
+      }
+   };
+
+   // both exchanges use the default tag: messages between two processes are matched in the order they were sent,
+   // and each process sends its replies only after its own requests
+   walberla::mpi::BufferSystem requestBufferSystem( comm );
+   std::set< walberla::mpi::MPIRank > ranksToReceiveRepliesFrom;
+
+   std::vector< Point3D > requestCoordinates;
+   std::vector< real_t >  requestValues;
+   std::vector< bool >    requestFound;
+
+   for ( const auto& request : requestedPoints )
+   {
+      if ( request.first == rank )
+      {
+         requestCoordinates.clear();
+         for ( const auto& point : request.second )
+         {
+            requestCoordinates.push_back( coordinates[point] );
+         }
+         evaluateLocally( requestCoordinates, searchToleranceRadius, evaluate, requestValues, requestFound );
+         for ( uint_t i = 0; i < request.second.size(); i++ )
+         {
+            if ( requestFound[i] )
+            {
+               setValue( request.second[i], requestValues[i], rank );
+            }
+         }
+         continue;
+      }
+
+      auto& buffer = requestBufferSystem.sendBuffer( request.first );
+      for ( const auto& point : request.second )
+      {
+         buffer << coordinates[point][0] << coordinates[point][1] << coordinates[point][2];
+      }
+      ranksToReceiveRepliesFrom.insert( request.first );
+   }
+
+   requestBufferSystem.setReceiverInfoFromSendBufferState( false, true );
+   requestBufferSystem.sendAll();
+
+   // evaluate the points requested by other processes and reply in the same order
+   walberla::mpi::BufferSystem replyBufferSystem( comm );
+   for ( auto i = requestBufferSystem.begin(); i != requestBufferSystem.end(); ++i )
+   {
+      requestCoordinates.clear();
+      while ( !i.buffer().isEmpty() )
+      {
+         real_t x, y, z;
+         i.buffer() >> x >> y >> z;
+         requestCoordinates.push_back( Point3D( {x, y, z} ) );
+      }
+
+      evaluateLocally( requestCoordinates, searchToleranceRadius, evaluate, requestValues, requestFound );
+
+      auto& buffer = replyBufferSystem.sendBuffer( i.rank() );
+      for ( uint_t point = 0; point < requestCoordinates.size(); point++ )
+      {
+         buffer << bool( requestFound[point] ) << requestValues[point];
+      }
+   }
+
+   replyBufferSystem.setReceiverInfo( ranksToReceiveRepliesFrom, true );
+   replyBufferSystem.sendAll();
+
+   for ( auto i = replyBufferSystem.begin(); i != replyBufferSystem.end(); ++i )
+   {
+      const auto& request = requestedPoints.at( i.rank() );
+      for ( const auto& point : request )
+      {
+         bool   pointFound;
+         real_t value;
+         i.buffer() >> pointFound >> value;
+         if ( pointFound )
+         {
+            setValue( point, value, i.rank() );
+         }
+      }
+      WALBERLA_CHECK( i.buffer().isEmpty() );
+   }
+}
+
+} // namespace hyteg
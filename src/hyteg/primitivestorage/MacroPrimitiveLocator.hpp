@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/PrimitiveID.hpp"
+#include "hyteg/types/pointnd.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+class GeometryMap;
+class PrimitiveStorage;
+
+/// \brief Spatial index of the process-local macro-faces (2D) or macro-cells (3D) of a PrimitiveStorage.
+///
+/// The axis-aligned bounding boxes of the macro-primitives are sorted into a uniform bucket grid that covers all
+/// local primitives. Finding the primitive that contains a point therefore only requires the (exact) inclusion
+/// tests for the few primitives that are registered in the bucket of the point instead of a linear scan over all
+/// local primitives.
+///
+/// The passed points are located in the physical domain. If a geometry map is attached to the macro-primitives,
+/// the bounding boxes cover the mapped primitives and the inclusion tests are performed after mapping the point
+/// back to the computational domain (GeometryMap::evalFinv()). The located points are passed to the evaluation
+/// in computational coordinates, as expected by the evaluate() methods of the macro-primitives.
+/// Maps that do not implement the inverse mapping are only supported if they are affine.
+///
+/// The index is not meant to be constructed directly but obtained via PrimitiveStorage::getMacroPrimitiveLocator(),
+/// which builds it once and rebuilds it only if the storage was modified (e.g. after migration).
+class MacroPrimitiveLocator
+{
+ public:
+   /// Callback that evaluates a function at a set of points that are all located in the same local
+   /// macro-face (2D) or macro-cell (3D). The points are passed in computational coordinates.
+   /// The values are written to the passed vector (same order as the points).
+   typedef std::function< void( const PrimitiveID&, const std::vector< Point3D >&, std::vector< real_t >& ) >
+       LocalEvaluationFunction;
+
+   explicit MacroPrimitiveLocator( const PrimitiveStorage& storage );
+
+   /// Searches the local macro-face (2D) or macro-cell (3D) that contains the passed point.
+   ///
+   /// First the exact inclusion test is performed. If that fails and searchToleranceRadius is positive,
+   /// the first primitive that intersects the circle / sphere with the passed radius is selected.
+   /// If several primitives qualify, the one with the smallest PrimitiveID is returned,
+   /// which is the same primitive a linear scan over the storage would find.
+   ///
+   /// \param coordinates              the point to search for (physical domain)
+   /// \param searchToleranceRadius    radius of the circle / sphere for the second search, skipped if non-positive,
+   ///                                 measured in the computational domain
+   /// \param primitiveID              set to the ID of the containing primitive on success
+   /// \param computationalCoordinates set to the point mapped to the computational domain of that primitive on success
+   /// \return true if a primitive was found, false otherwise
+   bool findLocalPrimitive( const Point3D& coordinates,
+                            const real_t&  searchToleranceRadius,
+                            PrimitiveID&   primitiveID,
+                            Point3D&       computationalCoordinates ) const;
+
+   /// Locates all passed points and groups the indices of the points that were found by the containing primitive.
+   /// The computational coordinates of the points that were found are written to the passed vector.
+   std::map< PrimitiveID, std::vector< uint_t > >
+       groupByLocalPrimitive( const std::vector< Point3D >& coordinates,
+                              const real_t&                 searchToleranceRadius,
+                              std::vector< Point3D >&       computationalCoordinates ) const;
+
+   /// \brief Evaluates a function at the passed points, which may be located on any process.
+   ///
+   /// Must be called collectively. Each process passes its own (possibly empty) list of points.
+   /// The bounding boxes of the local domains of all processes are exchanged on the first call (and after the
+   /// locator was rebuilt) and sorted into a bucket grid. Each point is then only sent to the processes whose
+   /// bounding box contains it, located in the local index there, grouped by primitive and evaluated in a single
+   /// sweep via the passed callback. The values are returned point-to-point to the requesting process.
+   /// If a point is found on several processes (e.g. on an interface), the value of the lowest rank is used.
+   ///
+   /// \param coordinates           the process-local points (physical domain)
+   /// \param searchToleranceRadius see findLocalPrimitive()
+   /// \param evaluate              evaluation callback for points in the same local primitive
+   /// \param values                resized and filled with the evaluated values (zero where no primitive was found)
+   /// \param found                 resized and set to true for all points that were found on any process
+   void evaluateDistributed( const std::vector< Point3D >&  coordinates,
+                             const real_t&                  searchToleranceRadius,
+                             const LocalEvaluationFunction& evaluate,
+                             std::vector< real_t >&         values,
+                             std::vector< bool >&           found ) const;
+
+   uint_t getNumLocalPrimitives() const { return primitiveIDs_.size(); }
+
+ private:
+   /// \brief Uniform bucket grid over a set of axis-aligned boxes.
+   ///
+   /// Roughly one bucket per box, distributed according to the extent of the covered region. The boxes of bucket b
+   /// are stored in entries[offsets[b], offsets[b+1]). Empty boxes (min > max) are not inserted.
+   struct BucketGrid
+   {
+      void build( const std::vector< std::pair< Point3D, Point3D > >& boxes, const uint_t& dim );
+
+      /// Indices of all boxes that are registered in a bucket overlapping the passed box, sorted and unique.
+      void getCandidates( const Point3D& min, const Point3D& max, std::vector< uint_t >& candidates ) const;
+
+      bool bucketRange( const Point3D&           min,
+                        const Point3D&           max,
+                        std::array< uint_t, 3 >& first,
+                        std::array< uint_t, 3 >& last ) const;
+
+      /// bounds of all inserted boxes (empty box if there are none)
+      Point3D                 gridMin;
+      Point3D                 gridMax;
+      Point3D                 bucketSize;
+      std::array< uint_t, 3 > numBuckets;
+      std::vector< uint_t >   offsets;
+      std::vector< uint_t >   entries;
+   };
+
+   /// Same as the public version, but reuses the passed candidate list to avoid allocations in loops.
+   bool findLocalPrimitive( const Point3D&         coordinates,
+                            const real_t&          searchToleranceRadius,
+                            PrimitiveID&           primitiveID,
+                            Point3D&               computationalCoordinates,
+                            std::vector< uint_t >& candidates ) const;
+
+   /// Indices of all primitives that are registered in a bucket overlapping the box around the point.
+   void getCandidates( const Point3D& coordinates, const real_t& radius, std::vector< uint_t >& candidates ) const;
+
+   /// Evaluates the points that are located in the local primitives, values of points that are not found are zero.
+   void evaluateLocally( const std::vector< Point3D >&  coordinates,
+                         const real_t&                  searchToleranceRadius,
+                         const LocalEvaluationFunction& evaluate,
+                         std::vector< real_t >&         values,
+                         std::vector< bool >&           found ) const;
+
+   /// Bounding boxes of the local domains of all processes, exchanged (collectively) on the first call.
+   const std::vector< std::pair< Point3D, Point3D > >& getProcessBoundingBoxes() const;
+
+   /// Classifies the geometry map of the primitive and stores the mapped vertices.
+   void computeMapping( const uint_t& primitive );
+
+   /// Axis-aligned bounding box of the (mapped) primitive in the physical domain.
+   std::pair< Point3D, Point3D > computeBoundingBox( const uint_t& primitive ) const;
+
+   /// Maps the physical point to the computational domain of the primitive.
+   void toComputational( const uint_t& primitive, const Point3D& coordinates, Point3D& computationalCoordinates ) const;
+
+   bool contains( const uint_t& primitive, const Point3D& computationalCoordinates ) const;
+   bool intersects( const uint_t& primitive, const Point3D& computationalCoordinates, const real_t& radius ) const;
+
+   /// IDENTITY and AFFINE are inverted without evaluating the map, NON_AFFINE via GeometryMap::evalFinv()
+   enum class Mapping
+   {
+      IDENTITY,
+      AFFINE,
+      NON_AFFINE
+   };
+
+   bool   is3D_;
+   uint_t dim_;
+
+   /// local primitives in the order of their IDs
+   std::vector< PrimitiveID >                    primitiveIDs_;
+   std::vector< std::array< Point3D, 4 > >       vertices_;
+   std::vector< std::array< Point3D, 4 > >       inwardNormals_;
+   std::vector< std::shared_ptr< GeometryMap > > geometryMaps_;
+   std::vector< Mapping >                        mappings_;
+   std::vector< std::array< Point3D, 4 > >       mappedVertices_;
+   std::vector< std::pair< Point3D, Point3D > >  boundingBoxes_;
+
+   /// bucket grid of the local primitives, its bounds also bound the local domain
+   BucketGrid primitiveGrid_;
+
+   /// bucket grid of the bounding boxes of the local domains of all processes, built together with the boxes
+   mutable std::vector< std::pair< Point3D, Point3D > > processBoundingBoxes_;
+   mutable BucketGrid                                   processGrid_;
+};
+
+} // namespace hyteg
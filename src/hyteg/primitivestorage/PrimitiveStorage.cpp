@@ -37,6 +37,7 @@
 #include "hyteg/primitives/Face.hpp"
 #include "hyteg/primitives/Primitive.hpp"
 #include "hyteg/primitives/Vertex.hpp"
+#include "hyteg/primitivestorage/MacroPrimitiveLocator.hpp"
 #include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
 #include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
 
@@ -55,6 +56,7 @@ PrimitiveStorage::PrimitiveStorage( const SetupPrimitiveStorage&
                                     const std::shared_ptr< walberla::WcTimingTree >& timingTree )
 : primitiveDataHandlers_( 0 )
 , modificationStamp_( 0 )
+, macroPrimitiveLocatorModificationStamp_( 0 )
 , timingTree_( timingTree )
 , hasGlobalCells_( setupStorage.getNumberOfCells() > 0 )
 {
@@ -727,6 +729,16 @@ uint_t PrimitiveStorage::getPrimitiveRank( const PrimitiveID& id ) const
    }
 }
 
+std::shared_ptr< const MacroPrimitiveLocator > PrimitiveStorage::getMacroPrimitiveLocator() const
+{
+   if ( macroPrimitiveLocator_ == nullptr || macroPrimitiveLocatorModificationStamp_ != modificationStamp_ )
+   {
+      macroPrimitiveLocator_                  = std::make_shared< MacroPrimitiveLocator >( *this );
+      macroPrimitiveLocatorModificationStamp_ = modificationStamp_;
+   }
+   return macroPrimitiveLocator_;
+}
+
 std::map< PrimitiveID, uint_t > PrimitiveStorage::getGlobalPrimitiveRanks() const
 {
    std::map< PrimitiveID, uint_t > primitiveRanks;
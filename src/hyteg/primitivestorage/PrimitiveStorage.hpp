@@ -41,6 +41,7 @@ class Vertex;
 class Edge;
 class Face;
 class Cell;
+class MacroPrimitiveLocator;
 
 typedef std::map< PrimitiveID::IDType, uint_t > MigrationMap_T;
 
@@ -404,6 +405,11 @@ class PrimitiveStorage : private walberla::NonCopyable
    /// e.g. after migration of primitives to other processes.
    uint_t getModificationStamp() const { return modificationStamp_; }
 
+   /// Returns a spatial index of the local macro-faces (2D) or macro-cells (3D) that is used to locate points,
+   /// e.g. for the evaluation of functions. The index is built on the first call and rebuilt only if the storage
+   /// was modified in the meantime.
+   std::shared_ptr< const MacroPrimitiveLocator > getMacroPrimitiveLocator() const;
+
    /// Fills the passed set with all neighboring ranks (== all ranks from primitives that are located in the direct neighborhood)
    void getNeighboringRanks( std::set< uint_t >& neighboringRanks ) const;
    void getNeighboringRanks( std::set< walberla::mpi::MPIRank >& neighboringRanks ) const;
@@ -644,6 +650,9 @@ class PrimitiveStorage : private walberla::NonCopyable
    void   wasModified() { modificationStamp_++; }
    uint_t modificationStamp_;
 
+   mutable std::shared_ptr< const MacroPrimitiveLocator > macroPrimitiveLocator_;
+   mutable uint_t                                         macroPrimitiveLocatorModificationStamp_;
+
    std::shared_ptr< walberla::WcTimingTree > timingTree_;
 
    bool hasGlobalCells_;
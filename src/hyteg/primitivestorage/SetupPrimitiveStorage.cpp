@@ -363,6 +363,15 @@ SetupPrimitiveStorage::SetupPrimitiveStorage( const MeshInfo & meshInfo, const u
   loadbalancing::roundRobin( *this );
 }
 
+SetupPrimitiveStorage::SetupPrimitiveStorage( const VertexMap & vertices, const EdgeMap & edges, const FaceMap & faces,
+                                              const CellMap & cells, const uint_t & numberOfProcesses ) :
+    numberOfProcesses_( numberOfProcesses ), vertices_( vertices ), edges_( edges ), faces_( faces ), cells_( cells )
+{
+  WALBERLA_ASSERT_GREATER( numberOfProcesses_, 0, "Number of processes must be positive" );
+
+  loadbalancing::roundRobin( *this );
+}
+
 Primitive * SetupPrimitiveStorage::getPrimitive( const PrimitiveID & id )
 {
   if ( vertexExists( id ) ) { return getVertex( id ); }
@@ -51,6 +51,11 @@ public:
 
   SetupPrimitiveStorage( const MeshInfo & meshInfo, const uint_t & numberOfProcesses );
 
+  /// Creates a SetupPrimitiveStorage from completely set up primitives (including all neighborhood information),
+  /// e.g. to restore the topology that was stored in a checkpoint. The primitives are distributed round robin.
+  SetupPrimitiveStorage( const VertexMap & vertices, const EdgeMap & edges, const FaceMap & faces, const CellMap & cells,
+                         const uint_t & numberOfProcesses );
+
   void toStream( std::ostream & os, bool verbose = false ) const;
 
   uint_t getNumberOfProcesses() const { return numberOfProcesses_; }
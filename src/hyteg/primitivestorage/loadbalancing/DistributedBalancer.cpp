@@ -21,6 +21,7 @@
 #include "hyteg/primitivestorage/loadbalancing/DistributedBalancer.hpp"
 
 #include <algorithm>
+#include <map>
 
 #include "core/DataTypes.h"
 #include "core/debug/CheckFunctions.h"
@@ -31,6 +32,9 @@
 #include "core/mpi/MPIWrapper.h"
 
 #include "hyteg/communication/PackageBufferSystem.hpp"
+#include "hyteg/primitives/Cell.hpp"
+#include "hyteg/primitives/Face.hpp"
+#include "hyteg/primitivestorage/loadbalancing/HilbertCurve.hpp"
 
 namespace hyteg {
 namespace loadbalancing {
@@ -372,6 +376,176 @@ MigrationInfo roundRobinInterval( PrimitiveStorage& storage, uint_t interval, ui
    return migrationInfo;
 }
 
+MigrationInfo hilbertCurve( PrimitiveStorage& storage )
+{
+   return hilbertCurve( storage, []( const PrimitiveID& ) { return real_t( 1 ); } );
+}
+
+MigrationInfo hilbertCurve( PrimitiveStorage&                                    storage,
+                            const std::function< real_t( const PrimitiveID& ) >& weight,
+                            const bool&                                          minimizeMigration )
+{
+   const bool   is3D         = storage.hasGlobalCells();
+   const uint_t dimension    = is3D ? 3 : 2;
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+   MPI_Comm     communicator = walberla::mpi::MPIManager::instance()->comm();
+
+   // gather the centroids and weights of all volume primitives on all processes
+   std::vector< PrimitiveID > localVolumePrimitiveIDs;
+   if ( is3D )
+   {
+      storage.getCellIDs( localVolumePrimitiveIDs );
+   }
+   else
+   {
+      storage.getFaceIDs( localVolumePrimitiveIDs );
+   }
+
+   std::vector< PrimitiveID::IDType > localIDs;
+   std::vector< real_t >              localCentroidCoordinates;
+   std::vector< real_t >              localWeights;
+
+   for ( const auto& id : localVolumePrimitiveIDs )
+   {
+      Point3D centroid( {0, 0, 0} );
+      if ( is3D )
+      {
+         const auto& coordinates = storage.getCell( id )->getCoordinates();
+         centroid = 0.25 * ( coordinates[0] + coordinates[1] + coordinates[2] + coordinates[3] );
+      }
+      else
+      {
+         const auto& coordinates = storage.getFace( id )->getCoordinates();
+         centroid = ( 1.0 / 3.0 ) * ( coordinates[0] + coordinates[1] + coordinates[2] );
+      }
+
+      localIDs.push_back( id.getID() );
+      for ( uint_t d = 0; d < 3; d++ )
+      {
+         localCentroidCoordinates.push_back( centroid[d] );
+      }
+      localWeights.push_back( weight( id ) );
+   }
+
+   const auto globalIDs                 = walberla::mpi::allGatherv( localIDs, communicator );
+   const auto globalCentroidCoordinates = walberla::mpi::allGatherv( localCentroidCoordinates, communicator );
+   const auto globalWeights             = walberla::mpi::allGatherv( localWeights, communicator );
+
+   WALBERLA_CHECK_EQUAL( 3 * globalIDs.size(), globalCentroidCoordinates.size() );
+   WALBERLA_CHECK_EQUAL( globalIDs.size(), globalWeights.size() );
+
+   std::vector< Point3D > globalCentroids;
+   for ( uint_t i = 0; i < globalIDs.size(); i++ )
+   {
+      globalCentroids.push_back( Point3D(
+          {globalCentroidCoordinates[3 * i], globalCentroidCoordinates[3 * i + 1], globalCentroidCoordinates[3 * i + 2]} ) );
+   }
+
+   // every process computes the same partition of the volume primitives
+   auto parts = hilbertCurvePartition( globalCentroids, globalIDs, globalWeights, dimension, numProcesses );
+
+   if ( minimizeMigration )
+   {
+      // The gathered primitives are ordered by their current rank. Each part is assigned to the process that already
+      // owns most of its volume primitives (greedy, largest overlap first), the remaining parts to the remaining
+      // processes in ascending order. All processes compute the same assignment.
+      const auto numLocalVolumePrimitives =
+          walberla::mpi::allGatherv( std::vector< uint_t >( 1, localIDs.size() ), communicator );
+
+      std::map< std::pair< uint_t, uint_t >, uint_t > overlap;
+      uint_t                                          primitive = 0;
+      for ( uint_t rank = 0; rank < numLocalVolumePrimitives.size(); rank++ )
+      {
+         for ( uint_t i = 0; i < numLocalVolumePrimitives[rank]; i++ )
+         {
+            overlap[{parts[primitive], rank}]++;
+            primitive++;
+         }
+      }
+
+      std::vector< std::pair< uint_t, std::pair< uint_t, uint_t > > > sortedOverlap;
+      for ( const auto& it : overlap )
+      {
+         sortedOverlap.push_back( {it.second, it.first} );
+      }
+      std::stable_sort( sortedOverlap.begin(), sortedOverlap.end(), []( const auto& a, const auto& b ) {
+         return a.first > b.first;
+      } );
+
+      std::vector< uint_t > partToRank( numProcesses, numProcesses );
+      std::vector< bool >   rankAssigned( numProcesses, false );
+      for ( const auto& it : sortedOverlap )
+      {
+         const uint_t part = it.second.first;
+         const uint_t rank = it.second.second;
+         if ( partToRank[part] == numProcesses && !rankAssigned[rank] )
+         {
+            partToRank[part]   = rank;
+            rankAssigned[rank] = true;
+         }
+      }
+      uint_t nextRank = 0;
+      for ( uint_t part = 0; part < numProcesses; part++ )
+      {
+         if ( partToRank[part] == numProcesses )
+         {
+            while ( rankAssigned[nextRank] )
+            {
+               nextRank++;
+            }
+            partToRank[part]       = nextRank;
+            rankAssigned[nextRank] = true;
+         }
+      }
+
+      for ( auto& part : parts )
+      {
+         part = partToRank[part];
+      }
+   }
+
+   std::map< PrimitiveID::IDType, uint_t > volumePrimitiveTargetRanks;
+   for ( uint_t i = 0; i < globalIDs.size(); i++ )
+   {
+      volumePrimitiveTargetRanks[globalIDs[i]] = parts[i];
+   }
+
+   // co-locate the local lower-dimensional primitives with their adjacent volume primitives
+   MigrationMap_T migrationMap;
+   for ( const auto& primitiveID : storage.getPrimitiveIDs() )
+   {
+      if ( volumePrimitiveTargetRanks.count( primitiveID.getID() ) > 0 )
+      {
+         migrationMap[primitiveID.getID()] = volumePrimitiveTargetRanks.at( primitiveID.getID() );
+         continue;
+      }
+
+      std::vector< PrimitiveID > adjacentVolumePrimitives;
+      if ( is3D )
+      {
+         storage.getPrimitive( primitiveID )->getNeighborCells( adjacentVolumePrimitives );
+      }
+      else
+      {
+         storage.getPrimitive( primitiveID )->getNeighborFaces( adjacentVolumePrimitives );
+      }
+
+      std::vector< uint_t > adjacentRanks;
+      for ( const auto& adjacentID : adjacentVolumePrimitives )
+      {
+         adjacentRanks.push_back( volumePrimitiveTargetRanks.at( adjacentID.getID() ) );
+      }
+
+      migrationMap[primitiveID.getID()] = colocatedRank( adjacentRanks, primitiveID );
+   }
+
+   const auto numReceivingPrimitives = getNumReceivingPrimitives( migrationMap );
+
+   MigrationInfo migrationInfo( migrationMap, numReceivingPrimitives );
+   storage.migratePrimitives( migrationInfo );
+   return migrationInfo;
+}
+
 MigrationInfo reverseDistribution( const MigrationInfo& originalMigrationInfo, PrimitiveStorage& storageToRedistribute )
 {
    MigrationInfo migrationInfo = reverseDistributionDry( originalMigrationInfo );
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "hyteg/primitivestorage/PrimitiveStorage.hpp"
 #include "core/mpi/MPIWrapper.h"
 
@@ -65,6 +67,29 @@ MigrationInfo roundRobinInterval( PrimitiveStorage & storage, uint_t interval );
 /// \param numProcesses number of processes that will obtain primitives
 MigrationInfo roundRobinInterval( PrimitiveStorage & storage, uint_t interval, uint_t numProcesses );
 
+/// \brief Distributes the primitives along a Hilbert space-filling curve in parallel.
+///
+/// Same algorithm as loadbalancing::hilbertCurve( SetupPrimitiveStorage & ).
+/// The centroids of all volume primitives are gathered on all processes, so this is intended for meshes with
+/// a moderate number of macro-primitives.
+///
+/// \param storage the PrimitiveStorage, the primitives are distributed on
+MigrationInfo hilbertCurve( PrimitiveStorage & storage );
+
+/// \brief Distributes the primitives along a Hilbert space-filling curve in parallel.
+///
+/// \param storage the PrimitiveStorage, the primitives are distributed on
+/// \param weight  returns the (non-negative) weight of a local volume primitive, e.g. the number of DoFs or the
+///                measured compute time; the cost of the lower-dimensional primitives should be included in the
+///                weights of the adjacent volume primitives
+/// \param minimizeMigration if true, the parts of the curve are not assigned to the processes in curve order, but each
+///                          part is assigned to the process that already owns most of its volume primitives, so that
+///                          a repartitioning of an existing Hilbert curve distribution only migrates the primitives
+///                          close to the part boundaries
+MigrationInfo hilbertCurve( PrimitiveStorage &                                     storage,
+                            const std::function< real_t( const PrimitiveID & ) > & weight,
+                            const bool &                                           minimizeMigration = false );
+
 /// \brief Reverses the previous distribution previously performed by some load balancing algorithm.
 ///
 /// \param originalMigrationInfo the MigrationInfo that was calculated by the previous algorithm
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/primitivestorage/loadbalancing/DistributionQuality.hpp"
+
+#include <set>
+#include <vector>
+
+#include "core/mpi/Reduce.h"
+
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+
+namespace hyteg {
+namespace loadbalancing {
+
+using walberla::real_c;
+
+DistributionQuality distributionQuality( const SetupPrimitiveStorage& storage )
+{
+   const uint_t numProcesses = storage.getNumberOfProcesses();
+
+   std::vector< std::set< uint_t > > neighborRanks( numProcesses );
+   std::vector< uint_t >             primitivesPerRank( numProcesses, 0 );
+   uint_t                            edgeCut = 0;
+
+   SetupPrimitiveStorage::PrimitiveMap setupPrimitives;
+   storage.getSetupPrimitives( setupPrimitives );
+
+   for ( const auto& it : setupPrimitives )
+   {
+      const uint_t rank = storage.getTargetRank( it.first );
+      primitivesPerRank[rank]++;
+
+      std::vector< PrimitiveID > neighborIDs;
+      it.second->getNeighborPrimitives( neighborIDs );
+      for ( const auto& neighborID : neighborIDs )
+      {
+         const uint_t neighborRank = storage.getTargetRank( neighborID );
+         if ( neighborRank != rank )
+         {
+            edgeCut++;
+            neighborRanks[rank].insert( neighborRank );
+         }
+      }
+   }
+
+   DistributionQuality quality;
+   // the neighborhood relation is symmetric, each cut is counted twice
+   quality.edgeCut              = edgeCut / 2;
+   quality.maxNeighborRanks     = 0;
+   quality.avgNeighborRanks     = 0;
+   quality.maxPrimitivesPerRank = 0;
+   quality.avgPrimitivesPerRank = real_c( storage.getNumberOfPrimitives() ) / real_c( numProcesses );
+   for ( uint_t rank = 0; rank < numProcesses; rank++ )
+   {
+      quality.maxNeighborRanks     = std::max( quality.maxNeighborRanks, uint_c( neighborRanks[rank].size() ) );
+      quality.avgNeighborRanks     += real_c( neighborRanks[rank].size() ) / real_c( numProcesses );
+      quality.maxPrimitivesPerRank = std::max( quality.maxPrimitivesPerRank, primitivesPerRank[rank] );
+   }
+   return quality;
+}
+
+DistributionQuality distributionQuality( const PrimitiveStorage& storage )
+{
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   std::set< uint_t > neighborRanks;
+   uint_t             edgeCut = 0;
+
+   for ( const auto& primitiveID : storage.getPrimitiveIDs() )
+   {
+      std::vector< PrimitiveID > neighborIDs;
+      storage.getPrimitive( primitiveID )->getNeighborPrimitives( neighborIDs );
+      for ( const auto& neighborID : neighborIDs )
+      {
+         if ( storage.primitiveExistsInNeighborhood( neighborID ) )
+         {
+            edgeCut++;
+            neighborRanks.insert( storage.getNeighborPrimitiveRank( neighborID ) );
+         }
+      }
+   }
+
+   const uint_t numLocalPrimitives = storage.getNumberOfLocalPrimitives();
+   const uint_t numNeighborRanks   = uint_c( neighborRanks.size() );
+
+   DistributionQuality quality;
+   // the neighborhood relation is symmetric, each cut is counted twice
+   quality.edgeCut              = walberla::mpi::allReduce( edgeCut, walberla::mpi::SUM ) / 2;
+   quality.maxNeighborRanks     = walberla::mpi::allReduce( numNeighborRanks, walberla::mpi::MAX );
+   quality.avgNeighborRanks     = real_c( walberla::mpi::allReduce( numNeighborRanks, walberla::mpi::SUM ) ) / real_c( numProcesses );
+   quality.maxPrimitivesPerRank = walberla::mpi::allReduce( numLocalPrimitives, walberla::mpi::MAX );
+   quality.avgPrimitivesPerRank = real_c( storage.getNumberOfGlobalPrimitives() ) / real_c( numProcesses );
+   return quality;
+}
+
+} // namespace loadbalancing
+} // namespace hyteg
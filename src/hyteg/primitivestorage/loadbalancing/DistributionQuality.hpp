@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <ostream>
+
+#include "core/DataTypes.h"
+
+namespace hyteg {
+
+class SetupPrimitiveStorage;
+class PrimitiveStorage;
+
+namespace loadbalancing {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Metrics that describe the quality of a distribution of the macro-primitives.
+///
+/// Used to compare load balancing algorithms, e.g. the number of neighbor processes directly corresponds
+/// to the number of messages that are sent by the BufferedCommunicator during a halo exchange.
+struct DistributionQuality
+{
+   /// number of pairs of neighboring primitives that are located on different processes
+   uint_t edgeCut;
+   /// maximum number of processes a process shares a neighborhood relation with
+   uint_t maxNeighborRanks;
+   /// average number of processes a process shares a neighborhood relation with
+   real_t avgNeighborRanks;
+   /// maximum number of primitives on a process
+   uint_t maxPrimitivesPerRank;
+   /// average number of primitives on a process
+   real_t avgPrimitivesPerRank;
+};
+
+/// Evaluates the distribution that is defined by the target ranks of the \ref SetupPrimitiveStorage.
+DistributionQuality distributionQuality( const SetupPrimitiveStorage& storage );
+
+/// Evaluates the current distribution of the \ref PrimitiveStorage. Collective call, the result is valid on all processes.
+DistributionQuality distributionQuality( const PrimitiveStorage& storage );
+
+inline std::ostream& operator<<( std::ostream& os, const DistributionQuality& quality )
+{
+   os << "edge-cut: " << quality.edgeCut << ", neighbor ranks (max / avg): " << quality.maxNeighborRanks << " / "
+      << quality.avgNeighborRanks << ", primitives per rank (max / avg): " << quality.maxPrimitivesPerRank << " / "
+      << quality.avgPrimitivesPerRank;
+   return os;
+}
+
+} // namespace loadbalancing
+} // namespace hyteg
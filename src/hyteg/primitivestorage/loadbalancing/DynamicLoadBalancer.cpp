@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/primitivestorage/loadbalancing/DynamicLoadBalancer.hpp"
+
+#include "core/debug/CheckFunctions.h"
+#include "core/logging/Logging.h"
+#include "core/mpi/Reduce.h"
+
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/DistributedBalancer.hpp"
+
+namespace hyteg {
+namespace loadbalancing {
+
+using walberla::real_c;
+using walberla::uint_c;
+
+DynamicLoadBalancer::DynamicLoadBalancer( const std::shared_ptr< PrimitiveStorage >& storage,
+                                          const uint_t&                              interval,
+                                          const real_t&                              imbalanceThreshold )
+: storage_( storage )
+, interval_( interval )
+, imbalanceThreshold_( imbalanceThreshold )
+, stepCounter_( 0 )
+, numberOfMigrations_( 0 )
+, costModel_( []( const PrimitiveID& ) { return real_c( 1 ); } )
+, timerTotalAtLastRebalancing_( 0 )
+{
+   WALBERLA_CHECK_GREATER( interval_, 0, "Rebalancing interval must be larger than zero." );
+   WALBERLA_CHECK_GREATER_EQUAL( imbalanceThreshold_, real_c( 1 ), "Imbalance threshold must not be smaller than 1." );
+}
+
+void DynamicLoadBalancer::setTimer( const std::string& timerName )
+{
+   timerName_                   = timerName;
+   timerTotalAtLastRebalancing_ = 0;
+   if ( storage_->getTimingTree()->timerExists( timerName_ ) )
+   {
+      timerTotalAtLastRebalancing_ = real_c( ( *storage_->getTimingTree() )[timerName_].total() );
+   }
+}
+
+void DynamicLoadBalancer::addCost( const PrimitiveID& primitiveID, const real_t& cost )
+{
+   WALBERLA_ASSERT( storage_->primitiveExistsLocally( primitiveID ) );
+   costCounters_[primitiveID.getID()] += cost;
+}
+
+bool DynamicLoadBalancer::step()
+{
+   stepCounter_++;
+   if ( stepCounter_ % interval_ != 0 )
+   {
+      return false;
+   }
+   return rebalance();
+}
+
+real_t DynamicLoadBalancer::measuredTime() const
+{
+   if ( timerName_.empty() || !storage_->getTimingTree()->timerExists( timerName_ ) )
+   {
+      return real_c( 0 );
+   }
+   return real_c( ( *storage_->getTimingTree() )[timerName_].total() ) - timerTotalAtLastRebalancing_;
+}
+
+std::map< PrimitiveID::IDType, real_t > DynamicLoadBalancer::estimateLocalCosts() const
+{
+   std::vector< PrimitiveID > volumePrimitiveIDs;
+   if ( storage_->hasGlobalCells() )
+   {
+      storage_->getCellIDs( volumePrimitiveIDs );
+   }
+   else
+   {
+      storage_->getFaceIDs( volumePrimitiveIDs );
+   }
+
+   std::map< PrimitiveID::IDType, real_t > costs;
+   real_t                                  localCost = 0;
+   for ( const auto& id : volumePrimitiveIDs )
+   {
+      real_t cost = costModel_( id );
+      if ( costCounters_.count( id.getID() ) > 0 )
+      {
+         cost += costCounters_.at( id.getID() );
+      }
+      WALBERLA_CHECK_GREATER_EQUAL( cost, real_c( 0 ), "Cost of primitive " << id << " is negative." );
+      costs[id.getID()] = cost;
+      localCost += cost;
+   }
+
+   // scale the estimated costs to the measured time of this process
+   if ( !timerName_.empty() && localCost > real_c( 0 ) )
+   {
+      const real_t scaling = measuredTime() / localCost;
+      for ( auto& it : costs )
+      {
+         it.second *= scaling;
+      }
+   }
+
+   return costs;
+}
+
+real_t DynamicLoadBalancer::computeImbalance() const
+{
+   real_t localLoad = 0;
+   for ( const auto& it : estimateLocalCosts() )
+   {
+      localLoad += it.second;
+   }
+   if ( !timerName_.empty() )
+   {
+      // also counts the measured time of processes without volume primitives
+      localLoad = measuredTime();
+   }
+
+   const real_t maxLoad = walberla::mpi::allReduce( localLoad, walberla::mpi::MAX );
+   const real_t sumLoad = walberla::mpi::allReduce( localLoad, walberla::mpi::SUM );
+   const real_t avgLoad = sumLoad / real_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   if ( avgLoad <= real_c( 0 ) )
+   {
+      return real_c( 1 );
+   }
+   return maxLoad / avgLoad;
+}
+
+bool DynamicLoadBalancer::rebalance( const bool& force )
+{
+   const real_t imbalance = computeImbalance();
+   if ( !force && imbalance <= imbalanceThreshold_ )
+   {
+      return false;
+   }
+
+   storage_->getTimingTree()->start( "Dynamic load balancing" );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "[DynamicLoadBalancer] Load imbalance (max / avg) " << imbalance << ", rebalancing ..." );
+
+   // the parts are kept on the processes that own most of them to limit the migration volume
+   const auto costs         = estimateLocalCosts();
+   const auto migrationInfo = distributed::hilbertCurve(
+       *storage_, [&costs]( const PrimitiveID& id ) { return costs.at( id.getID() ); }, true );
+
+   const uint_t rank                  = uint_c( walberla::mpi::MPIManager::instance()->rank() );
+   uint_t       numMigratedPrimitives = 0;
+   for ( const auto& it : costs )
+   {
+      if ( migrationInfo.getMap().at( it.first ) != rank )
+      {
+         numMigratedPrimitives++;
+      }
+   }
+   numMigratedPrimitives            = walberla::mpi::allReduce( numMigratedPrimitives, walberla::mpi::SUM );
+   const uint_t numVolumePrimitives = walberla::mpi::allReduce( uint_c( costs.size() ), walberla::mpi::SUM );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "[DynamicLoadBalancer] Migrated " << numMigratedPrimitives << " of " << numVolumePrimitives
+                                                                << " volume primitives." );
+
+   for ( const auto& callback : migrationCallbacks_ )
+   {
+      callback();
+   }
+
+   numberOfMigrations_++;
+
+   storage_->getTimingTree()->stop( "Dynamic load balancing" );
+
+   resetMeasurements();
+
+   return true;
+}
+
+void DynamicLoadBalancer::resetMeasurements()
+{
+   costCounters_.clear();
+   if ( !timerName_.empty() && storage_->getTimingTree()->timerExists( timerName_ ) )
+   {
+      timerTotalAtLastRebalancing_ = real_c( ( *storage_->getTimingTree() )[timerName_].total() );
+   }
+}
+
+} // namespace loadbalancing
+} // namespace hyteg
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/PrimitiveID.hpp"
+
+namespace hyteg {
+
+class PrimitiveStorage;
+
+namespace loadbalancing {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Runtime load balancing of a PrimitiveStorage based on the measured cost of the macro-primitives.
+///
+/// The cost of each local volume primitive (cell in 3D, face in 2D) is estimated from
+///
+///   - a cost model that returns the relative cost of a primitive (e.g. depending on the blending map,
+///     free-slip boundaries or the number of particles in it), uniform by default,
+///   - plus explicit counters that are accumulated via addCost() since the last rebalancing.
+///
+/// If a timer is set via setTimer(), the estimated costs on each process are scaled so that they sum up to the
+/// time that was measured by this timer of the storage's timing tree since the last rebalancing. Thus, the
+/// measured time determines the load of each process, while the cost model distributes it among the primitives.
+/// The timer must only measure computation: time spent waiting in communication is largest on the processes with
+/// the least work, so a timer around a whole time step (including halo exchanges and reductions) hides the imbalance.
+///
+/// If the load imbalance (max / avg load over all processes) exceeds the threshold, the primitives are redistributed
+/// with the weighted Hilbert curve balancer (loadbalancing::distributed::hilbertCurve()). Each part of the curve is
+/// assigned to the process that already owns most of it, so that only the primitives near the part boundaries are
+/// migrated once the distribution follows the curve.
+///
+/// All functions and operators that store their data as primitive data (FunctionMemory, stencils, ...) are migrated
+/// along with the primitives, and communicators are updated automatically. Data that is stored outside of the
+/// primitives (e.g. precomputed element matrices of elementwise operators) must be refreshed via a callback that
+/// is registered with addMigrationCallback().
+///
+/// Usage in a time loop:
+///
+///   DynamicLoadBalancer balancer( storage, 50 );
+///   balancer.setTimer( "Compute" );
+///   balancer.addMigrationCallback( [&]() { A.computeAndStoreLocalElementMatrices(); } );
+///
+///   for ( ... )
+///   {
+///      storage->getTimingTree()->start( "Compute" );
+///      ... // kernels only
+///      storage->getTimingTree()->stop( "Compute" );
+///      ... // communication
+///      balancer.step();
+///   }
+class DynamicLoadBalancer
+{
+ public:
+   /// \param storage            the PrimitiveStorage that is rebalanced
+   /// \param interval           the imbalance is checked every interval calls to step()
+   /// \param imbalanceThreshold the storage is rebalanced if max / avg load exceeds this value
+   DynamicLoadBalancer( const std::shared_ptr< PrimitiveStorage >& storage,
+                        const uint_t&                              interval,
+                        const real_t&                              imbalanceThreshold = 1.1 );
+
+   /// Sets the model that returns the relative cost of a local volume primitive.
+   void setCostModel( const std::function< real_t( const PrimitiveID& ) >& costModel ) { costModel_ = costModel; }
+
+   /// Sets the timer of the storage's timing tree that measures the work of this process.
+   /// Nested timers are separated by a dot.
+   ///
+   /// The timer must exclude communication (halo exchanges, reductions, ...), since processes with less work spend
+   /// more time waiting. Without a timer only the cost model and the counters determine the load.
+   void setTimer( const std::string& timerName );
+
+   /// Adds cost to a local volume primitive. The counters are reset after each rebalancing.
+   void addCost( const PrimitiveID& primitiveID, const real_t& cost );
+
+   /// Registers a function that is called on all processes after the primitives have been migrated.
+   void addMigrationCallback( const std::function< void() >& callback ) { migrationCallbacks_.push_back( callback ); }
+
+   /// To be called once per iteration of a time loop. Checks the imbalance every interval calls and rebalances if
+   /// required. Collective call. Returns true if the primitives were migrated.
+   bool step();
+
+   /// Checks the imbalance and rebalances if required (or if forced). Collective call.
+   /// Returns true if the primitives were migrated.
+   bool rebalance( const bool& force = false );
+
+   /// Returns the current load imbalance (max / avg load over all processes). Collective call.
+   real_t computeImbalance() const;
+
+   /// Number of rebalancings that have been performed.
+   uint_t getNumberOfMigrations() const { return numberOfMigrations_; }
+
+ private:
+   /// Returns the estimated cost of all local volume primitives.
+   std::map< PrimitiveID::IDType, real_t > estimateLocalCosts() const;
+
+   /// Returns the time that was measured by the timer since the last rebalancing.
+   real_t measuredTime() const;
+
+   void resetMeasurements();
+
+   std::shared_ptr< PrimitiveStorage > storage_;
+
+   uint_t interval_;
+   real_t imbalanceThreshold_;
+   uint_t stepCounter_;
+   uint_t numberOfMigrations_;
+
+   std::function< real_t( const PrimitiveID& ) > costModel_;
+   std::map< PrimitiveID::IDType, real_t >       costCounters_;
+
+   std::string timerName_;
+   real_t      timerTotalAtLastRebalancing_;
+
+   std::vector< std::function< void() > > migrationCallbacks_;
+};
+
+} // namespace loadbalancing
+} // namespace hyteg
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "hyteg/primitivestorage/loadbalancing/HilbertCurve.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <numeric>
+#include <tuple>
+
+#include "core/debug/CheckFunctions.h"
+
+namespace hyteg {
+namespace loadbalancing {
+
+using walberla::real_c;
+using walberla::uint64_c;
+
+uint64_t hilbertIndex( const Point3D& point,
+                       const Point3D& minCorner,
+                       const Point3D& maxCorner,
+                       const uint_t&  dimension,
+                       const uint_t&  bitsPerDimension )
+{
+   WALBERLA_ASSERT( dimension == 2 || dimension == 3 );
+   WALBERLA_ASSERT_GREATER( bitsPerDimension, 0 );
+   WALBERLA_ASSERT_LESS_EQUAL( dimension * bitsPerDimension, 64 );
+
+   const uint64_t numCells = uint64_c( 1 ) << bitsPerDimension;
+
+   // discretize the coordinates
+   std::array< uint64_t, 3 > x = {0, 0, 0};
+   for ( uint_t d = 0; d < dimension; d++ )
+   {
+      const real_t extent = maxCorner[d] - minCorner[d];
+      if ( extent <= real_c( 0 ) )
+      {
+         continue;
+      }
+      const real_t relative = ( point[d] - minCorner[d] ) / extent;
+      x[d] = std::min( uint64_t( std::max( relative, real_c( 0 ) ) * real_c( numCells ) ), numCells - 1 );
+   }
+
+   // Transform the coordinates to the transposed Hilbert index.
+   // See J. Skilling, Programming the Hilbert curve, AIP Conference Proceedings 707, 381 (2004).
+   const uint64_t m = uint64_c( 1 ) << ( bitsPerDimension - 1 );
+
+   for ( uint64_t q = m; q > 1; q >>= 1 )
+   {
+      const uint64_t p = q - 1;
+      for ( uint_t d = 0; d < dimension; d++ )
+      {
+         if ( x[d] & q )
+         {
+            // invert
+            x[0] ^= p;
+         }
+         else
+         {
+            // exchange
+            const uint64_t t = ( x[0] ^ x[d] ) & p;
+            x[0] ^= t;
+            x[d] ^= t;
+         }
+      }
+   }
+
+   // Gray encode
+   for ( uint_t d = 1; d < dimension; d++ )
+   {
+      x[d] ^= x[d - 1];
+   }
+   uint64_t t = 0;
+   for ( uint64_t q = m; q > 1; q >>= 1 )
+   {
+      if ( x[dimension - 1] & q )
+      {
+         t ^= q - 1;
+      }
+   }
+   for ( uint_t d = 0; d < dimension; d++ )
+   {
+      x[d] ^= t;
+   }
+
+   // interleave the bits of the transposed index
+   uint64_t index = 0;
+   for ( uint_t bit = bitsPerDimension; bit-- > 0; )
+   {
+      for ( uint_t d = 0; d < dimension; d++ )
+      {
+         index = ( index << 1 ) | ( ( x[d] >> bit ) & uint64_c( 1 ) );
+      }
+   }
+   return index;
+}
+
+std::vector< uint_t > hilbertCurvePartition( const std::vector< Point3D >&             points,
+                                             const std::vector< PrimitiveID::IDType >& ids,
+                                             const std::vector< real_t >&              weights,
+                                             const uint_t&                             dimension,
+                                             const uint_t&                             numParts )
+{
+   WALBERLA_CHECK_EQUAL( points.size(), ids.size() );
+   WALBERLA_CHECK_EQUAL( points.size(), weights.size() );
+   WALBERLA_CHECK_GREATER( numParts, 0 );
+
+   std::vector< uint_t > parts( points.size(), 0 );
+
+   if ( points.empty() )
+   {
+      return parts;
+   }
+
+   Point3D minCorner = points[0];
+   Point3D maxCorner = points[0];
+   for ( const auto& point : points )
+   {
+      for ( uint_t d = 0; d < 3; d++ )
+      {
+         minCorner[d] = std::min( minCorner[d], point[d] );
+         maxCorner[d] = std::max( maxCorner[d], point[d] );
+      }
+   }
+
+   std::vector< std::tuple< uint64_t, PrimitiveID::IDType, uint_t > > curve;
+   curve.reserve( points.size() );
+   for ( uint_t i = 0; i < points.size(); i++ )
+   {
+      WALBERLA_CHECK_GREATER_EQUAL( weights[i], real_c( 0 ), "Weights for the load balancing must be non-negative." );
+      curve.emplace_back( hilbertIndex( points[i], minCorner, maxCorner, dimension ), ids[i], i );
+   }
+   std::sort( curve.begin(), curve.end() );
+
+   real_t totalWeight = std::accumulate( weights.begin(), weights.end(), real_c( 0 ) );
+   const bool uniform = totalWeight <= real_c( 0 );
+   if ( uniform )
+   {
+      totalWeight = real_c( points.size() );
+   }
+
+   // each point is assigned to the chunk that contains the center of its weight interval along the curve
+   real_t prefixWeight = 0;
+   for ( const auto& it : curve )
+   {
+      const uint_t i      = std::get< 2 >( it );
+      const real_t weight = uniform ? real_c( 1 ) : weights[i];
+      const real_t center = prefixWeight + real_c( 0.5 ) * weight;
+      parts[i]            = std::min( uint_t( center / totalWeight * real_c( numParts ) ), numParts - 1 );
+      prefixWeight += weight;
+   }
+
+   return parts;
+}
+
+uint_t colocatedRank( const std::vector< uint_t >& adjacentVolumePrimitiveRanks, const PrimitiveID& primitiveID )
+{
+   WALBERLA_CHECK_GREATER( adjacentVolumePrimitiveRanks.size(),
+                           0,
+                           "Primitive " << primitiveID << " has no adjacent volume primitives." );
+
+   std::map< uint_t, uint_t > count;
+   for ( const auto& rank : adjacentVolumePrimitiveRanks )
+   {
+      count[rank]++;
+   }
+
+   uint_t maxCount = 0;
+   for ( const auto& it : count )
+   {
+      maxCount = std::max( maxCount, it.second );
+   }
+
+   std::vector< uint_t > candidates;
+   for ( const auto& it : count )
+   {
+      if ( it.second == maxCount )
+      {
+         candidates.push_back( it.first );
+      }
+   }
+
+   return candidates[uint_c( primitiveID.getID() % candidates.size() )];
+}
+
+} // namespace loadbalancing
+} // namespace hyteg
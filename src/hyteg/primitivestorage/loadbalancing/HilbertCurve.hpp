@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <vector>
+
+#include "core/DataTypes.h"
+
+#include "hyteg/PrimitiveID.hpp"
+#include "hyteg/types/pointnd.hpp"
+
+namespace hyteg {
+namespace loadbalancing {
+
+using walberla::real_t;
+using walberla::uint64_t;
+using walberla::uint_t;
+
+/// \brief Returns the position of a point along the Hilbert space-filling curve that fills the specified bounding box.
+///
+/// The box is discretized with 2^bitsPerDimension cells in each direction.
+/// If dimension == 2, the z-coordinate is ignored and a two-dimensional curve is used.
+uint64_t hilbertIndex( const Point3D& point,
+                       const Point3D& minCorner,
+                       const Point3D& maxCorner,
+                       const uint_t&  dimension,
+                       const uint_t&  bitsPerDimension = 16 );
+
+/// \brief Sorts the passed points along a Hilbert curve and splits the curve into contiguous chunks of approximately equal weight.
+///
+/// The curve fills the bounding box of the passed points. Points that are located in the same cell of the curve
+/// are sorted by their ID, so that the result does not depend on the order of the input.
+///
+/// \param points    points to partition (typically the centroids of the macro-primitives)
+/// \param ids       unique IDs of the points
+/// \param weights   non-negative weights of the points
+/// \param dimension 2 or 3
+/// \param numParts  number of chunks
+/// \return the chunk index in [0, numParts) for each point
+std::vector< uint_t > hilbertCurvePartition( const std::vector< Point3D >&             points,
+                                             const std::vector< PrimitiveID::IDType >& ids,
+                                             const std::vector< real_t >&              weights,
+                                             const uint_t&                             dimension,
+                                             const uint_t&                             numParts );
+
+/// \brief Selects the process of a lower-dimensional primitive from the processes of its adjacent volume primitives.
+///
+/// Returns the process that carries most of the adjacent volume primitives. Ties are resolved via the PrimitiveID
+/// to spread the interface primitives evenly among the involved processes.
+uint_t colocatedRank( const std::vector< uint_t >& adjacentVolumePrimitiveRanks, const PrimitiveID& primitiveID );
+
+} // namespace loadbalancing
+} // namespace hyteg
@@ -22,6 +22,7 @@
 
 #include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
 #include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+#include "hyteg/primitivestorage/loadbalancing/HilbertCurve.hpp"
 
 #include <queue>
 
@@ -171,5 +172,81 @@ void greedy( SetupPrimitiveStorage & storage )
 }
 
 
+void hilbertCurve( SetupPrimitiveStorage & storage )
+{
+  hilbertCurve( storage, []( const PrimitiveID & ) { return real_t( 1 ); } );
+}
+
+
+void hilbertCurve( SetupPrimitiveStorage & storage, const std::function< real_t( const PrimitiveID & ) > & weight )
+{
+  const bool   is3D      = storage.getNumberOfCells() > 0;
+  const uint_t dimension = is3D ? 3 : 2;
+
+  // Partition the volume primitives along the curve
+  std::vector< Point3D >             centroids;
+  std::vector< PrimitiveID::IDType > volumePrimitiveIDs;
+  std::vector< real_t >              weights;
+
+  if ( is3D )
+  {
+    for ( const auto & it : storage.getCells() )
+    {
+      const auto & coordinates = it.second->getCoordinates();
+      centroids.push_back( 0.25 * ( coordinates[0] + coordinates[1] + coordinates[2] + coordinates[3] ) );
+      volumePrimitiveIDs.push_back( it.first );
+      weights.push_back( weight( PrimitiveID( it.first ) ) );
+    }
+  }
+  else
+  {
+    for ( const auto & it : storage.getFaces() )
+    {
+      const auto & coordinates = it.second->getCoordinates();
+      centroids.push_back( ( 1.0 / 3.0 ) * ( coordinates[0] + coordinates[1] + coordinates[2] ) );
+      volumePrimitiveIDs.push_back( it.first );
+      weights.push_back( weight( PrimitiveID( it.first ) ) );
+    }
+  }
+
+  const auto parts = hilbertCurvePartition( centroids, volumePrimitiveIDs, weights, dimension, storage.getNumberOfProcesses() );
+
+  for ( uint_t i = 0; i < volumePrimitiveIDs.size(); i++ )
+  {
+    storage.setTargetRank( volumePrimitiveIDs[i], parts[i] );
+  }
+
+  // Co-locate the lower-dimensional primitives with their adjacent volume primitives
+  SetupPrimitiveStorage::PrimitiveMap setupPrimitives;
+  storage.getSetupPrimitives( setupPrimitives );
+
+  for ( const auto & it : setupPrimitives )
+  {
+    if ( ( is3D && storage.cellExists( it.first ) ) || ( !is3D && storage.faceExists( it.first ) ) )
+    {
+      continue;
+    }
+
+    std::vector< PrimitiveID > adjacentVolumePrimitives;
+    if ( is3D )
+    {
+      it.second->getNeighborCells( adjacentVolumePrimitives );
+    }
+    else
+    {
+      it.second->getNeighborFaces( adjacentVolumePrimitives );
+    }
+
+    std::vector< uint_t > adjacentRanks;
+    for ( const auto & adjacentID : adjacentVolumePrimitives )
+    {
+      adjacentRanks.push_back( storage.getTargetRank( adjacentID ) );
+    }
+
+    storage.setTargetRank( it.first, colocatedRank( adjacentRanks, it.first ) );
+  }
+}
+
+
 } // namespace loadbalancing
 } // namespace hyteg
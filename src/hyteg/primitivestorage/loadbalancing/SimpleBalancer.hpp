@@ -20,11 +20,19 @@
 
 #pragma once
 
+#include <functional>
+
 #include "core/DataTypes.h"
 
+#include "hyteg/PrimitiveID.hpp"
+
 namespace hyteg {
+
+class SetupPrimitiveStorage;
+
 namespace loadbalancing {
 
+using walberla::real_t;
 using walberla::uint_t;
 
 /// \brief Load balancing function for \ref SetupPrimitiveStorage that locates all primitives on a certain rank
@@ -44,5 +52,21 @@ void roundRobin( SetupPrimitiveStorage & storage );
 void greedy( SetupPrimitiveStorage & storage );
 
 
+/// \brief Load balancing function for \ref SetupPrimitiveStorage that distributes the primitives along a Hilbert space-filling curve.
+///
+/// The volume primitives (cells in 3D, faces in 2D) are sorted by the Hilbert index of their centroids and distributed
+/// in contiguous chunks of equal weight. Each lower-dimensional primitive is located on the process that carries most
+/// of its adjacent volume primitives. This results in compact subdomains with a low edge-cut and few neighbor processes.
+void hilbertCurve( SetupPrimitiveStorage & storage );
+
+
+/// \brief Same as hilbertCurve( SetupPrimitiveStorage & ) but with individual weights of the volume primitives.
+///
+/// \param weight returns the (non-negative) weight of a volume primitive, e.g. the number of DoFs or the measured
+///               compute time; the cost of the lower-dimensional primitives should be included in the weights of the
+///               adjacent volume primitives
+void hilbertCurve( SetupPrimitiveStorage & storage, const std::function< real_t( const PrimitiveID & ) > & weight );
+
+
 } // namespace loadbalancing
 } // namespace hyteg
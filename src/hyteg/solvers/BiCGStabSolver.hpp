@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "core/Abort.h"
+#include "core/timing/TimingTree.h"
+
+#include "hyteg/FunctionReductions.hpp"
+#include "hyteg/solvers/Solver.hpp"
+#include "hyteg/solvers/preconditioners/IdentityPreconditioner.hpp"
+
+namespace hyteg {
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Right-preconditioned BiCGStab method for non-symmetric operators.
+///
+/// The algorithm is taken from: van der Vorst: "Bi-CGSTAB: A fast and smoothly converging variant of Bi-CG for the
+/// solution of nonsymmetric linear systems", SIAM J. Sci. Stat. Comput. 13(2), 1992.
+///
+/// The scalar products are grouped so that each iteration requires three global reductions
+/// (including the residual norms for the stopping criterion).
+///
+/// The preconditioner is applied to a zero initial guess. BiCGStab is not a flexible method, so a preconditioner
+/// that changes between the iterations (e.g. an inner Krylov solver) may slow down the convergence. In that case
+/// the FGMRESSolver should be preferred.
+template < class OperatorType >
+class BiCGStabSolver : public Solver< OperatorType >
+{
+ public:
+   typedef typename OperatorType::srcType FunctionType;
+
+   BiCGStabSolver(
+       const std::shared_ptr< PrimitiveStorage >& storage,
+       uint_t                                     minLevel,
+       uint_t                                     maxLevel,
+       uint_t                                     maxIter        = std::numeric_limits< uint_t >::max(),
+       real_t                                     tolerance      = 1e-16,
+       std::shared_ptr< Solver< OperatorType > >  preconditioner = std::make_shared< IdentityPreconditioner< OperatorType > >() )
+   : r_( "r", storage, minLevel, maxLevel )
+   , rHat_( "rHat", storage, minLevel, maxLevel )
+   , p_( "p", storage, minLevel, maxLevel )
+   , pHat_( "pHat", storage, minLevel, maxLevel )
+   , v_( "v", storage, minLevel, maxLevel )
+   , s_( "s", storage, minLevel, maxLevel )
+   , sHat_( "sHat", storage, minLevel, maxLevel )
+   , t_( "t", storage, minLevel, maxLevel )
+   , preconditioner_( preconditioner )
+   , flag_( hyteg::Inner | hyteg::NeumannBoundary | hyteg::FreeslipBoundary )
+   , printInfo_( false )
+   , tolerance_( tolerance )
+   , maxIter_( maxIter )
+   , timingTree_( storage->getTimingTree() )
+   {
+      if ( !std::is_same< FunctionType, typename OperatorType::dstType >::value )
+      {
+         WALBERLA_ABORT( "BiCGStabSolver does not work for Operator with different src and dst FunctionTypes" );
+      }
+   }
+
+   void solve( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) override
+   {
+      if ( maxIter_ == 0 )
+         return;
+
+      if ( x.isDummy() || b.isDummy() )
+         return;
+
+      timingTree_->start( "BiCGStab Solver" );
+
+      r_.copyBoundaryConditionFromFunction( x );
+      rHat_.copyBoundaryConditionFromFunction( x );
+      p_.copyBoundaryConditionFromFunction( x );
+      pHat_.copyBoundaryConditionFromFunction( x );
+      v_.copyBoundaryConditionFromFunction( x );
+      s_.copyBoundaryConditionFromFunction( x );
+      sHat_.copyBoundaryConditionFromFunction( x );
+      t_.copyBoundaryConditionFromFunction( x );
+
+      // r = b - Ax, rHat = r
+      A.apply( x, v_, level, flag_, Replace );
+      r_.assign( {1.0, -1.0}, {b, v_}, level, flag_ );
+      rHat_.assign( {1.0}, {r_}, level, flag_ );
+      p_.interpolate( real_c( 0 ), level, All );
+      v_.interpolate( real_c( 0 ), level, All );
+
+      real_t rhoOld = 1;
+      real_t alpha  = 1;
+      real_t omega  = 1;
+
+      for ( uint_t i = 0; i < maxIter_; ++i )
+      {
+         // rho = (rHat, r), (r, r) for the stopping criterion
+         const auto   rhoAndResidual = dotGlobal< FunctionType >( {rHat_, r_}, {r_, r_}, level, flag_ );
+         const real_t rho            = rhoAndResidual[0];
+         const real_t residualNorm   = std::sqrt( rhoAndResidual[1] );
+
+         if ( printInfo_ )
+         {
+            WALBERLA_LOG_INFO_ON_ROOT( "[BiCGStab] residual: " << residualNorm );
+         }
+
+         if ( residualNorm < tolerance_ )
+         {
+            if ( printInfo_ )
+            {
+               WALBERLA_LOG_INFO_ON_ROOT( "[BiCGStab] converged after " << i << " iterations" );
+            }
+            break;
+         }
+
+         if ( std::abs( rho ) < std::numeric_limits< real_t >::min() )
+         {
+            WALBERLA_LOG_WARNING_ON_ROOT( "[BiCGStab] breakdown: (rHat, r) = 0" );
+            break;
+         }
+
+         // p = r + beta (p - omega v)
+         const real_t beta = ( rho / rhoOld ) * ( alpha / omega );
+         p_.assign( {1.0, beta, -beta * omega}, {r_, p_, v_}, level, flag_ );
+
+         // v = A M^{-1} p
+         precondition( A, pHat_, p_, level );
+         A.apply( pHat_, v_, level, flag_, Replace );
+
+         alpha = rho / rHat_.dotGlobal( v_, level, flag_ );
+
+         // s = r - alpha v
+         s_.assign( {1.0, -alpha}, {r_, v_}, level, flag_ );
+
+         // t = A M^{-1} s
+         precondition( A, sHat_, s_, level );
+         A.apply( sHat_, t_, level, flag_, Replace );
+
+         // omega = (t, s) / (t, t)
+         const auto omegaProducts = dotGlobal< FunctionType >( {t_, t_}, {s_, t_}, level, flag_ );
+         omega                    = omegaProducts[1] > 0 ? omegaProducts[0] / omegaProducts[1] : real_c( 0 );
+
+         // x = x + alpha M^{-1} p + omega M^{-1} s
+         x.add( {alpha, omega}, {pHat_, sHat_}, level, flag_ );
+
+         // r = s - omega t
+         r_.assign( {1.0, -omega}, {s_, t_}, level, flag_ );
+
+         if ( std::abs( omega ) < std::numeric_limits< real_t >::min() )
+         {
+            WALBERLA_LOG_WARNING_ON_ROOT( "[BiCGStab] breakdown: omega = 0" );
+            break;
+         }
+
+         rhoOld = rho;
+      }
+
+      timingTree_->stop( "BiCGStab Solver" );
+   }
+
+   void setPrintInfo( bool printInfo ) { printInfo_ = printInfo; }
+
+ private:
+   void precondition( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) const
+   {
+      timingTree_->start( "Preconditioner" );
+      x.interpolate( real_c( 0 ), level, All );
+      preconditioner_->solve( A, x, b, level );
+      timingTree_->stop( "Preconditioner" );
+   }
+
+   FunctionType r_;
+   FunctionType rHat_;
+   FunctionType p_;
+   FunctionType pHat_;
+   FunctionType v_;
+   FunctionType s_;
+   FunctionType sHat_;
+   FunctionType t_;
+
+   std::shared_ptr< Solver< OperatorType > > preconditioner_;
+
+   hyteg::DoFType flag_;
+   bool           printInfo_;
+   real_t         tolerance_;
+   uint_t         maxIter_;
+
+   std::shared_ptr< walberla::WcTimingTree > timingTree_;
+};
+
+} // namespace hyteg
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "core/Abort.h"
+#include "core/timing/TimingTree.h"
+
+#include "hyteg/FunctionReductions.hpp"
+#include "hyteg/solvers/Solver.hpp"
+#include "hyteg/solvers/preconditioners/IdentityPreconditioner.hpp"
+
+namespace hyteg {
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Restarted flexible GMRES method FGMRES(m) for non-symmetric operators.
+///
+/// The algorithm is taken from: Saad: "A flexible inner-outer preconditioned GMRES algorithm",
+/// SIAM J. Sci. Comput. 14(2), 1993. The preconditioned vectors are stored, so the preconditioner may change in
+/// every iteration (e.g. a multigrid cycle or an inner Krylov solver with a fixed number of iterations).
+/// The preconditioner is applied to a zero initial guess.
+///
+/// The Arnoldi vectors are orthogonalized with classical Gram-Schmidt and one reorthogonalization (CGS2).
+/// All scalar products of each of the two passes are computed with a single global reduction, and the norm of the
+/// new Arnoldi vector is computed within the second reduction. Therefore, each iteration requires two reductions
+/// independent of the restart length.
+///
+/// The residual norm is taken from the least-squares problem and the true residual is recomputed on each restart.
+template < class OperatorType >
+class FGMRESSolver : public Solver< OperatorType >
+{
+ public:
+   typedef typename OperatorType::srcType FunctionType;
+
+   FGMRESSolver(
+       const std::shared_ptr< PrimitiveStorage >& storage,
+       uint_t                                     minLevel,
+       uint_t                                     maxLevel,
+       uint_t                                     restartLength  = 30,
+       uint_t                                     maxIter        = std::numeric_limits< uint_t >::max(),
+       real_t                                     tolerance      = 1e-16,
+       std::shared_ptr< Solver< OperatorType > >  preconditioner = std::make_shared< IdentityPreconditioner< OperatorType > >() )
+   : w_( "w", storage, minLevel, maxLevel )
+   , preconditioner_( preconditioner )
+   , flag_( hyteg::Inner | hyteg::NeumannBoundary | hyteg::FreeslipBoundary )
+   , printInfo_( false )
+   , restartLength_( restartLength )
+   , tolerance_( tolerance )
+   , maxIter_( maxIter )
+   , timingTree_( storage->getTimingTree() )
+   {
+      if ( !std::is_same< FunctionType, typename OperatorType::dstType >::value )
+      {
+         WALBERLA_ABORT( "FGMRESSolver does not work for Operator with different src and dst FunctionTypes" );
+      }
+      WALBERLA_CHECK_GREATER( restartLength_, 0, "FGMRESSolver: the restart length must be positive." );
+
+      for ( uint_t i = 0; i < restartLength_ + 1; i++ )
+      {
+         V_.push_back( FunctionType( "v_" + std::to_string( i ), storage, minLevel, maxLevel ) );
+      }
+      for ( uint_t i = 0; i < restartLength_; i++ )
+      {
+         Z_.push_back( FunctionType( "z_" + std::to_string( i ), storage, minLevel, maxLevel ) );
+      }
+   }
+
+   void solve( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) override
+   {
+      if ( maxIter_ == 0 )
+         return;
+
+      if ( x.isDummy() || b.isDummy() )
+         return;
+
+      timingTree_->start( "FGMRES Solver" );
+
+      w_.copyBoundaryConditionFromFunction( x );
+      for ( uint_t i = 0; i < V_.size(); i++ )
+      {
+         V_[i].copyBoundaryConditionFromFunction( x );
+      }
+      for ( uint_t i = 0; i < Z_.size(); i++ )
+      {
+         Z_[i].copyBoundaryConditionFromFunction( x );
+      }
+
+      // Hessenberg matrix (column-wise, transformed to upper triangular form by Givens rotations)
+      std::vector< std::vector< real_t > > H( restartLength_, std::vector< real_t >( restartLength_ + 1 ) );
+      std::vector< real_t >                cs( restartLength_ );
+      std::vector< real_t >                sn( restartLength_ );
+      std::vector< real_t >                g( restartLength_ + 1 );
+
+      uint_t iter      = 0;
+      bool   converged = false;
+
+      while ( !converged )
+      {
+         // v_0 = r / ||r||, r = b - Ax
+         A.apply( x, w_, level, flag_, Replace );
+         V_[0].assign( {1.0, -1.0}, {b, w_}, level, flag_ );
+         const real_t beta = std::sqrt( V_[0].dotGlobal( V_[0], level, flag_ ) );
+
+         if ( printInfo_ )
+         {
+            WALBERLA_LOG_INFO_ON_ROOT( "[FGMRES] residual: " << beta );
+         }
+
+         if ( beta < tolerance_ )
+         {
+            converged = true;
+            break;
+         }
+
+         if ( iter >= maxIter_ )
+         {
+            break;
+         }
+
+         V_[0].assign( {1.0 / beta}, {V_[0]}, level, flag_ );
+         std::fill( g.begin(), g.end(), real_c( 0 ) );
+         g[0] = beta;
+
+         uint_t k = 0;
+         while ( k < restartLength_ && iter < maxIter_ )
+         {
+            // z_k = M_k^{-1} v_k, w = A z_k
+            timingTree_->start( "Preconditioner" );
+            Z_[k].interpolate( real_c( 0 ), level, All );
+            preconditioner_->solve( A, Z_[k], V_[k], level );
+            timingTree_->stop( "Preconditioner" );
+            A.apply( Z_[k], w_, level, flag_, Replace );
+
+            const bool breakdown = orthogonalize( k, level, H[k] );
+
+            // apply the previous rotations to the new column and eliminate H(k+1, k)
+            for ( uint_t i = 0; i < k; i++ )
+            {
+               const real_t tmp = cs[i] * H[k][i] + sn[i] * H[k][i + 1];
+               H[k][i + 1]      = -sn[i] * H[k][i] + cs[i] * H[k][i + 1];
+               H[k][i]          = tmp;
+            }
+            const real_t r = std::sqrt( H[k][k] * H[k][k] + H[k][k + 1] * H[k][k + 1] );
+            cs[k]          = H[k][k] / r;
+            sn[k]          = H[k][k + 1] / r;
+            H[k][k]        = r;
+            H[k][k + 1]    = 0;
+            g[k + 1]       = -sn[k] * g[k];
+            g[k]           = cs[k] * g[k];
+
+            k++;
+            iter++;
+
+            const real_t residual = std::abs( g[k] );
+            if ( printInfo_ )
+            {
+               WALBERLA_LOG_INFO_ON_ROOT( "[FGMRES] residual (estimated): " << residual );
+            }
+
+            if ( residual < tolerance_ || breakdown )
+            {
+               converged = true;
+               break;
+            }
+         }
+
+         updateSolution( x, H, g, k, level );
+
+         if ( converged && printInfo_ )
+         {
+            WALBERLA_LOG_INFO_ON_ROOT( "[FGMRES] converged after " << iter << " iterations" );
+         }
+      }
+
+      timingTree_->stop( "FGMRES Solver" );
+   }
+
+   void setPrintInfo( bool printInfo ) { printInfo_ = printInfo; }
+
+ private:
+   /// Orthogonalizes w against v_0, ..., v_k with two passes of classical Gram-Schmidt, stores the coefficients
+   /// in h and normalizes w to v_{k+1}. Returns true if w lies in the span of v_0, ..., v_k (lucky breakdown).
+   bool orthogonalize( const uint_t& k, const uint_t& level, std::vector< real_t >& h )
+   {
+      timingTree_->start( "Orthogonalization" );
+
+      std::vector< std::reference_wrapper< const FunctionType > > basis;
+      for ( uint_t i = 0; i < k + 1; i++ )
+      {
+         basis.push_back( V_[i] );
+      }
+      std::vector< std::reference_wrapper< const FunctionType > > lhs( basis );
+      std::vector< std::reference_wrapper< const FunctionType > > rhs( k + 1, std::cref( w_ ) );
+
+      // first pass, ||w||^2 is used to detect the breakdown
+      lhs.push_back( w_ );
+      rhs.push_back( w_ );
+      std::vector< real_t > coefficients = dotGlobal< FunctionType >( lhs, rhs, level, flag_ );
+      const real_t          normWSquared = coefficients.back();
+      coefficients.pop_back();
+      subtract( coefficients, basis, level );
+      for ( uint_t i = 0; i < k + 1; i++ )
+      {
+         h[i] = coefficients[i];
+      }
+
+      // second pass, the norm of the orthogonalized vector is computed in the same reduction via
+      // ||w - V c||^2 = ||w||^2 - ||c||^2 (V has orthonormal columns)
+      coefficients       = dotGlobal< FunctionType >( lhs, rhs, level, flag_ );
+      real_t normSquared = coefficients.back();
+      coefficients.pop_back();
+      subtract( coefficients, basis, level );
+      for ( uint_t i = 0; i < k + 1; i++ )
+      {
+         h[i] += coefficients[i];
+         normSquared -= coefficients[i] * coefficients[i];
+      }
+
+      // cancellation, compute the norm explicitly
+      if ( normSquared <= 1e-8 * normWSquared )
+      {
+         normSquared = w_.dotGlobal( w_, level, flag_ );
+      }
+
+      const real_t norm      = std::sqrt( std::max( normSquared, real_c( 0 ) ) );
+      const bool   breakdown = norm <= 1e-14 * std::sqrt( normWSquared );
+      h[k + 1]               = breakdown ? real_c( 0 ) : norm;
+      if ( !breakdown )
+      {
+         V_[k + 1].assign( {1.0 / norm}, {w_}, level, flag_ );
+      }
+
+      timingTree_->stop( "Orthogonalization" );
+      return breakdown;
+   }
+
+   /// w = w - sum_i c_i v_i
+   void subtract( const std::vector< real_t >&                                       coefficients,
+                  const std::vector< std::reference_wrapper< const FunctionType > >& basis,
+                  const uint_t&                                                      level ) const
+   {
+      std::vector< real_t >                                       scalars( 1, real_c( 1 ) );
+      std::vector< std::reference_wrapper< const FunctionType > > functions( 1, std::cref( w_ ) );
+      for ( uint_t i = 0; i < coefficients.size(); i++ )
+      {
+         scalars.push_back( -coefficients[i] );
+         functions.push_back( basis[i] );
+      }
+      w_.assign( scalars, functions, level, flag_ );
+   }
+
+   /// Solves the upper triangular system H y = g and updates x = x + Z y.
+   void updateSolution( const FunctionType&                         x,
+                        const std::vector< std::vector< real_t > >& H,
+                        const std::vector< real_t >&                g,
+                        const uint_t&                               k,
+                        const uint_t&                               level ) const
+   {
+      if ( k == 0 )
+      {
+         return;
+      }
+
+      std::vector< real_t > y( k );
+      for ( uint_t ii = k; ii > 0; ii-- )
+      {
+         const uint_t i = ii - 1;
+         y[i]           = g[i];
+         for ( uint_t j = i + 1; j < k; j++ )
+         {
+            y[i] -= H[j][i] * y[j];
+         }
+         y[i] /= H[i][i];
+      }
+
+      std::vector< std::reference_wrapper< const FunctionType > > functions;
+      for ( uint_t i = 0; i < k; i++ )
+      {
+         functions.push_back( Z_[i] );
+      }
+      x.add( y, functions, level, flag_ );
+   }
+
+   FunctionType                w_;
+   std::vector< FunctionType > V_;
+   std::vector< FunctionType > Z_;
+
+   std::shared_ptr< Solver< OperatorType > > preconditioner_;
+
+   hyteg::DoFType flag_;
+   bool           printInfo_;
+   uint_t         restartLength_;
+   real_t         tolerance_;
+   uint_t         maxIter_;
+
+   std::shared_ptr< walberla::WcTimingTree > timingTree_;
+};
+
+} // namespace hyteg
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "core/Abort.h"
+#include "core/DataTypes.h"
+
+#include "hyteg/HytegDefinitions.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticRestriction.hpp"
+#include "hyteg/gridtransferoperators/RestrictionOperator.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/types/flags.hpp"
+
+namespace hyteg {
+
+/// \brief Computes the residual r = b - Ax and restricts it to the next coarser level in a single pass.
+///
+/// This is the generic implementation that signals that no fused kernel is available for the operator type.
+/// The specializations below connect the constant stencil operators to the fused kernels of the matching
+/// restriction operators.
+///
+/// The result is the same as computing the residual into \p tmp on level sourceLevel and restricting it,
+/// i.e. the restricted residual is written to \p tmp on level sourceLevel - 1.
+template < typename OperatorType >
+class FusedResidualRestriction
+{
+ public:
+   typedef typename OperatorType::srcType FunctionType;
+
+   /// Returns true if a fused kernel is available for the passed operator and restriction.
+   static bool isAvailable( const OperatorType& A, const RestrictionOperator< FunctionType >& restriction )
+   {
+      WALBERLA_UNUSED( A );
+      WALBERLA_UNUSED( restriction );
+      return false;
+   }
+
+   static void computeAndRestrictResidual( const OperatorType&                         A,
+                                           const RestrictionOperator< FunctionType >& restriction,
+                                           const FunctionType&                         x,
+                                           const FunctionType&                         b,
+                                           const FunctionType&                         tmp,
+                                           const walberla::uint_t&                     sourceLevel,
+                                           const DoFType&                              flag )
+   {
+      WALBERLA_UNUSED( A );
+      WALBERLA_UNUSED( restriction );
+      WALBERLA_UNUSED( x );
+      WALBERLA_UNUSED( b );
+      WALBERLA_UNUSED( tmp );
+      WALBERLA_UNUSED( sourceLevel );
+      WALBERLA_UNUSED( flag );
+      WALBERLA_ABORT( "Fused residual computation and restriction not available for this operator." );
+   }
+};
+
+/// Constant P1 stencils with linear restriction.
+///
+/// In 3D the fused kernel scales the residual like the generated restriction kernel, so it is only used if the
+/// generated kernels are enabled.
+template < class P1Form >
+class FusedResidualRestriction< P1ConstantOperator< P1Form, false, false, false > >
+{
+ public:
+   typedef P1ConstantOperator< P1Form, false, false, false > OperatorType;
+   typedef P1Function< real_t >                                FunctionType;
+
+   static bool isAvailable( const OperatorType& A, const RestrictionOperator< FunctionType >& restriction )
+   {
+      if ( A.getStorage()->hasGlobalCells() && !globalDefines::useGeneratedKernels )
+      {
+         return false;
+      }
+      return dynamic_cast< const P1toP1LinearRestriction* >( &restriction ) != nullptr;
+   }
+
+   static void computeAndRestrictResidual( const OperatorType&                         A,
+                                           const RestrictionOperator< FunctionType >& restriction,
+                                           const FunctionType&                         x,
+                                           const FunctionType&                         b,
+                                           const FunctionType&                         tmp,
+                                           const uint_t&                               sourceLevel,
+                                           const DoFType&                              flag )
+   {
+      WALBERLA_ASSERT( isAvailable( A, restriction ) );
+      const auto& p1Restriction = dynamic_cast< const P1toP1LinearRestriction& >( restriction );
+      p1Restriction.computeAndRestrictResidual( A.getVertexStencilID(),
+                                                A.getEdgeStencilID(),
+                                                A.getFaceStencilID(),
+                                                A.getFaceStencil3DID(),
+                                                A.getCellStencilID(),
+                                                x,
+                                                b,
+                                                tmp,
+                                                sourceLevel,
+                                                flag );
+   }
+};
+
+/// Constant P2 stencils with quadratic restriction.
+///
+/// The operator is applied as usual, the fused kernel then forms the residual and restricts it macro-primitive
+/// by macro-primitive instead of sweeping over the fine grid twice.
+template < class P2Form >
+class FusedResidualRestriction< P2ConstantOperator< P2Form > >
+{
+ public:
+   typedef P2ConstantOperator< P2Form > OperatorType;
+   typedef P2Function< real_t >         FunctionType;
+
+   static bool isAvailable( const OperatorType& A, const RestrictionOperator< FunctionType >& restriction )
+   {
+      WALBERLA_UNUSED( A );
+      return dynamic_cast< const P2toP2QuadraticRestriction* >( &restriction ) != nullptr;
+   }
+
+   static void computeAndRestrictResidual( const OperatorType&                         A,
+                                           const RestrictionOperator< FunctionType >& restriction,
+                                           const FunctionType&                         x,
+                                           const FunctionType&                         b,
+                                           const FunctionType&                         tmp,
+                                           const uint_t&                               sourceLevel,
+                                           const DoFType&                              flag )
+   {
+      WALBERLA_ASSERT( isAvailable( A, restriction ) );
+      const auto& p2Restriction = dynamic_cast< const P2toP2QuadraticRestriction& >( restriction );
+      A.apply( x, tmp, sourceLevel, flag, Replace );
+      p2Restriction.computeAndRestrictResidual( b, tmp, sourceLevel, flag );
+   }
+};
+
+} // namespace hyteg
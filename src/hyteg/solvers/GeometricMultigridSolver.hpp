@@ -22,9 +22,11 @@
 #include "core/DataTypes.h"
 #include "core/timing/TimingTree.h"
 
+#include "hyteg/KernelInstrumentation.hpp"
 #include "hyteg/gridtransferoperators/ProlongationOperator.hpp"
 #include "hyteg/gridtransferoperators/RestrictionOperator.hpp"
 #include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/solvers/FusedResidualRestriction.hpp"
 #include "hyteg/solvers/Solver.hpp"
 #include "hyteg/types/pointnd.hpp"
 
@@ -113,6 +115,7 @@ class GeometricMultigridSolver : public Solver< OperatorType >
    , timingTree_( storage->getTimingTree() )
    , constantRHS_( constantRHS )
    , constantRHSScalar_( constantRHSScalar )
+   , fusedResidualRestriction_( true )
    {}
 
    ~GeometricMultigridSolver() = default;
@@ -124,6 +127,11 @@ class GeometricMultigridSolver : public Solver< OperatorType >
       smoothIncrement_ = smoothIncrement;
    }
 
+   /// If enabled, the residual computation and the restriction are performed in a single pass
+   /// whenever a fused kernel is available for the pair of operator and restriction operator
+   /// (see FusedResidualRestriction). Enabled by default, the result is the same as with separate passes.
+   void setFusedResidualRestriction( bool fusedResidualRestriction ) { fusedResidualRestriction_ = fusedResidualRestriction; }
+
    void solve( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) override
    {
       timingTree_->start( "Geometric Multigrid Solver" );
@@ -156,7 +164,7 @@ class GeometricMultigridSolver : public Solver< OperatorType >
          const uint_t preSmoothingSteps = preSmoothSteps_ + smoothIncrement_ * ( invokedLevel_ - level );
          for ( uint_t i = 0; i < preSmoothingSteps; ++i )
          {
-            timingTree_->start( "Smoother" );
+            startInstrumentedRegion( *timingTree_, "Smoother", level );
             if ( constantRHS_ && level == invokedLevel_ )
             {
                smoother_->solve( A, x, tmp_, level );
@@ -166,7 +174,7 @@ class GeometricMultigridSolver : public Solver< OperatorType >
                smoother_->solve( A, x, b, level );
             }
 
-            timingTree_->stop( "Smoother" );
+            stopInstrumentedRegion( *timingTree_, "Smoother", level );
          }
 
          if ( constantRHS_ && level == invokedLevel_ )
@@ -176,9 +184,17 @@ class GeometricMultigridSolver : public Solver< OperatorType >
             tmp_.add( constantRHSScalar_, level, flag_ );
 
             // restrict
-            timingTree_->start( "Restriction" );
+            startInstrumentedRegion( *timingTree_, "Restriction", level );
             restrictionOperator_->restrict( tmp_, level, flag_ );
-            timingTree_->stop( "Restriction" );
+            stopInstrumentedRegion( *timingTree_, "Restriction", level );
+         }
+         else if ( fusedResidualRestriction_ &&
+                   FusedResidualRestriction< OperatorType >::isAvailable( A, *restrictionOperator_ ) )
+         {
+            startInstrumentedRegion( *timingTree_, "Fused Residual and Restriction", level );
+            FusedResidualRestriction< OperatorType >::computeAndRestrictResidual(
+                A, *restrictionOperator_, x, b, tmp_, level, flag_ );
+            stopInstrumentedRegion( *timingTree_, "Fused Residual and Restriction", level );
          }
          else
          {
@@ -186,9 +202,9 @@ class GeometricMultigridSolver : public Solver< OperatorType >
             tmp_.assign( {1.0, -1.0}, {b, tmp_}, level, flag_ );
 
             // restrict
-            timingTree_->start( "Restriction" );
+            startInstrumentedRegion( *timingTree_, "Restriction", level );
             restrictionOperator_->restrict( tmp_, level, flag_ );
-            timingTree_->stop( "Restriction" );
+            stopInstrumentedRegion( *timingTree_, "Restriction", level );
          }
 
          b.assign( {1.0}, {tmp_}, level - 1, flag_ );
@@ -205,9 +221,9 @@ class GeometricMultigridSolver : public Solver< OperatorType >
          timingTree_->start( "Level " + std::to_string( level ) );
 
          // prolongate
-         timingTree_->start( "Prolongation" );
+         startInstrumentedRegion( *timingTree_, "Prolongation", level );
          prolongationOperator_->prolongateAndAdd( x, level - 1, flag_ );
-         timingTree_->stop( "Prolongation" );
+         stopInstrumentedRegion( *timingTree_, "Prolongation", level );
 
          if ( constantRHS_ && level == invokedLevel_ )
          {
@@ -218,7 +234,7 @@ class GeometricMultigridSolver : public Solver< OperatorType >
          const uint_t postSmoothingSteps = postSmoothSteps_ + smoothIncrement_ * ( invokedLevel_ - level );
          for ( uint_t i = 0; i < postSmoothingSteps; ++i )
          {
-            timingTree_->start( "Smoother" );
+            startInstrumentedRegion( *timingTree_, "Smoother", level );
             if ( constantRHS_ && level == invokedLevel_ )
             {
                smoother_->solve( A, x, tmp_, level );
@@ -227,7 +243,7 @@ class GeometricMultigridSolver : public Solver< OperatorType >
             {
                smoother_->solve( A, x, b, level );
             }
-            timingTree_->stop( "Smoother" );
+            stopInstrumentedRegion( *timingTree_, "Smoother", level );
          }
 
          timingTree_->stop( "Level " + std::to_string( level ) );
@@ -256,6 +272,8 @@ class GeometricMultigridSolver : public Solver< OperatorType >
 
    bool   constantRHS_;
    real_t constantRHSScalar_;
+
+   bool fusedResidualRestriction_;
 };
 
 } // namespace hyteg
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "core/logging/Logging.h"
+#include "core/timing/TimingTree.h"
+
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/solvers/Solver.hpp"
+
+namespace hyteg {
+
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Mixed-precision iterative refinement.
+///
+/// Solves A x = b by the iteration
+///
+///   r   = b - A x             (working precision, e.g. double)
+///   A e = r                   (approximately, in low precision, e.g. single)
+///   x   = x + e               (working precision)
+///
+/// The inner solver, typically a single V-cycle of a GeometricMultigridSolver on the low precision operator, operates on
+/// data with half the memory footprint, while the final accuracy is determined by the residual computation in working
+/// precision. Since the multigrid smoothers and transfer operators are bandwidth bound, this roughly halves the runtime of
+/// the inner solve.
+///
+/// The function types must provide a converting copyFrom() (see VertexDoFFunction::copyFrom()).
+///
+/// Usage:
+///
+///   P1ConstantLaplaceOperator                     A( storage, minLevel, maxLevel );
+///   auto                                          A_f = std::make_shared< P1ConstantSinglePrecisionOperator >( A );
+///   auto gmg_f = std::make_shared< GeometricMultigridSolver< P1ConstantSinglePrecisionOperator > >( ... );
+///   MixedPrecisionSolver< P1ConstantLaplaceOperator, P1ConstantSinglePrecisionOperator > solver(
+///       storage, minLevel, maxLevel, A_f, gmg_f, 20, 1e-10 );
+///   solver.solve( A, u, f, maxLevel );
+///
+/// With maxIter == 1 the solver can be employed as preconditioner, e.g. for the CGSolver. Since the preconditioner is
+/// always invoked with a zero initial guess there, the residual computation can be skipped by enabling
+/// setZeroInitialGuess(). A tolerance of zero skips the (global) residual norm computation.
+template < class OperatorType, class LowPrecisionOperatorType >
+class MixedPrecisionSolver : public Solver< OperatorType >
+{
+ public:
+   typedef typename OperatorType::srcType             FunctionType;
+   typedef typename LowPrecisionOperatorType::srcType LowPrecisionFunctionType;
+
+   MixedPrecisionSolver( const std::shared_ptr< PrimitiveStorage >&            storage,
+                         uint_t                                                minLevel,
+                         uint_t                                                maxLevel,
+                         std::shared_ptr< LowPrecisionOperatorType >           lowPrecisionOperator,
+                         std::shared_ptr< Solver< LowPrecisionOperatorType > > innerSolver,
+                         uint_t                                                maxIter   = std::numeric_limits< uint_t >::max(),
+                         real_t                                                tolerance = 1e-12 )
+   : lowPrecisionOperator_( lowPrecisionOperator )
+   , innerSolver_( innerSolver )
+   , r_( "mp_r", storage, minLevel, maxLevel )
+   , e_( "mp_e", storage, minLevel, maxLevel )
+   , rLowPrecision_( "mp_r_low", storage, minLevel, maxLevel )
+   , eLowPrecision_( "mp_e_low", storage, minLevel, maxLevel )
+   , flag_( hyteg::Inner | hyteg::NeumannBoundary )
+   , maxIter_( maxIter )
+   , tolerance_( tolerance )
+   , printInfo_( false )
+   , zeroInitialGuess_( false )
+   , timingTree_( storage->getTimingTree() )
+   {}
+
+   void setPrintInfo( bool printInfo ) { printInfo_ = printInfo; }
+
+   /// If enabled, x is assumed to be zero when solve() is called. The residual of the first iteration is then b and its
+   /// computation is skipped. Intended for the application as preconditioner.
+   void setZeroInitialGuess( bool zeroInitialGuess ) { zeroInitialGuess_ = zeroInitialGuess; }
+
+   void solve( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) override
+   {
+      // e.g. the z-component of the velocity in 2D if applied to the velocity blocks of a Stokes system
+      if ( x.isDummy() || b.isDummy() )
+         return;
+
+      timingTree_->start( "Mixed Precision Solver" );
+
+      r_.copyBoundaryConditionFromFunction( x );
+      e_.copyBoundaryConditionFromFunction( x );
+      rLowPrecision_.copyBoundaryConditionFromFunction( x );
+      eLowPrecision_.copyBoundaryConditionFromFunction( x );
+
+      if ( zeroInitialGuess_ )
+      {
+         x.interpolate( 0, level, flag_ );
+         r_.assign( {1.0}, {b}, level, flag_ );
+      }
+      else
+      {
+         computeResidual( A, x, b, level );
+      }
+
+      for ( uint_t i = 0; i < maxIter_; ++i )
+      {
+         if ( tolerance_ > 0 )
+         {
+            const real_t residualNorm = std::sqrt( r_.dotGlobal( r_, level, flag_ ) );
+            if ( printInfo_ )
+            {
+               WALBERLA_LOG_INFO_ON_ROOT( "[Mixed Precision] iteration " << i << ", residual: " << residualNorm );
+            }
+            if ( residualNorm < tolerance_ )
+            {
+               if ( printInfo_ )
+               {
+                  WALBERLA_LOG_INFO_ON_ROOT( "[Mixed Precision] converged after " << i << " iterations" );
+               }
+               break;
+            }
+         }
+
+         // correction equation in low precision
+         timingTree_->start( "Inner Solver" );
+         rLowPrecision_.copyFrom( r_, level );
+         eLowPrecision_.interpolate( 0, level );
+         innerSolver_->solve( *lowPrecisionOperator_, eLowPrecision_, rLowPrecision_, level );
+         e_.copyFrom( eLowPrecision_, level );
+         timingTree_->stop( "Inner Solver" );
+
+         x.add( {1.0}, {e_}, level, flag_ );
+
+         if ( i + 1 < maxIter_ )
+         {
+            computeResidual( A, x, b, level );
+         }
+      }
+
+      timingTree_->stop( "Mixed Precision Solver" );
+   }
+
+ private:
+   void computeResidual( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) const
+   {
+      timingTree_->start( "Residual" );
+      A.apply( x, r_, level, flag_ );
+      r_.assign( {1.0, -1.0}, {b, r_}, level, flag_ );
+      timingTree_->stop( "Residual" );
+   }
+
+   std::shared_ptr< LowPrecisionOperatorType >           lowPrecisionOperator_;
+   std::shared_ptr< Solver< LowPrecisionOperatorType > > innerSolver_;
+
+   FunctionType             r_;
+   FunctionType             e_;
+   LowPrecisionFunctionType rLowPrecision_;
+   LowPrecisionFunctionType eLowPrecision_;
+
+   DoFType flag_;
+   uint_t  maxIter_;
+   real_t  tolerance_;
+   bool    printInfo_;
+   bool    zeroInitialGuess_;
+
+   std::shared_ptr< walberla::WcTimingTree > timingTree_;
+};
+
+/// \brief Wraps a solver for a higher precision operator so that it can be applied to low precision functions.
+///
+/// The low precision solution and right-hand side are converted, the solver is called with the higher precision
+/// operator and the result is converted back. Intended as coarse grid solver of low precision multigrid solvers,
+/// since not all solvers (e.g. the CGSolver) can be instantiated for single precision functions.
+template < class LowPrecisionOperatorType, class OperatorType >
+class HigherPrecisionSolverWrapper : public Solver< LowPrecisionOperatorType >
+{
+ public:
+   typedef typename OperatorType::srcType             FunctionType;
+   typedef typename LowPrecisionOperatorType::srcType LowPrecisionFunctionType;
+
+   HigherPrecisionSolverWrapper( const std::shared_ptr< PrimitiveStorage >& storage,
+                                 uint_t                                     minLevel,
+                                 uint_t                                     maxLevel,
+                                 std::shared_ptr< OperatorType >            higherPrecisionOperator,
+                                 std::shared_ptr< Solver< OperatorType > >  solver )
+   : higherPrecisionOperator_( higherPrecisionOperator )
+   , solver_( solver )
+   , x_( "hp_x", storage, minLevel, maxLevel )
+   , b_( "hp_b", storage, minLevel, maxLevel )
+   {}
+
+   void solve( const LowPrecisionOperatorType&                   A,
+               const typename LowPrecisionOperatorType::srcType& x,
+               const typename LowPrecisionOperatorType::dstType& b,
+               const uint_t                                      level ) override
+   {
+      WALBERLA_UNUSED( A );
+      x_.copyBoundaryConditionFromFunction( x );
+      b_.copyBoundaryConditionFromFunction( b );
+      x_.copyFrom( x, level );
+      b_.copyFrom( b, level );
+      solver_->solve( *higherPrecisionOperator_, x_, b_, level );
+      x.copyFrom( x_, level );
+   }
+
+ private:
+   std::shared_ptr< OperatorType >           higherPrecisionOperator_;
+   std::shared_ptr< Solver< OperatorType > > solver_;
+
+   FunctionType x_;
+   FunctionType b_;
+};
+
+} // namespace hyteg
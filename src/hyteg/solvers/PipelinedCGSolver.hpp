@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "core/Abort.h"
+#include "core/timing/TimingTree.h"
+
+#include "hyteg/FunctionReductions.hpp"
+#include "hyteg/solvers/Solver.hpp"
+#include "hyteg/solvers/preconditioners/IdentityPreconditioner.hpp"
+
+namespace hyteg {
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+
+/// \brief Preconditioned pipelined Conjugate Gradient method.
+///
+/// The algorithm is taken from: Ghysels, Vanroose: "Hiding global synchronization latency in the preconditioned
+/// Conjugate Gradient algorithm", Parallel Computing 40(7), 2014 (Algorithm 4).
+///
+/// In contrast to the CGSolver, all scalar products of an iteration are computed with a single non-blocking
+/// reduction that overlaps with the application of the preconditioner and the operator.
+/// This comes at the cost of additional vector updates and slightly reduced numerical stability,
+/// so this solver pays off when the global reductions dominate the runtime (e.g. on many processes or on coarse grids).
+///
+/// The preconditioner is applied to a zero initial guess so that it acts as a fixed linear operator.
+template < class OperatorType >
+class PipelinedCGSolver : public Solver< OperatorType >
+{
+ public:
+   typedef typename OperatorType::srcType FunctionType;
+
+   PipelinedCGSolver(
+       const std::shared_ptr< PrimitiveStorage >& storage,
+       uint_t                                     minLevel,
+       uint_t                                     maxLevel,
+       uint_t                                     maxIter        = std::numeric_limits< uint_t >::max(),
+       real_t                                     tolerance      = 1e-16,
+       std::shared_ptr< Solver< OperatorType > >  preconditioner = std::make_shared< IdentityPreconditioner< OperatorType > >() )
+   : r_( "r", storage, minLevel, maxLevel )
+   , u_( "u", storage, minLevel, maxLevel )
+   , w_( "w", storage, minLevel, maxLevel )
+   , m_( "m", storage, minLevel, maxLevel )
+   , n_( "n", storage, minLevel, maxLevel )
+   , z_( "z", storage, minLevel, maxLevel )
+   , q_( "q", storage, minLevel, maxLevel )
+   , s_( "s", storage, minLevel, maxLevel )
+   , p_( "p", storage, minLevel, maxLevel )
+   , preconditioner_( preconditioner )
+   , flag_( hyteg::Inner | hyteg::NeumannBoundary | hyteg::FreeslipBoundary )
+   , printInfo_( false )
+   , tolerance_( tolerance )
+   , maxIter_( maxIter )
+   , timingTree_( storage->getTimingTree() )
+   {
+      if ( !std::is_same< FunctionType, typename OperatorType::dstType >::value )
+      {
+         WALBERLA_ABORT( "PipelinedCGSolver does not work for Operator with different src and dst FunctionTypes" );
+      }
+   }
+
+   void solve( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) override
+   {
+      if ( maxIter_ == 0 )
+         return;
+
+      if ( x.isDummy() || b.isDummy() )
+         return;
+
+      timingTree_->start( "Pipelined CG Solver" );
+
+      r_.copyBoundaryConditionFromFunction( x );
+      u_.copyBoundaryConditionFromFunction( x );
+      w_.copyBoundaryConditionFromFunction( x );
+      m_.copyBoundaryConditionFromFunction( x );
+      n_.copyBoundaryConditionFromFunction( x );
+      z_.copyBoundaryConditionFromFunction( x );
+      q_.copyBoundaryConditionFromFunction( x );
+      s_.copyBoundaryConditionFromFunction( x );
+      p_.copyBoundaryConditionFromFunction( x );
+
+      // r = b - Ax, u = M^{-1} r, w = Au
+      A.apply( x, w_, level, flag_, Replace );
+      r_.assign( {1.0, -1.0}, {b, w_}, level, flag_ );
+      precondition( A, u_, r_, level );
+      A.apply( u_, w_, level, flag_, Replace );
+
+      real_t gammaOld = 0;
+      real_t alphaOld = 0;
+
+      NonBlockingSumReduction reduction;
+
+      for ( uint_t i = 0; i < maxIter_; ++i )
+      {
+         // gamma = (r, u), delta = (w, u), (r, r) for the stopping criterion
+         timingTree_->start( "Reduction (start)" );
+         startDotGlobal< FunctionType >( reduction, {r_, w_, r_}, {u_, u_, r_}, level, flag_ );
+         timingTree_->stop( "Reduction (start)" );
+
+         // m = M^{-1} w, n = Am overlap with the reduction
+         precondition( A, m_, w_, level );
+         A.apply( m_, n_, level, flag_, Replace );
+
+         timingTree_->start( "Reduction (wait)" );
+         const std::vector< real_t > scalarProducts = reduction.wait();
+         timingTree_->stop( "Reduction (wait)" );
+
+         const real_t gamma        = scalarProducts[0];
+         const real_t delta        = scalarProducts[1];
+         const real_t residualNorm = std::sqrt( scalarProducts[2] );
+
+         if ( printInfo_ )
+         {
+            WALBERLA_LOG_INFO_ON_ROOT( "[Pipelined CG] residual: " << residualNorm );
+         }
+
+         if ( residualNorm < tolerance_ )
+         {
+            if ( printInfo_ )
+            {
+               WALBERLA_LOG_INFO_ON_ROOT( "[Pipelined CG] converged after " << i << " iterations" );
+            }
+            break;
+         }
+
+         real_t alpha, beta;
+         if ( i == 0 )
+         {
+            beta  = 0;
+            alpha = gamma / delta;
+         }
+         else
+         {
+            beta  = gamma / gammaOld;
+            alpha = gamma / ( delta - beta * gamma / alphaOld );
+         }
+
+         z_.assign( {1.0, beta}, {n_, z_}, level, flag_ );
+         q_.assign( {1.0, beta}, {m_, q_}, level, flag_ );
+         s_.assign( {1.0, beta}, {w_, s_}, level, flag_ );
+         p_.assign( {1.0, beta}, {u_, p_}, level, flag_ );
+
+         x.add( {alpha}, {p_}, level, flag_ );
+         r_.add( {-alpha}, {s_}, level, flag_ );
+         u_.add( {-alpha}, {q_}, level, flag_ );
+         w_.add( {-alpha}, {z_}, level, flag_ );
+
+         gammaOld = gamma;
+         alphaOld = alpha;
+      }
+
+      timingTree_->stop( "Pipelined CG Solver" );
+   }
+
+   void setPrintInfo( bool printInfo ) { printInfo_ = printInfo; }
+
+ private:
+   void precondition( const OperatorType& A, const FunctionType& x, const FunctionType& b, const uint_t level ) const
+   {
+      timingTree_->start( "Preconditioner" );
+      x.interpolate( real_c( 0 ), level, All );
+      preconditioner_->solve( A, x, b, level );
+      timingTree_->stop( "Preconditioner" );
+   }
+
+   FunctionType r_;
+   FunctionType u_;
+   FunctionType w_;
+   FunctionType m_;
+   FunctionType n_;
+   FunctionType z_;
+   FunctionType q_;
+   FunctionType s_;
+   FunctionType p_;
+
+   std::shared_ptr< Solver< OperatorType > > preconditioner_;
+
+   hyteg::DoFType flag_;
+   bool           printInfo_;
+   real_t         tolerance_;
+   uint_t         maxIter_;
+
+   std::shared_ptr< walberla::WcTimingTree > timingTree_;
+};
+
+} // namespace hyteg
@@ -153,7 +153,7 @@ public:
   }
 
   template<uint_t N_rhs>
-  Matrix<T, M, N_rhs> mul(const Matrix<T, N, N_rhs>& rhs)
+  Matrix<T, M, N_rhs> mul(const Matrix<T, N, N_rhs>& rhs) const
   {
     Matrix<T, M, N_rhs> out;
     for (uint_t i = 0; i < M; ++i)
@@ -168,7 +168,7 @@ public:
     return out;
   }
 
-  PointND<T, M> mul(const PointND<T, N>& rhs)
+  PointND<T, M> mul(const PointND<T, N>& rhs) const
   {
     PointND<T, M> out;
     for (uint_t i = 0; i < M; ++i)
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <core/Environment.h>
+#include <core/math/Constants.h>
+
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+#include "coupling_hyteg_convection_particles/MMOCTransport.hpp"
+
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+
+using namespace hyteg;
+
+/// Checks that the MMOC transport on a distributed storage gives the same result as on a storage where all
+/// macro-primitives are located on the root process.
+///
+/// The macro-faces are distributed round robin, so that neighboring macro-faces belong to different processes.
+/// The time step is chosen such that the particles move across several macro-faces per step and therefore have
+/// to be forwarded across process boundaries, also beyond the direct neighborhood of their start process.
+/// Run with multiple processes (e.g. 4).
+
+static std::shared_ptr< PrimitiveStorage > createStorage( const MeshInfo& meshInfo, bool allOnRoot )
+{
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   if ( allOnRoot )
+   {
+      loadbalancing::allPrimitivesOnRoot( setupStorage );
+   }
+   else
+   {
+      loadbalancing::roundRobin( setupStorage );
+   }
+   return std::make_shared< PrimitiveStorage >( setupStorage );
+}
+
+/// Solid body rotation of a Gaussian hill around the center of the unit square.
+static void transport( const std::shared_ptr< PrimitiveStorage >& storage,
+                       const P2Function< real_t >&                c,
+                       const uint_t&                              level,
+                       const real_t&                              dt,
+                       const uint_t&                              outerSteps,
+                       const uint_t&                              innerSteps )
+{
+   P2Function< real_t > u( "u", storage, level, level );
+   P2Function< real_t > v( "v", storage, level, level );
+   P2Function< real_t > w( "w", storage, level, level );
+
+   u.interpolate( []( const Point3D& x ) { return 0.5 - x[1]; }, level );
+   v.interpolate( []( const Point3D& x ) { return x[0] - 0.5; }, level );
+   c.interpolate(
+       []( const Point3D& x ) { return std::exp( -50.0 * ( std::pow( x[0] - 0.5, 2 ) + std::pow( x[1] - 0.2, 2 ) ) ); }, level );
+
+   MMOCTransport< P2Function< real_t > > mmoc( storage, level, level, TimeSteppingScheme::RK4 );
+   for ( uint_t i = 0; i < outerSteps; i++ )
+   {
+      mmoc.step( c, u, v, w, u, v, w, level, Inner, dt, innerSteps, i == 0 );
+   }
+}
+
+/// Copies the data of all macro-primitives of one type from the (equally distributed) source storage.
+template < typename PrimitiveType >
+static void copyPrimitiveData( const PrimitiveStorage&                                            srcStorage,
+                               const PrimitiveDataID< FunctionMemory< real_t >, PrimitiveType >& srcID,
+                               const PrimitiveStorage&                                            dstStorage,
+                               const PrimitiveDataID< FunctionMemory< real_t >, PrimitiveType >& dstID,
+                               const uint_t&                                                      level )
+{
+   std::vector< PrimitiveID > primitiveIDs;
+   dstStorage.getPrimitiveIDsGenerically< PrimitiveType >( primitiveIDs );
+   for ( const auto& id : primitiveIDs )
+   {
+      const PrimitiveType* src = srcStorage.getPrimitiveGenerically< PrimitiveType >( id );
+      WALBERLA_CHECK_NOT_NULLPTR( src, "Primitive " << id << " not found in the source storage." );
+      dstStorage.getPrimitiveGenerically< PrimitiveType >( id )->getData( dstID )->copyFrom( *src->getData( srcID ), level );
+   }
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   const uint_t level      = 3;
+   const real_t dt         = walberla::math::pi / 8;
+   const uint_t outerSteps = 4;
+   const uint_t innerSteps = 2;
+
+   const MeshInfo meshInfo = MeshInfo::meshRectangle( Point2D( {0, 0} ), Point2D( {1, 1} ), MeshInfo::CRISS, 4, 4 );
+
+   auto storageSerial      = createStorage( meshInfo, true );
+   auto storageDistributed = createStorage( meshInfo, false );
+
+   P2Function< real_t > cSerial( "cSerial", storageSerial, level, level );
+   P2Function< real_t > cDistributed( "cDistributed", storageDistributed, level, level );
+
+   transport( storageSerial, cSerial, level, dt, outerSteps, innerSteps );
+   transport( storageDistributed, cDistributed, level, dt, outerSteps, innerSteps );
+
+   WALBERLA_CHECK_GREATER( cDistributed.getMaxMagnitude( level ), 0.5, "The hill must not be lost during the transport." );
+
+   // gather the distributed result on the root process and compare it with the serial run
+   MigrationMap_T primitivesToMigrate;
+   for ( const auto& id : storageDistributed->getPrimitiveIDs() )
+   {
+      primitivesToMigrate[id.getID()] = 0;
+   }
+   storageDistributed->migratePrimitives( MigrationInfo( primitivesToMigrate, getNumReceivingPrimitives( primitivesToMigrate ) ) );
+
+   P2Function< real_t > cGathered( "cGathered", storageSerial, level, level );
+   P2Function< real_t > error( "error", storageSerial, level, level );
+
+   const auto& srcVertexDoFs = cDistributed.getVertexDoFFunction();
+   const auto& srcEdgeDoFs   = cDistributed.getEdgeDoFFunction();
+   const auto& dstVertexDoFs = cGathered.getVertexDoFFunction();
+   const auto& dstEdgeDoFs   = cGathered.getEdgeDoFFunction();
+
+   copyPrimitiveData( *storageDistributed, srcVertexDoFs.getVertexDataID(), *storageSerial, dstVertexDoFs.getVertexDataID(), level );
+   copyPrimitiveData( *storageDistributed, srcVertexDoFs.getEdgeDataID(), *storageSerial, dstVertexDoFs.getEdgeDataID(), level );
+   copyPrimitiveData( *storageDistributed, srcVertexDoFs.getFaceDataID(), *storageSerial, dstVertexDoFs.getFaceDataID(), level );
+   copyPrimitiveData( *storageDistributed, srcEdgeDoFs.getEdgeDataID(), *storageSerial, dstEdgeDoFs.getEdgeDataID(), level );
+   copyPrimitiveData( *storageDistributed, srcEdgeDoFs.getFaceDataID(), *storageSerial, dstEdgeDoFs.getFaceDataID(), level );
+
+   error.assign( {1.0, -1.0}, {cSerial, cGathered}, level, All );
+   const real_t errorMax = error.getMaxMagnitude( level );
+   WALBERLA_LOG_INFO_ON_ROOT( "max difference distributed vs. serial: " << errorMax )
+   WALBERLA_CHECK_LESS( errorMax, 1e-12 );
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/math/Random.h"
+
+#include "hyteg/communication/Syncing.hpp"
+#include "hyteg/geometry/AnnulusMap.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// Tests the batched evaluation of P1 and P2 functions at points that are located in the subdomains of
+// arbitrary processes. Each process draws its own random points, all of them must be found and evaluated exactly
+// for functions that are contained in the respective finite element space.
+// On a blended domain, the points are the mapped micro-vertices, where the interpolated functions are exact.
+
+using walberla::real_t;
+using namespace hyteg;
+
+template < typename FunctionType >
+void testBatchedEvaluation( const std::shared_ptr< PrimitiveStorage >&         storage,
+                            const std::function< real_t( const Point3D& ) >& testFunc,
+                            const Point3D&                                    min,
+                            const Point3D&                                    max,
+                            const uint_t&                                     level,
+                            const uint_t&                                     numPoints )
+{
+   const uint_t dim = storage->hasGlobalCells() ? 3 : 2;
+
+   FunctionType x( "x", storage, level, level );
+   x.interpolate( testFunc, level, All );
+   communication::syncFunctionBetweenPrimitives( x, level );
+
+   // different points on each process
+   walberla::math::seedRandomGenerator( 12345678 + uint_c( walberla::mpi::MPIManager::instance()->rank() ) );
+
+   std::vector< Point3D > coordinates( numPoints );
+   for ( auto& point : coordinates )
+   {
+      for ( uint_t i = 0; i < dim; i++ )
+      {
+         point[i] = walberla::math::realRandom( min[i], max[i] );
+      }
+   }
+
+   // one point outside of the domain
+   coordinates.push_back( max + Point3D( {1.0, 1.0, 1.0} ) );
+
+   std::vector< real_t > values;
+   std::vector< bool >   found;
+   x.evaluate( coordinates, level, values, found );
+
+   WALBERLA_CHECK_EQUAL( values.size(), coordinates.size() );
+   WALBERLA_CHECK_EQUAL( found.size(), coordinates.size() );
+
+   for ( uint_t i = 0; i < numPoints; i++ )
+   {
+      WALBERLA_CHECK( found[i], "Point " << coordinates[i] << " was not found." );
+      WALBERLA_CHECK_FLOAT_EQUAL( values[i], testFunc( coordinates[i] ), "Wrong value at " << coordinates[i] << "." );
+
+      // the batched evaluation must agree with the evaluation at a single point on the owning process
+      real_t value;
+      if ( x.evaluate( coordinates[i], level, value ) )
+      {
+         WALBERLA_CHECK_FLOAT_EQUAL( values[i], value );
+      }
+   }
+   WALBERLA_CHECK( !found[numPoints] );
+}
+
+template < typename FunctionType >
+void testBlendedEvaluation( const std::shared_ptr< PrimitiveStorage >&         storage,
+                            const std::function< real_t( const Point3D& ) >& testFunc,
+                            const uint_t&                                     level )
+{
+   FunctionType x( "x", storage, level, level );
+   x.interpolate( testFunc, level, All );
+   communication::syncFunctionBetweenPrimitives( x, level );
+
+   std::vector< Point3D > coordinates;
+   for ( const auto& it : storage->getFaces() )
+   {
+      const Face& face = *it.second;
+      for ( const auto& idx : vertexdof::macroface::Iterator( level ) )
+      {
+         Point3D physicalCoordinates;
+         face.getGeometryMap()->evalF( vertexdof::macroface::coordinateFromIndex( level, face, idx ), physicalCoordinates );
+         coordinates.push_back( physicalCoordinates );
+      }
+   }
+
+   std::vector< real_t > values;
+   std::vector< bool >   found;
+   x.evaluate( coordinates, level, values, found );
+
+   for ( uint_t i = 0; i < coordinates.size(); i++ )
+   {
+      WALBERLA_CHECK( found[i], "Point " << coordinates[i] << " was not found." );
+      const real_t error = std::abs( values[i] - testFunc( coordinates[i] ) );
+      WALBERLA_CHECK_LESS( error, 1e-10, "Wrong value at " << coordinates[i] << "." );
+   }
+}
+
+std::shared_ptr< PrimitiveStorage > createStorage( const MeshInfo& meshInfo, bool annulusMap = false )
+{
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   if ( annulusMap )
+   {
+      AnnulusMap::setMap( setupStorage );
+   }
+   loadbalancing::roundRobin( setupStorage );
+   return std::make_shared< PrimitiveStorage >( setupStorage );
+}
+
+int main( int argc, char** argv )
+{
+   walberla::debug::enterTestMode();
+   walberla::mpi::Environment MPIenv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   const uint_t numPoints = 500;
+
+   auto linear2D    = []( const Point3D& x ) { return 10.0 * x[0] + 3.0 * x[1] + 1.0; };
+   auto quadratic2D = []( const Point3D& x ) { return 10.0 * x[0] * x[1] + 3.0 * x[1] * x[1] + x[0] + 1.0; };
+   auto linear3D    = []( const Point3D& x ) { return 10.0 * x[0] + 3.0 * x[1] - 2.0 * x[2] + 1.0; };
+   auto quadratic3D = []( const Point3D& x ) { return 10.0 * x[0] * x[2] + 3.0 * x[1] * x[1] - x[2] + 1.0; };
+
+   const Point3D min( {0, 0, 0} );
+   const Point3D max( {2, 1, 1} );
+
+   auto storage2D = createStorage( MeshInfo::meshRectangle( Point2D( {0, 0} ), Point2D( {2, 1} ), MeshInfo::CRISS, 4, 3 ) );
+   auto storage3D = createStorage( MeshInfo::meshSymmetricCuboid( min, max, 2, 1, 1 ) );
+   auto annulus   = createStorage( MeshInfo::meshAnnulus( 1.0, 2.0, MeshInfo::CRISS, 6, 2 ), true );
+
+   for ( uint_t level = 0; level <= 3; level++ )
+   {
+      testBatchedEvaluation< P1Function< real_t > >( storage2D, linear2D, min, max, level, numPoints );
+      testBatchedEvaluation< P2Function< real_t > >( storage2D, quadratic2D, min, max, level, numPoints );
+      testBatchedEvaluation< P1Function< real_t > >( storage3D, linear3D, min, max, level, numPoints );
+      testBatchedEvaluation< P2Function< real_t > >( storage3D, quadratic3D, min, max, level, numPoints );
+      testBlendedEvaluation< P1Function< real_t > >( annulus, quadratic2D, level );
+      testBlendedEvaluation< P2Function< real_t > >( annulus, quadratic2D, level );
+   }
+
+   return EXIT_SUCCESS;
+}
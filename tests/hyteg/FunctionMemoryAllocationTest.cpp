@@ -18,12 +18,15 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
+
 #include "core/Environment.h"
 #include "core/logging/Logging.h"
 #include "core/timing/Timer.h"
 #include "core/math/Random.h"
 
 #include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
 #include "hyteg/p1functionspace/VertexDoFMemory.hpp"
 #include "hyteg/p1functionspace/P1ConstantOperator.hpp"
 #include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
@@ -71,6 +74,48 @@ void TestFunctionMemoryAllocation()
    WALBERLA_CHECK_EQUAL( globalMemoryAfterReallocation, globalMemoryAfterDeletion + memoryAllocated );
 }
 
+void TestFunctionMemoryAlignment()
+{
+   auto meshInfo = MeshInfo::fromGmshFile("../../data/meshes/3D/cube_24el.msh");
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   const uint_t minLevel = 2;
+   const uint_t maxLevel = 4;
+
+   P2Function< real_t > x( "x", storage, minLevel, maxLevel );
+   P2Function< real_t > y( "y", storage, minLevel, maxLevel );
+
+   // all levels on all primitives must be aligned to cache lines
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      for ( const auto & it : storage->getCells() )
+      {
+         const auto vertexDoFPtr = it.second->getData( x.getVertexDoFFunction().getCellDataID() )->getPointer( level );
+         const auto edgeDoFPtr   = it.second->getData( x.getEdgeDoFFunction().getCellDataID() )->getPointer( level );
+         WALBERLA_CHECK_EQUAL( reinterpret_cast< std::uintptr_t >( vertexDoFPtr ) % FunctionMemoryAllocation::alignment, std::uintptr_t( 0 ) );
+         WALBERLA_CHECK_EQUAL( reinterpret_cast< std::uintptr_t >( edgeDoFPtr ) % FunctionMemoryAllocation::alignment, std::uintptr_t( 0 ) );
+      }
+      for ( const auto & it : storage->getFaces() )
+      {
+         const auto vertexDoFPtr = it.second->getData( x.getVertexDoFFunction().getFaceDataID() )->getPointer( level );
+         WALBERLA_CHECK_EQUAL( reinterpret_cast< std::uintptr_t >( vertexDoFPtr ) % FunctionMemoryAllocation::alignment, std::uintptr_t( 0 ) );
+      }
+   }
+
+   // levels of the same arena must not overlap and must keep their data after swapping
+   x.interpolate( 1.0, minLevel, All );
+   x.interpolate( 2.0, maxLevel, All );
+   y.interpolate( 3.0, maxLevel, All );
+   x.swap( y, maxLevel, All );
+   y.interpolate( 4.0, minLevel, All );
+
+   WALBERLA_CHECK_FLOAT_EQUAL( x.getMaxMagnitude( minLevel, All ), 1.0 );
+   WALBERLA_CHECK_FLOAT_EQUAL( x.getMaxMagnitude( maxLevel, All ), 3.0 );
+   WALBERLA_CHECK_FLOAT_EQUAL( y.getMaxMagnitude( maxLevel, All ), 2.0 );
+   WALBERLA_CHECK_FLOAT_EQUAL( y.getMaxMagnitude( minLevel, All ), 4.0 );
+}
+
 int main( int argc, char* argv[] )
 {
    walberla::Environment walberlaEnv( argc, argv );
@@ -78,5 +123,6 @@ int main( int argc, char* argv[] )
    walberla::MPIManager::instance()->useWorldComm();
 
    TestFunctionMemoryAllocation();
+   TestFunctionMemoryAlignment();
    return 0;
 }
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <fstream>
+
+#include "hyteg/KernelInstrumentation.hpp"
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/timing/TimingJSON.h"
+
+#include "hyteg/HytegDefinitions.hpp"
+#include "hyteg/Levelinfo.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// Checks the analytic kernel statistics of the constant P1 operator and the roofline JSON export.
+
+namespace hyteg {
+
+static void testKernelStatistics( const std::string& meshFile, const uint_t& level )
+{
+   const uint_t numApplies = 3;
+
+   const std::string fileName = "../../output/KernelInstrumentationTest.json";
+
+   MeshInfo              mesh = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( mesh, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   loadbalancing::roundRobin( setupStorage );
+   std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   P1Function< real_t >      src( "src", storage, level, level );
+   P1Function< real_t >      dst( "dst", storage, level, level );
+   P1ConstantLaplaceOperator L( storage, level, level );
+
+   src.interpolate( []( const Point3D& p ) { return p[0] + p[1]; }, level, All );
+
+   auto instrumentation = KernelInstrumentation::instance();
+   instrumentation->reset();
+   instrumentation->enableKernelStatistics( true );
+
+   for ( uint_t i = 0; i < numApplies; i++ )
+   {
+      L.apply( src, dst, level, Inner );
+   }
+
+   instrumentation->enableKernelStatistics( false );
+
+   // without statistics enabled, nothing is recorded
+   L.apply( src, dst, level, Inner );
+
+   const bool        is3D   = storage->hasGlobalCells();
+   const std::string kernel = is3D ? "apply_3D_macrocell_vertexdof_to_vertexdof_replace" :
+                                     "apply_2D_macroface_vertexdof_to_vertexdof_replace";
+   const uint_t      width  = levelinfo::num_microvertices_per_edge( level );
+   const uint_t      numInnerDoFsPerPrimitive = is3D ? levelinfo::num_microvertices_per_cell_from_width( width - 4 ) :
+                                                       levelinfo::num_microvertices_per_face_from_width( width - 3 );
+   const uint_t      stencilSize              = is3D ? 15 : 7;
+
+   auto numPrimitivesWithFlag = [&dst]( const auto& primitives ) {
+      uint_t count = 0;
+      for ( const auto& it : primitives )
+      {
+         if ( testFlag( dst.getBoundaryCondition().getBoundaryType( it.second->getMeshBoundaryFlag() ), Inner ) )
+         {
+            count++;
+         }
+      }
+      return count;
+   };
+   const uint_t numLocalPrimitives = is3D ? numPrimitivesWithFlag( storage->getCells() ) : numPrimitivesWithFlag( storage->getFaces() );
+   const uint_t numGlobalPrimitives = walberla::mpi::allReduce( numLocalPrimitives, walberla::mpi::SUM );
+   WALBERLA_CHECK_GREATER( numGlobalPrimitives, 0 );
+
+   const auto& statistics = instrumentation->getStatistics();
+
+   // only the generated kernels are instrumented
+   if ( !globalDefines::useGeneratedKernels )
+   {
+      WALBERLA_CHECK( statistics.empty() );
+      instrumentation->reset();
+      return;
+   }
+
+   WALBERLA_CHECK_EQUAL( statistics.size(), 1 );
+   WALBERLA_CHECK_EQUAL( statistics.count( kernel ), 1 );
+   WALBERLA_CHECK_EQUAL( statistics.at( kernel ).count( level ), 1 );
+
+   const auto& kernelStatistics = statistics.at( kernel ).at( level );
+   WALBERLA_CHECK_EQUAL( kernelStatistics.calls, numApplies );
+   WALBERLA_CHECK_FLOAT_EQUAL( kernelStatistics.bytes,
+                               double( numApplies * numLocalPrimitives * numInnerDoFsPerPrimitive * 3 * sizeof( real_t ) ) );
+   WALBERLA_CHECK_FLOAT_EQUAL( kernelStatistics.flops,
+                               double( numApplies * numLocalPrimitives * numInnerDoFsPerPrimitive * ( 2 * stencilSize - 1 ) ) );
+
+   // machine balance far above the arithmetic intensity of the stencil apply -> memory bound
+   const double peakBandwidthGBs = 100.0;
+   const double peakGFLOPs       = 1000.0;
+   instrumentation->writeRooflineJSON( fileName, peakBandwidthGBs, peakGFLOPs );
+
+   WALBERLA_ROOT_SECTION()
+   {
+      std::ifstream  jsonInput( fileName );
+      nlohmann::json json;
+      jsonInput >> json;
+
+      WALBERLA_CHECK_EQUAL( json["numProcesses"].get< int >(), walberla::mpi::MPIManager::instance()->numProcesses() );
+      WALBERLA_CHECK_FLOAT_EQUAL( json["machine"]["ridgePoint"].get< double >(), peakGFLOPs / peakBandwidthGBs );
+
+      const auto& entry = json["kernels"][kernel][std::to_string( level )];
+      WALBERLA_CHECK_EQUAL( entry["calls"].get< uint_t >(), numApplies );
+      WALBERLA_CHECK_FLOAT_EQUAL(
+          entry["bytes"].get< double >(),
+          double( numApplies * numGlobalPrimitives * numInnerDoFsPerPrimitive * 3 * sizeof( real_t ) ) );
+      WALBERLA_CHECK_FLOAT_EQUAL( entry["arithmeticIntensity"].get< double >(),
+                                  double( 2 * stencilSize - 1 ) / double( 3 * sizeof( real_t ) ) );
+      WALBERLA_CHECK_EQUAL( entry["bound"].get< std::string >(), "memory" );
+      WALBERLA_CHECK_GREATER( entry["time"].get< double >(), 0.0 );
+      WALBERLA_CHECK_LESS_EQUAL( entry["rooflineGFLOPs"].get< double >(), peakGFLOPs );
+   }
+
+   instrumentation->reset();
+}
+
+static void testLikwidRegionTags()
+{
+   WALBERLA_CHECK_EQUAL( KernelInstrumentation::likwidRegionTag( "Operator P1Function to P1Function Apply" ),
+                         "Operator_P1Function_to_P1Function_Apply" );
+   WALBERLA_CHECK_EQUAL( KernelInstrumentation::likwidRegionTag( "Smoother", 4 ), "Smoother_level04" );
+   WALBERLA_CHECK_EQUAL( KernelInstrumentation::likwidRegionTag( "Smoother", 12 ), "Smoother_level12" );
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testLikwidRegionTags();
+
+   hyteg::testKernelStatistics( "../../data/meshes/quad_4el.msh", 4 );
+   hyteg::testKernelStatistics( "../../data/meshes/3D/cube_6el.msh", 3 );
+
+   return EXIT_SUCCESS;
+}
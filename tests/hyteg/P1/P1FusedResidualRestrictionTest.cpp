@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/Environment.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/FusedResidualRestriction.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using walberla::math::pi;
+
+using namespace hyteg;
+
+/// Compares the fused residual computation and restriction against
+/// the composition of apply, assign and restrict.
+void testFusedResidualRestriction( const std::string& meshFile, const uint_t& level )
+{
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   P1ConstantLaplaceOperator A( storage, level - 1, level );
+   P1toP1LinearRestriction   restriction;
+
+   P1Function< real_t > x( "x", storage, level - 1, level );
+   P1Function< real_t > b( "b", storage, level - 1, level );
+   P1Function< real_t > tmp( "tmp", storage, level - 1, level );
+   P1Function< real_t > tmpFused( "tmpFused", storage, level - 1, level );
+   P1Function< real_t > err( "err", storage, level - 1, level );
+
+   std::function< real_t( const Point3D& ) > xFunc = []( const Point3D& p ) {
+      return std::sin( 2 * pi * p[0] ) * std::cos( pi * p[1] ) + p[2] * p[2];
+   };
+   std::function< real_t( const Point3D& ) > bFunc = []( const Point3D& p ) {
+      return std::exp( p[0] ) * p[1] - std::sin( 3 * pi * p[2] );
+   };
+
+   const DoFType flag = Inner | NeumannBoundary;
+
+   x.interpolate( xFunc, level, All );
+   b.interpolate( bFunc, level, All );
+
+   if ( storage->hasGlobalCells() && !globalDefines::useGeneratedKernels )
+   {
+      // the 3D fused kernel scales the residual like the generated restriction kernel
+      WALBERLA_CHECK( !( FusedResidualRestriction< P1ConstantLaplaceOperator >::isAvailable( A, restriction ) ) );
+      return;
+   }
+   WALBERLA_CHECK( FusedResidualRestriction< P1ConstantLaplaceOperator >::isAvailable( A, restriction ) );
+
+   A.apply( x, tmp, level, flag );
+   tmp.assign( {1.0, -1.0}, {b, tmp}, level, flag );
+   restriction.restrict( tmp, level, flag );
+
+   FusedResidualRestriction< P1ConstantLaplaceOperator >::computeAndRestrictResidual(
+       A, restriction, x, b, tmpFused, level, flag );
+
+   err.assign( {1.0, -1.0}, {tmp, tmpFused}, level - 1, flag );
+   const real_t maxError = err.getMaxMagnitude( level - 1, flag );
+   const real_t maxValue = tmp.getMaxMagnitude( level - 1, flag );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << ", level " << level << "] max error: " << maxError
+                                  << ", max magnitude: " << maxValue );
+   WALBERLA_CHECK_GREATER( maxValue, 0.0 );
+   WALBERLA_CHECK_LESS( maxError, 1e-12 * maxValue );
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::logging::Logging::instance()->setLogLevel( walberla::logging::Logging::PROGRESS );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   for ( uint_t level = 2; level <= 4; level++ )
+   {
+      testFusedResidualRestriction( "../../data/meshes/tri_1el.msh", level );
+      testFusedResidualRestriction( "../../data/meshes/quad_4el_neumann.msh", level );
+      testFusedResidualRestriction( "../../data/meshes/annulus_coarse.msh", level );
+      testFusedResidualRestriction( "../../data/meshes/3D/tet_1el.msh", level );
+      testFusedResidualRestriction( "../../data/meshes/3D/pyramid_tilted_4el.msh", level );
+      testFusedResidualRestriction( "../../data/meshes/3D/cube_24el.msh", level );
+   }
+
+   return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <limits>
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/geometry/AnnulusMap.hpp"
+#include "hyteg/geometry/BlendedGeometryCache.hpp"
+#include "hyteg/geometry/IcosahedralShellMap.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroFace.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// This test checks that the interpolation with the cached mapped coordinates of a
+// BlendedGeometryCache gives the same result as the evaluation of the blending map.
+// It also checks the cached Jacobians and the update of the cache after a migration.
+
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using namespace hyteg;
+
+static void compareInterpolation( const std::shared_ptr< PrimitiveStorage >&     storage,
+                                  const std::shared_ptr< BlendedGeometryCache >& cache,
+                                  const uint_t                                   minLevel,
+                                  const uint_t                                   maxLevel )
+{
+   P1Function< real_t > u( "u", storage, minLevel, maxLevel );
+   P1Function< real_t > uCached( "uCached", storage, minLevel, maxLevel );
+   P1Function< real_t > error( "error", storage, minLevel, maxLevel );
+   uCached.setGeometryCache( cache );
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      u.interpolate( func, level );
+      uCached.interpolate( func, level );
+
+      error.assign( {1.0, -1.0}, {u, uCached}, level, All );
+      const real_t errorMax = error.getMaxMagnitude( level );
+      WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ": max difference " << errorMax )
+      WALBERLA_CHECK_LESS( errorMax, 1e-13 );
+   }
+}
+
+static void checkJacobians( const Face& face, const real_t* jacobians, const Point3D& x, const uint_t& idx )
+{
+   Matrix2r DF;
+   face.getGeometryMap()->evalDF( x, DF );
+   for ( uint_t k = 0; k < 4; k++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( jacobians[4 * idx + k], DF( k / 2, k % 2 ) );
+   }
+}
+
+static void checkJacobians( const Cell& cell, const real_t* jacobians, const Point3D& x, const uint_t& idx )
+{
+   Matrix3r DF;
+   cell.getGeometryMap()->evalDF( x, DF );
+   for ( uint_t k = 0; k < 9; k++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( jacobians[9 * idx + k], DF( k / 3, k % 3 ) );
+   }
+}
+
+/// Compares the cached data of the micro-vertex ( 1, 0 ), which exists on all levels, with the evaluation of the map.
+static void checkCachedData( const std::shared_ptr< PrimitiveStorage >& storage, const BlendedGeometryCache& cache )
+{
+   for ( const auto& level : cache.getCachedLevels() )
+   {
+      if ( storage->hasGlobalCells() )
+      {
+         for ( const auto& it : storage->getCells() )
+         {
+            const Cell&   cell = *it.second;
+            const uint_t  idx  = vertexdof::macrocell::index( level, 1, 0, 0 );
+            const Point3D x    = vertexdof::macrocell::coordinateFromIndex( level, cell, indexing::Index( 1, 0, 0 ) );
+            Point3D       Fx;
+            cell.getGeometryMap()->evalF( x, Fx );
+            const real_t* coordinates = cache.getMappedCoordinates( cell, level );
+            WALBERLA_CHECK_NOT_NULLPTR( coordinates );
+            WALBERLA_CHECK_FLOAT_EQUAL( coordinates[3 * idx], Fx[0] );
+            WALBERLA_CHECK_FLOAT_EQUAL( coordinates[3 * idx + 1], Fx[1] );
+            WALBERLA_CHECK_FLOAT_EQUAL( coordinates[3 * idx + 2], Fx[2] );
+            checkJacobians( cell, cache.getJacobians( cell, level ), x, idx );
+         }
+      }
+      else
+      {
+         for ( const auto& it : storage->getFaces() )
+         {
+            const Face&   face = *it.second;
+            const uint_t  idx  = vertexdof::macroface::index( level, 1, 0 );
+            const Point3D x    = vertexdof::macroface::coordinateFromIndex( level, face, indexing::Index( 1, 0, 0 ) );
+            Point3D       Fx;
+            face.getGeometryMap()->evalF( x, Fx );
+            const real_t* coordinates = cache.getMappedCoordinates( face, level );
+            WALBERLA_CHECK_NOT_NULLPTR( coordinates );
+            WALBERLA_CHECK_FLOAT_EQUAL( coordinates[3 * idx], Fx[0] );
+            WALBERLA_CHECK_FLOAT_EQUAL( coordinates[3 * idx + 1], Fx[1] );
+            WALBERLA_CHECK_FLOAT_EQUAL( coordinates[3 * idx + 2], Fx[2] );
+            checkJacobians( face, cache.getJacobians( face, level ), x, idx );
+         }
+      }
+   }
+}
+
+/// Migrates all macro-primitives to the next process.
+static void migrateToNextProcess( PrimitiveStorage& storage )
+{
+   const uint_t rank         = uint_c( walberla::mpi::MPIManager::instance()->rank() );
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   MigrationMap_T             primitivesToMigrate;
+   std::vector< PrimitiveID > localPrimitiveIDs;
+   storage.getPrimitiveIDs( localPrimitiveIDs );
+   for ( const auto& id : localPrimitiveIDs )
+   {
+      primitivesToMigrate[id.getID()] = ( rank + 1 ) % numProcesses;
+   }
+   storage.migratePrimitives( MigrationInfo( primitivesToMigrate, getNumReceivingPrimitives( primitivesToMigrate ) ) );
+}
+
+static void testGeometryCache( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t minLevel, const uint_t maxLevel )
+{
+   // a budget of zero disables the cache
+   WALBERLA_CHECK( BlendedGeometryCache( storage, minLevel, maxLevel, 0 ).getCachedLevels().empty() );
+
+   auto cache = std::make_shared< BlendedGeometryCache >( storage, minLevel, maxLevel, std::numeric_limits< uint_t >::max() / 2 );
+   WALBERLA_CHECK_EQUAL( cache->getCachedLevels().size(), maxLevel - minLevel + 1 );
+
+   checkCachedData( storage, *cache );
+   compareInterpolation( storage, cache, minLevel, maxLevel );
+
+   // the cached data migrates with the macro-primitives
+   migrateToNextProcess( *storage );
+   WALBERLA_CHECK( cache->isOutdated() );
+   checkCachedData( storage, *cache );
+   compareInterpolation( storage, cache, minLevel, maxLevel );
+
+   cache->update();
+   WALBERLA_CHECK( !cache->isOutdated() );
+   WALBERLA_CHECK_EQUAL( cache->getCachedLevels().size(), maxLevel - minLevel + 1 );
+   checkCachedData( storage, *cache );
+   compareInterpolation( storage, cache, minLevel, maxLevel );
+}
+
+static std::shared_ptr< PrimitiveStorage > createStorage( const MeshInfo& meshInfo, bool annulusMap, bool shellMap )
+{
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   if ( annulusMap )
+   {
+      AnnulusMap::setMap( setupStorage );
+   }
+   if ( shellMap )
+   {
+      IcosahedralShellMap::setMap( setupStorage );
+   }
+   loadbalancing::roundRobin( setupStorage );
+   return std::make_shared< PrimitiveStorage >( setupStorage );
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   WALBERLA_LOG_INFO_ON_ROOT( "2D, annulus" )
+   testGeometryCache( createStorage( MeshInfo::meshAnnulus( 1.0, 2.0, MeshInfo::CRISS, 6, 2 ), true, false ), 0, 4 );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "3D, spherical shell" )
+   testGeometryCache( createStorage( MeshInfo::meshSphericalShell( 2, 2, 1.0, 2.0 ), false, true ), 0, 3 );
+
+   return EXIT_SUCCESS;
+}
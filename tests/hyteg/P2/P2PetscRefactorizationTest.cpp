@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "core/Environment.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+
+#include "hyteg/composites/UnsteadyDiffusion.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/petsc/PETScLUSolver.hpp"
+#include "hyteg/petsc/PETScManager.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+
+#ifndef HYTEG_BUILD_WITH_PETSC
+WALBERLA_ABORT( "This test only works with PETSc enabled. Please enable it via -DHYTEG_BUILD_WITH_PETSC=ON" )
+#endif
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using walberla::math::pi;
+
+namespace hyteg {
+
+/// Solves the implicit Euler system for several time step sizes with a single LU solver that refactorizes the
+/// operator in each solve (reusing the symbolic factorization) and compares the result to a freshly set up solver.
+void petscRefactorizationTest( const uint_t& level, const std::string& meshFileName )
+{
+   WALBERLA_LOG_INFO_ON_ROOT( "##### Mesh file: " << meshFileName << " / level: " << level << " #####" )
+
+   MeshInfo              meshInfo = MeshInfo::fromGmshFile( meshFileName );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   P2Function< real_t > x( "x", storage, level, level );
+   P2Function< real_t > xReference( "xReference", storage, level, level );
+   P2Function< real_t > b( "b", storage, level, level );
+   P2Function< real_t > residual( "residual", storage, level, level );
+   P2Function< real_t > err( "err", storage, level, level );
+
+   std::function< real_t( const Point3D& ) > boundary = []( const Point3D& p ) { return std::sin( pi * p[0] ) + p[1]; };
+   std::function< real_t( const Point3D& ) > rhs      = []( const Point3D& p ) { return p[0] * p[1] + real_c( 1 ); };
+
+   P2ConstantUnsteadyDiffusionOperator A( storage, level, level, 1.0, 1.0, DiffusionTimeIntegrator::ImplicitEuler );
+
+   PETScLUSolver< P2ConstantUnsteadyDiffusionOperator > solver( storage, level );
+   solver.assumeSymmetry( false );
+   solver.reassembleMatrix( true );
+
+   for ( const real_t dt : {1.0, 1e-1, 1e-3, 5e-2} )
+   {
+      A.setDt( dt );
+
+      b.interpolate( rhs, level, Inner );
+      x.interpolate( real_c( 0 ), level, All );
+      x.interpolate( boundary, level, DirichletBoundary );
+      xReference.assign( {1.0}, {x}, level, All );
+
+      solver.solve( A, x, b, level );
+
+      PETScLUSolver< P2ConstantUnsteadyDiffusionOperator > referenceSolver( storage, level );
+      referenceSolver.assumeSymmetry( false );
+      referenceSolver.solve( A, xReference, b, level );
+
+      A.apply( x, residual, level, Inner );
+      residual.assign( {1.0, -1.0}, {residual, b}, level, Inner );
+      const real_t residualNorm = std::sqrt( residual.dotGlobal( residual, level, Inner ) );
+
+      err.assign( {1.0, -1.0}, {x, xReference}, level, All );
+      const real_t difference = err.getMaxMagnitude( level, All );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "dt = " << dt << ": residual " << residualNorm << ", max difference to new solver "
+                                         << difference );
+      WALBERLA_CHECK_LESS( residualNorm, 1e-10 );
+      WALBERLA_CHECK_LESS( difference, 1e-12 );
+   }
+}
+
+} // namespace hyteg
+
+using namespace hyteg;
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::logging::Logging::instance()->setLogLevel( walberla::logging::Logging::PROGRESS );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   PETScManager petscManager( &argc, &argv );
+
+   petscRefactorizationTest( 3, "../../data/meshes/quad_8el.msh" );
+   petscRefactorizationTest( 2, "../../data/meshes/3D/cube_24el.msh" );
+
+   return EXIT_SUCCESS;
+}
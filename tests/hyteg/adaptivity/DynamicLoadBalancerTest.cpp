@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/DynamicLoadBalancer.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+namespace hyteg {
+
+static void testDynamicLoadBalancer( const std::string& meshFile, const uint_t& level )
+{
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+   const uint_t rank         = uint_c( walberla::mpi::MPIManager::instance()->rank() );
+
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, numProcesses );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+
+   // start with a maximal imbalance
+   loadbalancing::allPrimitivesOnRoot( setupStorage );
+   auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   P2ConstantLaplaceOperator L( storage, level, level );
+
+   P2Function< real_t > u( "u", storage, level, level );
+   P2Function< real_t > f( "f", storage, level, level );
+
+   std::function< real_t( const hyteg::Point3D& ) > exact = []( const hyteg::Point3D& x ) { return sin( x[0] ) * sinh( x[1] ); };
+   u.interpolate( exact, level, All );
+   L.apply( u, f, level, All );
+
+   const auto u_norm_before = u.dotGlobal( u, level, All );
+   const auto f_norm_before = f.dotGlobal( f, level, All );
+
+   uint_t numCallbacks = 0;
+
+   loadbalancing::DynamicLoadBalancer balancer( storage, 5, 1.1 );
+   balancer.addMigrationCallback( [&numCallbacks]() { numCallbacks++; } );
+
+   WALBERLA_CHECK_FLOAT_EQUAL( balancer.computeImbalance(), real_c( numProcesses ) );
+
+   // the imbalance is only checked every fifth step
+   for ( uint_t step = 1; step <= 10; step++ )
+   {
+      const bool migrated = balancer.step();
+      WALBERLA_CHECK_EQUAL( migrated, step == 5 && numProcesses > 1 );
+   }
+
+   const uint_t expectedMigrations = numProcesses > 1 ? 1 : 0;
+   WALBERLA_CHECK_EQUAL( balancer.getNumberOfMigrations(), expectedMigrations );
+   WALBERLA_CHECK_EQUAL( numCallbacks, expectedMigrations );
+
+   // the number of volume primitives is divisible by the number of processes
+   WALBERLA_CHECK_FLOAT_EQUAL( balancer.computeImbalance(), real_c( 1 ) );
+   WALBERLA_CHECK( !balancer.rebalance() );
+
+   // the primitives on root become ten times as expensive
+   std::vector< PrimitiveID > cellIDs;
+   storage->getCellIDs( cellIDs );
+   if ( rank == 0 )
+   {
+      for ( const auto& id : cellIDs )
+      {
+         balancer.addCost( id, 9 );
+      }
+   }
+
+   if ( numProcesses > 1 )
+   {
+      WALBERLA_CHECK_GREATER( balancer.computeImbalance(), real_c( 1.1 ) );
+   }
+   WALBERLA_CHECK_EQUAL( balancer.rebalance(), numProcesses > 1 );
+   WALBERLA_CHECK_EQUAL( numCallbacks, 2 * expectedMigrations );
+
+   // functions and operators must still be consistent after the migration
+   L.apply( u, f, level, All );
+
+   const auto u_norm_after = u.dotGlobal( u, level, All );
+   const auto f_norm_after = f.dotGlobal( f, level, All );
+
+   WALBERLA_CHECK_FLOAT_EQUAL( u_norm_before, u_norm_after );
+   WALBERLA_CHECK_FLOAT_EQUAL( f_norm_before, f_norm_after );
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testDynamicLoadBalancer( "../../data/meshes/3D/cube_24el.msh", 2 );
+
+   return EXIT_SUCCESS;
+}
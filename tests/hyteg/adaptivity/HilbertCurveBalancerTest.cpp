@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/DistributedBalancer.hpp"
+#include "hyteg/primitivestorage/loadbalancing/DistributionQuality.hpp"
+#include "hyteg/primitivestorage/loadbalancing/HilbertCurve.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+namespace hyteg {
+
+static void testHilbertIndex()
+{
+   // the 2D curve of order 1 visits the quadrants in the order (0,0), (0,1), (1,1), (1,0)
+   const Point3D minCorner( {0, 0, 0} );
+   const Point3D maxCorner( {1, 1, 0} );
+   WALBERLA_CHECK_EQUAL( loadbalancing::hilbertIndex( Point3D( {0.25, 0.25, 0} ), minCorner, maxCorner, 2, 1 ), walberla::uint64_c( 0 ) );
+   WALBERLA_CHECK_EQUAL( loadbalancing::hilbertIndex( Point3D( {0.25, 0.75, 0} ), minCorner, maxCorner, 2, 1 ), walberla::uint64_c( 1 ) );
+   WALBERLA_CHECK_EQUAL( loadbalancing::hilbertIndex( Point3D( {0.75, 0.75, 0} ), minCorner, maxCorner, 2, 1 ), walberla::uint64_c( 2 ) );
+   WALBERLA_CHECK_EQUAL( loadbalancing::hilbertIndex( Point3D( {0.75, 0.25, 0} ), minCorner, maxCorner, 2, 1 ), walberla::uint64_c( 3 ) );
+
+   // consecutive cells along the 3D curve must be face neighbors
+   const uint_t           bits     = 3;
+   const uint_t           numCells = 1 << bits;
+   std::vector< Point3D > cellOnCurve( numCells * numCells * numCells );
+   for ( uint_t i = 0; i < numCells; i++ )
+   {
+      for ( uint_t j = 0; j < numCells; j++ )
+      {
+         for ( uint_t k = 0; k < numCells; k++ )
+         {
+            const Point3D center( {( real_c( i ) + 0.5 ) / real_c( numCells ),
+                                   ( real_c( j ) + 0.5 ) / real_c( numCells ),
+                                   ( real_c( k ) + 0.5 ) / real_c( numCells )} );
+            const auto index = loadbalancing::hilbertIndex( center, Point3D( {0, 0, 0} ), Point3D( {1, 1, 1} ), 3, bits );
+            WALBERLA_CHECK_LESS( index, cellOnCurve.size() );
+            cellOnCurve[index] = center;
+         }
+      }
+   }
+   for ( uint_t index = 1; index < cellOnCurve.size(); index++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( ( cellOnCurve[index] - cellOnCurve[index - 1] ).norm(), 1.0 / real_c( numCells ) );
+   }
+}
+
+static void testHilbertCurveBalancer( const std::string& meshFile )
+{
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   MeshInfo mesh = MeshInfo::fromGmshFile( meshFile );
+
+   SetupPrimitiveStorage roundRobinStorage( mesh, numProcesses );
+   loadbalancing::roundRobin( roundRobinStorage );
+   const auto roundRobinQuality = loadbalancing::distributionQuality( roundRobinStorage );
+
+   SetupPrimitiveStorage hilbertStorage( mesh, numProcesses );
+   loadbalancing::hilbertCurve( hilbertStorage );
+   const auto hilbertQuality = loadbalancing::distributionQuality( hilbertStorage );
+
+   WALBERLA_LOG_INFO_ON_ROOT( meshFile << " on " << numProcesses << " processes" );
+   WALBERLA_LOG_INFO_ON_ROOT( "  round robin:   " << roundRobinQuality );
+   WALBERLA_LOG_INFO_ON_ROOT( "  Hilbert curve: " << hilbertQuality );
+
+   WALBERLA_CHECK_LESS_EQUAL( hilbertQuality.edgeCut, roundRobinQuality.edgeCut );
+   WALBERLA_CHECK_LESS_EQUAL( hilbertQuality.maxNeighborRanks, roundRobinQuality.maxNeighborRanks );
+
+   // the parallel algorithm must result in the same distribution
+   auto storage = std::make_shared< PrimitiveStorage >( roundRobinStorage );
+   WALBERLA_CHECK_EQUAL( loadbalancing::distributionQuality( *storage ).edgeCut, roundRobinQuality.edgeCut );
+
+   loadbalancing::distributed::hilbertCurve( *storage );
+
+   const auto distributedQuality = loadbalancing::distributionQuality( *storage );
+   WALBERLA_CHECK_EQUAL( distributedQuality.edgeCut, hilbertQuality.edgeCut );
+   WALBERLA_CHECK_EQUAL( distributedQuality.maxNeighborRanks, hilbertQuality.maxNeighborRanks );
+   WALBERLA_CHECK_EQUAL( distributedQuality.maxPrimitivesPerRank, hilbertQuality.maxPrimitivesPerRank );
+
+   const uint_t rank = uint_c( walberla::mpi::MPIManager::instance()->rank() );
+   for ( const auto& primitiveID : storage->getPrimitiveIDs() )
+   {
+      WALBERLA_CHECK_EQUAL( hilbertStorage.getTargetRank( primitiveID ), rank );
+   }
+
+   // repartitioning with the same weights and minimal migration must keep all primitives in place
+   const auto repartitioning = loadbalancing::distributed::hilbertCurve(
+       *storage, []( const PrimitiveID& ) { return real_c( 1 ); }, true );
+   for ( const auto& it : repartitioning.getMap() )
+   {
+      WALBERLA_CHECK_EQUAL( it.second, rank );
+   }
+
+   // weighted distribution: the volume primitives on the first half of the processes are ten times as expensive
+   const auto weight = [&hilbertStorage]( const PrimitiveID& id ) {
+      return hilbertStorage.getTargetRank( id ) < hilbertStorage.getNumberOfProcesses() / 2 ? real_c( 10 ) : real_c( 1 );
+   };
+
+   SetupPrimitiveStorage weightedStorage( mesh, numProcesses );
+   loadbalancing::hilbertCurve( weightedStorage, weight );
+
+   std::vector< PrimitiveID > volumePrimitiveIDs;
+   if ( hilbertStorage.getNumberOfCells() > 0 )
+   {
+      for ( const auto& it : hilbertStorage.getCells() )
+      {
+         volumePrimitiveIDs.push_back( it.first );
+      }
+   }
+   else
+   {
+      for ( const auto& it : hilbertStorage.getFaces() )
+      {
+         volumePrimitiveIDs.push_back( it.first );
+      }
+   }
+
+   std::vector< real_t > weightPerRank( numProcesses, 0 );
+   real_t                totalWeight = 0;
+   for ( const auto& id : volumePrimitiveIDs )
+   {
+      weightPerRank[weightedStorage.getTargetRank( id )] += weight( id );
+      totalWeight += weight( id );
+   }
+
+   // contiguous chunks deviate from the average weight by at most the largest single weight
+   for ( const auto& weightOnRank : weightPerRank )
+   {
+      WALBERLA_CHECK_LESS_EQUAL( std::abs( weightOnRank - totalWeight / real_c( numProcesses ) ), real_c( 10 ) );
+   }
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testHilbertIndex();
+   hyteg::testHilbertCurveBalancer( "../../data/meshes/quad_184el.msh" );
+   hyteg::testHilbertCurveBalancer( "../../data/meshes/3D/cube_24el.msh" );
+   hyteg::testHilbertCurveBalancer( "../../data/meshes/3D/cube_4120el.msh" );
+
+   return EXIT_SUCCESS;
+}
@@ -177,6 +177,30 @@ void runTest0( std::string tag ) {
     WALBERLA_ASSERT_FLOAT_EQUAL( std::sqrt(mapped[k].normSq()), rad );
   }
 
+  // check 3
+  WALBERLA_LOG_INFO_ON_ROOT( " Checking batched and fused evaluation:" );
+  const GeometryMap& map = myMap;
+
+  std::vector< Point3D > points( sample.begin(), sample.end() );
+  std::vector< Point3D > batch;
+  map.evalF( points, batch );
+  WALBERLA_CHECK_EQUAL( batch.size(), nSamples );
+
+  for( uint_t k = 0; k < nSamples; k++ ) {
+    Point3D  single, fused;
+    Matrix2r DF, DFfused;
+    map.evalF( sample[k], single );
+    map.evalDF( sample[k], DF );
+    map.evalFAndDF( sample[k], fused, DFfused );
+    for( uint_t i = 0; i < 2; i++ ) {
+      WALBERLA_CHECK_LESS( std::abs( batch[k][i] - single[i] ), 1e-14 );
+      WALBERLA_CHECK_LESS( std::abs( fused[i] - single[i] ), 1e-14 );
+      for( uint_t j = 0; j < 2; j++ ) {
+        WALBERLA_CHECK_LESS( std::abs( DFfused( i, j ) - DF( i, j ) ), 1e-14 );
+      }
+    }
+  }
+
 }
 
 
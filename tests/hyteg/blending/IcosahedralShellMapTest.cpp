@@ -56,6 +56,54 @@ void testInverse()
    }
 }
 
+
+void testBatchedAndFusedEvaluation()
+{
+   const uint_t level = 3;
+   auto meshInfo = MeshInfo::meshSphericalShell( 5, 2, 0.5, 1.0 );
+   auto setupStorage = std::make_shared< SetupPrimitiveStorage >( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   auto storage = std::make_shared< PrimitiveStorage >( *setupStorage );
+
+   for ( const auto & it : storage->getCells() )
+   {
+      auto cell = it.second;
+      IcosahedralShellMap geometryMap( *cell, *setupStorage );
+      const GeometryMap & map = geometryMap;
+
+      std::vector< Point3D > positions;
+      for ( const auto & idx : vertexdof::macrocell::Iterator( level ) )
+      {
+         positions.push_back( vertexdof::macrocell::coordinateFromIndex( level, *cell, idx ) );
+      }
+
+      std::vector< Point3D > mappedPositions;
+      map.evalF( positions, mappedPositions );
+      WALBERLA_CHECK_EQUAL( mappedPositions.size(), positions.size() );
+
+      for ( uint_t i = 0; i < positions.size(); i++ )
+      {
+         Point3D  mappedPosition;
+         Point3D  fusedPosition;
+         Matrix3r jacobian;
+         Matrix3r fusedJacobian;
+         map.evalF( positions[i], mappedPosition );
+         const real_t det      = map.evalDF( positions[i], jacobian );
+         const real_t fusedDet = map.evalFAndDF( positions[i], fusedPosition, fusedJacobian );
+
+         WALBERLA_CHECK_LESS( ( mappedPositions[i] - mappedPosition ).norm(), 1e-14 );
+         WALBERLA_CHECK_LESS( ( fusedPosition - mappedPosition ).norm(), 1e-14 );
+         WALBERLA_CHECK_LESS( std::abs( fusedDet - det ), 1e-14 );
+         for ( uint_t j = 0; j < 3; j++ )
+         {
+            for ( uint_t k = 0; k < 3; k++ )
+            {
+               WALBERLA_CHECK_LESS( std::abs( fusedJacobian( j, k ) - jacobian( j, k ) ), 1e-14 );
+            }
+         }
+      }
+   }
+}
+
 }
 
 int main( int argc, char ** argv )
@@ -65,5 +113,6 @@ int main( int argc, char ** argv )
    walberla::MPIManager::instance()->useWorldComm();
 
    hyteg::testInverse();
+   hyteg::testBatchedAndFusedEvaluation();
    return 0;
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/DataTypes.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/composites/P2P1TaylorHoodStokesOperator.hpp"
+#include "hyteg/elementwiseoperators/P2P1ElementwiseBlendingStokesOperator.hpp"
+#include "hyteg/geometry/AnnulusMap.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// This test checks that the monolithic apply of the Taylor-Hood Stokes operators
+// gives the same result as the blockwise application of the individual operators.
+
+using walberla::real_t;
+using namespace hyteg;
+
+template < typename StokesOperatorType >
+void compareFusedApply( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t level )
+{
+   const real_t epsilon = 1e-12;
+
+   P2P1TaylorHoodFunction< real_t > src( "src", storage, level, level );
+   P2P1TaylorHoodFunction< real_t > dstBlockwise( "dstBlockwise", storage, level, level );
+   P2P1TaylorHoodFunction< real_t > dstFused( "dstFused", storage, level, level );
+   P2P1TaylorHoodFunction< real_t > error( "error", storage, level, level );
+
+   StokesOperatorType blockwiseOp( storage, level, level );
+   StokesOperatorType fusedOp( storage, level, level );
+   blockwiseOp.setFusedApply( false );
+   fusedOp.setFusedApply( true );
+
+   auto vel_x    = []( const Point3D& p ) { return std::sin( p[0] ) + std::sin( 1.3 * p[1] ) + std::sin( 1.7 * p[2] ); };
+   auto vel_y    = []( const Point3D& p ) { return std::sin( p[0] ) + std::sin( 2.3 * p[1] ) + std::sin( 2.7 * p[2] ); };
+   auto vel_z    = []( const Point3D& p ) { return std::sin( p[0] ) + std::sin( 3.3 * p[1] ) + std::sin( 3.7 * p[2] ); };
+   auto pressure = []( const Point3D& p ) { return p[0] * p[0] * p[0] + std::cos( p[1] * p[2] ); };
+
+   src.uvw.u.interpolate( vel_x, level, All );
+   src.uvw.v.interpolate( vel_y, level, All );
+   if ( storage->hasGlobalCells() )
+   {
+      src.uvw.w.interpolate( vel_z, level, All );
+   }
+   src.p.interpolate( pressure, level, All );
+
+   for ( const auto& flag : {All, Inner | NeumannBoundary} )
+   {
+      // the destination is prefilled, so that the check also covers the DoFs that are not touched by the apply
+      dstBlockwise.interpolate( real_c( 1 ), level, All );
+      dstFused.interpolate( real_c( 1 ), level, All );
+
+      blockwiseOp.apply( src, dstBlockwise, level, flag );
+      fusedOp.apply( src, dstFused, level, flag );
+
+      error.assign( {1.0, -1.0}, {dstBlockwise, dstFused}, level, All );
+
+      for ( uint_t k = 0; k < error.uvw.getDimension(); k++ )
+      {
+         const real_t errorMax = error.uvw[k].getMaxMagnitude( level );
+         WALBERLA_LOG_INFO_ON_ROOT( "velocity component " << k << ": max difference " << errorMax )
+         WALBERLA_CHECK_LESS( errorMax, epsilon );
+      }
+      const real_t errorMaxP = error.p.getMaxMagnitude( level );
+      WALBERLA_LOG_INFO_ON_ROOT( "pressure: max difference " << errorMaxP )
+      WALBERLA_CHECK_LESS( errorMaxP, epsilon );
+   }
+}
+
+std::shared_ptr< PrimitiveStorage > createStorage( const MeshInfo& meshInfo, bool annulusMap = false )
+{
+   SetupPrimitiveStorage setupStorage( meshInfo, walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   if ( annulusMap )
+   {
+      AnnulusMap::setMap( setupStorage );
+   }
+   loadbalancing::roundRobin( setupStorage );
+   return std::make_shared< PrimitiveStorage >( setupStorage );
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   auto storage2D      = createStorage( MeshInfo::fromGmshFile( "../../data/meshes/quad_16el.msh" ) );
+   auto storage3D      = createStorage( MeshInfo::fromGmshFile( "../../data/meshes/3D/pyramid_tilted_4el.msh" ) );
+   auto storageAnnulus = createStorage( MeshInfo::meshAnnulus( 1.0, 2.0, MeshInfo::CRISS, 6, 2 ), true );
+
+   for ( uint_t level = 2; level <= 3; level++ )
+   {
+      WALBERLA_LOG_INFO_ON_ROOT( "Constant stencils, 2D, level " << level )
+      compareFusedApply< P2P1TaylorHoodStokesOperator >( storage2D, level );
+      WALBERLA_LOG_INFO_ON_ROOT( "Constant stencils, 3D, level " << level )
+      compareFusedApply< P2P1TaylorHoodStokesOperator >( storage3D, level );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "Elementwise blending, 2D, level " << level )
+      compareFusedApply< P2P1ElementwiseBlendingStokesOperator >( storage2D, level );
+      WALBERLA_LOG_INFO_ON_ROOT( "Elementwise blending, 2D annulus, level " << level )
+      compareFusedApply< P2P1ElementwiseBlendingStokesOperator >( storageAnnulus, level );
+      WALBERLA_LOG_INFO_ON_ROOT( "Elementwise blending, 3D, level " << level )
+      compareFusedApply< P2P1ElementwiseBlendingStokesOperator >( storage3D, level );
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/Environment.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticProlongation.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/FusedResidualRestriction.hpp"
+#include "hyteg/solvers/GaussSeidelSmoother.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using walberla::math::pi;
+
+using namespace hyteg;
+
+/// Runs the same V-cycles with and without the fused residual computation and restriction
+/// and checks that the iterates agree after each cycle.
+template < typename OperatorType, typename FunctionType, typename RestrictionType, typename ProlongationType >
+void testFusedVCycles( const std::string& meshFile, const uint_t& minLevel, const uint_t& maxLevel )
+{
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   OperatorType A( storage, minLevel, maxLevel );
+
+   FunctionType u( "u", storage, minLevel, maxLevel );
+   FunctionType uFused( "uFused", storage, minLevel, maxLevel );
+   FunctionType f( "f", storage, minLevel, maxLevel );
+   FunctionType fFused( "fFused", storage, minLevel, maxLevel );
+   FunctionType err( "err", storage, minLevel, maxLevel );
+
+   std::function< real_t( const Point3D& ) > boundary = []( const Point3D& p ) {
+      return std::sin( pi * p[0] ) * std::cos( 2 * pi * p[1] ) + p[2];
+   };
+   std::function< real_t( const Point3D& ) > rhs = []( const Point3D& p ) { return std::exp( p[0] * p[1] ) - p[2] * p[2]; };
+
+   u.interpolate( boundary, maxLevel, DirichletBoundary );
+   uFused.interpolate( boundary, maxLevel, DirichletBoundary );
+   f.interpolate( rhs, maxLevel, All );
+   fFused.interpolate( rhs, maxLevel, All );
+
+   auto smoother         = std::make_shared< GaussSeidelSmoother< OperatorType > >();
+   auto coarseGridSolver = std::make_shared< CGSolver< OperatorType > >( storage, minLevel, minLevel, 10000, 1e-16 );
+   auto restriction      = std::make_shared< RestrictionType >();
+   auto prolongation     = std::make_shared< ProlongationType >();
+
+   GeometricMultigridSolver< OperatorType > gmg(
+       storage, smoother, coarseGridSolver, restriction, prolongation, minLevel, maxLevel, 2, 2 );
+   GeometricMultigridSolver< OperatorType > gmgFused(
+       storage, smoother, coarseGridSolver, restriction, prolongation, minLevel, maxLevel, 2, 2 );
+   gmg.setFusedResidualRestriction( false );
+   gmgFused.setFusedResidualRestriction( true );
+
+   const bool fusedAvailable = FusedResidualRestriction< OperatorType >::isAvailable( A, *restriction );
+   WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << "] fused kernel available: " << ( fusedAvailable ? "yes" : "no" ) );
+
+   for ( uint_t cycle = 0; cycle < 4; cycle++ )
+   {
+      gmg.solve( A, u, f, maxLevel );
+      gmgFused.solve( A, uFused, fFused, maxLevel );
+
+      err.assign( { 1.0, -1.0 }, { u, uFused }, maxLevel, All );
+      const real_t maxError = err.getMaxMagnitude( maxLevel, All );
+      const real_t maxValue = u.getMaxMagnitude( maxLevel, All );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "  after cycle " << cycle << ": max difference " << maxError << ", max magnitude "
+                                                  << maxValue );
+      WALBERLA_CHECK_GREATER( maxValue, 0.0 );
+      WALBERLA_CHECK_LESS( maxError, 1e-10 * maxValue );
+   }
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::logging::Logging::instance()->setLogLevel( walberla::logging::Logging::PROGRESS );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   testFusedVCycles< P1ConstantLaplaceOperator, P1Function< real_t >, P1toP1LinearRestriction, P1toP1LinearProlongation >(
+       "../../data/meshes/quad_8el.msh", 0, 5 );
+   testFusedVCycles< P1ConstantLaplaceOperator, P1Function< real_t >, P1toP1LinearRestriction, P1toP1LinearProlongation >(
+       "../../data/meshes/3D/cube_6el.msh", 0, 4 );
+
+   testFusedVCycles< P2ConstantLaplaceOperator, P2Function< real_t >, P2toP2QuadraticRestriction, P2toP2QuadraticProlongation >(
+       "../../data/meshes/quad_8el.msh", 0, 4 );
+   testFusedVCycles< P2ConstantLaplaceOperator, P2Function< real_t >, P2toP2QuadraticRestriction, P2toP2QuadraticProlongation >(
+       "../../data/meshes/3D/cube_6el.msh", 0, 3 );
+
+   return 0;
+}
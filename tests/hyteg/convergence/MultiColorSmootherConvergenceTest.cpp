@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/logging/Logging.h"
+#include "core/math/Random.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticProlongation.hpp"
+#include "hyteg/gridtransferoperators/P2toP2QuadraticRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2ConstantOperator.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/GaussSeidelSmoother.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+#include "hyteg/solvers/MultiColorGaussSeidelSmoother.hpp"
+#include "hyteg/solvers/MultiColorSORSmoother.hpp"
+
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+
+namespace hyteg {
+
+/// Runs a few V-cycles with the passed smoother and returns the average residual convergence rate.
+template < typename FunctionType, typename OperatorType, typename RestrictionOperatorType, typename ProlongationOperatorType >
+static real_t averageConvergenceRate( const std::shared_ptr< PrimitiveStorage >&       storage,
+                                      const std::shared_ptr< Solver< OperatorType > >& smoother,
+                                      const uint_t&                                    minLevel,
+                                      const uint_t&                                    maxLevel,
+                                      const uint_t&                                    numVCycles )
+{
+   std::function< real_t( const hyteg::Point3D& ) > exact = []( const hyteg::Point3D& p ) -> real_t {
+      return sin( p[0] ) * sinh( p[1] ) * ( 1 + p[2] );
+   };
+
+   std::function< real_t( const hyteg::Point3D& ) > rand = []( const hyteg::Point3D& ) -> real_t {
+      return walberla::math::realRandom( 0.0, 1.0 );
+   };
+
+   FunctionType u( "u", storage, minLevel, maxLevel );
+   FunctionType f( "f", storage, minLevel, maxLevel );
+   FunctionType Au( "Au", storage, minLevel, maxLevel );
+   FunctionType r( "r", storage, minLevel, maxLevel );
+
+   OperatorType A( storage, minLevel, maxLevel );
+
+   walberla::math::seedRandomGenerator( 42 );
+   u.interpolate( rand, maxLevel, Inner );
+   u.interpolate( exact, maxLevel, DirichletBoundary );
+
+   const auto residualNorm = [&]() -> real_t {
+      A.apply( u, Au, maxLevel, Inner );
+      r.assign( { 1.0, -1.0 }, { f, Au }, maxLevel, Inner );
+      return std::sqrt( r.dotGlobal( r, maxLevel, Inner ) );
+   };
+
+   auto coarseGridSolver     = std::make_shared< CGSolver< OperatorType > >( storage, minLevel, minLevel );
+   auto restrictionOperator  = std::make_shared< RestrictionOperatorType >();
+   auto prolongationOperator = std::make_shared< ProlongationOperatorType >();
+
+   GeometricMultigridSolver< OperatorType > gmg(
+       storage, smoother, coarseGridSolver, restrictionOperator, prolongationOperator, minLevel, maxLevel, 2, 2 );
+
+   const real_t initialResidual = residualNorm();
+   for ( uint_t i = 0; i < numVCycles; i++ )
+   {
+      gmg.solve( A, u, f, maxLevel );
+   }
+   return std::pow( residualNorm() / initialResidual, 1.0 / real_t( numVCycles ) );
+}
+
+template < typename FunctionType, typename OperatorType, typename RestrictionOperatorType, typename ProlongationOperatorType >
+static void testMultiColorSmoothers( const std::string& meshFile, const uint_t& maxLevel, const real_t& maxRate )
+{
+   const uint_t minLevel   = 0;
+   const uint_t numVCycles = 5;
+
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   const real_t rateLexicographic =
+       averageConvergenceRate< FunctionType, OperatorType, RestrictionOperatorType, ProlongationOperatorType >(
+           storage, std::make_shared< GaussSeidelSmoother< OperatorType > >(), minLevel, maxLevel, numVCycles );
+   const real_t rateMultiColorGS =
+       averageConvergenceRate< FunctionType, OperatorType, RestrictionOperatorType, ProlongationOperatorType >(
+           storage, std::make_shared< MultiColorGaussSeidelSmoother< OperatorType > >(), minLevel, maxLevel, numVCycles );
+   const real_t rateMultiColorSOR =
+       averageConvergenceRate< FunctionType, OperatorType, RestrictionOperatorType, ProlongationOperatorType >(
+           storage, std::make_shared< MultiColorSORSmoother< OperatorType > >( 1.1 ), minLevel, maxLevel, numVCycles );
+
+   WALBERLA_LOG_INFO_ON_ROOT( meshFile << ", level " << maxLevel << ": average convergence rate lexicographic GS "
+                                       << rateLexicographic << ", multi-color GS " << rateMultiColorGS << ", multi-color SOR "
+                                       << rateMultiColorSOR );
+
+   WALBERLA_CHECK_LESS( rateLexicographic, maxRate );
+   WALBERLA_CHECK_LESS( rateMultiColorGS, maxRate );
+   WALBERLA_CHECK_LESS( rateMultiColorSOR, maxRate );
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   using namespace hyteg;
+
+   testMultiColorSmoothers< P1Function< real_t >, P1ConstantLaplaceOperator, P1toP1LinearRestriction, P1toP1LinearProlongation >(
+       "../../data/meshes/quad_16el.msh", 5, 0.2 );
+   testMultiColorSmoothers< P1Function< real_t >, P1ConstantLaplaceOperator, P1toP1LinearRestriction, P1toP1LinearProlongation >(
+       "../../data/meshes/3D/cube_6el.msh", 4, 0.2 );
+
+   testMultiColorSmoothers< P2Function< real_t >,
+                            P2ConstantLaplaceOperator,
+                            P2toP2QuadraticRestriction,
+                            P2toP2QuadraticProlongation >( "../../data/meshes/quad_16el.msh", 4, 0.4 );
+   testMultiColorSmoothers< P2Function< real_t >,
+                            P2ConstantLaplaceOperator,
+                            P2toP2QuadraticRestriction,
+                            P2toP2QuadraticProlongation >( "../../data/meshes/3D/cube_6el.msh", 3, 0.4 );
+
+   return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/Environment.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+
+#include "hyteg/Operator.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/BiCGStabSolver.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/FGMRESSolver.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+#include "hyteg/solvers/SymmetricGaussSeidelSmoother.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using walberla::math::pi;
+
+using namespace hyteg;
+
+/// Non-symmetric operator -Laplace(u) + c * du/dx.
+class ConvectionDiffusionOperator : public Operator< P1Function< real_t >, P1Function< real_t > >
+{
+ public:
+   ConvectionDiffusionOperator( const std::shared_ptr< PrimitiveStorage >& storage,
+                                const uint_t&                              minLevel,
+                                const uint_t&                              maxLevel,
+                                const real_t&                              velocity )
+   : Operator( storage, minLevel, maxLevel )
+   , laplace_( storage, minLevel, maxLevel )
+   , divx_( storage, minLevel, maxLevel )
+   , tmp_( "tmp", storage, minLevel, maxLevel )
+   , velocity_( velocity )
+   {}
+
+   void apply( const P1Function< real_t >& src,
+               const P1Function< real_t >& dst,
+               const uint_t&               level,
+               const DoFType&              flag,
+               const UpdateType&           updateType = Replace ) const
+   {
+      laplace_.apply( src, dst, level, flag, updateType );
+      divx_.apply( src, tmp_, level, flag, Replace );
+      dst.add( {velocity_}, {tmp_}, level, flag );
+   }
+
+   const P1ConstantLaplaceOperator& getLaplaceOperator() const { return laplace_; }
+
+ private:
+   P1ConstantLaplaceOperator laplace_;
+   P1DivxOperator            divx_;
+   P1Function< real_t >      tmp_;
+   real_t                    velocity_;
+};
+
+/// Applies a multigrid cycle for the diffusion part of the operator.
+class DiffusionGMGPreconditioner : public Solver< ConvectionDiffusionOperator >
+{
+ public:
+   explicit DiffusionGMGPreconditioner( const std::shared_ptr< Solver< P1ConstantLaplaceOperator > >& gmg )
+   : gmg_( gmg )
+   {}
+
+   void solve( const ConvectionDiffusionOperator& A,
+               const P1Function< real_t >&        x,
+               const P1Function< real_t >&        b,
+               const uint_t                       level ) override
+   {
+      gmg_->solve( A.getLaplaceOperator(), x, b, level );
+   }
+
+ private:
+   std::shared_ptr< Solver< P1ConstantLaplaceOperator > > gmg_;
+};
+
+std::shared_ptr< Solver< P1ConstantLaplaceOperator > > createGMG( const std::shared_ptr< PrimitiveStorage >& storage,
+                                                                  const uint_t&                              level )
+{
+   auto smoother     = std::make_shared< SymmetricGaussSeidelSmoother< P1ConstantLaplaceOperator > >();
+   auto coarseSolver = std::make_shared< CGSolver< P1ConstantLaplaceOperator > >( storage, 0, level );
+   auto restriction  = std::make_shared< P1toP1LinearRestriction >();
+   auto prolongation = std::make_shared< P1toP1LinearProlongation >();
+   return std::make_shared< GeometricMultigridSolver< P1ConstantLaplaceOperator > >(
+       storage, smoother, coarseSolver, restriction, prolongation, 0, level, 2, 2 );
+}
+
+/// Solves A u = M f with Dirichlet boundary conditions and returns the norm of the final residual relative to the
+/// initial residual.
+template < typename OperatorType, typename SolverType >
+real_t solveAndComputeRelativeResidual( const std::shared_ptr< PrimitiveStorage >& storage,
+                                        const uint_t&                              level,
+                                        const OperatorType&                        A,
+                                        const std::shared_ptr< SolverType >&       solver,
+                                        P1Function< real_t >&                      u )
+{
+   P1ConstantMassOperator M( storage, level, level );
+
+   P1Function< real_t > f( "f", storage, level, level );
+   P1Function< real_t > b( "b", storage, level, level );
+   P1Function< real_t > r( "r", storage, level, level );
+
+   std::function< real_t( const Point3D& ) > boundary = []( const Point3D& p ) { return std::sin( pi * p[0] ) * p[1]; };
+
+   f.interpolate( []( const Point3D& p ) { return real_c( 1 ) + p[0] * p[0]; }, level, All );
+   M.apply( f, b, level, All );
+
+   u.interpolate( real_c( 0 ), level, All );
+   u.interpolate( boundary, level, DirichletBoundary );
+
+   A.apply( u, r, level, Inner );
+   r.assign( {1.0, -1.0}, {b, r}, level, Inner );
+   const real_t initialResidual = std::sqrt( r.dotGlobal( r, level, Inner ) );
+
+   solver->solve( A, u, b, level );
+
+   A.apply( u, r, level, Inner );
+   r.assign( {1.0, -1.0}, {b, r}, level, Inner );
+   return std::sqrt( r.dotGlobal( r, level, Inner ) ) / initialResidual;
+}
+
+void testNonSymmetricSolvers( const std::string& meshFile, const uint_t& level )
+{
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   P1Function< real_t > uFGMRES( "uFGMRES", storage, 0, level );
+   P1Function< real_t > uBiCGStab( "uBiCGStab", storage, 0, level );
+   P1Function< real_t > err( "err", storage, level, level );
+
+   // symmetric problem, FGMRES with a multigrid preconditioner vs. CG
+   {
+      P1ConstantLaplaceOperator L( storage, 0, level );
+      P1Function< real_t >      uCG( "uCG", storage, 0, level );
+
+      auto fgmres = std::make_shared< FGMRESSolver< P1ConstantLaplaceOperator > >(
+          storage, 0, level, 10, 100, 1e-14, createGMG( storage, level ) );
+      auto cg = std::make_shared< CGSolver< P1ConstantLaplaceOperator > >( storage, level, level, 10000, 1e-14 );
+
+      const real_t residualFGMRES = solveAndComputeRelativeResidual( storage, level, L, fgmres, uFGMRES );
+      solveAndComputeRelativeResidual( storage, level, L, cg, uCG );
+
+      err.assign( {1.0, -1.0}, {uFGMRES, uCG}, level, All );
+      const real_t difference = err.getMaxMagnitude( level, All );
+      WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << "] Laplace, GMG-FGMRES: relative residual " << residualFGMRES
+                                     << ", max difference to CG: " << difference );
+      WALBERLA_CHECK_LESS( residualFGMRES, 1e-10 );
+      WALBERLA_CHECK_LESS( difference, 1e-10 );
+   }
+
+   // non-symmetric problem
+   const ConvectionDiffusionOperator A( storage, 0, level, real_c( 20 ) );
+
+   // unpreconditioned, with restarts
+   {
+      auto fgmres   = std::make_shared< FGMRESSolver< ConvectionDiffusionOperator > >( storage, 0, level, 50, 5000, 1e-12 );
+      auto bicgstab = std::make_shared< BiCGStabSolver< ConvectionDiffusionOperator > >( storage, 0, level, 5000, 1e-12 );
+
+      const real_t residualFGMRES   = solveAndComputeRelativeResidual( storage, level, A, fgmres, uFGMRES );
+      const real_t residualBiCGStab = solveAndComputeRelativeResidual( storage, level, A, bicgstab, uBiCGStab );
+
+      err.assign( {1.0, -1.0}, {uFGMRES, uBiCGStab}, level, All );
+      const real_t difference = err.getMaxMagnitude( level, All );
+      WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << "] convection-diffusion, FGMRES(50): relative residual "
+                                     << residualFGMRES << ", BiCGStab: relative residual " << residualBiCGStab
+                                     << ", max difference: " << difference );
+      WALBERLA_CHECK_LESS( residualFGMRES, 1e-8 );
+      WALBERLA_CHECK_LESS( residualBiCGStab, 1e-8 );
+      WALBERLA_CHECK_LESS( difference, 1e-8 );
+   }
+
+   // multigrid cycle for the diffusion part as preconditioner
+   {
+      auto preconditioner = std::make_shared< DiffusionGMGPreconditioner >( createGMG( storage, level ) );
+      auto fgmres =
+          std::make_shared< FGMRESSolver< ConvectionDiffusionOperator > >( storage, 0, level, 30, 100, 1e-12, preconditioner );
+      auto bicgstab =
+          std::make_shared< BiCGStabSolver< ConvectionDiffusionOperator > >( storage, 0, level, 100, 1e-12, preconditioner );
+      fgmres->setPrintInfo( true );
+
+      const real_t residualFGMRES   = solveAndComputeRelativeResidual( storage, level, A, fgmres, uFGMRES );
+      const real_t residualBiCGStab = solveAndComputeRelativeResidual( storage, level, A, bicgstab, uBiCGStab );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << "] convection-diffusion, GMG-FGMRES: relative residual "
+                                     << residualFGMRES << ", GMG-BiCGStab: relative residual " << residualBiCGStab );
+      WALBERLA_CHECK_LESS( residualFGMRES, 1e-8 );
+      WALBERLA_CHECK_LESS( residualBiCGStab, 1e-8 );
+   }
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::logging::Logging::instance()->setLogLevel( walberla::logging::Logging::PROGRESS );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   testNonSymmetricSolvers( "../../data/meshes/quad_8el.msh", 4 );
+   testNonSymmetricSolvers( "../../data/meshes/3D/cube_24el.msh", 3 );
+
+   return 0;
+}
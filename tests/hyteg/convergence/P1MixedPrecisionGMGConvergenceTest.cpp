@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/logging/Logging.h"
+#include "core/math/Random.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1ConstantReducedPrecisionOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/GaussSeidelSmoother.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+#include "hyteg/solvers/MixedPrecisionSolver.hpp"
+
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+
+namespace hyteg {
+
+/// Compares the single precision operator and grid transfers to their double precision counterparts.
+static void testSinglePrecisionComponents( const std::shared_ptr< PrimitiveStorage >& storage,
+                                           const uint_t&                              minLevel,
+                                           const uint_t&                              maxLevel )
+{
+   std::function< real_t( const hyteg::Point3D& ) > rand = []( const hyteg::Point3D& ) -> real_t {
+      return walberla::math::realRandom( 0.0, 1.0 );
+   };
+
+   P1Function< real_t > u( "u", storage, minLevel, maxLevel );
+   P1Function< real_t > v( "v", storage, minLevel, maxLevel );
+   P1Function< real_t > w( "w", storage, minLevel, maxLevel );
+   P1Function< real_t > err( "err", storage, minLevel, maxLevel );
+   P1Function< float >  u_f( "u_f", storage, minLevel, maxLevel );
+   P1Function< float >  v_f( "v_f", storage, minLevel, maxLevel );
+
+   P1ConstantLaplaceOperator         A( storage, minLevel, maxLevel );
+   P1ConstantSinglePrecisionOperator A_f( A );
+
+   P1toP1LinearRestriction                  restriction;
+   P1toP1LinearProlongation                 prolongation;
+   GenericP1toP1LinearRestriction< float >  restriction_f;
+   GenericP1toP1LinearProlongation< float > prolongation_f;
+
+   const auto maxError = [&]( const uint_t& level ) -> real_t {
+      w.copyFrom( v_f, level );
+      err.assign( {1.0, -1.0}, {v, w}, level, All );
+      return err.getMaxMagnitude( level, All );
+   };
+
+   walberla::math::seedRandomGenerator( 42 );
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      u.interpolate( rand, level, All );
+      u_f.copyFrom( u, level );
+   }
+
+   A.apply( u, v, maxLevel, Inner );
+   A_f.apply( u_f, v_f, maxLevel, Inner );
+   WALBERLA_CHECK_LESS( maxError( maxLevel ), 1e-5 );
+
+   v.assign( {1.0}, {u}, maxLevel, All );
+   v_f.copyFrom( u_f, maxLevel );
+   restriction.restrict( v, maxLevel, Inner );
+   restriction_f.restrict( v_f, maxLevel, Inner );
+   WALBERLA_CHECK_LESS( maxError( maxLevel - 1 ), 1e-5 );
+
+   for ( uint_t level = maxLevel - 1; level <= maxLevel; level++ )
+   {
+      v.assign( {1.0}, {u}, level, All );
+      v_f.copyFrom( u_f, level );
+   }
+   prolongation.prolongateAndAdd( v, maxLevel - 1, Inner );
+   prolongation_f.prolongateAndAdd( v_f, maxLevel - 1, Inner );
+   WALBERLA_CHECK_LESS( maxError( maxLevel ), 1e-5 );
+}
+
+/// Solves the Poisson problem with iterative refinement (double precision residuals, single precision V-cycles)
+/// and checks that the residual is reduced below single precision accuracy.
+static void testMixedPrecisionSolver( const std::string& meshFile, const uint_t& minLevel, const uint_t& maxLevel )
+{
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   testSinglePrecisionComponents( storage, minLevel, maxLevel );
+
+   std::function< real_t( const hyteg::Point3D& ) > exact = []( const hyteg::Point3D& p ) -> real_t {
+      return sin( p[0] ) * sinh( p[1] ) * ( 1 + p[2] );
+   };
+
+   std::function< real_t( const hyteg::Point3D& ) > rand = []( const hyteg::Point3D& ) -> real_t {
+      return walberla::math::realRandom( 0.0, 1.0 );
+   };
+
+   P1Function< real_t > u( "u", storage, minLevel, maxLevel );
+   P1Function< real_t > f( "f", storage, minLevel, maxLevel );
+   P1Function< real_t > r( "r", storage, minLevel, maxLevel );
+
+   auto A   = std::make_shared< P1ConstantLaplaceOperator >( storage, minLevel, maxLevel );
+   auto A_f = std::make_shared< P1ConstantSinglePrecisionOperator >( *A );
+
+   walberla::math::seedRandomGenerator( 42 );
+   u.interpolate( rand, maxLevel, Inner );
+   u.interpolate( exact, maxLevel, DirichletBoundary );
+
+   const auto residualNorm = [&]() -> real_t {
+      A->apply( u, r, maxLevel, Inner );
+      r.assign( {1.0, -1.0}, {f, r}, maxLevel, Inner );
+      return std::sqrt( r.dotGlobal( r, maxLevel, Inner ) );
+   };
+
+   auto coarseGridSolver = std::make_shared< CGSolver< P1ConstantLaplaceOperator > >( storage, minLevel, minLevel );
+   auto coarseGridSolver_f =
+       std::make_shared< HigherPrecisionSolverWrapper< P1ConstantSinglePrecisionOperator, P1ConstantLaplaceOperator > >(
+           storage, minLevel, minLevel, A, coarseGridSolver );
+
+   auto gmg_f = std::make_shared< GeometricMultigridSolver< P1ConstantSinglePrecisionOperator > >(
+       storage,
+       std::make_shared< GaussSeidelSmoother< P1ConstantSinglePrecisionOperator > >(),
+       coarseGridSolver_f,
+       std::make_shared< GenericP1toP1LinearRestriction< float > >(),
+       std::make_shared< GenericP1toP1LinearProlongation< float > >(),
+       minLevel,
+       maxLevel,
+       2,
+       2 );
+
+   const real_t initialResidual = residualNorm();
+
+   MixedPrecisionSolver< P1ConstantLaplaceOperator, P1ConstantSinglePrecisionOperator > solver(
+       storage, minLevel, maxLevel, A_f, gmg_f, 30, 1e-10 * initialResidual );
+   solver.solve( *A, u, f, maxLevel );
+
+   const real_t finalResidual = residualNorm();
+   WALBERLA_LOG_INFO_ON_ROOT( meshFile << ", level " << maxLevel << ": initial residual " << initialResidual
+                                       << ", final residual " << finalResidual );
+   WALBERLA_CHECK_LESS( finalResidual, 1e-10 * initialResidual );
+
+   // one single precision V-cycle as preconditioner of the double precision CG
+   auto preconditioner = std::make_shared< MixedPrecisionSolver< P1ConstantLaplaceOperator, P1ConstantSinglePrecisionOperator > >(
+       storage, minLevel, maxLevel, A_f, gmg_f, 1, 0 );
+   preconditioner->setZeroInitialGuess( true );
+   CGSolver< P1ConstantLaplaceOperator > pcg( storage, minLevel, maxLevel, 30, 1e-10 * initialResidual, preconditioner );
+
+   u.interpolate( rand, maxLevel, Inner );
+   pcg.solve( *A, u, f, maxLevel );
+
+   const real_t finalResidualPCG = residualNorm();
+   WALBERLA_LOG_INFO_ON_ROOT( meshFile << ", level " << maxLevel << ": final residual PCG " << finalResidualPCG );
+   WALBERLA_CHECK_LESS( finalResidualPCG, 1e-9 * initialResidual );
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testMixedPrecisionSolver( "../../data/meshes/quad_16el.msh", 2, 6 );
+   hyteg::testMixedPrecisionSolver( "../../data/meshes/3D/cube_6el.msh", 2, 4 );
+
+   return 0;
+}
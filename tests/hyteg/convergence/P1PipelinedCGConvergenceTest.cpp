@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/Environment.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+
+#include "hyteg/FunctionReductions.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearProlongation.hpp"
+#include "hyteg/gridtransferoperators/P1toP1LinearRestriction.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/solvers/CGSolver.hpp"
+#include "hyteg/solvers/GeometricMultigridSolver.hpp"
+#include "hyteg/solvers/PipelinedCGSolver.hpp"
+#include "hyteg/solvers/SymmetricGaussSeidelSmoother.hpp"
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_c;
+using walberla::uint_t;
+using walberla::math::pi;
+
+using namespace hyteg;
+
+/// Checks that the batched scalar products agree with the individual ones.
+void testBatchedDotProducts( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t& level )
+{
+   P1Function< real_t > a( "a", storage, level, level );
+   P1Function< real_t > b( "b", storage, level, level );
+   P1Function< real_t > c( "c", storage, level, level );
+
+   a.interpolate( []( const Point3D& p ) { return std::sin( pi * p[0] ) + p[1]; }, level, All );
+   b.interpolate( []( const Point3D& p ) { return p[0] * p[1] + p[2]; }, level, All );
+   c.interpolate( []( const Point3D& p ) { return std::cos( pi * p[1] ) - 2 * p[0]; }, level, All );
+
+   const auto batched = dotGlobal< P1Function< real_t > >( {a, b, a}, {b, c, a}, level, Inner );
+
+   NonBlockingSumReduction reduction;
+   startDotGlobal< P1Function< real_t > >( reduction, {a, b, a}, {b, c, a}, level, Inner );
+   const auto nonBlocking = reduction.wait();
+
+   const std::vector< real_t > expected = {
+       a.dotGlobal( b, level, Inner ), b.dotGlobal( c, level, Inner ), a.dotGlobal( a, level, Inner )};
+
+   for ( uint_t i = 0; i < expected.size(); i++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( batched[i], expected[i] );
+      WALBERLA_CHECK_FLOAT_EQUAL( nonBlocking[i], expected[i] );
+   }
+}
+
+/// Solves a Poisson problem with CG and pipelined CG and compares the solutions.
+template < typename SolverType >
+real_t solveAndComputeDifference( const std::shared_ptr< PrimitiveStorage >& storage,
+                                  const uint_t&                              level,
+                                  const std::shared_ptr< SolverType >&       pipelinedSolver,
+                                  const std::shared_ptr< CGSolver< P1ConstantLaplaceOperator > >& referenceSolver )
+{
+   P1ConstantLaplaceOperator A( storage, level, level );
+   P1ConstantMassOperator    M( storage, level, level );
+
+   P1Function< real_t > u( "u", storage, level, level );
+   P1Function< real_t > uReference( "uReference", storage, level, level );
+   P1Function< real_t > f( "f", storage, level, level );
+   P1Function< real_t > b( "b", storage, level, level );
+   P1Function< real_t > err( "err", storage, level, level );
+
+   std::function< real_t( const Point3D& ) > boundary = []( const Point3D& p ) { return std::sin( pi * p[0] ) * p[1]; };
+
+   f.interpolate( []( const Point3D& p ) { return real_c( 1 ) + p[0] * p[0]; }, level, All );
+   M.apply( f, b, level, All );
+
+   u.interpolate( boundary, level, DirichletBoundary );
+   uReference.interpolate( boundary, level, DirichletBoundary );
+
+   pipelinedSolver->solve( A, u, b, level );
+   referenceSolver->solve( A, uReference, b, level );
+
+   err.assign( {1.0, -1.0}, {u, uReference}, level, All );
+   return err.getMaxMagnitude( level, All );
+}
+
+void testPipelinedCG( const std::string& meshFile, const uint_t& level )
+{
+   const auto            meshInfo = MeshInfo::fromGmshFile( meshFile );
+   SetupPrimitiveStorage setupStorage( meshInfo, uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   setupStorage.setMeshBoundaryFlagsOnBoundary( 1, 0, true );
+   const auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+   testBatchedDotProducts( storage, level );
+
+   auto cg = std::make_shared< CGSolver< P1ConstantLaplaceOperator > >( storage, level, level, 10000, 1e-14 );
+
+   // unpreconditioned
+   auto pipelinedCG = std::make_shared< PipelinedCGSolver< P1ConstantLaplaceOperator > >( storage, level, level, 10000, 1e-14 );
+   const real_t errorUnpreconditioned = solveAndComputeDifference( storage, level, pipelinedCG, cg );
+   WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << "] max difference CG / pipelined CG: " << errorUnpreconditioned );
+   WALBERLA_CHECK_LESS( errorUnpreconditioned, 1e-10 );
+
+   // symmetric multigrid preconditioner
+   auto smoother     = std::make_shared< SymmetricGaussSeidelSmoother< P1ConstantLaplaceOperator > >();
+   auto coarseSolver = std::make_shared< CGSolver< P1ConstantLaplaceOperator > >( storage, 0, level );
+   auto restriction  = std::make_shared< P1toP1LinearRestriction >();
+   auto prolongation = std::make_shared< P1toP1LinearProlongation >();
+   auto gmg          = std::make_shared< GeometricMultigridSolver< P1ConstantLaplaceOperator > >(
+       storage, smoother, coarseSolver, restriction, prolongation, 0, level, 2, 2 );
+
+   auto pipelinedPCG = std::make_shared< PipelinedCGSolver< P1ConstantLaplaceOperator > >( storage, 0, level, 100, 1e-14, gmg );
+   pipelinedPCG->setPrintInfo( true );
+   const real_t errorPreconditioned = solveAndComputeDifference( storage, level, pipelinedPCG, cg );
+   WALBERLA_LOG_INFO_ON_ROOT( "[" << meshFile << "] max difference CG / pipelined GMG-PCG: " << errorPreconditioned );
+   WALBERLA_CHECK_LESS( errorPreconditioned, 1e-10 );
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::logging::Logging::instance()->setLogLevel( walberla::logging::Logging::PROGRESS );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   testPipelinedCG( "../../data/meshes/quad_8el.msh", 4 );
+   testPipelinedCG( "../../data/meshes/3D/cube_24el.msh", 3 );
+
+   return 0;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include "hyteg/dataexport/FunctionCheckpoint.hpp"
+
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+
+#include "hyteg/composites/P2P1TaylorHoodFunction.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// Writes a checkpoint and restores it on a storage with a different distribution of the primitives, once on a storage
+// that is created from the mesh and once on a storage that is created from the topology stored in the checkpoint.
+
+namespace hyteg {
+
+static void checkRestoredFunctions( const std::shared_ptr< PrimitiveStorage >&                     storage,
+                                    const std::string&                                             fileName,
+                                    const uint_t&                                                  minLevel,
+                                    const uint_t&                                                  maxLevel,
+                                    const std::vector< std::function< real_t( const Point3D& ) > >& expr )
+{
+   P1Function< real_t >             p1( "p1", storage, minLevel, maxLevel );
+   P2Function< real_t >             p2( "p2", storage, minLevel, maxLevel );
+   P2P1TaylorHoodFunction< real_t > taylorHood( "taylorHood", storage, minLevel, maxLevel );
+
+   FunctionCheckpoint checkpoint( storage );
+   checkpoint.add( p1 );
+   checkpoint.add( p2 );
+   checkpoint.add( taylorHood );
+   checkpoint.restore( fileName );
+
+   P1Function< real_t >             p1Expected( "p1Expected", storage, minLevel, maxLevel );
+   P2Function< real_t >             p2Expected( "p2Expected", storage, minLevel, maxLevel );
+   P2P1TaylorHoodFunction< real_t > taylorHoodExpected( "taylorHoodExpected", storage, minLevel, maxLevel );
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      p1Expected.interpolate( expr[0], level, All );
+      p2Expected.interpolate( expr[1], level, All );
+      for ( uint_t k = 0; k < taylorHoodExpected.uvw.getDimension(); k++ )
+      {
+         taylorHoodExpected.uvw[k].interpolate( expr[k], level, All );
+      }
+      taylorHoodExpected.p.interpolate( expr[2], level, All );
+
+      p1Expected.assign( {1.0, -1.0}, {p1Expected, p1}, level, All );
+      p2Expected.assign( {1.0, -1.0}, {p2Expected, p2}, level, All );
+      taylorHoodExpected.assign( {1.0, -1.0}, {taylorHoodExpected, taylorHood}, level, All );
+
+      WALBERLA_CHECK_FLOAT_EQUAL( p1Expected.getMaxMagnitude( level ), 0.0 );
+      WALBERLA_CHECK_FLOAT_EQUAL( p2Expected.getMaxMagnitude( level ), 0.0 );
+      for ( uint_t k = 0; k < taylorHoodExpected.uvw.getDimension(); k++ )
+      {
+         WALBERLA_CHECK_FLOAT_EQUAL( taylorHoodExpected.uvw[k].getMaxMagnitude( level ), 0.0 );
+      }
+      WALBERLA_CHECK_FLOAT_EQUAL( taylorHoodExpected.p.getMaxMagnitude( level ), 0.0 );
+   }
+}
+
+static void testFunctionCheckpoint( const std::string& meshFile )
+{
+   const uint_t minLevel     = 2;
+   const uint_t maxLevel     = 3;
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   const std::string fileName = "../../output/FunctionCheckpointTest.dat";
+
+   std::function< real_t( const hyteg::Point3D& ) > xFunc = []( const Point3D& p ) -> real_t {
+      return std::sin( p[0] ) + p[1] * p[2];
+   };
+   std::function< real_t( const hyteg::Point3D& ) > yFunc = []( const Point3D& p ) -> real_t { return p[0] * p[1] + 2.0; };
+   std::function< real_t( const hyteg::Point3D& ) > zFunc = []( const Point3D& p ) -> real_t {
+      return std::exp( p[2] ) - p[0];
+   };
+   std::vector< std::function< real_t( const hyteg::Point3D& ) > > vecExpr = {xFunc, yFunc, zFunc};
+
+   MeshInfo mesh = MeshInfo::fromGmshFile( meshFile );
+
+   // write the checkpoint with the primitives distributed round robin
+   {
+      SetupPrimitiveStorage setupStorage( mesh, numProcesses );
+      loadbalancing::roundRobin( setupStorage );
+      std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+      P1Function< real_t >             p1( "p1", storage, minLevel, maxLevel );
+      P2Function< real_t >             p2( "p2", storage, minLevel, maxLevel );
+      P2P1TaylorHoodFunction< real_t > taylorHood( "taylorHood", storage, minLevel, maxLevel );
+
+      for ( uint_t level = minLevel; level <= maxLevel; level++ )
+      {
+         p1.interpolate( xFunc, level, All );
+         p2.interpolate( yFunc, level, All );
+         for ( uint_t k = 0; k < taylorHood.uvw.getDimension(); k++ )
+         {
+            taylorHood.uvw[k].interpolate( vecExpr[k], level, All );
+         }
+         taylorHood.p.interpolate( zFunc, level, All );
+      }
+
+      FunctionCheckpoint checkpoint( storage );
+      checkpoint.add( p1 );
+      checkpoint.add( p2 );
+      checkpoint.add( taylorHood );
+      checkpoint.write( fileName );
+   }
+
+   // restore the checkpoint with all primitives on the root process
+   {
+      SetupPrimitiveStorage setupStorage( mesh, numProcesses );
+      loadbalancing::allPrimitivesOnRoot( setupStorage );
+      std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+      checkRestoredFunctions( storage, fileName, minLevel, maxLevel, vecExpr );
+   }
+
+   // restore the topology and the checkpoint with all primitives on the last process
+   {
+      auto                  setupStorage = FunctionCheckpoint::readSetupStorage( fileName, numProcesses );
+      SetupPrimitiveStorage setupStorageFromMesh( mesh, numProcesses );
+
+      WALBERLA_CHECK_EQUAL( setupStorage->getNumberOfVertices(), setupStorageFromMesh.getNumberOfVertices() );
+      WALBERLA_CHECK_EQUAL( setupStorage->getNumberOfEdges(), setupStorageFromMesh.getNumberOfEdges() );
+      WALBERLA_CHECK_EQUAL( setupStorage->getNumberOfFaces(), setupStorageFromMesh.getNumberOfFaces() );
+      WALBERLA_CHECK_EQUAL( setupStorage->getNumberOfCells(), setupStorageFromMesh.getNumberOfCells() );
+      for ( const auto& it : setupStorageFromMesh.getFaces() )
+      {
+         WALBERLA_CHECK( setupStorage->faceExists( it.first ) );
+         for ( uint_t i = 0; i < 3; i++ )
+         {
+            const Point3D difference = setupStorage->getFace( it.first )->getCoordinates()[i] - it.second->getCoordinates()[i];
+            WALBERLA_CHECK_FLOAT_EQUAL( difference.norm(), 0.0 );
+         }
+         WALBERLA_CHECK_EQUAL( setupStorage->getFace( it.first )->getMeshBoundaryFlag(), it.second->getMeshBoundaryFlag() );
+      }
+
+      loadbalancing::allPrimitivesOnOneRank( *setupStorage, numProcesses - 1 );
+      std::shared_ptr< PrimitiveStorage > storage = std::make_shared< PrimitiveStorage >( *setupStorage );
+
+      checkRestoredFunctions( storage, fileName, minLevel, maxLevel, vecExpr );
+   }
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testFunctionCheckpoint( "../../data/meshes/annulus_coarse.msh" );
+   hyteg::testFunctionCheckpoint( "../../data/meshes/3D/cube_6el.msh" );
+
+   return EXIT_SUCCESS;
+}
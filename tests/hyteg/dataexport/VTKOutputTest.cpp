@@ -88,6 +88,29 @@ static void exportFunctions2D()
       vtkOutput2.add( p2ScalarFunc2 );
       vtkOutput2.add( p2VectorFunc );
       vtkOutput2.write( maxLevel );
+
+      for ( const auto& vtkDataFormat : {vtk::DataFormat::BINARY, vtk::DataFormat::APPENDED} )
+      {
+         const std::string formatSuffix = vtkDataFormat == vtk::DataFormat::BINARY ? "Binary" : "Appended";
+
+         fName = "VTKOutputTest" + formatSuffix;
+         WALBERLA_LOG_INFO_ON_ROOT( "Exporting to '" << fPath << "/" << fName << "'" );
+         VTKOutput vtkOutputBinary( fPath, fName, storage );
+         vtkOutputBinary.setVTKDataFormat( vtkDataFormat );
+         vtkOutputBinary.add( p1ScalarFunc1 );
+         vtkOutputBinary.add( p1ScalarFunc2 );
+         vtkOutputBinary.add( p1VectorFunc );
+         vtkOutputBinary.write( maxLevel );
+
+         fName = "VTKOutputTestP2" + formatSuffix;
+         WALBERLA_LOG_INFO_ON_ROOT( "Exporting to '" << fPath << "/" << fName << "'" );
+         VTKOutput vtkOutputBinary2( fPath, fName, storage );
+         vtkOutputBinary2.setVTKDataFormat( vtkDataFormat );
+         vtkOutputBinary2.add( p2ScalarFunc1 );
+         vtkOutputBinary2.add( p2ScalarFunc2 );
+         vtkOutputBinary2.add( p2VectorFunc );
+         vtkOutputBinary2.write( maxLevel );
+      }
    }
 }
 
@@ -155,6 +178,31 @@ static void exportFunctions3D()
       vtkOutput2.add( p2ScalarFunc3 );
       vtkOutput2.add( p2VectorFunc );
       vtkOutput2.write( maxLevel );
+
+      for ( const auto& vtkDataFormat : {vtk::DataFormat::BINARY, vtk::DataFormat::APPENDED} )
+      {
+         const std::string formatSuffix = vtkDataFormat == vtk::DataFormat::BINARY ? "Binary" : "Appended";
+
+         fName = "VTKOutputTest3D" + formatSuffix;
+         WALBERLA_LOG_INFO_ON_ROOT( "Exporting to '" << fPath << "/" << fName << "'" );
+         VTKOutput vtkOutputBinary( fPath, fName, storage );
+         vtkOutputBinary.setVTKDataFormat( vtkDataFormat );
+         vtkOutputBinary.add( p1ScalarFunc1 );
+         vtkOutputBinary.add( p1ScalarFunc2 );
+         vtkOutputBinary.add( p1ScalarFunc3 );
+         vtkOutputBinary.add( p1VectorFunc );
+         vtkOutputBinary.write( maxLevel );
+
+         fName = "VTKOutputTest3DP2" + formatSuffix;
+         WALBERLA_LOG_INFO_ON_ROOT( "Exporting to '" << fPath << "/" << fName << "'" );
+         VTKOutput vtkOutputBinary2( fPath, fName, storage );
+         vtkOutputBinary2.setVTKDataFormat( vtkDataFormat );
+         vtkOutputBinary2.add( p2ScalarFunc1 );
+         vtkOutputBinary2.add( p2ScalarFunc2 );
+         vtkOutputBinary2.add( p2ScalarFunc3 );
+         vtkOutputBinary2.add( p2VectorFunc );
+         vtkOutputBinary2.write( maxLevel );
+      }
    }
 }
 
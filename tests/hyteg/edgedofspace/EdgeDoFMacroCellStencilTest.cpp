@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/mpi/RecvBuffer.h"
+#include "core/mpi/SendBuffer.h"
+
+#include "hyteg/edgedofspace/EdgeDoFMacroCellStencil.hpp"
+#include "hyteg/p2functionspace/P2Elements3D.hpp"
+
+namespace hyteg {
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+
+static real_t weightOf( const uint_t& row, const indexing::IndexIncrement& increment )
+{
+   return real_c( 100 * row + 9 * increment.x() + 3 * increment.y() + increment.z() );
+}
+
+/// Checks that the rows of the flat stencil contain exactly the neighbors of the P2 elements and that
+/// the weights can be written and read via the increments.
+template < typename RowAccess_T, typename Neighbors_T >
+static void checkRow( const RowAccess_T& row, const Neighbors_T& neighbors, const uint_t& rowIdx )
+{
+   WALBERLA_CHECK_EQUAL( row.size(), neighbors.size() );
+   for ( const auto& neighbor : neighbors )
+   {
+      WALBERLA_CHECK_EQUAL( row.count( neighbor ), uint_t( 1 ) );
+      WALBERLA_CHECK_FLOAT_EQUAL( row[neighbor], weightOf( rowIdx, neighbor ) );
+   }
+
+   const auto rowMap = row.toMap();
+   WALBERLA_CHECK_EQUAL( rowMap.size(), neighbors.size() );
+   for ( const auto& it : rowMap )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( it.second, weightOf( rowIdx, it.first ) );
+   }
+}
+
+static void testEdgeToEdgeLayout()
+{
+   edgedof::macrocell::EdgeToEdgeFlatStencil stencil;
+   for ( const auto& centerOrientation : edgedof::allEdgeDoFOrientations )
+   {
+      for ( const auto& leafOrientation : edgedof::allEdgeDoFOrientations )
+      {
+         const uint_t rowIdx = uint_t( centerOrientation ) * edgedof::macrocell::numOrientations + uint_t( leafOrientation );
+         for ( const auto& neighbor :
+               P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromEdgeDoFInMacroCell( centerOrientation, leafOrientation ) )
+         {
+            stencil[centerOrientation][leafOrientation].at( neighbor ) = weightOf( rowIdx, neighbor );
+         }
+      }
+   }
+
+   const auto& constStencil = stencil;
+   for ( const auto& centerOrientation : edgedof::allEdgeDoFOrientations )
+   {
+      for ( const auto& leafOrientation : edgedof::allEdgeDoFOrientations )
+      {
+         const uint_t rowIdx = uint_t( centerOrientation ) * edgedof::macrocell::numOrientations + uint_t( leafOrientation );
+         checkRow( constStencil[centerOrientation][leafOrientation],
+                   P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromEdgeDoFInMacroCell( centerOrientation, leafOrientation ),
+                   rowIdx );
+      }
+   }
+
+   walberla::mpi::SendBuffer sendBuffer;
+   sendBuffer << stencil;
+   walberla::mpi::RecvBuffer                 recvBuffer( sendBuffer );
+   edgedof::macrocell::EdgeToEdgeFlatStencil received;
+   recvBuffer >> received;
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( received.data()[i], stencil.data()[i] );
+   }
+}
+
+template < typename Stencil_T, typename NeighborFunction_T >
+static void testOrientationLayout( const NeighborFunction_T& neighbors )
+{
+   Stencil_T stencil;
+   for ( const auto& orientation : edgedof::allEdgeDoFOrientations )
+   {
+      for ( const auto& neighbor : neighbors( orientation ) )
+      {
+         stencil[orientation].at( neighbor ) = weightOf( uint_t( orientation ), neighbor );
+      }
+   }
+
+   const auto& constStencil = stencil;
+   for ( const auto& orientation : edgedof::allEdgeDoFOrientations )
+   {
+      checkRow( constStencil[orientation], neighbors( orientation ), uint_t( orientation ) );
+   }
+
+   walberla::mpi::SendBuffer sendBuffer;
+   sendBuffer << stencil;
+   walberla::mpi::RecvBuffer recvBuffer( sendBuffer );
+   Stencil_T                 received;
+   recvBuffer >> received;
+   for ( uint_t i = 0; i < stencil.size(); i++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( received.data()[i], stencil.data()[i] );
+   }
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testEdgeToEdgeLayout();
+   hyteg::testOrientationLayout< hyteg::edgedof::macrocell::VertexToEdgeFlatStencil >(
+       []( const hyteg::edgedof::EdgeDoFOrientation& orientation ) {
+          return hyteg::P2Elements::P2Elements3D::getAllVertexDoFNeighborsFromEdgeDoFInMacroCell( orientation );
+       } );
+   hyteg::testOrientationLayout< hyteg::edgedof::macrocell::EdgeToVertexFlatStencil >(
+       []( const hyteg::edgedof::EdgeDoFOrientation& orientation ) {
+          return hyteg::P2Elements::P2Elements3D::getAllEdgeDoFNeighborsFromVertexDoFInMacroCell( orientation );
+       } );
+
+   return EXIT_SUCCESS;
+}
@@ -37,6 +37,7 @@ using walberla::math::pi;
 #include "hyteg/forms/form_hyteg_generated/P1FormDivT.hpp"
 #include "hyteg/forms/form_hyteg_generated/P1FormLaplace.hpp"
 #include "hyteg/forms/form_hyteg_generated/P1FormMass.hpp"
+#include "hyteg/forms/form_hyteg_manual/P1FormLaplace3D.hpp"
 #include "hyteg/forms/form_hyteg_manual/P1FormMass3D.hpp"
 #include "hyteg/forms/form_hyteg_manual/P1ToP2FormDivT.hpp"
 #include "hyteg/forms/form_hyteg_manual/P2FormDiv.hpp"
@@ -335,6 +336,10 @@ void run3DTestsWithoutBlending()
    compareForms< P1FenicsForm< fenics::NoAssemble, p1_tet_mass_cell_integral_0_otherwise >, P1Form_mass3D, Matrix4r, 3 >( theTet,
                                                                                                                           1e-15 );
 
+   logSectionHeader( "P1 Laplace Forms (3D)" );
+   compareForms< P1FenicsForm< fenics::NoAssemble, p1_tet_diffusion_cell_integral_0_otherwise >, P1Form_laplace3D, Matrix4r, 3 >(
+       theTet, 1e-13 );
+
    logSectionHeader( "P2 Mass Forms (3D)" );
    compareForms< P2FenicsForm< fenics::NoAssemble, p2_tet_mass_cell_integral_0_otherwise >, P2Form_mass, Matrix10r, 3 >(
        theTet, 1e-8 ); // need to improve our cubature !!!
@@ -419,6 +424,12 @@ void run3DTestsWithAffineMap()
    compareUsingAffineMap< P1FenicsForm< fenics::NoAssemble, p1_tet_mass_cell_integral_0_otherwise >, P1Form_mass3D, Matrix4r, 3 >(
        theTet, 5e-15, map );
 
+   logSectionHeader( "P1 Laplace Forms (3D)" );
+   compareUsingAffineMap< P1FenicsForm< fenics::NoAssemble, p1_tet_diffusion_cell_integral_0_otherwise >,
+                          P1Form_laplace3D,
+                          Matrix4r,
+                          3 >( theTet, 5e-14, map );
+
    logSectionHeader( "P2 Mass Forms (3D)" );
    compareUsingAffineMap< P2FenicsForm< fenics::NoAssemble, p2_tet_mass_cell_integral_0_otherwise >, P2Form_mass, Matrix10r, 3 >(
        theTet, 5e-7, map ); // need to improve our cubature !!!
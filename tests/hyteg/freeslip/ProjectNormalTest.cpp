@@ -103,6 +103,35 @@ static void testProjectNormal( )
    StokesFunctionType diff( "diff", storage, level, level );
    diff.assign( {1, -1}, {u, uTan}, level, All );
    WALBERLA_CHECK_LESS( diff.dotGlobal(diff, level, All), 1e-14 );
+
+   // the normals are stored after the first application, we check that the projection is still idempotent:
+   u.uvw.u.interpolate( [=](auto & p){ return p[0] + p[1]; }, level );
+   u.uvw.v.interpolate( [=](auto & p){ return p[0] * p[1]; }, level );
+   if (storage->hasGlobalCells())
+      u.uvw.w.interpolate( [=](auto & p){ return p[2]; }, level );
+   projectNormalOperator.apply( u, level, FreeslipBoundary );
+   StokesFunctionType uProjected( "uProjected", storage, level, level );
+   uProjected.assign( {1}, {u}, level, All );
+   projectNormalOperator.apply( u, level, FreeslipBoundary );
+   diff.assign( {1, -1}, {u, uProjected}, level, All );
+   WALBERLA_CHECK_LESS( diff.dotGlobal(diff, level, All), 1e-14 );
+
+   // the normals are recomputed after the macro-primitives have been migrated to the next process:
+   const uint_t   rank         = uint_c( walberla::mpi::MPIManager::instance()->rank() );
+   const uint_t   numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+   MigrationMap_T primitivesToMigrate;
+   for ( const auto& id : storage->getPrimitiveIDs() )
+   {
+      primitivesToMigrate[id.getID()] = ( rank + 1 ) % numProcesses;
+   }
+   storage->migratePrimitives( MigrationInfo( primitivesToMigrate, getNumReceivingPrimitives( primitivesToMigrate ) ) );
+
+   u.uvw.u.interpolate( [=](auto & p){ return normalInterpolant(p)[0]; }, level );
+   u.uvw.v.interpolate( [=](auto & p){ return normalInterpolant(p)[1]; }, level );
+   if (storage->hasGlobalCells())
+      u.uvw.w.interpolate( [=](auto & p){ return normalInterpolant(p)[2]; }, level );
+   projectNormalOperator.apply( u, level, FreeslipBoundary );
+   WALBERLA_CHECK_LESS( u.dotGlobal(u, level, FreeslipBoundary), 1e-14 );
 }
 
 int main( int argc, char* argv[] )
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <limits>
+
+#include "core/DataTypes.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/elementwiseoperators/P1ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
+#include "hyteg/geometry/AnnulusMap.hpp"
+#include "hyteg/geometry/IcosahedralShellMap.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// This test checks that the application of the elementwise operators with
+// precomputed local element matrices gives the same result as the
+// application with on-the-fly integration. This includes the matrices of
+// all micro-elements that are stored on blended macro-primitives.
+// It also checks that the stored matrices (affine and blended) are
+// recomputed after the macro-primitives have been migrated.
+
+using walberla::real_t;
+using namespace hyteg;
+
+template < typename OpType >
+void cachedApplyTest( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t minLevel, const uint_t maxLevel )
+{
+   const real_t epsilon = 1e-12;
+
+   P2Function< real_t > src( "src", storage, minLevel, maxLevel );
+   P2Function< real_t > dstIntegrated( "dstIntegrated", storage, minLevel, maxLevel );
+   P2Function< real_t > dstCached( "dstCached", storage, minLevel, maxLevel );
+   P2Function< real_t > error( "error", storage, minLevel, maxLevel );
+
+   OpType integratedOp( storage, minLevel, maxLevel );
+   OpType cachedOp( storage, minLevel, maxLevel );
+   cachedOp.computeAndStoreLocalElementMatrices();
+   WALBERLA_CHECK( cachedOp.localElementMatricesPrecomputed() );
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      src.interpolate( func, level );
+
+      integratedOp.apply( src, dstIntegrated, level, All, Replace );
+      cachedOp.apply( src, dstCached, level, All, Replace );
+
+      error.assign( {1.0, -1.0}, {dstIntegrated, dstCached}, level, All );
+      const real_t errorMax = error.getMaxMagnitude( level );
+      WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ": max difference " << errorMax )
+      WALBERLA_CHECK_LESS( errorMax, epsilon );
+   }
+}
+
+template < typename OpType, typename FunctionType >
+void blendedCachedApplyTest( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t minLevel, const uint_t maxLevel )
+{
+   const real_t epsilon = 1e-12;
+
+   FunctionType src( "src", storage, minLevel, maxLevel );
+   FunctionType dstIntegrated( "dstIntegrated", storage, minLevel, maxLevel );
+   FunctionType dstCached( "dstCached", storage, minLevel, maxLevel );
+   FunctionType error( "error", storage, minLevel, maxLevel );
+
+   OpType integratedOp( storage, minLevel, maxLevel );
+   OpType cachedOp( storage, minLevel, maxLevel );
+
+   // a budget of zero disables the cache
+   cachedOp.computeAndStoreBlendedLocalElementMatrices( 0 );
+   WALBERLA_CHECK( cachedOp.getBlendedLocalElementMatrixLevels().empty() );
+
+   cachedOp.computeAndStoreBlendedLocalElementMatrices( std::numeric_limits< uint_t >::max() / 2 );
+   WALBERLA_CHECK_EQUAL( cachedOp.getBlendedLocalElementMatrixLevels().size(), maxLevel - minLevel + 1 );
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      src.interpolate( func, level );
+
+      integratedOp.apply( src, dstIntegrated, level, All, Replace );
+      cachedOp.apply( src, dstCached, level, All, Replace );
+
+      error.assign( {1.0, -1.0}, {dstIntegrated, dstCached}, level, All );
+      const real_t errorMax = error.getMaxMagnitude( level );
+      WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ": max difference " << errorMax )
+      WALBERLA_CHECK_LESS( errorMax, epsilon );
+   }
+}
+
+/// Migrates all macro-primitives to the next process.
+void migrateToNextProcess( PrimitiveStorage& storage )
+{
+   const uint_t rank         = uint_c( walberla::mpi::MPIManager::instance()->rank() );
+   const uint_t numProcesses = uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   MigrationMap_T             primitivesToMigrate;
+   std::vector< PrimitiveID > localPrimitiveIDs;
+   storage.getPrimitiveIDs( localPrimitiveIDs );
+   for ( const auto& id : localPrimitiveIDs )
+   {
+      primitivesToMigrate[id.getID()] = ( rank + 1 ) % numProcesses;
+   }
+   const uint_t modificationStamp = storage.getModificationStamp();
+   storage.migratePrimitives( MigrationInfo( primitivesToMigrate, getNumReceivingPrimitives( primitivesToMigrate ) ) );
+   WALBERLA_CHECK_GREATER( storage.getModificationStamp(), modificationStamp );
+}
+
+/// Stores the element matrices, migrates all macro-primitives to the next process and applies the operator again.
+template < typename OpType >
+void cachedApplyAfterMigrationTest( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t level )
+{
+   const real_t epsilon = 1e-12;
+
+   P2Function< real_t > src( "src", storage, level, level );
+   P2Function< real_t > dstIntegrated( "dstIntegrated", storage, level, level );
+   P2Function< real_t > dstCached( "dstCached", storage, level, level );
+   P2Function< real_t > error( "error", storage, level, level );
+
+   OpType integratedOp( storage, level, level );
+   OpType cachedOp( storage, level, level );
+   cachedOp.computeAndStoreLocalElementMatrices();
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+   src.interpolate( func, level );
+   cachedOp.apply( src, dstCached, level, All, Replace );
+
+   migrateToNextProcess( *storage );
+
+   integratedOp.apply( src, dstIntegrated, level, All, Replace );
+   cachedOp.apply( src, dstCached, level, All, Replace );
+
+   error.assign( {1.0, -1.0}, {dstIntegrated, dstCached}, level, All );
+   const real_t errorMax = error.getMaxMagnitude( level );
+   WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ", after migration: max difference " << errorMax )
+   WALBERLA_CHECK_LESS( errorMax, epsilon );
+}
+
+/// Stores the element matrices of the blended macro-primitives, migrates all macro-primitives to the next process
+/// and applies the operator again.
+template < typename OpType, typename FunctionType >
+void blendedCachedApplyAfterMigrationTest( const std::shared_ptr< PrimitiveStorage >& storage,
+                                           const uint_t                               minLevel,
+                                           const uint_t                               maxLevel )
+{
+   const real_t epsilon = 1e-12;
+
+   FunctionType src( "src", storage, minLevel, maxLevel );
+   FunctionType dstIntegrated( "dstIntegrated", storage, minLevel, maxLevel );
+   FunctionType dstCached( "dstCached", storage, minLevel, maxLevel );
+   FunctionType error( "error", storage, minLevel, maxLevel );
+
+   OpType integratedOp( storage, minLevel, maxLevel );
+   OpType cachedOp( storage, minLevel, maxLevel );
+   cachedOp.computeAndStoreBlendedLocalElementMatrices( std::numeric_limits< uint_t >::max() / 2 );
+
+   migrateToNextProcess( *storage );
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      src.interpolate( func, level );
+
+      integratedOp.apply( src, dstIntegrated, level, All, Replace );
+      cachedOp.apply( src, dstCached, level, All, Replace );
+
+      error.assign( {1.0, -1.0}, {dstIntegrated, dstCached}, level, All );
+      const real_t errorMax = error.getMaxMagnitude( level );
+      WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ", after migration: max difference " << errorMax )
+      WALBERLA_CHECK_LESS( errorMax, epsilon );
+   }
+
+   // the matrices have been recomputed for the new distribution in the first apply()
+   WALBERLA_CHECK_EQUAL( cachedOp.getBlendedLocalElementMatrixLevels().size(), maxLevel - minLevel + 1 );
+}
+
+std::shared_ptr< PrimitiveStorage > createStorage( const MeshInfo& meshInfo, bool annulusMap = false, bool shellMap = false )
+{
+   SetupPrimitiveStorage setupStorage( meshInfo, walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   if ( annulusMap )
+   {
+      AnnulusMap::setMap( setupStorage );
+   }
+   if ( shellMap )
+   {
+      IcosahedralShellMap::setMap( setupStorage );
+   }
+   loadbalancing::roundRobin( setupStorage );
+   return std::make_shared< PrimitiveStorage >( setupStorage );
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   auto storage2D = createStorage( MeshInfo::fromGmshFile( "../../data/meshes/quad_16el.msh" ) );
+   auto storage3D = createStorage( MeshInfo::fromGmshFile( "../../data/meshes/3D/pyramid_tilted_4el.msh" ) );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Laplace, 2D" )
+   cachedApplyTest< P2ElementwiseLaplaceOperator >( storage2D, 0, 4 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Mass, 2D" )
+   cachedApplyTest< P2ElementwiseMassOperator >( storage2D, 0, 4 );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Laplace, 3D" )
+   cachedApplyTest< P2ElementwiseLaplaceOperator >( storage3D, 0, 3 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Mass, 3D" )
+   cachedApplyTest< P2ElementwiseMassOperator >( storage3D, 0, 3 );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Laplace, 2D, migration" )
+   cachedApplyAfterMigrationTest< P2ElementwiseLaplaceOperator >(
+       createStorage( MeshInfo::fromGmshFile( "../../data/meshes/quad_16el.msh" ) ), 3 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Laplace, 3D, migration" )
+   cachedApplyAfterMigrationTest< P2ElementwiseLaplaceOperator >(
+       createStorage( MeshInfo::fromGmshFile( "../../data/meshes/3D/pyramid_tilted_4el.msh" ) ), 2 );
+
+   // blended macro-faces are not cached and must fall back to on-the-fly integration
+   auto storageAnnulus = createStorage( MeshInfo::meshAnnulus( 1.0, 2.0, MeshInfo::CRISS, 6, 2 ), true );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Blending Laplace, 2D, annulus" )
+   cachedApplyTest< P2ElementwiseBlendingLaplaceOperator >( storageAnnulus, 0, 3 );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P1, Blending Laplace, 2D, annulus, all micro-elements cached" )
+   blendedCachedApplyTest< P1ElementwiseBlendingLaplaceOperator, P1Function< real_t > >( storageAnnulus, 0, 4 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Blending Laplace, 2D, annulus, all micro-elements cached" )
+   blendedCachedApplyTest< P2ElementwiseBlendingLaplaceOperator, P2Function< real_t > >( storageAnnulus, 0, 3 );
+
+   auto storageShell = createStorage( MeshInfo::meshSphericalShell( 2, 2, 1.0, 2.0 ), false, true );
+   WALBERLA_LOG_INFO_ON_ROOT( "P1, Blending Laplace, 3D, shell, all micro-elements cached" )
+   blendedCachedApplyTest< P1ElementwiseBlendingLaplaceOperator3D, P1Function< real_t > >( storageShell, 0, 2 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Blending Laplace, 3D, shell, all micro-elements cached" )
+   blendedCachedApplyTest< P2ElementwiseBlendingLaplaceOperator, P2Function< real_t > >( storageShell, 0, 2 );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P1, Blending Laplace, 2D, annulus, migration" )
+   blendedCachedApplyAfterMigrationTest< P1ElementwiseBlendingLaplaceOperator, P1Function< real_t > >(
+       createStorage( MeshInfo::meshAnnulus( 1.0, 2.0, MeshInfo::CRISS, 6, 2 ), true ), 0, 3 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Blending Laplace, 3D, shell, migration" )
+   blendedCachedApplyAfterMigrationTest< P2ElementwiseBlendingLaplaceOperator, P2Function< real_t > >(
+       createStorage( MeshInfo::meshSphericalShell( 2, 2, 1.0, 2.0 ), false, true ), 0, 2 );
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/DataTypes.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// This test checks that the application of the operators with the halo exchange
+// overlapped with the computation gives the same result as the application with
+// blocking communication.
+
+using walberla::real_t;
+using namespace hyteg;
+
+template < typename OpType, typename FunctionType >
+void overlapApplyTest( const std::shared_ptr< PrimitiveStorage >& storage, const uint_t minLevel, const uint_t maxLevel )
+{
+   const real_t epsilon = 1e-12;
+
+   FunctionType srcBlocking( "srcBlocking", storage, minLevel, maxLevel );
+   FunctionType srcOverlap( "srcOverlap", storage, minLevel, maxLevel );
+   FunctionType dstBlocking( "dstBlocking", storage, minLevel, maxLevel );
+   FunctionType dstOverlap( "dstOverlap", storage, minLevel, maxLevel );
+   FunctionType error( "error", storage, minLevel, maxLevel );
+
+   OpType blockingOp( storage, minLevel, maxLevel );
+   OpType overlapOp( storage, minLevel, maxLevel );
+   overlapOp.setCommunicationOverlap( true );
+   WALBERLA_CHECK( overlapOp.getCommunicationOverlap() );
+   WALBERLA_CHECK( !blockingOp.getCommunicationOverlap() );
+
+   auto func    = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+   auto funcDst = []( const Point3D& x ) { return x[0] * x[1] + x[2]; };
+
+   for ( uint_t level = minLevel; level <= maxLevel; level++ )
+   {
+      for ( const auto& updateType : {Replace, Add} )
+      {
+         // separate source functions, so that the overlapping apply cannot rely on halos updated by the other one
+         srcBlocking.interpolate( func, level );
+         srcOverlap.interpolate( func, level );
+         dstBlocking.interpolate( funcDst, level );
+         dstOverlap.interpolate( funcDst, level );
+
+         blockingOp.apply( srcBlocking, dstBlocking, level, All, updateType );
+         overlapOp.apply( srcOverlap, dstOverlap, level, All, updateType );
+
+         error.assign( {1.0, -1.0}, {dstBlocking, dstOverlap}, level, All );
+         const real_t errorMax = error.getMaxMagnitude( level );
+         WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ", update type " << updateType << ": max difference " << errorMax )
+         WALBERLA_CHECK_LESS( errorMax, epsilon );
+      }
+   }
+}
+
+std::shared_ptr< PrimitiveStorage > createStorage( const MeshInfo& meshInfo )
+{
+   SetupPrimitiveStorage setupStorage( meshInfo, walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() ) );
+   loadbalancing::roundRobin( setupStorage );
+   return std::make_shared< PrimitiveStorage >( setupStorage );
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   auto storage2D = createStorage( MeshInfo::fromGmshFile( "../../data/meshes/quad_16el.msh" ) );
+   auto storage3D = createStorage( MeshInfo::fromGmshFile( "../../data/meshes/3D/cube_6el.msh" ) );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P1, Laplace, 2D" )
+   overlapApplyTest< P1ConstantLaplaceOperator, P1Function< real_t > >( storage2D, 2, 4 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Laplace, 2D" )
+   overlapApplyTest< P2ElementwiseLaplaceOperator, P2Function< real_t > >( storage2D, 0, 4 );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "P1, Laplace, 3D" )
+   overlapApplyTest< P1ConstantLaplaceOperator, P1Function< real_t > >( storage3D, 2, 4 );
+   WALBERLA_LOG_INFO_ON_ROOT( "P2, Laplace, 3D" )
+   overlapApplyTest< P2ElementwiseLaplaceOperator, P2Function< real_t > >( storage3D, 0, 3 );
+
+   return EXIT_SUCCESS;
+}
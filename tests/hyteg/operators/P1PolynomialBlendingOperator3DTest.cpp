@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "core/DataTypes.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/elementwiseoperators/P1ElementwiseOperator.hpp"
+#include "hyteg/geometry/IcosahedralShellMap.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/P1PolynomialBlendingOperator.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// This test compares the 3D polynomial surrogate operators to the elementwise operators with the same form.
+// Without blending the stencils are constant in each macro-cell, so that already the polynomials of degree zero
+// must reproduce the elementwise operators up to round-off. On the blended spherical shell the error must decrease
+// when the polynomial degree is increased.
+
+using walberla::real_t;
+using namespace hyteg;
+
+template < typename ElementwiseOpType, typename PolynomialOpType >
+real_t surrogateError( const std::shared_ptr< PrimitiveStorage >& storage,
+                       const uint_t                               level,
+                       const uint_t                               interpolationLevel,
+                       const uint_t                               polyDegree )
+{
+   P1Function< real_t > src( "src", storage, level, level );
+   P1Function< real_t > dstElementwise( "dstElementwise", storage, level, level );
+   P1Function< real_t > dstPolynomial( "dstPolynomial", storage, level, level );
+   P1Function< real_t > error( "error", storage, level, level );
+
+   ElementwiseOpType elementwiseOp( storage, level, level );
+   PolynomialOpType  polynomialOp( storage, level, level, interpolationLevel, polyDegree );
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+   src.interpolate( func, level, All );
+
+   elementwiseOp.apply( src, dstElementwise, level, All, Replace );
+   polynomialOp.apply( src, dstPolynomial, level, All, Replace );
+
+   error.assign( {1.0, -1.0}, {dstElementwise, dstPolynomial}, level, All );
+   const real_t relativeError =
+       std::sqrt( error.dotGlobal( error, level, All ) / dstElementwise.dotGlobal( dstElementwise, level, All ) );
+   WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ", degree " << polyDegree << ": relative error " << relativeError )
+   return relativeError;
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   const uint_t numProcesses = walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   {
+      SetupPrimitiveStorage setupStorage( MeshInfo::fromGmshFile( "../../data/meshes/3D/cube_6el.msh" ), numProcesses );
+      loadbalancing::roundRobin( setupStorage );
+      auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "Laplace, cube" )
+      for ( uint_t level = 2; level <= 4; level++ )
+      {
+         const real_t error =
+             surrogateError< P1ElementwiseBlendingLaplaceOperator3D, P1PolynomialBlendingLaplaceOperator3D >( storage, level, 3, 0 );
+         WALBERLA_CHECK_LESS( error, 1e-12 );
+      }
+
+      WALBERLA_LOG_INFO_ON_ROOT( "Mass, cube" )
+      for ( uint_t level = 2; level <= 4; level++ )
+      {
+         const real_t error =
+             surrogateError< P1ElementwiseBlendingMassOperator3D, P1PolynomialBlendingMassOperator3D >( storage, level, 3, 0 );
+         WALBERLA_CHECK_LESS( error, 1e-12 );
+      }
+   }
+
+   {
+      SetupPrimitiveStorage setupStorage( MeshInfo::meshSphericalShell( 3, 2, 0.5, 1.0 ), numProcesses );
+      loadbalancing::roundRobin( setupStorage );
+      IcosahedralShellMap::setMap( setupStorage );
+      auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "Laplace, blended shell" )
+      const real_t errorDegree0 =
+          surrogateError< P1ElementwiseBlendingLaplaceOperator3D, P1PolynomialBlendingLaplaceOperator3D >( storage, 4, 3, 0 );
+      const real_t errorDegree4 =
+          surrogateError< P1ElementwiseBlendingLaplaceOperator3D, P1PolynomialBlendingLaplaceOperator3D >( storage, 4, 3, 4 );
+      WALBERLA_CHECK_LESS( errorDegree4, errorDegree0 );
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "core/DataTypes.h"
+#include "core/mpi/MPIManager.h"
+
+#include "hyteg/elementwiseoperators/P1ToP2ElementwiseOperator.hpp"
+#include "hyteg/elementwiseoperators/P2ElementwiseOperator.hpp"
+#include "hyteg/geometry/IcosahedralShellMap.hpp"
+#include "hyteg/mesh/MeshInfo.hpp"
+#include "hyteg/mixedoperators/P1ToP2SurrogateOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p2functionspace/P2Function.hpp"
+#include "hyteg/p2functionspace/P2SurrogateOperator.hpp"
+#include "hyteg/primitivestorage/SetupPrimitiveStorage.hpp"
+#include "hyteg/primitivestorage/loadbalancing/SimpleBalancer.hpp"
+
+// This test compares the 3D polynomial surrogate operators with P2 range to the elementwise operators with the same form.
+// Without blending the stencils are constant in each macro-cell, so that already the polynomials of degree zero
+// must reproduce the elementwise operators up to round-off. On the blended spherical shell the error must decrease
+// when the polynomial degree is increased.
+
+using walberla::real_t;
+using namespace hyteg;
+
+template < typename ElementwiseOpType, typename SurrogateOpType >
+real_t surrogateError( const std::shared_ptr< PrimitiveStorage >& storage,
+                       const uint_t                               level,
+                       const uint_t                               interpolationLevel,
+                       const uint_t                               polyDegree )
+{
+   typename SurrogateOpType::srcType src( "src", storage, level, level );
+   typename SurrogateOpType::dstType dstElementwise( "dstElementwise", storage, level, level );
+   typename SurrogateOpType::dstType dstSurrogate( "dstSurrogate", storage, level, level );
+   typename SurrogateOpType::dstType error( "error", storage, level, level );
+
+   ElementwiseOpType elementwiseOp( storage, level, level );
+   SurrogateOpType   surrogateOp( storage, level, level, interpolationLevel, polyDegree );
+
+   auto func = []( const Point3D& x ) { return std::sin( x[0] ) + 6.0 * std::sin( x[1] * x[1] * x[1] ) + x[2] * x[2] * x[2]; };
+   src.interpolate( func, level, All );
+
+   elementwiseOp.apply( src, dstElementwise, level, All, Replace );
+   surrogateOp.apply( src, dstSurrogate, level, All, Replace );
+
+   error.assign( { 1.0, -1.0 }, { dstElementwise, dstSurrogate }, level, All );
+   const real_t relativeError =
+       std::sqrt( error.dotGlobal( error, level, All ) / dstElementwise.dotGlobal( dstElementwise, level, All ) );
+   WALBERLA_LOG_INFO_ON_ROOT( "level " << level << ", degree " << polyDegree << ": relative error " << relativeError )
+   return relativeError;
+}
+
+int main( int argc, char* argv[] )
+{
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   const uint_t numProcesses = walberla::uint_c( walberla::mpi::MPIManager::instance()->numProcesses() );
+
+   {
+      SetupPrimitiveStorage setupStorage( MeshInfo::fromGmshFile( "../../data/meshes/3D/cube_6el.msh" ), numProcesses );
+      loadbalancing::roundRobin( setupStorage );
+      auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+      for ( uint_t level = 2; level <= 3; level++ )
+      {
+         WALBERLA_LOG_INFO_ON_ROOT( "Laplace, cube" )
+         WALBERLA_CHECK_LESS(
+             ( surrogateError< P2ElementwiseBlendingLaplaceOperator, P2SurrogateLaplaceOperator >( storage, level, 3, 0 ) ),
+             1e-12 );
+
+         WALBERLA_LOG_INFO_ON_ROOT( "Mass, cube" )
+         WALBERLA_CHECK_LESS(
+             ( surrogateError< P2ElementwiseBlendingMassOperator, P2SurrogateMassOperator >( storage, level, 3, 0 ) ), 1e-12 );
+
+         WALBERLA_LOG_INFO_ON_ROOT( "DivT_z, cube" )
+         WALBERLA_CHECK_LESS(
+             ( surrogateError< P1ToP2ElementwiseBlendingDivTzOperator, P1ToP2SurrogateDivTzOperator >( storage, level, 3, 0 ) ),
+             1e-12 );
+      }
+   }
+
+   {
+      SetupPrimitiveStorage setupStorage( MeshInfo::meshSphericalShell( 3, 2, 0.5, 1.0 ), numProcesses );
+      loadbalancing::roundRobin( setupStorage );
+      IcosahedralShellMap::setMap( setupStorage );
+      auto storage = std::make_shared< PrimitiveStorage >( setupStorage );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "Laplace, blended shell" )
+      const real_t laplaceErrorDegree0 =
+          surrogateError< P2ElementwiseBlendingLaplaceOperator, P2SurrogateLaplaceOperator >( storage, 3, 3, 0 );
+      const real_t laplaceErrorDegree4 =
+          surrogateError< P2ElementwiseBlendingLaplaceOperator, P2SurrogateLaplaceOperator >( storage, 3, 3, 4 );
+      WALBERLA_CHECK_LESS( laplaceErrorDegree4, laplaceErrorDegree0 );
+
+      WALBERLA_LOG_INFO_ON_ROOT( "DivT_x, blended shell" )
+      const real_t divTErrorDegree0 =
+          surrogateError< P1ToP2ElementwiseBlendingDivTxOperator, P1ToP2SurrogateDivTxOperator >( storage, 3, 3, 0 );
+      const real_t divTErrorDegree4 =
+          surrogateError< P1ToP2ElementwiseBlendingDivTxOperator, P1ToP2SurrogateDivTxOperator >( storage, 3, 3, 4 );
+      WALBERLA_CHECK_LESS( divTErrorDegree4, divTErrorDegree0 );
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 agent.
+ *
+ * This file is part of HyTeG
+ * (see https://i10git.cs.fau.de/hyteg/hyteg).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <map>
+
+#include "core/Environment.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/mpi/RecvBuffer.h"
+#include "core/mpi/SendBuffer.h"
+
+#include "hyteg/p1functionspace/P1ConstantOperator.hpp"
+#include "hyteg/p1functionspace/P1Function.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCell.hpp"
+#include "hyteg/p1functionspace/VertexDoFMacroCellStencil.hpp"
+#include "hyteg/p1functionspace/generatedKernels/apply_3D_macrocell_vertexdof_to_vertexdof_replace.hpp"
+#include "hyteg/primitivestorage/PrimitiveStorage.hpp"
+
+namespace hyteg {
+
+using walberla::real_c;
+using walberla::real_t;
+using walberla::uint_t;
+
+static void testStencilLayout()
+{
+   // the flat layout must match the lexicographic order of the increments
+   std::map< indexing::IndexIncrement, real_t > stencilMap;
+   for ( const auto& neighbor : vertexdof::macrocell::neighborsWithCenter )
+   {
+      const auto increment  = vertexdof::logicalIndexOffsetFromVertex( neighbor );
+      stencilMap[increment] = real_c( 10 * increment.x() + 3 * increment.y() + increment.z() );
+   }
+   WALBERLA_CHECK_EQUAL( stencilMap.size(), vertexdof::macrocell::stencilSize );
+
+   vertexdof::macrocell::FlatStencil stencil( stencilMap );
+
+   uint_t position = 0;
+   for ( const auto& it : stencilMap )
+   {
+      WALBERLA_CHECK_EQUAL( vertexdof::macrocell::stencilIndex( it.first.x(), it.first.y(), it.first.z() ), position );
+      WALBERLA_CHECK_EQUAL( stencil.count( it.first ), uint_t( 1 ) );
+      WALBERLA_CHECK_FLOAT_EQUAL( stencil.data()[position], it.second );
+      WALBERLA_CHECK_FLOAT_EQUAL( stencil[it.first], it.second );
+      position++;
+   }
+
+   WALBERLA_CHECK_EQUAL( stencil.count( indexing::IndexIncrement( 1, 1, 0 ) ), uint_t( 0 ) );
+   WALBERLA_CHECK_EQUAL( stencil.count( indexing::IndexIncrement( 0, 0, 2 ) ), uint_t( 0 ) );
+
+   walberla::mpi::SendBuffer sendBuffer;
+   sendBuffer << stencil;
+   walberla::mpi::RecvBuffer         recvBuffer( sendBuffer );
+   vertexdof::macrocell::FlatStencil received;
+   recvBuffer >> received;
+
+   for ( uint_t i = 0; i < vertexdof::macrocell::stencilSize; i++ )
+   {
+      WALBERLA_CHECK_FLOAT_EQUAL( received.data()[i], stencil.data()[i] );
+   }
+}
+
+static void testGeneratedApply( const uint_t& level )
+{
+   auto storage = PrimitiveStorage::createFromGmshFile( "../../data/meshes/3D/cube_6el.msh" );
+
+   P1ConstantLaplaceOperator L( storage, level, level );
+
+   P1Function< real_t > src( "src", storage, level, level );
+   P1Function< real_t > dstReference( "dstReference", storage, level, level );
+   P1Function< real_t > dstGenerated( "dstGenerated", storage, level, level );
+
+   src.interpolate( []( const Point3D& x ) { return std::sin( 3 * x[0] ) + x[1] * x[2]; }, level );
+
+   // the generated kernel reads the weights from the flat stencil memory via fixed offsets
+   for ( const auto& it : storage->getCells() )
+   {
+      Cell& cell = *it.second;
+
+      vertexdof::macrocell::apply< real_t >(
+          level, cell, L.getCellStencilID(), src.getCellDataID(), dstReference.getCellDataID(), Replace );
+
+      const auto& stencil = cell.getData( L.getCellStencilID() )->getData( level );
+      vertexdof::macrocell::generated::apply_3D_macrocell_vertexdof_to_vertexdof_replace(
+          cell.getData( dstGenerated.getCellDataID() )->getPointer( level ),
+          cell.getData( src.getCellDataID() )->getPointer( level ),
+          static_cast< int32_t >( level ),
+          stencil.toMap() );
+
+      const real_t* reference = cell.getData( dstReference.getCellDataID() )->getPointer( level );
+      const real_t* generated = cell.getData( dstGenerated.getCellDataID() )->getPointer( level );
+      for ( const auto& idx : vertexdof::macrocell::Iterator( level, 1 ) )
+      {
+         const uint_t arrayIdx = vertexdof::macrocell::index( level, idx.x(), idx.y(), idx.z() );
+         WALBERLA_CHECK_FLOAT_EQUAL( generated[arrayIdx], reference[arrayIdx] );
+      }
+   }
+}
+
+} // namespace hyteg
+
+int main( int argc, char* argv[] )
+{
+   walberla::debug::enterTestMode();
+
+   walberla::Environment walberlaEnv( argc, argv );
+   walberla::MPIManager::instance()->useWorldComm();
+
+   hyteg::testStencilLayout();
+   hyteg::testGeneratedApply( 2 );
+   hyteg::testGeneratedApply( 4 );
+
+   return EXIT_SUCCESS;
+}